@@ -0,0 +1,70 @@
+#!/bin/bash
+#
+# Strong and weak scaling of a GROOPS config file over numbers of MPI processes.
+#
+# Usage: runScaling.sh [-p "3 5 9 17"] [-w name=value:exponent] [-m mpirun] [-g groopsMPI] <config.xml> [groops options]
+#   -p  list of process counts (the master mainly distributes the work, so use 2^n+1)
+#   -w  weak scaling: the global variable name is set to value*workers^exponent,
+#       e.g. -w gridSpacing=1:-0.5 for normalsBuildScaling.xml (observations ~ workers)
+#   -m  MPI launcher (default: mpirun), the process count is appended as '-np <count>'
+#   -g  GROOPS MPI executable (default: groopsMPI)
+# Further groops options (e.g. --global maxDegree=120 --threads 4) are passed to every run.
+#
+# Output (tab separated, one line per run):
+#   processes  workers  weakVariable  wallTime[s]  speedup  efficiency
+# Speedup and efficiency are relative to the first run (strong scaling: time1*workers1/(time*workers),
+# weak scaling: time1/time). The log of each run is written to scaling.<processes>.log.
+#
+# Example (GRACE-like normal equations at degree 120 without external data):
+#   runScaling.sh -p "3 5 9 17 33" normalsBuildScaling.xml --global maxDegree=120 --global gridSpacing=0.25 --global workDir=/tmp
+#   runScaling.sh -p "3 5 9 17 33" -w gridSpacing=1:-0.5 normalsBuildScaling.xml --global maxDegree=120 --global workDir=/tmp
+
+PROCESSES="3 5 9 17"
+WEAK=""
+MPIRUN="mpirun"
+GROOPS="groopsMPI"
+while getopts "p:w:m:g:" opt; do
+  case $opt in
+    p) PROCESSES="$OPTARG" ;;
+    w) WEAK="$OPTARG" ;;
+    m) MPIRUN="$OPTARG" ;;
+    g) GROOPS="$OPTARG" ;;
+    *) sed -n '3,20p' "$0"; exit 1 ;;
+  esac
+done
+shift $((OPTIND-1))
+if [ $# -lt 1 ]; then
+  sed -n '3,20p' "$0"
+  exit 1
+fi
+CONFIG="$1"
+shift
+
+printf "processes\tworkers\tweakVariable\twallTime[s]\tspeedup\tefficiency\n"
+TIME1=""
+for P in $PROCESSES; do
+  WORKERS=$(( P>1 ? P-1 : 1 ))
+  WEAKARG=()
+  WEAKVALUE="-"
+  if [ -n "$WEAK" ]; then
+    NAME="${WEAK%%=*}"
+    VALUE="${WEAK#*=}"
+    WEAKVALUE=$(awk -v v="${VALUE%%:*}" -v e="${VALUE#*:}" -v w="$WORKERS" 'BEGIN {printf "%.10g", v*w^e}')
+    WEAKARG=(--global "$NAME=$WEAKVALUE")
+  fi
+
+  START=$(date +%s.%N)
+  $MPIRUN -np "$P" "$GROOPS" "${WEAKARG[@]}" "$@" "$CONFIG" > "scaling.$P.log" 2>&1 || { echo "run with $P processes failed (see scaling.$P.log)" >&2; exit 1; }
+  END=$(date +%s.%N)
+
+  TIME=$(awk -v s="$START" -v e="$END" 'BEGIN {printf "%.3f", e-s}')
+  if [ -z "$TIME1" ]; then
+    TIME1=$TIME
+    WORKERS1=$WORKERS
+  fi
+  if [ -n "$WEAK" ]; then
+    awk -v p="$P" -v w="$WORKERS" -v x="$WEAKVALUE" -v t="$TIME" -v t1="$TIME1" 'BEGIN {printf "%i\t%i\t%s\t%s\t%.3f\t%.3f\n", p, w, x, t, t1/t, t1/t}'
+  else
+    awk -v p="$P" -v w="$WORKERS" -v t="$TIME" -v t1="$TIME1" -v w1="$WORKERS1" 'BEGIN {printf "%i\t%i\t-\t%s\t%.3f\t%.3f\n", p, w, t, t1/t, t1*w1/(t*w)}'
+  fi
+done
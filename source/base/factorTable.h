@@ -0,0 +1,77 @@
+/***********************************************/
+/**
+* @file factorTable.h
+*
+* @brief Lazily computed tables of recursion factors.
+*
+* @author GROOPS Developers
+* @date 2026-10-14
+*
+*/
+/***********************************************/
+
+#ifndef __GROOPS_FACTORTABLE__
+#define __GROOPS_FACTORTABLE__
+
+#include "base/importStd.h"
+#include <atomic>
+#include <mutex>
+
+/***** CLASS ***********************************/
+
+/** @brief Lazily computed table of recursion factors up to a maximum degree.
+* @ingroup base
+* A table computed for degree N serves all requests up to N. The tables are immutable
+* and can be read by many threads simultaneously without locking. If a higher degree is requested
+* a new table is computed (at least 1.5 times the previous degree to avoid frequent recomputation).
+* The previous tables are kept alive, as references to them may still be in use by other threads.
+* @code
+* static FactorTable<Factors> table([](UInt degree) {Factors f; ...; return f;});
+* const Factors &factors = table(degree);
+* @endcode */
+template<typename T>
+class FactorTable
+{
+  struct Entry
+  {
+    UInt degree;
+    T    factors;
+  };
+
+  std::function<T(UInt)>              compute;
+  std::mutex                          mutex;
+  std::vector<std::unique_ptr<Entry>> entries;
+  std::atomic<const Entry*>           current;
+
+public:
+  /** @brief Constructor.
+  * @param compute function computing the factors up to degree (inclusive). */
+  explicit FactorTable(std::function<T(UInt)> compute) : compute(compute), current(nullptr) {}
+
+  FactorTable(const FactorTable &) = delete;
+  FactorTable &operator=(const FactorTable &) = delete;
+
+  /** @brief Factors valid at least up to @a degree.
+  * The reference stays valid until the end of the program. */
+  const T &operator()(UInt degree)
+  {
+    const Entry *entry = current.load(std::memory_order_acquire);
+    if(entry && (entry->degree >= degree))
+      return entry->factors;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    entry = current.load(std::memory_order_relaxed);
+    if(!entry || (entry->degree < degree))
+    {
+      const UInt degreeNew = (entry) ? std::max(degree, entry->degree + entry->degree/2) : degree;
+      entries.push_back(std::unique_ptr<Entry>(new Entry{degreeNew, compute(degreeNew)}));
+      entry = entries.back().get();
+      current.store(entry, std::memory_order_release);
+    }
+    return entry->factors;
+  }
+};
+
+/***********************************************/
+
+#endif /* __GROOPS_FACTORTABLE__ */
@@ -43,16 +43,19 @@ std::string operator%(LongDouble value, const std::string &format)
         throw(Exception("expecting qualifier after '%'"));
 
       // parse %[flags][width][.precision]specifier format
-      std::stringstream ss;
       auto c = format.at(posFormat++);
 
       Bool hasSubSpecifiers = FALSE;
+      Char fill      = ' ';
+      Bool left      = FALSE;
+      Int  width     = 0;
+      Int  precision = -1;
       // [flags]
       for(;;)
       {
-        if(c=='0')      ss.fill('0');
-        else if(c==' ') ss.fill(' ');
-        else if(c=='-') ss.setf(std::ios_base::left, std::ios_base::adjustfield);
+        if(c=='0')      fill = '0';
+        else if(c==' ') fill = ' ';
+        else if(c=='-') left = TRUE;
         else if(c=='#') throw(Exception("'#' not supported"));
         else if(c=='+') throw(Exception("'+' not supported"));
         else break;
@@ -65,7 +68,7 @@ std::string operator%(LongDouble value, const std::string &format)
       {
         const char *ptr1 = format.c_str()+posFormat-1;
         char *ptr2;
-        ss.width(std::strtol(ptr1, &ptr2, 10));
+        width = static_cast<Int>(std::strtol(ptr1, &ptr2, 10));
         posFormat += ptr2-ptr1-1;
         c = format.at(posFormat++);
         hasSubSpecifiers = TRUE;
@@ -76,12 +79,46 @@ std::string operator%(LongDouble value, const std::string &format)
       {
         const char *ptr1 = format.c_str()+posFormat;
         char *ptr2;
-        ss.precision(std::strtol(ptr1, &ptr2, 10));
+        precision = static_cast<Int>(std::strtol(ptr1, &ptr2, 10));
         posFormat += ptr2-ptr1;
         c = format.at(posFormat++);
         hasSubSpecifiers = TRUE;
       }
 
+      // fast path for numbers without a stream (same result as the stream formatting below)
+      // streams pad zeros in front of the sign, printf after the sign
+      if((c=='i') || (c=='f') || (c=='e') || (c=='g'))
+      {
+        const Bool isNegative = (c=='i') ? (std::round(value) < 0) : (std::signbit(value) || !std::isfinite(value));
+        if((fill != '0') || (!left && !isNegative))
+        {
+          char buffer[256];
+          Int  size;
+          if(c=='i')
+            size = std::snprintf(buffer, sizeof(buffer), left ? "%-*d" : ((fill == '0') ? "%0*d" : "%*d"), width, static_cast<int>(std::round(value)));
+          else
+          {
+            const char formatNumber[] = {'%', '*', '.', '*', 'L', c, '\0'};
+            const char formatLeft[]   = {'%', '-', '*', '.', '*', 'L', c, '\0'};
+            const char formatZero[]   = {'%', '0', '*', '.', '*', 'L', c, '\0'};
+            size = std::snprintf(buffer, sizeof(buffer), left ? formatLeft : ((fill == '0') ? formatZero : formatNumber), width, (precision < 0) ? 6 : precision, value);
+          }
+          if((size >= 0) && (size < static_cast<Int>(sizeof(buffer))))
+          {
+            result.append(buffer, size);
+            continue;
+          }
+        }
+      }
+
+      std::stringstream ss;
+      ss.fill(fill);
+      if(left)
+        ss.setf(std::ios_base::left, std::ios_base::adjustfield);
+      ss.width(width);
+      if(precision >= 0)
+        ss.precision(precision);
+
       // specifier
       switch(c)
       {
@@ -13,6 +13,9 @@
 #include "base/importStd.h"
 #include "base/matrix.h"
 #include "base/fourier.h"
+#include "parallel/threadPool.h"
+#include <map>
+#include <mutex>
 
 /***********************************************/
 
@@ -162,6 +165,66 @@ static inline void recursiveFft(Bool inverse, std::complex<Double> *f, const std
   }
 }
 
+/***********************************************/
+
+// twiddle factors and radix decomposition of a complex FFT with given length
+// (computed once per length and shared between threads)
+class FftPlan
+{
+public:
+  UInt                              count;
+  std::vector<UInt>                 factors;
+  std::vector<std::complex<Double>> twiddles, twiddlesInverse; // exp(-+2pi*i*k/count)
+  std::vector<std::complex<Double>> twiddlesReal;              // exp(-pi*i*k/count), k=0..count, for real transforms of length 2*count
+
+  explicit FftPlan(UInt count);
+  void transform(Bool inverse, const std::complex<Double> *input, std::complex<Double> *output) const;
+  static std::shared_ptr<const FftPlan> plan(UInt count);
+};
+
+/***********************************************/
+
+FftPlan::FftPlan(UInt count) : count(count), twiddles(count), twiddlesInverse(count), twiddlesReal(count+1)
+{
+  for(UInt i=0; i<count; i++)
+  {
+    twiddles[i]        = std::polar(1., -2*PI*i/count);
+    twiddlesInverse[i] = std::conj(twiddles[i]);
+  }
+  for(UInt i=0; i<=count; i++)
+    twiddlesReal[i] = std::polar(1., -PI*i/count);
+  if(count > 1)
+    factors = computeRadix(count);
+}
+
+/***********************************************/
+
+void FftPlan::transform(Bool inverse, const std::complex<Double> *input, std::complex<Double> *output) const
+{
+  if(count == 1)
+    output[0] = input[0];
+  else
+    recursiveFft(inverse, output, input, factors.data(), (inverse) ? twiddlesInverse : twiddles, 1);
+}
+
+/***********************************************/
+
+std::shared_ptr<const FftPlan> FftPlan::plan(UInt count)
+{
+  static std::mutex mutex;
+  static std::map<UInt, std::shared_ptr<const FftPlan>> plans;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto iter = plans.find(count);
+  if(iter != plans.end())
+    return iter->second;
+  if(plans.size() >= 64) // do not accumulate plans of arbitrary lengths
+    plans.clear();
+  auto plan = std::make_shared<const FftPlan>(count);
+  plans[count] = plan;
+  return plan;
+}
+
 /***********************************************/
 /***********************************************/
 
@@ -170,20 +233,41 @@ std::vector<std::complex<Double>> Fourier::fft(const Vector &data)
   try
   {
     const UInt count = data.rows();
+    if(count == 0)
+      return std::vector<std::complex<Double>>();
 
-    std::vector<std::complex<Double>> input(count);
-    for(UInt i=0; i<count; i++)
-      input[i] = data(i);
-
-    // compute twiddle factors
-    std::vector<std::complex<Double>> twiddles(count);
-    for(UInt i=0; i<twiddles.size(); i++)
-      twiddles[i] = std::exp(std::complex<Double>(0, -2*PI*i/count));
+    // odd length: complex transform
+    if(count % 2)
+    {
+      auto plan = FftPlan::plan(count);
+      std::vector<std::complex<Double>> input(count);
+      for(UInt i=0; i<count; i++)
+        input[i] = data(i);
+      std::vector<std::complex<Double>> F(count);
+      plan->transform(FALSE/*inverse*/, input.data(), F.data());
+      F.resize((count+2)/2);
+      return F;
+    }
 
-    std::vector<std::complex<Double>> F(twiddles.size());
-    std::vector<UInt> factors = computeRadix(twiddles.size());
-    recursiveFft(FALSE/*inverse*/, F.data(), input.data(), factors.data(), twiddles, 1);
-    F.resize((count+2)/2);
+    // even length: real sequence is packed into complex sequence of half length
+    // z_j = x_2j + i*x_2j+1
+    const UInt m = count/2;
+    auto plan = FftPlan::plan(m);
+    std::vector<std::complex<Double>> z(m), Z(m);
+    for(UInt j=0; j<m; j++)
+      z[j] = std::complex<Double>(data(2*j), data(2*j+1));
+    plan->transform(FALSE/*inverse*/, z.data(), Z.data());
+
+    // separate even and odd part: X_k = E_k + exp(-2pi*i*k/count) O_k
+    std::vector<std::complex<Double>> F(m+1);
+    for(UInt k=0; k<=m; k++)
+    {
+      const std::complex<Double> a = Z[k%m];
+      const std::complex<Double> b = std::conj(Z[(m-k)%m]);
+      const std::complex<Double> E = 0.5*(a+b);
+      const std::complex<Double> O = std::complex<Double>(0,-0.5)*(a-b);
+      F[k] = E + plan->twiddlesReal[k] * O;
+    }
     return F;
   }
   catch(std::exception &e)
@@ -198,29 +282,92 @@ Vector Fourier::synthesis(const std::vector<std::complex<Double>> &F, Bool count
 {
   try
   {
+    if(F.size() == 0)
+      return Vector();
     const UInt count = 2*F.size() - (countEven ? 2 : 1);
 
-    // extent input symmetric
-    std::vector<std::complex<Double>> F2(count);
-    F2[0] = F[0];
-    for(UInt i=1; i<F.size(); i++)
+    // odd length: complex transform
+    if(!countEven)
     {
-      F2[i]       = F[i];
-      F2[count-i] = std::conj(F[i]);
+      // extent input symmetric
+      std::vector<std::complex<Double>> F2(count);
+      F2[0] = F[0];
+      for(UInt i=1; i<F.size(); i++)
+      {
+        F2[i]       = F[i];
+        F2[count-i] = std::conj(F[i]);
+      }
+
+      auto plan = FftPlan::plan(count);
+      std::vector<std::complex<Double>> F3(count);
+      plan->transform(TRUE/*inverse*/, F2.data(), F3.data());
+
+      Vector data(count);
+      for(UInt i=0; i<count; i++)
+        data(i) = (1./count)*F3[i].real();
+      return data;
     }
 
-    // compute twiddle factors
-    std::vector<std::complex<Double>> twiddles(count);
-    for(UInt i=0; i<twiddles.size(); i++)
-      twiddles[i] = std::exp(std::complex<Double>(0, 2*PI*i/count));
-
-    std::vector<std::complex<Double>> F3(twiddles.size());
-    std::vector<UInt> factors = computeRadix(twiddles.size());
-    recursiveFft(TRUE/*inverse*/, F3.data(), F2.data(), factors.data(), twiddles, 1);
+    // even length: inverse of the packed real transform
+    const UInt m = count/2;
+    auto plan = FftPlan::plan(m);
+    std::vector<std::complex<Double>> Z(m), z(m);
+    for(UInt k=0; k<m; k++)
+    {
+      // imaginary parts of first and last coefficient have no influence on a real sequence
+      const std::complex<Double> a = (k==0) ? std::complex<Double>(F[0].real()) : F[k];
+      const std::complex<Double> b = (k==0) ? std::complex<Double>(F[m].real()) : std::conj(F[m-k]);
+      const std::complex<Double> E = 0.5*(a+b);
+      const std::complex<Double> O = 0.5*(a-b) * std::conj(plan->twiddlesReal[k]);
+      Z[k] = E + std::complex<Double>(0,1)*O;
+    }
+    plan->transform(TRUE/*inverse*/, Z.data(), z.data());
 
     Vector data(count);
-    for(UInt i=0; i<F3.size(); i++)
-      data(i) = (1./count)*F3[i].real();
+    for(UInt j=0; j<m; j++)
+    {
+      data(2*j+0) = (1./m)*z[j].real();
+      data(2*j+1) = (1./m)*z[j].imag();
+    }
+    return data;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+std::vector<std::vector<std::complex<Double>>> Fourier::fftColumns(const_MatrixSliceRef data)
+{
+  try
+  {
+    std::vector<std::vector<std::complex<Double>>> F(data.columns());
+    Parallel::threadLoop(0, data.columns(), [&](UInt k) {F.at(k) = fft(data.column(k));});
+    return F;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Matrix Fourier::synthesisColumns(const std::vector<std::vector<std::complex<Double>>> &F, Bool countEven)
+{
+  try
+  {
+    if(!F.size())
+      return Matrix();
+    Matrix data(2*F.at(0).size() - (countEven ? 2 : 1), F.size());
+    Parallel::threadLoop(0, F.size(), [&](UInt k)
+    {
+      if(F.at(k).size() != F.at(0).size())
+        throw(Exception("all columns must have the same number of coefficients"));
+      copy(synthesis(F.at(k), countEven), data.column(k));
+    });
     return data;
   }
   catch(std::exception &e)
@@ -231,6 +378,98 @@ Vector Fourier::synthesis(const std::vector<std::complex<Double>> &F, Bool count
 
 /***********************************************/
 
+UInt Fourier::paddedLength(UInt count)
+{
+  for(UInt n=std::max(count+(count%2), UInt(2));; n+=2)
+  {
+    UInt m = n;
+    for(UInt p : {2, 3, 5})
+      while(m % p == 0)
+        m /= p;
+    if(m == 1)
+      return n;
+  }
+}
+
+/***********************************************/
+
+// spectra of columns padded with zeros to length count
+static std::vector<std::vector<std::complex<Double>>> paddedSpectra(const_MatrixSliceRef x, UInt count)
+{
+  Matrix padded(count, x.columns());
+  copy(x, padded.row(0, x.rows()));
+  return Fourier::fftColumns(padded);
+}
+
+/***********************************************/
+
+Matrix Fourier::crossCorrelation(const_MatrixSliceRef x, const_MatrixSliceRef y, UInt maxLag)
+{
+  try
+  {
+    if((x.rows() != y.rows()) || (x.columns() != y.columns()))
+      throw(Exception("Dimension error: x("+x.rows()%"%i x "s+x.columns()%"%i) != y("s+y.rows()%"%i x "s+y.columns()%"%i)"s));
+
+    Matrix C(2*maxLag+1, x.columns());
+    if(!x.size())
+      return C;
+    maxLag = std::min(maxLag, x.rows()-1);
+    const UInt count = paddedLength(x.rows()+maxLag);
+    auto F = paddedSpectra(x, count);
+    auto G = paddedSpectra(y, count);
+    Parallel::threadLoop(0, F.size(), [&](UInt k)
+    {
+      for(UInt i=0; i<F.at(k).size(); i++)
+        F.at(k).at(i) = std::conj(F.at(k).at(i)) * G.at(k).at(i);
+      const Vector c = synthesis(F.at(k), TRUE/*countEven*/);
+      C(C.rows()/2, k) = c(0);
+      for(UInt h=1; h<=maxLag; h++)
+      {
+        C(C.rows()/2+h, k) = c(h);
+        C(C.rows()/2-h, k) = c(count-h);
+      }
+    });
+    return C;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+std::vector<Matrix> Fourier::laggedProducts(const_MatrixSliceRef x, UInt maxLag)
+{
+  try
+  {
+    std::vector<Matrix> R(maxLag+1, Matrix(x.columns(), x.columns()));
+    if(!x.size())
+      return R;
+    const UInt lagCount = std::min(maxLag, x.rows()-1);
+    const UInt count    = paddedLength(x.rows()+lagCount);
+    const auto F = paddedSpectra(x, count);
+    Parallel::threadLoop(0, x.columns()*x.columns(), [&](UInt idx)
+    {
+      const UInt i = idx / x.columns();
+      const UInt k = idx % x.columns();
+      std::vector<std::complex<Double>> FF(F.at(i).size());
+      for(UInt n=0; n<FF.size(); n++)
+        FF.at(n) = std::conj(F.at(i).at(n)) * F.at(k).at(n);
+      const Vector c = synthesis(FF, TRUE/*countEven*/);
+      for(UInt h=0; h<=lagCount; h++)
+        R.at(h)(i, k) = c(h);
+    });
+    return R;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 Vector Fourier::frequencies(UInt count, Double dt)
 {
   Vector frequencies((count+2)/2);
@@ -294,7 +533,7 @@ Vector Fourier::covariance2psd(const Vector &cov, Double dt)
   try
   {
     Vector psd = 2*dt*cov; // one sided PSD
-    cosTransformation(psd);
+    ::cosTransformation(psd);
     return psd;
   }
   catch(std::exception &e)
@@ -310,7 +549,7 @@ Vector Fourier::psd2covariance(const Vector &psd, Double dt)
   try
   {
     Vector cov = 0.25/(dt*(psd.rows()-1))*psd; // from  one sided PSD
-    cosTransformation(cov);
+    ::cosTransformation(cov);
     return cov;
   }
   catch(std::exception &e)
@@ -320,3 +559,19 @@ Vector Fourier::psd2covariance(const Vector &psd, Double dt)
 }
 
 /***********************************************/
+
+Vector Fourier::cosTransformation(const Vector &x)
+{
+  try
+  {
+    Vector y = x;
+    ::cosTransformation(y);
+    return y;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
@@ -31,6 +31,8 @@ namespace Fourier
   * @f[ y_k = \sum_{j=0}^{n-1} x_j e^{-2\pi jk/n}, @f]
   * where @f$k = 0 \ldots [n/2]@f$.
   * This transform is normalized since a call of fft followed by a call of synthesis gives the original result.
+  * The twiddle factors are precomputed once per length and cached.
+  * Sequences with even length are transformed as complex sequence of half the length.
   * @param data data series
   * @return complex representation of the fourier transform */
   std::vector<std::complex<Double>> fft(const Vector &data);
@@ -50,6 +52,47 @@ namespace Fourier
   * @return data series */
   Vector synthesis(const std::vector<std::complex<Double>> &F, Bool countEven);
 
+  /** @brief Forward fourier transform of each column of @a data.
+  * Same as fft() for each column, all columns share the same precomputed twiddle factors
+  * and are transformed in parallel threads (see Parallel::threadLoop).
+  * @param data data series (columns)
+  * @return complex fourier coefficients for each column */
+  std::vector<std::vector<std::complex<Double>>> fftColumns(const_MatrixSliceRef data);
+
+  /** @brief Backward transform of complex fourier coefficients for many columns.
+  * Same as synthesis() for each column. All columns must have the same size.
+  * @param F complex fourier coefficients for each column
+  * @param countEven size of output columns is even
+  * @return data series (columns) */
+  Matrix synthesisColumns(const std::vector<std::vector<std::complex<Double>>> &F, Bool countEven);
+
+  /** @brief Efficient length for zero padding.
+  * Smallest even number @f$\geq@f$ @a count, which has only the prime factors 2, 3, and 5.
+  * @param count minimum length
+  * @return padded length */
+  UInt paddedLength(UInt count);
+
+  /** @brief Cross-correlation of corresponding columns with zero padded FFT.
+  * For each column pair @f$x@f$ and @f$y@f$ the lagged products
+  * @f[ c(h) = \sum_{t} x_t y_{t+h}, @f]
+  * are computed for the lags @f$h=-maxLag\ldots maxLag@f$, where the sum includes all epochs with both indices in range.
+  * The columns are padded with zeros to avoid circular wrap-around.
+  * @param x data series (columns)
+  * @param y data series (columns), same size as @a x
+  * @param maxLag maximum lag
+  * @return (2 maxLag+1) x columns, the row @f$maxLag+h@f$ contains the lag @f$h@f$ */
+  Matrix crossCorrelation(const_MatrixSliceRef x, const_MatrixSliceRef y, UInt maxLag);
+
+  /** @brief Lagged product matrices of all column pairs with zero padded FFT.
+  * Computes for the lags @f$h=0\ldots maxLag@f$ the matrices
+  * @f[ \M R_h = \sum_{t} \M x_t \M x_{t+h}^T, @f]
+  * where @f$\M x_t@f$ is the row @f$t@f$ of @a x. Each column is transformed once,
+  * the effort is independent of the number of lags.
+  * @param x data series (columns)
+  * @param maxLag maximum lag
+  * @return matrices (columns x columns) for each lag */
+  std::vector<Matrix> laggedProducts(const_MatrixSliceRef x, UInt maxLag);
+
   /** @brief Frequency computation.
   * This function creates a frequency vector of half the length of an input
   * data vector. The output vector contains frequencies measured in cycles per time.
@@ -87,6 +130,14 @@ namespace Fourier
   * @param dt sampling interval
   * @return covariance function */
   Vector psd2covariance(const Vector &psd, Double dt);
+
+  /** @brief Cosine transformation (DCT-I) with FFT.
+  * A sequence @f$x@f$ with @f$j=0\ldots n-1@f$ elements is transformed by
+  * @f[ y_k = x_0 + x_{n-1} (-1)^k + \sum_{j=1}^{n-2} 2 x_j \cos(\pi jk/(n-1)) @f]
+  * in @f$O(n\log n)@f$ operations.
+  * @param x data sequence
+  * @return transformed sequence */
+  Vector cosTransformation(const Vector &x);
 }
 
 /***********************************************/
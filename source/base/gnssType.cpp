@@ -503,16 +503,6 @@ Bool GnssType::isInList(const std::vector<GnssType> &types, UInt &idx) const
 
 /***********************************************/
 
-UInt GnssType::index(const std::vector<GnssType> &types, GnssType type)
-{
-  for(UInt i=0; i<types.size(); i++)
-    if(type == types.at(i))
-      return i;
-  return NULLINDEX;
-}
-
-/***********************************************/
-
 Bool GnssType::allEqual(const std::vector<GnssType> &types1, const std::vector<GnssType> &types2, GnssType mask)
 {
   try
@@ -652,20 +642,6 @@ GnssType GnssType::operator~() const
 
 /***********************************************/
 
-Bool GnssType::operator==(const GnssType &t) const
-{
-  if(type == t.type) return TRUE;
-  if((type & SYSTEM.type)    && (t.type & SYSTEM.type)    && ((type & SYSTEM.type)    != (t.type & SYSTEM.type)))    return FALSE;
-  if((type & FREQUENCY.type) && (t.type & FREQUENCY.type) && ((type & FREQUENCY.type) != (t.type & FREQUENCY.type))) return FALSE;
-  if((type & TYPE.type)      && (t.type & TYPE.type)      && ((type & TYPE.type)      != (t.type & TYPE.type)))      return FALSE;
-  if((type & ATTRIBUTE.type) && (t.type & ATTRIBUTE.type) && ((type & ATTRIBUTE.type) != (t.type & ATTRIBUTE.type))) return FALSE;
-  if((type & PRN.type)       && (t.type & PRN.type)       && ((type & PRN.type)       != (t.type & PRN.type)))       return FALSE;
-  if((type & FREQ_NO.type)   && (t.type & FREQ_NO.type)   && ((type & FREQ_NO.type)   != (t.type & FREQ_NO.type)))   return FALSE;
-  return TRUE;
-}
-
-/***********************************************/
-
 Bool GnssType::operator<(const GnssType &t) const
 {
   if((type & SYSTEM.type)    != (t.type & SYSTEM.type))    return ((t.type & SYSTEM.type)    == 0) || (((type & SYSTEM.type)    != 0) && ((type & SYSTEM.type)    < (t.type & SYSTEM.type)));
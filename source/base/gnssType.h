@@ -319,8 +319,42 @@ public:
 
   /** @brief Returns true if any part is neither the same nor matches a wildcard. */
   Bool operator!=(const GnssType &t) const { return !(*this==t); }
+
+private:
+  /** @brief Bit mask of all parts which are set (not a wildcard) in @a t. */
+  static constexpr UInt64 partsSet(UInt64 t);
 };
 
+/***********************************************/
+/***** INLINES *********************************/
+/***********************************************/
+
+constexpr UInt64 GnssType::partsSet(UInt64 t)
+{
+  // PRN, SYSTEM, FREQUENCY, TYPE, ATTRIBUTE, FREQ_NO
+  return ((t & 0x00000000ffull) ? 0x00000000ffull : 0) | ((t & 0x0000000f00ull) ? 0x0000000f00ull : 0)
+       | ((t & 0x000000f000ull) ? 0x000000f000ull : 0) | ((t & 0x0000ff0000ull) ? 0x0000ff0000ull : 0)
+       | ((t & 0x007f000000ull) ? 0x007f000000ull : 0) | ((t & 0xff00000000ull) ? 0xff00000000ull : 0);
+}
+
+/***********************************************/
+
+inline Bool GnssType::operator==(const GnssType &t) const
+{
+  // parts set in both types must be the same
+  return !((type ^ t.type) & partsSet(type) & partsSet(t.type));
+}
+
+/***********************************************/
+
+inline UInt GnssType::index(const std::vector<GnssType> &types, GnssType type)
+{
+  for(UInt i=0; i<types.size(); i++)
+    if(type == types[i])
+      return i;
+  return NULLINDEX;
+}
+
 /***********************************************/
 
 #endif /* __GROOPS___ */
@@ -153,6 +153,50 @@ Bool GriddedData::isValid() const
   }
 }
 
+/***********************************************/
+
+Matrix GriddedData::valuesMatrix() const
+{
+  try
+  {
+    if(!isValid())
+      throw(Exception("GriddedData is not valid"));
+    Matrix data(points.size(), values.size());
+    for(UInt k=0; k<values.size(); k++)
+      std::copy(values.at(k).begin(), values.at(k).end(), data.field()+k*data.ld());
+    return data;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void GriddedData::setValues(const_MatrixSliceRef data)
+{
+  try
+  {
+    if(data.rows() != points.size())
+      throw(Exception("data rows ("+data.rows()%"%i) must agree with point count ("s+points.size()%"%i)"s));
+    values.resize(data.columns());
+    for(UInt k=0; k<values.size(); k++)
+    {
+      values.at(k).resize(data.rows());
+      if(data.isRowMajorOrder())
+        for(UInt i=0; i<data.rows(); i++)
+          values.at(k).at(i) = data(i, k);
+      else
+        std::copy_n(&data(0, k), data.rows(), values.at(k).begin());
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
 /***********************************************/
 /***********************************************/
 
@@ -57,6 +57,13 @@ public:
   /** @brief Is GriddedData valid?.
   * Test dimensions of vectors. */
   Bool isValid() const;
+
+  /** @brief Values as one matrix (points x data columns).
+  * Each data column is copied as contiguous block. */
+  Matrix valuesMatrix() const;
+
+  /** @brief Replace all values by the columns of @a data (points x data columns). */
+  void setValues(const_MatrixSliceRef data);
 };
 
 /***** CLASS ***********************************/
@@ -0,0 +1,161 @@
+/***********************************************/
+/**
+* @file kdTree.cpp
+*
+* @brief Spatial index of points (k-d tree).
+*
+* @author GROOPS Developers
+* @date 2026-10-15
+*
+*/
+/***********************************************/
+
+#include "base/importStd.h"
+#include "base/kdTree.h"
+
+/***********************************************/
+
+void KdTree::init(const std::vector<Vector3d> &pointList)
+{
+  try
+  {
+    points.resize(pointList.size());
+    for(UInt i=0; i<pointList.size(); i++)
+      points.at(i) = {pointList.at(i).x(), pointList.at(i).y(), pointList.at(i).z()};
+    index.resize(points.size());
+    std::iota(index.begin(), index.end(), 0);
+    axis.resize(points.size());
+    build(0, points.size());
+
+    // store points in tree order
+    std::vector<std::array<Double,3>> tmp(points.size());
+    for(UInt i=0; i<index.size(); i++)
+      tmp.at(i) = points.at(index.at(i));
+    points.swap(tmp);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void KdTree::build(UInt begin, UInt end)
+{
+  if(end-begin < 2)
+    return;
+
+  // split along the largest extent
+  std::array<Double,3> minP = points[index[begin]];
+  std::array<Double,3> maxP = points[index[begin]];
+  for(UInt i=begin+1; i<end; i++)
+    for(UInt k=0; k<3; k++)
+    {
+      minP[k] = std::min(minP[k], points[index[i]][k]);
+      maxP[k] = std::max(maxP[k], points[index[i]][k]);
+    }
+  UInt split = 0;
+  for(UInt k=1; k<3; k++)
+    if(maxP[k]-minP[k] > maxP[split]-minP[split])
+      split = k;
+
+  // median
+  const UInt mid = (begin+end)/2;
+  std::nth_element(index.begin()+begin, index.begin()+mid, index.begin()+end,
+                   [&](UInt i, UInt k) {return points[i][split] < points[k][split];});
+  axis.at(mid) = split;
+
+  build(begin, mid);
+  build(mid+1, end);
+}
+
+/***********************************************/
+
+void KdTree::nearest(const std::array<Double,3> &p, UInt begin, UInt end, UInt &best, Double &bestDistance2) const
+{
+  if(begin >= end)
+    return;
+  const UInt   mid = (begin+end)/2;
+  const Double d2  = std::pow(points[mid][0]-p[0], 2) + std::pow(points[mid][1]-p[1], 2) + std::pow(points[mid][2]-p[2], 2);
+  if((d2 < bestDistance2) || ((d2 == bestDistance2) && (index[mid] < index[best])))
+  {
+    bestDistance2 = d2;
+    best = mid;
+  }
+  if(end-begin == 1)
+    return;
+
+  const Double delta = p[axis[mid]] - points[mid][axis[mid]];
+  if(delta < 0)
+  {
+    nearest(p, begin, mid, best, bestDistance2);
+    if(delta*delta <= bestDistance2)
+      nearest(p, mid+1, end, best, bestDistance2);
+  }
+  else
+  {
+    nearest(p, mid+1, end, best, bestDistance2);
+    if(delta*delta <= bestDistance2)
+      nearest(p, begin, mid, best, bestDistance2);
+  }
+}
+
+/***********************************************/
+
+UInt KdTree::nearest(const Vector3d &point, Double &distance) const
+{
+  try
+  {
+    distance = std::numeric_limits<Double>::infinity();
+    if(!size())
+      return MAX_UINT;
+    UInt   best = 0;
+    Double bestDistance2 = std::numeric_limits<Double>::infinity();
+    nearest({point.x(), point.y(), point.z()}, 0, points.size(), best, bestDistance2);
+    distance = std::sqrt(bestDistance2);
+    return index.at(best);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void KdTree::search(const std::array<Double,3> &p, Double radius2, UInt begin, UInt end, std::vector<UInt> &result) const
+{
+  if(begin >= end)
+    return;
+  const UInt mid = (begin+end)/2;
+  if(std::pow(points[mid][0]-p[0], 2) + std::pow(points[mid][1]-p[1], 2) + std::pow(points[mid][2]-p[2], 2) <= radius2)
+    result.push_back(index[mid]);
+  if(end-begin == 1)
+    return;
+
+  const Double delta = p[axis[mid]] - points[mid][axis[mid]];
+  if((delta < 0) || (delta*delta <= radius2))
+    search(p, radius2, begin, mid, result);
+  if((delta >= 0) || (delta*delta <= radius2))
+    search(p, radius2, mid+1, end, result);
+}
+
+/***********************************************/
+
+std::vector<UInt> KdTree::radiusSearch(const Vector3d &point, Double radius) const
+{
+  try
+  {
+    std::vector<UInt> result;
+    search({point.x(), point.y(), point.z()}, radius*radius, 0, points.size(), result);
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
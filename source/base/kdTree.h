@@ -0,0 +1,63 @@
+/***********************************************/
+/**
+* @file kdTree.h
+*
+* @brief Spatial index of points (k-d tree).
+*
+* @author GROOPS Developers
+* @date 2026-10-15
+*
+*/
+/***********************************************/
+
+#ifndef __GROOPS_KDTREE__
+#define __GROOPS_KDTREE__
+
+#include "base/importStd.h"
+#include "base/vector3d.h"
+
+/***** CLASS ***********************************/
+
+/** @brief Spatial index of points (k-d tree).
+* Nearest neighbor and radius searches in O(log n) instead of a loop over all points.
+* Distances are Euclidean. For searches by spherical distance use points projected onto the unit sphere
+* (the chord length 2*sin(psi/2) increases with the spherical distance psi).
+* @ingroup base */
+class KdTree
+{
+  std::vector<std::array<Double,3>> points; // reordered, node of range [begin, end) at (begin+end)/2
+  std::vector<UInt>                 index;  // original index of reordered points
+  std::vector<UInt>                 axis;   // split axis of node
+
+  void build(UInt begin, UInt end);
+  void nearest(const std::array<Double,3> &p, UInt begin, UInt end, UInt &best, Double &bestDistance2) const;
+  void search(const std::array<Double,3> &p, Double radius2, UInt begin, UInt end, std::vector<UInt> &result) const;
+
+public:
+  /// Default constructor (empty tree).
+  KdTree() = default;
+
+  /// Constructor from list of points.
+  explicit KdTree(const std::vector<Vector3d> &points) {init(points);}
+
+  /// Build the tree from list of points.
+  void init(const std::vector<Vector3d> &points);
+
+  /// Number of points.
+  UInt size() const {return index.size();}
+
+  /** @brief Index of the point nearest to @a point.
+  * @return MAX_UINT if the tree is empty. */
+  UInt nearest(const Vector3d &point) const {Double distance; return nearest(point, distance);}
+
+  /** @brief Index of the point nearest to @a point and its @a distance.
+  * @return MAX_UINT if the tree is empty. */
+  UInt nearest(const Vector3d &point, Double &distance) const;
+
+  /** @brief Indices of all points within @a radius around @a point (sorted ascending). */
+  std::vector<UInt> radiusSearch(const Vector3d &point, Double radius) const;
+};
+
+/***********************************************/
+
+#endif
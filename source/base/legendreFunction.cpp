@@ -14,85 +14,85 @@
 
 #include "base/importStd.h"
 #include "base/matrix.h"
+#include "base/factorTable.h"
 #include "legendreFunction.h"
 
-/***** VARIABLES *******************************/
-
-Matrix LegendreFunction::factor1;
-Matrix LegendreFunction::factor2;
-Matrix LegendreFunction::factor1Integral;
-Matrix LegendreFunction::factor2Integral;
-Vector LegendreFunction::factorSmall; //integration for small thetas
-
 /***********************************************/
 
-void LegendreFunction::computeFactors(UInt degree)
+const LegendreFunction::Factors &LegendreFunction::factors(UInt degree)
 {
-  // Enough factors already computed?
-  if(factor1.rows()>degree)
-    return;
-
-  factor1 = Matrix(degree+1, Matrix::TRIANGULAR, Matrix::LOWER);
-  factor2 = Matrix(degree+1, Matrix::TRIANGULAR, Matrix::LOWER);
-
-  // factors for recursion P[n-1][n-1] -> P[n][n]
-  if(degree>0) factor1(1,1) = sqrt(3.0);
-  for(UInt n=2; n<=degree; n++)
-    factor1(n,n) =  sqrt((2.0*n+1)/(2.0*n));
+  static FactorTable<Factors> table([](UInt degree)
+  {
+    Factors f;
+    f.factor1 = Matrix(degree+1, Matrix::TRIANGULAR, Matrix::LOWER);
+    f.factor2 = Matrix(degree+1, Matrix::TRIANGULAR, Matrix::LOWER);
+
+    // factors for recursion P[n-1][n-1] -> P[n][n]
+    if(degree>0) f.factor1(1,1) = sqrt(3.0);
+    for(UInt n=2; n<=degree; n++)
+      f.factor1(n,n) =  sqrt((2.0*n+1)/(2.0*n));
+
+    // factors for recursion P[m][n-1] and P[m][n-2] -> P[m][n]
+    for(UInt m=0; m<degree; m++)
+      for(UInt n=m+1; n<=degree; n++)
+      {
+        Double f0 = (2.0*n+1)/static_cast<Double>((n+m)*(n-m));
+        f.factor1(n,m) =  sqrt(f0*(2.0*n-1));
+        f.factor2(n,m) = -sqrt(f0*(n-m-1.0)*(n+m-1.0)/(2.0*n-3));
+      }
+    return f;
+  });
 
-  // factors for recursion P[m][n-1] and P[m][n-2] -> P[m][n]
-  for(UInt m=0; m<degree; m++)
-    for(UInt n=m+1; n<=degree; n++)
-    {
-      Double f = (2.0*n+1)/static_cast<Double>((n+m)*(n-m));
-      factor1(n,m) =  sqrt(f*(2.0*n-1));
-      factor2(n,m) = -sqrt(f*(n-m-1.0)*(n+m-1.0)/(2.0*n-3));
-    }
+  return table(degree);
 }
 
 /***********************************************/
 
-void LegendreFunction::computeFactorsIntegral(UInt degree)
+const LegendreFunction::FactorsIntegral &LegendreFunction::factorsIntegral(UInt degree)
 {
-  // Enough factors already computed?
-  if(factor1Integral.rows()>degree)
-    return;
-
-  factor1Integral = Matrix(degree+1, Matrix::TRIANGULAR, Matrix::LOWER);
-  factor2Integral = Matrix(degree+1, Matrix::TRIANGULAR, Matrix::LOWER);
-
-  // factors for recursion P[n-1][n-2] and int_P[n-2][n-2] -> P[n][n]
-  for(UInt n=2; n<=degree; n++)
+  static FactorTable<FactorsIntegral> table([](UInt degree)
   {
-    factor1Integral(n,n) =  1.0/static_cast<Double>(2.*n+2.)*sqrt((2.*n+1.)/static_cast<Double>(n*(n-1.)));
-    factor2Integral(n,n) =  1.0/static_cast<Double>(2.*n+2.)*sqrt(n*(2.*n+1.)*(2.*n-1.)/static_cast<Double>(n-1.));
-  }
+    FactorsIntegral f;
+    f.factor1 = Matrix(degree+1, Matrix::TRIANGULAR, Matrix::LOWER);
+    f.factor2 = Matrix(degree+1, Matrix::TRIANGULAR, Matrix::LOWER);
 
-  // factors for recursion P[n-1][m] and int_P[n-2][m] -> P[n][m]
-  for(UInt m=0; m<degree; m++)
-    for(UInt n=m+1; n<=degree; n++)
+    // factors for recursion P[n-1][n-2] and int_P[n-2][n-2] -> P[n][n]
+    for(UInt n=2; n<=degree; n++)
     {
-      factor1Integral(n,m) = -1.0/(n+1.)*sqrt((2.*n+1.)*(2.*n-1.)/static_cast<Double>((n-m)*(n+m)));
-      factor2Integral(n,m) = (n-2.)/static_cast<Double>(n+1.)*sqrt((2.*n+1.)*(n+m-1.)*(n-m-1.)/static_cast<Double>((2.*n-3.)*(n+m)*(n-m)));
+      f.factor1(n,n) =  1.0/static_cast<Double>(2.*n+2.)*sqrt((2.*n+1.)/static_cast<Double>(n*(n-1.)));
+      f.factor2(n,n) =  1.0/static_cast<Double>(2.*n+2.)*sqrt(n*(2.*n+1.)*(2.*n-1.)/static_cast<Double>(n-1.));
     }
 
-  // factors for Hmain diagonal for small thetas
-  factorSmall = Vector(degree+1);
+    // factors for recursion P[n-1][m] and int_P[n-2][m] -> P[n][m]
+    for(UInt m=0; m<degree; m++)
+      for(UInt n=m+1; n<=degree; n++)
+      {
+        f.factor1(n,m) = -1.0/(n+1.)*sqrt((2.*n+1.)*(2.*n-1.)/static_cast<Double>((n-m)*(n+m)));
+        f.factor2(n,m) = (n-2.)/static_cast<Double>(n+1.)*sqrt((2.*n+1.)*(n+m-1.)*(n-m-1.)/static_cast<Double>((2.*n-3.)*(n+m)*(n-m)));
+      }
 
-  for(UInt n=3; n<=degree; n++)
-  {
-    factorSmall(n)=1.0;
-    for(UInt k=5; k<=(2*n-1); k=k+2)
-      factorSmall(n)*=k/static_cast<Double>(k+1);
-    factorSmall(n)=sqrt(factorSmall(n)*(2*n+1));
-  }
+    // factors for Hmain diagonal for small thetas
+    f.factorSmall = Vector(degree+1);
+    for(UInt n=3; n<=degree; n++)
+    {
+      f.factorSmall(n)=1.0;
+      for(UInt k=5; k<=(2*n-1); k=k+2)
+        f.factorSmall(n)*=k/static_cast<Double>(k+1);
+      f.factorSmall(n)=sqrt(f.factorSmall(n)*(2*n+1));
+    }
+    return f;
+  });
+
+  return table(degree);
 }
 
 /***********************************************/
 
 const Matrix LegendreFunction::compute(Double t, UInt degree)
 {
-  computeFactors(degree);
+  const Factors &factors = LegendreFunction::factors(degree);
+  const Matrix  &factor1 = factors.factor1;
+  const Matrix  &factor2 = factors.factor2;
 
   Matrix Fkt(degree+1, Matrix::TRIANGULAR, Matrix::LOWER);
 
@@ -119,7 +119,10 @@ const Matrix LegendreFunction::compute(Double t, UInt degree)
 
 const Matrix LegendreFunction::integral(Double t1, Double t2, UInt degree)
 {
-  computeFactorsIntegral(degree);
+  const FactorsIntegral &factors = LegendreFunction::factorsIntegral(degree);
+  const Matrix &factor1Integral = factors.factor1;
+  const Matrix &factor2Integral = factors.factor2;
+  const Vector &factorSmall     = factors.factorSmall;
 
   Matrix intP(degree+1, Matrix::TRIANGULAR, Matrix::LOWER);
 
@@ -25,12 +25,12 @@
 * fully normalized. */
 class LegendreFunction
 {
-  static Matrix factor1, factor2;
-  static Matrix factor1Integral, factor2Integral;
-  static Vector factorSmall;
+  // factors needed for recursion formular (shared between threads)
+  class Factors         {public: Matrix factor1, factor2;};
+  class FactorsIntegral {public: Matrix factor1, factor2; Vector factorSmall;};
 
-  static void computeFactors(UInt degree);
-  static void computeFactorsIntegral(UInt degree);
+  static const Factors         &factors(UInt degree);
+  static const FactorsIntegral &factorsIntegral(UInt degree);
 
 public:
   /** @brief Legendre functions.
@@ -15,102 +15,109 @@
 
 #include "base/importStd.h"
 #include "base/matrix.h"
+#include "base/factorTable.h"
 #include "base/legendrePolynomial.h"
 
-/***** VARIABLES ********************************/
-
-// factors for the recursion
-Vector LegendrePolynomial::factor1,            LegendrePolynomial::factor2;
-Vector LegendrePolynomial::factor1Derivate,    LegendrePolynomial::factor2Derivate;
-Vector LegendrePolynomial::factor1Derivate2nd, LegendrePolynomial::factor2Derivate2nd;
-Vector LegendrePolynomial::factor1Integral,    LegendrePolynomial::factor2Integral;
-
 /***********************************************/
 
-void LegendrePolynomial::computeFactors(UInt degree)
+const LegendrePolynomial::Factors &LegendrePolynomial::factors(UInt degree)
 {
-  // Enough factors already computed?
-  if(factor1.rows()>degree)
-    return;
+  static FactorTable<Factors> table([](UInt degree)
+  {
+    Factors f;
+    f.factor1 = Vector(degree+1);
+    f.factor2 = Vector(degree+1);
 
-  factor1 = Vector(degree+1);
-  factor2 = Vector(degree+1);
+    f.factor1(0) = 1.0;
+    f.factor2(0) = sqrt(3.0);
 
-  factor1(0) = 1.0;
-  factor2(0) = sqrt(3.0);
+    for(UInt n=2; n<=degree; n++)
+    {
+      f.factor1(n) = sqrt(2.*n+1)*sqrt(2.*n-1.)/n;
+      f.factor2(n) = -(n-1.)*sqrt(2.*n+1.)/sqrt(2.*n-3.)/n;
+    }
+    return f;
+  });
 
-  for(UInt n=2; n<=degree; n++)
-  {
-    factor1(n) = sqrt(2.*n+1)*sqrt(2.*n-1.)/n;
-    factor2(n) = -(n-1.)*sqrt(2.*n+1.)/sqrt(2.*n-3.)/n;
-  }
+  return table(degree);
 }
 
 /***********************************************/
 
-void LegendrePolynomial::computeFactorsDerivate(UInt degree)
+const LegendrePolynomial::Factors &LegendrePolynomial::factorsDerivate(UInt degree)
 {
-  // Enough factors already computed?
-  if(factor1Derivate.rows()>degree)
-    return;
+  static FactorTable<Factors> table([](UInt degree)
+  {
+    Factors f;
+    f.factor1 = Vector(degree+1);
+    f.factor2 = Vector(degree+1);
 
-  factor1Derivate = Vector(degree+1);
-  factor2Derivate = Vector(degree+1);
+    f.factor1(0) = sqrt(3.);
+    f.factor2(0) = 3.*sqrt(5.);
 
-  factor1Derivate(0) = sqrt(3.);
-  factor2Derivate(0) = 3.*sqrt(5.);
+    for(UInt n=2; n<=degree; n++)
+    {
+      f.factor1(n) = sqrt(2.*n+1.)*sqrt(2.*n-1.)/(n-1.);
+      f.factor2(n) = -sqrt(2.*n+1.)*n/sqrt(2.*n-3.)/(n-1.);
+    }
+    return f;
+  });
 
-  for(UInt n=2; n<=degree; n++)
-  {
-    factor1Derivate(n) = sqrt(2.*n+1.)*sqrt(2.*n-1.)/(n-1.);
-    factor2Derivate(n) = -sqrt(2.*n+1.)*n/sqrt(2.*n-3.)/(n-1.);
-  }
+  return table(degree);
 }
 
 /***********************************************/
 
-void LegendrePolynomial::computeFactorsDerivate2nd(UInt degree)
+const LegendrePolynomial::Factors &LegendrePolynomial::factorsDerivate2nd(UInt degree)
 {
-  // Enough factors already computed?
-  if(factor1Derivate2nd.rows()>degree)
-    return;
+  static FactorTable<Factors> table([](UInt degree)
+  {
+    Factors f;
+    f.factor1 = Vector(degree+1);
+    f.factor2 = Vector(degree+1);
 
-  factor1Derivate2nd = Vector(degree+1);
-  factor2Derivate2nd = Vector(degree+1);
+    f.factor1(0) =  3. * sqrt(5.);
+    f.factor2(0) = 15. * sqrt(7.);
 
-  factor1Derivate2nd(0) =  3. * sqrt(5.);
-  factor2Derivate2nd(0) = 15. * sqrt(7.);
+    for(UInt n=3; n<=degree; n++)
+    {
+      f.factor1(n) = sqrt(2.*n+1.)*sqrt(2.*n-1.)/(n-2.);
+      f.factor2(n) = -(n+1.)*sqrt(2.*n+1.)/sqrt(2.*n-3.)/(n-2.);
+    }
+    return f;
+  });
 
-  for(UInt n=3; n<=degree; n++)
-  {
-    factor1Derivate2nd(n) = sqrt(2.*n+1.)*sqrt(2.*n-1.)/(n-2.);
-    factor2Derivate2nd(n) = -(n+1.)*sqrt(2.*n+1.)/sqrt(2.*n-3.)/(n-2.);
-  }
+  return table(degree);
 }
 
 /***********************************************/
 
-void LegendrePolynomial::computeFactorsIntegral(UInt degree)
+const LegendrePolynomial::Factors &LegendrePolynomial::factorsIntegral(UInt degree)
 {
-  // Enough factors already computed?
-  if(factor1Integral.rows()>degree)
-    return;
+  static FactorTable<Factors> table([](UInt degree)
+  {
+    Factors f;
+    f.factor1 = Vector(degree+1);
+    f.factor2 = Vector(degree+1);
 
-  factor1Integral = Vector(degree+1);
-  factor2Integral = Vector(degree+1);
+    for(UInt n=1; n<=degree; n++)
+    {
+      f.factor1(n) = -1./sqrt((2.*n+1.)*(2.*n+3.));
+      f.factor2(n) =  1./sqrt((2.*n+1.)*(2.*n-1.));
+    }
+    return f;
+  });
 
-  for(UInt n=1; n<=degree; n++)
-  {
-    factor1Integral(n) = -1./sqrt((2.*n+1.)*(2.*n+3.));
-    factor2Integral(n) =  1./sqrt((2.*n+1.)*(2.*n-1.));
-  }
+  return table(degree);
 }
 
 /***********************************************/
 
 const Vector LegendrePolynomial::compute(Double t, UInt degree)
 {
-  computeFactors(degree);
+  const Factors &factors = LegendrePolynomial::factors(degree);
+  const Vector  &factor1 = factors.factor1;
+  const Vector  &factor2 = factors.factor2;
 
   Vector P(degree+1);
   P(0) = 1.0;
@@ -127,7 +134,9 @@ const Vector LegendrePolynomial::compute(Double t, UInt degree)
 
 const Vector LegendrePolynomial::derivative(Double t, UInt degree)
 {
-  computeFactorsDerivate(degree);
+  const Factors &factors = factorsDerivate(degree);
+  const Vector  &factor1Derivate = factors.factor1;
+  const Vector  &factor2Derivate = factors.factor2;
 
   Vector P(degree+1);
   if(degree>=1) P(1) = sqrt(3.);
@@ -142,7 +151,9 @@ const Vector LegendrePolynomial::derivative(Double t, UInt degree)
 
 const Vector LegendrePolynomial::derivative2nd(Double t, UInt degree)
 {
-  computeFactorsDerivate2nd(degree);
+  const Factors &factors = factorsDerivate2nd(degree);
+  const Vector  &factor1Derivate2nd = factors.factor1;
+  const Vector  &factor2Derivate2nd = factors.factor2;
 
   Vector P(degree+1);
   if(degree>=2) P(2) = 3.*sqrt(5.);
@@ -157,7 +168,9 @@ const Vector LegendrePolynomial::derivative2nd(Double t, UInt degree)
 
 const Vector LegendrePolynomial::integral(Double t, UInt degree)
 {
-  computeFactorsIntegral(degree);
+  const Factors &factors = factorsIntegral(degree);
+  const Vector  &factor1Integral = factors.factor1;
+  const Vector  &factor2Integral = factors.factor2;
 
   Vector R(degree+1);
   Vector P = compute(t,degree);
@@ -173,7 +186,9 @@ const Vector LegendrePolynomial::integral(Double t, UInt degree)
 
 Double LegendrePolynomial::sum(Double t, const Vector &koeff, UInt degree)
 {
-  computeFactors(degree);
+  const Factors &factors = LegendrePolynomial::factors(degree);
+  const Vector  &factor1 = factors.factor1;
+  const Vector  &factor2 = factors.factor2;
 
   // pointer arithemtic to be as fast as possible
   const Double *aptr = factor1.field()+degree;
@@ -199,7 +214,9 @@ Double LegendrePolynomial::sum(Double t, const Vector &koeff, UInt degree)
 
 Double LegendrePolynomial::sumDerivative(Double t, const Vector &koeff, UInt degree)
 {
-  computeFactorsDerivate(degree);
+  const Factors &factors = factorsDerivate(degree);
+  const Vector  &factor1Derivate = factors.factor1;
+  const Vector  &factor2Derivate = factors.factor2;
 
   // pointer arithemtic to be as fast as possible
   const Double *aptr = factor1Derivate.field()+degree;
@@ -225,7 +242,9 @@ Double LegendrePolynomial::sumDerivative(Double t, const Vector &koeff, UInt deg
 
 Double LegendrePolynomial::sumDerivative2nd(Double t, const Vector &koeff, UInt degree)
 {
-  computeFactorsDerivate2nd(degree);
+  const Factors &factors = factorsDerivate2nd(degree);
+  const Vector  &factor1Derivate2nd = factors.factor1;
+  const Vector  &factor2Derivate2nd = factors.factor2;
 
   // pointer arithemtic to be as fast as possible
   const Double *aptr = factor1Derivate2nd.field()+degree;
@@ -26,15 +26,13 @@
 */
 class LegendrePolynomial
 {
-  static Vector factor1,            factor2;
-  static Vector factor1Derivate,    factor2Derivate;
-  static Vector factor1Derivate2nd, factor2Derivate2nd;
-  static Vector factor1Integral,    factor2Integral;
-
-  static void computeFactors(UInt degree);
-  static void computeFactorsDerivate(UInt degree);
-  static void computeFactorsDerivate2nd(UInt degree);
-  static void computeFactorsIntegral(UInt degree);
+  // factors needed for recursion formular (shared between threads)
+  class Factors {public: Vector factor1, factor2;};
+
+  static const Factors &factors(UInt degree);
+  static const Factors &factorsDerivate(UInt degree);
+  static const Factors &factorsDerivate2nd(UInt degree);
+  static const Factors &factorsIntegral(UInt degree);
 
 public:
   /** @brief  Legendre polynomials.
@@ -17,16 +17,22 @@
 #include "external/lapack/blas.h"
 #include "external/lapack/lapack.h"
 #include "base/matrix.h"
+#include "base/matrixGpu.h"
+#include "inputOutput/profiler.h"
 
 /***********************************************/
 /***** MatrixBase ******************************/
 /***********************************************/
 
-MatrixBase::MatrixBase(UInt size) : _size(size)
+MatrixBase::MatrixBase(UInt size) : _size(size), data(buffer)
 {
   try
   {
-    ptr = std::shared_ptr<Double>(new Double[_size], std::default_delete<Double[]>());
+    if(_size > SMALLSIZE)
+    {
+      ptr  = allocate(_size);
+      data = ptr.get();
+    }
   }
   catch(std::exception &e)
   {
@@ -34,6 +40,36 @@ MatrixBase::MatrixBase(UInt size) : _size(size)
   }
 }
 
+/***********************************************/
+
+MatrixBase::MatrixBase(const MatrixBase &x) : _size(x._size), data(buffer), ptr(x.ptr)
+{
+  if(ptr)
+    data = ptr.get();
+  else
+    std::copy_n(x.buffer, _size, buffer);
+}
+
+/***********************************************/
+
+MatrixBase::MatrixBase(UInt size, std::shared_ptr<Double> field) : _size(size), data(field.get()), ptr(field)
+{
+}
+
+/***********************************************/
+
+std::shared_ptr<Double> MatrixBase::allocate(UInt size)
+{
+  if(!Profiler::isEnabled())
+    return std::shared_ptr<Double>(new Double[size], std::default_delete<Double[]>());
+
+  const UInt  category = Profiler::memoryCategory();
+  const Int64 bytes    = static_cast<Int64>(size*sizeof(Double));
+  std::shared_ptr<Double> ptr(new Double[size], [category, bytes](Double *p) {delete[] p; Profiler::memoryAdd(category, -bytes);});
+  Profiler::memoryAdd(category, bytes);
+  return ptr;
+}
+
 /***********************************************/
 /***** const_MatrixSlice ***********************/
 /***********************************************/
@@ -265,6 +301,17 @@ Matrix::Matrix(std::initializer_list<std::initializer_list<Double>> list) : Matr
 
 /***********************************************/
 
+Matrix::Matrix(UInt rows, UInt columns, std::shared_ptr<Double> field) : MatrixSlice(0, 0, GENERAL, UPPER)
+{
+  _rows    = rows;
+  _columns = columns;
+  _ld      = rows;
+  if(size())
+    base = std::make_shared<MatrixBase>(size(), field);
+}
+
+/***********************************************/
+
 Matrix &Matrix::operator=(const const_MatrixSlice &x)
 {
   try
@@ -837,9 +884,12 @@ void matMult(Double c, const_MatrixSliceRef A, const_MatrixSliceRef B, MatrixSli
       throw(Exception("Combination of Matrix types not implemented"));
 
     if(!C.isRowMajorOrder())
-      blas_dgemm(A.isRowMajorOrder(), B.isRowMajorOrder(), static_cast<F77Int>(C.rows()), static_cast<F77Int>(C.columns()), static_cast<F77Int>(A.columns()),
-                 c, A.field(), static_cast<F77Int>(A.ld()), B.field(), static_cast<F77Int>(B.ld()), 1.0, C.field(), static_cast<F77Int>(C.ld()));
-    else
+    {
+      if(!MatrixGpu::dgemm(A.isRowMajorOrder(), B.isRowMajorOrder(), C.rows(), C.columns(), A.columns(), c, A.field(), A.ld(), B.field(), B.ld(), 1.0, C.field(), C.ld()))
+        blas_dgemm(A.isRowMajorOrder(), B.isRowMajorOrder(), static_cast<F77Int>(C.rows()), static_cast<F77Int>(C.columns()), static_cast<F77Int>(A.columns()),
+                   c, A.field(), static_cast<F77Int>(A.ld()), B.field(), static_cast<F77Int>(B.ld()), 1.0, C.field(), static_cast<F77Int>(C.ld()));
+    }
+    else if(!MatrixGpu::dgemm(!B.isRowMajorOrder(), !A.isRowMajorOrder(), C.columns(), C.rows(), A.columns(), c, B.field(), B.ld(), A.field(), A.ld(), 1.0, C.field(), C.ld()))
       blas_dgemm(!B.isRowMajorOrder(), !A.isRowMajorOrder(), static_cast<F77Int>(C.columns()), static_cast<F77Int>(C.rows()), static_cast<F77Int>(A.columns()),
                  c, B.field(), static_cast<F77Int>(B.ld()), A.field(), static_cast<F77Int>(A.ld()), 1.0, C.field(), static_cast<F77Int>(C.ld()));
   }
@@ -863,8 +913,9 @@ void rankKUpdate(Double c, const_MatrixSliceRef A, MatrixSliceRef N)
       throw(Exception("Matrix A must be GENERAL and Matrix N must be SYMMETRIC"));
 
     const Bool isUpper = (N.isRowMajorOrder()) ? (!N.isUpper()) : N.isUpper();
-    blas_dsyrk(isUpper, !A.isRowMajorOrder(), static_cast<F77Int>(N.rows()), static_cast<F77Int>(A.rows()),
-               c, A.field(), static_cast<F77Int>(A.ld()), 1.0, N.field(), static_cast<F77Int>(N.ld()));
+    if(!MatrixGpu::dsyrk(isUpper, !A.isRowMajorOrder(), N.rows(), A.rows(), c, A.field(), A.ld(), 1.0, N.field(), N.ld()))
+      blas_dsyrk(isUpper, !A.isRowMajorOrder(), static_cast<F77Int>(N.rows()), static_cast<F77Int>(A.rows()),
+                 c, A.field(), static_cast<F77Int>(A.ld()), 1.0, N.field(), static_cast<F77Int>(N.ld()));
   }
   catch(std::exception &e)
   {
@@ -1259,7 +1310,9 @@ void cholesky(MatrixSliceRef A)
       throw(Exception("Dimension error"));
 
     const Bool isUpper = (A.isRowMajorOrder()) ? (!A.isUpper()) : A.isUpper();
-    const Int info = lapack_dpotrf(isUpper, A.rows(), A.field(),A.ld());
+    Int info = 0;
+    if(!MatrixGpu::dpotrf(isUpper, A.rows(), A.field(), A.ld(), info))
+      info = lapack_dpotrf(isUpper, A.rows(), A.field(), A.ld());
     const_cast<MatrixSlice&>(A).setType(Matrix::TRIANGULAR, Matrix::UPPER);
     if(isUpper)
       const_cast<MatrixSlice&>(A)._rowMajorOrder = FALSE;
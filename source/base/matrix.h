@@ -232,6 +232,11 @@ public:
   * @param uplo Only the UPPER or LOWER part of the matrix is used */
   Matrix(UInt rows, Type type, Uplo uplo=Matrix::UPPER) : MatrixSlice(rows, rows, type, uplo) {}
 
+  /** @brief Constructor using the external memory @p field (column major order, e.g. shared between processes).
+  * The memory is never modified: as long as @p field is referenced elsewhere,
+  * the first writable access copies the elements (copy on write). */
+  Matrix(UInt rows, UInt columns, std::shared_ptr<Double> field);
+
   Matrix(const Matrix &x);                                           //!< Copy Constructor.
   Matrix(const const_MatrixSlice &x);                                //!< Copy Constructor.
   Matrix(std::initializer_list<std::initializer_list<Double>> list); //!< List Constructor.
@@ -651,25 +656,40 @@ void generateQ(MatrixSliceRef A, const Vector &tau);
 * Used for memory management of matrices.
 * Memory is only copied, if needed (copy on write).
 * This means multiple matrices share the same memory,
-* as long as the elements are not changed. */
+* as long as the elements are not changed.
+* Small matrices (e.g. 3x3 rotations, 6x6 state transition blocks) up to @a SMALLSIZE elements
+* are stored inside the object itself. As the object is created with std::make_shared
+* this needs only one allocation and the elements are copied directly instead of shared.
+* With enabled profiling the memory is accounted to the current memory category (see Profiler::MemoryCategory),
+* except for the small inline storage. */
 class MatrixBase
 {
 public:
+  /// Maximum count of elements stored inside the object.
+  static constexpr UInt SMALLSIZE = 36;
+
   explicit MatrixBase(UInt size);  //!< Constructor
+  MatrixBase(const MatrixBase &x); //!< Copy constructor (shares large fields).
+  MatrixBase(UInt size, std::shared_ptr<Double> field); //!< Constructor using external memory.
+  MatrixBase &operator=(const MatrixBase &) = delete; //!< Disallow copying.
 
   /// count of elements in field.
   UInt size() const {return _size;}
 
   /// Readonly access to field.
-  inline const Double *const_field() const {return ptr.get();}
+  inline const Double *const_field() const {return data;}
 
   /** Writable access to field.
   * Maybe memory must be copied. */
   inline Double *field();
 
 private:
-  UInt _size;
+  UInt    _size;
+  Double *data;
   std::shared_ptr<Double> ptr;
+  Double  buffer[SMALLSIZE];
+
+  static std::shared_ptr<Double> allocate(UInt size);
 };
 
 /// @} group matrix
@@ -682,11 +702,12 @@ inline Double *MatrixBase::field()
 {
   if(ptr.use_count()>1) // not threat save
   {
-    auto ptr2 = std::shared_ptr<Double>(new Double[size()], std::default_delete<Double[]>());
+    auto ptr2 = allocate(size());
     std::copy_n(ptr.get(), size(), ptr2.get());
     std::swap(ptr, ptr2);
+    data = ptr.get();
   }
-  return ptr.get();
+  return data;
 }
 
 /***********************************************/
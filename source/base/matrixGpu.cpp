@@ -0,0 +1,262 @@
+/***********************************************/
+/**
+* @file matrixGpu.cpp
+*
+* @brief Optional offload of large matrix operations to a GPU (CUDA).
+*
+* @author GROOPS Developers
+* @date 2026-10-15
+*
+*/
+/***********************************************/
+
+#include "base/importStd.h"
+#include "base/matrixGpu.h"
+
+#ifdef GROOPS_DISABLE_CUDA
+
+/***********************************************/
+
+void MatrixGpu::setMinSize(UInt /*size*/) {}
+Bool MatrixGpu::isEnabled() {return FALSE;}
+Bool MatrixGpu::dgemm(Bool, Bool, UInt, UInt, UInt, Double, const Double *, UInt, const Double *, UInt, Double, Double *, UInt) {return FALSE;}
+Bool MatrixGpu::dsyrk(Bool, Bool, UInt, UInt, Double, const Double *, UInt, Double, Double *, UInt) {return FALSE;}
+Bool MatrixGpu::dpotrf(Bool, UInt, Double *, UInt, Int &) {return FALSE;}
+
+/***********************************************/
+
+#else
+
+#include <atomic>
+#include <mutex>
+#include <cuda_runtime.h>
+#include <cublas_v2.h>
+#include <cusolverDn.h>
+
+/***********************************************/
+
+namespace
+{
+  std::atomic<UInt> minSize(1024);
+
+  Bool hasDevice()
+  {
+    static std::once_flag flag;
+    static Bool available = FALSE;
+    std::call_once(flag, []()
+    {
+      int count = 0;
+      available = (cudaGetDeviceCount(&count) == cudaSuccess) && (count > 0);
+    });
+    return available;
+  }
+
+  void check(cudaError_t status)
+  {
+    if(status != cudaSuccess)
+      throw(Exception("CUDA error: "s+cudaGetErrorString(status)));
+  }
+
+  void check(cublasStatus_t status)
+  {
+    if(status != CUBLAS_STATUS_SUCCESS)
+      throw(Exception("cuBLAS error = "s+static_cast<Int>(status)%"%i"s));
+  }
+
+  void check(cusolverStatus_t status)
+  {
+    if(status != CUSOLVER_STATUS_SUCCESS)
+      throw(Exception("cuSOLVER error = "s+static_cast<Int>(status)%"%i"s));
+  }
+
+  // Stream, library handles, and device buffer of a thread.
+  // Operations of different threads run concurrently on their own streams.
+  class Context
+  {
+  public:
+    Bool               valid;
+    cudaStream_t       stream;
+    cublasHandle_t     blas;
+    cusolverDnHandle_t solver;
+    Double            *buffer;
+    UInt               bufferSize;
+    int               *devInfo;
+
+    Context() : valid(FALSE), stream(nullptr), blas(nullptr), solver(nullptr), buffer(nullptr), bufferSize(0), devInfo(nullptr)
+    {
+      valid = hasDevice()
+           && (cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking) == cudaSuccess)
+           && (cublasCreate(&blas)      == CUBLAS_STATUS_SUCCESS) && (cublasSetStream(blas, stream)       == CUBLAS_STATUS_SUCCESS)
+           && (cusolverDnCreate(&solver) == CUSOLVER_STATUS_SUCCESS) && (cusolverDnSetStream(solver, stream) == CUSOLVER_STATUS_SUCCESS)
+           && (cudaMalloc(&devInfo, sizeof(int)) == cudaSuccess);
+    }
+
+   ~Context()
+    {
+      if(buffer)  cudaFree(buffer);
+      if(devInfo) cudaFree(devInfo);
+      if(solver)  cusolverDnDestroy(solver);
+      if(blas)    cublasDestroy(blas);
+      if(stream)  cudaStreamDestroy(stream);
+    }
+
+    Context(const Context &) = delete;
+    Context &operator=(const Context &) = delete;
+
+    /// device memory for @p count doubles, nullptr if not enough memory (the operation is computed on the CPU).
+    Double *allocate(UInt count)
+    {
+      if(count <= bufferSize)
+        return buffer;
+      if(buffer)
+        cudaFree(buffer);
+      buffer     = nullptr;
+      bufferSize = 0;
+      if(cudaMalloc(&buffer, count*sizeof(Double)) != cudaSuccess)
+      {
+        cudaGetLastError(); // reset error state
+        buffer = nullptr;
+        return nullptr;
+      }
+      bufferSize = count;
+      return buffer;
+    }
+
+    void upload(const Double *host, UInt ld, UInt rows, UInt columns, Double *device)
+    {
+      check(cudaMemcpy2DAsync(device, rows*sizeof(Double), host, ld*sizeof(Double), rows*sizeof(Double), columns, cudaMemcpyHostToDevice, stream));
+    }
+
+    void download(const Double *device, UInt rows, UInt columns, Double *host, UInt ld)
+    {
+      check(cudaMemcpy2DAsync(host, ld*sizeof(Double), device, rows*sizeof(Double), rows*sizeof(Double), columns, cudaMemcpyDeviceToHost, stream));
+    }
+
+    void synchronize() {check(cudaStreamSynchronize(stream));}
+  };
+
+  Context *context(UInt size)
+  {
+    if(!minSize || (size < minSize) || !hasDevice())
+      return nullptr;
+    thread_local Context ctx;
+    return ctx.valid ? &ctx : nullptr;
+  }
+} // end namespace
+
+/***********************************************/
+
+void MatrixGpu::setMinSize(UInt size)
+{
+  minSize = size;
+}
+
+/***********************************************/
+
+Bool MatrixGpu::isEnabled()
+{
+  return minSize && hasDevice();
+}
+
+/***********************************************/
+
+Bool MatrixGpu::dgemm(Bool transA, Bool transB, UInt m, UInt n, UInt k, Double alpha, const Double *A, UInt ldA, const Double *B, UInt ldB, Double beta, Double *C, UInt ldC)
+{
+  try
+  {
+    Context *ctx = context(std::min(m, std::min(n, k)));
+    if(!ctx)
+      return FALSE;
+
+    const UInt rowsA = transA ? k : m;
+    const UInt rowsB = transB ? n : k;
+    Double *dA = ctx->allocate(m*k + k*n + m*n);
+    if(!dA)
+      return FALSE;
+    Double *dB = dA + m*k;
+    Double *dC = dB + k*n;
+
+    ctx->upload(A, ldA, rowsA, transA ? m : k, dA);
+    ctx->upload(B, ldB, rowsB, transB ? k : n, dB);
+    if(beta != 0.)
+      ctx->upload(C, ldC, m, n, dC);
+    check(cublasDgemm(ctx->blas, transA ? CUBLAS_OP_T : CUBLAS_OP_N, transB ? CUBLAS_OP_T : CUBLAS_OP_N,
+                      static_cast<int>(m), static_cast<int>(n), static_cast<int>(k),
+                      &alpha, dA, static_cast<int>(rowsA), dB, static_cast<int>(rowsB), &beta, dC, static_cast<int>(m)));
+    ctx->download(dC, m, n, C, ldC);
+    ctx->synchronize();
+    return TRUE;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Bool MatrixGpu::dsyrk(Bool upper, Bool trans, UInt n, UInt k, Double alpha, const Double *A, UInt ldA, Double beta, Double *C, UInt ldC)
+{
+  try
+  {
+    Context *ctx = context(std::min(n, k));
+    if(!ctx)
+      return FALSE;
+
+    const UInt rowsA = trans ? k : n;
+    Double *dA = ctx->allocate(n*k + n*n);
+    if(!dA)
+      return FALSE;
+    Double *dC = dA + n*k;
+
+    // the full square is transferred, the other triangle is written back unchanged
+    ctx->upload(A, ldA, rowsA, trans ? n : k, dA);
+    ctx->upload(C, ldC, n, n, dC);
+    check(cublasDsyrk(ctx->blas, upper ? CUBLAS_FILL_MODE_UPPER : CUBLAS_FILL_MODE_LOWER, trans ? CUBLAS_OP_T : CUBLAS_OP_N,
+                      static_cast<int>(n), static_cast<int>(k), &alpha, dA, static_cast<int>(rowsA), &beta, dC, static_cast<int>(n)));
+    ctx->download(dC, n, n, C, ldC);
+    ctx->synchronize();
+    return TRUE;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Bool MatrixGpu::dpotrf(Bool upper, UInt n, Double *A, UInt ldA, Int &info)
+{
+  try
+  {
+    Context *ctx = context(n);
+    if(!ctx)
+      return FALSE;
+
+    const cublasFillMode_t uplo = upper ? CUBLAS_FILL_MODE_UPPER : CUBLAS_FILL_MODE_LOWER;
+    int workSize = 0;
+    check(cusolverDnDpotrf_bufferSize(ctx->solver, uplo, static_cast<int>(n), nullptr, static_cast<int>(n), &workSize));
+    Double *dA = ctx->allocate(n*n + static_cast<UInt>(workSize));
+    if(!dA)
+      return FALSE;
+    Double *dWork = dA + n*n;
+
+    int devInfo = 0;
+    ctx->upload(A, ldA, n, n, dA);
+    check(cusolverDnDpotrf(ctx->solver, uplo, static_cast<int>(n), dA, static_cast<int>(n), dWork, workSize, ctx->devInfo));
+    ctx->download(dA, n, n, A, ldA);
+    check(cudaMemcpyAsync(&devInfo, ctx->devInfo, sizeof(int), cudaMemcpyDeviceToHost, ctx->stream));
+    ctx->synchronize();
+    info = devInfo;
+    return TRUE;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+#endif
@@ -0,0 +1,56 @@
+/***********************************************/
+/**
+* @file matrixGpu.h
+*
+* @brief Optional offload of large matrix operations to a GPU (CUDA).
+*
+* The dense kernels of the normal equation accumulation and solving (dgemm, dsyrk, dpotrf)
+* are computed on the GPU if GROOPS is compiled with CUDA (cuBLAS/cuSOLVER)
+* and all dimensions of the operation exceed a minimum size.
+* Each thread uses its own CUDA stream and device buffers, so the block operations
+* of MatrixDistributed running in parallel threads overlap transfers and computation.
+* The functions return FALSE if the operation was not computed on the GPU,
+* the caller must then use the CPU BLAS/LAPACK routines.
+*
+* @author GROOPS Developers
+* @date 2026-10-15
+*
+*/
+/***********************************************/
+
+#ifndef __GROOPS_MATRIXGPU__
+#define __GROOPS_MATRIXGPU__
+
+#include "base/importStd.h"
+
+/** @addtogroup matrixGroup */
+/// @{
+
+/***** FUNCTIONS *******************************/
+
+/** @brief Optional offload of large matrix operations to a GPU.
+* Matrices are column major order as in BLAS/LAPACK. */
+namespace MatrixGpu
+{
+  /** @brief Minimum dimension (rows, columns, and inner dimension) of an operation to be computed on the GPU.
+  * Zero disables the GPU. Default: 1024. Has no effect if compiled without CUDA. */
+  void setMinSize(UInt size);
+
+  /** @brief Is a GPU available and enabled? */
+  Bool isEnabled();
+
+  /** @brief C = alpha * op(A) * op(B) + beta * C with C (m x n) and inner dimension k. */
+  Bool dgemm(Bool transA, Bool transB, UInt m, UInt n, UInt k, Double alpha, const Double *A, UInt ldA, const Double *B, UInt ldB, Double beta, Double *C, UInt ldC);
+
+  /** @brief C = alpha * op(A)^T * op(A) + beta * C, with symmetric C (n x n), only the @p upper or lower triangle is referenced. */
+  Bool dsyrk(Bool upper, Bool trans, UInt n, UInt k, Double alpha, const Double *A, UInt ldA, Double beta, Double *C, UInt ldC);
+
+  /** @brief Cholesky decomposition of the symmetric matrix A (n x n), LAPACK error code is returned in @p info. */
+  Bool dpotrf(Bool upper, UInt n, Double *A, UInt ldA, Int &info);
+}
+
+/// @}
+
+/***********************************************/
+
+#endif
@@ -0,0 +1,174 @@
+/***********************************************/
+/**
+* @file matrixPacked.cpp
+*
+* @brief Symmetric and triangular matrices in packed storage.
+*
+* @author GROOPS Developers
+* @date 2026-10-14
+*
+*/
+/***********************************************/
+
+#include "base/importStd.h"
+#include "external/lapack/lapack.h"
+#include "base/matrixPacked.h"
+
+/***********************************************/
+
+MatrixPacked::MatrixPacked(UInt dimension, Matrix::Type type) : _dimension(dimension), _type(type), _field(dimension*(dimension+1)/2, 0.)
+{
+  if(type == Matrix::GENERAL)
+    throw(Exception("MatrixPacked must be SYMMETRIC or TRIANGULAR"));
+}
+
+/***********************************************/
+
+MatrixPacked::MatrixPacked(const_MatrixSliceRef A) : _dimension(A.rows()), _type(A.getType())
+{
+  try
+  {
+    if(A.rows() != A.columns())
+      throw(Exception("Dimension error"));
+    if(A.getType() == Matrix::GENERAL)
+      throw(Exception("Matrix must be SYMMETRIC or TRIANGULAR"));
+    if((A.getType() == Matrix::TRIANGULAR) && !A.isUpper())
+      throw(Exception("TRIANGULAR matrix must be UPPER"));
+
+    // column major upper triangle
+    Matrix B(_dimension, _type, Matrix::UPPER);
+    for(UInt z=0; z<_dimension; z++)
+      for(UInt s=z; s<_dimension; s++)
+        B(z,s) = A.isUpper() ? A(z,s) : A(s,z);
+
+    _field.resize(_dimension*(_dimension+1)/2);
+    if(_dimension)
+    {
+      const Int info = lapack_dtrttf(TRUE, _dimension, B.field(), B.ld(), _field.data());
+      if(info != 0)
+        throw(Exception("conversion to RFP failed, error = "+info%"%i"s));
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Matrix MatrixPacked::matrix() const
+{
+  try
+  {
+    Matrix A(_dimension, _type, Matrix::UPPER);
+    if(_dimension)
+    {
+      const Int info = lapack_dtfttr(TRUE, _dimension, _field.data(), A.field(), A.ld());
+      if(info != 0)
+        throw(Exception("conversion from RFP failed, error = "+info%"%i"s));
+    }
+    return A;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+/***********************************************/
+
+void cholesky(MatrixPacked &N)
+{
+  try
+  {
+    if(N.getType() != Matrix::SYMMETRIC)
+      throw(Exception("Matrix must be SYMMETRIC"));
+    if(!N.dimension())
+      return;
+    const Int info = lapack_dpftrf(TRUE, N.dimension(), N.field());
+    N.setType(Matrix::TRIANGULAR);
+    if(info != 0)
+      throw(Exception("cannot compute decomposition, error = "+info%"%i"s));
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW_EXTRA("W'W = A("s+N.dimension()%"%i x "s+N.dimension()%"%i) packed"s, e)
+  }
+}
+
+/***********************************************/
+
+void rankKUpdate(Double c, const_MatrixSliceRef A, MatrixPacked &N)
+{
+  try
+  {
+    if(A.columns() != N.dimension())
+      throw(Exception("Dimension error"));
+    if((N.getType() != Matrix::SYMMETRIC) || (A.getType() != Matrix::GENERAL))
+      throw(Exception("Matrix A must be GENERAL and Matrix N must be SYMMETRIC"));
+    if((N.size() == 0) || (A.size() == 0))
+      return;
+
+    // RFP needs column major order
+    if(A.isRowMajorOrder())
+      lapack_dsfrk(TRUE, FALSE, N.dimension(), A.rows(), c, A.field(), A.ld(), 1.0, N.field()); // A' stored column major
+    else
+      lapack_dsfrk(TRUE, TRUE,  N.dimension(), A.rows(), c, A.field(), A.ld(), 1.0, N.field());
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW_EXTRA("N = A'A mit A = ("s+A.rows()%"%i x "s+A.columns()%"%i) and N = ("s+N.dimension()%"%i x "s+N.dimension()%"%i) packed"s, e)
+  }
+}
+
+/***********************************************/
+
+static void triangularSolvePacked(Double c, const MatrixPacked &W, MatrixSliceRef C, Bool trans)
+{
+  if(W.getType() != Matrix::TRIANGULAR)
+    throw(Exception("Matrix W must be TRIANGULAR"));
+  if(C.getType() != Matrix::GENERAL)
+    throw(Exception("Matrix C must be GENERAL"));
+  if(W.dimension() != C.rows())
+    throw(Exception("Dimension error"));
+  if(C.size() == 0)
+    return;
+
+  // row major C is solved from the right: C' := c * C' * W^(-T)
+  if(C.isRowMajorOrder())
+    lapack_dtfsm(FALSE, TRUE, !trans, C.columns(), C.rows(), c, W.field(), C.field(), C.ld());
+  else
+    lapack_dtfsm(TRUE,  TRUE, trans,  C.rows(), C.columns(), c, W.field(), C.field(), C.ld());
+}
+
+/***********************************************/
+
+void triangularSolve(Double c, const MatrixPacked &W, MatrixSliceRef C)
+{
+  try
+  {
+    triangularSolvePacked(c, W, C, FALSE);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW_EXTRA("C = W^(-1)*C mit W = ("s+W.dimension()%"%i x "s+W.dimension()%"%i) packed and C = ("s+C.rows()%"%i x "s+C.columns()%"%i)"s, e)
+  }
+}
+
+/***********************************************/
+
+void triangularTransSolve(Double c, const MatrixPacked &W, MatrixSliceRef C)
+{
+  try
+  {
+    triangularSolvePacked(c, W, C, TRUE);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW_EXTRA("C = W^(-T)*C mit W = ("s+W.dimension()%"%i x "s+W.dimension()%"%i) packed and C = ("s+C.rows()%"%i x "s+C.columns()%"%i)"s, e)
+  }
+}
+
+/***********************************************/
@@ -0,0 +1,87 @@
+/***********************************************/
+/**
+* @file matrixPacked.h
+*
+* @brief Symmetric and triangular matrices in packed storage.
+*
+* @author GROOPS Developers
+* @date 2026-10-14
+*
+*/
+/***********************************************/
+
+#ifndef __GROOPS_MATRIXPACKED__
+#define __GROOPS_MATRIXPACKED__
+
+#include "base/importStd.h"
+#include "base/matrix.h"
+
+/** @addtogroup matrixGroup */
+/// @{
+
+/***** CLASS ***********************************/
+
+/** @brief Symmetric or triangular matrix in packed storage.
+* Only the upper triangle is stored, which needs n(n+1)/2 elements instead of n^2 of a full @a Matrix.
+* The rectangular full packed format (RFP) of LAPACK is used, so the
+* decomposition, rank-k updates and triangular solves run with level 3 BLAS performance.
+* Useful for large normal equation matrices in memory. Use @a matrix() to get a full @a Matrix
+* for all other operations (e.g. writing files, which store triangles packed anyway). */
+class MatrixPacked
+{
+public:
+  /// Default Constructor.
+  MatrixPacked() : _dimension(0), _type(Matrix::SYMMETRIC) {}
+
+  /** @brief Constructor with zero matrix.
+  * @param dimension number of rows and columns.
+  * @param type SYMMETRIC or TRIANGULAR (upper). */
+  explicit MatrixPacked(UInt dimension, Matrix::Type type=Matrix::SYMMETRIC);
+
+  /** @brief Packed copy of a SYMMETRIC or upper TRIANGULAR matrix. */
+  explicit MatrixPacked(const_MatrixSliceRef A);
+
+  UInt rows()      const {return _dimension;}                   //!< Number of rows.
+  UInt columns()   const {return _dimension;}                   //!< Number of columns.
+  UInt dimension() const {return _dimension;}                   //!< Number of rows and columns.
+  UInt size()      const {return _field.size();}                //!< Number of stored elements.
+  Matrix::Type getType() const {return _type;}                  //!< SYMMETRIC or TRIANGULAR.
+  void setType(Matrix::Type type) {_type = type;}               //!< Changes only the interpretation of the content.
+  Double       *field()       {return _field.data();}           //!< Pointer to the RFP memory.
+  const Double *field() const {return _field.data();}           //!< Pointer to the RFP memory.
+
+  /** @brief Set all elements to zero. */
+  void setNull() {std::fill(_field.begin(), _field.end(), 0.);}
+
+  /** @brief Full matrix (upper triangle filled, type is preserved). */
+  Matrix matrix() const;
+
+private:
+  UInt                _dimension;
+  Matrix::Type        _type;
+  std::vector<Double> _field;
+};
+
+/***** FUNCTIONS *******************************/
+
+/** @brief Cholesky decomposition N = W'W.
+* @a N must be SYMMETRIC and is replaced by the upper TRIANGULAR matrix @a W. */
+void cholesky(MatrixPacked &N);
+
+/** @brief Rank k update: N += c * A'A.
+* @a N must be SYMMETRIC. */
+void rankKUpdate(Double c, const_MatrixSliceRef A, MatrixPacked &N);
+
+/** @brief Solve triangular system: C := c * W^(-1) * C.
+* @a W must be TRIANGULAR. */
+void triangularSolve(Double c, const MatrixPacked &W, MatrixSliceRef C);
+
+/** @brief Solve transposed triangular system: C := c * W^(-T) * C.
+* @a W must be TRIANGULAR. */
+void triangularTransSolve(Double c, const MatrixPacked &W, MatrixSliceRef C);
+
+/// @}
+
+/***********************************************/
+
+#endif /* __GROOPS_MATRIXPACKED__ */
@@ -49,16 +49,22 @@ ParameterName ParameterName::fromStr(const std::string &str)
 {
   try
   {
-    std::vector<std::string> parts = String::split(str, sep);
-
+    // assign the parts directly (called for each name of large parameter name files)
     ParameterName parameterName;
-    if(parts.size() > 0) parameterName.object   = parts.at(0);
-    if(parts.size() > 1) parameterName.type     = parts.at(1);
-    if(parts.size() > 2) parameterName.temporal = parts.at(2);
-    if(parts.size() > 3) parameterName.interval = parts.at(3);
-    if(parts.size() > 4) throw(Exception("Parameter name contains more than four parts: "+str));
-
-    return parameterName;
+    std::string *parts[] = {&parameterName.object, &parameterName.type, &parameterName.temporal, &parameterName.interval};
+    std::size_t start = 0;
+    for(std::string *part : parts)
+    {
+      const std::size_t end = str.find(sep, start);
+      if(end == std::string::npos)
+      {
+        part->assign(str, start, std::string::npos);
+        return parameterName;
+      }
+      part->assign(str, start, end-start);
+      start = end+1;
+    }
+    throw(Exception("Parameter name contains more than four parts: "+str));
   }
   catch(std::exception &e)
   {
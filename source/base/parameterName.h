@@ -74,5 +74,23 @@ public:
 
 /***********************************************/
 
+/** @brief Hash of ParameterName for unordered containers. */
+namespace std
+{
+  template<> struct hash<ParameterName>
+  {
+    std::size_t operator()(const ParameterName &name) const
+    {
+      std::hash<std::string> hash;
+      std::size_t seed = hash(name.object);
+      for(const std::string *part : {&name.type, &name.temporal, &name.interval})
+        seed ^= hash(*part) + 0x9e3779b97f4a7c15 + (seed<<6) + (seed>>2);
+      return seed;
+    }
+  };
+}
+
+/***********************************************/
+
 #endif
 
@@ -12,6 +12,7 @@
 
 #include "base/importStd.h"
 #include "base/polynomial.h"
+#include "parallel/threadPool.h"
 
 /***********************************************/
 
@@ -24,6 +25,7 @@ void Polynomial::init(const std::vector<Time> &times, UInt degree, Bool throwExc
     this->degree         = degree;
     this->throwException = throwException;
     this->isLeastSquares = leastSquares;
+    this->grid           = TimeGrid::fromTimes(times, margin);
     this->sampling       = medianSampling(times).seconds();
     this->range          = range * ((range < 0) ? -sampling : 1.);
     this->extrapolation  = extrapolation * ((extrapolation < 0) ? -sampling : 1.);
@@ -60,14 +62,17 @@ void Polynomial::init(const std::vector<Time> &times, UInt degree, Bool throwExc
 
 /***********************************************/
 
-Matrix Polynomial::interpolate(const std::vector<Time> &timesNew, const_MatrixSliceRef A, UInt rowsPerEpoch, UInt derivative) const
+Polynomial::Plan Polynomial::plan(const std::vector<Time> &timesNew, UInt derivative) const
 {
   try
   {
-    if(!derivative && !isLeastSquares && (timesNew == times)) // need interpolation?
-      return A;
+    Plan plan;
+    plan.isIdentity = (!derivative && !isLeastSquares && (timesNew == times)); // need interpolation?
+    if(plan.isIdentity)
+      return plan;
 
-    Matrix B(rowsPerEpoch*timesNew.size(), A.columns());
+    plan.index.resize(timesNew.size(), NULLINDEX);
+    plan.weight.resize(timesNew.size());
     UInt count = degree+1;
     auto searchStart = times.begin();
     for(UInt i=0; i<timesNew.size(); i++)
@@ -77,7 +82,20 @@ Matrix Polynomial::interpolate(const std::vector<Time> &timesNew, const_MatrixSl
       UInt idx;
       if(!isLeastSquares)
       {
-        searchStart = std::upper_bound(searchStart, times.end(), timesNew.at(i)); // first epoch greater than interpolation point
+        // first epoch greater than interpolation point
+        if(grid.count())
+        {
+          // index from uniform grid, corrected to the exact upper bound within [searchStart, end)
+          const UInt k0 = static_cast<UInt>(std::distance(times.begin(), searchStart));
+          UInt k = std::max(grid.upperBound(timesNew.at(i)), k0);
+          while((k < times.size()) && !(timesNew.at(i) < times.at(k)))
+            k++;
+          while((k > k0) && (timesNew.at(i) < times.at(k-1)))
+            k--;
+          searchStart = times.begin()+k;
+        }
+        else
+          searchStart = std::upper_bound(searchStart, times.end(), timesNew.at(i));
         idx = std::min(std::max(static_cast<UInt>(std::distance(times.begin(), searchStart)), count)-count, times.size()-count);
 
         auto centricity = [&](UInt idx) {return std::max(std::fabs((timesNew.at(i)-times.at(idx)).seconds()),
@@ -88,7 +106,6 @@ Matrix Polynomial::interpolate(const std::vector<Time> &timesNew, const_MatrixSl
 
         if((times.at(idx+degree)-times.at(idx)).seconds() > range) // polynomial data points not within range
         {
-          B.row(i*rowsPerEpoch, rowsPerEpoch).fill(NAN_EXPR);
           if(throwException)
             throw(Exception("cannot interpolate at "+timesNew.at(i).dateTimeStr()));
           continue;
@@ -101,7 +118,6 @@ Matrix Polynomial::interpolate(const std::vector<Time> &timesNew, const_MatrixSl
         count = static_cast<UInt>(std::distance(searchStart, searchEnd));
         if(count < degree+1) // not enough points
         {
-          B.row(i*rowsPerEpoch, rowsPerEpoch).fill(NAN_EXPR);
           if(throwException)
             throw(Exception("not enough points to fit at "+timesNew.at(i).dateTimeStr()));
           continue;
@@ -114,7 +130,6 @@ Matrix Polynomial::interpolate(const std::vector<Time> &timesNew, const_MatrixSl
       if(((times.at(idx) - timesNew.at(i)).seconds()         > extrapolation) || // all points are after newTime and we are too far away
          ((timesNew.at(i) - times.at(idx+count-1)).seconds() > extrapolation))   // all points are before newTime and we are too far away
       {
-        B.row(i*rowsPerEpoch, rowsPerEpoch).fill(NAN_EXPR);
         if(throwException)
           throw(Exception("cannot extrapolate at "+timesNew.at(i).dateTimeStr()));
         continue;
@@ -163,15 +178,43 @@ Matrix Polynomial::interpolate(const std::vector<Time> &timesNew, const_MatrixSl
           solveInPlace(Matrix(P.trans()), coeff);
       }
 
-      // interpolate
-      // -----------
-      if(rowsPerEpoch == 1)
-        matMult(1., coeff.trans(), A.row(idx, coeff.rows()), B.row(i, rowsPerEpoch));
-      else
-        for(UInt k=0; k<coeff.rows(); k++)
-          axpy(coeff(k), A.row(rowsPerEpoch*(idx+k), rowsPerEpoch), B.row(rowsPerEpoch*i, rowsPerEpoch));
+      plan.index.at(i)  = idx;
+      plan.weight.at(i) = coeff;
     }
 
+    return plan;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Matrix Polynomial::Plan::apply(const_MatrixSliceRef A, UInt rowsPerEpoch) const
+{
+  try
+  {
+    if(isIdentity)
+      return A;
+
+    // new epochs in blocks distributed to threads
+    constexpr UInt blockSize = 256;
+    Matrix B(rowsPerEpoch*index.size(), A.columns());
+    Parallel::threadLoop(0, (index.size()+blockSize-1)/blockSize, [&](UInt block)
+    {
+      for(UInt i=block*blockSize; i<std::min(index.size(), (block+1)*blockSize); i++)
+      {
+        if(index.at(i) == NULLINDEX)
+          B.row(i*rowsPerEpoch, rowsPerEpoch).fill(NAN_EXPR);
+        else if(rowsPerEpoch == 1)
+          matMult(1., weight.at(i).trans(), A.row(index.at(i), weight.at(i).rows()), B.row(i, rowsPerEpoch));
+        else
+          for(UInt k=0; k<weight.at(i).rows(); k++)
+            axpy(weight.at(i)(k), A.row(rowsPerEpoch*(index.at(i)+k), rowsPerEpoch), B.row(rowsPerEpoch*i, rowsPerEpoch));
+      }
+    });
     return B;
   }
   catch(std::exception &e)
@@ -26,6 +26,7 @@ class Polynomial
   Bool              throwException;
   UInt              degree;
   std::vector<Time> times;
+  TimeGrid          grid; // if times are equally spaced
   Double            sampling;
   Bool              isLeastSquares;
   Double            range, extrapolation;
@@ -33,6 +34,31 @@ class Polynomial
   Matrix            W;
 
 public:
+  /** @brief Precomputed interpolation of the input epochs to new epochs.
+  * Contains for each new epoch the index of the first nodal point and the interpolation weights.
+  * Applying the plan to data is a sparse matrix product. Useful if many data sets
+  * (e.g. columns of design matrices) are interpolated to the same epochs.
+  * @see Polynomial::plan() */
+  class Plan
+  {
+    friend class Polynomial;
+    Bool                isIdentity;
+    std::vector<UInt>   index;  // first nodal point for each new epoch, NULLINDEX if not interpolated
+    std::vector<Vector> weight; // weights of the nodal points
+
+  public:
+    Plan() : isIdentity(FALSE) {}
+
+    /// Number of new epochs.
+    UInt epochCount() const {return index.size();}
+
+    /** @brief Interpolated data.
+    * @param A input data of time series (at input epochs of the polynomial).
+    * @param rowsPerEpoch e.g. for @a A with positions (x,y,z) per epoch in separated rows.
+    * @return Interpolated matrix with epochCount()*rowsPerEpoch rows, non-interpolated values are NaN. */
+    Matrix apply(const_MatrixSliceRef A, UInt rowsPerEpoch=1) const;
+  };
+
   /// Constructor
   Polynomial() {}
 
@@ -66,7 +92,14 @@ public:
   * @param rowsPerEpoch e.g. for @a A with positions (x,y,z) per epoch in separated rows.
   * @param derivative compute the kth derivative.
   * @return Interpolated matrix with timesNew.size()*rowsPerEpoch rows. */
-  Matrix interpolate(const std::vector<Time> &timesNew, const_MatrixSliceRef A, UInt rowsPerEpoch, UInt derivative) const;
+  Matrix interpolate(const std::vector<Time> &timesNew, const_MatrixSliceRef A, UInt rowsPerEpoch, UInt derivative) const {return plan(timesNew, derivative).apply(A, rowsPerEpoch);}
+
+  /** @brief Precompute the interpolation to new epochs.
+  * Same as interpolate(), but the nodal points and weights are computed only once
+  * for many data sets at the same epochs.
+  * @param timesNew output epochs.
+  * @param derivative compute the kth derivative. */
+  Plan plan(const std::vector<Time> &timesNew, UInt derivative=0) const;
 
   /** @brief Interpolate a matrix to new epochs.
   * @see interpolate(const std::vector<Time> &, const_MatrixSliceRef, UInt, UInt) */
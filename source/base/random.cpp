@@ -0,0 +1,62 @@
+/***********************************************/
+/**
+* @file random.cpp
+*
+* @brief Counter-based pseudo random numbers.
+*
+* @see Salmon et al. (2011): Parallel random numbers: as easy as 1, 2, 3, Proceedings of SC11.
+*
+* @author GROOPS Developers
+* @date 2026-10-15
+*
+*/
+/***********************************************/
+
+#include <random>
+#include "base/importStd.h"
+#include "base/constants.h"
+#include "base/random.h"
+
+/***********************************************/
+
+std::array<UInt32,4> Random::block(UInt64 index) const
+{
+  constexpr UInt64 M0 = 0xD2511F53, M1 = 0xCD9E8D57; // multipliers
+  constexpr UInt32 W0 = 0x9E3779B9, W1 = 0xBB67AE85; // Weyl sequence of key
+
+  std::array<UInt32,4> x = {static_cast<UInt32>(index),  static_cast<UInt32>(index>>32),
+                            static_cast<UInt32>(stream), static_cast<UInt32>(stream>>32)};
+  UInt32 k0 = static_cast<UInt32>(seed);
+  UInt32 k1 = static_cast<UInt32>(seed>>32);
+  for(UInt round=0; round<10; round++)
+  {
+    const UInt64 p0 = M0 * x[0];
+    const UInt64 p1 = M1 * x[2];
+    x = {static_cast<UInt32>(p1>>32) ^ x[1] ^ k0, static_cast<UInt32>(p1),
+         static_cast<UInt32>(p0>>32) ^ x[3] ^ k1, static_cast<UInt32>(p0)};
+    k0 += W0;
+    k1 += W1;
+  }
+  return x;
+}
+
+/***********************************************/
+
+Double Random::normal(UInt64 index) const
+{
+  // Box-Muller transformation of two uniform numbers of the same block
+  const auto   x  = block(index);
+  const Double u1 = std::ldexp(static_cast<Double>(((static_cast<UInt64>(x[1])<<32) | x[0])>>11) + 0.5, -53); // (0,1)
+  const Double u2 = std::ldexp(static_cast<Double>(((static_cast<UInt64>(x[3])<<32) | x[2])>>11), -53);
+  return std::sqrt(-2.*std::log(u1)) * std::cos(2*PI*u2);
+}
+
+/***********************************************/
+
+UInt64 Random::randomSeed()
+{
+  std::random_device randomDevice;
+  return (static_cast<UInt64>(randomDevice())<<32) ^ randomDevice();
+}
+
+/***********************************************/
@@ -0,0 +1,53 @@
+/***********************************************/
+/**
+* @file random.h
+*
+* @brief Counter-based pseudo random numbers.
+*
+* @see Salmon et al. (2011): Parallel random numbers: as easy as 1, 2, 3, Proceedings of SC11.
+*
+* @author GROOPS Developers
+* @date 2026-10-15
+*
+*/
+/***********************************************/
+
+#ifndef __GROOPS_RANDOM__
+#define __GROOPS_RANDOM__
+
+#include "base/importStd.h"
+
+/***** CLASS ***********************************/
+
+/** @brief Counter-based pseudo random numbers (Philox4x32-10).
+* The random numbers are a pure function of (seed, stream, index) without internal state.
+* Threads and processes can generate any part of a random sequence independently
+* and the result does not depend on the number of threads or processes.
+* @ingroup base */
+class Random
+{
+  UInt64 seed, stream;
+
+public:
+  /// Constructor. Different @p stream numbers give independent sequences for the same @p seed.
+  explicit Random(UInt64 seed, UInt64 stream=0) : seed(seed), stream(stream) {}
+
+  /// 128 random bits at position @p index of the sequence.
+  std::array<UInt32,4> block(UInt64 index) const;
+
+  /// 64 random bits at position @p index of the sequence.
+  UInt64 uint64(UInt64 index) const {auto x = block(index); return (static_cast<UInt64>(x[1])<<32) | x[0];}
+
+  /// Uniform distributed random number in [0,1) at position @p index of the sequence.
+  Double uniform(UInt64 index) const {return std::ldexp(static_cast<Double>(uint64(index)>>11), -53);}
+
+  /// Normal distributed random number (mean 0, standard deviation 1) at position @p index of the sequence.
+  Double normal(UInt64 index) const;
+
+  /// Real random seed from the system (non reproducible).
+  static UInt64 randomSeed();
+};
+
+/***********************************************/
+
+#endif /* __GROOPS_RANDOM__ */
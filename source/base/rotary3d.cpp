@@ -122,6 +122,42 @@ Vector Rotary3d::quaternion() const
 
 /***********************************************/
 
+void rotate(const std::vector<Rotary3d> &rot, MatrixSliceRef xyz, Bool inverse)
+{
+  try
+  {
+    if((xyz.columns() != 3) || (xyz.rows() != rot.size()))
+      throw(Exception("Dimension error: "+xyz.rows()%"%i x "s+xyz.columns()%"%i vectors, "s+rot.size()%"%i rotations"s));
+
+    Double *x = xyz.field();
+    Double *y = x + xyz.ld();
+    Double *z = y + xyz.ld();
+    for(UInt i=0; i<rot.size(); i++)
+    {
+      const auto  &D  = rot[i].field;
+      const Double x0 = x[i], y0 = y[i], z0 = z[i];
+      if(inverse)
+      {
+        x[i] = D[0][0]*x0 + D[1][0]*y0 + D[2][0]*z0;
+        y[i] = D[0][1]*x0 + D[1][1]*y0 + D[2][1]*z0;
+        z[i] = D[0][2]*x0 + D[1][2]*y0 + D[2][2]*z0;
+      }
+      else
+      {
+        x[i] = D[0][0]*x0 + D[0][1]*y0 + D[0][2]*z0;
+        y[i] = D[1][0]*x0 + D[1][1]*y0 + D[1][2]*z0;
+        z[i] = D[2][0]*x0 + D[2][1]*y0 + D[2][2]*z0;
+      }
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 Vector3d Rotary3d::rotate(const Vector3d &v) const
 {
   Vector3d erg;
@@ -106,10 +106,17 @@ public:
   friend Rotary3d rotaryZ(Angle angle);
   friend Rotary3d inverse(const Rotary3d &b);
   friend Rotary3d localNorthEastDown(const Vector3d &point);
+  friend void rotate(const std::vector<Rotary3d> &rot, MatrixSliceRef xyz, Bool inverse);
 };
 
 /***********************************************/
 
+/** @brief Rotation of many vectors.
+* Each row of @p xyz (columns x, y, z) is rotated in place by the corresponding rotation @p rot.at(i),
+* with the transposed rotations if @p inverse is set.
+* The coordinates are processed as contiguous columns (structure of arrays). */
+void rotate(const std::vector<Rotary3d> &rot, MatrixSliceRef xyz, Bool inverse=FALSE);
+
 /** @brief Rotation about x-axis.
 * @param angle in [rad].
 * \f[ D=\left(\begin{array}{ccc}
@@ -15,37 +15,36 @@
 #include "base/importStd.h"
 #include "base/tensor3d.h"
 #include "base/rotary3d.h"
+#include "base/factorTable.h"
 #include "base/sphericalHarmonics.h"
 
 /***********************************************/
 
-Matrix SphericalHarmonics::factor1;
-Matrix SphericalHarmonics::factor2;
-
-/***********************************************/
-
-void SphericalHarmonics::computeFactors(UInt degree)
+const SphericalHarmonics::Factors &SphericalHarmonics::factors(UInt degree)
 {
-  // Enough factors?
-  if(factor1.rows()>degree)
-    return;
+  static FactorTable<Factors> table([](UInt degree)
+  {
+    Factors f;
+    f.factor1 = Matrix(degree+1, Matrix::TRIANGULAR, Matrix::LOWER);
+    f.factor2 = Matrix(degree+1, Matrix::TRIANGULAR, Matrix::LOWER);
 
-  factor1 = Matrix(degree+1, Matrix::TRIANGULAR, Matrix::LOWER);
-  factor2 = Matrix(degree+1, Matrix::TRIANGULAR, Matrix::LOWER);
+    // factors for the recursion P[n-1][n-1] -> P[n][n]
+    if(degree>0) f.factor1(1,1) = std::sqrt(3.);
+    for(UInt n=2; n<=degree; n++)
+      f.factor1(n,n) =  std::sqrt((2.*n+1.)/(2.*n));
 
-  // factors for the recursion P[n-1][n-1] -> P[n][n]
-  if(degree>0) factor1(1,1) = std::sqrt(3.);
-  for(UInt n=2; n<=degree; n++)
-    factor1(n,n) =  std::sqrt((2.*n+1.)/(2.*n));
+    // factors for the recursion P[m][n-1] and P[m][n-2] -> P[m][n]
+    for(UInt m=0; m<degree; m++)
+      for(UInt n=m+1; n<=degree; n++)
+      {
+        Double f0 = (2.*n+1.)/static_cast<Double>((n+m)*(n-m));
+        f.factor1(n,m) =  std::sqrt(f0*(2.*n-1.));
+        f.factor2(n,m) = -std::sqrt(f0*(n-m-1.)*(n+m-1.)/(2.*n-3.));
+      }
+    return f;
+  });
 
-  // factors for the recursion P[m][n-1] and P[m][n-2] -> P[m][n]
-  for(UInt m=0; m<degree; m++)
-    for(UInt n=m+1; n<=degree; n++)
-    {
-      Double f = (2.*n+1.)/static_cast<Double>((n+m)*(n-m));
-      factor1(n,m) =  std::sqrt(f*(2.*n-1.));
-      factor2(n,m) = -std::sqrt(f*(n-m-1.)*(n+m-1.)/(2.*n-3.));
-    }
+  return table(degree);
 }
 
 /***********************************************/
@@ -53,7 +52,9 @@ void SphericalHarmonics::computeFactors(UInt degree)
 // Basis functions Ynm (Cnm and Snm)
 void SphericalHarmonics::CnmSnm(const Vector3d &point, UInt degree, Matrix &Cnm, Matrix &Snm, Bool interior)
 {
-  computeFactors(degree);
+  const Factors &factors = SphericalHarmonics::factors(degree);
+  const Matrix  &factor1 = factors.factor1;
+  const Matrix  &factor2 = factors.factor2;
 
   Cnm = Matrix(degree+1, Matrix::TRIANGULAR, Matrix::LOWER);
   Snm = Matrix(degree+1, Matrix::TRIANGULAR, Matrix::LOWER);
@@ -99,7 +100,8 @@ void SphericalHarmonics::CnmSnm(const Vector3d &point, UInt degree, Matrix &Cnm,
     for(UInt m=0; m<(degree-1); m++)
     {
       Double *c  = &Cnm(m+2,m),     *s  = &Snm(m+2,m);
-      Double *f1 = &factor1(m+2,m), *f2 = &factor2(m+2,m);
+      const Double *f1 = factor1.field()+(m+2)+m*factor1.ld();
+      const Double *f2 = factor2.field()+(m+2)+m*factor2.ld();
 
       for(UInt n=m+2; n<=degree; n++)
       {
@@ -116,9 +118,91 @@ void SphericalHarmonics::CnmSnm(const Vector3d &point, UInt degree, Matrix &Cnm,
 
 /***********************************************/
 
+void SphericalHarmonics::CnmSnm(const std::vector<Vector3d> &points, UInt degree, Matrix &Cnm, Matrix &Snm, Bool interior)
+{
+  const Factors &factors = SphericalHarmonics::factors(degree);
+  const Matrix  &factor1 = factors.factor1;
+  const Matrix  &factor2 = factors.factor2;
+
+  const UInt count = points.size();
+  const UInt cols  = (degree+1)*(degree+2)/2;
+  if((Cnm.rows() != count) || (Cnm.columns() != cols) || (Cnm.getType() != Matrix::GENERAL))
+    Cnm = Matrix(count, cols);
+  if((Snm.rows() != count) || (Snm.columns() != cols) || (Snm.getType() != Matrix::GENERAL))
+    Snm = Matrix(count, cols);
+  if(!count)
+    return;
+
+  std::vector<Double> rr(count), x(count), y(count), z(count);
+  for(UInt k=0; k<count; k++)
+  {
+    const Double r = points.at(k).r();
+    rr[k] = interior ? r*r : 1./(r*r);
+    x[k]  = interior ? points.at(k).x() : points.at(k).x() * rr[k];
+    y[k]  = interior ? points.at(k).y() : points.at(k).y() * rr[k];
+    z[k]  = interior ? points.at(k).z() : points.at(k).z() * rr[k];
+    Cnm(k,0) = interior ? 1e280 : 1e280/r; // dirty trick: to account for small numbers in very high degrees.
+    Snm(k,0) = 0.;
+  }
+
+  // column of degree n and order m
+  auto column = [&](Matrix &A, UInt n, UInt m) {return A.field() + (n*(n+1)/2+m)*A.ld();};
+
+  // Recursion diagonal
+  // C(n-1,n-1) -> C(n,n)
+  for(UInt n=1; n<=degree; n++)
+  {
+    const Double f = factor1(n,n);
+    const Double *c0 = column(Cnm, n-1, n-1), *s0 = column(Snm, n-1, n-1);
+    Double       *c  = column(Cnm, n,   n),   *s  = column(Snm, n,   n);
+    for(UInt k=0; k<count; k++)
+    {
+      c[k] = f * (x[k] * c0[k] - y[k] * s0[k]);
+      s[k] = f * (y[k] * c0[k] + x[k] * s0[k]);
+    }
+  }
+
+  // Recursion secondary diagonal
+  // C(n-1,n-1) -> C(n,n-1)
+  for(UInt n=1; n<=degree; n++)
+  {
+    const Double f = factor1(n,n-1);
+    const Double *c0 = column(Cnm, n-1, n-1), *s0 = column(Snm, n-1, n-1);
+    Double       *c  = column(Cnm, n,   n-1), *s  = column(Snm, n,   n-1);
+    for(UInt k=0; k<count; k++)
+    {
+      c[k] = f * z[k] * c0[k];
+      s[k] = f * z[k] * s0[k];
+    }
+  }
+
+  // Recursion others
+  // C(n-1,m),C(n-2,m) -> C(n,m)
+  for(UInt m=0; m+1<degree; m++)
+    for(UInt n=m+2; n<=degree; n++)
+    {
+      const Double f1 = factor1(n,m), f2 = factor2(n,m);
+      const Double *c1 = column(Cnm, n-1, m), *s1 = column(Snm, n-1, m);
+      const Double *c2 = column(Cnm, n-2, m), *s2 = column(Snm, n-2, m);
+      Double       *c  = column(Cnm, n,   m), *s  = column(Snm, n,   m);
+      for(UInt k=0; k<count; k++)
+      {
+        c[k] = f1 * z[k] * c1[k] + f2 * rr[k] * c2[k];
+        s[k] = f1 * z[k] * s1[k] + f2 * rr[k] * s2[k];
+      }
+    }
+
+  Cnm *= 1e-280; // dirty trick: to account for small numbers in very high degrees.
+  Snm *= 1e-280;
+}
+
+/***********************************************/
+
 Matrix SphericalHarmonics::Pnm(Angle theta, Double _r, UInt degree, Bool interior)
 {
-  computeFactors(degree);
+  const Factors &factors = SphericalHarmonics::factors(degree);
+  const Matrix  &factor1 = factors.factor1;
+  const Matrix  &factor2 = factors.factor2;
 
   Matrix Pnm(degree+1, Matrix::TRIANGULAR, Matrix::LOWER);
 
@@ -154,8 +238,8 @@ Matrix SphericalHarmonics::Pnm(Angle theta, Double _r, UInt degree, Bool interio
     for(UInt m=0; m<(degree-1); m++)
     {
       Double *c  = &Pnm(m+2,m);
-      Double *f1 = &factor1(m+2,m);
-      Double *f2 = &factor2(m+2,m);
+      const Double *f1 = factor1.field()+(m+2)+m*factor1.ld();
+      const Double *f2 = factor2.field()+(m+2)+m*factor2.ld();
 
       for(UInt n=m+2; n<=degree; n++)
       {
@@ -37,10 +37,9 @@ class SphericalHarmonics
   Matrix _cnm, _snm, _sigma2cnm, _sigma2snm;
   Bool   _interior;
 
-  static Matrix factor1, factor2;
-
-  // factors needed for recursion formular
-  static void computeFactors(UInt degree);
+  // factors needed for recursion formular (shared between threads)
+  class Factors {public: Matrix factor1, factor2;};
+  static const Factors &factors(UInt degree);
 
 public:
   /// Default Constructor.
@@ -61,6 +60,13 @@ public:
   * @f[ S_{nm}(\lambda,\vartheta,r) = r^n \sin(m\lambda)P_n^m(\cos\vartheta) @f] */
   static void CnmSnm(const Vector3d &point, UInt maxDegree, Matrix &Cnm, Matrix &Snm, Bool interior=FALSE);
 
+  /** @brief Solid spherical harmonics (Cnm und Snm) for many points at once.
+  * Same as above, but the recursion runs over all @a points simultaneously (vectorizable).
+  * The results are stored columnwise: row k contains the values of @a points(k)
+  * and column n*(n+1)/2+m belongs to degree n and order m.
+  * @a Cnm and @a Snm are only reallocated if the dimensions change, so they can be reused as scratch buffers. */
+  static void CnmSnm(const std::vector<Vector3d> &points, UInt maxDegree, Matrix &Cnm, Matrix &Snm, Bool interior=FALSE);
+
   /** @brief Solid Legendre functions (Pnm).
   * (4Pi normalized).
   * @f[ P_{nm}(\lambda,\vartheta,r) = \frac{1}{r^{n+1}} P_n^m(\cos\vartheta) @f]
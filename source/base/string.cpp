@@ -14,6 +14,7 @@
 #include "base/importStd.h"
 #include "base/string.h"
 #include <regex>
+#include <cerrno>
 
 /***********************************************/
 
@@ -55,39 +56,77 @@ std::string String::trim(const std::string &str)
 
 Double String::toDouble(const std::string &str)
 {
-  try
-  {
-    if(std::all_of(str.begin(), str.end(), ::isspace))
-      return 0.;
+  return toDouble(str.data(), str.data()+str.size());
+}
 
-    std::string str2 = str;
-    auto dpos = str.find_first_of("Dd");
-    if(dpos != std::string::npos)
-      str2[dpos] = 'e';
+/***********************************************/
 
-    return std::stod(str2);
-  }
-  catch(std::exception &e)
-  {
-    GROOPS_RETHROW_EXTRA("cannot read double from string '"+str+"'", e)
-  }
+Double String::toDouble(const std::string &str, std::size_t pos, std::size_t len)
+{
+  if(pos > str.size())
+    throw(Exception("cannot read double at position "+std::to_string(pos)+" from string '"+str+"'"));
+  return toDouble(str.data()+pos, str.data()+pos+std::min(len, str.size()-pos));
+}
+
+/***********************************************/
+
+Double String::toDouble(const Char *begin, const Char *end)
+{
+  while((begin < end) && std::isspace(static_cast<unsigned char>(*begin)))
+    begin++;
+  if(begin == end)
+    return 0.;
+
+  // null terminated copy on the stack, Fortran exponent (D) is replaced
+  Char buffer[64];
+  const std::size_t size = std::min(static_cast<std::size_t>(end-begin), sizeof(buffer)-1);
+  std::transform(begin, begin+size, buffer, [](Char c) {return ((c == 'D') || (c == 'd')) ? 'e' : c;});
+  buffer[size] = '\0';
+
+  Char *ptr;
+  errno = 0;
+  const Double value = std::strtod(buffer, &ptr);
+  if((ptr == buffer) || ((errno == ERANGE) && (std::fabs(value) == HUGE_VAL)))
+    throw(Exception("cannot read double from string '"+std::string(begin, end)+"'"));
+  return value; // underflow to denormal or zero is accepted
 }
 
 /***********************************************/
 
 Int String::toInt(const std::string &str)
 {
-  try
-  {
-    if(std::all_of(str.begin(), str.end(), ::isspace))
-      return 0;
+  return toInt(str.data(), str.data()+str.size());
+}
 
-    return std::stoi(str);
-  }
-  catch(std::exception &e)
-  {
-    GROOPS_RETHROW_EXTRA("cannot read integer from string '"+str+"'", e)
-  }
+/***********************************************/
+
+Int String::toInt(const std::string &str, std::size_t pos, std::size_t len)
+{
+  if(pos > str.size())
+    throw(Exception("cannot read integer at position "+std::to_string(pos)+" from string '"+str+"'"));
+  return toInt(str.data()+pos, str.data()+pos+std::min(len, str.size()-pos));
+}
+
+/***********************************************/
+
+Int String::toInt(const Char *begin, const Char *end)
+{
+  while((begin < end) && std::isspace(static_cast<unsigned char>(*begin)))
+    begin++;
+  if(begin == end)
+    return 0;
+
+  Char buffer[32];
+  const std::size_t size = std::min(static_cast<std::size_t>(end-begin), sizeof(buffer)-1);
+  std::copy_n(begin, size, buffer);
+  buffer[size] = '\0';
+
+  Char *ptr;
+  errno = 0;
+  const long value = std::strtol(buffer, &ptr, 10);
+  if((ptr == buffer) || (errno == ERANGE) || (value < std::numeric_limits<Int>::min()) || (value > std::numeric_limits<Int>::max()))
+    throw(Exception("cannot read integer from string '"+std::string(begin, end)+"'"));
+  return static_cast<Int>(value);
 }
 
 /***********************************************/
@@ -204,3 +243,65 @@ std::regex String::wildcard2regex(const std::string &pattern)
 }
 
 /***********************************************/
+
+String::Wildcard::Wildcard(const std::string &pattern)
+{
+  try
+  {
+    for(UInt i=0; i<pattern.size(); i++)
+    {
+      if((pattern[i] == '\\') && (i+1 < pattern.size()) && ((pattern[i+1] == '*') || (pattern[i+1] == '?')))
+      {
+        literal.push_back(pattern[++i]);
+        isAny.push_back(FALSE);
+        continue;
+      }
+      literal.push_back(pattern[i]);
+      isAny.push_back((pattern[i] == '*') || (pattern[i] == '?'));
+    }
+    anything = (literal == "*") && isAny.at(0);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Bool String::Wildcard::match(const std::string &str) const
+{
+  if(anything)
+    return TRUE;
+
+  // greedy matching with backtracking to the last *
+  UInt i = 0, k = 0;
+  UInt iStar = 0, kStar = 0;
+  Bool star  = FALSE;
+  while(i < str.size())
+  {
+    if((k < literal.size()) && isAny[k] && (literal[k] == '*'))
+    {
+      kStar = k++;
+      iStar = i;
+      star  = TRUE;
+    }
+    else if((k < literal.size()) && (isAny[k] || (literal[k] == str[i])))
+    {
+      i++;
+      k++;
+    }
+    else if(star)
+    {
+      k = kStar+1;
+      i = ++iStar;
+    }
+    else
+      return FALSE;
+  }
+  while((k < literal.size()) && isAny[k] && (literal[k] == '*'))
+    k++;
+  return (k == literal.size());
+}
+
+/***********************************************/
@@ -41,6 +41,21 @@ namespace String
   /** @brief Convert to Int. Returns 0 if substring is all white spaces. */
   Int toInt(const std::string &str);
 
+  /** @brief Convert the substring @p str[@p pos, @p pos+@p len) to Double without creating a temporary string.
+  * Same as toDouble(str.substr(pos, len)). */
+  Double toDouble(const std::string &str, std::size_t pos, std::size_t len=std::string::npos);
+
+  /** @brief Convert the substring @p str[@p pos, @p pos+@p len) to Int without creating a temporary string.
+  * Same as toInt(str.substr(pos, len)). */
+  Int toInt(const std::string &str, std::size_t pos, std::size_t len=std::string::npos);
+
+  /** @brief Convert the characters [@p begin, @p end) to Double. Returns 0 if all white spaces.
+  * Fortran exponents (e.g. 1.0D-05) are accepted. */
+  Double toDouble(const Char *begin, const Char *end);
+
+  /** @brief Convert the characters [@p begin, @p end) to Int. Returns 0 if all white spaces. */
+  Int toInt(const Char *begin, const Char *end);
+
   /** @brief test whether the @a str starts with @p test. */
   Bool startsWith(const std::string &str, const std::string &test);
 
@@ -59,6 +74,25 @@ namespace String
   /** @brief Convert a simple wildcard pattern into an equivalent regex expression.
   * Wildcards *, ? can be escaped \*, \?. */
   std::regex wildcard2regex(const std::string &pattern);
+
+  /** @brief Compiled simple wildcard pattern.
+  * Matches the same strings as wildcard2regex (*, ? can be escaped \*, \?)
+  * without the overhead of std::regex. */
+  class Wildcard
+  {
+    std::string       literal; // pattern with resolved escapes
+    std::vector<Bool> isAny;   // wildcard (* or ?) at this position
+    Bool              anything;
+
+  public:
+    explicit Wildcard(const std::string &pattern="*");
+
+    /** @brief Test whether @p str matches the pattern. */
+    Bool match(const std::string &str) const;
+
+    /** @brief Pattern is only * and matches every string. */
+    Bool matchAll() const {return anything;}
+  };
 }
 
 /***********************************************/
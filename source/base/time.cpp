@@ -182,6 +182,126 @@ Time medianSampling(const std::vector<Time> &times)
 
 /***********************************************/
 
+void MedianSampling::add(const std::vector<Time> &times)
+{
+  for(UInt i=0; i<times.size(); i++)
+  {
+    if(timesCount+i > 0)
+    {
+      const Time diff = times.at(i) - ((i > 0) ? times.at(i-1) : timeLast);
+      count[std::make_pair(diff.mjdInt(), diff.mjdMod())]++;
+    }
+  }
+  if(times.size())
+    timeLast = times.back();
+  timesCount += times.size();
+}
+
+/***********************************************/
+
+Time MedianSampling::median() const
+{
+  // k-th smallest time difference
+  auto element = [&](UInt k)
+  {
+    for(const auto &c : count)
+    {
+      if(k < c.second)
+        return Time(c.first.first, c.first.second);
+      k -= c.second;
+    }
+    return Time();
+  };
+
+  if(timesCount < 2)
+    return Time();
+  if(timesCount == 2)
+    return element(0);
+  // same element selection as medianSampling()
+  return (timesCount-1) % 2 == 0 ? element(timesCount/2-1)*0.5 + element(timesCount/2)*0.5 : element(timesCount/2);
+}
+
+/***********************************************/
+
+constexpr Int64 TimeGrid::NANOSECONDS_PER_DAY;
+
+/***********************************************/
+
+TimeGrid::TimeGrid(const Time &timeStart, const Time &sampling, UInt count)
+  : mjdInt(timeStart.mjdInt()),
+    nanoStart(std::llround(timeStart.mjdMod()*NANOSECONDS_PER_DAY)),
+    nanoSampling(sampling.mjdInt()*NANOSECONDS_PER_DAY + std::llround(sampling.mjdMod()*NANOSECONDS_PER_DAY)),
+    _count(count)
+{
+  if(nanoSampling < 0)
+    throw(Exception("TimeGrid: negative sampling"));
+}
+
+/***********************************************/
+
+TimeGrid TimeGrid::fromTimes(const std::vector<Time> &times, Double margin)
+{
+  try
+  {
+    if(!times.size())
+      return TimeGrid();
+    TimeGrid grid(times.front(), (times.size() > 1) ? (1./(times.size()-1))*(times.back()-times.front()) : Time(), times.size());
+    for(UInt i=1; i+1<times.size(); i++)
+      if(std::fabs((times.at(i)-grid.at(i)).seconds()) > margin)
+        return TimeGrid();
+    return grid;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Time TimeGrid::at(UInt i) const
+{
+  const Int64 nano = nanoStart + static_cast<Int64>(i)*nanoSampling;
+  const Int64 days = nano/NANOSECONDS_PER_DAY; // nano >= 0
+  return Time(mjdInt+static_cast<Int>(days), static_cast<Double>(nano-days*NANOSECONDS_PER_DAY)/NANOSECONDS_PER_DAY);
+}
+
+/***********************************************/
+
+std::vector<Time> TimeGrid::times() const
+{
+  std::vector<Time> times(_count);
+  for(UInt i=0; i<_count; i++)
+    times.at(i) = at(i);
+  return times;
+}
+
+/***********************************************/
+
+Double TimeGrid::index(const Time &time) const
+{
+  if(!nanoSampling)
+    return 0.;
+  return (static_cast<Double>(static_cast<Int64>(time.mjdInt()-mjdInt)*NANOSECONDS_PER_DAY - nanoStart)
+          + time.mjdMod()*NANOSECONDS_PER_DAY)/nanoSampling;
+}
+
+/***********************************************/
+
+UInt TimeGrid::upperBound(const Time &time) const
+{
+  // estimate, then correct with exact comparisons (considering TIME_EPSILON)
+  const Double idx = std::floor(index(time))+1;
+  UInt k = static_cast<UInt>(std::min(std::max(idx, 0.), static_cast<Double>(_count)));
+  while((k < _count) && !(time < at(k)))
+    k++;
+  while((k > 0) && (time < at(k-1)))
+    k--;
+  return k;
+}
+
+/***********************************************/
+
 Bool isRegular(const std::vector<Time> &times, Double margin)
 {
   if(times.size()<=2)
@@ -16,6 +16,7 @@
 #define __GROOPS_TIME__
 
 #include "base/importStd.h"
+#include <map>
 #include "base/constants.h"
 
 /**
@@ -99,6 +100,52 @@ public:
   Bool operator>= (const Time &time) const {return !(*this<time);}
 };
 
+/***** CLASS ***********************************/
+
+/** @brief Uniform time grid: epochs timeStart + i*sampling for i=0..count-1.
+* Start and sampling are stored as integer nanoseconds, so epochs are computed
+* without accumulated rounding errors. Mapping between index and time is O(1)
+* instead of a search in a vector of epochs. */
+class TimeGrid
+{
+  Int   mjdInt;       // start day
+  Int64 nanoStart;    // start within day [ns]
+  Int64 nanoSampling; // [ns]
+  UInt  _count;
+
+public:
+  /// Default Constructor (empty grid).
+  TimeGrid() : mjdInt(0), nanoStart(0), nanoSampling(0), _count(0) {}
+
+  /// Constructor.
+  TimeGrid(const Time &timeStart, const Time &sampling, UInt count);
+
+  /** @brief Grid of @p times if all epochs are equally spaced within @p margin [seconds].
+  * Otherwise an empty grid (count()==0) is returned. */
+  static TimeGrid fromTimes(const std::vector<Time> &times, Double margin=1e-5);
+
+  /// Number of epochs.
+  UInt count() const {return _count;}
+
+  /// Time difference between epochs.
+  Time sampling() const {return Time(0, static_cast<Double>(nanoSampling)/NANOSECONDS_PER_DAY);}
+
+  /// Epoch with index @p i.
+  Time at(UInt i) const;
+
+  /// All epochs.
+  std::vector<Time> times() const;
+
+  /// Fractional index of @p time: (time-timeStart)/sampling.
+  Double index(const Time &time) const;
+
+  /** @brief First index with an epoch greater than @p time.
+  * Same as std::upper_bound() on times() with Time comparisons, computed in O(1). */
+  UInt upperBound(const Time &time) const;
+
+  static constexpr Int64 NANOSECONDS_PER_DAY = 86400000000000;
+};
+
 /***** FUNCTIONS *******************************/
 
 /// MJD (modified julian date) to Time representation.
@@ -117,6 +164,25 @@ inline void time2date(const Time &time, UInt &year, UInt &month, UInt &day, UInt
 /// @brief Median sampling of a time series.
 Time medianSampling(const std::vector<Time> &times);
 
+/** @brief Median sampling of a long time series given in consecutive parts (e.g. arcs of an instrument file).
+* Same result as medianSampling() of the concatenated times,
+* but only the distinct time differences are stored instead of all times. */
+class MedianSampling
+{
+  std::map<std::pair<Int, Double>, UInt> count; // time difference (exact) -> number of occurrences
+  Time timeLast;
+  UInt timesCount;
+
+public:
+  MedianSampling() : timesCount(0) {}
+
+  /** @brief Append @p times to the series. */
+  void add(const std::vector<Time> &times);
+
+  /** @brief Median sampling of all times added so far. */
+  Time median() const;
+};
+
 /** @brief return true if all points are equally spaced.
 * @param times series to be tested
 * @param margin threshold for equality [seconds] */
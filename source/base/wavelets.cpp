@@ -40,226 +40,64 @@ Vector highpass(const Vector &w)
 
 /***********************************************/
 
-void halfbandFilter(const Matrix &input, const Vector &wl, Matrix &detailCoefficients, Matrix &approxCoefficients)
+// symmetric extension of a column by p samples at both sides
+// (samples beyond the length of the column mirror the already extended samples)
+static void symmetricExtension(const Matrix &x, UInt column, UInt p, std::vector<Double> &ext)
 {
-  // high/lowpass filters
-  const Vector hn = lowpass(wl);
-  const Vector gn = highpass(wl);
-
-  if(hn.size() != gn.size())
-    throw(Exception("Length of high- and low-pass filters do not match."));
-
-  // filter order
-  const UInt order = hn.rows();
-
-  // symmetric padding
-  Matrix padded(2*order+input.rows(), input.columns());
-  copy(input, padded.row(order, input.rows()));
-  for(UInt k = 0; k < order; k++)
-  {
-    copy(input.row(k), padded.row(order - 1 - k));
-    copy(input.row(input.rows() - 1 - k), padded.row(input.rows() + order + k));
-  }
-
-  // initialize state
-  Matrix stateLowpass(order, padded.columns());
-  Matrix stateHighpass(order, padded.columns());
-
-  // filter input signal
-  Matrix outputLowpass(padded.rows(), padded.columns());
-  Matrix outputHighpass(padded.rows(), padded.columns());
-
-  for(UInt k = 0; k<padded.rows(); k++)
-  {
-    // yn = b0 * xn + s0
-    axpy(hn(0), padded.row(k), outputLowpass.row(k));
-    axpy(1.0, stateLowpass.row(0), outputLowpass.row(k));
-
-    axpy(gn(0), padded.row(k), outputHighpass.row(k));
-    axpy(1.0, stateHighpass.row(0), outputHighpass.row(k));
-
-    // s_i = b_i+1 * xn + s_i+1 - a_i+1*yn
-    for(UInt i = 0; i<order-1; i++)
-    {
-      copy(stateLowpass.row(i+1), stateLowpass.row(i));
-      if(i+1<hn.rows())
-        axpy(hn(i+1), padded.row(k), stateLowpass.row(i));
-
-      copy(stateHighpass.row(i+1), stateHighpass.row(i));
-      if(i+1<gn.rows())
-        axpy(gn(i+1), padded.row(k), stateHighpass.row(i));
-    }
-  }
-
-  // compute output
-  const UInt outputSize = (padded.rows()-order-1)/2;
-  detailCoefficients = Matrix(outputSize, padded.columns());
-  approxCoefficients = Matrix(outputSize, padded.columns());
-
-  for(UInt k = 0; k<outputSize ; k++)
+  const UInt n = x.rows();
+  ext.resize(n+2*p);
+  for(UInt i=0; i<n; i++)
+    ext[p+i] = x(i, column);
+  for(UInt i=0; i<p; i++)
   {
-    copy(outputLowpass.row(order+1+2*k), approxCoefficients.row(k));
-    copy(outputHighpass.row(order+1+2*k), detailCoefficients.row(k));
+    ext[p-1-i] = (i<n) ? x(i, column)     : ext[p+i];
+    ext[p+n+i] = (i<n) ? x(n-1-i, column) : ext[p-1-(i-n)];
   }
 }
 
 /***********************************************/
 
-std::vector<Matrix> waveletTransform(const Matrix &input, const Vector &wl, UInt maxLevel)
+// filter extended columns with hn and gn and keep every second sample: y(k) = sum_i h(i) ext(offset+2k-i)
+static void decimatedFilter(const Matrix &x, const Vector &hn, const Vector &gn, UInt p, UInt offset, UInt outputSize,
+                            Matrix &approx, Matrix &detail)
 {
-  maxLevel = std::min(maxLevel, static_cast<UInt>(std::log2(static_cast<Double>(input.rows())/static_cast<Double>(wl.rows()-1))));
-
-  std::vector<Matrix> levels;
-
-  Matrix detail, approx;
-  approx = input;
-  for(UInt k = 0; k<maxLevel; k++)
+  approx = Matrix(outputSize, x.columns());
+  detail = Matrix(outputSize, x.columns());
+  std::vector<Double> ext;
+  for(UInt s=0; s<x.columns(); s++)
   {
-    Matrix tmp(approx);
-    halfbandFilter(tmp, wl, detail, approx);
-    levels.push_back(detail);
-  }
-  levels.push_back(approx);
-
-  return levels;
-}
-
-/**************************************************************************/
-
-void discreteWaveletTransform(std::vector<Double> &signal, const Vector &wl, UInt J, std::vector<Double> &coefficients, std::vector<UInt> &flag, std::vector<UInt> &length)
-{
-  try
-  {
-    UInt temp_len = signal.size();
-    if((temp_len % 2) != 0)
-    {
-      Double temp =signal.at(temp_len - 1);
-      signal.push_back(temp);
-      flag.push_back(1);
-      temp_len++;
-    }
-    else
-      flag.push_back(0);
-    length.push_back(temp_len);
-    flag.push_back(J);
-    // flag contains symmetric extension length
-
-    std::vector<Double> originalSignal, approxs, details;
-    originalSignal = signal;
-
-    // Storing Filter Values
-    std::vector<Double> lpDecom,hpDecom,lpRecon,hpRecon;
-    filtCoef(wl,lpDecom,hpDecom,lpRecon,hpRecon);
-
-    for(UInt iter = 0; iter < J; iter++)
+    symmetricExtension(x, s, p, ext);
+    for(UInt k=0; k<outputSize; k++)
     {
-      UInt factor = 2; // Downsampling Factor is 2
-      UInt lf = lpDecom.size();
-      symmExtention(signal,lf-1);
-
-      std::vector<Double> cA;
-      //Low Pass Branch Computation
-      convfft(signal,lpDecom,cA);
-      cA.erase(cA.begin(),cA.begin()+lf);
-      cA.erase(cA.end()-lf+1,cA.end());
-      downSampling(cA, factor, approxs);
-
-      //High Pass Branch Computation
-      std::vector<Double> cD;
-      convfft(signal,hpDecom,cD);
-      cD.erase(cD.begin(),cD.begin()+lf);
-      cD.erase(cD.end()-lf+1,cD.end());
-      downSampling(cD, factor, details);
-
-      coefficients.insert(coefficients.begin(),details.begin(),details.end());
-      length.insert(length.begin(),details.size());
-
-      if(iter == J-1 )
+      Double a = 0, d = 0;
+      for(UInt i=0; i<hn.rows(); i++)
       {
-        coefficients.insert(coefficients.begin(),approxs.begin(),approxs.end());
-        length.insert(length.begin(),approxs.size());
+        a += hn(i) * ext[offset+2*k-i];
+        d += gn(i) * ext[offset+2*k-i];
       }
-
-      signal.clear();
-      signal = approxs;
-      approxs.clear();
-      details.clear();
-     }
-     signal = originalSignal;
-  }
-
-  catch(std::exception &e)
-  {
-    GROOPS_RETHROW(e)
+      approx(k, s) = a;
+      detail(k, s) = d;
+    }
   }
 }
-/********************************************************************/
 
-void inverseDiscreteWaveletTransform(std::vector<Double> &dwtop, const Vector &wl, const std::vector<UInt> &flag, std::vector<Double> &recoveredSignal, std::vector<UInt> &length)
+/***********************************************/
+
+void halfbandFilter(const Matrix &input, const Vector &wl, Matrix &detailCoefficients, Matrix &approxCoefficients)
 {
   try
   {
-    UInt J = flag.at(1);
-    UInt lf;
+    // high/lowpass filters
+    const Vector hn = lowpass(wl);
+    const Vector gn = highpass(wl);
 
-    std::vector<Double> approxs;
-    std::vector<Double> details;
-    UInt appLen = length.at(0);
-    UInt detLen = length.at(1);
+    // filter order
+    const UInt order = hn.rows();
+    if(input.rows() < order)
+      throw(Exception("time series ("+input.rows()%"%i samples) shorter than wavelet filter ("s+order%"%i)"s));
 
-    std::vector<Double>::iterator dwt;
-    dwt = dwtop.begin();
-    approxs.assign(dwt,dwtop.begin()+appLen);
-    details.assign(dwtop.begin()+appLen, dwtop.begin()+ 2* appLen);
-
-    for(UInt i = 0; i < J; i++)
-    {
-      UInt factor = 2; // Upsampling Factor
-      // Storing Filter Values
-      std::vector<Double> lpDecom,hpDecom, lpRecon, hpRecon;
-      filtCoef(wl, lpDecom,hpDecom, lpRecon, hpRecon);
-      lf = lpRecon.size();
-
-      // Operations in the Low Frequency branch of the Synthesis Filter Bank
-      std::vector<Double> X_lp;
-      std::vector<Double> cA_up;
-      upSampling(approxs, factor,cA_up);
-      cA_up.pop_back();
-      convfft(cA_up, lpRecon, X_lp);
-
-      // Operations in the High Frequency branch of the Synthesis Filter Bank
-      std::vector<Double> X_hp;
-      std::vector<Double> cD_up;
-      upSampling(details, factor, cD_up);
-      cD_up.pop_back();
-      convfft(cD_up, hpRecon, X_hp);
-
-      appLen += detLen;
-      recoveredSignal.resize(X_lp.size());
-      transform (X_lp.begin(), X_lp.end(), X_hp.begin(), X_hp.begin(), [](Double i, Double j ){return i+j;});
-      recoveredSignal = X_hp;
-      recoveredSignal.erase(recoveredSignal.begin(),recoveredSignal.begin()+lf-2);
-      recoveredSignal.erase(recoveredSignal.end()-(lf - 2),recoveredSignal.end());
-
-      approxs.clear();
-      details.clear();
-
-      if(i < J - 1)
-      {
-        detLen = length.at(i+2);
-        for (UInt l = 0; l < detLen;l++)
-        {
-          Double temp = dwtop.at(appLen + l);
-          details.push_back(temp);
-        }
-      }
-      approxs = recoveredSignal;
-      for(UInt iter1 = 0; iter1 < (approxs.size() - detLen); iter1++)
-        approxs.pop_back();
-    }
-    // Remove Padding
-    UInt paddLength = flag.at(0);
-    recoveredSignal.erase(recoveredSignal.end()- paddLength,recoveredSignal.end());
+    // causal filter of the symmetric padded input, keep samples order+1+2k
+    decimatedFilter(input, hn, gn, order, order+1, (input.rows()+order-1)/2, approxCoefficients, detailCoefficients);
   }
   catch(std::exception &e)
   {
@@ -267,119 +105,54 @@ void inverseDiscreteWaveletTransform(std::vector<Double> &dwtop, const Vector &w
   }
 }
 
-/********************************************/
+/***********************************************/
 
-void convfft(std::vector<Double> &a, std::vector<Double> &b, std::vector<Double> &c)
+std::vector<Matrix> waveletTransform(const Matrix &input, const Vector &wl, UInt maxLevel)
 {
-  try
-  {
-     UInt N = a.size() + b.size() - 1;
-     std::vector<std::complex<Double> > inp, filt;
-     for(UInt i=0; i < a.size(); i++)
-     {
-       Double temp = a.at(i);
-       inp.push_back(std::complex<Double>(temp,0));
-     }
-     for(UInt i =0; i < b.size(); i++)
-     {
-       Double temp = b.at(i);
-       filt.push_back(std::complex<Double>(temp,0));
-     }
-     //apply Fast Fourier Transform
-     dfft(inp,1,N);
-     dfft(filt,1,N);
-     std::vector<std::complex<Double> > temp;
-     UInt K=inp.size();
-     for(UInt i =0; i < K; i++)
-     {
-       std::complex<Double> mult = inp.at(i)*filt.at(i);
-       temp.push_back(mult);
-     }
-     dfft(temp, -1 , K);
-     for(UInt i =0; i < N ; i++)
-     {
-       Double temp1 =real(temp.at(i));
-       c.push_back(temp1);
-     }
+  maxLevel = std::min(maxLevel, static_cast<UInt>(std::log2(static_cast<Double>(input.rows())/static_cast<Double>(wl.rows()-1))));
 
-  }
-  catch(std::exception &e)
+  std::vector<Matrix> levels;
+
+  Matrix detail, approx;
+  approx = input;
+  for(UInt k = 0; k<maxLevel; k++)
   {
-    GROOPS_RETHROW(e)
+    halfbandFilter(Matrix(approx), wl, detail, approx);
+    levels.push_back(detail);
   }
+  levels.push_back(approx);
+
+  return levels;
 }
 
-/***************************************************************/
+/***********************************************/
 
-void dfft(std::vector<std::complex<Double> > &data, int sign,UInt N)
+std::vector<Matrix> discreteWaveletTransform(const Matrix &signal, const Vector &wl, UInt level)
 {
   try
   {
-    Double pi = -PI;
-    if(sign == 1 || sign == -1)
-      pi = sign * pi;
-    UInt len = data.size();
-    std::vector<std::complex<Double> >::iterator it;
-    it = data.end();
-    if(len != N)
-    {
-      UInt al = N - len;
-      data.insert(it, al, std::complex<Double> (0,0));
-    }
-
-    UInt K = (UInt) pow(2.0,ceil(log10(static_cast<Double>(N))/log10(2.0)));
-    std::vector<std::complex<Double> >::iterator it1;
-    it1 = data.end();
-    if(N < K)
-    {
-      UInt al = K - N;
-      data.insert(it1,al,std::complex<Double>(0,0));
-      N = K;
-    }
-
-    bitreverse(data);
+    const Vector hn = lowpass(wl);
+    const Vector gn = highpass(wl);
+    const UInt   lf = hn.rows();
 
-    for(UInt iter = 1; iter < N; iter <<=1)
+    // odd number of samples: repeat last sample
+    Matrix approx = signal;
+    if(approx.rows() % 2)
     {
-      const UInt step = iter << 1;
-      const Double theta =  pi / Double(iter);
-      Double wtemp = sin(theta * .5);
-
-      //Multipliers
-      Double wreal = -2 * wtemp * wtemp;
-      Double wimag = sin(theta);
-
-      //Factors
-      Double wr = 1.0;
-      Double wi = 0.0;
-
-      //Iteration through two loops
-      for(UInt m = 0; m < iter; m++)
-      {
-        //Iteration within m
-        for(UInt i = m; i < N; i += step)
-        {
-          //jth position
-          const UInt j = i + iter;
-          Double tempr = wr * real(data.at(j)) - wi * imag(data.at(j));
-          Double tempi = wr * imag(data.at(j)) + wi * real(data.at(j));
-          std::complex<Double> temp(tempr,tempi);
-          data.at(j)  = data.at(i) - temp;
-          data.at(i) += temp;
-        }
-
-        wtemp = wr;
-        wr += wr * wreal - wi * wimag;
-        wi += wi * wreal + wtemp * wimag ;
-      }
+      approx = Matrix(signal.rows()+1, signal.columns());
+      copy(signal, approx.row(0, signal.rows()));
+      copy(signal.row(signal.rows()-1), approx.row(signal.rows()));
     }
 
-    if(sign == -1)
+    std::vector<Matrix> coefficients(level+1);
+    for(UInt j=0; j<level; j++)
     {
-      Double scale = 1.0/Double(N);
-      for (UInt i = 0; i < N; i++)
-        data.at(i) *= scale;
+      Matrix a;
+      decimatedFilter(approx, hn, gn, lf-1, lf, (approx.rows()+lf-1)/2, a, coefficients.at(level-j));
+      approx = std::move(a);
     }
+    coefficients.at(0) = std::move(approx);
+    return coefficients;
   }
   catch(std::exception &e)
   {
@@ -387,58 +160,50 @@ void dfft(std::vector<std::complex<Double> > &data, int sign,UInt N)
   }
 }
 
-/**************************************************************/
+/***********************************************/
 
-void bitreverse(std::vector<std::complex<Double> > &signal)
+// one synthesis step: upsampling and reconstruction filtering of approximation and detail (both may be empty)
+static Matrix synthesisStep(const Matrix &approx, const Matrix &detail, const Vector &lpRecon, const Vector &hpRecon, UInt rows, UInt columns)
 {
-  try
-  {
-    UInt len = signal.size();
-    UInt N   = (UInt) pow(2.0,ceil(log10(static_cast<Double>(len))/log10(2.0)));
-    UInt rev = 0;
-    //Processing Input Data
-    for(UInt iter = 0; iter < N; ++iter)
-    {
-      if (rev > iter)
+  const UInt lf = lpRecon.rows();
+  Matrix x(rows, columns);
+  for(const auto &filter : {std::make_pair(&approx, &lpRecon), std::make_pair(&detail, &hpRecon)})
+  {
+    const Matrix &c = *filter.first;
+    const Vector &h = *filter.second;
+    if(!c.size())
+      continue;
+    if(2*c.rows()+2 < lf+rows)
+      throw(Exception("wavelet coefficients ("+c.rows()%"%i) too short for "s+rows%"%i samples"s));
+    // x(r) = sum_k h(r+lf-2-2k) c(k)
+    for(UInt s=0; s<columns; s++)
+      for(UInt r=0; r<rows; r++)
       {
-        //Replacing current values with reversed values
-        Double tempr = real(signal.at(rev));
-        Double tempi = imag(signal.at(rev));
-        std::complex<Double> temp(tempr,tempi);
-        signal.at(rev)  = signal.at(iter);
-        signal.at(iter) = temp;
+        const UInt kMin = r/2;
+        const UInt kMax = std::min((r+lf-2)/2+1, c.rows());
+        Double sum = 0;
+        for(UInt k=kMin; k<kMax; k++)
+          sum += h(r+lf-2-2*k) * c(k, s);
+        x(r, s) += sum;
       }
-      //Using filter "filt" such that the value of reverse changes with each iteration
-      UInt filt = N;
-      while (rev & (filt >>= 1))
-        rev &= ~filt;
-      rev |= filt;
-    }
-  }
-
-  catch(std::exception &e)
-  {
-    GROOPS_RETHROW(e)
   }
+  return x;
 }
 
-/**************************************************************/
+/***********************************************/
 
-void filtCoef(const Vector &wl, std::vector<Double> &lpDecom, std::vector<Double> &hpDecom, std::vector<Double> &lpRecon, std::vector<Double> &hpRecon)
+Matrix inverseDiscreteWaveletTransform(const std::vector<Matrix> &coefficients, const Vector &wl, UInt rows)
 {
   try
   {
-    Vector gn =  highpass(wl);
-    Vector hn =  lowpass (wl);
-    UInt length = gn.size();
-    for(UInt i = 0; i < length; i++)
-    {
-      lpDecom.push_back(hn(i));
-      hpDecom.push_back(gn(i));
-      lpRecon.push_back(hn(length-i-1));
-      hpRecon.push_back(gn(length-i-1));
-    }
+    const UInt level = coefficients.size()-1;
+    const Vector lpRecon = wl;
+    const Vector hpRecon = lowpass(highpass(wl));
 
+    Matrix approx = coefficients.at(0);
+    for(UInt j=1; j<=level; j++)
+      approx = synthesisStep(approx, coefficients.at(j), lpRecon, hpRecon, (j<level) ? coefficients.at(j+1).rows() : rows, approx.columns());
+    return approx;
   }
   catch(std::exception &e)
   {
@@ -446,40 +211,30 @@ void filtCoef(const Vector &wl, std::vector<Double> &lpDecom, std::vector<Double
   }
 }
 
-/*************************************************/
+/***********************************************/
 
-void symmExtention(std::vector<Double> &sig, UInt paddLength)
+std::vector<Matrix> multiresolutionAnalysis(const Matrix &signal, const Vector &wl, UInt level)
 {
   try
   {
-    UInt len = sig.size();
-    for(UInt i =0; i < paddLength; i++)
-    {
-      double temp1= sig.at(i * 2);
-      double temp2= sig.at(len - 1);
-      sig.insert(sig.begin(),temp1);
-      sig.insert(sig.end(),temp2);
-    }
-  }
-  catch(std::exception &e)
-  {
-    GROOPS_RETHROW(e)
-  }
-}
-
-/****************************************************************/
+    const std::vector<Matrix> coefficients = discreteWaveletTransform(signal, wl, level);
+    const Vector lpRecon = wl;
+    const Vector hpRecon = lowpass(highpass(wl));
 
-void downSampling(std::vector<Double> &signal, UInt factor, std::vector<Double> &signalNew)
-{
-  try
-  {
-    UInt len = signal.size();
-    UInt lenNew = (UInt) ceil( (double) len / (double) factor);
-    for(UInt i = 0; i < lenNew; i++)
+    std::vector<Matrix> levels(level+1);
+    for(UInt i=0; i<=level; i++)
     {
-      double temp = signal.at(i*factor);
-      signalNew.push_back(temp);
+      // synthesis of a_J starts with d_J = 0, synthesis of d_j starts with a_j = 0
+      Matrix approx = (i==0) ? coefficients.at(0) : Matrix();
+      Matrix detail = (i==0) ? Matrix() : coefficients.at(i);
+      for(UInt j=std::max(i, UInt(1)); j<=level; j++)
+      {
+        approx = synthesisStep(approx, detail, lpRecon, hpRecon, (j<level) ? coefficients.at(j+1).rows() : signal.rows(), signal.columns());
+        detail = Matrix();
+      }
+      levels.at(i) = std::move(approx);
     }
+    return levels;
   }
   catch(std::exception &e)
   {
@@ -489,27 +244,6 @@ void downSampling(std::vector<Double> &signal, UInt factor, std::vector<Double>
 
 /***********************************************/
 
-void upSampling(std::vector<Double> &signal, UInt factor, std::vector<Double> &signalNew)
-{
-  try
-  {
-    UInt len     = signal.size();
-    UInt lenNew  = (UInt) ceil( (Double) len * (Double) factor);
-    for(UInt i = 0; i < lenNew; i++)
-      if(i % factor == 0)
-      {
-        Double temp = signal.at(i/factor);
-        signalNew.push_back(temp);
-      }
-    else
-      signalNew.push_back(0);
-  }
-  catch(std::exception &e)
-  {
-    GROOPS_RETHROW(e)
-  }
-}
-
 } // end namespace Wavelets
 
 /***********************************************/
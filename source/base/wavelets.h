@@ -86,50 +86,42 @@ namespace Wavelets
   void stationaryHalfbandFilter(const Matrix &input, const Vector &wl, UInt level, Matrix &detailCoefficients, Matrix &approxCoefficients);
 
   /**
-  * @brief Apply discrete wavelet transform to time series.
+  * @brief Discrete wavelet transform of time series.
   *
-  * This routine applies the discrete wavelet transform to time series
-  * and stores the output as a vector with the sequence of approximation and details coefficients.
+  * This routine computes the n-level discrete wavelet transform of all columns of @a signal
+  * simultaneously. Only the retained (decimated) samples of the half-band filters are computed.
+  * Each level is padded symmetrically around the edges. An odd number of samples is
+  * padded with the last sample.
   *
-  * @param signal data series
-  * @param wl wavelet class object
-  * @param J level
-  * @param[out] coefficients wavelet coefficients
-  * @param[out] flag padd length (if added) and level of decomposition
-  * @param[out] length length of each set of details and approximation.*/
-  void discreteWaveletTransform(std::vector<Double> &signal, const Vector &wl, UInt J, std::vector<Double> &coefficients, std::vector<UInt> &flag, std::vector<UInt> &length);
+  * @param signal data series (each column is transformed)
+  * @param wl wavelet coefficients
+  * @param level number of decomposition levels J
+  * @return wavelet coefficients in the sequence ${a_J, d_J,..., d_1}$ */
+  std::vector<Matrix> discreteWaveletTransform(const Matrix &signal, const Vector &wl, UInt level);
 
   /**
-  * @brief Apply inverse discrete wavelet transform.
+  * @brief Inverse discrete wavelet transform.
   *
-  * This routine applies the inverse discrete wavelet transform to a set of coefficients.
+  * This routine applies the inverse discrete wavelet transform to a set of coefficients
+  * as computed by @ref discreteWaveletTransform.
   *
-  * @param dwtop set of coefficients ${a_J, d_J,..., d_1}
-  * @param wl wavelet class object
-  * @param flag padd length (if added) and level of decomposition
-  * @param recoveredSignal output in time domain
-  * @param[out] length length of each set of details and approximation.*/
-  void inverseDiscreteWaveletTransform(std::vector<Double> &dwtop, const Vector &wl, const std::vector<UInt> &flag, std::vector<Double> &recoveredSignal, std::vector<UInt> &length);
-
-  /** @brief compute convolution of two vectors $a$ and $b$ and store the output in $c$.*/
-  void convfft(std::vector<Double> &a, std::vector<Double> &b, std::vector<Double> &c);
-
-  /** @brief compute fast fourier transform.*/
-  void dfft(std::vector<std::complex<Double> > &data, int sign,UInt N);
-
-  /** @brief apply a bit reverse algorithm to sort out the output frequencies of the FFT.*/
-  void bitreverse(std::vector<std::complex<Double> > &signal);
-
-  /** @brief compute decomposition and reconstruction filter coefficients from wavelet file.*/
-  void filtCoef(const Vector &wl, std::vector<Double> &lpDecom, std::vector<Double> &hpDecom, std::vector<Double> &lpRecon, std::vector<Double> &hpRecon);
-
-  /** @brief apply symmetric padding to a signal.*/
-  void symmExtention(std::vector<Double> &sig, UInt paddLength);
-
-  /** @brief apply down-sampling to a signal.*/
-  void downSampling(std::vector<Double> &signal, UInt factor, std::vector<Double> &signalNew);
+  * @param coefficients wavelet coefficients ${a_J, d_J,..., d_1}$
+  * @param wl wavelet coefficients
+  * @param rows number of samples of the recovered signal
+  * @return recovered signal in time domain */
+  Matrix inverseDiscreteWaveletTransform(const std::vector<Matrix> &coefficients, const Vector &wl, UInt rows);
 
-  /** @brief increase the sampling of a signal by inserting 0.*/
-  void upSampling(std::vector<Double> &signal,   UInt factor, std::vector<Double> &signalNew);
+  /**
+  * @brief Multiresolution analysis of time series.
+  *
+  * Decomposes all columns of @a signal into the contributions of the approximation $a_J$ and
+  * the details $d_J,...,d_1$ of a discrete wavelet transform in time domain. The sum of all levels
+  * recovers the signal. The synthesis of each level starts at its own decomposition level.
+  *
+  * @param signal data series (each column is decomposed)
+  * @param wl wavelet coefficients
+  * @param level number of decomposition levels J
+  * @return decomposed signal in the sequence ${a_J, d_J,..., d_1}$, each with the size of @a signal */
+  std::vector<Matrix> multiresolutionAnalysis(const Matrix &signal, const Vector &wl, UInt level);
 }
 #endif
@@ -38,13 +38,28 @@ Use a negative value to shrink the polygon area.
 * @see Border */
 class BorderPolygon : public BorderBase
 {
+  // precomputed cross products of an edge (v0, v1)
+  class Edge
+  {
+  public:
+    Vector3d q, v0q, v1q; // q = v0 x v1, v0 x q, v1 x q
+  };
+
   Ellipsoid             ellipsoid;
   std::vector<std::vector<Vector3d>> vertices;
-  std::vector<Vector3d> centroid;
+  std::vector<std::vector<Edge>>     edges;
+  std::vector<std::vector<std::vector<UInt>>> azimuthBins; // edge indices sorted into azimuth sectors around the centroid
+  std::vector<Vector3d> centroid, axisX, axisY;            // local frame at centroid
+  std::vector<std::vector<Vector3d>> chunkCenter;          // bounding caps of consecutive edges (for buffer)
+  std::vector<std::vector<Double>>   chunkThreshold;
   std::vector<Double>   capThreshold;
   Bool                  exclude;
   Double                buffer;
 
+  static constexpr UInt chunkSize = 16; // number of edges in a bounding cap
+
+  UInt azimuthBin(const Vector3d &point, UInt polyNo) const;
+
   Bool inPolygon(const Vector3d &testPoint, UInt polyNo) const;
   Bool inBuffer (const Vector3d &testPoint, UInt polyNo) const;
 
@@ -89,6 +104,83 @@ inline BorderPolygon::BorderPolygon(Config &config)
     for(auto &v : vertices.at(i))
       capThreshold.at(i) = std::min(capThreshold.at(i), std::cos(std::acos(inner(centroid.at(i), v)) + std::fabs(buffer)/DEFAULT_R*1e3));
   }
+
+  // The crossing test in inPolygon follows the meridian of the test point with respect to the centroid.
+  // Only edges spanning the azimuth of the test point can cross it, so the edges are sorted into azimuth sectors.
+  // A great circle arc shorter than PI spans an azimuth range of less than PI.
+  edges.resize(polygon.size());
+  azimuthBins.resize(polygon.size());
+  axisX.resize(polygon.size());
+  axisY.resize(polygon.size());
+  for(UInt i=0; i<polygon.size(); i++)
+  {
+    const UInt vertexCount = vertices.at(i).size();
+    axisX.at(i) = normalize(crossProduct(centroid.at(i), (std::fabs(centroid.at(i).z()) < 0.9) ? Vector3d(0,0,1) : Vector3d(1,0,0)));
+    axisY.at(i) = crossProduct(centroid.at(i), axisX.at(i));
+    azimuthBins.at(i).resize(std::max(vertexCount/8, UInt(1)));
+    const UInt binCount = azimuthBins.at(i).size();
+    edges.at(i).resize(vertexCount);
+    for(UInt k=0; k<vertexCount; k++)
+    {
+      const Vector3d &v0 = vertices.at(i).at(k);
+      const Vector3d &v1 = vertices.at(i).at((k+1)%vertexCount);
+      Edge &edge = edges.at(i).at(k);
+      edge.q   = crossProduct(v0, v1);
+      edge.v0q = crossProduct(v0, edge.q);
+      edge.v1q = crossProduct(v1, edge.q);
+
+      const UInt bin0 = azimuthBin(v0, i);
+      const UInt bin1 = azimuthBin(v1, i);
+      if((bin0 == MAX_UINT) || (bin1 == MAX_UINT)) // vertex at centroid or antipode
+      {
+        for(auto &bin : azimuthBins.at(i))
+          bin.push_back(k);
+        continue;
+      }
+      // shorter way around including one sector margin on each side
+      UInt first = bin0, count = (bin1+binCount-bin0)%binCount;
+      if(2*count > binCount)
+      {
+        first = bin1;
+        count = binCount-count;
+      }
+      count = std::min(count+3, binCount);
+      for(UInt n=0; n<count; n++)
+        azimuthBins.at(i).at((first+binCount-1+n)%binCount).push_back(k);
+    }
+  }
+
+  // bounding caps of chunks of edges including the buffer
+  chunkCenter.resize(polygon.size());
+  chunkThreshold.resize(polygon.size());
+  for(UInt i=0; i<polygon.size(); i++)
+  {
+    const UInt vertexCount = vertices.at(i).size();
+    for(UInt k=0; k<vertexCount; k+=chunkSize)
+    {
+      Vector3d center;
+      for(UInt n=k; n<=std::min(k+chunkSize, vertexCount); n++)
+        center += vertices.at(i).at(n%vertexCount);
+      center.normalize();
+      Double psi = 0; // cap radius
+      for(UInt n=k; n<=std::min(k+chunkSize, vertexCount); n++)
+        psi = std::max(psi, std::acos(std::min(inner(center, vertices.at(i).at(n%vertexCount)), 1.)));
+      chunkCenter.at(i).push_back(center);
+      chunkThreshold.at(i).push_back(((psi < PI/2) && (psi+std::fabs(buffer)*1e3/DEFAULT_R < PI)) ? std::cos(psi+std::fabs(buffer)*1e3/DEFAULT_R+1e-9) : -2.);
+    }
+  }
+}
+
+/***********************************************/
+
+inline UInt BorderPolygon::azimuthBin(const Vector3d &point, UInt polyNo) const
+{
+  const Double x = inner(point, axisX.at(polyNo));
+  const Double y = inner(point, axisY.at(polyNo));
+  if(x*x+y*y < 1e-12)
+    return MAX_UINT;
+  const UInt binCount = azimuthBins.at(polyNo).size();
+  return std::min(static_cast<UInt>((std::atan2(y, x)+PI)/(2*PI)*binCount), binCount-1);
 }
 
 /***********************************************/
@@ -101,20 +193,31 @@ inline Bool BorderPolygon::inPolygon(const Vector3d &testPoint, UInt polyNo) con
   const Vector3d p   = crossProduct(testPoint, -centroid.at(polyNo));
   const Vector3d axp = crossProduct(testPoint, p);
   const Vector3d cxp = crossProduct(-centroid.at(polyNo), p);
-  const UInt     vertexCount = vertices.at(polyNo).size();
-  UInt crossingCount = 0;
-  for(UInt k=0; k<vertexCount; k++)
+  // edge crosses the arc from testPoint to -centroid?
+  auto crossing = [&](const Edge &edge)
   {
-    const Vector3d q = crossProduct(vertices.at(polyNo).at(k), vertices.at(polyNo).at((k+1)%vertexCount));
-    const Vector3d t = crossProduct(p, q);
+    const Vector3d t = crossProduct(p, edge.q);
     if(t.norm() == 0.0)
-      continue;
-
+      return FALSE;
     Bool sign = std::signbit(-inner(t, axp));
-    if((sign == std::signbit( inner(t, cxp))) &&
-       (sign == std::signbit(-inner(t, crossProduct(vertices.at(polyNo).at(k), q)))) &&
-       (sign == std::signbit( inner(t, crossProduct(vertices.at(polyNo).at((k+1)%vertexCount), q)))))
-      crossingCount++;
+    return (sign == std::signbit( inner(t, cxp))) &&
+           (sign == std::signbit(-inner(t, edge.v0q))) &&
+           (sign == std::signbit( inner(t, edge.v1q)));
+  };
+
+  UInt crossingCount = 0;
+  const UInt bin = azimuthBin(testPoint, polyNo);
+  if(bin == MAX_UINT)
+  {
+    for(const Edge &edge : edges.at(polyNo))
+      if(crossing(edge))
+        crossingCount++;
+  }
+  else
+  {
+    for(UInt k : azimuthBins.at(polyNo).at(bin))
+      if(crossing(edges.at(polyNo).at(k)))
+        crossingCount++;
   }
 
   return Bool(crossingCount%2);
@@ -128,19 +231,26 @@ inline Bool BorderPolygon::inBuffer(const Vector3d &testPoint, UInt polyNo) cons
     return FALSE;
 
   const Double cosBuffer   = std::cos(buffer*1e3/DEFAULT_R);
+  const Double sinBuffer   = std::sin(std::fabs(buffer)*1e3/DEFAULT_R);
   const UInt   vertexCount = vertices.at(polyNo).size();
-  for(UInt k=0; k<vertexCount; k++)
-    if(cosBuffer <= inner(vertices.at(polyNo).at(k), testPoint))
-      return TRUE;
-
-  const Double sinBuffer = std::sin(std::fabs(buffer)*1e3/DEFAULT_R);
-  for(UInt k=0; k<vertexCount; k++)
+  for(UInt idChunk=0; idChunk<chunkCenter.at(polyNo).size(); idChunk++)
   {
-    const Vector3d n = crossProduct(vertices.at(polyNo).at(k), vertices.at(polyNo).at((k+1)%vertexCount));
-    if((inner(n, crossProduct(testPoint, vertices.at(polyNo).at(k))) <= 0) &&
-       (inner(n, crossProduct(testPoint, vertices.at(polyNo).at((k+1)%vertexCount))) >= 0) &&
-       (std::fabs(inner(testPoint, normalize(n))) <= sinBuffer))
-      return TRUE;
+    if(inner(chunkCenter.at(polyNo).at(idChunk), testPoint) < chunkThreshold.at(polyNo).at(idChunk))
+      continue;
+
+    const UInt end = std::min((idChunk+1)*chunkSize, vertexCount);
+    for(UInt k=idChunk*chunkSize; k<end; k++)
+      if(cosBuffer <= inner(vertices.at(polyNo).at(k), testPoint))
+        return TRUE;
+
+    for(UInt k=idChunk*chunkSize; k<end; k++)
+    {
+      const Vector3d &n = edges.at(polyNo).at(k).q;
+      if((inner(n, crossProduct(testPoint, vertices.at(polyNo).at(k))) <= 0) &&
+         (inner(n, crossProduct(testPoint, vertices.at(polyNo).at((k+1)%vertexCount))) >= 0) &&
+         (std::fabs(inner(testPoint, normalize(n))) <= sinBuffer))
+        return TRUE;
+    }
   }
 
   return FALSE;
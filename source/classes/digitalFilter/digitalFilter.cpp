@@ -161,19 +161,25 @@ Matrix DigitalFilterARMA::filter(const_MatrixSliceRef input) const
     {
       Matrix padded = pad(input, warmup(), padType);
       auto H = frequencyResponse(padded.rows());
-      for(UInt k=0; k<padded.columns(); k++) // Filter column-wise
-      {
-        auto F = Fourier::fft(padded.column(k));
-        for(UInt i=0; i<F.size(); i++)
-          F.at(i) *= H.at(i);
-        copy(Fourier::synthesis(F, (padded.rows()%2==0)), padded.column(k));
-      }
-      return trim(padded, warmup(), padType);
+      auto F = Fourier::fftColumns(padded); // Filter column-wise
+      for(auto &f : F)
+        for(UInt i=0; i<f.size(); i++)
+          f.at(i) *= H.at(i);
+      return trim(Fourier::synthesisColumns(F, (padded.rows()%2==0)), warmup(), padType);
+    }
+
+    // long FIR filters: overlap-add convolution in frequency domain
+    // -------------------------------------------------------------
+    Matrix padded = pad(input, warmup(), padType);
+    if(an.rows() == 1)
+    {
+      const UInt length = overlapAddLength(bn.rows(), padded.rows());
+      if(length)
+        return trim(filterOverlapAdd(padded, length), warmup(), padType);
     }
 
     // filter in time domain
     // ---------------------
-    Matrix padded = pad(input, warmup(), padType);
     Matrix output(padded.rows(), padded.columns());
 
     // pre-fill state for non-causal filters
@@ -248,6 +254,88 @@ std::vector<std::complex<Double>> DigitalFilterARMA::frequencyResponse(UInt leng
 
 /***********************************************/
 
+UInt DigitalFilterARMA::overlapAddLength(UInt filterLength, UInt count)
+{
+  // operations per output sample: time domain ~ filterLength,
+  // overlap-add ~ forward and backward FFT of a block with length L for L-filterLength+1 samples
+  constexpr UInt minFilterLength = 32;
+  if((filterLength < minFilterLength) || (count < filterLength))
+    return 0;
+
+  UInt   bestLength = 0;
+  Double bestCost   = static_cast<Double>(filterLength);
+  for(UInt length=1; length/2<count+filterLength-1; length*=2)
+  {
+    if(length < 2*filterLength)
+      continue;
+    const Double cost = 4.*std::log2(length)*length/(length-filterLength+1) + 8.;
+    if(cost < bestCost)
+    {
+      bestCost   = cost;
+      bestLength = length;
+    }
+  }
+  return bestLength;
+}
+
+/***********************************************/
+
+Matrix DigitalFilterARMA::filterOverlapAdd(const_MatrixSliceRef input, UInt length) const
+{
+  try
+  {
+    // MA part as causal convolution with shifted output: y_n = sum_k h_k x_{n+shift-k}
+    const UInt count  = input.rows();
+    Vector     h      = bn;
+    UInt       shift  = bnStartIndex;
+    if(backward)
+    {
+      for(UInt k=0; k<h.rows(); k++)
+        h(k) = bn(bn.rows()-1-k);
+      shift = bn.rows()-1-bnStartIndex;
+    }
+    Vector hPad(length);
+    copy(h, hPad.row(0, h.rows()));
+    const auto H = Fourier::fft(hPad);
+
+    // all blocks of all columns are transformed in one batch
+    const UInt blockSize = length-h.rows()+1;
+    const UInt blocks    = (count+blockSize-1)/blockSize;
+    Matrix x(length, blocks*input.columns());
+    for(UInt i=0; i<input.columns(); i++)
+      for(UInt b=0; b<blocks; b++)
+      {
+        const UInt rows = std::min(blockSize, count-b*blockSize);
+        copy(input.slice(b*blockSize, i, rows, 1), x.slice(0, i*blocks+b, rows, 1));
+      }
+
+    auto F = Fourier::fftColumns(x);
+    for(auto &f : F)
+      for(UInt k=0; k<f.size(); k++)
+        f.at(k) *= H.at(k);
+    x = Fourier::synthesisColumns(F, (length%2==0));
+
+    // overlap-add: block b contributes to the convolution at b*blockSize ... b*blockSize+length-1
+    Matrix output(count, input.columns());
+    for(UInt i=0; i<input.columns(); i++)
+      for(UInt b=0; b<blocks; b++)
+      {
+        const UInt start = std::max(b*blockSize, shift);
+        const UInt end   = std::min(b*blockSize+length, count+shift);
+        if(start < end)
+          axpy(1., x.slice(start-b*blockSize, i*blocks+b, end-start, 1), output.slice(start-shift, i, end-start, 1));
+      }
+
+    return output;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 UInt DigitalFilterARMA::warmup() const
 {
   return std::max(std::max(bn.rows()-bnStartIndex-1, bnStartIndex), 3*an.rows());  // warump length of filter
@@ -33,6 +33,8 @@ Setting \config{inFrequencyDomain} to true applies the transfer function of the
   y_n = \mathcal{F}^{-1}\{H\cdot\mathcal{F}\{x_n\}\}.
 \end{equation}
 This is equivalent to setting \config{padType} to \config{periodic}.
+Long filters without AR part (e.g. \config{graceLowpass} or \config{wavelet}) are automatically
+applied in time domain by an FFT based overlap-add convolution, which gives the same result as the direct evaluation.
 
 To reduce warmup effects, the input time series can be padded by choosing a \config{padType}:
 \begin{itemize}
@@ -141,6 +143,14 @@ protected:
 
   virtual UInt warmup() const;
 
+  /** @brief FFT length for overlap-add convolution of a FIR filter with @a filterLength coefficients.
+  * Returns zero if filtering in time domain is expected to be faster. */
+  static UInt overlapAddLength(UInt filterLength, UInt count);
+
+  /** @brief Applies the MA part (FIR filter) by overlap-add convolution with FFT blocks of @a length.
+  * Gives the same result as the time domain filter (without AR part). */
+  Matrix filterOverlapAdd(const_MatrixSliceRef input, UInt length) const;
+
 public:
   DigitalFilterARMA() : inFrequencyDomain(FALSE), backward(FALSE), padType(PadType::NONE) {}
   virtual ~DigitalFilterARMA() {}
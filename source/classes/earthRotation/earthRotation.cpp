@@ -16,6 +16,7 @@
 #include "base/planets.h"
 #include "config/configRegister.h"
 #include "classes/earthRotation/earthRotationFile.h"
+#include "classes/earthRotation/earthRotationInterpolated.h"
 #include "classes/earthRotation/earthRotationIers2010.h"
 #include "classes/earthRotation/earthRotationIers2010b.h"
 #include "classes/earthRotation/earthRotationIers2003.h"
@@ -32,6 +33,7 @@
 
 GROOPS_REGISTER_CLASS(EarthRotation, "earthRotationType",
                       EarthRotationFile,
+                      EarthRotationInterpolated,
                       EarthRotationIers2010,
                       EarthRotationIers2010b,
                       EarthRotationIers2003,
@@ -60,6 +62,8 @@ EarthRotationPtr EarthRotation::create(Config &config, const std::string &name)
 
     if(readConfigChoiceElement(config, "file",     choice, "interpolated values from file"))
       earthRotation = EarthRotationPtr(new EarthRotationFile(config));
+    if(readConfigChoiceElement(config, "interpolated", choice, "interpolated values of a precise model computed in memory"))
+      earthRotation = EarthRotationPtr(new EarthRotationInterpolated(config));
     if(readConfigChoiceElement(config, "iers2010",  choice, "IERS conventions 2010"))
       earthRotation = EarthRotationPtr(new EarthRotationIers2010(config));
     if(readConfigChoiceElement(config, "iers2010b", choice, "IERS conventions 2010 with HF EOP model"))
@@ -96,7 +100,47 @@ Rotary3d EarthRotation::rotaryMatrix(const Time &timeGPS) const
   {
     Double xp, yp, sp, deltaUT, LOD, X, Y, S;
     earthOrientationParameter(timeGPS, xp, yp, sp, deltaUT, LOD, X, Y, S);
+    return rotaryMatrixCio(timeGPS, xp, yp, sp, deltaUT, X, Y, S);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+std::vector<Rotary3d> EarthRotation::rotaryMatrix(const std::vector<Time> &timesGPS) const
+{
+  try
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutexRotations);
+      if(timesGPS == timesRotations)
+        return rotations;
+    }
 
+    std::vector<Rotary3d> rot(timesGPS.size());
+    for(UInt i=0; i<timesGPS.size(); i++)
+      rot.at(i) = rotaryMatrix(timesGPS.at(i));
+
+    std::lock_guard<std::mutex> lock(mutexRotations);
+    timesRotations = timesGPS;
+    rotations      = rot;
+    return rot;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Rotary3d EarthRotation::rotaryMatrixCio(const Time &timeGPS, Double xp, Double yp, Double sp, Double deltaUT, Double X, Double Y, Double S)
+{
+  try
+  {
     const Double ERA = Planets::ERA(timeGPS2UTC(timeGPS) + seconds2time(deltaUT));
     const Double r2  = X*X + Y*Y;
     const Double E   = (r2 != 0.) ? std::atan2(Y, X) : 0.;
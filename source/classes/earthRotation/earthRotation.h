@@ -26,6 +26,7 @@ reference frame (TRF) and a celestial reference frame (CRF).
 
 #include "base/import.h"
 #include "config/config.h"
+#include <mutex>
 
 /**
 * @defgroup earthRotationGroup EarthRotation
@@ -46,6 +47,10 @@ typedef std::shared_ptr<EarthRotation> EarthRotationPtr;
 * An Instance of this class can be created by @ref readConfig. */
 class EarthRotation
 {
+  mutable std::mutex            mutexRotations;
+  mutable std::vector<Time>     timesRotations; // last requested arc
+  mutable std::vector<Rotary3d> rotations;
+
 public:
   /// Destructor.
   virtual ~EarthRotation() {}
@@ -55,6 +60,13 @@ public:
   * @param timeGPS modified julian date (MJD) in GPS time system. */
   virtual Rotary3d rotaryMatrix(const Time &timeGPS) const;
 
+  /** @brief Rotary matrices for many epochs (e.g. an arc).
+  * Inertial system (CRF) -> earth fixed system (TRF).
+  * The rotations of the last requested epochs are kept,
+  * repeated requests for the same arc (e.g. several observation types or iterations) are not computed again.
+  * @param timesGPS modified julian dates (MJD) in GPS time system. */
+  std::vector<Rotary3d> rotaryMatrix(const std::vector<Time> &timesGPS) const;
+
   /** @brief Instantaneous rotation vector of Earth rotation.
   * Contains the complete rotation with precession, nutation, polar wobble.
   * Given in inertial system (CRF). [rad/s].
@@ -81,6 +93,11 @@ public:
 
   /** @brief creates an derived instance of this class. */
   static EarthRotationPtr create(Config &config, const std::string &name);
+
+protected:
+  /** @brief Rotary matrix (CRF -> TRF) from earth orientation parameters according to the CIO based transformation.
+  * @see earthOrientationParameter */
+  static Rotary3d rotaryMatrixCio(const Time &timeGPS, Double xp, Double yp, Double sp, Double deltaUT, Double X, Double Y, Double S);
 };
 
 /***** FUNCTIONS *******************************/
@@ -0,0 +1,150 @@
+/***********************************************/
+/**
+* @file earthRotationInterpolated.cpp
+*
+* @brief Interpolated values of an earth rotation model.
+* @see EarthRotation
+*
+* @author GROOPS Developers
+* @date 2026-10-14
+*
+*/
+/***********************************************/
+
+#include "base/import.h"
+#include "config/config.h"
+#include "classes/earthRotation/earthRotation.h"
+#include "classes/earthRotation/earthRotationInterpolated.h"
+
+/***********************************************/
+
+EarthRotationInterpolated::EarthRotationInterpolated(Config &config)
+{
+  try
+  {
+    readConfig(config, "earthRotation",       earthRotation, Config::MUSTSET, "",      "precise model");
+    readConfig(config, "sampling",            sampling,      Config::DEFAULT, "3600",  "[seconds] of the interpolation grid");
+    readConfig(config, "interpolationDegree", degree,        Config::DEFAULT, "7",     "for polynomial interpolation");
+    readConfig(config, "maxError",            maxError,      Config::DEFAULT, "1e-10", "[rad] max. rotation error of the interpolation, sampling is refined otherwise");
+    if(isCreateSchema(config)) return;
+
+    if(sampling <= 0)
+      throw(Exception("sampling must be positive"));
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+std::shared_ptr<const EarthRotationInterpolated::Day> EarthRotationInterpolated::day(const Time &timeGPS) const
+{
+  try
+  {
+    const Int mjd = static_cast<Int>(std::floor(timeGPS.mjd()));
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      auto iter = days.find(mjd);
+      if(iter != days.end())
+        return iter->second;
+    }
+    // computed outside the lock, other threads may compute the same day simultaneously
+    auto day = computeDay(mjd);
+    std::lock_guard<std::mutex> lock(mutex);
+    return days.emplace(mjd, day).first->second;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+std::shared_ptr<const EarthRotationInterpolated::Day> EarthRotationInterpolated::computeDay(Int mjd) const
+{
+  try
+  {
+    const Time timeStart = mjd2time(mjd);
+    Double delta = sampling;
+    for(UInt iter=0; iter<=6; iter++, delta/=2)
+    {
+      auto day = std::make_shared<Day>();
+
+      // grid includes margins for interpolation at the day boundaries
+      const UInt count = static_cast<UInt>(std::ceil(86400./delta)) + 2*degree + 1;
+      std::vector<Time> times(count);
+      day->EOP = Matrix(count, 8);
+      for(UInt i=0; i<count; i++)
+      {
+        times.at(i) = timeStart + seconds2time((static_cast<Double>(i)-degree)*delta);
+        earthRotation->earthOrientationParameter(times.at(i), day->EOP(i,0), day->EOP(i,1), day->EOP(i,2), day->EOP(i,3),
+                                                 day->EOP(i,4), day->EOP(i,5), day->EOP(i,6), day->EOP(i,7));
+        // UT1-UTC => UT1-GPS (avoid leap seconds jumps for interpolation)
+        day->EOP(i,3) -= (times.at(i)-timeGPS2UTC(times.at(i))).seconds();
+      }
+      day->polynomial.init(times, degree);
+
+      // check interpolation error at midpoints within the day
+      Double error = 0;
+      for(UInt i=degree; i<count-degree-1; i++)
+      {
+        const Time time = times.at(i) + seconds2time(0.5*delta);
+        Double xp, yp, sp, deltaUT, LOD, X, Y, S;
+        interpolate(*day, time, xp, yp, sp, deltaUT, LOD, X, Y, S);
+        const Matrix R = (earthRotation->rotaryMatrix(time) * inverse(rotaryMatrixCio(time, xp, yp, sp, deltaUT, X, Y, S))).matrix();
+        error = std::max(error, 0.5*std::max(std::fabs(R(1,2)-R(2,1)), std::max(std::fabs(R(2,0)-R(0,2)), std::fabs(R(0,1)-R(1,0)))));
+      }
+      if(error <= maxError)
+        return day;
+    }
+
+    throw(Exception("interpolation error exceeds maxError at MJD "+mjd%"%i"s+" (model without CIO based earth orientation parameters?)"));
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void EarthRotationInterpolated::interpolate(const Day &day, const Time &timeGPS, Double &xp, Double &yp, Double &sp,
+                                            Double &dUT1, Double &LOD, Double &X, Double &Y, Double &S)
+{
+  try
+  {
+    Matrix eop = day.polynomial.interpolate({timeGPS}, day.EOP);
+    xp   = eop(0,0);
+    yp   = eop(0,1);
+    sp   = eop(0,2);
+    dUT1 = eop(0,3) + (timeGPS-timeGPS2UTC(timeGPS)).seconds();
+    LOD  = eop(0,4);
+    X    = eop(0,5);
+    Y    = eop(0,6);
+    S    = eop(0,7);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void EarthRotationInterpolated::earthOrientationParameter(const Time &timeGPS, Double &xp, Double &yp, Double &sp,
+                                                          Double &dUT1, Double &LOD, Double &X, Double &Y, Double &S) const
+{
+  try
+  {
+    interpolate(*day(timeGPS), timeGPS, xp, yp, sp, dUT1, LOD, X, Y, S);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
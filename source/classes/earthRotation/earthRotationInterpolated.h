@@ -0,0 +1,76 @@
+/***********************************************/
+/**
+* @file earthRotationInterpolated.h
+*
+* @brief Interpolated values of an earth rotation model.
+* @see EarthRotation
+*
+* @author GROOPS Developers
+* @date 2026-10-14
+*
+*/
+/***********************************************/
+
+#ifndef __GROOPS_EARTHROTATIONINTERPOLATED__
+#define __GROOPS_EARTHROTATIONINTERPOLATED__
+
+// Latex documentation
+#ifdef DOCSTRING_EarthRotation
+static const char *docstringEarthRotationInterpolated = R"(
+\subsection{Interpolated}\label{earthRotationType:interpolated}
+The earth orientation parameters of \configClass{earthRotation}{earthRotationType}
+are evaluated on a grid with \config{sampling} and interpolated by a polynomial
+of \config{interpolationDegree} in between. The grid is computed day by day in memory
+when the first time of a day is requested. This is much faster than the evaluation
+of the nutation series with thousands of terms at every epoch and avoids the preparation
+of a file with \program{EarthOrientationParameterTimeSeries} for \configClass{file}{earthRotationType:file}.
+
+For each day the interpolated rotation is checked at the midpoints of the grid
+against the rotation of the precise model. If the difference exceeds \config{maxError}
+the sampling of this day is halved (up to 6 times) until the error bound is met.
+Only models with earth orientation parameters according to the CIO based transformation
+(e.g. \configClass{iers2010}{earthRotationType:iers2010}) can be interpolated.
+)";
+#endif
+
+/***********************************************/
+
+#include "base/polynomial.h"
+#include "classes/earthRotation/earthRotation.h"
+#include <mutex>
+
+/***** CLASS ***********************************/
+
+/** @brief Interpolated values of an earth rotation model.
+* @ingroup earthRotationGroup
+* @see EarthRotation */
+class EarthRotationInterpolated : public EarthRotation
+{
+  class Day
+  {
+  public:
+    Polynomial polynomial;
+    Matrix     EOP; // xp, yp, sp, UT1-GPS, LOD, X, Y, S
+  };
+
+  EarthRotationPtr earthRotation;
+  Double           sampling;
+  UInt             degree;
+  Double           maxError;
+
+  mutable std::mutex mutex;
+  mutable std::map<Int, std::shared_ptr<const Day>> days;
+
+  std::shared_ptr<const Day> day(const Time &timeGPS) const;
+  std::shared_ptr<const Day> computeDay(Int mjd) const;
+  static void interpolate(const Day &day, const Time &timeGPS, Double &xp, Double &yp, Double &sp, Double &deltaUT, Double &LOD, Double &X, Double &Y, Double &S);
+
+public:
+  EarthRotationInterpolated(Config &config);
+
+  void earthOrientationParameter(const Time &timeGPS, Double &xp, Double &yp, Double &sp, Double &deltaUT, Double &LOD, Double &X, Double &Y, Double &S) const;
+};
+
+/***********************************************/
+
+#endif /* __GROOPS_EARTHROTATIONINTERPOLATED__ */
@@ -52,6 +52,94 @@ EclipsePtr Eclipse::create(Config &config, const std::string &name)
 
 /***********************************************/
 
+Vector Eclipse::factors(const std::vector<Time> &timesGPS, const std::vector<Vector3d> &positions, EphemeridesPtr ephemerides) const
+{
+  try
+  {
+    if(!ephemerides)
+      throw(Exception("No ephemerides given"));
+    if(timesGPS.size() != positions.size())
+      throw(Exception("size of times and positions differ"));
+
+    Vector f(timesGPS.size(), 1.);
+    if(!timesGPS.size())
+      return f;
+
+    // Sun and Moon on a coarse time grid (linear interpolation error below 1 km)
+    // --------------------------------------------------------------------------
+    const Double sampling = 600.; // seconds
+    const Time   timeStart = timesGPS.front();
+    std::vector<Vector3d> posSun, posMoon;
+    std::vector<Bool>     isNode;
+    auto node = [&](UInt k)
+    {
+      if(k >= isNode.size())
+      {
+        isNode.resize(k+1, FALSE);
+        posSun.resize(k+1);
+        posMoon.resize(k+1);
+      }
+      if(!isNode.at(k))
+      {
+        const Time time = timeStart + seconds2time(k*sampling);
+        posSun.at(k)  = ephemerides->position(time, Ephemerides::SUN);
+        posMoon.at(k) = ephemerides->position(time, Ephemerides::MOON);
+        isNode.at(k)  = TRUE;
+      }
+    };
+
+    // conservative test for full sun light: apparent separation c larger than the sum of the apparent radii a+b (see shadowScalingFactor)
+    // the Earth radius includes the atmosphere (SOLAARS) and the margin covers the interpolation error
+    // c > a+b+margin is tested with cosines to avoid trigonometric functions
+    const Double margin = 1e-4; // [rad]
+    const Double cosMargin = std::cos(margin);
+    const Double sinMargin = std::sin(margin);
+    auto isSunLit = [&](const Vector3d &posSat, const Vector3d &posSun, const Vector3d &posBody, Double radiusBody)
+    {
+      const Double R_Sun       = 6.96342e8;
+      const Double distSatSun  = (posSat-posSun).r();
+      const Double distSatBody = (posSat-posBody).r();
+      if(distSatBody <= radiusBody)
+        return FALSE;
+      const Double sinA = R_Sun/distSatSun;
+      const Double sinB = radiusBody/distSatBody;
+      const Double cosA = std::sqrt(1-sinA*sinA);
+      const Double cosB = std::sqrt(1-sinB*sinB);
+      const Double cosAB = cosA*cosB - sinA*sinB;
+      const Double sinAB = sinA*cosB + cosA*sinB;
+      if(cosAB*cosMargin - sinAB*sinMargin <= -1) // a+b+margin >= PI
+        return FALSE;
+      const Double cosC = inner(posBody-posSat, posSun-posSat)/(distSatBody*distSatSun);
+      return (cosC < cosAB*cosMargin - sinAB*sinMargin);
+    };
+
+    for(UInt i=0; i<timesGPS.size(); i++)
+    {
+      const Double t = (timesGPS.at(i)-timeStart).seconds()/sampling;
+      if(t >= 0)
+      {
+        const UInt   k = static_cast<UInt>(std::floor(t));
+        const Double w = t-k;
+        node(k);
+        node(k+1);
+        const Vector3d sun  = (1-w) * posSun.at(k)  + w * posSun.at(k+1);
+        const Vector3d moon = (1-w) * posMoon.at(k) + w * posMoon.at(k+1);
+        if(isSunLit(positions.at(i), sun, Vector3d(), R_Earth+200e3) && isSunLit(positions.at(i), sun, moon, R_Moon))
+          continue;
+      }
+      f(i) = factor(timesGPS.at(i), positions.at(i), ephemerides);
+    }
+
+    return f;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 // For detailed information on this calculation, see Montenbruck and Gill (2000, pp. 80-83)
 Double Eclipse::shadowScalingFactor(const Vector3d &posSat, const Vector3d &posSun, const Vector3d &posBody, const Double &radiusBody)
 {
@@ -58,6 +58,16 @@ public:
   * @return Scaling factor [0..1] (0 = full shadow, 1 = no shadow, between 0 and 1 = partial shadow) */
   virtual Double factor(const Time &timeGPS, const Vector3d &position, EphemeridesPtr ephemerides) const = 0;
 
+  /** @brief Scaling factors along an orbit arc.
+  * Most epochs are in full sun light. These are detected with Sun and Moon positions
+  * interpolated from a coarse time grid and are set to 1 without evaluating the model.
+  * Only the epochs near a shadow are computed with factor(), so the result is the same.
+  * @param timesGPS  Epochs in GPS time system (increasing).
+  * @param positions Positions of the satellite in celestial frame (CRF).
+  * @param ephemerides Position of Sun and Moon.
+  * @return Scaling factor for each epoch. */
+  Vector factors(const std::vector<Time> &timesGPS, const std::vector<Vector3d> &positions, EphemeridesPtr ephemerides) const;
+
   /** @brief creates an derived instance of this class. */
   static EclipsePtr create(Config &config, const std::string &name);
 
@@ -47,6 +47,23 @@ EphemeridesPtr Ephemerides::create(Config &config, const std::string &name)
   }
 }
 
+/***********************************************/
+
+std::vector<Vector3d> Ephemerides::positions(const std::vector<Time> &timesGPS, Planet planet)
+{
+  try
+  {
+    std::vector<Vector3d> pos(timesGPS.size());
+    for(UInt i=0; i<timesGPS.size(); i++)
+      pos.at(i) = position(timesGPS.at(i), planet);
+    return pos;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
 /***********************************************/
 /***** CLASS ***********************************/
 /***********************************************/
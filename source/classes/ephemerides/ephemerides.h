@@ -79,6 +79,10 @@ public:
   /** @brief Position and velocity of a planet in celestial reference system (CRF).  */
   virtual void ephemeris(const Time &timeGPS, Planet planet, Vector3d &position, Vector3d &velocity) = 0;
 
+  /** @brief Positions of a planet at many epochs in celestial reference system (CRF).
+  * Faster than repeated calls of @ref position for (sorted) time series. */
+  virtual std::vector<Vector3d> positions(const std::vector<Time> &timesGPS, Planet planet);
+
   virtual Planet origin() const = 0;
 
   /** @brief creates an derived instance of this class. */
@@ -18,6 +18,9 @@
 static const char *docstringEphemeridesJpl = R"(
 \section{JPL}\label{ephemeridesType:jpl}
 Using \verb|DExxx| ephemerides from NASA Jet Propulsion Laboratory (JPL).
+The results of the last epochs are cached, so that the many models
+(e.g. tides, solar radiation pressure, albedo, eclipse) requesting
+Sun and Moon at the same epoch share one evaluation.
 )";
 #endif
 
@@ -36,6 +39,19 @@ class EphemeridesJpl : public Ephemerides
   InFileEphemerides file;
   Planet origin_;
 
+  // results of the last requests
+  class Entry
+  {
+  public:
+    Time     time;
+    Planet   planet;
+    Vector3d position, velocity;
+  };
+  std::vector<Entry> cache;
+  UInt               cacheNext;
+
+  const Entry &evaluate(const Time &timeGPS, Planet planet);
+
 public:
   EphemeridesJpl(Config &config);
 
@@ -46,7 +62,7 @@ public:
 
 /***********************************************/
 
-inline EphemeridesJpl::EphemeridesJpl(Config &config)
+inline EphemeridesJpl::EphemeridesJpl(Config &config) : cache(8, Entry{Time(), static_cast<Planet>(0), Vector3d(), Vector3d()}), cacheNext(0)
 {
   try
   {
@@ -66,13 +82,34 @@ inline EphemeridesJpl::EphemeridesJpl(Config &config)
 
 /***********************************************/
 
-inline Vector3d EphemeridesJpl::position(const Time &timeGPS, Planet planet)
+inline const EphemeridesJpl::Entry &EphemeridesJpl::evaluate(const Time &timeGPS, Planet planet)
 {
   try
   {
+    for(const Entry &entry : cache)
+      if((entry.planet == planet) && (entry.time == timeGPS))
+        return entry;
+
     Vector3d position, velocity;
     file.ephemeris(timeGPS, static_cast<InFileEphemerides::Planet>(planet), static_cast<InFileEphemerides::Planet>(origin_), position, velocity);
-    return position;
+    Entry &entry = cache.at(cacheNext);
+    cacheNext = (cacheNext+1) % cache.size();
+    entry = Entry{timeGPS, planet, position, velocity};
+    return entry;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+inline Vector3d EphemeridesJpl::position(const Time &timeGPS, Planet planet)
+{
+  try
+  {
+    return evaluate(timeGPS, planet).position;
   }
   catch(std::exception &e)
   {
@@ -86,7 +123,9 @@ inline void EphemeridesJpl::ephemeris(const Time &timeGPS, Planet planet, Vector
 {
   try
   {
-    file.ephemeris(timeGPS, static_cast<InFileEphemerides::Planet>(planet), static_cast<InFileEphemerides::Planet>(origin_), position, velocity);
+    const Entry &entry = evaluate(timeGPS, planet);
+    position = entry.position;
+    velocity = entry.velocity;
   }
   catch(std::exception &e)
   {
@@ -60,3 +60,39 @@ Vector3d Forces::acceleration(SatelliteModelPtr satellite, const Time &time, con
 }
 
 /***********************************************/
+
+std::vector<Vector3d> Forces::acceleration(const std::vector<SatelliteModelPtr> &satellite, const Time &time,
+                                           const std::vector<Vector3d> &position, const std::vector<Vector3d> &velocity, const std::vector<Rotary3d> &rotSat,
+                                           const Rotary3d &rotEarth, EarthRotationPtr rotation, EphemeridesPtr ephemerides) const
+{
+  try
+  {
+    std::vector<Vector3d> posEarth(position.size());
+    for(UInt i=0; i<position.size(); i++)
+      posEarth.at(i) = rotEarth.rotate(position.at(i));
+
+    std::vector<Vector3d> g(position.size());
+    if(gravityfield)
+    {
+      const std::vector<Vector3d> gGravity = gravityfield->gravity(time, posEarth);
+      for(UInt i=0; i<g.size(); i++)
+        g.at(i) += gGravity.at(i);
+    }
+    if(tides)
+    {
+      const std::vector<Vector3d> gTides = tides->acceleration(time, posEarth, rotEarth, rotation, ephemerides);
+      for(UInt i=0; i<g.size(); i++)
+        g.at(i) += gTides.at(i);
+    }
+    if(miscAccelerations)
+      for(UInt i=0; i<g.size(); i++)
+        g.at(i) += miscAccelerations->acceleration(satellite.at(i), time, position.at(i), velocity.at(i), rotSat.at(i), rotEarth, ephemerides);
+    return g;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
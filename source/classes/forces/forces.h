@@ -69,6 +69,22 @@ public:
   Vector3d acceleration(SatelliteModelPtr satellite, const Time &time, const Vector3d &position, const Vector3d &velocity,
                         const Rotary3d &rotSat, const Rotary3d &rotEarth, EarthRotationPtr rotation, EphemeridesPtr ephemerides) const;
 
+  /** @brief Compute full acceleration of several satellites at the same epoch in TRF.
+  * Time dependent quantities (e.g. tide arguments, spherical harmonics coefficients, positions of sun and moon)
+  * are computed only once for all satellites.
+  * @param satellite model for misc accelerations (for each satellite)
+  * @param time Time.
+  * @param position in CRF [m] (for each satellite).
+  * @param velocity in CRF [m/s] (for each satellite).
+  * @param rotSat   Sat -> CRF (for each satellite)
+  * @param rotEarth CRF -> TRF
+  * @param rotation need for computation of polar motion.
+  * @param ephemerides Position of Sun and Moon.
+  * @return acceleration in TRF(!) [m/s^2] for each satellite */
+  std::vector<Vector3d> acceleration(const std::vector<SatelliteModelPtr> &satellite, const Time &time,
+                                     const std::vector<Vector3d> &position, const std::vector<Vector3d> &velocity, const std::vector<Rotary3d> &rotSat,
+                                     const Rotary3d &rotEarth, EarthRotationPtr rotation, EphemeridesPtr ephemerides) const;
+
   /** @brief creates an derived instance of this class. */
   static ForcesPtr create(Config &config, const std::string &name) {return ForcesPtr(new Forces(config, name));}
 
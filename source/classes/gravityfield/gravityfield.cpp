@@ -95,6 +95,13 @@ Gravityfield::Gravityfield(Config &config, const std::string &name)
       if(isCreateSchema(config))
         return;
     };
+
+    // combine components given as spherical harmonics (only useful for more than one)
+    isCombined.resize(gravityfield.size(), FALSE);
+    for(UInt i=0; i<gravityfield.size(); i++)
+      isCombined.at(i) = gravityfield.at(i)->isSphericalHarmonics();
+    if(std::count(isCombined.begin(), isCombined.end(), TRUE) < 2)
+      std::fill(isCombined.begin(), isCombined.end(), FALSE);
   }
   catch(std::exception &e)
   {
@@ -116,7 +123,10 @@ Double Gravityfield::potential(const Time &time, const Vector3d &point) const
 {
   Double sum = 0.0;
   for(UInt i=0; i<gravityfield.size(); i++)
-    sum += gravityfield.at(i)->potential(time, point);
+    if(!isCombined.at(i))
+      sum += gravityfield.at(i)->potential(time, point);
+  if(std::count(isCombined.begin(), isCombined.end(), TRUE))
+    sum += combinedHarmonics(time)->potential(point);
   return sum;
 }
 
@@ -126,7 +136,10 @@ Double Gravityfield::radialGradient(const Time &time, const Vector3d &point) con
 {
   Double sum = 0.0;
   for(UInt i=0; i<gravityfield.size(); i++)
-    sum += gravityfield.at(i)->radialGradient(time, point);
+    if(!isCombined.at(i))
+      sum += gravityfield.at(i)->radialGradient(time, point);
+  if(std::count(isCombined.begin(), isCombined.end(), TRUE))
+    sum += combinedHarmonics(time)->radialGradient(point);
   return sum;
 }
 
@@ -146,7 +159,27 @@ Vector3d Gravityfield::gravity(const Time &time, const Vector3d &point) const
 {
   Vector3d sum;
   for(UInt i=0; i<gravityfield.size(); i++)
-    sum += gravityfield.at(i)->gravity(time, point);
+    if(!isCombined.at(i))
+      sum += gravityfield.at(i)->gravity(time, point);
+  if(std::count(isCombined.begin(), isCombined.end(), TRUE))
+    sum += combinedHarmonics(time)->gravity(point);
+  return sum;
+}
+
+/***********************************************/
+
+std::vector<Vector3d> Gravityfield::gravity(const Time &time, const std::vector<Vector3d> &point) const
+{
+  std::vector<Vector3d> sum(point.size());
+  for(UInt i=0; i<gravityfield.size(); i++)
+    if(!isCombined.at(i))
+      gravityfield.at(i)->gravity(time, point, sum);
+  if(std::count(isCombined.begin(), isCombined.end(), TRUE))
+  {
+    auto harm = combinedHarmonics(time);
+    for(UInt k=0; k<point.size(); k++)
+      sum.at(k) += harm->gravity(point.at(k));
+  }
   return sum;
 }
 
@@ -156,7 +189,10 @@ Tensor3d Gravityfield::gravityGradient(const Time &time, const Vector3d &point)
 {
   Tensor3d sum;
   for(UInt i=0; i<gravityfield.size(); i++)
-    sum += gravityfield.at(i)->gravityGradient(time, point);
+    if(!isCombined.at(i))
+      sum += gravityfield.at(i)->gravityGradient(time, point);
+  if(std::count(isCombined.begin(), isCombined.end(), TRUE))
+    sum += combinedHarmonics(time)->gravityGradient(point);
   return sum;
 }
 
@@ -199,6 +235,53 @@ SphericalHarmonics Gravityfield::sphericalHarmonics(const Time &time, UInt maxDe
 
 /***********************************************/
 
+Bool Gravityfield::isSphericalHarmonics() const
+{
+  for(UInt i=0; i<gravityfield.size(); i++)
+    if(!gravityfield.at(i)->isSphericalHarmonics())
+      return FALSE;
+  return TRUE;
+}
+
+/***********************************************/
+
+std::shared_ptr<const SphericalHarmonics> Gravityfield::combinedHarmonics(const Time &time) const
+{
+  try
+  {
+    const UInt cacheSize = 4;
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    for(auto iter=cache.begin(); iter!=cache.end(); iter++)
+      if(iter->first == time)
+      {
+        cache.splice(cache.begin(), cache, iter);
+        return cache.front().second;
+      }
+
+    auto harm  = std::make_shared<SphericalHarmonics>();
+    Bool first = TRUE;
+    for(UInt i=0; i<gravityfield.size(); i++)
+      if(isCombined.at(i))
+      {
+        if(first)
+          *harm = gravityfield.at(i)->sphericalHarmonics(time);
+        else
+          *harm += gravityfield.at(i)->sphericalHarmonics(time);
+        first = FALSE;
+      }
+    cache.emplace_front(time, harm);
+    if(cache.size() > cacheSize)
+      cache.pop_back();
+    return harm;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 Matrix Gravityfield::sphericalHarmonicsCovariance(const Time &time, UInt maxDegree, UInt minDegree, Double GM, Double R) const
 {
   try
@@ -399,6 +482,15 @@ Matrix GravityfieldBase::sphericalHarmonicsCovariance(const Time &time, UInt max
 
 /***********************************************/
 
+// Default implementation
+void GravityfieldBase::gravity(const Time &time, const std::vector<Vector3d> &point, std::vector<Vector3d> &g) const
+{
+  for(UInt i=0; i<point.size(); i++)
+    g.at(i) += gravity(time, point.at(i));
+}
+
+/***********************************************/
+
 // Default implementation
 Double GravityfieldBase::variance(const Time &time, const Vector3d &point, const Kernel &kernel) const
 {
@@ -37,6 +37,7 @@ The variance of the result (sum) is computed by means of variance propagation.
 #include "base/sphericalHarmonics.h"
 #include "config/config.h"
 #include "classes/kernel/kernel.h"
+#include <mutex>
 
 /**
 * @defgroup gravityfieldGroup GravityField
@@ -94,6 +95,13 @@ public:
   * @return Result is given in an Earth fixed system [m/s^2]. */
   Vector3d gravity(const Time &time, const Vector3d &point) const;
 
+  /** @brief Gravity vector at many points at the same time.
+  * Time dependent quantities (e.g. interpolated coefficients) are computed only once.
+  * @param time If time==Time(), only the static part will be computed.
+  * @param point computation points in an Earth fixed reference system [m].
+  * @return Result is given in an Earth fixed system [m/s^2]. */
+  std::vector<Vector3d> gravity(const Time &time, const std::vector<Vector3d> &point) const;
+
   /** @brief Gravity gradient.
   * @f$ \nabla\nabla V @f$
   * @param time If time==Time(), only the static part will be computed.
@@ -141,12 +149,22 @@ public:
   /** @brief Covariance between gravity field functional at two different points. */
   Double covariance(const Time &time, const Vector3d &point1, const Vector3d &point2, const Kernel &kernel) const;
 
+  /** @brief Can the gravity field be represented exactly by @a sphericalHarmonics?
+  * E.g. topographic masses or tides with direct effects cannot. */
+  Bool isSphericalHarmonics() const;
+
   /** @brief creates an derived instance of this class. */
   static GravityfieldPtr create(Config &config, const std::string &name) {return GravityfieldPtr(new Gravityfield(config, name));}
 
 private:
   std::vector<GravityfieldBase*> gravityfield;
 
+  // components given as spherical harmonics are summed up per epoch and evaluated with one synthesis
+  std::vector<Bool> isCombined;
+  mutable std::mutex cacheMutex;
+  mutable std::list<std::pair<Time, std::shared_ptr<const SphericalHarmonics>>> cache; // last used epochs first
+  std::shared_ptr<const SphericalHarmonics> combinedHarmonics(const Time &time) const;
+
   void variance(const Time &/*time*/, const std::vector<Vector3d> &/*point*/, const Kernel &/*kernel*/, Matrix &/*D*/) const {}
 };
 
@@ -178,6 +196,7 @@ virtual Double   field          (const Time &time, const Vector3d &point, const
 virtual Double   potential      (const Time &time, const Vector3d &point) const = 0;
 virtual Double   radialGradient (const Time &time, const Vector3d &point) const = 0;
 virtual Vector3d gravity        (const Time &time, const Vector3d &point) const = 0;
+virtual void     gravity        (const Time &time, const std::vector<Vector3d> &point, std::vector<Vector3d> &g) const;
 virtual Tensor3d gravityGradient(const Time &time, const Vector3d &point) const = 0;
 virtual Vector3d deformation    (const Time &time, const Vector3d &point, Double gravity, const Vector &hn, const Vector &ln) const = 0;
 virtual void     deformation    (const std::vector<Time> &time, const std::vector<Vector3d> &point, const std::vector<Double> &gravity,
@@ -190,6 +209,7 @@ virtual SphericalHarmonics sphericalHarmonics(const Time &time, UInt maxDegree=I
 virtual Matrix   sphericalHarmonicsCovariance(const Time &time, UInt maxDegree=INFINITYDEGREE, UInt minDegree=0, Double GM=0.0, Double R=0.0) const;
 
 virtual void   variance  (const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Matrix &D) const=0;
+virtual Bool   isSphericalHarmonics() const {return FALSE;} // exactly represented by sphericalHarmonics()?
 virtual Double variance  (const Time &time, const Vector3d &point, const Kernel &kernel) const;
 virtual Double covariance(const Time &time, const Vector3d &point1, const Vector3d &point2, const Kernel &kernel) const;
 };
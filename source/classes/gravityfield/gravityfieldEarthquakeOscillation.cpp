@@ -37,6 +37,17 @@ GravityfieldEarthquakeOscillation::GravityfieldEarthquakeOscillation(Config &con
 
     Matrix mx;
     readFileMatrix(xName, mx);
+    for(UInt i=0; i<mx.rows(); i++)
+    {
+      if((mx(i,1) > maxDegree) || (mx(i,2) > mx(i,1)))
+        continue;
+      degree.push_back(static_cast<UInt>(mx(i,1)));
+      order.push_back(static_cast<UInt>(mx(i,2)));
+      cnm0.push_back(mx(i,3));
+      snm0.push_back(mx(i,4));
+      period.push_back(mx(i,5));
+      attenuation.push_back(mx(i,6));
+    }
   }
   catch(std::exception &e)
   {
@@ -56,10 +67,12 @@ SphericalHarmonics GravityfieldEarthquakeOscillation::timeVariableCoefficients(c
 
     Matrix cnm(maxDegree+1, Matrix::TRIANGULAR, Matrix::LOWER);
     Matrix snm(maxDegree+1, Matrix::TRIANGULAR, Matrix::LOWER);
-    for(UInt i=0; i<mx.rows(); i++)
+    for(UInt i=0; i<degree.size(); i++)
     {
-      cnm(mx(i,1), mx(i,2)) += mx(i,3) * (1-cos(c/mx(i,5)) * exp(-c/mx(i,5)/mx(i,6)/2));
-      snm(mx(i,1), mx(i,2)) += mx(i,4) * (1-cos(c/mx(i,5)) * exp(-c/mx(i,5)/mx(i,6)/2));
+      const Double wt     = c/period.at(i);
+      const Double factor = 1-cos(wt) * exp(-wt/attenuation.at(i)/2);
+      cnm(degree.at(i), order.at(i)) += cnm0.at(i) * factor;
+      snm(degree.at(i), order.at(i)) += snm0.at(i) * factor;
     }
 
     return SphericalHarmonics(GM, R, cnm, snm);
@@ -118,8 +131,11 @@ void GravityfieldEarthquakeOscillation::deformation(const std::vector<Time> &tim
                                                     const Vector &hn, const Vector &ln, std::vector< std::vector<Vector3d> > &disp) const
 {
   for(UInt i=0; i<time.size(); i++)
+  {
+    const SphericalHarmonics harmonics = timeVariableCoefficients(time.at(i));
     for(UInt k=0; k<point.size(); k++)
-      disp.at(k).at(i) += deformation(time.at(i), point.at(k), gravity.at(k), hn, ln);
+      disp.at(k).at(i) += harmonics.deformation(point.at(k), gravity.at(k), hn, ln);
+  }
 }
 
 /***********************************************/
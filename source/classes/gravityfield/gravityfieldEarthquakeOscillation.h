@@ -42,7 +42,8 @@ period record of superconducting gravimeter measurements after the earthquakes.
 * @see Gravityfield */
 class GravityfieldEarthquakeOscillation : public GravityfieldBase
 {
-  Matrix   mx;
+  std::vector<UInt>   degree, order;
+  std::vector<Double> cnm0, snm0, period, attenuation; // one oscillation mode per entry
   Time     time0;
   UInt     minDegree, maxDegree;
   Double   GM, R;
@@ -61,6 +62,7 @@ public:
                            const Vector &hn, const Vector &ln, std::vector< std::vector<Vector3d> > &disp) const;
 
   SphericalHarmonics sphericalHarmonics(const Time &time, UInt maxDegree, UInt minDegree, Double GM, Double R) const;
+  Bool isSphericalHarmonics() const {return TRUE;}
 
   void variance(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Matrix &D) const;
 };
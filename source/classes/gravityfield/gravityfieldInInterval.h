@@ -54,6 +54,7 @@ public:
   void     deformation    (const std::vector<Time> &time, const std::vector<Vector3d> &point, const std::vector<Double> &gravity,
                            const Vector &hn, const Vector &ln, std::vector< std::vector<Vector3d> > &disp) const;
   SphericalHarmonics sphericalHarmonics(const Time &time, UInt maxDegree, UInt minDegree, Double GM, Double R) const;
+  Bool isSphericalHarmonics() const {return gravityfield->isSphericalHarmonics();}
   void variance(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Matrix &D) const;
 };
 
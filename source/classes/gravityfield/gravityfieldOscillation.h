@@ -56,6 +56,7 @@ public:
                            const Vector &hn, const Vector &ln, std::vector< std::vector<Vector3d> > &disp) const;
 
   SphericalHarmonics sphericalHarmonics(const Time &time, UInt maxDegree, UInt minDegree, Double GM, Double R) const;
+  Bool isSphericalHarmonics() const {return gravityfieldCos->isSphericalHarmonics() && gravityfieldSin->isSphericalHarmonics();}
 
   void variance(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Matrix &D) const;
 };
@@ -61,6 +61,7 @@ public:
                            const Vector &hn, const Vector &ln, std::vector< std::vector<Vector3d> > &disp) const;
 
   SphericalHarmonics sphericalHarmonics(const Time &time, UInt maxDegree=INFINITYDEGREE, UInt minDegree=0, Double GM=0.0, Double R=0.0) const;
+  Bool isSphericalHarmonics() const {return TRUE;}
 
   void   variance(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Matrix &D) const;
   Double variance(const Time &time, const Vector3d &point, const Kernel &kernel) const;
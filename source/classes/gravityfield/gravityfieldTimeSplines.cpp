@@ -78,6 +78,15 @@ Vector3d GravityfieldTimeSplines::gravity(const Time &time, const Vector3d &poin
 
 /***********************************************/
 
+void GravityfieldTimeSplines::gravity(const Time &time, const std::vector<Vector3d> &point, std::vector<Vector3d> &g) const
+{
+  const SphericalHarmonics harm = splinesFile.sphericalHarmonics(time, factor);
+  for(UInt i=0; i<point.size(); i++)
+    g.at(i) += harm.gravity(point.at(i));
+}
+
+/***********************************************/
+
 Tensor3d GravityfieldTimeSplines::gravityGradient(const Time &time, const Vector3d &point) const
 {
   return splinesFile.sphericalHarmonics(time, factor).gravityGradient(point);
@@ -98,6 +107,54 @@ void GravityfieldTimeSplines::deformation(const std::vector<Time> &time, const s
   if((time.size()==0) || (point.size()==0))
     return;
 
+  // spline nodes and weights at each epoch
+  std::vector<UInt>   first(time.size());
+  std::vector<Vector> weights(time.size());
+  std::set<UInt> nodes;
+  for(UInt i=0; i<time.size(); i++)
+  {
+    first.at(i) = splinesFile.nodeWeights(time.at(i), weights.at(i));
+    if(first.at(i) != NULLINDEX)
+      for(UInt k=0; k<weights.at(i).rows(); k++)
+        nodes.insert(first.at(i)+k);
+  }
+
+  // less nodes than epochs: deformation of each node is computed once and combined with the spline weights
+  if(nodes.size() < time.size())
+  {
+    Matrix A;
+    std::map<UInt, Vector> x; // displacements of nodes in the current window
+    for(UInt i=0; i<time.size(); i++)
+    {
+      if(first.at(i) == NULLINDEX)
+      {
+        splinesFile.sphericalHarmonics(time.at(i)); // warning
+        continue;
+      }
+      x.erase(x.begin(), x.lower_bound(first.at(i))); // nodes no longer needed
+      for(UInt k=0; k<weights.at(i).rows(); k++)
+      {
+        auto iter = x.find(first.at(i)+k);
+        if(iter == x.end())
+        {
+          const SphericalHarmonics &harm = splinesFile.node(first.at(i)+k);
+          const Vector anm = harm.x();
+          if(A.columns() < anm.rows())
+            A = deformationMatrix(point, gravity, hn, ln, harm.GM(), harm.R(), harm.maxDegree());
+          iter = x.emplace(first.at(i)+k, A.column(0, anm.rows())*anm).first;
+        }
+        const Double w = factor * weights.at(i)(k);
+        for(UInt p=0; p<point.size(); p++)
+        {
+          disp.at(p).at(i).x() += w * iter->second(3*p+0);
+          disp.at(p).at(i).y() += w * iter->second(3*p+1);
+          disp.at(p).at(i).z() += w * iter->second(3*p+2);
+        }
+      }
+    }
+    return;
+  }
+
   Matrix A;
   for(UInt i=0; i<time.size(); i++)
   {
@@ -58,6 +58,7 @@ public:
   Double   radialGradient (const Time &time, const Vector3d &point) const;
   Double   field          (const Time &time, const Vector3d &point, const Kernel &kernel) const;
   Vector3d gravity        (const Time &time, const Vector3d &point) const;
+  void     gravity        (const Time &time, const std::vector<Vector3d> &point, std::vector<Vector3d> &g) const;
   Tensor3d gravityGradient(const Time &time, const Vector3d &point) const;
   Vector3d deformation    (const Time &time, const Vector3d &point, Double gravity, const Vector &hn, const Vector &ln) const;
   void     deformation    (const std::vector<Time> &time, const std::vector<Vector3d> &point, const std::vector<Double> &gravity,
@@ -65,6 +66,7 @@ public:
 
   // Umrechnung der Parameter in Potentialkoeffizienten
   SphericalHarmonics sphericalHarmonics(const Time &time, UInt maxDegree=INFINITYDEGREE, UInt minDegree=0, Double GM=0.0, Double R=0.0) const;
+  Bool isSphericalHarmonics() const {return TRUE;}
   Matrix sphericalHarmonicsCovariance  (const Time &time, UInt maxDegree=INFINITYDEGREE, UInt minDegree=0, Double GM=0.0, Double R=0.0) const;
 
   void variance(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Matrix &D) const;
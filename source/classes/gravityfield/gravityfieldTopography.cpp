@@ -16,6 +16,7 @@
 #include "parser/expressionParser.h"
 #include "parser/dataVariables.h"
 #include "parallel/parallel.h"
+#include "parallel/threadPool.h"
 #include "config/config.h"
 #include "inputOutput/logging.h"
 #include "files/fileGriddedData.h"
@@ -32,7 +33,7 @@ GravityfieldTopography::GravityfieldTopography(Config &config)
   {
     FileName gridName;
     ExpressionVariablePtr expressionUpper, expressionLower, expressionRho;
-    cosPsiMax = 1e99;
+    cosPsiMax = cosPsiAggregation = 1e99;
 
     readConfig(config, "inputfileGridRectangular", gridName,        Config::MUSTSET,  "",      "Digital Terrain Model");
     readConfig(config, "density",                  expressionRho,   Config::DEFAULT,  "2670",  "expression [kg/m**3]");
@@ -42,6 +43,8 @@ GravityfieldTopography::GravityfieldTopography(Config &config)
     readConfig(config, "distancePrism",            cosPsiPrism,     Config::DEFAULT,  "15",    "[km] max. distance for prism formular");
     readConfig(config, "distanceLine",             cosPsiLine,      Config::DEFAULT,  "100",   "[km] max. distance for radial integration");
     readConfig(config, "distanceMax",              cosPsiMax,       Config::OPTIONAL, "",      "[km] max. influence distance (ignore far zone)");
+    readConfig(config, "distanceAggregation",      cosPsiAggregation, Config::OPTIONAL, "",    "[km] blocks of cells beyond this distance are aggregated to point masses");
+    readConfig(config, "aggregationCells",         blockSize,       Config::DEFAULT,  "8",     "number of grid rows/columns aggregated to one block");
     readConfig(config, "factor",                   factor,          Config::DEFAULT,  "1.0",   "the result is multiplied by this factor, set -1 to subtract the field");
     if(isCreateSchema(config)) return;
 
@@ -49,6 +52,7 @@ GravityfieldTopography::GravityfieldTopography(Config &config)
     cosPsiPrism /= DEFAULT_R*1e-3; if(cosPsiPrism>PI) cosPsiPrism = PI; cosPsiPrism = std::cos(cosPsiPrism);
     cosPsiLine  /= DEFAULT_R*1e-3; if(cosPsiLine >PI) cosPsiLine  = PI; cosPsiLine  = std::cos(cosPsiLine);
     cosPsiMax   /= DEFAULT_R*1e-3; if(cosPsiMax  >PI) cosPsiMax   = PI; cosPsiMax   = std::cos(cosPsiMax);
+    cosPsiAggregation /= DEFAULT_R*1e-3; if(cosPsiAggregation>PI) cosPsiAggregation = PI; cosPsiAggregation = std::min(std::cos(cosPsiAggregation), cosPsiLine);
 
     // read rectangular grid
     // ---------------------
@@ -100,6 +104,36 @@ GravityfieldTopography::GravityfieldTopography(Config &config)
       cosB(z) = std::cos(phi.at(z));
     }
 
+    // aggregate blocks of cells to point masses (far zone)
+    // ----------------------------------------------------
+    if((cosPsiAggregation <= -1.) || (blockSize <= 1))
+      blockSize = 0;
+    blockRows = blockCols = 0;
+    if(blockSize)
+    {
+      blockRows = (rows+blockSize-1)/blockSize;
+      blockCols = (cols+blockSize-1)/blockSize;
+      blockMass.resize(blockRows*blockCols, 0.);
+      blockCenter.resize(blockRows*blockCols);
+      std::vector<Double> weight(blockRows*blockCols, 0.);
+      for(UInt z=0; z<rows; z++)
+        for(UInt s=0; s<cols; s++)
+        {
+          const Double dr = rUpper(z,s)-rLower(z,s);
+          if(std::fabs(dr)<0.001)
+            continue;
+          const Double r0   = (rUpper(z,s)+rLower(z,s))/2;
+          const Double mass = rho(z,s)*r0*r0*cosB(z)*dLambda.at(s)*dPhi.at(z)*dr;
+          const UInt   idx  = (z/blockSize)*blockCols + s/blockSize;
+          blockMass.at(idx)   += mass;
+          weight.at(idx)      += std::fabs(mass);
+          blockCenter.at(idx) += (std::fabs(mass)*r0) * Vector3d(cosB(z)*cosL(s), cosB(z)*sinL(s), sinB(z));
+        }
+      for(UInt idx=0; idx<blockCenter.size(); idx++)
+        if(weight.at(idx))
+          blockCenter.at(idx) *= 1./weight.at(idx);
+    }
+
     // Restrict computation to rectangle possible?
     // -------------------------------------------
     testRectangle = FALSE;
@@ -193,6 +227,51 @@ inline void GravityfieldTopography::findRectangle(const Vector3d &point, UInt &c
 
 /***********************************************/
 
+GravityfieldTopography::FarZone GravityfieldTopography::findFarZone(const Vector3d &point, UInt colsMin, UInt rowsMin, UInt colsMax, UInt rowsMax) const
+{
+  try
+  {
+    FarZone zone;
+    zone.blockSize = blockSize;
+    zone.rowStart  = zone.colStart = zone.colCount = 0;
+    if(!blockSize || (rowsMin >= rowsMax) || (colsMin >= colsMax))
+      return zone;
+
+    zone.rowStart = rowsMin/blockSize;
+    zone.colStart = colsMin/blockSize;
+    const UInt rowEnd = (rowsMax-1)/blockSize+1;
+    const UInt colEnd = (colsMax-1)/blockSize+1;
+    zone.colCount = colEnd-zone.colStart;
+    zone.far.resize((rowEnd-zone.rowStart)*zone.colCount, FALSE);
+
+    const Double r = point.r();
+    for(UInt z=zone.rowStart; z<rowEnd; z++)
+      for(UInt s=zone.colStart; s<colEnd; s++)
+      {
+        const UInt idx = z*blockCols+s;
+        const Double rCenter = blockCenter.at(idx).r();
+        if(rCenter == 0.) // no masses in block
+        {
+          zone.far.at((z-zone.rowStart)*zone.colCount+s-zone.colStart) = TRUE;
+          continue;
+        }
+        const Double cosPsi = inner(blockCenter.at(idx), point)/(rCenter*r);
+        if((cosPsi < cosPsiAggregation) && (cosPsi >= cosPsiMax))
+        {
+          zone.far.at((z-zone.rowStart)*zone.colCount+s-zone.colStart) = TRUE;
+          zone.blocks.push_back(idx);
+        }
+      }
+    return zone;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 Double GravityfieldTopography::potential(const Time &/*time*/, const Vector3d &point) const
 {
   try
@@ -202,6 +281,7 @@ Double GravityfieldTopography::potential(const Time &/*time*/, const Vector3d &p
     // find rectangle border
     UInt colsMin, rowsMin, colsMax, rowsMax;
     findRectangle(point, colsMin, rowsMin, colsMax, rowsMax);
+    const FarZone farZone = findFarZone(point, colsMin, rowsMin, colsMax, rowsMax);
 
     Double sum = 0.0;
     for(UInt k=colsMin; k<colsMax; k++)
@@ -211,6 +291,11 @@ Double GravityfieldTopography::potential(const Time &/*time*/, const Vector3d &p
 
       for(UInt i=rowsMin; i<rowsMax; i++)
       {
+        if(farZone.isFar(i,k))
+        {
+          i = (i/blockSize+1)*blockSize-1; // skip rows of aggregated block
+          continue;
+        }
         const Double r1 = rLower(i,k);
         const Double r2 = rUpper(i,k);
         const Double dr = r2-r1;
@@ -277,6 +362,10 @@ Double GravityfieldTopography::potential(const Time &/*time*/, const Vector3d &p
       } // for(i=0..rows)
     } //for(k=0..cols)
 
+    // aggregated point masses
+    for(UInt idx : farZone.blocks)
+      sum += blockMass.at(idx)/(point-blockCenter.at(idx)).r();
+
     return factor * GRAVITATIONALCONSTANT * sum;
   }
   catch(std::exception &e)
@@ -296,6 +385,7 @@ Double GravityfieldTopography::radialGradient(const Time &/*time*/, const Vector
     // find rectangle border
     UInt colsMin, rowsMin, colsMax, rowsMax;
     findRectangle(point, colsMin, rowsMin, colsMax, rowsMax);
+    const FarZone farZone = findFarZone(point, colsMin, rowsMin, colsMax, rowsMax);
 
     Double sum = 0.0;
     for(UInt k=colsMin; k<colsMax; k++)
@@ -305,6 +395,11 @@ Double GravityfieldTopography::radialGradient(const Time &/*time*/, const Vector
 
       for(UInt i=rowsMin; i<rowsMax; i++)
       {
+        if(farZone.isFar(i,k))
+        {
+          i = (i/blockSize+1)*blockSize-1; // skip rows of aggregated block
+          continue;
+        }
         const Double r1 = rLower(i,k);
         const Double r2 = rUpper(i,k);
         const Double dr = r2-r1;
@@ -385,6 +480,14 @@ Double GravityfieldTopography::radialGradient(const Time &/*time*/, const Vector
       } // for(i=0..rows)
     } //for(k=0..cols)
 
+    // aggregated point masses
+    for(UInt idx : farZone.blocks)
+    {
+      const Vector3d d  = point-blockCenter.at(idx);
+      const Double   l0 = d.r();
+      sum -= blockMass.at(idx)*inner(point, d)/(l0*l0*l0);
+    }
+
     return factor * GRAVITATIONALCONSTANT * sum/r;
   }
   catch(std::exception &e)
@@ -404,6 +507,7 @@ Vector3d GravityfieldTopography::gravity(const Time &/*time*/, const Vector3d &p
     // find rectangle border
     UInt colsMin, rowsMin, colsMax, rowsMax;
     findRectangle(point, colsMin, rowsMin, colsMax, rowsMax);
+    const FarZone farZone = findFarZone(point, colsMin, rowsMin, colsMax, rowsMax);
 
     Vector3d sum;
     for(UInt k=colsMin; k<colsMax; k++)
@@ -414,6 +518,11 @@ Vector3d GravityfieldTopography::gravity(const Time &/*time*/, const Vector3d &p
       Vector3d sum_local;
       for(UInt i=rowsMin; i<rowsMax; i++)
       {
+        if(farZone.isFar(i,k))
+        {
+          i = (i/blockSize+1)*blockSize-1; // skip rows of aggregated block
+          continue;
+        }
         const Double r1 = rLower(i,k);
         const Double r2 = rUpper(i,k);
         const Double dr = r2-r1;
@@ -506,6 +615,14 @@ Vector3d GravityfieldTopography::gravity(const Time &/*time*/, const Vector3d &p
       sum += rotaryZ(Angle(-lambda.at(k))).rotate(sum_local);
     } //for(k=0..cols)
 
+    // aggregated point masses
+    for(UInt idx : farZone.blocks)
+    {
+      const Vector3d d  = point-blockCenter.at(idx);
+      const Double   l0 = d.r();
+      sum -= (blockMass.at(idx)/(l0*l0*l0)) * d;
+    }
+
     return factor * GRAVITATIONALCONSTANT * sum;
   }
   catch(std::exception &e)
@@ -514,6 +631,19 @@ Vector3d GravityfieldTopography::gravity(const Time &/*time*/, const Vector3d &p
   }
 }
 
+/***********************************************/
+
+void GravityfieldTopography::gravity(const Time &time, const std::vector<Vector3d> &point, std::vector<Vector3d> &g) const
+{
+  try
+  {
+    Parallel::threadLoop(0, point.size(), [&](UInt i) {g.at(i) += gravity(time, point.at(i));});
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
 
 /***********************************************/
 
@@ -41,6 +41,11 @@ can defined with \config{distancePrism}. Afterwards a simplified radial line
 a distance of \config{distanceLine}. At last the prim is approximated by a point mass
 in the center up to a distance \config{distanceMax} (if set). Prisms nearby the evaluation
 point can be excluded with \config{distanceMin}.
+
+If \config{distanceAggregation} is set, blocks of \config{aggregationCells} $\times$ \config{aggregationCells}
+grid cells with their centers beyond this distance are aggregated into a single point mass
+(located at the mass weighted center of the block). This reduces the computational costs
+of the far zone considerably for fine topography models.
 )";
 #endif
 
@@ -65,7 +70,25 @@ class GravityfieldTopography : public GravityfieldBase
   Bool                testRectangle;
   Bool                isPhiAscending, isLambdaAscending;
 
+  // far zone: blocks of cells aggregated to point masses
+  Double                cosPsiAggregation;
+  UInt                  blockSize, blockRows, blockCols;
+  std::vector<Double>   blockMass;
+  std::vector<Vector3d> blockCenter;
+
+  // aggregated blocks within the rectangle of an evaluation point
+  class FarZone
+  {
+  public:
+    UInt              rowStart, colStart, colCount, blockSize;
+    std::vector<Bool> far;
+    std::vector<UInt> blocks; // indices of aggregated blocks
+
+    Bool isFar(UInt i, UInt k) const {return far.size() && far[(i/blockSize-rowStart)*colCount+k/blockSize-colStart];}
+  };
+
   inline void findRectangle(const Vector3d &point, UInt &colsMin, UInt &rowsMin, UInt &colsMax, UInt &rowsMax) const;
+  FarZone findFarZone(const Vector3d &point, UInt colsMin, UInt rowsMin, UInt colsMax, UInt rowsMax) const;
 
 public:
   GravityfieldTopography(Config &config);
@@ -74,6 +97,7 @@ public:
   Double   potential      (const Time &time, const Vector3d &point) const;
   Double   radialGradient (const Time &time, const Vector3d &point) const;
   Vector3d gravity        (const Time &time, const Vector3d &point) const;
+  void     gravity        (const Time &time, const std::vector<Vector3d> &point, std::vector<Vector3d> &g) const;
   Tensor3d gravityGradient(const Time &time, const Vector3d &point) const;
   Vector3d deformation    (const Time &time, const Vector3d &point, Double gravity, const Vector &hn, const Vector &ln) const;
   void     deformation    (const std::vector<Time> &time, const std::vector<Vector3d> &point, const std::vector<Double> &gravity,
@@ -74,6 +74,16 @@ Vector3d GravityfieldTrend::gravity(const Time &time, const Vector3d &point) con
 
 /***********************************************/
 
+void GravityfieldTrend::gravity(const Time &time, const std::vector<Vector3d> &point, std::vector<Vector3d> &g) const
+{
+  const Double f = factor(time);
+  const std::vector<Vector3d> g0 = gravityfield->gravity(time, point);
+  for(UInt i=0; i<point.size(); i++)
+    g.at(i) += f * g0.at(i);
+}
+
+/***********************************************/
+
 Tensor3d GravityfieldTrend::gravityGradient(const Time &time, const Vector3d &point) const
 {
   return factor(time) * gravityfield->gravityGradient(time, point);
@@ -51,12 +51,14 @@ public:
   Double   radialGradient (const Time &time, const Vector3d &point) const;
   Double   field          (const Time &time, const Vector3d &point, const Kernel &kernel) const;
   Vector3d gravity        (const Time &time, const Vector3d &point) const;
+  void     gravity        (const Time &time, const std::vector<Vector3d> &point, std::vector<Vector3d> &g) const;
   Tensor3d gravityGradient(const Time &time, const Vector3d &point) const;
   Vector3d deformation    (const Time &time, const Vector3d &point, Double gravity, const Vector &hn, const Vector &ln) const;
   void     deformation    (const std::vector<Time> &time, const std::vector<Vector3d> &point, const std::vector<Double> &gravity,
                            const Vector &hn, const Vector &ln, std::vector< std::vector<Vector3d> > &disp) const;
 
   SphericalHarmonics sphericalHarmonics(const Time &time, UInt maxDegree, UInt minDegree, Double GM, Double R) const;
+  Bool isSphericalHarmonics() const {return gravityfield->isSphericalHarmonics();}
 
   void variance(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Matrix &D) const;
 };
@@ -102,11 +102,108 @@ KernelPtr Kernel::create(Config &config, const std::string &name)
 
 /***********************************************/
 
+Kernel::Kernel()
+{
+  static std::atomic<UInt> count(0);
+  id = ++count;
+}
+
+/***********************************************/
+
+// The coefficients and radial factors of the last evaluations are cached per thread.
+// Consecutive evaluations at the same computational point (e.g. a point and all nodes of a grid)
+// skip the computation of the coefficients and of the radial factors,
+// only the Clenshaw summation in cos(psi) remains per point pair.
+namespace
+{
+  class KernelCoefficientsCache
+  {
+  public:
+    UInt     id, type, degree;
+    Vector3d p;
+    Vector   kn;
+  };
+
+  class KernelFactorsCache
+  {
+  public:
+    UInt   type;
+    Double r, R;
+    Vector kn, kn2, factors;
+  };
+
+  thread_local std::array<KernelCoefficientsCache, 4> coefficientsCache;
+  thread_local std::array<KernelFactorsCache, 4>      factorsCache;
+  thread_local UInt coefficientsCacheNext = 0, factorsCacheNext = 0;
+
+  Bool isEqual(const Vector &x, const Vector &y)
+  {
+    if(x.size() != y.size())
+      return FALSE;
+    if(!x.size())
+      return TRUE;
+    return (x.field() == y.field()) || std::equal(x.field(), x.field()+x.size(), y.field());
+  }
+}
+
+/***********************************************/
+
+Vector Kernel::cachedCoefficients(const Vector3d &p, UInt degree, UInt type) const
+{
+  try
+  {
+    for(const auto &c : coefficientsCache)
+      if((c.id == id) && (c.type == type) && (c.degree == degree) && (c.p.x() == p.x()) && (c.p.y() == p.y()) && (c.p.z() == p.z()))
+        return c.kn;
+
+    auto &c  = coefficientsCache.at(coefficientsCacheNext++ % coefficientsCache.size());
+    c.id     = 0; // invalid in case of exception
+    c.kn     = (type == 0) ? coefficients(p, degree) : inverseCoefficients(p, degree, (type == 2));
+    c.type   = type;
+    c.degree = degree;
+    c.p      = p;
+    c.id     = id;
+    return c.kn;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Vector Kernel::cachedFactors(Double r, Double R, const Vector &kn, const Vector &kn2, UInt type, std::function<Vector()> compute)
+{
+  try
+  {
+    for(const auto &c : factorsCache)
+      if((c.type == type) && (c.r == r) && (c.R == R) && isEqual(c.kn, kn) && isEqual(c.kn2, kn2))
+        return c.factors;
+
+    auto &c   = factorsCache.at(factorsCacheNext++ % factorsCache.size());
+    c.type    = MAX_UINT; // invalid in case of exception
+    c.factors = compute();
+    c.r       = r;
+    c.R       = R;
+    c.kn      = kn;
+    c.kn2     = kn2;
+    c.type    = type;
+    return c.factors;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 Double Kernel::kernel(Vector3d const &p, Vector3d const &q) const
 {
   try
   {
-    return kernel(p, q, coefficients(p, maxDegree()));
+    return kernel(p, q, cachedCoefficients(p, maxDegree(), 0));
   }
   catch(std::exception &e)
   {
@@ -120,7 +217,7 @@ Double Kernel::radialDerivative(Vector3d const &p, Vector3d const &q) const
 {
   try
   {
-    return radialDerivative(p, q, coefficients(p, maxDegree()));
+    return radialDerivative(p, q, cachedCoefficients(p, maxDegree(), 0));
   }
   catch(std::exception &e)
   {
@@ -134,7 +231,7 @@ Vector3d Kernel::gradient(Vector3d const &p, Vector3d const &q) const
 {
   try
   {
-    return gradient(p, q, coefficients(p, maxDegree()));
+    return gradient(p, q, cachedCoefficients(p, maxDegree(), 0));
   }
   catch(std::exception &e)
   {
@@ -148,7 +245,7 @@ Tensor3d Kernel::gradientGradient(Vector3d const &p, Vector3d const &q) const
 {
   try
   {
-    return gradientGradient(p, q, coefficients(p, maxDegree()));
+    return gradientGradient(p, q, cachedCoefficients(p, maxDegree(), 0));
   }
   catch(std::exception &e)
   {
@@ -166,20 +263,26 @@ Double Kernel::inverseKernel(Vector3d const &p, Vector3d const &q, const Kernel
     const Double R = q.r();
     const Double t = inner(p, q)/r/R; // t = cos(psi)
 
-    const Vector k2     = kernel2.coefficients(p, kernel2.maxDegree());
-    const Vector k1     = inverseCoefficients (p, k2.size()-1);
-    const UInt   degree = std::min(k1.rows(), k2.rows())-1;
-    Double       *p1 = k1.field();
-    const Double *p2 = k2.field();
-    Double  f1 = R/r;
-    const Double  f2 = R/r;
-
-    for(UInt n=0; n<=degree; n++)
+    const Vector k2     = kernel2.cachedCoefficients(p, kernel2.maxDegree(), 0);
+    const Vector kInv   = cachedCoefficients(p, k2.size()-1, 1);
+    const Vector k1     = cachedFactors(r, R, k2, kInv, 3, [&]()
     {
-      // k1(n) *= (R/r)^(n+1) * sqrt(2n+1) * k2(n));
-      *p1++ *= f1 * sqrt(2*n+1.0) * *p2++;
-      f1  *= f2;
-    }
+      Vector k1 = kInv;
+      const UInt degree = std::min(k1.rows(), k2.rows())-1;
+      Double       *p1 = k1.field();
+      const Double *p2 = k2.field();
+      Double  f1 = R/r;
+      const Double  f2 = R/r;
+
+      for(UInt n=0; n<=degree; n++)
+      {
+        // k1(n) *= (R/r)^(n+1) * sqrt(2n+1) * k2(n));
+        *p1++ *= f1 * sqrt(2*n+1.0) * *p2++;
+        f1  *= f2;
+      }
+      return k1;
+    });
+    const UInt degree = std::min(k1.rows(), k2.rows())-1;
 
     return LegendrePolynomial::sum(t, k1, degree);
   }
@@ -215,7 +318,7 @@ Double Kernel::kernel(Vector3d const &p, Vector3d const &q, const Vector &kn) co
   const Double R = q.r();
   const Double t = inner(p, q)/r/R; // t = cos(psi)
   // Factors: radial = sqrt(2n+1)*(R/r)^(n+1) * k_n
-  const Vector radial = computeFactors(r, R, kn);
+  const Vector radial = cachedFactors(r, R, kn, Vector(), 0, [&]() {return computeFactors(r, R, kn);});
   // K = sum_n sqrt(2n+1)*(R/r)^(n+1) * k_n * P_n(t)
   return LegendrePolynomial::sum(t, radial, kn.size()-1);
 }
@@ -229,7 +332,7 @@ Double Kernel::radialDerivative(Vector3d const &p, Vector3d const &q, const Vect
   const Double t = inner(p, q)/r/R; // t = cos(psi)
 
   // radial_n = -(n+1)/r*(R/r)^(n+1) * sqrt(2n+1) * k_n
-  const Vector radial = computeFactorsRadialDerivative(r, R, kn);
+  const Vector radial = cachedFactors(r, R, kn, Vector(), 1, [&]() {return computeFactorsRadialDerivative(r, R, kn);});
   // K = sum_n -(n+1)/r*(R/r)^(n+1) * sqrt(2n+1) * k_n * P_n(t)
   return LegendrePolynomial::sum(t, radial, kn.size()-1);
 }
@@ -244,8 +347,8 @@ Vector3d Kernel::gradient(Vector3d const &p, Vector3d const &q, const Vector &kn
   const Double t  = inner(p, q)/r/R; // t = cos(psi)
   const UInt   degree = kn.size()-1;
 
-  const Vector radial           = computeFactors(r, R, kn);
-  const Vector radialDerivative = computeFactorsRadialDerivative(r, R, kn);
+  const Vector radial           = cachedFactors(r, R, kn, Vector(), 0, [&]() {return computeFactors(r, R, kn);});
+  const Vector radialDerivative = cachedFactors(r, R, kn, Vector(), 1, [&]() {return computeFactorsRadialDerivative(r, R, kn);});
 
   // derivatives of r with respect to x,y,z
   const Double dr_dx = p.x()/r;
@@ -279,9 +382,9 @@ Tensor3d Kernel::gradientGradient(Vector3d const &p, Vector3d const &q, const Ve
   const Double t  = inner(p, q)/r/R; // t = cos(psi)
   const UInt   degree = kn.size()-1;
 
-  const Vector radial              = computeFactors                   (r, R, kn);
-  const Vector radialDerivative    = computeFactorsRadialDerivative   (r, R, kn);
-  const Vector radialDerivative2nd = computeFactorsRadialDerivative2nd(r, R, kn);
+  const Vector radial              = cachedFactors(r, R, kn, Vector(), 0, [&]() {return computeFactors                   (r, R, kn);});
+  const Vector radialDerivative    = cachedFactors(r, R, kn, Vector(), 1, [&]() {return computeFactorsRadialDerivative   (r, R, kn);});
+  const Vector radialDerivative2nd = cachedFactors(r, R, kn, Vector(), 2, [&]() {return computeFactorsRadialDerivative2nd(r, R, kn);});
 
   // derivatives of r with respect to x,y,z
   const Double dr_dx = p.x()/r;
@@ -63,7 +63,12 @@ class GravityfieldBase;
 * An Instance of this class can be created by @ref readConfig. */
 class Kernel
 {
+  UInt id; // unique number of the instance (key of the coefficient cache)
+
 public:
+  /// Constructor.
+  Kernel();
+
   /// Destructor.
   virtual ~Kernel() {}
 
@@ -149,6 +154,14 @@ protected:
   Vector3d gradient        (Vector3d const &p, Vector3d const &q, const Vector &kn) const;
   Tensor3d gradientGradient(Vector3d const &p, Vector3d const &q, const Vector &kn) const;
 
+  /** @brief coefficients (@a type=0) or inverseCoefficients (@a type=1: exterior, 2: interior) at @a p.
+  * The last results are cached per thread, repeated calls with the same point return the cached vector. */
+  Vector cachedCoefficients(const Vector3d &p, UInt degree, UInt type) const;
+
+  /** @brief Radial factors computed by @a compute from (@a r, @a R, @a kn, @a kn2).
+  * The last results are cached per thread, repeated calls with the same arguments return the cached vector. */
+  static Vector cachedFactors(Double r, Double R, const Vector &kn, const Vector &kn2, UInt type, std::function<Vector()> compute);
+
   Vector computeFactors                   (Double r, Double R, const Vector &kn) const;
   Vector computeFactorsRadialDerivative   (Double r, Double R, const Vector &kn) const;
   Vector computeFactorsRadialDerivative2nd(Double r, Double R, const Vector &kn) const;
@@ -14,6 +14,7 @@
 
 #include "base/import.h"
 #include "base/planets.h"
+#include <atomic>
 #include "config/configRegister.h"
 #include "classes/magnetosphere/magnetosphereIgrf.h"
 #include "classes/magnetosphere/magnetosphere.h"
@@ -24,6 +25,27 @@ GROOPS_REGISTER_CLASS(Magnetosphere, "magnetosphereType",
                       MagnetosphereIgrf)
 GROOPS_READCONFIG_CLASS(Magnetosphere, "magnetosphereType")
 
+namespace
+{
+  // Rotation of the last epoch (per thread).
+  // The rotation is requested for all observations of an epoch.
+  struct MagnetosphereEpochCache
+  {
+    UInt     id = NULLINDEX;
+    Time     time;
+    Rotary3d rotary;
+  };
+
+  thread_local MagnetosphereEpochCache epochCache;
+  std::atomic<UInt> epochCacheIdNext(0);
+}
+
+/***********************************************/
+
+Magnetosphere::Magnetosphere() : cacheId(epochCacheIdNext++)
+{
+}
+
 /***********************************************/
 
 MagnetospherePtr Magnetosphere::create(Config &config, const std::string &name)
@@ -48,14 +70,37 @@ MagnetospherePtr Magnetosphere::create(Config &config, const std::string &name)
 
 /***********************************************/
 
+std::vector<Vector3d> Magnetosphere::magenticFieldVector(const Time &time, const std::vector<Vector3d> &positions) const
+{
+  try
+  {
+    std::vector<Vector3d> b(positions.size());
+    for(UInt i=0; i<positions.size(); i++)
+      b.at(i) = magenticFieldVector(time, positions.at(i));
+    return b;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 Rotary3d Magnetosphere::rotaryCelestial2SolarGeomagneticFrame(const Time &time) const
 {
   try
   {
-    const Vector3d z = Planets::celestial2TerrestrialFrame(time).inverseRotate(geomagneticNorthPole(time));
-    const Vector3d y = normalize(crossProduct(z, Planets::positionSun(time)));
-    const Vector3d x = crossProduct(y, z);
-    return inverse(Rotary3d(x,y));
+    if((epochCache.id != cacheId) || !(epochCache.time == time))
+    {
+      const Vector3d z = Planets::celestial2TerrestrialFrame(time).inverseRotate(geomagneticNorthPole(time));
+      const Vector3d y = normalize(crossProduct(z, Planets::positionSun(time)));
+      const Vector3d x = crossProduct(y, z);
+      epochCache.id     = cacheId;
+      epochCache.time   = time;
+      epochCache.rotary = inverse(Rotary3d(x,y));
+    }
+    return epochCache.rotary;
   }
   catch(std::exception &e)
   {
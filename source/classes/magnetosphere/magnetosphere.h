@@ -45,7 +45,12 @@ typedef std::shared_ptr<Magnetosphere> MagnetospherePtr;
 * An Instance of this class can be created by @ref readConfig. */
 class Magnetosphere
 {
+  UInt cacheId;
+
 public:
+  /// Constructor.
+  Magnetosphere();
+
   /// Destructor.
   virtual ~Magnetosphere() {}
 
@@ -55,11 +60,19 @@ public:
   * @return Magentic vector in terrestrial reference system (TRF) [Tesla = kg/A/s^2]. */
   virtual Vector3d magenticFieldVector(const Time &time, const Vector3d &position) const = 0;
 
+  /** @brief Magnetic field of the Earth at many points of the same epoch.
+  * The time dependent part is computed only once.
+  * @param time GPS time
+  * @param positions in TRF [m]
+  * @return Magentic vectors in terrestrial reference system (TRF) [Tesla = kg/A/s^2]. */
+  virtual std::vector<Vector3d> magenticFieldVector(const Time &time, const std::vector<Vector3d> &positions) const;
+
   /** @brief Geomagnetic north pole in terrestrial frame (TRF).
   * Unit vector. */
   virtual Vector3d geomagneticNorthPole(const Time &time) const = 0;
 
-  /** @brief Rotation from celestial frame (CRF) to solar geomagnetic frame (SGF). */
+  /** @brief Rotation from celestial frame (CRF) to solar geomagnetic frame (SGF).
+  * The rotation of the last epoch is cached (per thread). */
   virtual Rotary3d rotaryCelestial2SolarGeomagneticFrame(const Time &time) const;
 
   /** @brief creates an derived instance of this class. */
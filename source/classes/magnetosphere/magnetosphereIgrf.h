@@ -43,6 +43,7 @@ public:
 
   Vector3d geomagneticNorthPole(const Time &time) const override;
   Vector3d magenticFieldVector(const Time &time, const Vector3d &position) const override;
+  std::vector<Vector3d> magenticFieldVector(const Time &time, const std::vector<Vector3d> &positions) const override;
 };
 
 /***********************************************/
@@ -107,4 +108,30 @@ inline Vector3d MagnetosphereIgrf::magenticFieldVector(const Time &time, const V
 
 /***********************************************/
 
+inline std::vector<Vector3d> MagnetosphereIgrf::magenticFieldVector(const Time &time, const std::vector<Vector3d> &positions) const
+{
+  try
+  {
+#ifdef GROOPS_DISABLE_IGRF
+    throw(Exception("Compiled without International Geomagnetic Reference Field (IGRF) sources"));
+#else
+    const Double decimalYear = time.decimalYear();
+    std::vector<Vector3d> b(positions.size());
+    for(UInt i=0; i<positions.size(); i++)
+    {
+      Double n,e,u,f;
+      igrfSynthesis(0/*main-field*/, decimalYear, 2/*geocentric*/, positions.at(i).r()/1000, positions.at(i).theta()*RAD2DEG, positions.at(i).lambda()*RAD2DEG, n,e,u,f);
+      b.at(i) = 1e-9*localNorthEastUp(positions.at(i)).transform(Vector3d(n,e,u));  // nT -> T (Tesla)
+    }
+    return b;
+#endif
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 #endif
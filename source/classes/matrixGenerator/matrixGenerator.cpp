@@ -185,6 +185,57 @@ Matrix MatrixGenerator::compute()
   }
 }
 
+/***********************************************/
+
+Matrix MatrixGenerator::compute(std::function<std::array<UInt,4>(UInt rows, UInt columns)> range)
+{
+  try
+  {
+    Matrix A;
+    if(matrix.size() == 1)
+    {
+      matrix.at(0)->varList["rowsBefore"]->setValue(0.);
+      matrix.at(0)->varList["columnsBefore"]->setValue(0.);
+      if(matrix.at(0)->computePart(A, range))
+        return A;
+    }
+
+    A = compute();
+    const std::array<UInt,4> r = range(A.rows(), A.columns());
+    if((r[0] == 0) && (r[1] == 0) && (r[2] == A.rows()) && (r[3] == A.columns()))
+      return A;
+    return A.slice(r[0], r[1], r[2], r[3]);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Matrix MatrixGenerator::compute(Bool &transposed)
+{
+  try
+  {
+    Matrix A;
+    if(matrix.size() == 1)
+    {
+      matrix.at(0)->varList["rowsBefore"]->setValue(0.);
+      matrix.at(0)->varList["columnsBefore"]->setValue(0.);
+      if(matrix.at(0)->computeTransposed(A, transposed))
+        return A;
+    }
+
+    transposed = FALSE;
+    return compute();
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
 /***********************************************/
 /***********************************************/
 
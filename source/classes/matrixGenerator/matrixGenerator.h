@@ -63,6 +63,16 @@ public:
   /// provides a matrix.
   Matrix compute();
 
+  /** @brief provides a part of the matrix.
+  * @a range is called with the dimension of the complete matrix and returns {startRow, startColumn, rows, columns} of the part.
+  * Some generators (e.g. multiplication, transpose) compute only the needed part instead of the complete matrix. */
+  Matrix compute(std::function<std::array<UInt,4>(UInt rows, UInt columns)> range);
+
+  /** @brief provides the matrix or its transposed.
+  * If @a transposed is set, the transposed of the returned matrix is meant.
+  * This avoids the copy of transposed matrices used e.g. in multiplications. */
+  Matrix compute(Bool &transposed);
+
   /** @brief creates an derived instance of this class. */
   static MatrixGeneratorPtr create(Config &config, const std::string &name) {return MatrixGeneratorPtr(new MatrixGenerator(config, name));}
 };
@@ -95,6 +105,8 @@ public:
   MatrixGeneratorBase(Config &config);
   virtual ~MatrixGeneratorBase() {}
   virtual void compute(Matrix &A, UInt &startRow, UInt &startCol) = 0;
+  virtual Bool computePart(Matrix &/*A*/, std::function<std::array<UInt,4>(UInt, UInt)> /*range*/) {return FALSE;}
+  virtual Bool computeTransposed(Matrix &/*A*/, Bool &/*transposed*/) {return FALSE;}
 };
 
 /***********************************************/
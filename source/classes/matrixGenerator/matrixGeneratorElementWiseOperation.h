@@ -43,6 +43,7 @@ class MatrixGeneratorElementWiseOperation : public MatrixGeneratorBase
 public:
   MatrixGeneratorElementWiseOperation(Config &config);
   void compute(Matrix &A, UInt &startRow, UInt &startCol);
+  Bool computePart(Matrix &A, std::function<std::array<UInt,4>(UInt, UInt)> range);
 };
 
 /***********************************************/
@@ -70,13 +71,39 @@ inline void MatrixGeneratorElementWiseOperation::compute(Matrix &A, UInt &/*star
 {
   try
   {
-    Matrix X = matrix1->compute();
-    Matrix Y = matrix2->compute();
-    if( (X.rows() != Y.rows()) || (X.columns() != Y.columns()) )
-      throw(Exception("Matrix dimensions do not agree. ("+X.rows()%"%i x "s+X.columns()%"%i) vs. ("s+Y.rows()%"%i x "s+Y.columns()%"%i)."s));
+    computePart(A, [](UInt rows, UInt columns) {return std::array<UInt,4>{0, 0, rows, columns};});
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+inline Bool MatrixGeneratorElementWiseOperation::computePart(Matrix &A, std::function<std::array<UInt,4>(UInt, UInt)> range)
+{
+  try
+  {
+    // only the needed part of both matrices is computed
+    UInt rows, columns;
+    std::array<UInt,4> r;
+    Matrix X = matrix1->compute([&](UInt rowsX, UInt columnsX)
+    {
+      rows    = rowsX;
+      columns = columnsX;
+      r = range(rows, columns);
+      return r;
+    });
+    Matrix Y = matrix2->compute([&](UInt rowsY, UInt columnsY)
+    {
+      if((rows != rowsY) || (columns != columnsY))
+        throw(Exception("Matrix dimensions do not agree. ("+rows%"%i x "s+columns%"%i) vs. ("s+rowsY%"%i x "s+columnsY%"%i)."s));
+      return r;
+    });
 
-    addVariable("rows",    static_cast<Double>(X.rows()),    varList);
-    addVariable("columns", static_cast<Double>(X.columns()), varList);
+    addVariable("rows",    static_cast<Double>(rows),    varList);
+    addVariable("columns", static_cast<Double>(columns), varList);
     addVariable("row",     varList);
     addVariable("column",  varList);
     addVariable("data",    varList);
@@ -86,12 +113,13 @@ inline void MatrixGeneratorElementWiseOperation::compute(Matrix &A, UInt &/*star
     for(UInt z=0; z<A.rows(); z++)
       for(UInt s=0; s<A.columns(); s++)
       {
-        varList["row"]->setValue(static_cast<Double>(z));
-        varList["column"]->setValue(static_cast<Double>(s));
+        varList["row"]->setValue(static_cast<Double>(z+r[0]));
+        varList["column"]->setValue(static_cast<Double>(s+r[1]));
         varList["data0"]->setValue(X(z,s));
         varList["data1"]->setValue(Y(z,s));
         A(z,s) = expression->evaluate(varList);
       }
+    return TRUE;
   }
   catch(std::exception &e)
   {
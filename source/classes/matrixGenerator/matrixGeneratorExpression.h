@@ -73,17 +73,16 @@ inline void MatrixGeneratorExpression::compute(Matrix &A, UInt &/*startRow*/, UI
 
     addVariable("rows",    static_cast<Double>(A.rows()),    varList);
     addVariable("columns", static_cast<Double>(A.columns()), varList);
-    expression->simplify(varList);
-    addVariable("row",    varList);
-    addVariable("column", varList);
-
-    for(UInt z=0; z<A.rows(); z++)
-      for(UInt s=0; s<A.columns(); s++)
-      {
-        varList["row"]->setValue(static_cast<Double>(z));
-        varList["column"]->setValue(static_cast<Double>(s));
-        A(z,s) = expression->evaluate(varList);
-      }
+    ExpressionCompiled compiled(expression, varList, {"row", "column"});
+
+    // evaluate column by column
+    std::vector<Double> rowIndex(A.rows()), colIndex(A.rows());
+    std::iota(rowIndex.begin(), rowIndex.end(), 0.);
+    for(UInt s=0; s<A.columns(); s++)
+    {
+      std::fill(colIndex.begin(), colIndex.end(), static_cast<Double>(s));
+      compiled.evaluate(A.rows(), {rowIndex.data(), colIndex.data()}, A.field()+s*A.ld());
+    }
   }
   catch(std::exception &e)
   {
@@ -40,6 +40,7 @@ class MatrixGeneratorFile : public MatrixGeneratorBase
 public:
   MatrixGeneratorFile(Config &config);
   void compute(Matrix &A, UInt &startRow, UInt &startCol);
+  Bool computePart(Matrix &A, std::function<std::array<UInt,4>(UInt, UInt)> range);
 };
 
 /***********************************************/
@@ -79,4 +80,20 @@ inline void MatrixGeneratorFile::compute(Matrix &A, UInt &/*startRow*/, UInt &/*
 
 /***********************************************/
 
+inline Bool MatrixGeneratorFile::computePart(Matrix &A, std::function<std::array<UInt,4>(UInt, UInt)> range)
+{
+  try
+  {
+    readFileMatrix(fileName, range, A);
+    A *= factor;
+    return TRUE;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 #endif
@@ -39,6 +39,7 @@ class MatrixGeneratorMultiplication : public MatrixGeneratorBase
 public:
   MatrixGeneratorMultiplication(Config &config);
   void compute(Matrix &A, UInt &startRow, UInt &startCol);
+  Bool computePart(Matrix &A, std::function<std::array<UInt,4>(UInt, UInt)> range);
 };
 
 /***********************************************/
@@ -66,9 +67,51 @@ inline void MatrixGeneratorMultiplication::compute(Matrix &A, UInt &/*startRow*/
 {
   try
   {
-    A = factor * matrix1->compute() * matrix2->compute();
-    if(A.getType() == Matrix::SYMMETRIC)
-      fillSymmetric(A);
+    computePart(A, [](UInt rows, UInt columns) {return std::array<UInt,4>{0, 0, rows, columns};});
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+inline Bool MatrixGeneratorMultiplication::computePart(Matrix &A, std::function<std::array<UInt,4>(UInt, UInt)> range)
+{
+  try
+  {
+    // transposed matrices are used directly in the multiplication without copy
+    Bool transposed1, transposed2;
+    Matrix X = matrix1->compute(transposed1);
+    Matrix Y = matrix2->compute(transposed2);
+    const std::array<UInt,4> r = range(transposed1 ? X.columns() : X.rows(), transposed2 ? Y.rows() : Y.columns());
+
+    // only the needed rows of matrix1 and columns of matrix2 are multiplied
+    auto part = [](Matrix &M, Bool transposed, UInt start, UInt count, Bool isRow) -> const_MatrixSlice
+    {
+      const UInt size = (isRow != transposed) ? M.rows() : M.columns();
+      if((start == 0) && (count == size))
+        return transposed ? const_MatrixSlice(M.trans()) : const_MatrixSlice(M);
+      if(M.getType() == Matrix::SYMMETRIC)
+        fillSymmetric(M);
+      else if(M.getType() == Matrix::TRIANGULAR)
+        zeroUnusedTriangle(M);
+      M.setType(Matrix::GENERAL);
+      if(isRow)
+        return transposed ? const_MatrixSlice(M.trans().row(start, count)) : const_MatrixSlice(M.row(start, count));
+      return transposed ? const_MatrixSlice(M.trans().column(start, count)) : const_MatrixSlice(M.column(start, count));
+    };
+
+    const const_MatrixSlice X1 = part(X, transposed1, r[0], r[2], TRUE);
+    const const_MatrixSlice Y1 = part(Y, transposed2, r[1], r[3], FALSE);
+    if(X1.columns() != Y1.rows())
+      throw(Exception("Matrix dimensions do not agree. ("+X1.rows()%"%i x "s+X1.columns()%"%i) vs. ("s+Y1.rows()%"%i x "s+Y1.columns()%"%i)."s));
+
+    A = Matrix(r[2], r[3]);
+    if(A.size() && X1.columns())
+      matMult(factor, X1, Y1, A);
+    return TRUE;
   }
   catch(std::exception &e)
   {
@@ -18,6 +18,8 @@
 static const char *docstringMatrixGeneratorSlice = R"(
 \subsection{Slice}
 Slice of a matrix.
+Only the needed part is computed of a \configClass{matrix:multiplication}{matrixGeneratorType:multiplication},
+\configClass{matrix:transpose}{matrixGeneratorType:transpose} or \configClass{matrix:elementWiseOperation}{matrixGeneratorType:elementWiseOperation}.
 )";
 #endif
 
@@ -69,16 +71,19 @@ inline void MatrixGeneratorSlice::compute(Matrix &A, UInt &/*startRow*/, UInt &/
 {
   try
   {
-    A = matrix->compute();
-
-    addVariable("rows",    static_cast<Double>(A.rows()),    varList);
-    addVariable("columns", static_cast<Double>(A.columns()), varList);
-    const UInt row  = static_cast<UInt>(exprRow->evaluate(varList));
-    const UInt col  = static_cast<UInt>(exprCol->evaluate(varList));
-    const UInt rows = static_cast<UInt>(exprRows->evaluate(varList));
-    const UInt cols = static_cast<UInt>(exprCols->evaluate(varList));
-
-    A = A.slice(row, col, rows > 0 ? rows : A.rows()-row, cols > 0 ? cols : A.columns()-col);
+    // only the slice is computed if possible (e.g. of a multiplication)
+    A = matrix->compute([&](UInt rows, UInt columns)
+    {
+      addVariable("rows",    static_cast<Double>(rows),    varList);
+      addVariable("columns", static_cast<Double>(columns), varList);
+      const UInt row      = static_cast<UInt>(exprRow->evaluate(varList));
+      const UInt col      = static_cast<UInt>(exprCol->evaluate(varList));
+      const UInt rowCount = static_cast<UInt>(exprRows->evaluate(varList));
+      const UInt colCount = static_cast<UInt>(exprCols->evaluate(varList));
+      if((row+rowCount > rows) || (col+colCount > columns) || (row > rows) || (col > columns))
+        throw(Exception("Dimension error: ("+rows%"%i x "s+columns%"%i).slice("s+row%"%i, "s+col%"%i, "s+rowCount%"%i, "s+colCount%"%i)"s));
+      return std::array<UInt,4>{row, col, rowCount > 0 ? rowCount : rows-row, colCount > 0 ? colCount : columns-col};
+    });
   }
   catch(std::exception &e)
   {
@@ -38,6 +38,8 @@ class MatrixGeneratorTranspose : public MatrixGeneratorBase
 public:
   MatrixGeneratorTranspose(Config &config);
   void compute(Matrix &A, UInt &startRow, UInt &startCol);
+  Bool computePart(Matrix &A, std::function<std::array<UInt,4>(UInt, UInt)> range);
+  Bool computeTransposed(Matrix &A, Bool &transposed);
 };
 
 /***********************************************/
@@ -73,4 +75,39 @@ inline void MatrixGeneratorTranspose::compute(Matrix &A, UInt &/*startRow*/, UIn
 
 /***********************************************/
 
+inline Bool MatrixGeneratorTranspose::computePart(Matrix &A, std::function<std::array<UInt,4>(UInt, UInt)> range)
+{
+  try
+  {
+    A = matrix->compute([&](UInt rows, UInt columns)
+    {
+      const std::array<UInt,4> r = range(columns, rows);
+      return std::array<UInt,4>{r[1], r[0], r[3], r[2]};
+    }).trans();
+    return TRUE;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+inline Bool MatrixGeneratorTranspose::computeTransposed(Matrix &A, Bool &transposed)
+{
+  try
+  {
+    A = matrix->compute(transposed);
+    transposed = !transposed;
+    return TRUE;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 #endif
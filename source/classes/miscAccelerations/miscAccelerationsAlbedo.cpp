@@ -60,6 +60,17 @@ MiscAccelerationsAlbedo::MiscAccelerationsAlbedo(Config &config)
     // convert area from unit sphere
     for(UInt i=0; i<points.size(); i++)
       areas.at(i) *= pow(points.at(i).r(), 2);
+
+    // spatial index: points in latitude bands
+    radiusMin = 1e99;
+    normals.resize(points.size());
+    bands.resize(180);
+    for(UInt i=0; i<points.size(); i++)
+    {
+      normals.at(i) = normalize(points.at(i));
+      radiusMin     = std::min(radiusMin, points.at(i).r());
+      bands.at(bandIndex(std::asin(normals.at(i).z()))).push_back(i);
+    }
   }
   catch(std::exception &e)
   {
@@ -69,6 +80,14 @@ MiscAccelerationsAlbedo::MiscAccelerationsAlbedo(Config &config)
 
 /***********************************************/
 
+UInt MiscAccelerationsAlbedo::bandIndex(Double phi) const
+{
+  const Double idx = std::floor((phi+PI/2)/PI*bands.size());
+  return static_cast<UInt>(std::max(0., std::min(idx, bands.size()-1.)));
+}
+
+/***********************************************/
+
 Vector3d MiscAccelerationsAlbedo::acceleration(SatelliteModelPtr satellite, const Time &time,
                                                const Vector3d &position, const Vector3d &/*velocity*/,
                                                const Rotary3d &rotSat, const Rotary3d &rotEarth, EphemeridesPtr ephemerides)
@@ -80,8 +99,10 @@ Vector3d MiscAccelerationsAlbedo::acceleration(SatelliteModelPtr satellite, cons
     if(!ephemerides)
       throw(Exception("No ephemerides given"));
 
-    Vector3d posSat = rotSat.inverseRotate(position);
-    Vector3d posSun = rotSat.inverseRotate(ephemerides->position(time, Ephemerides::SUN));
+    // computation in terrestrial frame
+    const Rotary3d rot    = rotEarth * rotSat; // satellite frame -> terrestrial frame
+    const Vector3d posSat = rotEarth.rotate(position);
+    Vector3d       posSun = rotEarth.rotate(ephemerides->position(time, Ephemerides::SUN));
 
     const Double AU           = 149597870700.0;
     const Double distanceSun  = posSun.normalize();
@@ -99,35 +120,47 @@ Vector3d MiscAccelerationsAlbedo::acceleration(SatelliteModelPtr satellite, cons
       index2 = std::min(month-1, emissivity.size()-1);
     }
 
-    Vector3d acc;
-    for(UInt i=0; i<points.size(); i++)
-    {
-      Vector3d posEarth     = rotSat.inverseRotate(rotEarth.inverseRotate(points.at(i)));
-      Vector3d direction    = posSat-posEarth;
-      const Double distance = direction.normalize();
-      posEarth.normalize();
-
-      // Cosine of angle of reflected radiation
-      const Double cosReflexion = inner(direction, posEarth);
-      if(cosReflexion<=0) // element visible?
-        continue;
-      // Cosine of angle of incident radiation
-      const Double cosIncident = inner(posSun, posEarth);
-
-      // Reflected Irradiance
-      Double eReflectivity = 0;
-      if(reflectivity.size() && (cosIncident>0))
-        eReflectivity = reflectivity.at(index1).at(i)/(PI*distance*distance)*cosIncident*s0*cosReflexion*areas.at(i);
-
-      // Emitted Irradiance
-      Double eEmittance = 0;
-      if(emissivity.size())
-        eEmittance = emissivity.at(index2).at(i)/(4*PI*distance*distance)*s0*cosReflexion*areas.at(i);
-
-      acc += satellite->accelerationPressure(direction, eReflectivity, eEmittance);
-    }
-
-    return factor*rotEarth.rotate(rotSat.rotate(acc));
+    // latitude bands within visibility cap
+    const Double r   = posSat.r();
+    const Double psi = std::acos(std::min(1., radiusMin/r));
+    const Double phi = std::asin(posSat.z()/r);
+
+    std::vector<Double> dx, dy, dz, visible, infrared;
+    for(UInt band=bandIndex(phi-psi); band<=bandIndex(phi+psi); band++)
+      for(UInt i : bands.at(band))
+      {
+        const Vector3d &posEarth = normals.at(i);
+        Vector3d direction    = posSat-points.at(i);
+        const Double distance = direction.normalize();
+
+        // Cosine of angle of reflected radiation
+        const Double cosReflexion = inner(direction, posEarth);
+        if(cosReflexion<=0) // element visible?
+          continue;
+        // Cosine of angle of incident radiation
+        const Double cosIncident = inner(posSun, posEarth);
+
+        // Reflected Irradiance
+        Double eReflectivity = 0;
+        if(reflectivity.size() && (cosIncident>0))
+          eReflectivity = reflectivity.at(index1).at(i)/(PI*distance*distance)*cosIncident*s0*cosReflexion*areas.at(i);
+
+        // Emitted Irradiance
+        Double eEmittance = 0;
+        if(emissivity.size())
+          eEmittance = emissivity.at(index2).at(i)/(4*PI*distance*distance)*s0*cosReflexion*areas.at(i);
+
+        direction = rot.inverseRotate(direction);
+        dx.push_back(direction.x());
+        dy.push_back(direction.y());
+        dz.push_back(direction.z());
+        visible.push_back(eReflectivity);
+        infrared.push_back(eEmittance);
+      }
+
+    // all visible cells at once
+    const Vector3d acc = satellite->accelerationPressure(dx, dy, dz, visible, infrared);
+    return factor*rot.rotate(acc);
   }
   catch(std::exception &e)
   {
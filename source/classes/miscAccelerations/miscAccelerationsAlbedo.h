@@ -26,6 +26,8 @@ algorithm in:
 Knocke, P. C., Ries, J. C., and Tapley, B. D. (1988). Earth radiation pressure effects on satellites.
 Proceedings of the AIAA/AAS Astrodynamics Conference, 88-4292-CP, 577-87. DOI: 10.2514/6.
 1988-4292.
+
+Only grid cells in latitude bands within the visibility cap of the satellite are evaluated.
 )";
 #endif
 
@@ -45,9 +47,14 @@ class MiscAccelerationsAlbedo : public MiscAccelerationsBase
   std::vector<Double>              areas;
   std::vector<std::vector<Double>> reflectivity;
   std::vector<std::vector<Double>> emissivity;
+  std::vector<Vector3d>            normals;   // unit vectors of points
+  std::vector<std::vector<UInt>>   bands;     // point indices sorted into latitude bands (visibility query)
+  Double                           radiusMin; // min. radius of points
   Double                           solarflux;
   Double                           factor;
 
+  UInt bandIndex(Double phi) const;
+
 public:
   MiscAccelerationsAlbedo(Config &config);
 
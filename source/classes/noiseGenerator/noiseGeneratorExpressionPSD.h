@@ -91,17 +91,15 @@ inline Matrix NoiseGeneratorExpressionPSD::noise(UInt samples, UInt series)
         logWarning << "Warning: PSD at frequency "+freq(i) % "%f [Hz] is "s + PSD(i) % "%f"s << Log::endl;
     }
 
-    // For each column, perform discrete Fourier transform, multiply the results and synthesize noise
-    Matrix noise(samples, series);
-    for(UInt k=0; k<series; k++)
-    {
-      auto Wk = Fourier::fft(Vector(wk.column(k))); // Complex Fourier transform
-      for(UInt i=0; i<PSD.rows(); i++)
-        Wk.at(i) *= std::sqrt(PSD(i));
-      copy(Fourier::synthesis(Wk, TRUE/*even*/).slice(0, samples), noise.column(k));
-    }
+    for(UInt i=0; i<PSD.rows(); i++)
+      PSD(i) = std::sqrt(PSD(i));
 
-    return noise;
+    // Discrete Fourier transform of all columns, multiply the results and synthesize noise
+    auto Wk = Fourier::fftColumns(wk);
+    for(auto &W : Wk)
+      for(UInt i=0; i<PSD.rows(); i++)
+        W.at(i) *= PSD(i);
+    return Fourier::synthesisColumns(Wk, TRUE/*even*/).row(0, samples);
   }
   catch(std::exception &e)
   {
@@ -83,17 +83,12 @@ inline Matrix NoiseGeneratorPowerLaw::noise(UInt samples, UInt series)
       hk(i) = hk(i-1) * (0.5*alpha+(i-1))/i;
     auto Hk = Fourier::fft(hk);
 
-    // For each column, perform discrete Fourier transform, multiply the results and synthesize noise
-    Matrix noise(samples, series);
-    for(UInt i=0; i<series; i++)
-    {
-      auto Wk = Fourier::fft(wk.column(i));
-      for(UInt j=0; j<Wk.size(); j++)
-        Wk.at(j) *= Hk.at(j); // complex multiplication
-      copy(Fourier::synthesis(Wk, TRUE/*even*/).slice(0, samples), noise.column(i));
-    }
-
-    return noise;
+    // Discrete Fourier transform of all columns, multiply the results and synthesize noise
+    auto Wk = Fourier::fftColumns(wk);
+    for(auto &W : Wk)
+      for(UInt j=0; j<W.size(); j++)
+        W.at(j) *= Hk.at(j); // complex multiplication
+    return Fourier::synthesisColumns(Wk, TRUE/*even*/).row(0, samples);
   }
   catch(std::exception &e)
   {
@@ -74,11 +74,12 @@ NormalEquation::NormalEquation(Config &config, const std::string &name)
 
 /***********************************************/
 
-void NormalEquation::init(UInt blockSize, Parallel::CommunicatorPtr comm)
+void NormalEquation::init(UInt blockSize, Parallel::CommunicatorPtr comm, UInt monteCarloCount)
 {
   try
   {
     status = UNKNOWN;
+    this->monteCarloCount = monteCarloCount;
 
     // determine dimension
     UInt paraCount = 0;
@@ -92,12 +93,19 @@ void NormalEquation::init(UInt blockSize, Parallel::CommunicatorPtr comm)
       throw(Exception("Cannot determine dimension of normals"));
 
     // init distributed normal matrix
-    normals.initEmpty(MatrixDistributed::computeBlockIndex(paraCount, blockSize), comm);
+    if(blockSize == NULLINDEX)
+      blockSize = MatrixDistributed::autotuneBlockSize(paraCount, comm);
+    const std::vector<UInt> blockIndex = MatrixDistributed::computeBlockIndex(paraCount, blockSize);
+    const std::vector<UInt> memory     = MatrixDistributed::estimateMemory(blockIndex, Parallel::size(comm));
+    logInfo<<"  normal matrix: "<<paraCount<<" parameters, "<<blockIndex.size()-1<<" blocks, estimated memory "
+           <<1e-6*std::accumulate(memory.begin(), memory.end(), UInt(0))%"%.1f MB, max. "s<<1e-6*(*std::max_element(memory.begin(), memory.end()))%"%.1f MB per process"s<<Log::endl;
+    normals.initEmpty(blockIndex, comm);
     n        = Matrix(paraCount, rhsCount);
     lPl      = Vector(rhsCount);
     obsCount = 0;
     x        = Matrix(paraCount, rhsCount);
-    Wz       = Matrix(paraCount, 100);
+    Wz       = Matrix(paraCount, monteCarloCount);
+    Wz2      = Wz;
 
     // init normals components
     for(auto component : normalsComponent)
@@ -172,6 +180,21 @@ void NormalEquation::setApproximateSolution(const const_MatrixSlice &x0)
 
 /***********************************************/
 
+void NormalEquation::setCheckpoint(const FileName &fileName, Double interval)
+{
+  try
+  {
+    for(UInt i=0; i<normalsComponent.size(); i++)
+      normalsComponent.at(i)->setCheckpoint(fileName.appendBaseName(".component"+i%"%02i"s), interval);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 Bool NormalEquation::build(UInt rightHandSide)
 {
   try
@@ -190,7 +213,7 @@ Bool NormalEquation::build(UInt rightHandSide)
 
     Bool ready = TRUE;
     for(auto component : normalsComponent)
-      ready = component->addNormalEquation(rhsNo, x, Wz, normals, n, lPl, obsCount) && ready;
+      ready = component->addNormalEquation(rhsNo, x, Wz, Wz2, normals, n, lPl, obsCount) && ready;
 
     status = NORMAL;
     return ready || (varianceComponentFactors().rows() == 1); // if only one sigma -> iteration is not needed
@@ -221,14 +244,10 @@ void NormalEquation::write(const FileName &fileName)
 
 /***********************************************/
 
-Matrix NormalEquation::solve()
+void NormalEquation::regularizeNotUsedParameter()
 {
   try
   {
-    if(status!=NORMAL)
-      build(rhsNo);
-
-    // regularize not used parameters
     for(UInt i=0; i<normals.blockCount(); i++)
       if(normals.isMyRank(i,i))
       {
@@ -240,14 +259,32 @@ Matrix NormalEquation::solve()
             logWarning<<normals.blockIndex(i)+k<<". parameter has zero diagonal element -> set to one"<<Log::endl;
           }
       }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Matrix NormalEquation::solve(Bool mixedPrecision)
+{
+  try
+  {
+    if(status!=NORMAL && status!=ITERATIVE)
+      build(rhsNo);
+
+    regularizeNotUsedParameter();
 
-    x = normals.solve(n, TRUE/*timing*/);
+    x = normals.solve(n, TRUE/*timing*/, mixedPrecision);
     Parallel::broadCast(x, 0, normals.communicator());
 
     // N contains now the cholesky decomposition
-    Wz = Vce::monteCarlo(x.rows(), 100);
+    Wz = Vce::monteCarlo(x.rows(), monteCarloCount);
     normals.triangularSolve(Wz);
     Parallel::broadCast(Wz, 0, normals.communicator());
+    Wz2 = Wz;
 
     status = CHOLESKY;
     return x;
@@ -260,6 +297,42 @@ Matrix NormalEquation::solve()
 
 /***********************************************/
 
+Matrix NormalEquation::solveConjugateGradient(UInt maxIter, Double threshold)
+{
+  try
+  {
+    if(status!=NORMAL && status!=ITERATIVE)
+      build(rhsNo);
+
+    regularizeNotUsedParameter();
+
+    // solve together with Monte-Carlo vectors: trace(N_k*N^-1) = E[z'*N_k*N^-1*z]
+    Matrix z = Vce::monteCarlo(n.rows(), monteCarloCount);
+    Matrix nz;
+    if(Parallel::isMaster(normals.communicator()))
+    {
+      nz = Matrix(n.rows(), n.columns()+z.columns());
+      copy(n, nz.column(0, n.columns()));
+      copy(z, nz.column(n.columns(), z.columns()));
+    }
+    Matrix y = normals.solveConjugateGradient(nz, maxIter, threshold, TRUE/*timing*/);
+    Parallel::broadCast(y, 0, normals.communicator());
+    x   = y.column(0, n.columns());
+    Wz  = z;
+    Wz2 = y.column(n.columns(), z.columns());
+    Parallel::broadCast(Wz, 0, normals.communicator());
+
+    status = ITERATIVE;
+    return x;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 Double NormalEquation::aposterioriSigma()
 {
   try
@@ -278,44 +351,91 @@ Double NormalEquation::aposterioriSigma()
 
 /***********************************************/
 
-Vector NormalEquation::sigmaParameter()
+Double NormalEquation::sigmaForCovariance()
 {
   try
   {
-    if(status != CHOLESKY)
-      solve();
-
     Double sigma = aposterioriSigma();
     if((sigma <= 0) || std::isnan(sigma))
     {
       logWarningOnce<<"sigma = "<<sigma<<" not applied to covariance matrix"<<Log::endl;
       sigma = 1.;
     }
+    return sigma;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
 
-    normals.choleskyInverse();
+Vector NormalEquation::sigmaParameter()
+{
+  try
+  {
+    if((status != CHOLESKY) && (status != INVERSE))
+      solve();
+
+    const Double sigma = sigmaForCovariance();
     Vector diagonal = Vector(normals.dimension());
+
+    // diagonal of the full inverse
+    // ----------------------------
+    if(status == INVERSE)
+    {
+      for(UInt i=0; i<normals.blockCount(); i++)
+        if(normals.isMyRank(i,i))
+          for(UInt z=0; z<normals.blockSize(i); z++)
+            diagonal(normals.blockIndex(i)+z) = normals.N(i,i)(z,z);
+    }
+
+    // selected inversion at the structure of the Cholesky factor
+    // ----------------------------------------------------------
+    Bool isSparse = FALSE;
     for(UInt i=0; i<normals.blockCount(); i++)
+      for(UInt k=i+1; k<normals.blockCount(); k++)
+        isSparse = isSparse || !normals.isBlockUsed(i,k);
+    if((status == CHOLESKY) && isSparse)
     {
-      if(normals.isMyRank(i,i))
+      normals.cholesky2SparseInverse();
+      for(UInt i=0; i<normals.blockCount(); i++)
+        if(normals.isMyRank(i,i))
+          for(UInt z=0; z<normals.blockSize(i); z++)
+            diagonal(normals.blockIndex(i)+z) = normals.N(i,i)(z,z);
+      status = SPARSEINVERSE;
+    }
+
+    // inverse of the Cholesky factor: diagonal is the row wise square sum
+    // -------------------------------------------------------------------
+    if(status == CHOLESKY)
+    {
+      normals.choleskyInverse();
+      for(UInt i=0; i<normals.blockCount(); i++)
       {
-        Matrix &N = normals.N(i,i);
-        for(UInt z=0; z<N.rows(); z++)
-          diagonal(normals.blockIndex(i)+z) += quadsum(N.slice(z,z,1,N.columns()-z));
-      }
-      for(UInt k=i+1; k<normals.blockCount(); k++)
-        if(normals.isMyRank(i,k))
+        if(normals.isMyRank(i,i))
         {
-          Matrix &N = normals.N(i,k);
+          Matrix &N = normals.N(i,i);
           for(UInt z=0; z<N.rows(); z++)
-            diagonal(normals.blockIndex(i)+z) += quadsum(N.row(z));
+            diagonal(normals.blockIndex(i)+z) += quadsum(N.slice(z,z,1,N.columns()-z));
         }
+        for(UInt k=i+1; k<normals.blockCount(); k++)
+          if(normals.isMyRank(i,k))
+          {
+            Matrix &N = normals.N(i,k);
+            for(UInt z=0; z<N.rows(); z++)
+              diagonal(normals.blockIndex(i)+z) += quadsum(N.row(z));
+          }
+      }
+      status = INVERSECHOLESKY;
     }
+
     Parallel::reduceSum(diagonal, 0, normals.communicator());
     Parallel::broadCast(diagonal, 0, normals.communicator());
     for(UInt i=0; i<diagonal.rows(); i++)
       diagonal(i) = std::sqrt(diagonal(i));
 
-    status = INVERSECHOLESKY;
     return sigma * diagonal;
   }
   catch(std::exception &e)
@@ -326,6 +446,40 @@ Vector NormalEquation::sigmaParameter()
 
 /***********************************************/
 
+Matrix NormalEquation::covarianceParameter(const std::vector<UInt> &index)
+{
+  try
+  {
+    if(status != CHOLESKY)
+      solve();
+
+    const Double sigma = sigmaForCovariance();
+    Matrix Y, C;
+    if(Parallel::isMaster(normals.communicator()))
+    {
+      Y = Matrix(normals.dimension(), index.size());
+      for(UInt k=0; k<index.size(); k++)
+        if(index.at(k) != NULLINDEX)
+          Y(index.at(k), k) = sigma;
+    }
+    normals.triangularTransSolve(Y);
+
+    if(Parallel::isMaster(normals.communicator()))
+    {
+      C = Matrix(index.size(), Matrix::SYMMETRIC);
+      rankKUpdate(1., Y, C);
+      fillSymmetric(C);
+    }
+    return C;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 void NormalEquation::writeCovariance(const FileName &fileName)
 {
   try
@@ -333,17 +487,15 @@ void NormalEquation::writeCovariance(const FileName &fileName)
     if(status != INVERSE)
     {
       if(status != INVERSECHOLESKY)
-        sigmaParameter();
+      {
+        if(status != CHOLESKY)
+          solve();
+        normals.choleskyInverse();
+      }
       normals.choleskyProduct();
     }
 
-    Double sigma = aposterioriSigma();
-    if((sigma <= 0) || std::isnan(sigma))
-    {
-      logWarningOnce<<"sigma = "<<sigma<<" not applied to covariance matrix"<<Log::endl;
-      sigma = 1.;
-    }
-
+    const Double sigma = sigmaForCovariance();
     for(UInt i=0; i<normals.blockCount(); i++)
       for(UInt k=i; k<normals.blockCount(); k++)
         if(normals.isMyRank(i,k))
@@ -366,7 +518,11 @@ Matrix NormalEquation::contribution()
     if(status != INVERSE)
     {
       if(status != INVERSECHOLESKY)
-        sigmaParameter();
+      {
+        if(status != CHOLESKY)
+          solve();
+        normals.choleskyInverse();
+      }
       normals.choleskyProduct();
       status = INVERSE;
     }
@@ -84,18 +84,22 @@ typedef std::shared_ptr<NormalEquation> NormalEquationPtr;
 class NormalEquation
 {
 private:
-  enum Status {UNKNOWN, INIT, NORMAL, CHOLESKY, INVERSECHOLESKY, INVERSE};
+  enum Status {UNKNOWN, INIT, NORMAL, ITERATIVE, CHOLESKY, INVERSECHOLESKY, SPARSEINVERSE, INVERSE};
   Status            status;
   UInt              rhsNo;
   MatrixDistributed normals;
   Matrix            n;        // right hand sides (at master)
   Vector            lPl;      // Norm of the observations
   UInt              obsCount;
-  Matrix            Wz;       // Monte-Carlo-vector
+  Matrix            Wz, Wz2;  // Monte-Carlo-vectors
+  UInt              monteCarloCount;
   Matrix            x;        // current solution
 
   std::vector<NormalEquationBase*> normalsComponent;
 
+  void regularizeNotUsedParameter();
+  Double sigmaForCovariance();
+
 public:
   /// Constructor.
   NormalEquation(Config &config, const std::string &name);
@@ -104,9 +108,10 @@ public:
   virtual ~NormalEquation();
 
   /** @brief Init systems of normal equations.
-  * @param blockSize normal matrix is divided into blocks, (0: only one block).
-  * @param comm normal matrix is distributed over processes.  */
-  void init(UInt blockSize, Parallel::CommunicatorPtr comm);
+  * @param blockSize normal matrix is divided into blocks, (0: only one block, NULLINDEX: see MatrixDistributed::autotuneBlockSize).
+  * @param comm normal matrix is distributed over processes.
+  * @param monteCarloCount number of Monte-Carlo vectors for the stochastic trace estimation in the variance component estimation. */
+  void init(UInt blockSize, Parallel::CommunicatorPtr comm, UInt monteCarloCount=100);
 
   /** @brief Number of unknown parameters.
   * Dimension of the normal matrix N. */
@@ -131,6 +136,15 @@ public:
   * To speed up the iterative Variance Component Estimation (VCE). */
   void setApproximateSolution(const const_MatrixSlice &x0);
 
+  /** @brief Store partially accumulated normals periodically in @a build().
+  * Each process writes its accumulated observation equations and the processed arcs
+  * to @p fileName (with appended component and process number) every @p interval seconds.
+  * An interrupted accumulation restarted with the same number of processes
+  * continues from these files and skips the processed arcs.
+  * The files are removed after the accumulation is complete.
+  * Only the accumulation without a priori solution is stored (first iteration of VCE). */
+  void setCheckpoint(const FileName &fileName, Double interval);
+
   /** @name Status
   * @brief The following functions changes the state of this class.
   * Optimal performance is only given if the functions are called in a specific state.
@@ -151,20 +165,45 @@ public:
   void write(const FileName &name);
 
   /** @brief Solve the system of normal equations.
+  * With @p mixedPrecision the Cholesky decomposition is computed in single precision
+  * with iterative refinement of the solution (see MatrixDistributed::solve).
   * Change of state of this class: (NORMAL -> CHOLESKY).
   * @return Solution vector as columns of the matrix. */
-  Matrix solve();
+  Matrix solve(Bool mixedPrecision=FALSE);
+
+  /** @brief Solve the system of normal equations iteratively with preconditioned conjugate gradients.
+  * The normal matrix is not decomposed, only products with the normal matrix are computed (see MatrixDistributed::solveConjugateGradient).
+  * The traces needed for the variance component estimation are estimated stochastically
+  * from the solutions of Monte-Carlo vectors (Hutchinson estimator).
+  * Change of state of this class: (NORMAL -> ITERATIVE).
+  * @param maxIter maximum number of iterations.
+  * @param threshold iteration stops if the residual norm is reduced by this factor.
+  * @return Solution vector as columns of the matrix. */
+  Matrix solveConjugateGradient(UInt maxIter, Double threshold);
 
   /** @brief A posteriori sigma.
-  * Change of state of this class: (CHOLESKY -> CHOLESKY). */
+  * Change of state of this class: (CHOLESKY -> CHOLESKY) or (ITERATIVE -> ITERATIVE). */
   Double aposterioriSigma();
 
   /** @brief Inverse of the combined normal matrix.
   * The posteriori sigma is applied if possible.
-  * Change of state of this class: (CHOLESKY -> CHOLESKYINVERSE).
+  * If the Cholesky factor contains empty blocks, only the inverse at the structure of the factor
+  * is computed (selected inversion, see MatrixDistributed::cholesky2SparseInverse), which avoids the fill-in.
+  * If the full inverse is already computed its diagonal is used.
+  * Change of state of this class: (CHOLESKY -> CHOLESKYINVERSE), (CHOLESKY -> SPARSEINVERSE), or (INVERSE -> INVERSE).
   * @return Accuracy of the solution (Square root of the diagonals of the inverse). */
   Vector sigmaParameter();
 
+  /** @brief Covariance matrix of selected parameters.
+  * Computed from the Cholesky factor \f$ \mathbf{W} \f$ as \f$ \mathbf{Y}^T\mathbf{Y} \f$ with \f$ \mathbf{W}^T\mathbf{Y} = \mathbf{E} \f$,
+  * where the columns of \f$ \mathbf{E} \f$ are the unit vectors of the selected parameters.
+  * The effort increases linearly with the number of selected parameters, the inverse of the full matrix is not needed.
+  * The posteriori sigma is applied if possible.
+  * Change of state of this class: (CHOLESKY -> CHOLESKY).
+  * @param index of the selected parameters (NULLINDEX: row/column of zeros).
+  * @return covariance matrix (valid at master). */
+  Matrix covarianceParameter(const std::vector<UInt> &index);
+
   /** @brief Write variance/covariance matrix.
   * Change of state of this class: (CHOLESKYINVERSE -> INVERSE). */
   void writeCovariance(const FileName &name);
@@ -211,10 +250,12 @@ protected:
   virtual UInt   parameterCount()     const = 0;
   virtual void   parameterNames(std::vector<ParameterName> &name) const = 0;
   virtual void   init(MatrixDistributed &normals, UInt rhsCount) = 0;
-  virtual Bool   addNormalEquation(UInt rightHandSide, const const_MatrixSlice &x, const const_MatrixSlice &Wz,
+  // Monte-Carlo trace estimation: trace(N_k*N^-1) = E[Wz'*N_k*Wz2]
+  virtual Bool   addNormalEquation(UInt rightHandSide, const const_MatrixSlice &x, const const_MatrixSlice &Wz, const const_MatrixSlice &Wz2,
                                    MatrixDistributed &normals, Matrix &n, Vector &lPl, UInt &obsCount) = 0;
   virtual Vector contribution(MatrixDistributed &Cov) = 0;
   virtual std::vector<Double> varianceComponentFactors() const = 0;
+  virtual void   setCheckpoint(const FileName &/*fileName*/, Double /*interval*/) {}
 
   friend class NormalEquation;
 };
@@ -16,10 +16,14 @@
 #include "base/import.h"
 #include "config/config.h"
 #include "parallel/parallel.h"
+#include "inputOutput/fileArchive.h"
+#include "inputOutput/system.h"
 #include "files/fileArcList.h"
+#include "files/fileNormalEquation.h"
 #include "classes/observation/observation.h"
 #include "classes/normalEquation/normalEquation.h"
 #include "classes/normalEquation/normalEquationDesign.h"
+#include <chrono>
 
 /***********************************************/
 
@@ -35,6 +39,7 @@ NormalEquationDesign::NormalEquationDesign(Config &config)
     readConfig(config, "aprioriSigma",     sigma2,          Config::DEFAULT,  "1.0", "");
     readConfig(config, "startIndex",       startIndex,      Config::DEFAULT,  "0",   "add this normals at index of total matrix (counting from 0)");
     readConfig(config, "inputfileArcList", fileNameArcList, Config::OPTIONAL, "",    "to accelerate computation");
+    readConfig(config, "rowsPerBlock",     rowsPerBlock,    Config::DEFAULT,  "0",   "compute arcs in blocks of observation equations to reduce memory (0: whole arc)");
     if(isCreateSchema(config)) return;
 
 
@@ -47,6 +52,7 @@ NormalEquationDesign::NormalEquationDesign(Config &config)
 
     sigma2   *= sigma2;
     sigma2New = sigma2;
+    checkpointInterval = 0;
   }
   catch(std::exception &e)
   {
@@ -90,11 +96,12 @@ void NormalEquationDesign::init(MatrixDistributed &/*normals*/, UInt rhsCount)
 
 /***********************************************/
 
-Bool NormalEquationDesign::addNormalEquation(UInt rhsNo, const const_MatrixSlice &x, const const_MatrixSlice &Wz,
+Bool NormalEquationDesign::addNormalEquation(UInt rhsNo, const const_MatrixSlice &x, const const_MatrixSlice &Wz, const const_MatrixSlice &Wz2,
                                              MatrixDistributed &normals, Matrix &n, Vector &lPl, UInt &obsCount)
 {
   try
   {
+    GROOPS_PROFILE("NormalEquationDesign::addNormalEquation")
     if(!observation->parameterCount())
       return TRUE;
 
@@ -104,6 +111,7 @@ Bool NormalEquationDesign::addNormalEquation(UInt rhsNo, const const_MatrixSlice
     for(UInt i=blockStart; i<=blockEnd; i++)
       for(UInt k=i; k<=blockEnd; k++)
       {
+        GROOPS_MEMORY_CATEGORY("normals blocks")
         normals.setBlock(i, k);
         normals.N(i,k) = (i==k) ? Matrix(normals.blockSize(i), Matrix::SYMMETRIC) : Matrix(normals.blockSize(i), normals.blockSize(k));
       }
@@ -116,60 +124,211 @@ Bool NormalEquationDesign::addNormalEquation(UInt rhsNo, const const_MatrixSlice
     Double      redundancy = 0;
     MatrixSlice x0(x.slice(startIndex, rhsNo, observation->parameterCount(), 1));
     MatrixSlice Wz0(Wz.row(startIndex, observation->parameterCount()));
+    MatrixSlice Wz20(Wz2.row(startIndex, observation->parameterCount()));
+    MatrixSlice n0(n.row(startIndex, observation->parameterCount()));
 
-    logStatus<<"accumulate normals from observation equations"<<Log::endl;
-    Parallel::forEachInterval(observation->arcCount(), intervals, [&](UInt arcNo)
+    // if equations are orthogonal transformed
+    // additional residuals appended to l
+    auto splitResiduals = [](Matrix &l, const Matrix &A)
     {
-      // observation equations
-      Matrix l, A, B;
-      observation->observation(arcNo, l, A, B);
-      if(l.rows()==0)
-        return;
-
-      // if equations are orthogonal transformed
-      // additional residuals appended to l
       Matrix l2;
       if(l.rows()>A.rows())
       {
         l2 = l.row(A.rows(), l.rows()-A.rows());
         l  = l.row(0, A.rows());
       }
+      return l2;
+    };
 
-      // eliminate arc related parameters
-      if(B.size())
-        eliminationParameter(B,A,l);
-
+    // accumulate (decorrelated) observation equations without arc related parameters
+    auto accumulate = [&](const Matrix &l, const Matrix &l2, const Matrix &A)
+    {
+      GROOPS_PROFILE("accumulate")
       // right hand side
       // ---------------
-      matMult(1/sigma2, A.trans(), l, n);
+      matMult(1/sigma2, A.trans(), l, n0);
       for(UInt i=0; i<l.columns(); i++)
         lPl(i) += quadsum(l.column(i)) + quadsum(l2.column(i))/sigma2;
       obsCount   += l.rows() + l2.rows();
       ePe        += (quadsum(l.column(rhsNo) - A*x0) + quadsum(l2.column(rhsNo)))/sigma2;
-      redundancy += l.rows() - quadsum(A*Wz0)/sigma2;
+      redundancy += l.rows() - inner(A*Wz0, A*Wz20)/sigma2;
 
       // accumulate normals
       // ------------------
+      normals.rankKUpdate(1/sigma2, A, startIndex);
+    };
+
+    // accumulate observation equations of one arc
+    auto computeArc = [&](UInt arcNo)
+    {
+      GROOPS_MEMORY_CATEGORY("design matrix")
+      if(!rowsPerBlock)
+      {
+        // observation equations
+        Matrix l, A, B;
+        {
+          GROOPS_PROFILE("observation")
+          observation->observation(arcNo, l, A, B);
+        }
+        if(l.rows()==0)
+          return;
+
+        Matrix l2 = splitResiduals(l, A);
+
+        // eliminate arc related parameters
+        if(B.size())
+        {
+          GROOPS_PROFILE("eliminationParameter")
+          eliminationParameter(B,A,l);
+        }
+
+        accumulate(l, l2, A);
+        return;
+      }
+
+      // observation equations in blocks of rows
+      // arc related parameters are eliminated afterwards with the accumulated
+      // B^T B, B^T A, and B^T l: N -= A^T B (B^T B)^-1 B^T A
+      Matrix BtB, BtA, Btl;
+      observation->observationBlocks(arcNo, rowsPerBlock, [&](Matrix &l, Matrix &A, Matrix &B)
+      {
+        if(l.rows()==0)
+          return;
+        Matrix l2 = splitResiduals(l, A);
+        if(B.size())
+        {
+          if(!BtB.size())
+          {
+            BtB = Matrix(B.columns(), Matrix::SYMMETRIC);
+            BtA = Matrix(B.columns(), A.columns());
+            Btl = Matrix(B.columns(), l.columns());
+          }
+          rankKUpdate(1., B, BtB);
+          matMult(1., B.trans(), A, BtA);
+          matMult(1., B.trans(), l, Btl);
+        }
+        accumulate(l, l2, A);
+      });
+
+      if(BtB.size())
+      {
+        cholesky(BtB);
+        triangularSolve(1., BtB.trans(), BtA);
+        triangularSolve(1., BtB.trans(), Btl);
+        normals.rankKUpdate(-1/sigma2, BtA, startIndex);
+        matMult(-1/sigma2, BtA.trans(), Btl, n0);
+        for(UInt i=0; i<Btl.columns(); i++)
+          lPl(i) -= quadsum(Btl.column(i));
+        obsCount   -= BtB.rows();
+        ePe        -= quadsum(Btl.column(rhsNo) - BtA*x0)/sigma2;
+        redundancy -= BtB.rows() - inner(BtA*Wz0, BtA*Wz20)/sigma2;
+      }
+    };
+
+    // restore partially accumulated normals of an interrupted run
+    // -----------------------------------------------------------
+    // only the contribution of this component is stored
+    const Bool   checkpoint = !fileNameCheckpoint.empty() && (quadsum(x0) == 0);
+    const Matrix nStart     = n0;
+    const Vector lPlStart   = lPl;
+    std::vector<UInt> arcsProcessed; // at this process
+    Vector            arcsSkipped;   // at all processes
+    FileName          fileNameRank;
+    if(checkpoint)
+    {
+      const UInt processCount = Parallel::size(normals.communicator());
+      fileNameRank = fileNameCheckpoint.appendBaseName(".process"+Parallel::myRank(normals.communicator())%"%04i"s);
+      if(System::exists(fileNameRank))
+      {
+        UInt   processCountOld, arcCountOld, parameterCountOld;
+        Double sigma2Old;
+        std::vector<Matrix> blocks;
+        Matrix nOld;
+        Vector lPlOld;
+        UInt   obsCountOld;
+        InFileArchive file(fileNameRank, FILE_NORMALEQUATION_TYPE);
+        file>>nameValue("processCount",   processCountOld);
+        file>>nameValue("arcCount",       arcCountOld);
+        file>>nameValue("parameterCount", parameterCountOld);
+        file>>nameValue("sigma2",         sigma2Old);
+        if((processCountOld != processCount) || (arcCountOld != observation->arcCount()) ||
+           (parameterCountOld != observation->parameterCount()) || (sigma2Old != sigma2))
+          throw(Exception("checkpoint <"+fileNameRank.str()+"> does not match (process count, arcs, parameters, or sigma), remove it to start again"));
+        file>>nameValue("arcs",             arcsProcessed);
+        file>>nameValue("observationCount", obsCountOld);
+        file>>nameValue("lPl",              lPlOld);
+        file>>nameValue("rightHandSide",    nOld);
+        file>>nameValue("normals",          blocks);
+
+        UInt idx = 0;
+        for(UInt i=blockStart; i<=blockEnd; i++)
+          for(UInt k=i; k<=blockEnd; k++)
+            axpy(1., blocks.at(idx++), normals.N(i,k));
+        axpy(1., nOld, n0);
+        axpy(1., lPlOld, lPl);
+        obsCount += obsCountOld;
+      }
+
+      arcsSkipped = Vector(observation->arcCount());
+      for(UInt arcNo : arcsProcessed)
+        arcsSkipped(arcNo) = 1;
+      Parallel::reduceSum(arcsSkipped, 0, normals.communicator());
+      Parallel::broadCast(arcsSkipped, 0, normals.communicator());
+      if(sum(arcsSkipped))
+        logInfo<<"  restored "<<static_cast<UInt>(sum(arcsSkipped))<<" of "<<observation->arcCount()<<" arcs from checkpoint <"<<fileNameCheckpoint<<">"<<Log::endl;
+    }
+
+    // write to temporary file first: an interrupted write must not destroy the previous checkpoint
+    auto writeCheckpoint = [&]()
+    {
+      GROOPS_PROFILE("checkpoint")
+      std::vector<Matrix> blocks;
       for(UInt i=blockStart; i<=blockEnd; i++)
+        for(UInt k=i; k<=blockEnd; k++)
+          blocks.push_back(normals.N(i,k));
+      const FileName fileNameTmp = fileNameRank.appendBaseName(".tmp");
+      {
+        OutFileArchive file(fileNameTmp, FILE_NORMALEQUATION_TYPE);
+        file<<nameValue("processCount",     Parallel::size(normals.communicator()));
+        file<<nameValue("arcCount",         observation->arcCount());
+        file<<nameValue("parameterCount",   observation->parameterCount());
+        file<<nameValue("sigma2",           sigma2);
+        file<<nameValue("arcs",             arcsProcessed);
+        file<<nameValue("observationCount", obsCount);
+        file<<nameValue("lPl",              Vector(lPl-lPlStart));
+        file<<nameValue("rightHandSide",    Matrix(n0-nStart));
+        file<<nameValue("normals",          blocks);
+      }
+      if(std::rename(fileNameTmp.c_str(), fileNameRank.c_str()) != 0)
+        throw(Exception("cannot rename <"+fileNameTmp.str()+"> to <"+fileNameRank.str()+">"));
+    };
+
+    logStatus<<"accumulate normals from observation equations"<<Log::endl;
+    auto timeCheckpoint = std::chrono::steady_clock::now();
+    Parallel::forEachInterval(observation->arcCount(), intervals, [&](UInt arcNo)
+    {
+      if(checkpoint)
       {
-        const UInt idxN1 = (normals.blockIndex(i) < startIndex) ? (startIndex-normals.blockIndex(i)) : 0;
-        const UInt idxA1 = (normals.blockIndex(i) < startIndex) ? 0 : (normals.blockIndex(i)-startIndex);
-        const UInt cols1 = std::min(normals.blockSize(i)-idxN1, A.columns()-idxA1);
-        rankKUpdate(1/sigma2, A.column(idxA1, cols1), normals.N(i,i).slice(idxN1, idxN1, cols1, cols1));
-        for(UInt k=i+1; k<=blockEnd; k++)
+        if(arcsSkipped(arcNo))
+          return;
+        computeArc(arcNo);
+        arcsProcessed.push_back(arcNo);
+        if(std::chrono::duration<Double>(std::chrono::steady_clock::now()-timeCheckpoint).count() > checkpointInterval)
         {
-          const UInt idxN2 = (normals.blockIndex(k) < startIndex) ? (startIndex-normals.blockIndex(k)) : 0;
-          const UInt idxA2 = (normals.blockIndex(k) < startIndex) ? 0 : (normals.blockIndex(k)-startIndex);
-          const UInt cols2 = std::min(normals.blockSize(k)-idxN1, A.columns()-idxA1);
-          matMult(1/sigma2, A.column(idxA1, cols1).trans(), A.column(idxA2, cols2), normals.N(i,k).slice(idxN1, idxN2, cols1, cols2));
+          writeCheckpoint();
+          timeCheckpoint = std::chrono::steady_clock::now();
         }
+        return;
       }
+      computeArc(arcNo);
     }, normals.communicator());
 
     normals.reduceSum(FALSE);
     Parallel::reduceSum(n,        0, normals.communicator());
     Parallel::reduceSum(lPl,      0, normals.communicator());
     Parallel::reduceSum(obsCount, 0, normals.communicator());
+    if(checkpoint)
+      System::remove(fileNameRank);
 
     UInt ready = 0;
     if(quadsum(x0) > 0)
@@ -196,6 +355,7 @@ Vector NormalEquationDesign::contribution(MatrixDistributed &Cov)
 {
   try
   {
+    GROOPS_PROFILE("NormalEquationDesign::contribution")
     logWarningOnce<<"In NormalEquationDesign: contribution is not implemented"<<Log::endl;
     return Vector(Cov.dimension());
   }
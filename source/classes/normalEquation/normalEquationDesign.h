@@ -33,6 +33,10 @@ equations is acculumated according to
  \qquad\text{and}\qquad
 \M n = \sum_{i=1}^m \M A_i^T \M l_i.
 \end{equation}
+To reduce the memory requirements for long arcs the observation equations can be computed in blocks
+of at most \config{rowsPerBlock} rows, if supported by the \configClass{observation}{observationType}
+(e.g. \configClass{gradiometer}{observationType:gradiometer} without covariance).
+The arc depending parameters are then eliminated by the accumulated sums of the blocks.
 )";
 #endif
 
@@ -51,9 +55,12 @@ equations is acculumated according to
 class NormalEquationDesign : public NormalEquationBase
 {
   UInt              startIndex;
+  UInt              rowsPerBlock;
   std::vector<UInt> intervals;
   ObservationPtr    observation;
   Double            sigma2, sigma2New;
+  FileName          fileNameCheckpoint;
+  Double            checkpointInterval;
 
 public:
   NormalEquationDesign(Config &config);
@@ -62,10 +69,11 @@ public:
   UInt   parameterCount()     const override {return observation->parameterCount() + startIndex;}
   void   parameterNames(std::vector<ParameterName> &names) const override;
   void   init(MatrixDistributed &normals, UInt rhsCount) override;
-  Bool   addNormalEquation(UInt rhsNo, const const_MatrixSlice &x, const const_MatrixSlice &Wz,
+  Bool   addNormalEquation(UInt rhsNo, const const_MatrixSlice &x, const const_MatrixSlice &Wz, const const_MatrixSlice &Wz2,
                            MatrixDistributed &normals, Matrix &n, Vector &lPl, UInt &obsCount) override;
   Vector contribution(MatrixDistributed &Cov) override;
   std::vector<Double> varianceComponentFactors() const override {return std::vector<Double>({sigma2});}
+  void   setCheckpoint(const FileName &fileName, Double interval) override {fileNameCheckpoint = fileName; checkpointInterval = interval;}
 };
 
 /***********************************************/
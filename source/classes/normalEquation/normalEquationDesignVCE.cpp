@@ -89,7 +89,7 @@ void NormalEquationDesignVCE::init(MatrixDistributed &/*normals*/, UInt rhsCount
 
 /***********************************************/
 
-Bool NormalEquationDesignVCE::addNormalEquation(UInt rhsNo, const const_MatrixSlice &x, const const_MatrixSlice &Wz,
+Bool NormalEquationDesignVCE::addNormalEquation(UInt rhsNo, const const_MatrixSlice &x, const const_MatrixSlice &Wz, const const_MatrixSlice &Wz2,
                                                 MatrixDistributed &normals, Matrix &n, Vector &lPl, UInt &obsCount)
 {
   try
@@ -102,6 +102,7 @@ Bool NormalEquationDesignVCE::addNormalEquation(UInt rhsNo, const const_MatrixSl
     for(UInt i=blockStart; i<=blockEnd; i++)
       for(UInt k=i; k<=blockEnd; k++)
       {
+        GROOPS_MEMORY_CATEGORY("normals blocks")
         normals.setBlock(i, k);
         normals.N(i,k) = (i==k) ? Matrix(normals.blockSize(i), Matrix::SYMMETRIC) : Matrix(normals.blockSize(i), normals.blockSize(k));
       }
@@ -110,7 +111,8 @@ Bool NormalEquationDesignVCE::addNormalEquation(UInt rhsNo, const const_MatrixSl
     // -----------------------------
     logStatus<<"accumulate normals from observation equations"<<Log::endl;
     Vector x0  = x.slice(startIndex, rhsNo, observation->parameterCount(), 1);
-    Matrix Wz0 = Wz.row(startIndex, observation->parameterCount());
+    Matrix Wz0  = Wz.row(startIndex, observation->parameterCount());
+    Matrix Wz20 = Wz2.row(startIndex, observation->parameterCount());
 
     Parallel::forEachInterval(sigma2, intervals, [&](UInt arcNo) -> Double
     {
@@ -136,7 +138,7 @@ Bool NormalEquationDesignVCE::addNormalEquation(UInt rhsNo, const const_MatrixSl
       // Partial redundancy
       // trace(A'A*N^(-1)) = trace(A'A*W^(-1)*W^(-T))
       //                   = z'*W^(-1)*A'*A*W^(-T)*z (MonteCarlo trace estimation)
-      const Double r      = l.rows() + l2.rows() - quadsum(A*Wz0)/sigma2.at(arcNo);
+      const Double r      = l.rows() + l2.rows() - inner(A*Wz0, A*Wz20)/sigma2.at(arcNo);
       const Double sigma2 = (quadsum(l.column(rhsNo)-A*x0) + quadsum(l2.column(rhsNo)))/r;
 
       // right hand side
@@ -148,20 +150,7 @@ Bool NormalEquationDesignVCE::addNormalEquation(UInt rhsNo, const const_MatrixSl
 
       // accumulate normals
       // ------------------
-      for(UInt i=blockStart; i<=blockEnd; i++)
-      {
-        const UInt idxN1 = (normals.blockIndex(i) < startIndex) ? (startIndex-normals.blockIndex(i)) : 0;
-        const UInt idxA1 = (normals.blockIndex(i) < startIndex) ? 0 : (normals.blockIndex(i)-startIndex);
-        const UInt cols1 = std::min(normals.blockSize(i)-idxN1, A.columns()-idxA1);
-        rankKUpdate(1/sigma2, A.column(idxA1, cols1), normals.N(i,i).slice(idxN1, idxN1, cols1, cols1));
-        for(UInt k=i+1; k<=blockEnd; k++)
-        {
-          const UInt idxN2 = (normals.blockIndex(k) < startIndex) ? (startIndex-normals.blockIndex(k)) : 0;
-          const UInt idxA2 = (normals.blockIndex(k) < startIndex) ? 0 : (normals.blockIndex(k)-startIndex);
-          const UInt cols2 = std::min(normals.blockSize(k)-idxN1, A.columns()-idxA1);
-          matMult(1/sigma2, A.column(idxA1, cols1).trans(), A.column(idxA2, cols2), normals.N(i,k).slice(idxN1, idxN2, cols1, cols2));
-        }
-      }
+      normals.rankKUpdate(1/sigma2, A, startIndex);
 
       return sigma2;
     }, normals.communicator());
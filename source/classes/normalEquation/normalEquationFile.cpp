@@ -102,7 +102,7 @@ void NormalEquationFile::init(MatrixDistributed &normalsTotal, UInt rhsCount)
 
 /***********************************************/
 
-Bool NormalEquationFile::addNormalEquation(UInt rhsNo, const const_MatrixSlice &x, const const_MatrixSlice &Wz,
+Bool NormalEquationFile::addNormalEquation(UInt rhsNo, const const_MatrixSlice &x, const const_MatrixSlice &Wz, const const_MatrixSlice &Wz2,
                                            MatrixDistributed &normalsTotal, Matrix &nTotal, Vector &lPlTotal, UInt &obsCountTotal)
 {
   try
@@ -132,7 +132,7 @@ Bool NormalEquationFile::addNormalEquation(UInt rhsNo, const const_MatrixSlice &
         // aposteriori sigma
         const Double sigma2Old = sigma2;
         const Double ePe = inner(vx, Nvx) - 2*inner(vx, n.column(rhsNo)) + lPl(rhsNo);
-        const Double r   = obsCount - inner(Wz, NWz)/sigma2;
+        const Double r   = obsCount - inner(Wz2, NWz)/sigma2;
         sigma2 = ePe/r;
         ready  = (std::fabs(std::sqrt(sigma2)-std::sqrt(sigma2Old))/std::sqrt(sigma2) < 0.01);
       }
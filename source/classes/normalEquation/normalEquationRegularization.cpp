@@ -105,7 +105,7 @@ void NormalEquationRegularization::init(MatrixDistributed &normals, UInt rhsCoun
 
 /***********************************************/
 
-Bool NormalEquationRegularization::addNormalEquation(UInt rhsNo, const const_MatrixSlice &x, const const_MatrixSlice &Wz,
+Bool NormalEquationRegularization::addNormalEquation(UInt rhsNo, const const_MatrixSlice &x, const const_MatrixSlice &Wz, const const_MatrixSlice &Wz2,
                                                      MatrixDistributed &normals, Matrix &n, Vector &lPl, UInt &obsCount)
 {
   try
@@ -123,7 +123,7 @@ Bool NormalEquationRegularization::addNormalEquation(UInt rhsNo, const const_Mat
         // redundancy (monte carlo estimation)
         Double r = static_cast<Double>(this->obsCount);
         for(UInt i=0; i<paraCount; i++)
-          r -= 1/sigma2 * K(i) * quadsum(Wz.row(i+startIndex)); // = z'W'KWz
+          r -= 1/sigma2 * K(i) * inner(Wz.row(i+startIndex), Wz2.row(i+startIndex)); // = z'W'KWz
         // aposteriori sigma
         const Double sigma2Old = sigma2;
         sigma2 = ePe/r;
@@ -120,7 +120,7 @@ void NormalEquationRegularizationGeneralized::init(MatrixDistributed &normals, U
 
 /***********************************************/
 
-Bool NormalEquationRegularizationGeneralized::addNormalEquation(UInt rhsNo, const const_MatrixSlice &x, const const_MatrixSlice &Wz,
+Bool NormalEquationRegularizationGeneralized::addNormalEquation(UInt rhsNo, const const_MatrixSlice &x, const const_MatrixSlice &Wz, const const_MatrixSlice &Wz2,
                                                                 MatrixDistributed &normals, Matrix &n, Vector &lPl, UInt &obsCount)
 {
   try
@@ -146,14 +146,16 @@ Bool NormalEquationRegularizationGeneralized::addNormalEquation(UInt rhsNo, cons
     if(quadsum(x.slice(startIndex, rhsNo, paraCount, 1)) > 0.) // estimate sigmas
     {
       Matrix Se  = symMatMult(Sigma, bias.column(rhsNo) - x.slice(startIndex, rhsNo, paraCount, 1));
-      Matrix SWz = symMatMult(Sigma, Wz.row(startIndex, paraCount));
-      Parallel::broadCast(Se,  0, normals.communicator());
-      Parallel::broadCast(SWz, 0, normals.communicator());
+      Matrix SWz  = symMatMult(Sigma, Wz.row(startIndex, paraCount));
+      Matrix SWz2 = symMatMult(Sigma, Wz2.row(startIndex, paraCount));
+      Parallel::broadCast(Se,   0, normals.communicator());
+      Parallel::broadCast(SWz,  0, normals.communicator());
+      Parallel::broadCast(SWz2, 0, normals.communicator());
 
       for(UInt j=0; j<V.size(); j++)
       {
         Matrix VSe  = symMatMult(V.at(j), Se);
-        Matrix VSWz = symMatMult(V.at(j), SWz);
+        Matrix VSWz = symMatMult(V.at(j), SWz2);
 
         // trace(V*Sigma^-1)
         Double r = 0;
@@ -64,7 +64,7 @@ public:
   UInt   parameterCount()     const override {return paraCount + startIndex;}
   void   parameterNames(std::vector<ParameterName> &/*names*/) const override {}
   void   init(MatrixDistributed &normals, UInt rhsCount) override;
-  Bool   addNormalEquation(UInt rhsNo, const const_MatrixSlice &x, const const_MatrixSlice &Wz,
+  Bool   addNormalEquation(UInt rhsNo, const const_MatrixSlice &x, const const_MatrixSlice &Wz, const const_MatrixSlice &Wz2,
                            MatrixDistributed &normals, Matrix &n, Vector &lPl, UInt &obsCount) override;
   Vector contribution(MatrixDistributed &Cov) override;
   std::vector<Double> varianceComponentFactors() const override {return sigma2;}
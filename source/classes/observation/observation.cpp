@@ -94,3 +94,19 @@ ObservationPtr Observation::create(Config &config, const std::string &name)
 }
 
 /***********************************************/
+
+void Observation::observationBlocks(UInt arcNo, UInt /*rowsPerBlock*/, const std::function<void(Matrix &l, Matrix &A, Matrix &B)> &block)
+{
+  try
+  {
+    Matrix l, A, B;
+    observation(arcNo, l, A, B);
+    block(l, A, B);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
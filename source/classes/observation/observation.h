@@ -117,6 +117,17 @@ public:
   * @param[out] B Design matrix for arc related parameters. */
   virtual void observation(UInt arcNo, Matrix &l, Matrix &A, Matrix &B) = 0;
 
+  /** @brief Observation equations for an Arc in blocks of rows.
+  * Calls @a block(l, A, B) for consecutive row blocks of the arc, so that the design matrix of the whole arc
+  * must not be kept in memory. The blocks are uncorrelated parts of the equations given by @a observation(),
+  * the design matrices @a B of all blocks refer to the same arc related parameters.
+  * Observations which cannot be split (e.g. decorrelated with a full covariance matrix of the arc)
+  * give the whole arc as one block (default implementation).
+  * @param arcNo Index of the arc to be computed [0, arcCount)
+  * @param rowsPerBlock maximum number of rows of a block (approximately)
+  * @param block called for each block with observation vector @a l and design matrices @a A, @a B. */
+  virtual void observationBlocks(UInt arcNo, UInt rowsPerBlock, const std::function<void(Matrix &l, Matrix &A, Matrix &B)> &block);
+
   /** @brief creates an derived instance of this class. */
   static ObservationPtr create(Config &config, const std::string &name);
 };
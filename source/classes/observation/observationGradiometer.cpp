@@ -103,21 +103,19 @@ ObservationGradiometer::ObservationGradiometer(Config &config)
 
 /************************************************************************/
 
-void ObservationGradiometer::observation(UInt arcNo, Matrix &l, Matrix &A, Matrix &B)
+void ObservationGradiometer::observationEquations(UInt arcNo, OrbitArc &orbit, std::vector<Rotary3d> &rotEarth, Matrix &l, Matrix &rotGRF, Matrix &B)
 {
   try
   {
-    OrbitArc      orbit      = orbitFile.readArc(arcNo);
-    StarCameraArc starCamera = starCameraFile.readArc(arcNo);
+    orbit = orbitFile.readArcShared(arcNo);
+    StarCameraArc starCamera = starCameraFile.readArcShared(arcNo);
     const UInt    epochCount = orbit.size();
     const UInt    rhsCount   = rhs.size();
     Arc::checkSynchronized({orbit, starCamera});
 
     // earth rotation
     // --------------
-    std::vector<Rotary3d> rotEarth(epochCount);
-    for(UInt i=0; i<epochCount; i++)
-      rotEarth.at(i) = earthRotation->rotaryMatrix(orbit.at(i).time);
+    rotEarth = earthRotation->rotaryMatrix(orbit.times());
 
     // reduced observations
     // ---------------------
@@ -160,11 +158,12 @@ void ObservationGradiometer::observation(UInt arcNo, Matrix &l, Matrix &A, Matri
 
     // rotary matrix from TRF to satellite system
     // ------------------------------------------
-    Matrix rotGRF(componentCount*epochCount, 5*epochCount);
+    // (componentCount x 5) block for each epoch
+    rotGRF = Matrix(componentCount*epochCount, 5);
     for(UInt i=0; i<epochCount; i++)
     {
       Matrix rot = inverse(rotEarth.at(i) * starCamera.at(i).rotary).matrix();
-      MatrixSlice R(rotGRF.slice(componentCount*i, 5*i, componentCount,5));
+      MatrixSlice R(rotGRF.row(componentCount*i, componentCount));
 
       // One row of the rotary matrix for one gradiometer component (e.g. Txy: i=0, k=1)
       auto rotationLine = [&](UInt i, UInt k, UInt row)
@@ -210,28 +209,124 @@ void ObservationGradiometer::observation(UInt arcNo, Matrix &l, Matrix &A, Matri
       if(B.size())
         B *= factor;
     }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
 
-    // decorrelation
-    // -------------
-    if(CovCholesky.size())
+/************************************************************************/
+
+void ObservationGradiometer::designMatrix(const OrbitArc &orbit, const std::vector<Rotary3d> &rotEarth, const_MatrixSliceRef rotGRF,
+                                          UInt epochStart, UInt epochCount, MatrixSliceRef A) const
+{
+  try
+  {
+    std::vector<Time>     times(epochCount);
+    std::vector<Vector3d> points(epochCount);
+    for(UInt i=0; i<epochCount; i++)
     {
-      if(CovCholesky.rows()<l.rows())
-        throw(Exception("covariance matrix to small"));
-      const_MatrixSlice W(CovCholesky.slice(0,0,l.rows(),l.rows()).trans());
-      triangularSolve(1., W, rotGRF);
-      triangularSolve(1., W, l);
-      if(B.size())
-        triangularSolve(1.,W, B);
+      times.at(i)  = orbit.at(epochStart+i).time;
+      points.at(i) = rotEarth.at(epochStart+i).rotate(orbit.at(epochStart+i).position);
     }
 
+    Matrix tns(6*epochCount, parametrization->parameterCount());
+    parametrization->gravityGradient(times, points, tns);
+    for(UInt i=0; i<epochCount; i++)
+      matMult(1., rotGRF.row(componentCount*(epochStart+i), componentCount), tns.row(6*i, 5), A.slice(componentCount*i, 0, componentCount, tns.columns()));
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/************************************************************************/
+
+void ObservationGradiometer::observation(UInt arcNo, Matrix &l, Matrix &A, Matrix &B)
+{
+  try
+  {
+    OrbitArc              orbit;
+    std::vector<Rotary3d> rotEarth;
+    Matrix                rotGRF;
+    observationEquations(arcNo, orbit, rotEarth, l, rotGRF, B);
+    const UInt epochCount = orbit.size();
+
     // Design matrix A
     // ---------------
     A = Matrix(componentCount*epochCount, parameterCount());
-    Matrix tns(6, parametrization->parameterCount());
+    if(!CovCholesky.size())
+    {
+      designMatrix(orbit, rotEarth, rotGRF, 0, epochCount, A);
+      return;
+    }
+
+    // decorrelation
+    // -------------
+    if(CovCholesky.rows()<l.rows())
+      throw(Exception("covariance matrix to small"));
+    const_MatrixSlice W(CovCholesky.slice(0,0,l.rows(),l.rows()).trans());
+    Matrix rotGRFFull(componentCount*epochCount, 5*epochCount);
     for(UInt i=0; i<epochCount; i++)
+      copy(rotGRF.row(componentCount*i, componentCount), rotGRFFull.slice(componentCount*i, 5*i, componentCount, 5));
+    triangularSolve(1., W, rotGRFFull);
+    triangularSolve(1., W, l);
+    if(B.size())
+      triangularSolve(1.,W, B);
+
+    // gravity gradients for blocks of epochs, the decorrelated rotations
+    // of a block are applied in one matrix product (rows before the block are zero)
+    constexpr UInt epochsPerBlock = 32;
+    for(UInt epochStart=0; epochStart<epochCount; epochStart+=epochsPerBlock)
+    {
+      const UInt count = std::min(epochsPerBlock, epochCount-epochStart);
+      std::vector<Time>     times(count);
+      std::vector<Vector3d> points(count);
+      for(UInt i=0; i<count; i++)
+      {
+        times.at(i)  = orbit.at(epochStart+i).time;
+        points.at(i) = rotEarth.at(epochStart+i).rotate(orbit.at(epochStart+i).position);
+      }
+      Matrix tns(6*count, parametrization->parameterCount());
+      parametrization->gravityGradient(times, points, tns);
+      Matrix tns5(5*count, tns.columns()); // without zz (trace free)
+      for(UInt i=0; i<count; i++)
+        copy(tns.row(6*i, 5), tns5.row(5*i, 5));
+      const UInt row = componentCount*epochStart;
+      matMult(1., rotGRFFull.slice(row, 5*epochStart, rotGRFFull.rows()-row, 5*count), tns5, A.slice(row, 0, A.rows()-row, tns.columns()));
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void ObservationGradiometer::observationBlocks(UInt arcNo, UInt rowsPerBlock, const std::function<void(Matrix &l, Matrix &A, Matrix &B)> &block)
+{
+  try
+  {
+    if(CovCholesky.size()) // decorrelated arc cannot be split
+      return Observation::observationBlocks(arcNo, rowsPerBlock, block);
+
+    OrbitArc              orbit;
+    std::vector<Rotary3d> rotEarth;
+    Matrix                l, rotGRF, B;
+    observationEquations(arcNo, orbit, rotEarth, l, rotGRF, B);
+
+    const UInt epochsPerBlock = std::max(rowsPerBlock/componentCount, UInt(1));
+    for(UInt epochStart=0; epochStart<orbit.size(); epochStart+=epochsPerBlock)
     {
-      parametrization->gravityGradient(orbit.at(i).time, rotEarth.at(i).rotate(orbit.at(i).position), tns);
-      matMult(1., rotGRF.column(5*i,5), tns.row(0,5), A.column(0,tns.columns()));
+      const UInt epochCount = std::min(epochsPerBlock, orbit.size()-epochStart);
+      Matrix lBlock = l.row(componentCount*epochStart, componentCount*epochCount);
+      Matrix BBlock = B.size() ? Matrix(B.row(componentCount*epochStart, componentCount*epochCount)) : Matrix();
+      Matrix ABlock(componentCount*epochCount, parameterCount());
+      designMatrix(orbit, rotEarth, rotGRF, epochStart, epochCount, ABlock);
+      block(lBlock, ABlock, BBlock);
     }
   }
   catch(std::exception &e)
@@ -76,6 +76,10 @@ class ObservationGradiometer : public Observation
   Vector                       sigmaArc;
   Matrix                       CovCholesky; // cholesky decomposition of the Covariance
 
+  void observationEquations(UInt arcNo, OrbitArc &orbit, std::vector<Rotary3d> &rotEarth, Matrix &l, Matrix &rotGRF, Matrix &B);
+  void designMatrix(const OrbitArc &orbit, const std::vector<Rotary3d> &rotEarth, const_MatrixSliceRef rotGRF,
+                    UInt epochStart, UInt epochCount, MatrixSliceRef A) const;
+
 public:
   ObservationGradiometer(Config &config);
  ~ObservationGradiometer() {}
@@ -88,6 +92,7 @@ public:
   void parameterName(std::vector<ParameterName> &name) const override {parametrization->parameterName(name);}
 
   void observation(UInt arc, Matrix &l, Matrix &A, Matrix &B) override;
+  void observationBlocks(UInt arcNo, UInt rowsPerBlock, const std::function<void(Matrix &l, Matrix &A, Matrix &B)> &block) override;
 };
 
 /***********************************************/
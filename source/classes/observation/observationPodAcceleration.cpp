@@ -135,8 +135,8 @@ void ObservationPodAcceleration::observation(UInt arcNo, Matrix &l, Matrix &A, M
 {
   try
   {
-    OrbitArc      orbit      = orbitFile.readArc(arcNo);
-    StarCameraArc starCamera = starCameraFile.readArc(arcNo);
+    OrbitArc      orbit      = orbitFile.readArcShared(arcNo);
+    StarCameraArc starCamera = starCameraFile.readArcShared(arcNo);
     UInt          rhsCount   = rhs.size();
     UInt          posCount   = orbit.size();
     UInt          obsCount   = posCount-coeff.rows()+1;
@@ -195,8 +195,16 @@ void ObservationPodAcceleration::observation(UInt arcNo, Matrix &l, Matrix &A, M
     A = Matrix(3*obsCount, parametrization->parameterCount() + parametrizationAcceleration->parameterCount());
     B = Matrix(3*obsCount, parametrizationAcceleration->parameterCountArc());
     // gravity
-    for(UInt k=0; k<obsCount; k++)
-      parametrization->gravity(orbit.at(k+half).time, rotEarth.at(k).rotate(orbit.at(k+half).position), A.slice(3*k, 0, 3, parametrization->parameterCount()));
+    {
+      std::vector<Time>     timesGravity(obsCount);
+      std::vector<Vector3d> points(obsCount);
+      for(UInt k=0; k<obsCount; k++)
+      {
+        timesGravity.at(k) = orbit.at(k+half).time;
+        points.at(k)       = rotEarth.at(k).rotate(orbit.at(k+half).position);
+      }
+      parametrization->gravity(timesGravity, points, A.column(0, parametrization->parameterCount()));
+    }
 
     // orbit parameters
     for(UInt k=0; k<obsCount; k++)
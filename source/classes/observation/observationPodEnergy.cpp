@@ -91,8 +91,8 @@ void ObservationPodEnergy::observation(UInt arcNo, Matrix &l, Matrix &A, Matrix
 {
   try
   {
-    OrbitArc      orbit      = orbitFile.readArc(arcNo);
-    StarCameraArc starCamera = starCameraFile.readArc(arcNo);
+    OrbitArc      orbit      = orbitFile.readArcShared(arcNo);
+    StarCameraArc starCamera = starCameraFile.readArcShared(arcNo);
     UInt          rhsCount   = rhs.size();
     UInt          posCount   = orbit.size();
     UInt          obsCount   = posCount-interpolationDegree;
@@ -198,8 +198,16 @@ void ObservationPodEnergy::observation(UInt arcNo, Matrix &l, Matrix &A, Matrix
     // Design matrix A (gravitational potential)
     // -----------------------------------------
     A = Matrix(obsCount, parametrization->parameterCount());
-    for(UInt k=0; k<obsCount; k++)
-      parametrization->potential(orbit.at(k+half).time, rotEarth.at(k).rotate(orbit.at(k+half).position), A.row(k));
+    {
+      std::vector<Time>     timesPotential(obsCount);
+      std::vector<Vector3d> points(obsCount);
+      for(UInt k=0; k<obsCount; k++)
+      {
+        timesPotential.at(k) = orbit.at(k+half).time;
+        points.at(k)         = rotEarth.at(k).rotate(orbit.at(k+half).position);
+      }
+      parametrization->potential(timesPotential, points, A);
+    }
 
     // decorrelation
     // -------------
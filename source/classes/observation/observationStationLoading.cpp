@@ -194,9 +194,9 @@ void ObservationStationLoading::observation(UInt /*arcNo*/, Matrix &l, Matrix &A
     // ---------------
     A = Matrix(3*points.size(), parameterCount());
     B = Matrix();
+    parametrization->deformation(std::vector<Time>(points.size(), time), points, gravity, hn, ln, A.column(0, parametrization->parameterCount()));
     for(UInt i=0; i<points.size(); i++)
     {
-      parametrization->deformation(time, points.at(i), gravity.at(i), hn, ln, A.slice(3*i, 0, 3, parametrization->parameterCount()));
 
       // helmert transformation
       UInt idx = parametrization->parameterCount();
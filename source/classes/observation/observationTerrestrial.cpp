@@ -85,10 +85,13 @@ void ObservationTerrestrial::observation(UInt arcNo, Matrix &l, Matrix &A, Matri
     l = Vector(obsCount);
     A = Matrix(obsCount, parameterCount());
     B = Matrix();
+    std::vector<Vector3d> pointsArc(obsCount);
+    for(UInt obsNo=0; obsNo<obsCount; obsNo++)
+      pointsArc.at(obsNo) = points.at(idx(arcNo, obsNo));
+    parametrization->field(std::vector<Time>(obsCount, time), pointsArc, *kernel, A);
     for(UInt obsNo=0; obsNo<obsCount; obsNo++)
     {
       l(obsNo, 0) = values.at(idx(arcNo, obsNo)) - referencefield->field(time, points.at(idx(arcNo, obsNo)), *kernel);
-      parametrization->field(time, points.at(idx(arcNo, obsNo)), *kernel, A.row(obsNo));
       if(sigmas.at(idx(arcNo, obsNo)) != 1.)
       {
         l.row(obsNo) *= 1/sigmas.at(idx(arcNo, obsNo));
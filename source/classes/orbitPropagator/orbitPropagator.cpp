@@ -17,6 +17,7 @@
 #include "inputOutput/logging.h"
 #include "classes/orbitPropagator/orbitPropagatorEuler.h"
 #include "classes/orbitPropagator/orbitPropagatorRungeKutta4.h"
+#include "classes/orbitPropagator/orbitPropagatorDormandPrince.h"
 #include "classes/orbitPropagator/orbitPropagatorAdamsBashforthMoulton.h"
 #include "classes/orbitPropagator/orbitPropagatorStoermerCowell.h"
 #include "classes/orbitPropagator/orbitPropagatorGaussJackson.h"
@@ -29,6 +30,7 @@
 GROOPS_REGISTER_CLASS(OrbitPropagator, "orbitPropagatorType",
                       OrbitPropagatorEuler,
                       OrbitPropagatorRungeKutta4,
+                      OrbitPropagatorDormandPrince,
                       OrbitPropagatorAdamsBashforthMoulton,
                       OrbitPropagatorStoermerCowell,
                       OrbitPropagatorGaussJackson,
@@ -51,6 +53,8 @@ OrbitPropagatorPtr OrbitPropagator::create(Config &config, const std::string &na
       orbitPropagator = OrbitPropagatorPtr(new OrbitPropagatorEuler(config));
     if (readConfigChoiceElement(config, "rungeKutta4",         choice, "The classical Runge-Kutta 4 method"))
       orbitPropagator = OrbitPropagatorPtr(new OrbitPropagatorRungeKutta4(config));
+    if (readConfigChoiceElement(config, "dormandPrince",       choice, "Dormand-Prince 5(4) method with step size control and dense output"))
+      orbitPropagator = OrbitPropagatorPtr(new OrbitPropagatorDormandPrince(config));
     if (readConfigChoiceElement(config, "adamsBashforthMoulton", choice, "Adams-Bashforth-Moulton class of predictor-corrector method"))
       orbitPropagator = OrbitPropagatorPtr(new OrbitPropagatorAdamsBashforthMoulton(config));
     if (readConfigChoiceElement(config, "stoermerCowell",      choice, "Stoermer-Cowell predictor-corrector method"))
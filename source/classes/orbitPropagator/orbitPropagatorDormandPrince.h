@@ -0,0 +1,288 @@
+/***********************************************/
+/**
+* @file orbitPropagatorDormandPrince.h
+*
+* @brief Propagate a dynamic orbit using the Dormand-Prince method with step size control.
+* @see orbitPropagator
+*
+* @author GROOPS Developers
+* @date 2026-10-14
+*
+*/
+/***********************************************/
+
+#ifndef __GROOPS_ORBITPROPAGATORDORMANDPRINCE__
+#define __GROOPS_ORBITPROPAGATORDORMANDPRINCE__
+
+// Latex documentation
+#ifdef DOCSTRING_OrbitPropagator
+static const char *docstringOrbitPropagatorDormandPrince = R"(
+\subsection{DormandPrince}\label{orbitPropagatorType:DormandPrince}
+This class implements the embedded Runge-Kutta method of Dormand and Prince of order 5(4)
+to propagate a satellite orbit under the influence of \configClass{Forces}{forcesType}.
+The integration step size is adapted automatically so that the estimated local error of
+position and velocity stays below \config{tolerance} (relative to the length of the respective vector).
+The steps are independent of the output \config{sampling}. The output epochs are
+computed by quintic Hermite interpolation between the accepted steps (dense output)
+from positions, velocities and accelerations at the step boundaries.
+Therefore the number of force evaluations depends on the dynamics
+and not on the sampling of the resulting orbit. Output accelerations are interpolated as well.
+
+If \config{multiRate} is set, only the central term $GM\,\M r/r^3$ of the Earth's
+gravity field is evaluated at every step. The residual accelerations of all \configClass{Forces}{forcesType}
+(which vary slowly along the orbit, e.g. tides, albedo, high-degree gravity field)
+are evaluated only every \config{samplingForces} seconds and are extrapolated
+by a polynomial of \config{polynomialDegree} through the last evaluations in between.
+This reduces the number of expensive force evaluations at the cost of accuracy,
+which is controlled by \config{samplingForces}.
+Satellite is assumed to be oriented along-track.
+See: Montenbruck, Oliver, and Eberhard Gill. 2000. Satellite Orbits
+)";
+#endif
+
+/***********************************************/
+
+#include "classes/orbitPropagator/orbitPropagator.h"
+
+/***** CLASS ***********************************/
+
+/** @brief Propagate orbit using the Dormand-Prince 5(4) method with step size control and dense output.
+* @ingroup orbitPropagatorGroup
+* @see orbitPropagator */
+class OrbitPropagatorDormandPrince : public OrbitPropagator
+{
+  Double tolerance;
+  Double minStep, maxStep;
+  Bool   multiRate;
+  Double GM;
+  Double samplingForces;
+  UInt   degree;
+
+  // full accelerations or central term + extrapolated residual accelerations (multi-rate)
+  class Accelerations
+  {
+    const OrbitPropagatorDormandPrince &propagator;
+    ForcesPtr         forces;
+    SatelliteModelPtr satellite;
+    EarthRotationPtr  earthRotation;
+    EphemeridesPtr    ephemerides;
+    Time              time0;
+    std::vector<Double>   nodeTau;
+    std::vector<Vector3d> nodeResidual;
+
+    Vector3d central(const Vector3d &pos) const {return (-propagator.GM/std::pow(pos.r(), 3)) * pos;}
+
+  public:
+    UInt countForces;
+
+    Accelerations(const OrbitPropagatorDormandPrince &propagator, ForcesPtr forces, SatelliteModelPtr satellite,
+                  EarthRotationPtr earthRotation, EphemeridesPtr ephemerides, const Time &time0)
+      : propagator(propagator), forces(forces), satellite(satellite), earthRotation(earthRotation), ephemerides(ephemerides),
+        time0(time0), countForces(0) {}
+
+    Vector3d full(Double tau, const Vector3d &pos, const Vector3d &vel)
+    {
+      OrbitEpoch epoch;
+      epoch.time     = time0 + seconds2time(tau);
+      epoch.position = pos;
+      epoch.velocity = vel;
+      countForces++;
+      return propagator.acceleration(epoch, forces, satellite, earthRotation, ephemerides);
+    }
+
+    /** @brief evaluates the residual forces at exactly known states if due (multi-rate only). */
+    void update(Double tau, const Vector3d &pos, const Vector3d &vel)
+    {
+      if(!propagator.multiRate)
+        return;
+      if(nodeTau.size() && (std::fabs(tau-nodeTau.back()) < propagator.samplingForces))
+        return;
+      nodeTau.push_back(tau);
+      nodeResidual.push_back(full(tau, pos, vel) - central(pos));
+      if(nodeTau.size() > propagator.degree+1)
+      {
+        nodeTau.erase(nodeTau.begin());
+        nodeResidual.erase(nodeResidual.begin());
+      }
+    }
+
+    Vector3d operator()(Double tau, const Vector3d &pos, const Vector3d &vel)
+    {
+      if(!propagator.multiRate)
+        return full(tau, pos, vel);
+      // Lagrange polynomial through the last evaluations
+      Vector3d residual;
+      for(UInt i=0; i<nodeTau.size(); i++)
+      {
+        Double factor = 1.;
+        for(UInt k=0; k<nodeTau.size(); k++)
+          if(k != i)
+            factor *= (tau-nodeTau.at(k))/(nodeTau.at(i)-nodeTau.at(k));
+        residual += factor * nodeResidual.at(i);
+      }
+      return central(pos) + residual;
+    }
+  };
+
+public:
+  OrbitPropagatorDormandPrince(Config &config);
+
+  OrbitArc integrateArc(OrbitEpoch startEpoch, Time sampling, UInt posCount, ForcesPtr forces, SatelliteModelPtr satellite,
+                        EarthRotationPtr earthRotation, EphemeridesPtr ephemerides, Bool timing) const override;
+};
+
+/***********************************************/
+
+inline OrbitPropagatorDormandPrince::OrbitPropagatorDormandPrince(Config &config)
+{
+  try
+  {
+    multiRate = FALSE;
+    GM = DEFAULT_GM;
+    samplingForces = 0;
+    degree = 0;
+
+    readConfig(config, "tolerance",   tolerance, Config::DEFAULT,  "1e-13", "max. local error of position and velocity per step relative to their length");
+    readConfig(config, "minStepSize", minStep,   Config::DEFAULT,  "1e-3",  "[s] smallest allowed step size");
+    readConfig(config, "maxStepSize", maxStep,   Config::DEFAULT,  "300",   "[s] largest allowed step size");
+    if(readConfigSequence(config, "multiRate", Config::OPTIONAL, "", "evaluate the forces at a coarser rate, only the central term at every step"))
+    {
+      multiRate = TRUE;
+      readConfig(config, "samplingForces",   samplingForces, Config::DEFAULT, "30", "[s] evaluation rate of the residual forces");
+      readConfig(config, "polynomialDegree", degree,         Config::DEFAULT, "3",  "extrapolation of the residual forces between evaluations");
+      readConfig(config, "GM",               GM,             Config::DEFAULT, STRING_DEFAULT_GM, "Geocentric gravitational constant of the central term");
+      endSequence(config);
+    }
+    if(isCreateSchema(config)) return;
+
+    if((tolerance <= 0) || (minStep <= 0) || (maxStep < minStep))
+      throw(Exception("DormandPrince Propagator: tolerance and step sizes must be positive and maxStepSize >= minStepSize"));
+  }
+  catch (std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+inline OrbitArc OrbitPropagatorDormandPrince::integrateArc(OrbitEpoch startEpoch, Time sampling, UInt posCount, ForcesPtr forces,
+                                                           SatelliteModelPtr satellite, EarthRotationPtr earthRotation, EphemeridesPtr ephemerides, Bool timing) const
+{
+  try
+  {
+    // Butcher tableau of Dormand-Prince 5(4)
+    constexpr Double c[7]    = {0., 1./5., 3./10., 4./5., 8./9., 1., 1.};
+    constexpr Double a[7][6] = {{0., 0., 0., 0., 0., 0.},
+                                {1./5., 0., 0., 0., 0., 0.},
+                                {3./40., 9./40., 0., 0., 0., 0.},
+                                {44./45., -56./15., 32./9., 0., 0., 0.},
+                                {19372./6561., -25360./2187., 64448./6561., -212./729., 0., 0.},
+                                {9017./3168., -355./33., 46732./5247., 49./176., -5103./18656., 0.},
+                                {35./384., 0., 500./1113., 125./192., -2187./6784., 11./84.}};
+    // difference of 5th and 4th order solution (error estimate)
+    constexpr Double e[7]    = {71./57600., 0., -71./16695., 71./1920., -17253./339200., 22./525., -1./40.};
+
+    const Double dt        = sampling.seconds();
+    const Double direction = (dt < 0) ? -1. : 1.;
+    const Double tauEnd    = (posCount-1)*dt;
+
+    Accelerations accelerations(*this, forces, satellite, earthRotation, ephemerides, startEpoch.time);
+    accelerations.update(0., startEpoch.position, startEpoch.velocity);
+    startEpoch.acceleration = accelerations(0., startEpoch.position, startEpoch.velocity);
+
+    OrbitArc orbit;
+    orbit.push_back(startEpoch);
+
+    // state at the begin of the current step
+    Double   tau = 0.;
+    Vector3d pos = startEpoch.position;
+    Vector3d vel = startEpoch.velocity;
+    Vector3d acc = startEpoch.acceleration;
+    Double   h   = direction * std::min(maxStep, std::max(minStep, std::fabs(dt)));
+
+    if(timing) logTimerStart;
+    while(orbit.size() < posCount)
+    {
+      // do not step beyond the last epoch
+      if(direction*(tau+h-tauEnd) > 0)
+        h = tauEnd-tau;
+
+      // stages (velocity: derivative of position, acceleration: derivative of velocity)
+      Vector3d kPos[7], kVel[7];
+      kPos[0] = vel;
+      kVel[0] = acc;
+      for(UInt s=1; s<7; s++)
+      {
+        Vector3d p = pos;
+        Vector3d v = vel;
+        for(UInt j=0; j<s; j++)
+        {
+          p += (h*a[s][j]) * kPos[j];
+          v += (h*a[s][j]) * kVel[j];
+        }
+        kPos[s] = v;
+        kVel[s] = accelerations(tau+c[s]*h, p, v);
+      }
+      // 5th order solution = last stage (first same as last)
+      Vector3d posNew = pos;
+      Vector3d velNew = vel;
+      for(UInt j=0; j<6; j++)
+      {
+        posNew += (h*a[6][j]) * kPos[j];
+        velNew += (h*a[6][j]) * kVel[j];
+      }
+      Vector3d errPos, errVel;
+      for(UInt j=0; j<7; j++)
+      {
+        errPos += (h*e[j]) * kPos[j];
+        errVel += (h*e[j]) * kVel[j];
+      }
+      const Double err = std::max(errPos.r()/(tolerance*pos.r()), errVel.r()/(tolerance*vel.r()));
+
+      // step size control
+      const Double factor = (err > 0) ? std::min(5., std::max(0.2, 0.9*std::pow(err, -0.2))) : 5.;
+      if((err > 1.) && (std::fabs(h) > minStep))
+      {
+        h = direction * std::max(minStep, factor*std::fabs(h));
+        continue; // reject step
+      }
+
+      // dense output: quintic Hermite interpolation between accepted steps
+      const Vector3d accNew = kVel[6];
+      while((orbit.size() < posCount) && (direction*(orbit.size()*dt-(tau+h)) <= 1e-9*std::fabs(dt)))
+      {
+        const Double s  = (orbit.size()*dt-tau)/h;
+        const Double s2 = s*s, s3 = s2*s, s4 = s3*s, s5 = s4*s;
+        OrbitEpoch epoch;
+        epoch.time     = startEpoch.time + seconds2time(orbit.size()*dt);
+        epoch.position = (1-10*s3+15*s4-6*s5) * pos + (h*(s-6*s3+8*s4-3*s5)) * vel + (h*h/2*(s2-3*s3+3*s4-s5)) * acc
+                       + (10*s3-15*s4+6*s5) * posNew + (h*(-4*s3+7*s4-3*s5)) * velNew + (h*h/2*(s3-2*s4+s5)) * accNew;
+        epoch.velocity = (1/h*(-30*s2+60*s3-30*s4)) * pos + (1-18*s2+32*s3-15*s4) * vel + (h/2*(2*s-9*s2+12*s3-5*s4)) * acc
+                       + (1/h*(30*s2-60*s3+30*s4)) * posNew + (-12*s2+28*s3-15*s4) * velNew + (h/2*(3*s2-8*s3+5*s4)) * accNew;
+        epoch.acceleration = (1/(h*h)*(-60*s+180*s2-120*s3)) * pos + (1/h*(-36*s+96*s2-60*s3)) * vel + (0.5*(2-18*s+36*s2-20*s3)) * acc
+                           + (1/(h*h)*(60*s-180*s2+120*s3)) * posNew + (1/h*(-24*s+84*s2-60*s3)) * velNew + (0.5*(6*s-24*s2+20*s3)) * accNew;
+        orbit.push_back(epoch);
+        if(timing) logTimerLoop(orbit.size()-1, posCount);
+      }
+
+      tau += h;
+      pos  = posNew;
+      vel  = velNew;
+      acc  = accNew;
+      accelerations.update(tau, pos, vel);
+      h = direction * std::min(maxStep, std::max(minStep, factor*std::fabs(h)));
+    }
+    if(timing) logTimerLoopEnd(posCount);
+
+    return orbit;
+  }
+  catch (std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+#endif /* __GROOPS_ORBITPROPAGATORDORMANDPRINCE__ */
@@ -24,6 +24,7 @@ Parameter index vector from list of parameter names.
 /***********************************************/
 
 #include "base/import.h"
+#include <unordered_map>
 #include "classes/parameterNames/parameterNames.h"
 #include "classes/parameterSelector/parameterSelector.h"
 
@@ -68,13 +69,27 @@ inline std::vector<UInt> ParameterSelectorNames::indexVector(const std::vector<P
   try
   {
     std::vector<UInt> vector;
-    auto iter = parameterNames.begin(); // assume ordered list to accelerate search
+    std::unordered_map<ParameterName, UInt> index; // built at first miss
+    UInt idx = 0; // assume ordered list to accelerate search
     for(const auto &name : requestedNames)
     {
-      iter = std::find(iter, parameterNames.end(), name);
-      if(iter == parameterNames.end()) // not found? -> restart search from begin
-        iter = std::find(parameterNames.begin(), parameterNames.end(), name);
-      vector.push_back((iter != parameterNames.end()) ? std::distance(parameterNames.begin(), iter) : NULLINDEX);
+      if((idx < parameterNames.size()) && (parameterNames.at(idx) == name))
+      {
+        vector.push_back(idx++);
+        continue;
+      }
+
+      if(index.empty())
+      {
+        index.reserve(parameterNames.size());
+        for(UInt i=0; i<parameterNames.size(); i++)
+          index.emplace(parameterNames.at(i), i); // keeps the first occurrence
+      }
+      auto iter = index.find(name);
+      idx = (iter != index.end()) ? iter->second : NULLINDEX;
+      vector.push_back(idx);
+      if(idx != NULLINDEX)
+        idx++;
     }
 
     return vector;
@@ -68,12 +68,38 @@ inline std::vector<UInt> ParameterSelectorWildcard::indexVector(const std::vecto
 {
   try
   {
-    const std::regex pattern = String::wildcard2regex(ParameterName(object, type, temporal, interval).str());
-
     std::vector<UInt> vector;
+
+    // a separator inside the parts could shift the match to another part -> match the full name
+    auto hasSeparator = [](const ParameterName &name)
+    {
+      return (name.object.find(ParameterName::sep)   != std::string::npos) || (name.type.find(ParameterName::sep)     != std::string::npos) ||
+             (name.temporal.find(ParameterName::sep) != std::string::npos) || (name.interval.find(ParameterName::sep) != std::string::npos);
+    };
+
+    const ParameterName patternName(object, type, temporal, interval);
+    if(hasSeparator(patternName))
+    {
+      const String::Wildcard pattern(patternName.str());
+      for(UInt i=0; i<parameterWildcards.size(); i++)
+        if(pattern.match(parameterWildcards.at(i).str()))
+          vector.push_back(i);
+      return vector;
+    }
+
+    // match the parts separately without building the full name
+    const String::Wildcard patternObject(object), patternType(type), patternTemporal(temporal), patternInterval(interval);
     for(UInt i=0; i<parameterWildcards.size(); i++)
-      if(std::regex_match(parameterWildcards.at(i).str(), pattern))
+    {
+      const ParameterName &name = parameterWildcards.at(i);
+      if(hasSeparator(name))
+      {
+        if(String::Wildcard(patternName.str()).match(name.str()))
+          vector.push_back(i);
+      }
+      else if(patternObject.match(name.object) && patternType.match(name.type) && patternTemporal.match(name.temporal) && patternInterval.match(name.interval))
         vector.push_back(i);
+    }
 
     return vector;
   }
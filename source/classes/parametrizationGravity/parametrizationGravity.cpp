@@ -159,6 +159,46 @@ void ParametrizationGravity::gravityGradient(const Time &time, const Vector3d &p
 
 /***********************************************/
 
+void ParametrizationGravity::field(const std::vector<Time> &times, const std::vector<Vector3d> &points, const Kernel &kernel, MatrixSliceRef A) const
+{
+  for(UInt i=0; i<parametrizations.size(); i++)
+    parametrizations.at(i)->field(times, points, kernel, A.slice(0,index.at(i),points.size(),parametrizations.at(i)->parameterCount()));
+}
+
+/***********************************************/
+
+void ParametrizationGravity::potential(const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const
+{
+  for(UInt i=0; i<parametrizations.size(); i++)
+    parametrizations.at(i)->potential(times, points, A.slice(0,index.at(i),points.size(),parametrizations.at(i)->parameterCount()));
+}
+
+/***********************************************/
+
+void ParametrizationGravity::radialGradient(const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const
+{
+  for(UInt i=0; i<parametrizations.size(); i++)
+    parametrizations.at(i)->radialGradient(times, points, A.slice(0,index.at(i),points.size(),parametrizations.at(i)->parameterCount()));
+}
+
+/***********************************************/
+
+void ParametrizationGravity::gravity(const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const
+{
+  for(UInt i=0; i<parametrizations.size(); i++)
+    parametrizations.at(i)->gravity(times, points, A.slice(0,index.at(i),3*points.size(),parametrizations.at(i)->parameterCount()));
+}
+
+/***********************************************/
+
+void ParametrizationGravity::gravityGradient(const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const
+{
+  for(UInt i=0; i<parametrizations.size(); i++)
+    parametrizations.at(i)->gravityGradient(times, points, A.slice(0,index.at(i),6*points.size(),parametrizations.at(i)->parameterCount()));
+}
+
+/***********************************************/
+
 void ParametrizationGravity::deformation(const Time &time, const Vector3d &point, Double gravity, const Vector &hn, const Vector &ln, MatrixSliceRef A) const
 {
   for(UInt i=0; i<parametrizations.size(); i++)
@@ -167,6 +207,15 @@ void ParametrizationGravity::deformation(const Time &time, const Vector3d &point
 
 /***********************************************/
 
+void ParametrizationGravity::deformation(const std::vector<Time> &times, const std::vector<Vector3d> &points, const std::vector<Double> &gravity,
+                                         const Vector &hn, const Vector &ln, MatrixSliceRef A) const
+{
+  for(UInt i=0; i<parametrizations.size(); i++)
+    parametrizations.at(i)->deformation(times, points, gravity, hn, ln, A.slice(0,index.at(i),3*points.size(),parametrizations.at(i)->parameterCount()));
+}
+
+/***********************************************/
+
 SphericalHarmonics ParametrizationGravity::sphericalHarmonics(const Time &time, const Vector &x, UInt maxDegree) const
 {
   try
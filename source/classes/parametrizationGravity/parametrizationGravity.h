@@ -119,6 +119,39 @@ public:
   * @param A Must be a (sub)matrix with the dimension (6 x parameterCount()). It is filled with the partial derivatives with respect to the parameters. */
   void gravityGradient(const Time &time, const Vector3d &point, MatrixSliceRef A) const;
 
+  /** @brief Values of the gravity field at many points.
+  * Same as above for all @a points at once.
+  * @param times Time of observation for each point.
+  * @param points Computational points in TRF [m].
+  * @param kernel Type of the functional (e.g. Stokes kernel for gravity anomalies).
+  * @param A Must be a (sub)matrix with the dimension (points.size() x parameterCount()). Row k belongs to @a points(k). */
+  void field(const std::vector<Time> &times, const std::vector<Vector3d> &points, const Kernel &kernel, MatrixSliceRef A) const;
+
+  /** @brief Gravitational potential at many points.
+  * Same as above for all @a points at once, which is much faster than single calls for some parametrizations.
+  * @param times Time of observation for each point.
+  * @param points Computational points in TRF [m].
+  * @param A Must be a (sub)matrix with the dimension (points.size() x parameterCount()). Row k belongs to @a points(k). */
+  void potential(const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const;
+
+  /** @brief Radial derivative at many points.
+  * @param times Time of observation for each point.
+  * @param points Computational points in TRF [m].
+  * @param A Must be a (sub)matrix with the dimension (points.size() x parameterCount()). Row k belongs to @a points(k). */
+  void radialGradient(const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const;
+
+  /** @brief Gravity vector at many points.
+  * @param times Time of observation for each point.
+  * @param points Computational points in TRF [m].
+  * @param A Must be a (sub)matrix with the dimension (3*points.size() x parameterCount()). Rows 3*k..3*k+2 belong to @a points(k). */
+  void gravity(const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const;
+
+  /** @brief Gravity Gradient at many points.
+  * @param times Time of observation for each point.
+  * @param points Computational points in TRF [m].
+  * @param A Must be a (sub)matrix with the dimension (6*points.size() x parameterCount()). Rows 6*k..6*k+5 belong to @a points(k). */
+  void gravityGradient(const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const;
+
   /** @brief Loading deformation.
   * Three observation equations for loading deformation at a station (x,y,z) in TRF [m].
   * @param time Time of observation.
@@ -129,6 +162,17 @@ public:
   * @param A Must be a (sub)matrix with the dimension (3 x parameterCount()). It is filled with the partial derivatives with respect to the parameters. */
   void deformation(const Time &time, const Vector3d &point, Double gravity, const Vector &hn, const Vector &ln, MatrixSliceRef A) const;
 
+  /** @brief Loading deformation at many stations.
+  * Same as above for all @a points at once.
+  * @param times Time of observation for each station.
+  * @param points station positions in TRF [m]
+  * @param gravity local gravity at each station [m/s**2]
+  * @param hn vertical load love numbers
+  * @param ln horizontal load love numbers
+  * @param A Must be a (sub)matrix with the dimension (3*points.size() x parameterCount()). Rows 3*k..3*k+2 belong to @a points(k). */
+  void deformation(const std::vector<Time> &times, const std::vector<Vector3d> &points, const std::vector<Double> &gravity,
+                   const Vector &hn, const Vector &ln, MatrixSliceRef A) const;
+
   /** @brief Conversion of parameter Vector into SphericalHarmonics. */
   SphericalHarmonics sphericalHarmonics(const Time &time, const Vector &x, UInt maxDegree=INFINITYDEGREE) const;
 
@@ -175,6 +219,20 @@ public:
   virtual void gravityGradient(const Time &time, const Vector3d &point, MatrixSliceRef A) const = 0;
   virtual void deformation    (const Time &time, const Vector3d &point, Double gravity, const Vector &hn, const Vector &ln, MatrixSliceRef A) const = 0;
 
+  // batched versions (point k fills the rows k*rowsPerPoint, default: loop over single points)
+  virtual void field          (const std::vector<Time> &times, const std::vector<Vector3d> &points, const Kernel &kernel, MatrixSliceRef A) const
+    {for(UInt k=0; k<points.size(); k++) field(times.at(k), points.at(k), kernel, A.row(k));}
+  virtual void potential      (const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const
+    {for(UInt k=0; k<points.size(); k++) potential(times.at(k), points.at(k), A.row(k));}
+  virtual void radialGradient (const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const
+    {for(UInt k=0; k<points.size(); k++) radialGradient(times.at(k), points.at(k), A.row(k));}
+  virtual void gravity        (const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const
+    {for(UInt k=0; k<points.size(); k++) gravity(times.at(k), points.at(k), A.row(3*k, 3));}
+  virtual void gravityGradient(const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const
+    {for(UInt k=0; k<points.size(); k++) gravityGradient(times.at(k), points.at(k), A.row(6*k, 6));}
+  virtual void deformation    (const std::vector<Time> &times, const std::vector<Vector3d> &points, const std::vector<Double> &gravity, const Vector &hn, const Vector &ln, MatrixSliceRef A) const
+    {for(UInt k=0; k<points.size(); k++) deformation(times.at(k), points.at(k), gravity.at(k), hn, ln, A.row(3*k, 3));}
+
   virtual SphericalHarmonics sphericalHarmonics(const Time &time, const Vector &x, UInt maxDegree) const = 0;
   virtual SphericalHarmonics sphericalHarmonics(const Time &time, const Vector &x, const Vector &sigma2x, UInt maxDegree)  const = 0;
 };
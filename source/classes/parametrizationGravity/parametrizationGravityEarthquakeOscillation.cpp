@@ -40,7 +40,29 @@ ParametrizationGravityEarthquakeOscillation::ParametrizationGravityEarthquakeOsc
     numbering->numbering(maxDegree, minDegree, idxC, idxS);
     _parameterCount = 3*numbering->parameterCount(maxDegree, minDegree);
 
+    // initial values of amplitude, angular frequency and damping per coefficient
+    Matrix mx;
     readFileMatrix(xName, mx);
+    amplitude = omega = damping = Vector(_parameterCount/3);
+    for(UInt i=0; i<mx.rows(); i++)
+    {
+      const UInt n = static_cast<UInt>(mx(i,1));
+      const UInt m = static_cast<UInt>(mx(i,2));
+      if((n<minDegree) || (n>maxDegree) || (m>n))
+        continue;
+      if(idxC[n][m]!=NULLINDEX)
+      {
+        amplitude(idxC[n][m]) = mx(i,3);
+        omega(idxC[n][m])     = mx(i,5);
+        damping(idxC[n][m])   = mx(i,7);
+      }
+      if(m && (idxS[n][m]!=NULLINDEX))
+      {
+        amplitude(idxS[n][m]) = mx(i,4);
+        omega(idxS[n][m])     = mx(i,6);
+        damping(idxS[n][m])   = mx(i,8);
+      }
+    }
   }
   catch(std::exception &e)
   {
@@ -49,79 +71,60 @@ ParametrizationGravityEarthquakeOscillation::ParametrizationGravityEarthquakeOsc
 }
 /***********************************************/
 
-void ParametrizationGravityEarthquakeOscillation::coefficients(const Time &time, MatrixSliceRef B, MatrixSliceRef A) const
+Matrix ParametrizationGravityEarthquakeOscillation::temporalFactors(const Time &time) const
 {
   try
   {
+    // partial derivatives with respect to amplitude, angular frequency and damping
     const Double dt = (time-time0).seconds();
-
-    Matrix cnm0(maxDegree+1,maxDegree+1);
-    Matrix snm0(maxDegree+1,maxDegree+1);
-
-    Matrix cnmW = cnm0; Matrix cnmP = cnm0;
-    Matrix snmW = snm0; Matrix snmP = snm0;
-
-    for(UInt i=0; i<mx.rows(); i++)
+    Matrix factors(amplitude.rows(), 3);
+    for(UInt i=0; i<factors.rows(); i++)
     {
-      cnm0(mx(i,1), mx(i,2)) = mx(i,3);
-      snm0(mx(i,1), mx(i,2)) = mx(i,4);
-      cnmW(mx(i,1), mx(i,2)) = mx(i,5);
-      snmW(mx(i,1), mx(i,2)) = mx(i,6);
-      cnmP(mx(i,1), mx(i,2)) = mx(i,7);
-      snmP(mx(i,1), mx(i,2)) = mx(i,8);
+      const Double a = amplitude(i);
+      const Double w = omega(i);
+      const Double p = damping(i);
+      const Double e = std::exp(w*dt*p);
+      const Double cosWt = cos(w*dt);
+      factors(i,0) = 1 - cosWt*e;
+      factors(i,1) = (a*dt)*sin(w*dt)*e - (a*dt*p)*cosWt*e;
+      factors(i,2) = (-a*w*dt)*cosWt*e;
     }
+    return factors;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
 
-    std::vector<std::vector<Matrix>> cnm(maxDegree+1, std::vector<Matrix>(maxDegree+1));
-    std::vector<std::vector<Matrix>> snm(maxDegree+1, std::vector<Matrix>(maxDegree+1));
-
-    for(UInt n=minDegree; n<=maxDegree; n++)
-    {
-      if(idxC[n][0]!=NULLINDEX)
-      {
-        cnm[n][0] = Matrix(1, 3);
-        cnm[n][0](0,0) = 1 - cos( cnmW(n,0) * dt ) * std::exp(cnmW(n,0)*dt*cnmP(n,0));
-        cnm[n][0](0,1) = (cnm0(n,0)*dt)*sin(cnmW(n,0)*dt)*std::exp(cnmW(n,0)*dt*cnmP(n,0))-
-                         (cnm0(n,0)*dt*cnmP(n,0))*cos(cnmW(n,0)*dt)*std::exp(cnmW(n,0)*dt*cnmP(n,0));
-        cnm[n][0](0,2) = (-cnm0(n,0)*cnmW(n,0)*dt)*cos(cnmW(n,0)*dt)*std::exp(cnmW(n,0)*dt*cnmP(n,0));
+/***********************************************/
 
-      }
-      for(UInt m=1; m<=n; m++)
-      {
-        if(idxC[n][m]!=NULLINDEX)
-        {
-          cnm[n][m] = Matrix(1, 3);
-          cnm[n][m](0,0) = 1 - cos(cnmW(n,m)*dt)*std::exp(cnmW(n,m)*dt*cnmP(n,m));
-          cnm[n][m](0,1) = (cnm0(n,m)*dt)*sin(cnmW(n,m)*dt)*std::exp(cnmW(n,m)*dt*cnmP(n,m))-
-                           (cnm0(n,m)*dt*cnmP(n,m))*cos(cnmW(n,m)*dt)*std::exp(cnmW(n,m)*dt*cnmP(n,m));
-          cnm[n][m](0,2) = (-cnm0(n,m)*cnmW(n,m)*dt)*cos(cnmW(n,m)*dt)*std::exp(cnmW(n,m)*dt*cnmP(n,m));
-        }
+void ParametrizationGravityEarthquakeOscillation::coefficients(const Matrix &factors, const_MatrixSliceRef B, MatrixSliceRef A) const
+{
+  for(UInt i=0; i<factors.rows(); i++)
+    for(UInt k=0; k<3; k++)
+      for(UInt r=0; r<B.rows(); r++)
+        A(r, 3*i+k) = B(r,i) * factors(i,k);
+}
 
-        if(idxS[n][m]!=NULLINDEX)
-        {
-          snm[n][m] = Matrix(1, 3);
-          snm[n][m](0,0) = 1 - cos(snmW(n,m)*dt)*std::exp(snmW(n,m)*dt*snmP(n,m));
-          snm[n][m](0,1) = (snm0(n,m)*dt)*sin(snmW(n,m)*dt)*std::exp(snmW(n,m)*dt*snmP(n,m))-
-                           (snm0(n,m)*dt*snmP(n,m))*cos(snmW(n,m)*dt)*std::exp(snmW(n,m)*dt*snmP(n,m));
-          snm[n][m](0,2) = (-snm0(n,m)*snmW(n,m)*dt)*cos(snmW(n,m)*dt)*std::exp(snmW(n,m)*dt*snmP(n,m));
-        }
-      }
-    }
+/***********************************************/
 
-    for(UInt n=minDegree; n<=maxDegree; n++)
+void ParametrizationGravityEarthquakeOscillation::designMatrix(const std::vector<Time> &times, UInt rowsPerPoint, MatrixSliceRef A, std::function<void(UInt idPoint, MatrixSliceRef B)> spatial) const
+{
+  try
+  {
+    // consecutive points at the same epoch share the temporal factors
+    for(UInt start=0; start<times.size();)
     {
-      if(idxC[n][0]!=NULLINDEX)
-        copy (B.column(idxC[n][0]) * cnm[n][0] , A.column(3*idxC[n][0], 3));
-
-      for(UInt m=1; m<=n; m++)
-      {
-        if(idxC[n][m]!=NULLINDEX)
-            copy(B.column(idxC[n][m])* cnm[n][m] , A.column(3*idxC[n][m], 3));
-
-        if(idxS[n][m]!=NULLINDEX)
-            copy(B.column(idxS[n][m])* snm[n][m] , A.column(3*idxS[n][m], 3));
-      }
-     }
-
+      UInt count = 1;
+      while((start+count < times.size()) && (times.at(start+count) == times.at(start)))
+        count++;
+      Matrix B(rowsPerPoint*count, parameterCount()/3);
+      for(UInt k=0; k<count; k++)
+        spatial(start+k, B.row(rowsPerPoint*k, rowsPerPoint));
+      coefficients(temporalFactors(times.at(start)), B, A.row(rowsPerPoint*start, rowsPerPoint*count));
+      start += count;
+    }
   }
   catch(std::exception &e)
   {
@@ -153,24 +156,33 @@ void ParametrizationGravityEarthquakeOscillation::parameterName(std::vector<Para
 /***********************************************/
 
 void ParametrizationGravityEarthquakeOscillation::field(const Time &time, const Vector3d &point, const Kernel &kernel, MatrixSliceRef A) const
+{
+  field(std::vector<Time>{time}, std::vector<Vector3d>{point}, kernel, A);
+}
+
+/***********************************************/
+
+void ParametrizationGravityEarthquakeOscillation::field(const std::vector<Time> &times, const std::vector<Vector3d> &points, const Kernel &kernel, MatrixSliceRef A) const
 {
   try
   {
-    Matrix Cnm, Snm;
-    SphericalHarmonics::CnmSnm(1/R * point, maxDegree, Cnm, Snm);
-    Vector coeff = GM/R * kernel.inverseCoefficients(point, maxDegree);
-    Matrix B(1, parameterCount()/3);
-
-    for(UInt n=minDegree; n<=maxDegree; n++)
+    designMatrix(times, 1, A, [&](UInt idPoint, MatrixSliceRef B)
     {
-      if(idxC[n][0]!=NULLINDEX) B(0, idxC[n][0]) = coeff(n) * Cnm(n,0);
-      for(UInt m=1; m<=n; m++)
+      const Vector3d &point = points.at(idPoint);
+      Matrix Cnm, Snm;
+      SphericalHarmonics::CnmSnm(1/R * point, maxDegree, Cnm, Snm);
+      Vector coeff = GM/R * kernel.inverseCoefficients(point, maxDegree);
+
+      for(UInt n=minDegree; n<=maxDegree; n++)
       {
-        if(idxC[n][m]!=NULLINDEX) B(0, idxC[n][m]) = coeff(n) * Cnm(n,m);
-        if(idxS[n][m]!=NULLINDEX) B(0, idxS[n][m]) = coeff(n) * Snm(n,m);
+        if(idxC[n][0]!=NULLINDEX) B(0, idxC[n][0]) = coeff(n) * Cnm(n,0);
+        for(UInt m=1; m<=n; m++)
+        {
+          if(idxC[n][m]!=NULLINDEX) B(0, idxC[n][m]) = coeff(n) * Cnm(n,m);
+          if(idxS[n][m]!=NULLINDEX) B(0, idxS[n][m]) = coeff(n) * Snm(n,m);
+        }
       }
-    }
-    coefficients(time, B, A);
+    });
   }
   catch(std::exception &e)
   {
@@ -181,24 +193,33 @@ void ParametrizationGravityEarthquakeOscillation::field(const Time &time, const
 /***********************************************/
 
 void ParametrizationGravityEarthquakeOscillation::potential(const Time &time, const Vector3d &point, MatrixSliceRef A) const
+{
+  potential(std::vector<Time>{time}, std::vector<Vector3d>{point}, A);
+}
+
+/***********************************************/
+
+void ParametrizationGravityEarthquakeOscillation::potential(const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const
 {
   try
   {
-    Matrix Cnm, Snm;
-    SphericalHarmonics::CnmSnm(1/R * point, maxDegree, Cnm, Snm);
-    Matrix B(1, parameterCount()/3);
-
-    Double factor = GM/R;
-    for(UInt n=minDegree; n<=maxDegree; n++)
+    designMatrix(times, 1, A, [&](UInt idPoint, MatrixSliceRef B)
     {
-      if(idxC[n][0]!=NULLINDEX) B(0, idxC[n][0]) = factor * Cnm(n,0);
-      for(UInt m=1; m<=n; m++)
+      const Vector3d &point = points.at(idPoint);
+      Matrix Cnm, Snm;
+      SphericalHarmonics::CnmSnm(1/R * point, maxDegree, Cnm, Snm);
+
+      Double factor = GM/R;
+      for(UInt n=minDegree; n<=maxDegree; n++)
       {
-        if(idxC[n][m]!=NULLINDEX) B(0, idxC[n][m]) = factor * Cnm(n,m);
-        if(idxS[n][m]!=NULLINDEX) B(0, idxS[n][m]) = factor * Snm(n,m);
+        if(idxC[n][0]!=NULLINDEX) B(0, idxC[n][0]) = factor * Cnm(n,0);
+        for(UInt m=1; m<=n; m++)
+        {
+          if(idxC[n][m]!=NULLINDEX) B(0, idxC[n][m]) = factor * Cnm(n,m);
+          if(idxS[n][m]!=NULLINDEX) B(0, idxS[n][m]) = factor * Snm(n,m);
+        }
       }
-    }
-    coefficients(time, B, A);
+    });
   }
   catch(std::exception &e)
   {
@@ -209,24 +230,33 @@ void ParametrizationGravityEarthquakeOscillation::potential(const Time &time, co
 /***********************************************/
 
 void ParametrizationGravityEarthquakeOscillation::radialGradient(const Time &time, const Vector3d &point, MatrixSliceRef A) const
+{
+  radialGradient(std::vector<Time>{time}, std::vector<Vector3d>{point}, A);
+}
+
+/***********************************************/
+
+void ParametrizationGravityEarthquakeOscillation::radialGradient(const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const
 {
   try
   {
-    Matrix Cnm, Snm;
-    SphericalHarmonics::CnmSnm(1/R * point, maxDegree, Cnm, Snm);
-    Matrix B(1, parameterCount()/3);
-
-    Double factor = -GM/R/point.r();
-    for(UInt n=minDegree; n<=maxDegree; n++)
+    designMatrix(times, 1, A, [&](UInt idPoint, MatrixSliceRef B)
     {
-      if(idxC[n][0]!=NULLINDEX) B(0, idxC[n][0]) = factor * (n+1) * Cnm(n,0);
-      for(UInt m=1; m<=n; m++)
+      const Vector3d &point = points.at(idPoint);
+      Matrix Cnm, Snm;
+      SphericalHarmonics::CnmSnm(1/R * point, maxDegree, Cnm, Snm);
+
+      Double factor = -GM/R/point.r();
+      for(UInt n=minDegree; n<=maxDegree; n++)
       {
-        if(idxC[n][m]!=NULLINDEX) B(0, idxC[n][m]) = factor * (n+1) * Cnm(n,m);
-        if(idxS[n][m]!=NULLINDEX) B(0, idxS[n][m]) = factor * (n+1) * Snm(n,m);
+        if(idxC[n][0]!=NULLINDEX) B(0, idxC[n][0]) = factor * (n+1) * Cnm(n,0);
+        for(UInt m=1; m<=n; m++)
+        {
+          if(idxC[n][m]!=NULLINDEX) B(0, idxC[n][m]) = factor * (n+1) * Cnm(n,m);
+          if(idxS[n][m]!=NULLINDEX) B(0, idxS[n][m]) = factor * (n+1) * Snm(n,m);
+        }
       }
-    }
-    coefficients(time, B, A);
+    });
   }
   catch(std::exception &e)
   {
@@ -237,63 +267,72 @@ void ParametrizationGravityEarthquakeOscillation::radialGradient(const Time &tim
 /***********************************************/
 
 void ParametrizationGravityEarthquakeOscillation::gravity(const Time &time, const Vector3d &point, MatrixSliceRef A) const
+{
+  gravity(std::vector<Time>{time}, std::vector<Vector3d>{point}, A);
+}
+
+/***********************************************/
+
+void ParametrizationGravityEarthquakeOscillation::gravity(const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const
 {
   try
   {
-    Matrix Cnm, Snm;
-    SphericalHarmonics::CnmSnm(1/R * point, maxDegree+1, Cnm, Snm);
-    Matrix B(3, parameterCount()/3);
-
-    // 0. Order
-    for(UInt n=minDegree; n<=maxDegree; n++)
+    designMatrix(times, 3, A, [&](UInt idPoint, MatrixSliceRef B)
     {
-      Double factor = sqrt((2.*n+1.)/(2.*n+3.))*GM/(2.*R*R);
-
-      Double wm0 = sqrt((n+1.)*(n+1.));
-      Double wp1 = sqrt((n+1.)*(n+2.)) / sqrt(2.0);
-
-      Double Cm0 = wm0*Cnm(n+1,0);
-      Double Cp1 = wp1*Cnm(n+1,1); Double Sp1 = wp1*Snm(n+1,1);
+      const Vector3d &point = points.at(idPoint);
+      Matrix Cnm, Snm;
+      SphericalHarmonics::CnmSnm(1/R * point, maxDegree+1, Cnm, Snm);
 
-      if(idxC[n][0]!=NULLINDEX)
-      {
-        B(0, idxC[n][0]) = factor*(-2*Cp1);
-        B(1, idxC[n][0]) = factor*(-2*Sp1);
-        B(2, idxC[n][0]) = factor*(-2*Cm0);
-      }
-    }
-
-    // all other orders
-    for(UInt m=1; m<=maxDegree; m++)
-    {
-      for(UInt n=std::max(minDegree,m); n<=maxDegree; n++)
+      // 0. Order
+      for(UInt n=minDegree; n<=maxDegree; n++)
       {
         Double factor = sqrt((2.*n+1.)/(2.*n+3.))*GM/(2.*R*R);
 
-        Double wm1 = sqrt((n-m+1.)*(n-m+2.)) * ((m==1) ? sqrt(2.0) : 1.0);
-        Double wm0 = sqrt((n-m+1.)*(n+m+1.));
-        Double wp1 = sqrt((n+m+1.)*(n+m+2.));
+        Double wm0 = sqrt((n+1.)*(n+1.));
+        Double wp1 = sqrt((n+1.)*(n+2.)) / sqrt(2.0);
 
-        Double Cm1 = wm1*Cnm(n+1,m-1);  Double Sm1 = wm1*Snm(n+1,m-1);
-        Double Cm0 = wm0*Cnm(n+1,m  );  Double Sm0 = wm0*Snm(n+1,m  );
-        Double Cp1 = wp1*Cnm(n+1,m+1);  Double Sp1 = wp1*Snm(n+1,m+1);
+        Double Cm0 = wm0*Cnm(n+1,0);
+        Double Cp1 = wp1*Cnm(n+1,1); Double Sp1 = wp1*Snm(n+1,1);
 
-        if(idxC[n][m]!=NULLINDEX)
+        if(idxC[n][0]!=NULLINDEX)
         {
-          B(0, idxC[n][m]) = factor*( Cm1 - Cp1);
-          B(1, idxC[n][m]) = factor*(-Sm1 - Sp1);
-          B(2, idxC[n][m]) = factor*(-2*Cm0);
+          B(0, idxC[n][0]) = factor*(-2*Cp1);
+          B(1, idxC[n][0]) = factor*(-2*Sp1);
+          B(2, idxC[n][0]) = factor*(-2*Cm0);
         }
+      }
 
-        if(idxS[n][m]!=NULLINDEX)
+      // all other orders
+      for(UInt m=1; m<=maxDegree; m++)
+      {
+        for(UInt n=std::max(minDegree,m); n<=maxDegree; n++)
         {
-          B(0, idxS[n][m]) = factor*(Sm1 - Sp1);
-          B(1, idxS[n][m]) = factor*(Cm1 + Cp1);
-          B(2, idxS[n][m]) = factor*(-2*Sm0);
+          Double factor = sqrt((2.*n+1.)/(2.*n+3.))*GM/(2.*R*R);
+
+          Double wm1 = sqrt((n-m+1.)*(n-m+2.)) * ((m==1) ? sqrt(2.0) : 1.0);
+          Double wm0 = sqrt((n-m+1.)*(n+m+1.));
+          Double wp1 = sqrt((n+m+1.)*(n+m+2.));
+
+          Double Cm1 = wm1*Cnm(n+1,m-1);  Double Sm1 = wm1*Snm(n+1,m-1);
+          Double Cm0 = wm0*Cnm(n+1,m  );  Double Sm0 = wm0*Snm(n+1,m  );
+          Double Cp1 = wp1*Cnm(n+1,m+1);  Double Sp1 = wp1*Snm(n+1,m+1);
+
+          if(idxC[n][m]!=NULLINDEX)
+          {
+            B(0, idxC[n][m]) = factor*( Cm1 - Cp1);
+            B(1, idxC[n][m]) = factor*(-Sm1 - Sp1);
+            B(2, idxC[n][m]) = factor*(-2*Cm0);
+          }
+
+          if(idxS[n][m]!=NULLINDEX)
+          {
+            B(0, idxS[n][m]) = factor*(Sm1 - Sp1);
+            B(1, idxS[n][m]) = factor*(Cm1 + Cp1);
+            B(2, idxS[n][m]) = factor*(-2*Sm0);
+          }
         }
       }
-    }
-    coefficients(time, B, A);
+    });
   }
   catch(std::exception &e)
   {
@@ -304,88 +343,57 @@ void ParametrizationGravityEarthquakeOscillation::gravity(const Time &time, cons
 /***********************************************/
 
 void ParametrizationGravityEarthquakeOscillation::gravityGradient(const Time &time, const Vector3d &point, MatrixSliceRef A) const
+{
+  gravityGradient(std::vector<Time>{time}, std::vector<Vector3d>{point}, A);
+}
+
+/***********************************************/
+
+void ParametrizationGravityEarthquakeOscillation::gravityGradient(const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const
 {
   try
   {
-    Matrix Cnm, Snm;
-    SphericalHarmonics::CnmSnm(1/R * point, maxDegree+2, Cnm, Snm);
-    Matrix B(6, parameterCount()/3);
-
-    // 0. Order
-    for(UInt n=minDegree; n<=maxDegree; n++)
+    designMatrix(times, 6, A, [&](UInt idPoint, MatrixSliceRef B)
     {
-      Double factor = sqrt((2.*n+1.)/(2.*n+5.))*GM/(4.*R*R*R);
-
-      Double wm0 = sqrt((n+1.)*(n+2.)*(n+1.)*(n+2.));
-      Double wp1 = sqrt((n+1.)*(n+1.)*(n+2.)*(n+3.)) / sqrt(2.0);
-      Double wp2 = sqrt((n+1.)*(n+2.)*(n+3.)*(n+4.)) / sqrt(2.0);
-
-      Double Cm0 = wm0*Cnm(n+2,0);
-      Double Cp1 = wp1*Cnm(n+2,1);  Double Sp1 = wp1*Snm(n+2,1);
-      Double Cp2 = wp2*Cnm(n+2,2);  Double Sp2 = wp2*Snm(n+2,2);
+      const Vector3d &point = points.at(idPoint);
+      Matrix Cnm, Snm;
+      SphericalHarmonics::CnmSnm(1/R * point, maxDegree+2, Cnm, Snm);
 
-      if(idxC[n][0]!=NULLINDEX)
+      // 0. Order
+      for(UInt n=minDegree; n<=maxDegree; n++)
       {
-        B(0, idxC[n][0]) = factor * (-2*Cm0 + 2*Cp2);
-        B(1, idxC[n][0]) = factor * ( 2*Sp2);
-        B(2, idxC[n][0]) = factor * ( 4*Cp1);
-        B(3, idxC[n][0]) = factor * (-2*Cm0 - 2*Cp2);
-        B(4, idxC[n][0]) = factor * ( 4*Sp1);
-        B(5, idxC[n][0]) = factor * ( 4*Cm0);
-      }
-    }
-
-    // 1. order
-    UInt m=1;
-    for(UInt n=std::max(minDegree, static_cast<UInt>(1)); n<=maxDegree; n++)
-    {
-      Double factor = sqrt((2.*n+1.)/(2.*n+5.))*GM/(4.*R*R*R);
-
-      Double wm1 = sqrt((n-m+1.)*(n-m+2.)*(n-m+3.)*(n+m+1.)) * sqrt(2.0);
-      Double wm0 = sqrt((n-m+1.)*(n-m+2.)*(n+m+1.)*(n+m+2.));
-      Double wp1 = sqrt((n-m+1.)*(n+m+1.)*(n+m+2.)*(n+m+3.));
-      Double wp2 = sqrt((n+m+1.)*(n+m+2.)*(n+m+3.)*(n+m+4.));
+        Double factor = sqrt((2.*n+1.)/(2.*n+5.))*GM/(4.*R*R*R);
 
-      Double Cm1 = wm1*Cnm(n+2,m-1);  Double Sm1 = wm1*Snm(n+2,m-1);
-      Double Cm0 = wm0*Cnm(n+2,m  );  Double Sm0 = wm0*Snm(n+2,m  );
-      Double Cp1 = wp1*Cnm(n+2,m+1);  Double Sp1 = wp1*Snm(n+2,m+1);
-      Double Cp2 = wp2*Cnm(n+2,m+2);  Double Sp2 = wp2*Snm(n+2,m+2);
+        Double wm0 = sqrt((n+1.)*(n+2.)*(n+1.)*(n+2.));
+        Double wp1 = sqrt((n+1.)*(n+1.)*(n+2.)*(n+3.)) / sqrt(2.0);
+        Double wp2 = sqrt((n+1.)*(n+2.)*(n+3.)*(n+4.)) / sqrt(2.0);
 
-      if(idxC[n][m]!=NULLINDEX)
-      {
-        B(0, idxC[n][m]) = factor * (- 3*Cm0 + Cp2);
-        B(1, idxC[n][m]) = factor * (-   Sm0 + Sp2);
-        B(2, idxC[n][m]) = factor * (-2*Cm1 + 2*Cp1);
-        B(3, idxC[n][m]) = factor * (-   Cm0 - Cp2);
-        B(4, idxC[n][m]) = factor * (2*Sp1);
-        B(5, idxC[n][m]) = factor * (4*Cm0);
-      }
+        Double Cm0 = wm0*Cnm(n+2,0);
+        Double Cp1 = wp1*Cnm(n+2,1);  Double Sp1 = wp1*Snm(n+2,1);
+        Double Cp2 = wp2*Cnm(n+2,2);  Double Sp2 = wp2*Snm(n+2,2);
 
-      if(idxS[n][m]!=NULLINDEX)
-      {
-        B(0, idxS[n][m]) = factor * (- Sm0 + Sp2);
-        B(1, idxS[n][m]) = factor * (- Cm0 - Cp2);
-        B(2, idxS[n][m]) = factor * (-2*Sm1 + 2*Sp1);
-        B(3, idxS[n][m]) = factor * (- 3*Sm0 - Sp2);
-        B(4, idxS[n][m]) = factor * (-2*Cm1 - 2*Cp1);
-        B(5, idxS[n][m]) = factor * (4*Sm0);
+        if(idxC[n][0]!=NULLINDEX)
+        {
+          B(0, idxC[n][0]) = factor * (-2*Cm0 + 2*Cp2);
+          B(1, idxC[n][0]) = factor * ( 2*Sp2);
+          B(2, idxC[n][0]) = factor * ( 4*Cp1);
+          B(3, idxC[n][0]) = factor * (-2*Cm0 - 2*Cp2);
+          B(4, idxC[n][0]) = factor * ( 4*Sp1);
+          B(5, idxC[n][0]) = factor * ( 4*Cm0);
+        }
       }
-    } // end 1. order
 
-    // all other orders
-    for(UInt m=2; m<=maxDegree; m++)
-    {
-      for(UInt n=std::max(minDegree,m); n<=maxDegree; n++)
+      // 1. order
+      UInt m=1;
+      for(UInt n=std::max(minDegree, static_cast<UInt>(1)); n<=maxDegree; n++)
       {
         Double factor = sqrt((2.*n+1.)/(2.*n+5.))*GM/(4.*R*R*R);
 
-        Double wm2 = sqrt((n-m+1.)*(n-m+2.)*(n-m+3.)*(n-m+4.)) * ((m==2) ? sqrt(2.0) : 1.0);
-        Double wm1 = sqrt((n-m+1.)*(n-m+2.)*(n-m+3.)*(n+m+1.));
+        Double wm1 = sqrt((n-m+1.)*(n-m+2.)*(n-m+3.)*(n+m+1.)) * sqrt(2.0);
         Double wm0 = sqrt((n-m+1.)*(n-m+2.)*(n+m+1.)*(n+m+2.));
         Double wp1 = sqrt((n-m+1.)*(n+m+1.)*(n+m+2.)*(n+m+3.));
         Double wp2 = sqrt((n+m+1.)*(n+m+2.)*(n+m+3.)*(n+m+4.));
 
-        Double Cm2 = wm2*Cnm(n+2,m-2);  Double Sm2 = wm2*Snm(n+2,m-2);
         Double Cm1 = wm1*Cnm(n+2,m-1);  Double Sm1 = wm1*Snm(n+2,m-1);
         Double Cm0 = wm0*Cnm(n+2,m  );  Double Sm0 = wm0*Snm(n+2,m  );
         Double Cp1 = wp1*Cnm(n+2,m+1);  Double Sp1 = wp1*Snm(n+2,m+1);
@@ -393,27 +401,66 @@ void ParametrizationGravityEarthquakeOscillation::gravityGradient(const Time &ti
 
         if(idxC[n][m]!=NULLINDEX)
         {
-          B(0, idxC[n][m]) = factor * ( Cm2 - 2*Cm0 + Cp2);
-          B(1, idxC[n][m]) = factor * (-Sm2         + Sp2);
+          B(0, idxC[n][m]) = factor * (- 3*Cm0 + Cp2);
+          B(1, idxC[n][m]) = factor * (-   Sm0 + Sp2);
           B(2, idxC[n][m]) = factor * (-2*Cm1 + 2*Cp1);
-          B(3, idxC[n][m]) = factor * (-Cm2 - 2*Cm0 - Cp2);
-          B(4, idxC[n][m]) = factor * ( 2*Sm1 + 2*Sp1);
+          B(3, idxC[n][m]) = factor * (-   Cm0 - Cp2);
+          B(4, idxC[n][m]) = factor * (2*Sp1);
           B(5, idxC[n][m]) = factor * (4*Cm0);
         }
 
         if(idxS[n][m]!=NULLINDEX)
         {
-          B(0, idxS[n][m]) = factor * ( Sm2 - 2*Sm0 + Sp2);
-          B(1, idxS[n][m]) = factor * ( Cm2         - Cp2);
+          B(0, idxS[n][m]) = factor * (- Sm0 + Sp2);
+          B(1, idxS[n][m]) = factor * (- Cm0 - Cp2);
           B(2, idxS[n][m]) = factor * (-2*Sm1 + 2*Sp1);
-          B(3, idxS[n][m]) = factor * (-Sm2 - 2*Sm0 - Sp2);
+          B(3, idxS[n][m]) = factor * (- 3*Sm0 - Sp2);
           B(4, idxS[n][m]) = factor * (-2*Cm1 - 2*Cp1);
           B(5, idxS[n][m]) = factor * (4*Sm0);
         }
-      }
-    }
+      } // end 1. order
 
-    coefficients(time, B, A);
+      // all other orders
+      for(UInt m=2; m<=maxDegree; m++)
+      {
+        for(UInt n=std::max(minDegree,m); n<=maxDegree; n++)
+        {
+          Double factor = sqrt((2.*n+1.)/(2.*n+5.))*GM/(4.*R*R*R);
+
+          Double wm2 = sqrt((n-m+1.)*(n-m+2.)*(n-m+3.)*(n-m+4.)) * ((m==2) ? sqrt(2.0) : 1.0);
+          Double wm1 = sqrt((n-m+1.)*(n-m+2.)*(n-m+3.)*(n+m+1.));
+          Double wm0 = sqrt((n-m+1.)*(n-m+2.)*(n+m+1.)*(n+m+2.));
+          Double wp1 = sqrt((n-m+1.)*(n+m+1.)*(n+m+2.)*(n+m+3.));
+          Double wp2 = sqrt((n+m+1.)*(n+m+2.)*(n+m+3.)*(n+m+4.));
+
+          Double Cm2 = wm2*Cnm(n+2,m-2);  Double Sm2 = wm2*Snm(n+2,m-2);
+          Double Cm1 = wm1*Cnm(n+2,m-1);  Double Sm1 = wm1*Snm(n+2,m-1);
+          Double Cm0 = wm0*Cnm(n+2,m  );  Double Sm0 = wm0*Snm(n+2,m  );
+          Double Cp1 = wp1*Cnm(n+2,m+1);  Double Sp1 = wp1*Snm(n+2,m+1);
+          Double Cp2 = wp2*Cnm(n+2,m+2);  Double Sp2 = wp2*Snm(n+2,m+2);
+
+          if(idxC[n][m]!=NULLINDEX)
+          {
+            B(0, idxC[n][m]) = factor * ( Cm2 - 2*Cm0 + Cp2);
+            B(1, idxC[n][m]) = factor * (-Sm2         + Sp2);
+            B(2, idxC[n][m]) = factor * (-2*Cm1 + 2*Cp1);
+            B(3, idxC[n][m]) = factor * (-Cm2 - 2*Cm0 - Cp2);
+            B(4, idxC[n][m]) = factor * ( 2*Sm1 + 2*Sp1);
+            B(5, idxC[n][m]) = factor * (4*Cm0);
+          }
+
+          if(idxS[n][m]!=NULLINDEX)
+          {
+            B(0, idxS[n][m]) = factor * ( Sm2 - 2*Sm0 + Sp2);
+            B(1, idxS[n][m]) = factor * ( Cm2         - Cp2);
+            B(2, idxS[n][m]) = factor * (-2*Sm1 + 2*Sp1);
+            B(3, idxS[n][m]) = factor * (-Sm2 - 2*Sm0 - Sp2);
+            B(4, idxS[n][m]) = factor * (-2*Cm1 - 2*Cp1);
+            B(5, idxS[n][m]) = factor * (4*Sm0);
+          }
+        }
+      }
+    });
   }
   catch(std::exception &e)
   {
@@ -425,76 +472,86 @@ void ParametrizationGravityEarthquakeOscillation::gravityGradient(const Time &ti
 
 void ParametrizationGravityEarthquakeOscillation::deformation(const Time &time, const Vector3d &point, Double gravity, const Vector &hn, const Vector &ln, MatrixSliceRef A) const
 {
-  try
-  {
-    Vector3d up = normalize(point);
-    Matrix Cnm, Snm;
-    SphericalHarmonics::CnmSnm(1/R * point, maxDegree+1, Cnm, Snm);
-    Matrix B(3, parameterCount()/3);
-
-    // 0. order
-    for(UInt n=minDegree; n<=maxDegree; n++)
-    {
-      Double wm0 = sqrt((n+1.)*(n+1.));
-      Double wp1 = sqrt((n+1.)*(n+2.)) / sqrt(2.0);
-      Double Cm0 = wm0*Cnm(n+1,0);
-      Double Cp1 = wp1*Cnm(n+1,1); Double Sp1 = wp1*Snm(n+1,1);
-
-      if(idxC[n][0]!=NULLINDEX)
-      {
-        Double   Vn     = GM/R * Cnm(n,0);
-        Vector3d gradVn = GM/(2*R) * sqrt((2*n+1.)/(2*n+3.)) * Vector3d(-2*Cp1, -2*Sp1, -2*Cm0);
-
-
-        Vector3d disp = (hn(n)/gravity*Vn) * up // vertical
-                      + (ln(n)/gravity) * (gradVn-inner(gradVn,up)*up); // horizontal
+  deformation(std::vector<Time>{time}, std::vector<Vector3d>{point}, std::vector<Double>{gravity}, hn, ln, A);
+}
 
-        B(0, idxC[n][0]) = disp.x();
-        B(1, idxC[n][0]) = disp.y();
-        B(2, idxC[n][0]) = disp.z();
-      }
-    }
+/***********************************************/
 
-    // other orders
-    for(UInt m=1; m<=maxDegree; m++)
+void ParametrizationGravityEarthquakeOscillation::deformation(const std::vector<Time> &times, const std::vector<Vector3d> &points, const std::vector<Double> &gravity, const Vector &hn, const Vector &ln, MatrixSliceRef A) const
+{
+  try
+  {
+    designMatrix(times, 3, A, [&](UInt idPoint, MatrixSliceRef B)
     {
-      for(UInt n=std::max(minDegree,m); n<=maxDegree; n++)
+      const Vector3d &point = points.at(idPoint);
+      const Double    gravityPoint = gravity.at(idPoint);
+      Vector3d up = normalize(point);
+      Matrix Cnm, Snm;
+      SphericalHarmonics::CnmSnm(1/R * point, maxDegree+1, Cnm, Snm);
+
+      // 0. order
+      for(UInt n=minDegree; n<=maxDegree; n++)
       {
-        Double wm1 = sqrt((n-m+1.)*(n-m+2.)) * ((m==1) ? sqrt(2.0) : 1.0);
-        Double wm0 = sqrt((n-m+1.)*(n+m+1.));
-        Double wp1 = sqrt((n+m+1.)*(n+m+2.));
-        Double Cm1 = wm1*Cnm(n+1,m-1);  Double Sm1 = wm1*Snm(n+1,m-1);
-        Double Cm0 = wm0*Cnm(n+1,m  );  Double Sm0 = wm0*Snm(n+1,m  );
-        Double Cp1 = wp1*Cnm(n+1,m+1);  Double Sp1 = wp1*Snm(n+1,m+1);
+        Double wm0 = sqrt((n+1.)*(n+1.));
+        Double wp1 = sqrt((n+1.)*(n+2.)) / sqrt(2.0);
+        Double Cm0 = wm0*Cnm(n+1,0);
+        Double Cp1 = wp1*Cnm(n+1,1); Double Sp1 = wp1*Snm(n+1,1);
 
-        if(idxC[n][m]!=NULLINDEX)
+        if(idxC[n][0]!=NULLINDEX)
         {
-          Double   Vn     = GM/R * Cnm(n,m);
-          Vector3d gradVn = GM/(2*R) * sqrt((2*n+1.)/(2*n+3.)) * Vector3d(Cm1-Cp1, -Sm1-Sp1, -2*Cm0);
+          Double   Vn     = GM/R * Cnm(n,0);
+          Vector3d gradVn = GM/(2*R) * sqrt((2*n+1.)/(2*n+3.)) * Vector3d(-2*Cp1, -2*Sp1, -2*Cm0);
 
-          Vector3d disp = (hn(n)/gravity*Vn) * up // vertical
-                        + (ln(n)/gravity) * (gradVn-inner(gradVn,up)*up); // horizontal
 
-          B(0, idxC[n][m]) = disp.x();
-          B(1, idxC[n][m]) = disp.y();
-          B(2, idxC[n][m]) = disp.z();
+          Vector3d disp = (hn(n)/gravityPoint*Vn) * up // vertical
+                        + (ln(n)/gravityPoint) * (gradVn-inner(gradVn,up)*up); // horizontal
+
+          B(0, idxC[n][0]) = disp.x();
+          B(1, idxC[n][0]) = disp.y();
+          B(2, idxC[n][0]) = disp.z();
         }
+      }
 
-        if(idxS[n][m]!=NULLINDEX)
+      // other orders
+      for(UInt m=1; m<=maxDegree; m++)
+      {
+        for(UInt n=std::max(minDegree,m); n<=maxDegree; n++)
         {
-          Double   Vn     = GM/R * Snm(n,m);
-          Vector3d gradVn = GM/(2*R) * sqrt((2*n+1.)/(2*n+3.)) * Vector3d(Sm1-Sp1, Cm1+Cp1, -2*Sm0);
-
-          Vector3d disp = (hn(n)/gravity*Vn) * up // vertical
-                        + (ln(n)/gravity) * (gradVn-inner(gradVn,up)*up); // horizontal
-
-          B(0, idxS[n][m]) = disp.x();
-          B(1, idxS[n][m]) = disp.y();
-          B(2, idxS[n][m]) = disp.z();
+          Double wm1 = sqrt((n-m+1.)*(n-m+2.)) * ((m==1) ? sqrt(2.0) : 1.0);
+          Double wm0 = sqrt((n-m+1.)*(n+m+1.));
+          Double wp1 = sqrt((n+m+1.)*(n+m+2.));
+          Double Cm1 = wm1*Cnm(n+1,m-1);  Double Sm1 = wm1*Snm(n+1,m-1);
+          Double Cm0 = wm0*Cnm(n+1,m  );  Double Sm0 = wm0*Snm(n+1,m  );
+          Double Cp1 = wp1*Cnm(n+1,m+1);  Double Sp1 = wp1*Snm(n+1,m+1);
+
+          if(idxC[n][m]!=NULLINDEX)
+          {
+            Double   Vn     = GM/R * Cnm(n,m);
+            Vector3d gradVn = GM/(2*R) * sqrt((2*n+1.)/(2*n+3.)) * Vector3d(Cm1-Cp1, -Sm1-Sp1, -2*Cm0);
+
+            Vector3d disp = (hn(n)/gravityPoint*Vn) * up // vertical
+                          + (ln(n)/gravityPoint) * (gradVn-inner(gradVn,up)*up); // horizontal
+
+            B(0, idxC[n][m]) = disp.x();
+            B(1, idxC[n][m]) = disp.y();
+            B(2, idxC[n][m]) = disp.z();
+          }
+
+          if(idxS[n][m]!=NULLINDEX)
+          {
+            Double   Vn     = GM/R * Snm(n,m);
+            Vector3d gradVn = GM/(2*R) * sqrt((2*n+1.)/(2*n+3.)) * Vector3d(Sm1-Sp1, Cm1+Cp1, -2*Sm0);
+
+            Vector3d disp = (hn(n)/gravityPoint*Vn) * up // vertical
+                          + (ln(n)/gravityPoint) * (gradVn-inner(gradVn,up)*up); // horizontal
+
+            B(0, idxS[n][m]) = disp.x();
+            B(1, idxS[n][m]) = disp.y();
+            B(2, idxS[n][m]) = disp.z();
+          }
         }
       }
-    }
-    coefficients(time, B, A);
+    });
   }
   catch(std::exception &e)
   {
@@ -42,7 +42,7 @@ $n$ is the overtone factor, $m$ is degree, $l$ is order, and $t$ is time after e
 class ParametrizationGravityEarthquakeOscillation : public ParametrizationGravityBase
 {
   SphericalHarmonicsNumberingPtr numbering;
-  Matrix mx;
+  Vector amplitude, omega, damping; // initial values per coefficient
 
   std::vector<std::vector<UInt>> idxC, idxS;
   Time     time0;
@@ -50,11 +50,14 @@ class ParametrizationGravityEarthquakeOscillation : public ParametrizationGravit
   UInt     maxDegree, minDegree;
   Double   GM,R;
 
+  Matrix temporalFactors(const Time &time) const;
+  void   coefficients(const Matrix &factors, const_MatrixSliceRef B, MatrixSliceRef A) const;
+  void   designMatrix(const std::vector<Time> &times, UInt rowsPerPoint, MatrixSliceRef A, std::function<void(UInt idPoint, MatrixSliceRef B)> spatial) const;
+
 public:
   ParametrizationGravityEarthquakeOscillation(Config &config);
 
   UInt parameterCount() const {return _parameterCount;}
-  void coefficients(const Time &time,  MatrixSliceRef B,  MatrixSliceRef A) const;
   void parameterName(std::vector<ParameterName> &name) const;
   void field          (const Time &time, const Vector3d &point, const Kernel &kernel, MatrixSliceRef A) const;
   void potential      (const Time &time, const Vector3d &point, MatrixSliceRef A) const;
@@ -62,6 +65,12 @@ public:
   void gravity        (const Time &time, const Vector3d &point, MatrixSliceRef A) const;
   void gravityGradient(const Time &time, const Vector3d &point, MatrixSliceRef A) const;
   void deformation    (const Time &time, const Vector3d &point, Double gravity, const Vector &hn, const Vector &ln, MatrixSliceRef A) const;
+  void field          (const std::vector<Time> &times, const std::vector<Vector3d> &points, const Kernel &kernel, MatrixSliceRef A) const;
+  void potential      (const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const;
+  void radialGradient (const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const;
+  void gravity        (const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const;
+  void gravityGradient(const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const;
+  void deformation    (const std::vector<Time> &times, const std::vector<Vector3d> &points, const std::vector<Double> &gravity, const Vector &hn, const Vector &ln, MatrixSliceRef A) const;
   SphericalHarmonics sphericalHarmonics(const Time &time, const Vector &x, UInt maxDegree) const;
   SphericalHarmonics sphericalHarmonics(const Time &time, const Vector &x, const Vector &sigma2x, UInt maxDegree) const;
 };
@@ -26,12 +26,24 @@ ParametrizationGravityRadialBasis::ParametrizationGravityRadialBasis(Config &con
   try
   {
     GridPtr grid;
+    Double  distanceMax = 0;
 
-    readConfig(config, "kernel",kernel, Config::MUSTSET, "", "shape of the radial basis function");
-    readConfig(config, "grid",  grid,   Config::MUSTSET, "", "nodal point distribution");
+    readConfig(config, "kernel",      kernel,      Config::MUSTSET,  "", "shape of the radial basis function");
+    readConfig(config, "grid",        grid,        Config::MUSTSET,  "", "nodal point distribution");
+    readConfig(config, "distanceMax", distanceMax, Config::OPTIONAL, "", "[km] max. influence distance of basis functions (ignore far zone)");
     if(isCreateSchema(config)) return;
 
     sourcePoint = grid->points();
+
+    chordMax = 0;
+    if((distanceMax > 0) && (distanceMax/(DEFAULT_R*1e-3) < PI))
+    {
+      chordMax = 2*std::sin(0.5*distanceMax/(DEFAULT_R*1e-3));
+      std::vector<Vector3d> points(sourcePoint.size());
+      for(UInt i=0; i<sourcePoint.size(); i++)
+        points.at(i) = normalize(sourcePoint.at(i));
+      tree.init(points);
+    }
   }
   catch(std::exception &e)
   {
@@ -49,9 +61,23 @@ void ParametrizationGravityRadialBasis::parameterName(std::vector<ParameterName>
 
 /***********************************************/
 
+std::vector<UInt> ParametrizationGravityRadialBasis::nearSource(const Vector3d &point, MatrixSliceRef A) const
+{
+  if(!chordMax)
+  {
+    std::vector<UInt> index(sourcePoint.size());
+    std::iota(index.begin(), index.end(), 0);
+    return index;
+  }
+  A.setNull();
+  return tree.radiusSearch(normalize(point), chordMax);
+}
+
+/***********************************************/
+
 void ParametrizationGravityRadialBasis::field(const Time &/*time*/, const Vector3d &point, const Kernel &kernel2, MatrixSliceRef A) const
 {
-  for(UInt i=0; i<sourcePoint.size(); i++)
+  for(UInt i : nearSource(point, A))
     A(0,i) = kernel2.inverseKernel(point, sourcePoint.at(i), *kernel);
 }
 
@@ -59,7 +85,7 @@ void ParametrizationGravityRadialBasis::field(const Time &/*time*/, const Vector
 
 void ParametrizationGravityRadialBasis::potential(const Time &/*time*/, const Vector3d &point, MatrixSliceRef A) const
 {
-  for(UInt i=0; i<sourcePoint.size(); i++)
+  for(UInt i : nearSource(point, A))
     A(0,i) = kernel->kernel(point, sourcePoint.at(i));
 }
 
@@ -67,7 +93,7 @@ void ParametrizationGravityRadialBasis::potential(const Time &/*time*/, const Ve
 
 void ParametrizationGravityRadialBasis::radialGradient(const Time &/*time*/, const Vector3d &point, MatrixSliceRef A) const
 {
-  for(UInt i=0; i<sourcePoint.size(); i++)
+  for(UInt i : nearSource(point, A))
     A(0,i) = kernel->radialDerivative(point, sourcePoint.at(i));
 }
 
@@ -75,7 +101,7 @@ void ParametrizationGravityRadialBasis::radialGradient(const Time &/*time*/, con
 
 void ParametrizationGravityRadialBasis::gravity(const Time &/*time*/, const Vector3d &point, MatrixSliceRef A) const
 {
-  for(UInt i=0; i<sourcePoint.size(); i++)
+  for(UInt i : nearSource(point, A))
   {
     Vector3d field = kernel->gradient(point, sourcePoint.at(i));
     A(0,i) = field.x();
@@ -88,7 +114,7 @@ void ParametrizationGravityRadialBasis::gravity(const Time &/*time*/, const Vect
 
 void ParametrizationGravityRadialBasis::gravityGradient(const Time &/*time*/, const Vector3d &point, MatrixSliceRef A) const
 {
-  for(UInt i=0; i<sourcePoint.size(); i++)
+  for(UInt i : nearSource(point, A))
   {
     Tensor3d field = kernel->gradientGradient(point, sourcePoint.at(i));
     A(0,i) = field.xx();
@@ -29,11 +29,17 @@ functions given by isotropic radial \configClass{kernel}{kernelType} functions
 \end{equation}
 The basis functions are located on a grid~$\M x_i$ given by \configClass{grid}{gridType}.
 This class can also be used to estimate point masses if \configClass{kernel}{kernelType} is set to density.
+
+If \config{distanceMax} is set, basis functions farther away from an evaluation point
+are neglected (set to zero in the design matrix). The nodes within this distance are found with a spatial index,
+so only the near field is evaluated. The neglected part depends on the decay of the kernel
+and should be checked with \program{KernelEvaluate}.
 )";
 #endif
 
 /***********************************************/
 
+#include "base/kdTree.h"
 #include "classes/parametrizationGravity/parametrizationGravity.h"
 
 /***** CLASS ***********************************/
@@ -45,6 +51,11 @@ class ParametrizationGravityRadialBasis : public ParametrizationGravityBase
 {
   KernelPtr kernel;                  // basis functions
   std::vector<Vector3d> sourcePoint; // center of basis functions
+  Double    chordMax;                // max. influence distance on unit sphere (0: all)
+  KdTree    tree;                    // nodes projected on unit sphere
+
+  // indices of basis functions within distanceMax, all others are set to zero in A
+  std::vector<UInt> nearSource(const Vector3d &point, MatrixSliceRef A) const;
 
 public:
   ParametrizationGravityRadialBasis(Config &config);
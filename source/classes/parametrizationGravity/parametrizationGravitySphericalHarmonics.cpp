@@ -21,6 +21,10 @@
 
 /***********************************************/
 
+constexpr UInt ParametrizationGravitySphericalHarmonics::blockSize;
+
+/***********************************************/
+
 ParametrizationGravitySphericalHarmonics::ParametrizationGravitySphericalHarmonics(Config &config)
 {
   try
@@ -86,22 +90,51 @@ void ParametrizationGravitySphericalHarmonics::field(const Time &/*time*/, const
 
 /***********************************************/
 
-void ParametrizationGravitySphericalHarmonics::potential(const Time &/*time*/, const Vector3d &point, MatrixSliceRef A) const
+void ParametrizationGravitySphericalHarmonics::CnmSnm(const std::vector<Vector3d> &points, UInt start, UInt count, UInt degree, Matrix &Cnm, Matrix &Snm) const
+{
+  std::vector<Vector3d> p(count);
+  for(UInt k=0; k<count; k++)
+    p[k] = 1/R * points.at(start+k);
+  SphericalHarmonics::CnmSnm(p, degree, Cnm, Snm);
+}
+
+/***********************************************/
+
+// column of degree n and order m of the batched basis functions
+inline static const Double *column(const Matrix &A, UInt n, UInt m) {return A.field() + (n*(n+1)/2+m)*A.ld();}
+
+/***********************************************/
+
+void ParametrizationGravitySphericalHarmonics::potential(const Time &time, const Vector3d &point, MatrixSliceRef A) const
+{
+  potential(std::vector<Time>{time}, std::vector<Vector3d>{point}, A);
+}
+
+/***********************************************/
+
+void ParametrizationGravitySphericalHarmonics::potential(const std::vector<Time> &/*times*/, const std::vector<Vector3d> &points, MatrixSliceRef A) const
 {
   try
   {
+    const Double factor = GM/R;
     Matrix Cnm, Snm;
-    SphericalHarmonics::CnmSnm(1/R * point, maxDegree, Cnm, Snm);
-
-    Double factor = GM/R;
-    for(UInt n=minDegree; n<=maxDegree; n++)
+    for(UInt start=0; start<points.size(); start+=blockSize)
     {
-      if(idxC[n][0]!=NULLINDEX) A(0, idxC[n][0]) = factor * Cnm(n,0);
-      for(UInt m=1; m<=n; m++)
-      {
-        if(idxC[n][m]!=NULLINDEX) A(0, idxC[n][m]) = factor * Cnm(n,m);
-        if(idxS[n][m]!=NULLINDEX) A(0, idxS[n][m]) = factor * Snm(n,m);
-      }
+      const UInt count = std::min(blockSize, points.size()-start);
+      CnmSnm(points, start, count, maxDegree, Cnm, Snm);
+      MatrixSlice Ak(A.row(start, count));
+
+      for(UInt n=minDegree; n<=maxDegree; n++)
+        for(UInt m=0; m<=n; m++)
+        {
+          const Double *c = column(Cnm, n, m), *s = column(Snm, n, m);
+          if(idxC[n][m]!=NULLINDEX)
+            for(UInt k=0; k<count; k++)
+              Ak(k, idxC[n][m]) = factor * c[k];
+          if(m && (idxS[n][m]!=NULLINDEX))
+            for(UInt k=0; k<count; k++)
+              Ak(k, idxS[n][m]) = factor * s[k];
+        }
     }
   }
   catch(std::exception &e)
@@ -112,22 +145,38 @@ void ParametrizationGravitySphericalHarmonics::potential(const Time &/*time*/, c
 
 /***********************************************/
 
-void ParametrizationGravitySphericalHarmonics::radialGradient(const Time &/*time*/, const Vector3d &point, MatrixSliceRef A) const
+void ParametrizationGravitySphericalHarmonics::radialGradient(const Time &time, const Vector3d &point, MatrixSliceRef A) const
+{
+  radialGradient(std::vector<Time>{time}, std::vector<Vector3d>{point}, A);
+}
+
+/***********************************************/
+
+void ParametrizationGravitySphericalHarmonics::radialGradient(const std::vector<Time> &/*times*/, const std::vector<Vector3d> &points, MatrixSliceRef A) const
 {
   try
   {
     Matrix Cnm, Snm;
-    SphericalHarmonics::CnmSnm(1/R * point, maxDegree, Cnm, Snm);
-
-    Double factor = -GM/R/point.r();
-    for(UInt n=minDegree; n<=maxDegree; n++)
+    for(UInt start=0; start<points.size(); start+=blockSize)
     {
-      if(idxC[n][0]!=NULLINDEX) A(0, idxC[n][0]) = factor * (n+1) * Cnm(n,0);
-      for(UInt m=1; m<=n; m++)
-      {
-        if(idxC[n][m]!=NULLINDEX) A(0, idxC[n][m]) = factor * (n+1) * Cnm(n,m);
-        if(idxS[n][m]!=NULLINDEX) A(0, idxS[n][m]) = factor * (n+1) * Snm(n,m);
-      }
+      const UInt count = std::min(blockSize, points.size()-start);
+      CnmSnm(points, start, count, maxDegree, Cnm, Snm);
+      MatrixSlice Ak(A.row(start, count));
+      Vector factor(count);
+      for(UInt k=0; k<count; k++)
+        factor(k) = -GM/R/points.at(start+k).r();
+
+      for(UInt n=minDegree; n<=maxDegree; n++)
+        for(UInt m=0; m<=n; m++)
+        {
+          const Double *c = column(Cnm, n, m), *s = column(Snm, n, m);
+          if(idxC[n][m]!=NULLINDEX)
+            for(UInt k=0; k<count; k++)
+              Ak(k, idxC[n][m]) = factor(k) * (n+1) * c[k];
+          if(m && (idxS[n][m]!=NULLINDEX))
+            for(UInt k=0; k<count; k++)
+              Ak(k, idxS[n][m]) = factor(k) * (n+1) * s[k];
+        }
     }
   }
   catch(std::exception &e)
@@ -138,60 +187,80 @@ void ParametrizationGravitySphericalHarmonics::radialGradient(const Time &/*time
 
 /***********************************************/
 
-void ParametrizationGravitySphericalHarmonics::gravity(const Time &/*time*/, const Vector3d &point, MatrixSliceRef A) const
+void ParametrizationGravitySphericalHarmonics::gravity(const Time &time, const Vector3d &point, MatrixSliceRef A) const
+{
+  gravity(std::vector<Time>{time}, std::vector<Vector3d>{point}, A);
+}
+
+/***********************************************/
+
+void ParametrizationGravitySphericalHarmonics::gravity(const std::vector<Time> &/*times*/, const std::vector<Vector3d> &points, MatrixSliceRef A) const
 {
   try
   {
     Matrix Cnm, Snm;
-    SphericalHarmonics::CnmSnm(1/R * point, maxDegree+1, Cnm, Snm);
-
-    // 0. Order
-    for(UInt n=minDegree; n<=maxDegree; n++)
+    for(UInt start=0; start<points.size(); start+=blockSize)
     {
-      Double factor = sqrt((2.*n+1.)/(2.*n+3.))*GM/(2.*R*R);
-
-      Double wm0 = sqrt((n+1.)*(n+1.));
-      Double wp1 = sqrt((n+1.)*(n+2.)) / sqrt(2.0);
-
-      Double Cm0 = wm0*Cnm(n+1,0);
-      Double Cp1 = wp1*Cnm(n+1,1); Double Sp1 = wp1*Snm(n+1,1);
+      const UInt count = std::min(blockSize, points.size()-start);
+      CnmSnm(points, start, count, maxDegree+1, Cnm, Snm);
+      MatrixSlice Ak(A.row(3*start, 3*count));
 
-      if(idxC[n][0]!=NULLINDEX)
+      // 0. Order
+      for(UInt n=minDegree; n<=maxDegree; n++)
       {
-        A(0, idxC[n][0]) = factor*(-2*Cp1);
-        A(1, idxC[n][0]) = factor*(-2*Sp1);
-        A(2, idxC[n][0]) = factor*(-2*Cm0);
-      }
-    }
+        if(idxC[n][0]==NULLINDEX)
+          continue;
 
-    // all other orders
-    for(UInt m=1; m<=maxDegree; m++)
-      for(UInt n=std::max(minDegree,m); n<=maxDegree; n++)
-      {
-        Double factor = sqrt((2.*n+1.)/(2.*n+3.))*GM/(2.*R*R);
-
-        Double wm1 = sqrt((n-m+1.)*(n-m+2.)) * ((m==1) ? sqrt(2.0) : 1.0);
-        Double wm0 = sqrt((n-m+1.)*(n+m+1.));
-        Double wp1 = sqrt((n+m+1.)*(n+m+2.));
-
-        Double Cm1 = wm1*Cnm(n+1,m-1);  Double Sm1 = wm1*Snm(n+1,m-1);
-        Double Cm0 = wm0*Cnm(n+1,m  );  Double Sm0 = wm0*Snm(n+1,m  );
-        Double Cp1 = wp1*Cnm(n+1,m+1);  Double Sp1 = wp1*Snm(n+1,m+1);
+        const Double factor = sqrt((2.*n+1.)/(2.*n+3.))*GM/(2.*R*R);
+        const Double wm0 = sqrt((n+1.)*(n+1.));
+        const Double wp1 = sqrt((n+1.)*(n+2.)) / sqrt(2.0);
+        const Double *cm0 = column(Cnm, n+1, 0);
+        const Double *cp1 = column(Cnm, n+1, 1), *sp1 = column(Snm, n+1, 1);
 
-        if(idxC[n][m]!=NULLINDEX)
+        const UInt idx = idxC[n][0];
+        for(UInt k=0; k<count; k++)
         {
-          A(0, idxC[n][m]) = factor*( Cm1 - Cp1);
-          A(1, idxC[n][m]) = factor*(-Sm1 - Sp1);
-          A(2, idxC[n][m]) = factor*(-2*Cm0);
+          Ak(3*k+0, idx) = factor*(-2*wp1*cp1[k]);
+          Ak(3*k+1, idx) = factor*(-2*wp1*sp1[k]);
+          Ak(3*k+2, idx) = factor*(-2*wm0*cm0[k]);
         }
+      }
 
-        if(idxS[n][m]!=NULLINDEX)
+      // all other orders
+      for(UInt m=1; m<=maxDegree; m++)
+        for(UInt n=std::max(minDegree,m); n<=maxDegree; n++)
         {
-          A(0, idxS[n][m]) = factor*(Sm1 - Sp1);
-          A(1, idxS[n][m]) = factor*(Cm1 + Cp1);
-          A(2, idxS[n][m]) = factor*(-2*Sm0);
+          const Double factor = sqrt((2.*n+1.)/(2.*n+3.))*GM/(2.*R*R);
+          const Double wm1 = sqrt((n-m+1.)*(n-m+2.)) * ((m==1) ? sqrt(2.0) : 1.0);
+          const Double wm0 = sqrt((n-m+1.)*(n+m+1.));
+          const Double wp1 = sqrt((n+m+1.)*(n+m+2.));
+          const Double *cm1 = column(Cnm, n+1, m-1), *sm1 = column(Snm, n+1, m-1);
+          const Double *cm0 = column(Cnm, n+1, m  ), *sm0 = column(Snm, n+1, m  );
+          const Double *cp1 = column(Cnm, n+1, m+1), *sp1 = column(Snm, n+1, m+1);
+
+          if(idxC[n][m]!=NULLINDEX)
+          {
+            const UInt idx = idxC[n][m];
+            for(UInt k=0; k<count; k++)
+            {
+              Ak(3*k+0, idx) = factor*( wm1*cm1[k] - wp1*cp1[k]);
+              Ak(3*k+1, idx) = factor*(-wm1*sm1[k] - wp1*sp1[k]);
+              Ak(3*k+2, idx) = factor*(-2*wm0*cm0[k]);
+            }
+          }
+
+          if(idxS[n][m]!=NULLINDEX)
+          {
+            const UInt idx = idxS[n][m];
+            for(UInt k=0; k<count; k++)
+            {
+              Ak(3*k+0, idx) = factor*(wm1*sm1[k] - wp1*sp1[k]);
+              Ak(3*k+1, idx) = factor*(wm1*cm1[k] + wp1*cp1[k]);
+              Ak(3*k+2, idx) = factor*(-2*wm0*sm0[k]);
+            }
+          }
         }
-      }
+    }
   }
   catch(std::exception &e)
   {
@@ -201,112 +270,159 @@ void ParametrizationGravitySphericalHarmonics::gravity(const Time &/*time*/, con
 
 /***********************************************/
 
-void ParametrizationGravitySphericalHarmonics::gravityGradient(const Time &/*time*/, const Vector3d &point, MatrixSliceRef A) const
+void ParametrizationGravitySphericalHarmonics::gravityGradient(const Time &time, const Vector3d &point, MatrixSliceRef A) const
+{
+  gravityGradient(std::vector<Time>{time}, std::vector<Vector3d>{point}, A);
+}
+
+/***********************************************/
+
+void ParametrizationGravitySphericalHarmonics::gravityGradient(const std::vector<Time> &/*times*/, const std::vector<Vector3d> &points, MatrixSliceRef A) const
 {
   try
   {
     Matrix Cnm, Snm;
-    SphericalHarmonics::CnmSnm(1/R * point, maxDegree+2, Cnm, Snm);
-
-    // 0. Order
-    for(UInt n=minDegree; n<=maxDegree; n++)
+    for(UInt start=0; start<points.size(); start+=blockSize)
     {
-      Double factor = sqrt((2.*n+1.)/(2.*n+5.))*GM/(4.*R*R*R);
-
-      Double wm0 = sqrt((n+1.)*(n+2.)*(n+1.)*(n+2.));
-      Double wp1 = sqrt((n+1.)*(n+1.)*(n+2.)*(n+3.)) / sqrt(2.0);
-      Double wp2 = sqrt((n+1.)*(n+2.)*(n+3.)*(n+4.)) / sqrt(2.0);
+      const UInt count = std::min(blockSize, points.size()-start);
+      CnmSnm(points, start, count, maxDegree+2, Cnm, Snm);
+      MatrixSlice Ak(A.row(6*start, 6*count));
 
-      Double Cm0 = wm0*Cnm(n+2,0);
-      Double Cp1 = wp1*Cnm(n+2,1);  Double Sp1 = wp1*Snm(n+2,1);
-      Double Cp2 = wp2*Cnm(n+2,2);  Double Sp2 = wp2*Snm(n+2,2);
-
-      if(idxC[n][0]!=NULLINDEX)
+      // 0. Order
+      for(UInt n=minDegree; n<=maxDegree; n++)
       {
-        A(0, idxC[n][0]) = factor * (-2*Cm0 + 2*Cp2);
-        A(1, idxC[n][0]) = factor * ( 2*Sp2);
-        A(2, idxC[n][0]) = factor * ( 4*Cp1);
-        A(3, idxC[n][0]) = factor * (-2*Cm0 - 2*Cp2);
-        A(4, idxC[n][0]) = factor * ( 4*Sp1);
-        A(5, idxC[n][0]) = factor * ( 4*Cm0);
-      }
-    }
-
-    // 1. order
-    UInt m=1;
-    for(UInt n=std::max(minDegree, static_cast<UInt>(1)); n<=maxDegree; n++)
-    {
-      Double factor = sqrt((2.*n+1.)/(2.*n+5.))*GM/(4.*R*R*R);
-
-      Double wm1 = sqrt((n-m+1.)*(n-m+2.)*(n-m+3.)*(n+m+1.)) * sqrt(2.0);
-      Double wm0 = sqrt((n-m+1.)*(n-m+2.)*(n+m+1.)*(n+m+2.));
-      Double wp1 = sqrt((n-m+1.)*(n+m+1.)*(n+m+2.)*(n+m+3.));
-      Double wp2 = sqrt((n+m+1.)*(n+m+2.)*(n+m+3.)*(n+m+4.));
-
-      Double Cm1 = wm1*Cnm(n+2,m-1);  Double Sm1 = wm1*Snm(n+2,m-1);
-      Double Cm0 = wm0*Cnm(n+2,m  );  Double Sm0 = wm0*Snm(n+2,m  );
-      Double Cp1 = wp1*Cnm(n+2,m+1);  Double Sp1 = wp1*Snm(n+2,m+1);
-      Double Cp2 = wp2*Cnm(n+2,m+2);  Double Sp2 = wp2*Snm(n+2,m+2);
-
-      if(idxC[n][m]!=NULLINDEX)
-      {
-        A(0, idxC[n][m]) = factor * (- 3*Cm0 + Cp2);
-        A(1, idxC[n][m]) = factor * (-   Sm0 + Sp2);
-        A(2, idxC[n][m]) = factor * (-2*Cm1 + 2*Cp1);
-        A(3, idxC[n][m]) = factor * (-   Cm0 - Cp2);
-        A(4, idxC[n][m]) = factor * (2*Sp1);
-        A(5, idxC[n][m]) = factor * (4*Cm0);
-      }
-
-      if(idxS[n][m]!=NULLINDEX)
-      {
-        A(0, idxS[n][m]) = factor * (- Sm0 + Sp2);
-        A(1, idxS[n][m]) = factor * (- Cm0 - Cp2);
-        A(2, idxS[n][m]) = factor * (-2*Sm1 + 2*Sp1);
-        A(3, idxS[n][m]) = factor * (- 3*Sm0 - Sp2);
-        A(4, idxS[n][m]) = factor * (-2*Cm1 - 2*Cp1);
-        A(5, idxS[n][m]) = factor * (4*Sm0);
+        if(idxC[n][0]==NULLINDEX)
+          continue;
+
+        const Double factor = sqrt((2.*n+1.)/(2.*n+5.))*GM/(4.*R*R*R);
+        const Double wm0 = sqrt((n+1.)*(n+2.)*(n+1.)*(n+2.));
+        const Double wp1 = sqrt((n+1.)*(n+1.)*(n+2.)*(n+3.)) / sqrt(2.0);
+        const Double wp2 = sqrt((n+1.)*(n+2.)*(n+3.)*(n+4.)) / sqrt(2.0);
+        const Double *cm0 = column(Cnm, n+2, 0);
+        const Double *cp1 = column(Cnm, n+2, 1), *sp1 = column(Snm, n+2, 1);
+        const Double *cp2 = column(Cnm, n+2, 2), *sp2 = column(Snm, n+2, 2);
+
+        const UInt idx = idxC[n][0];
+        for(UInt k=0; k<count; k++)
+        {
+          const Double Cm0 = wm0*cm0[k];
+          const Double Cp1 = wp1*cp1[k];  const Double Sp1 = wp1*sp1[k];
+          const Double Cp2 = wp2*cp2[k];  const Double Sp2 = wp2*sp2[k];
+          Ak(6*k+0, idx) = factor * (-2*Cm0 + 2*Cp2);
+          Ak(6*k+1, idx) = factor * ( 2*Sp2);
+          Ak(6*k+2, idx) = factor * ( 4*Cp1);
+          Ak(6*k+3, idx) = factor * (-2*Cm0 - 2*Cp2);
+          Ak(6*k+4, idx) = factor * ( 4*Sp1);
+          Ak(6*k+5, idx) = factor * ( 4*Cm0);
+        }
       }
-    } // end 1. order
 
-    // all other orders
-    for(UInt m=2; m<=maxDegree; m++)
-      for(UInt n=std::max(minDegree,m); n<=maxDegree; n++)
+      // 1. order
+      UInt m=1;
+      for(UInt n=std::max(minDegree, static_cast<UInt>(1)); n<=maxDegree; n++)
       {
-        Double factor = sqrt((2.*n+1.)/(2.*n+5.))*GM/(4.*R*R*R);
-
-        Double wm2 = sqrt((n-m+1.)*(n-m+2.)*(n-m+3.)*(n-m+4.)) * ((m==2) ? sqrt(2.0) : 1.0);
-        Double wm1 = sqrt((n-m+1.)*(n-m+2.)*(n-m+3.)*(n+m+1.));
-        Double wm0 = sqrt((n-m+1.)*(n-m+2.)*(n+m+1.)*(n+m+2.));
-        Double wp1 = sqrt((n-m+1.)*(n+m+1.)*(n+m+2.)*(n+m+3.));
-        Double wp2 = sqrt((n+m+1.)*(n+m+2.)*(n+m+3.)*(n+m+4.));
-
-        Double Cm2 = wm2*Cnm(n+2,m-2);  Double Sm2 = wm2*Snm(n+2,m-2);
-        Double Cm1 = wm1*Cnm(n+2,m-1);  Double Sm1 = wm1*Snm(n+2,m-1);
-        Double Cm0 = wm0*Cnm(n+2,m  );  Double Sm0 = wm0*Snm(n+2,m  );
-        Double Cp1 = wp1*Cnm(n+2,m+1);  Double Sp1 = wp1*Snm(n+2,m+1);
-        Double Cp2 = wp2*Cnm(n+2,m+2);  Double Sp2 = wp2*Snm(n+2,m+2);
+        const Double factor = sqrt((2.*n+1.)/(2.*n+5.))*GM/(4.*R*R*R);
+        const Double wm1 = sqrt((n-m+1.)*(n-m+2.)*(n-m+3.)*(n+m+1.)) * sqrt(2.0);
+        const Double wm0 = sqrt((n-m+1.)*(n-m+2.)*(n+m+1.)*(n+m+2.));
+        const Double wp1 = sqrt((n-m+1.)*(n+m+1.)*(n+m+2.)*(n+m+3.));
+        const Double wp2 = sqrt((n+m+1.)*(n+m+2.)*(n+m+3.)*(n+m+4.));
+        const Double *cm1 = column(Cnm, n+2, m-1), *sm1 = column(Snm, n+2, m-1);
+        const Double *cm0 = column(Cnm, n+2, m  ), *sm0 = column(Snm, n+2, m  );
+        const Double *cp1 = column(Cnm, n+2, m+1), *sp1 = column(Snm, n+2, m+1);
+        const Double *cp2 = column(Cnm, n+2, m+2), *sp2 = column(Snm, n+2, m+2);
 
         if(idxC[n][m]!=NULLINDEX)
         {
-          A(0, idxC[n][m]) = factor * ( Cm2 - 2*Cm0 + Cp2);
-          A(1, idxC[n][m]) = factor * (-Sm2         + Sp2);
-          A(2, idxC[n][m]) = factor * (-2*Cm1 + 2*Cp1);
-          A(3, idxC[n][m]) = factor * (-Cm2 - 2*Cm0 - Cp2);
-          A(4, idxC[n][m]) = factor * ( 2*Sm1 + 2*Sp1);
-          A(5, idxC[n][m]) = factor * (4*Cm0);
+          const UInt idx = idxC[n][m];
+          for(UInt k=0; k<count; k++)
+          {
+            const Double Cm1 = wm1*cm1[k];
+            const Double Cm0 = wm0*cm0[k];  const Double Sm0 = wm0*sm0[k];
+            const Double Cp1 = wp1*cp1[k];  const Double Sp1 = wp1*sp1[k];
+            const Double Cp2 = wp2*cp2[k];  const Double Sp2 = wp2*sp2[k];
+            Ak(6*k+0, idx) = factor * (- 3*Cm0 + Cp2);
+            Ak(6*k+1, idx) = factor * (-   Sm0 + Sp2);
+            Ak(6*k+2, idx) = factor * (-2*Cm1 + 2*Cp1);
+            Ak(6*k+3, idx) = factor * (-   Cm0 - Cp2);
+            Ak(6*k+4, idx) = factor * (2*Sp1);
+            Ak(6*k+5, idx) = factor * (4*Cm0);
+          }
         }
 
         if(idxS[n][m]!=NULLINDEX)
         {
-          A(0, idxS[n][m]) = factor * ( Sm2 - 2*Sm0 + Sp2);
-          A(1, idxS[n][m]) = factor * ( Cm2         - Cp2);
-          A(2, idxS[n][m]) = factor * (-2*Sm1 + 2*Sp1);
-          A(3, idxS[n][m]) = factor * (-Sm2 - 2*Sm0 - Sp2);
-          A(4, idxS[n][m]) = factor * (-2*Cm1 - 2*Cp1);
-          A(5, idxS[n][m]) = factor * (4*Sm0);
+          const UInt idx = idxS[n][m];
+          for(UInt k=0; k<count; k++)
+          {
+            const Double Cm1 = wm1*cm1[k];  const Double Sm1 = wm1*sm1[k];
+            const Double Cm0 = wm0*cm0[k];  const Double Sm0 = wm0*sm0[k];
+            const Double Cp1 = wp1*cp1[k];  const Double Sp1 = wp1*sp1[k];
+            const Double Cp2 = wp2*cp2[k];  const Double Sp2 = wp2*sp2[k];
+            Ak(6*k+0, idx) = factor * (- Sm0 + Sp2);
+            Ak(6*k+1, idx) = factor * (- Cm0 - Cp2);
+            Ak(6*k+2, idx) = factor * (-2*Sm1 + 2*Sp1);
+            Ak(6*k+3, idx) = factor * (- 3*Sm0 - Sp2);
+            Ak(6*k+4, idx) = factor * (-2*Cm1 - 2*Cp1);
+            Ak(6*k+5, idx) = factor * (4*Sm0);
+          }
         }
-      }
+      } // end 1. order
+
+      // all other orders
+      for(UInt m=2; m<=maxDegree; m++)
+        for(UInt n=std::max(minDegree,m); n<=maxDegree; n++)
+        {
+          const Double factor = sqrt((2.*n+1.)/(2.*n+5.))*GM/(4.*R*R*R);
+          const Double wm2 = sqrt((n-m+1.)*(n-m+2.)*(n-m+3.)*(n-m+4.)) * ((m==2) ? sqrt(2.0) : 1.0);
+          const Double wm1 = sqrt((n-m+1.)*(n-m+2.)*(n-m+3.)*(n+m+1.));
+          const Double wm0 = sqrt((n-m+1.)*(n-m+2.)*(n+m+1.)*(n+m+2.));
+          const Double wp1 = sqrt((n-m+1.)*(n+m+1.)*(n+m+2.)*(n+m+3.));
+          const Double wp2 = sqrt((n+m+1.)*(n+m+2.)*(n+m+3.)*(n+m+4.));
+          const Double *cm2 = column(Cnm, n+2, m-2), *sm2 = column(Snm, n+2, m-2);
+          const Double *cm1 = column(Cnm, n+2, m-1), *sm1 = column(Snm, n+2, m-1);
+          const Double *cm0 = column(Cnm, n+2, m  ), *sm0 = column(Snm, n+2, m  );
+          const Double *cp1 = column(Cnm, n+2, m+1), *sp1 = column(Snm, n+2, m+1);
+          const Double *cp2 = column(Cnm, n+2, m+2), *sp2 = column(Snm, n+2, m+2);
+
+          if(idxC[n][m]!=NULLINDEX)
+          {
+            const UInt idx = idxC[n][m];
+            for(UInt k=0; k<count; k++)
+            {
+              const Double Cm2 = wm2*cm2[k];  const Double Sm2 = wm2*sm2[k];
+              const Double Cm1 = wm1*cm1[k];  const Double Sm1 = wm1*sm1[k];
+              const Double Cm0 = wm0*cm0[k];
+              const Double Cp1 = wp1*cp1[k];  const Double Sp1 = wp1*sp1[k];
+              const Double Cp2 = wp2*cp2[k];  const Double Sp2 = wp2*sp2[k];
+              Ak(6*k+0, idx) = factor * ( Cm2 - 2*Cm0 + Cp2);
+              Ak(6*k+1, idx) = factor * (-Sm2         + Sp2);
+              Ak(6*k+2, idx) = factor * (-2*Cm1 + 2*Cp1);
+              Ak(6*k+3, idx) = factor * (-Cm2 - 2*Cm0 - Cp2);
+              Ak(6*k+4, idx) = factor * ( 2*Sm1 + 2*Sp1);
+              Ak(6*k+5, idx) = factor * (4*Cm0);
+            }
+          }
+
+          if(idxS[n][m]!=NULLINDEX)
+          {
+            const UInt idx = idxS[n][m];
+            for(UInt k=0; k<count; k++)
+            {
+              const Double Cm2 = wm2*cm2[k];  const Double Sm2 = wm2*sm2[k];
+              const Double Cm1 = wm1*cm1[k];  const Double Sm1 = wm1*sm1[k];
+              const Double Sm0 = wm0*sm0[k];
+              const Double Cp1 = wp1*cp1[k];  const Double Sp1 = wp1*sp1[k];
+              const Double Cp2 = wp2*cp2[k];  const Double Sp2 = wp2*sp2[k];
+              Ak(6*k+0, idx) = factor * ( Sm2 - 2*Sm0 + Sp2);
+              Ak(6*k+1, idx) = factor * ( Cm2         - Cp2);
+              Ak(6*k+2, idx) = factor * (-2*Sm1 + 2*Sp1);
+              Ak(6*k+3, idx) = factor * (-Sm2 - 2*Sm0 - Sp2);
+              Ak(6*k+4, idx) = factor * (-2*Cm1 - 2*Cp1);
+              Ak(6*k+5, idx) = factor * (4*Sm0);
+            }
+          }
+        }
+    }
   }
   catch(std::exception &e)
   {
@@ -49,6 +49,10 @@ class ParametrizationGravitySphericalHarmonics : public ParametrizationGravityBa
   UInt     maxDegree, minDegree;
   Double   GM, R;
 
+  static constexpr UInt blockSize = 16; // number of points computed simultaneously in batched evaluation
+
+  void CnmSnm(const std::vector<Vector3d> &points, UInt start, UInt count, UInt degree, Matrix &Cnm, Matrix &Snm) const;
+
 public:
   ParametrizationGravitySphericalHarmonics(Config &config);
 
@@ -60,6 +64,10 @@ public:
   void gravity        (const Time &time, const Vector3d &point, MatrixSliceRef A) const override;
   void gravityGradient(const Time &time, const Vector3d &point, MatrixSliceRef A) const override;
   void deformation    (const Time &time, const Vector3d &point, Double gravity, const Vector &hn, const Vector &ln, MatrixSliceRef A) const override;
+  void potential      (const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const override;
+  void radialGradient (const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const override;
+  void gravity        (const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const override;
+  void gravityGradient(const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const override;
   SphericalHarmonics sphericalHarmonics(const Time &time, const Vector &x, UInt maxDegree) const override;
   SphericalHarmonics sphericalHarmonics(const Time &time, const Vector &x, const Vector &sigma2x, UInt maxDegree) const override;
 };
@@ -155,7 +155,7 @@ void ParametrizationGravityTemporal::deformation(const Time &time, const Vector3
   try
   {
     Matrix B(3,spatial->parameterCount());
-    spatial->deformation(time, point, gravity, hn, ln, A);
+    spatial->deformation(time, point, gravity, hn, ln, B);
     temporal->designMatrix(time, B, A);
   }
   catch(std::exception &e)
@@ -164,6 +164,128 @@ void ParametrizationGravityTemporal::deformation(const Time &time, const Vector3
   }
 }
 
+/***********************************************/
+
+void ParametrizationGravityTemporal::designMatrix(const std::vector<Time> &times, UInt rowsPerPoint, const_MatrixSliceRef B, MatrixSliceRef A) const
+{
+  try
+  {
+    // only the active temporal blocks are filled, the others stay zero
+    const UInt count = spatial->parameterCount();
+    A.setNull();
+    std::vector<UInt>   index;
+    std::vector<Double> factor;
+    for(UInt k=0; k<times.size(); k++)
+    {
+      if(!k || (times.at(k) != times.at(k-1)))
+        temporal->factors(times.at(k), index, factor);
+      for(UInt i=0; i<index.size(); i++)
+        axpy(factor.at(i), B.row(k*rowsPerPoint, rowsPerPoint), A.slice(k*rowsPerPoint, index.at(i)*count, rowsPerPoint, count));
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void ParametrizationGravityTemporal::field(const std::vector<Time> &times, const std::vector<Vector3d> &points, const Kernel &kernel, MatrixSliceRef A) const
+{
+  try
+  {
+    Matrix B(points.size(), spatial->parameterCount());
+    spatial->field(times, points, kernel, B);
+    designMatrix(times, 1, B, A);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void ParametrizationGravityTemporal::potential(const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const
+{
+  try
+  {
+    Matrix B(points.size(), spatial->parameterCount());
+    spatial->potential(times, points, B);
+    designMatrix(times, 1, B, A);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void ParametrizationGravityTemporal::radialGradient(const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const
+{
+  try
+  {
+    Matrix B(points.size(), spatial->parameterCount());
+    spatial->radialGradient(times, points, B);
+    designMatrix(times, 1, B, A);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void ParametrizationGravityTemporal::gravity(const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const
+{
+  try
+  {
+    Matrix B(3*points.size(), spatial->parameterCount());
+    spatial->gravity(times, points, B);
+    designMatrix(times, 3, B, A);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void ParametrizationGravityTemporal::gravityGradient(const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const
+{
+  try
+  {
+    Matrix B(6*points.size(), spatial->parameterCount());
+    spatial->gravityGradient(times, points, B);
+    designMatrix(times, 6, B, A);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void ParametrizationGravityTemporal::deformation(const std::vector<Time> &times, const std::vector<Vector3d> &points, const std::vector<Double> &gravity,
+                                                 const Vector &hn, const Vector &ln, MatrixSliceRef A) const
+{
+  try
+  {
+    Matrix B(3*points.size(), spatial->parameterCount());
+    spatial->deformation(times, points, gravity, hn, ln, B);
+    designMatrix(times, 3, B, A);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
 /***********************************************/
 /***********************************************/
 
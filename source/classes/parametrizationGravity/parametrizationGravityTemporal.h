@@ -46,6 +46,9 @@ class ParametrizationGravityTemporal : public ParametrizationGravityBase
   ParametrizationGravityPtr  spatial;
   ParametrizationTemporalPtr temporal;
 
+  // spatial design matrix B of all points (rowsPerPoint each) into the active temporal blocks of A
+  void designMatrix(const std::vector<Time> &times, UInt rowsPerPoint, const_MatrixSliceRef B, MatrixSliceRef A) const;
+
 public:
   ParametrizationGravityTemporal(Config &config);
 
@@ -58,6 +61,12 @@ public:
   void gravity        (const Time &time, const Vector3d &point, MatrixSliceRef A) const override;
   void gravityGradient(const Time &time, const Vector3d &point, MatrixSliceRef A) const override;
   void deformation    (const Time &time, const Vector3d &point, Double gravity, const Vector &hn, const Vector &ln, MatrixSliceRef A) const override;
+  void field          (const std::vector<Time> &times, const std::vector<Vector3d> &points, const Kernel &kernel, MatrixSliceRef A) const override;
+  void potential      (const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const override;
+  void radialGradient (const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const override;
+  void gravity        (const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const override;
+  void gravityGradient(const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const override;
+  void deformation    (const std::vector<Time> &times, const std::vector<Vector3d> &points, const std::vector<Double> &gravity, const Vector &hn, const Vector &ln, MatrixSliceRef A) const override;
   SphericalHarmonics sphericalHarmonics(const Time &time, const Vector &x, UInt maxDegree) const override;
   SphericalHarmonics sphericalHarmonics(const Time &time, const Vector &x, const Vector &sigma2x, UInt maxDegree) const override;
 };
@@ -80,3 +80,39 @@ SphericalHarmonics SphericalHarmonicsFilter::filter(const SphericalHarmonics &ha
 }
 
 /***********************************************/
+
+/***********************************************/
+
+std::vector<SphericalHarmonics> SphericalHarmonicsFilter::filter(const std::vector<SphericalHarmonics> &harms) const
+{
+  try
+  {
+    std::vector<SphericalHarmonics> harms2 = harms;
+    for(UInt i=0; i<filters.size(); i++)
+      harms2 = filters.at(i)->filter(harms2);
+    return harms2;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+std::vector<SphericalHarmonics> SphericalHarmonicsFilterBase::filter(const std::vector<SphericalHarmonics> &harms) const
+{
+  try
+  {
+    std::vector<SphericalHarmonics> harms2(harms.size());
+    for(UInt i=0; i<harms.size(); i++)
+      harms2.at(i) = filter(harms.at(i));
+    return harms2;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
@@ -59,6 +59,10 @@ public:
   /** @brief returns a filtered version of given harmonics. */
   virtual SphericalHarmonics filter(const SphericalHarmonics &harm) const;
 
+  /** @brief returns filtered versions of a list of harmonics (e.g. a time series).
+  * Faster than filtering each of them separately for some filters. */
+  virtual std::vector<SphericalHarmonics> filter(const std::vector<SphericalHarmonics> &harms) const;
+
   /** @brief creates an derived instance of this class. */
   static SphericalHarmonicsFilterPtr create(Config &config, const std::string &name) {return SphericalHarmonicsFilterPtr(new SphericalHarmonicsFilter(config, name));}
 };
@@ -87,6 +91,7 @@ class SphericalHarmonicsFilterBase
 public:
 virtual ~SphericalHarmonicsFilterBase() {}
 virtual SphericalHarmonics filter(const SphericalHarmonics &harm) const = 0;
+virtual std::vector<SphericalHarmonics> filter(const std::vector<SphericalHarmonics> &harms) const;
 };
 
 /***********************************************/
@@ -19,12 +19,15 @@
 static const char *docstringSphericalHarmonicsFilterDdk = R"(
 \subsection{DDK}
 Orderwise filtering with the DDK filter by Kusche et al. 2009.
+The filter matrices are computed once per \config{level} and \config{inputfileNormalEquation}
+and are kept in the file cache (see command line option \verb|--file-cache|).
 )";
 #endif
 
 /***********************************************/
 
 #include "classes/sphericalHarmonicsFilter/sphericalHarmonicsFilter.h"
+#include "inputOutput/fileCache.h"
 #include "files/fileNormalEquation.h"
 
 /***** CLASS ***********************************/
@@ -34,12 +37,15 @@ Orderwise filtering with the DDK filter by Kusche et al. 2009.
 * @see SphericalHarmonicsFilter */
 class SphericalHarmonicsFilterDdk : public SphericalHarmonicsFilterBase
 {
-  std::vector<Matrix> matrix;
+  std::vector<Matrix> matrix; // order 0, cnm and snm blocks of order m at 2*m-1 and 2*m
+
+  static void computeMatrix(const FileName &inName, UInt level, std::vector<Matrix> &matrix);
 
 public:
   SphericalHarmonicsFilterDdk(Config &config);
 
   SphericalHarmonics filter(const SphericalHarmonics &harm) const override;
+  std::vector<SphericalHarmonics> filter(const std::vector<SphericalHarmonics> &harms) const override;
 };
 
 /***********************************************/
@@ -57,6 +63,21 @@ inline SphericalHarmonicsFilterDdk::SphericalHarmonicsFilterDdk(Config &config)
     readConfig(config, "inputfileNormalEquation", inName, Config::MUSTSET, "{groopsDataDir}/sphericalHarmonicsFilter/DDK/normalsKuscheGfzBlock_n2-120_orderwiseNonAlternating.dat.gz", "");
     if(isCreateSchema(config)) return;
 
+    FileCache::read<std::vector<Matrix>>(inName, "sphericalHarmonicsFilterDdk.level"+level%"%i"s, matrix,
+                                         [&](const FileName &inName, std::vector<Matrix> &matrix) {computeMatrix(inName, level, matrix);});
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+inline void SphericalHarmonicsFilterDdk::computeMatrix(const FileName &inName, UInt level, std::vector<Matrix> &matrix)
+{
+  try
+  {
     const Double factor = std::pow(10, 15-level);
     const Double power  = 4.0;
 
@@ -188,47 +209,63 @@ inline SphericalHarmonics SphericalHarmonicsFilterDdk::filter(const SphericalHar
 {
   try
   {
-    const UInt maxDegree = std::min(harm.maxDegree(), matrix.size()-1);
-
-    Matrix cnm = harm.cnm();
-    Matrix snm = harm.snm();
+    return filter(std::vector<SphericalHarmonics>{harm}).front();
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
 
-    Matrix cnmNew(maxDegree+1, Matrix::TRIANGULAR, Matrix::LOWER);
-    Matrix snmNew(maxDegree+1, Matrix::TRIANGULAR, Matrix::LOWER);
+/***********************************************/
 
-    // filter order 0
-    Vector x(maxDegree+1);
-    for(UInt n=0; n<=maxDegree; n++)
-      x(n) = cnm(n,0);
-    x = matrix.at(0).slice(0,0,x.rows(),x.rows()) * x;
-    for(UInt n=0; n<=maxDegree; n++)
-      cnmNew(n,0) = x(n);
+inline std::vector<SphericalHarmonics> SphericalHarmonicsFilterDdk::filter(const std::vector<SphericalHarmonics> &harms) const
+{
+  try
+  {
+    if(!harms.size())
+      return harms;
+
+    // all coefficient sets filtered together as columns of one matrix per order
+    const UInt maxDegreeFilter = (matrix.size()-1)/2;
+    UInt maxDegree = 0;
+    for(const auto &harm : harms)
+      maxDegree = std::max(maxDegree, std::min(harm.maxDegree(), maxDegreeFilter));
+
+    std::vector<Matrix> cnm(harms.size()), snm(harms.size());
+    std::vector<Matrix> cnmNew(harms.size()), snmNew(harms.size());
+    for(UInt k=0; k<harms.size(); k++)
+    {
+      const UInt degree = std::min(harms.at(k).maxDegree(), maxDegreeFilter);
+      cnm.at(k) = harms.at(k).cnm();
+      snm.at(k) = harms.at(k).snm();
+      cnmNew.at(k) = Matrix(degree+1, Matrix::TRIANGULAR, Matrix::LOWER);
+      snmNew.at(k) = Matrix(degree+1, Matrix::TRIANGULAR, Matrix::LOWER);
+    }
 
-    // filter order >0
+    auto filterOrder = [&](const Matrix &F, UInt m, std::vector<Matrix> &cs, std::vector<Matrix> &csNew)
+    {
+      Matrix x(maxDegree+1-m, harms.size());
+      for(UInt k=0; k<harms.size(); k++)
+        for(UInt n=m; n<std::min(cs.at(k).rows(), csNew.at(k).rows()); n++)
+          x(n-m, k) = cs.at(k)(n,m);
+      x = F.slice(0, 0, x.rows(), x.rows()) * x;
+      for(UInt k=0; k<harms.size(); k++)
+        for(UInt n=m; n<csNew.at(k).rows(); n++)
+          csNew.at(k)(n,m) = x(n-m, k);
+    };
+
+    filterOrder(matrix.at(0), 0, cnm, cnmNew);
     for(UInt m=1; m<=maxDegree; m++)
     {
-      Vector x(maxDegree+1-m);
-
-      // cnm
-      UInt idx = 0;
-      for(UInt n=m; n<=maxDegree; n++)
-        x(idx++) = cnm(n,m);
-      x = matrix.at(2*m-1).slice(0,0,x.rows(),x.rows()) * x;
-      idx = 0;
-      for(UInt n=m; n<=maxDegree; n++)
-        cnmNew(n,m) = x(idx++);
-
-      // snm
-      idx = 0;
-      for(UInt n=m; n<=maxDegree; n++)
-        x(idx++) = snm(n,m);
-      x = matrix.at(2*m-0).slice(0,0,x.rows(),x.rows()) * x;
-      idx = 0;
-      for(UInt n=m; n<=maxDegree; n++)
-        snmNew(n,m) = x(idx++);
+      filterOrder(matrix.at(2*m-1), m, cnm, cnmNew);
+      filterOrder(matrix.at(2*m-0), m, snm, snmNew);
     }
 
-    return SphericalHarmonics(harm.GM(), harm.R(), cnmNew, snmNew);
+    std::vector<SphericalHarmonics> harmsNew(harms.size());
+    for(UInt k=0; k<harms.size(); k++)
+      harmsNew.at(k) = SphericalHarmonics(harms.at(k).GM(), harms.at(k).R(), cnmNew.at(k), snmNew.at(k));
+    return harmsNew;
   }
   catch(std::exception &e)
   {
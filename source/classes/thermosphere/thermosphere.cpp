@@ -18,6 +18,7 @@
 #include "config/configRegister.h"
 #include "classes/thermosphere/thermosphereJB2008.h"
 #include "classes/thermosphere/thermosphereNRLMSIS2.h"
+#include "classes/thermosphere/thermosphereInterpolated.h"
 #include "classes/thermosphere/thermosphere.h"
 
 
@@ -25,7 +26,8 @@
 
 GROOPS_REGISTER_CLASS(Thermosphere, "thermosphereType",
                       ThermosphereJB2008,
-                      ThermosphereNRLMSIS2)
+                      ThermosphereNRLMSIS2,
+                      ThermosphereInterpolated)
 
 GROOPS_READCONFIG_CLASS(Thermosphere, "thermosphereType")
 
@@ -43,6 +45,8 @@ ThermospherePtr Thermosphere::create(Config &config, const std::string &name)
       thermosphere = ThermospherePtr(new ThermosphereJB2008(config));
     if(readConfigChoiceElement(config, "nrlmsis2",  choice, "NRLMSIS 2.0 Empirical Thermospheric Density Model"))
       thermosphere = ThermospherePtr(new ThermosphereNRLMSIS2(config));
+    if(readConfigChoiceElement(config, "interpolated", choice, "interpolated from a lazily computed grid of another model"))
+      thermosphere = ThermospherePtr(new ThermosphereInterpolated(config));
     endChoice(config);
 
     return thermosphere;
@@ -55,6 +59,24 @@ ThermospherePtr Thermosphere::create(Config &config, const std::string &name)
 
 /***********************************************/
 
+void Thermosphere::state(const Time &time, const std::vector<Vector3d> &positions, std::vector<Double> &density, std::vector<Double> &temperature, std::vector<Vector3d> &velocity) const
+{
+  try
+  {
+    density.resize(positions.size());
+    temperature.resize(positions.size());
+    velocity.resize(positions.size());
+    for(UInt i=0; i<positions.size(); i++)
+      state(time, positions.at(i), density.at(i), temperature.at(i), velocity.at(i));
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 Vector Thermosphere::getIndices(const MiscValuesArc &arc, const Time &time, Bool interpolate)
 {
   try
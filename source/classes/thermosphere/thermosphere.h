@@ -61,6 +61,14 @@ public:
   * @param[out] velocity wind in TRF [m/s] */
   virtual void state(const Time &time, const Vector3d &position, Double &density, Double &temperature, Vector3d &velocity) const = 0;
 
+  /** @brief Thermospheric state at many positions at the same time (e.g. for gridded output).
+  * @param time GPS time
+  * @param positions in TRF [m]
+  * @param[out] density  [kg/m^3]
+  * @param[out] temperature  [K]
+  * @param[out] velocity wind in TRF [m/s] */
+  virtual void state(const Time &time, const std::vector<Vector3d> &positions, std::vector<Double> &density, std::vector<Double> &temperature, std::vector<Vector3d> &velocity) const;
+
   /** @brief creates an derived instance of this class. */
   static ThermospherePtr create(Config &config, const std::string &name);
 
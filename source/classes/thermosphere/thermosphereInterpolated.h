@@ -0,0 +1,176 @@
+/***********************************************/
+/**
+* @file thermosphereInterpolated.h
+*
+* @brief Density, temperature and velocity interpolated from a grid.
+*
+* @author GROOPS Developers
+* @date 2026-10-14
+*
+*/
+/***********************************************/
+
+#ifndef __GROOPS_THERMOSPHEREINTERPOLATED__
+#define __GROOPS_THERMOSPHEREINTERPOLATED__
+
+// Latex documentation
+#ifdef DOCSTRING_Thermosphere
+static const char *docstringThermosphereInterpolated = R"(
+\subsection{Interpolated}
+The thermospheric state of \configClass{thermosphere}{thermosphereType} is evaluated
+on a grid of ellipsoidal height, latitude and local solar time at epochs
+with \config{samplingTime} and interpolated (multi-linear) in between. The logarithm
+of the density is interpolated in height to account for its exponential decrease.
+The wind is interpolated in the local north/east frame.
+
+The grid nodes are computed lazily at their first use and kept in memory,
+so only the height band and region passed by the satellites is evaluated.
+As the diurnal bulge is fixed in local time, the grid changes slowly between the epochs.
+The accuracy is controlled by the grid spacing.
+)";
+#endif
+
+/***********************************************/
+
+#include "classes/thermosphere/thermosphere.h"
+#include <mutex>
+
+/***** CLASS ***********************************/
+
+/** @brief Density, temperature and velocity interpolated from a grid.
+* @ingroup thermosphereGroup
+* @see Thermosphere */
+class ThermosphereInterpolated : public Thermosphere
+{
+  ThermospherePtr thermosphere;
+  Double          samplingTime, heightStep, latitudeStep, localTimeStep;
+  Int             localTimeCount;
+  Ellipsoid       ellipsoid;
+
+  class Node
+  {
+  public:
+    Double logDensity, temperature, north, east;
+  };
+
+  mutable std::mutex mutex;
+  mutable std::map<std::array<Int,4>, Node> nodes;
+
+  Node node(Int idTime, Int idHeight, Int idLat, Int idLocalTime) const;
+
+public:
+  inline ThermosphereInterpolated(Config &config);
+
+  inline void state(const Time &time, const Vector3d &position, Double &density, Double &temperature, Vector3d &velocity) const override;
+};
+
+/***********************************************/
+
+inline ThermosphereInterpolated::ThermosphereInterpolated(Config &config)
+{
+  try
+  {
+    readConfig(config, "thermosphere",   thermosphere,  Config::MUSTSET, "",     "precise model");
+    readConfig(config, "samplingTime",   samplingTime,  Config::DEFAULT, "3600", "[seconds] temporal sampling of the grid");
+    readConfig(config, "heightStep",     heightStep,    Config::DEFAULT, "10e3", "[m] ellipsoidal height sampling of the grid");
+    readConfig(config, "latitudeStep",   latitudeStep,  Config::DEFAULT, "2.5",  "[degree] latitude sampling of the grid");
+    readConfig(config, "localTimeStep",  localTimeStep, Config::DEFAULT, "0.5",  "[hours] local solar time sampling of the grid (should divide 24 hours)");
+    if(isCreateSchema(config)) return;
+
+    if((samplingTime <= 0) || (heightStep <= 0) || (latitudeStep <= 0) || (localTimeStep <= 0))
+      throw(Exception("grid samplings must be positive"));
+    localTimeCount = static_cast<Int>(std::round(24./localTimeStep));
+    localTimeStep  = 24./localTimeCount;
+    latitudeStep  *= DEG2RAD;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+inline ThermosphereInterpolated::Node ThermosphereInterpolated::node(Int idTime, Int idHeight, Int idLat, Int idLocalTime) const
+{
+  try
+  {
+    const std::array<Int,4> key = {idTime, idHeight, idLat, idLocalTime};
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      auto iter = nodes.find(key);
+      if(iter != nodes.end())
+        return iter->second;
+    }
+
+    // evaluate precise model at grid node
+    const Time     time     = seconds2time(idTime*samplingTime);
+    const Double   hoursUt  = 24.*timeGPS2UTC(time).mjdMod();
+    const Vector3d position = ellipsoid(Angle(15.*DEG2RAD*(idLocalTime*localTimeStep-hoursUt)), Angle(idLat*latitudeStep-PI/2), idHeight*heightStep);
+    Double   density, temperature;
+    Vector3d wind;
+    thermosphere->state(time, position, density, temperature, wind);
+    wind = localNorthEastUp(position, ellipsoid).inverseTransform(wind);
+    const Node node = {std::log(std::max(density, 1e-300)), temperature, wind.x(), wind.y()};
+
+    std::lock_guard<std::mutex> lock(mutex);
+    return nodes.emplace(key, node).first->second;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+inline void ThermosphereInterpolated::state(const Time &time, const Vector3d &position, Double &density, Double &temperature, Vector3d &velocity) const
+{
+  try
+  {
+    Angle  lon, lat;
+    Double height;
+    ellipsoid(position, lon, lat, height);
+    Double localTime = std::fmod(24.*timeGPS2UTC(time).mjdMod() + lon*RAD2DEG/15., 24.);
+    if(localTime < 0)
+      localTime += 24.;
+
+    // cell and relative coordinates within the cell
+    const Double tTime = time.mjd()*86400./samplingTime;
+    const Double tHeight = height/heightStep;
+    const Double tLat    = std::min(std::max((lat+PI/2)/latitudeStep, 0.), std::floor(PI/latitudeStep+1e-9)-1e-9);
+    const Double tLocal  = localTime/localTimeStep;
+    const Int idTime   = static_cast<Int>(std::floor(tTime));
+    const Int idHeight = static_cast<Int>(std::floor(tHeight));
+    const Int idLat    = static_cast<Int>(std::floor(tLat));
+    const Int idLocal  = static_cast<Int>(std::floor(tLocal));
+    const Double w[4] = {tTime-idTime, tHeight-idHeight, tLat-idLat, tLocal-idLocal};
+
+    Node result = {0., 0., 0., 0.};
+    for(UInt corner=0; corner<16; corner++)
+    {
+      Double factor = 1.;
+      for(UInt k=0; k<4; k++)
+        factor *= ((corner>>k) & 1) ? w[k] : (1.-w[k]);
+      if(factor == 0.)
+        continue;
+      const Node n = node(idTime+(corner&1), idHeight+((corner>>1)&1), idLat+((corner>>2)&1), (idLocal+((corner>>3)&1)) % localTimeCount);
+      result.logDensity  += factor * n.logDensity;
+      result.temperature += factor * n.temperature;
+      result.north       += factor * n.north;
+      result.east        += factor * n.east;
+    }
+
+    density     = std::exp(result.logDensity);
+    temperature = result.temperature;
+    velocity    = localNorthEastUp(position, ellipsoid).transform(Vector3d(result.north, result.east, 0));
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+#endif
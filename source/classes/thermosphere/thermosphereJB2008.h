@@ -46,6 +46,7 @@ public:
   inline ThermosphereJB2008(Config &config);
 
   inline void state(const Time &time, const Vector3d &position, Double &density, Double &temperature, Vector3d &velocity) const override;
+  inline void state(const Time &time, const std::vector<Vector3d> &positions, std::vector<Double> &density, std::vector<Double> &temperature, std::vector<Vector3d> &velocity) const override;
 };
 
 /***********************************************/
@@ -125,12 +126,30 @@ inline void ThermosphereJB2008::state(const Time &time, const Vector3d &position
 {
   try
   {
-#ifndef GROOPS_DISABLE_JB2008
-    Ellipsoid ellipsoid;
-    Angle     lon, lat;
-    Double    height;
-    ellipsoid(position, lon, lat, height);
+    std::vector<Double>   densities, temperatures;
+    std::vector<Vector3d> velocities;
+    state(time, std::vector<Vector3d>{position}, densities, temperatures, velocities);
+    density     = densities.at(0);
+    temperature = temperatures.at(0);
+    velocity    = velocities.at(0);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
 
+inline void ThermosphereJB2008::state(const Time &time, const std::vector<Vector3d> &positions, std::vector<Double> &density, std::vector<Double> &temperature, std::vector<Vector3d> &velocity) const
+{
+  try
+  {
+    density.resize(positions.size(), 0.);
+    temperature.resize(positions.size(), 0.);
+    velocity.resize(positions.size());
+#ifndef GROOPS_DISABLE_JB2008
+    // indices and sun position are the same for all points
     // use 5 day lag for y10 for jb2008
     const Vector index5 = getIndices(solarFSMY, time - mjd2time(5), FALSE);
     const Double Y10  = index5(6);
@@ -152,16 +171,25 @@ inline void ThermosphereJB2008::state(const Time &time, const Vector3d &position
     const Double dstdtc = getIndices(dtc, time, TRUE)(0);
 
     const Vector3d sunPos = Planets::positionSun(time);
-
+    const Double   gmst   = Planets::gmst(timeGPS2UTC(time));
     F77Double sun[2] = {sunPos.lambda(), sunPos.phi()};
-    F77Double pos[3] = {std::fmod(Double(lon+Planets::gmst(timeGPS2UTC(time)))+2*PI, 2*PI), lat, height*1e-3};
-    F77Double temp[2], rho;
 
-    jb2008(time.mjd(), sun, pos, F10, F10B, S10, S10B, M10, M10B, Y10, Y10B, dstdtc, temp, rho);
+    Ellipsoid ellipsoid;
+    for(UInt i=0; i<positions.size(); i++)
+    {
+      Angle  lon, lat;
+      Double height;
+      ellipsoid(positions.at(i), lon, lat, height);
+
+      F77Double pos[3] = {std::fmod(Double(lon+gmst)+2*PI, 2*PI), lat, height*1e-3};
+      F77Double temp[2], rho;
 
-    density     = rho;
-    temperature = temp[1];
-    velocity    = wind(time, position);
+      jb2008(time.mjd(), sun, pos, F10, F10B, S10, S10B, M10, M10B, Y10, Y10B, dstdtc, temp, rho);
+
+      density.at(i)     = rho;
+      temperature.at(i) = temp[1];
+      velocity.at(i)    = wind(time, positions.at(i));
+    }
 #endif
   }
   catch(std::exception &e)
@@ -141,6 +141,24 @@ Vector3d Tides::acceleration(const Time &timeGPS, const Vector3d &point,
 
 /***********************************************/
 
+std::vector<Vector3d> Tides::acceleration(const Time &timeGPS, const std::vector<Vector3d> &point,
+                                          const Rotary3d &rotEarth, EarthRotationPtr rotation, EphemeridesPtr ephemerides) const
+{
+  try
+  {
+    std::vector<Vector3d> g(point.size());
+    for(UInt i=0; i<tides.size(); i++)
+      tides.at(i)->gravity(timeGPS, point, rotEarth, rotation, ephemerides, g);
+    return g;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 Tensor3d Tides::gradient(const Time &timeGPS, const Vector3d &point,
                          const Rotary3d &rotEarth, EarthRotationPtr rotation, EphemeridesPtr ephemerides) const
 {
@@ -241,6 +259,18 @@ Vector3d TidesBase::gravity(const Time &time, const Vector3d &point,
 
 /***********************************************/
 
+void TidesBase::gravity(const Time &time, const std::vector<Vector3d> &point,
+                        const Rotary3d &rotEarth, EarthRotationPtr rotation, EphemeridesPtr ephemerides, std::vector<Vector3d> &g) const
+{
+  if(!point.size())
+    return;
+  const SphericalHarmonics harm = sphericalHarmonics(time, rotEarth, rotation, ephemerides);
+  for(UInt i=0; i<point.size(); i++)
+    g.at(i) += harm.gravity(point.at(i));
+}
+
+/***********************************************/
+
 Tensor3d TidesBase::gravityGradient(const Time &time, const Vector3d &point,
                                     const Rotary3d &rotEarth, EarthRotationPtr rotation, EphemeridesPtr ephemerides) const
 {
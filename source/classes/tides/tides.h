@@ -97,6 +97,17 @@ public:
   Vector3d acceleration(const Time &timeGPS, const Vector3d &point,
                         const Rotary3d &rotEarth, EarthRotationPtr rotation, EphemeridesPtr ephemerides) const;
 
+  /** @brief Tidal acceleration at many points at the same time.
+  * Tide arguments, spherical harmonics coefficients and positions of sun and moon are computed only once.
+  * @param timeGPS point in time (GPS)
+  * @param point Computation points in TRF [m].
+  * @param rotEarth CRF -> TRF
+  * @param rotation need for computation of polar motion.
+  * @param ephemerides ephemerides of sun and moon.
+  * @return accelerations in TRF [@f$m/s^2@f$] */
+  std::vector<Vector3d> acceleration(const Time &timeGPS, const std::vector<Vector3d> &point,
+                                     const Rotary3d &rotEarth, EarthRotationPtr rotation, EphemeridesPtr ephemerides) const;
+
   /** @brief Tidal acceleration gradient.
   * @param timeGPS point in time (GPS)
   * @param point Computation point in TRF [m].
@@ -176,6 +187,8 @@ public:
   virtual Double   potential      (const Time &time, const Vector3d &point, const Rotary3d &rotEarth, EarthRotationPtr rotation, EphemeridesPtr ephemerides) const;
   virtual Double   radialGradient (const Time &time, const Vector3d &point, const Rotary3d &rotEarth, EarthRotationPtr rotation, EphemeridesPtr ephemerides) const;
   virtual Vector3d gravity        (const Time &time, const Vector3d &point, const Rotary3d &rotEarth, EarthRotationPtr rotation, EphemeridesPtr ephemerides) const;
+  virtual void     gravity        (const Time &time, const std::vector<Vector3d> &point, const Rotary3d &rotEarth, EarthRotationPtr rotation, EphemeridesPtr ephemerides,
+                                   std::vector<Vector3d> &g) const;
   virtual Tensor3d gravityGradient(const Time &time, const Vector3d &point, const Rotary3d &rotEarth, EarthRotationPtr rotation, EphemeridesPtr ephemerides) const;
   virtual Vector3d deformation    (const Time &time, const Vector3d &point, const Rotary3d &rotEarth, EarthRotationPtr rotation, EphemeridesPtr ephemerides,
                                    Double gravity, const Vector &hn, const Vector &ln) const;
@@ -221,6 +221,64 @@ Vector3d TidesAstronomical::gravity(const Time &time, const Vector3d &point, con
 
 /***********************************************/
 
+void TidesAstronomical::gravity(const Time &time, const std::vector<Vector3d> &point, const Rotary3d &rotEarth, EarthRotationPtr /*rotation*/, EphemeridesPtr ephemerides,
+                                std::vector<Vector3d> &g) const
+{
+  try
+  {
+    if(!point.size())
+      return;
+    if(!ephemerides)
+      throw(Exception("No ephemerides given"));
+
+    // positions of the bodies are the same for all points
+    const Bool withEarth = useEarth && (ephemerides->origin() != Ephemerides::EARTH);
+    const Bool withMoon  = useMoon  && (ephemerides->origin() != Ephemerides::MOON);
+    Vector3d posEarth, posMoon, g0;
+    if(withEarth)
+    {
+      posEarth = ephemerides->position(time, Ephemerides::EARTH);
+      g0 -= j2earth.gravity(-posEarth);
+    }
+    if(withMoon)
+    {
+      posMoon = ephemerides->position(time, Ephemerides::MOON);
+      if(ephemerides->origin() == Ephemerides::EARTH)
+        g0 -= GM_Moon/GM_Earth * j2earth.gravity(-posMoon);
+    }
+    std::vector<std::pair<Double, Vector3d>> bodies; // GM, position
+    if(useSun && (ephemerides->origin() != Ephemerides::SUN))
+      bodies.push_back({GM_Sun, ephemerides->position(time, Ephemerides::SUN)});
+    if(usePlanets)
+    {
+      bodies.push_back({GM_MERCURY, ephemerides->position(time, Ephemerides::MERCURY)});
+      bodies.push_back({GM_VENUS,   ephemerides->position(time, Ephemerides::VENUS)});
+      bodies.push_back({GM_MARS,    ephemerides->position(time, Ephemerides::MARS)});
+      bodies.push_back({GM_JUPITER, ephemerides->position(time, Ephemerides::JUPITER)});
+      bodies.push_back({GM_SATURN,  ephemerides->position(time, Ephemerides::SATURN)});
+    }
+
+    for(UInt i=0; i<point.size(); i++)
+    {
+      const Vector3d posSat = rotEarth.inverseRotate(point.at(i));
+      Vector3d gSat = g0;
+      if(withEarth)
+        gSat += directTideAcceleration(GM_Earth, posEarth, posSat) + j2earth.gravity(posSat-posEarth);
+      if(withMoon)
+        gSat += directTideAcceleration(GM_Moon, posMoon, posSat);
+      for(const auto &body : bodies)
+        gSat += directTideAcceleration(body.first, body.second, posSat);
+      g.at(i) += factor*rotEarth.rotate(gSat);
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 Tensor3d TidesAstronomical::gravityGradient(const Time &time, const Vector3d &point, const Rotary3d &rotEarth, EarthRotationPtr /*rotation*/, EphemeridesPtr ephemerides) const
 {
   try
@@ -61,6 +61,18 @@ Vector3d TidesCentrifugal::gravity(const Time &time, const Vector3d &point, cons
 
 /***********************************************/
 
+void TidesCentrifugal::gravity(const Time &time, const std::vector<Vector3d> &point, const Rotary3d &/*rotEarth*/, EarthRotationPtr rotation, EphemeridesPtr /*ephemerides*/,
+                               std::vector<Vector3d> &g) const
+{
+  if(!point.size())
+    return;
+  Vector3d Omega = rotation->rotaryAxis((time==Time()) ? mjd2time(J2000) : time);
+  for(UInt i=0; i<point.size(); i++)
+    g.at(i) -= factor * crossProduct(Omega, crossProduct(Omega, point.at(i)));
+}
+
+/***********************************************/
+
 Tensor3d TidesCentrifugal::gravityGradient(const Time &time, const Vector3d &/*point*/, const Rotary3d &/*rotEarth*/, EarthRotationPtr rotation, EphemeridesPtr /*ephemerides*/) const
 {
   Vector3d Omega = rotation->rotaryAxis((time==Time()) ? mjd2time(J2000) : time);
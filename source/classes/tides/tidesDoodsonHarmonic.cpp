@@ -158,6 +158,66 @@ Matrix TidesDoodsonHarmonic::interpolationFactors(const Time &time) const
 
 /***********************************************/
 
+void TidesDoodsonHarmonic::interpolationFactors(const std::vector<Time> &times, Matrix &cosMajor, Matrix &sinMajor) const
+{
+  try
+  {
+    // arguments of all constituents and epochs
+    Matrix arguments(6, times.size());
+    for(UInt idEpoch=0; idEpoch<times.size(); idEpoch++)
+      copy(Doodson::arguments(times.at(idEpoch)), arguments.column(idEpoch));
+    const Matrix thetaf = doodsonMatrix * arguments;
+
+    Matrix cosMinor(thetaf.rows(), thetaf.columns());
+    Matrix sinMinor(thetaf.rows(), thetaf.columns());
+    if(nCorr!=0) //apply nodal corrections here
+    {
+      // nodal corrections vary slowly (18.6 years) -> compute once per day and interpolate linearly
+      std::map<Int, Matrix> fuDay;
+      auto nodeCorrDay = [&](Int mjdInt) -> const Matrix&
+      {
+        auto iter = fuDay.find(mjdInt);
+        if(iter == fuDay.end())
+          iter = fuDay.emplace(mjdInt, Doodson::nodeCorr(doodson, Time(mjdInt, 0.), nCorr)).first;
+        return iter->second;
+      };
+
+      for(UInt idEpoch=0; idEpoch<times.size(); idEpoch++)
+      {
+        const Int    mjdInt = times.at(idEpoch).mjdInt();
+        const Double tau    = times.at(idEpoch).mjdMod();
+        const Matrix &fu0   = nodeCorrDay(mjdInt);
+        const Matrix &fu1   = nodeCorrDay(mjdInt+1);
+        for(UInt i=0; i<thetaf.rows(); i++)
+        {
+          const Double f = (1-tau) * fu0(i,0) + tau * fu1(i,0);
+          const Double u = (1-tau) * fu0(i,1) + tau * fu1(i,1);
+          cosMinor(i, idEpoch) = f * cos(thetaf(i, idEpoch)+u);
+          sinMinor(i, idEpoch) = f * sin(thetaf(i, idEpoch)+u);
+        }
+      }
+    }
+    else
+    {
+      for(UInt idEpoch=0; idEpoch<times.size(); idEpoch++)
+        for(UInt i=0; i<thetaf.rows(); i++)
+        {
+          cosMinor(i, idEpoch) = cos(thetaf(i, idEpoch));
+          sinMinor(i, idEpoch) = sin(thetaf(i, idEpoch));
+        }
+    }
+
+    cosMajor = (admittance.size()) ? (admittance * cosMinor) : cosMinor;
+    sinMajor = (admittance.size()) ? (admittance * sinMinor) : sinMinor;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 SphericalHarmonics TidesDoodsonHarmonic::sphericalHarmonics(const Time &time, const Rotary3d &/*rotEarth*/, EarthRotationPtr /*rotation*/, EphemeridesPtr /*ephemerides*/, UInt maxDegree, UInt minDegree, Double GM, Double R) const
 {
   try
@@ -194,32 +254,27 @@ void TidesDoodsonHarmonic::deformation(const std::vector<Time> &time, const std:
       return;
 
     Matrix A = deformationMatrix(point, gravity, hn, ln, GM, R, cnmCos.at(0).rows()-1);
-    std::vector<Matrix> xCos(cnmCos.size());
-    std::vector<Matrix> xSin(snmCos.size());
-    for(UInt i=0; i<xCos.size(); i++)
+    Matrix xCos(3*point.size(), cnmCos.size());
+    Matrix xSin(3*point.size(), cnmSin.size());
+    for(UInt i=0; i<cnmCos.size(); i++)
     {
-      xCos.at(i) = A * SphericalHarmonics(GM, R, cnmCos.at(i), snmCos.at(i)).x();
-      xSin.at(i) = A * SphericalHarmonics(GM, R, cnmSin.at(i), snmSin.at(i)).x();
+      matMult(1., A, SphericalHarmonics(GM, R, cnmCos.at(i), snmCos.at(i)).x(), xCos.column(i));
+      matMult(1., A, SphericalHarmonics(GM, R, cnmSin.at(i), snmSin.at(i)).x(), xSin.column(i));
     }
 
-    for(UInt idEpoch=0; idEpoch<time.size(); idEpoch++)
-    {
-      const Matrix csMajor = interpolationFactors(time.at(idEpoch));
-
-      Vector x(3*point.size());
-      for(UInt i=0; i<csMajor.rows(); i++)
-      {
-        axpy(csMajor(i,0), xCos.at(i), x);
-        axpy(csMajor(i,1), xSin.at(i), x);
-      }
+    // all epochs at once
+    Matrix cosMajor, sinMajor;
+    interpolationFactors(time, cosMajor, sinMajor);
+    Matrix x = xCos * cosMajor;
+    matMult(1., xSin, sinMajor, x);
 
+    for(UInt idEpoch=0; idEpoch<time.size(); idEpoch++)
       for(UInt k=0; k<point.size(); k++)
       {
-        disp.at(k).at(idEpoch).x() += x(3*k+0);
-        disp.at(k).at(idEpoch).y() += x(3*k+1);
-        disp.at(k).at(idEpoch).z() += x(3*k+2);
+        disp.at(k).at(idEpoch).x() += x(3*k+0, idEpoch);
+        disp.at(k).at(idEpoch).y() += x(3*k+1, idEpoch);
+        disp.at(k).at(idEpoch).z() += x(3*k+2, idEpoch);
       }
-    } // for(idEpoch)
   }
   catch(std::exception &e)
   {
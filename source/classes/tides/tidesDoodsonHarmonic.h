@@ -70,6 +70,14 @@ class TidesDoodsonHarmonic : public TidesBase
 
   Matrix interpolationFactors(const Time &time) const;
 
+  /** @brief Interpolation factors of the major constituents for many epochs at once.
+  * The Doodson arguments of all epochs are multiplied in one matrix product,
+  * the nodal corrections are computed once per day and interpolated linearly in between.
+  * @param times epochs
+  * @param[out] cosMajor cos factors (major constituents x epochs)
+  * @param[out] sinMajor sin factors (major constituents x epochs) */
+  void interpolationFactors(const std::vector<Time> &times, Matrix &cosMajor, Matrix &sinMajor) const;
+
 public:
   TidesDoodsonHarmonic(Config &config);
 
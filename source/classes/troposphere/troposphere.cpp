@@ -65,7 +65,7 @@ void Troposphere::initEmpiricalCoefficients(const FileName &fileNameGpt, const s
     longitude = Vector(stationCount);
     latitude  = Vector(stationCount);
     height    = Vector(stationCount);
-    coeff     = Matrix(grid.values.size(), stationCount);
+    Matrix coeff(grid.values.size(), stationCount);
 
     for(UInt stationId=0; stationId<stationCount; stationId++)
     {
@@ -91,6 +91,19 @@ void Troposphere::initEmpiricalCoefficients(const FileName &fileNameGpt, const s
       }
     }
 
+    // spatial interpolation is done once here,
+    // per day only the Fourier series of the 16 quantities of all stations are evaluated in one product
+    if(coeff.rows() < 1+16*5)
+      throw(Exception(fileNameGpt.str()+": too few GPT coefficients"));
+    topography   = Vector(stationCount);
+    coeffFourier = Matrix(5, 16*stationCount);
+    for(UInt stationId=0; stationId<stationCount; stationId++)
+    {
+      topography(stationId) = coeff(0, stationId);
+      for(UInt i=0; i<16; i++)
+        copy(coeff.slice(1+i*5, stationId, 5, 1), coeffFourier.column(16*stationId+i));
+    }
+
     timeRef = Time();
   }
   catch(std::exception &e)
@@ -118,29 +131,31 @@ void Troposphere::computeEmpiricalCoefficients(const Time &time) const
     fourier(3) = std::cos(4*PI*t); // cos semiannual
     fourier(4) = std::sin(4*PI*t); // sin semiannual
 
+    const Matrix values = fourier.trans() * coeffFourier;
+
     topo = ah = aw = bh = bw = ch = cw = p = T = Q = dT = la = Tm = zhd = zwd = gnh = geh = gnw = gew = Vector(longitude.rows());
     for(UInt stationId=0; stationId<longitude.size(); stationId++)
     {
-      topo(stationId)  = coeff(0, stationId);                                                // [m]
-
-      ah(stationId)    = inner(fourier, coeff.slice(1+ 0*5,  stationId, fourier.rows(), 1));
-      aw(stationId)    = inner(fourier, coeff.slice(1+ 1*5,  stationId, fourier.rows(), 1));
-      bh(stationId)    = inner(fourier, coeff.slice(1+ 2*5,  stationId, fourier.rows(), 1));
-      bw(stationId)    = inner(fourier, coeff.slice(1+ 3*5,  stationId, fourier.rows(), 1));
-      ch(stationId)    = inner(fourier, coeff.slice(1+ 4*5,  stationId, fourier.rows(), 1));
-      cw(stationId)    = inner(fourier, coeff.slice(1+ 5*5,  stationId, fourier.rows(), 1));
-
-      p(stationId)     = inner(fourier, coeff.slice(1+ 6*5,  stationId, fourier.rows(), 1)); // [Pa]
-      T(stationId)     = inner(fourier, coeff.slice(1+ 7*5,  stationId, fourier.rows(), 1)); // [Kelvin]
-      Q(stationId)     = inner(fourier, coeff.slice(1+ 8*5,  stationId, fourier.rows(), 1)); // [kg/kg]
-      dT(stationId)    = inner(fourier, coeff.slice(1+ 9*5,  stationId, fourier.rows(), 1)); // tempLapseRate [Kelvin/m]
-      la(stationId)    = inner(fourier, coeff.slice(1+10*5,  stationId, fourier.rows(), 1)); // waterWaporDecreaseFactor []
-      Tm(stationId)    = inner(fourier, coeff.slice(1+11*5,  stationId, fourier.rows(), 1)); // waterWaporMeanTemperature [Kelvin]
-
-      gnh(stationId)   = inner(fourier, coeff.slice(1+12*5, stationId, fourier.rows(), 1)); // [m]
-      geh(stationId)   = inner(fourier, coeff.slice(1+13*5, stationId, fourier.rows(), 1)); // [m]
-      gnw(stationId)   = inner(fourier, coeff.slice(1+14*5, stationId, fourier.rows(), 1)); // [m]
-      gew(stationId)   = inner(fourier, coeff.slice(1+15*5, stationId, fourier.rows(), 1)); // [m]
+      topo(stationId)  = topography(stationId);  // [m]
+
+      ah(stationId)    = values(0, 16*stationId+ 0);
+      aw(stationId)    = values(0, 16*stationId+ 1);
+      bh(stationId)    = values(0, 16*stationId+ 2);
+      bw(stationId)    = values(0, 16*stationId+ 3);
+      ch(stationId)    = values(0, 16*stationId+ 4);
+      cw(stationId)    = values(0, 16*stationId+ 5);
+
+      p(stationId)     = values(0, 16*stationId+ 6); // [Pa]
+      T(stationId)     = values(0, 16*stationId+ 7); // [Kelvin]
+      Q(stationId)     = values(0, 16*stationId+ 8); // [kg/kg]
+      dT(stationId)    = values(0, 16*stationId+ 9); // tempLapseRate [Kelvin/m]
+      la(stationId)    = values(0, 16*stationId+10); // waterWaporDecreaseFactor []
+      Tm(stationId)    = values(0, 16*stationId+11); // waterWaporMeanTemperature [Kelvin]
+
+      gnh(stationId)   = values(0, 16*stationId+12); // [m]
+      geh(stationId)   = values(0, 16*stationId+13); // [m]
+      gnw(stationId)   = values(0, 16*stationId+14); // [m]
+      gew(stationId)   = values(0, 16*stationId+15); // [m]
 
       constexpr Double g    = 9.80665;                  // mean gravity in [m/s^2]
       constexpr Double dMtr = 2.8965e-2;                // molar mass of dry air in [kg/mol]
@@ -114,7 +114,8 @@ public:
 
 private:
   mutable Time timeRef;
-  Matrix coeff;
+  Vector topography;   // per station
+  Matrix coeffFourier; // Fourier coefficients (5 x 16*stations), bilinear interpolated to the stations
 
 protected:
   Vector longitude, latitude, height;
@@ -12,6 +12,7 @@
 /***********************************************/
 
 #include "base/import.h"
+#include "base/kdTree.h"
 #include "config/config.h"
 #include "files/fileGriddedDataTimeSeries.h"
 #include "troposphere.h"
@@ -98,20 +99,19 @@ void TroposphereViennaMapping::init(const std::vector<Vector3d> &stationPosition
     else
     {
       // find closest station
+      const KdTree kdTree(grid.points);
       for(UInt stationId=0; stationId<stationPositions.size(); stationId++)
       {
-        std::vector<Double> distances(grid.points.size());
-        for(UInt i=0; i<distances.size(); i++)
-          distances.at(i) = (stationPositions.at(stationId)-grid.points.at(i)).r();
-        auto iter = std::min_element(distances.begin(), distances.end());
-        if(iter == distances.end() || *iter > 10e3)
+        Double distance;
+        const UInt idx = kdTree.nearest(stationPositions.at(stationId), distance);
+        if(distance > 10e3)
         {
           Angle  lon, lat;
           Double h;
           grid.ellipsoid(stationPositions.at(stationId), lon, lat, h);
           throw(Exception("no troposphere data for station id "+stationId%"%i (L="s+(lon*RAD2DEG)%"%f, B="s+(lat*RAD2DEG)%"%f)"s));
         }
-        index.at(stationId).push_back(std::distance(distances.begin(), iter));
+        index.at(stationId).push_back(idx);
         factor.at(stationId).push_back(1.0);
       }
     }
@@ -15,6 +15,7 @@
 #include "base/doodson.h"
 #include "base/gnssType.h"
 #include "inputOutput/file.h"
+#include "inputOutput/system.h"
 #include "parser/xml.h"
 #include "parser/stringParser.h"
 #include "parser/expressionParser.h"
@@ -23,6 +24,7 @@
 #include "classes/loop/loop.h"
 #include "programs/program.h"
 #include "config.h"
+#include <chrono>
 
 /***********************************************/
 /*** Stack management **************************/
@@ -683,6 +685,171 @@ XmlNodePtr Config::table()
 /***********************************************/
 /***********************************************/
 
+std::string ProgramConfig::comment(Config &config)
+{
+  try
+  {
+    std::string comment;
+    StackNode top = config.stack.top();
+    config.stack.pop(); // coment is given in <program> not in <choiceElement>
+    XmlAttrPtr attr = config.stack.top().xmlNode->getAttribute("comment");
+    if(attr)
+      comment = attr->getText();
+    config.stack.push(top);
+    if(comment.empty())
+      return comment;
+    Bool resolved;
+    return " ("+StringParser::parse("comment", comment, config.getVarList(), resolved)+")";
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+// file names of all inputfile*/outputfile* elements, returns FALSE if not all file names can be resolved
+static Bool collectFileNames(XmlNodePtr xmlNode, XmlNodePtr global, const VariableList &varList, std::set<std::string> &inputs, std::set<std::string> &outputs)
+{
+  try
+  {
+    Bool resolvedAll = TRUE;
+    for(XmlNodePtr child : xmlNode->getChildren())
+    {
+      const Bool isInput  = (child->getName().find("inputfile")  == 0);
+      const Bool isOutput = (child->getName().find("outputfile") == 0);
+      if(child->findAttribute("loop") || child->findAttribute("condition"))
+        resolvedAll = FALSE;
+      if(!isInput && !isOutput)
+      {
+        resolvedAll = collectFileNames(child, global, varList, inputs, outputs) && resolvedAll;
+        continue;
+      }
+
+      XmlNodePtr node = child;
+      XmlAttrPtr link = child->findAttribute("link");
+      if(link)
+        node = global->findChild(link->getText());
+      if(!node || node->hasChildren() || (link && node->findAttribute("link")))
+      {
+        resolvedAll = FALSE;
+        continue;
+      }
+      Bool resolved;
+      const std::string fileName = StringParser::parse(child->getName(), node->getText(), varList, resolved);
+      if(!resolved)
+        resolvedAll = FALSE;
+      else if(!fileName.empty())
+        (isInput ? inputs : outputs).insert(fileName);
+    }
+    return resolvedAll;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+// build cache (see ProgramConfig::setBuildCache)
+// -----------------------------------------------
+static FileName                           buildCacheFileName;
+static std::map<std::string, std::string> buildCache; // hash of program and config -> hash of file states
+
+// FNV-1a, stable between runs
+static std::string buildCacheHash(const std::string &str)
+{
+  UInt hash = 14695981039346656037ULL;
+  for(unsigned char c : str)
+    hash = (hash ^ c) * 1099511628211ULL;
+  std::stringstream ss;
+  ss<<std::hex<<std::setw(16)<<std::setfill('0')<<hash;
+  return ss.str();
+}
+
+// config with all links and variables resolved, returns FALSE if not possible
+static Bool buildCacheConfig(XmlNodePtr xmlNode, XmlNodePtr global, const VariableList &varList, std::string &str)
+{
+  try
+  {
+    for(XmlNodePtr child : xmlNode->getChildren())
+    {
+      if(child->findAttribute("loop") || child->findAttribute("condition"))
+        return FALSE;
+      XmlNodePtr node = child;
+      XmlAttrPtr link = child->findAttribute("link");
+      if(link)
+        node = global->findChild(link->getText());
+      if(!node || (link && node->findAttribute("link")))
+        return FALSE;
+      Bool resolved;
+      str += "<"+child->getName()+">"+StringParser::parse(child->getName(), node->getText(), varList, resolved);
+      if(!resolved || !buildCacheConfig(node, global, varList, str))
+        return FALSE;
+      str += "</>";
+    }
+    return TRUE;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+static std::string buildCacheState(const std::set<std::string> &inputs, const std::set<std::string> &outputs)
+{
+  std::string str;
+  for(const auto &name : inputs)
+    str += "<"+name+">"+System::fileStatus(name);
+  str += "|";
+  for(const auto &name : outputs)
+    str += "<"+name+">"+System::fileStatus(name);
+  return buildCacheHash(str);
+}
+
+/***********************************************/
+
+void ProgramConfig::setBuildCache(const FileName &fileName)
+{
+  try
+  {
+    buildCacheFileName = fileName;
+    buildCache.clear();
+    if(fileName.empty() || !System::exists(fileName))
+      return;
+    InFile file(fileName);
+    std::string key, state;
+    while(file>>key>>state)
+      buildCache[key] = state;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+std::set<std::string> ProgramConfig::inputFileNames(const VariableList &variableList) const
+{
+  try
+  {
+    VariableList varListTmp = varList;
+    varListTmp += variableList;
+    std::set<std::string> inputs, outputs;
+    collectFileNames(stack.top().xmlNode, global, varListTmp, inputs, outputs);
+    return inputs;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 void ProgramConfig::run(VariableList &variableList, Parallel::CommunicatorPtr comm) const
 {
   try
@@ -693,33 +860,59 @@ void ProgramConfig::run(VariableList &variableList, Parallel::CommunicatorPtr co
     std::string type;
     while(readConfigChoice(config, name, type, OPTIONAL, "", ""))
     {
-      for(auto &renamed : Program::RenamedProgram::renamedList())
-        renameDeprecatedChoice(config, type, renamed.oldName, renamed.newName, renamed.time);
+      auto renamed = Program::RenamedProgram::find(type);
+      if(renamed)
+        renameDeprecatedChoice(config, type, renamed->oldName, renamed->newName, renamed->time);
+
+      Program::Program *program = Program::Program::find(type);
+      if(program && readConfigChoiceElement(config, program->name(), type, ""))
+      {
+        const std::string text = comment(config);
 
-      for(auto &program : Program::Program::programList())
-        if(readConfigChoiceElement(config, program->name(), type, ""))
+        // unchanged since last run? (file operations, commands, and program control are always executed)
+        std::string key;
+        std::set<std::string> inputs, outputs;
+        Bool unchanged = FALSE;
+        if(!buildCacheFileName.empty() && Parallel::isMaster(comm) && (program->tags().front() != Program::System))
         {
-          std::string comment;
-          StackNode top = config.stack.top();
-          config.stack.pop(); // coment is given in <program> not in <choiceElement>
-          XmlAttrPtr attr = config.stack.top().xmlNode->getAttribute("comment");
-          if(attr)
-            comment = attr->getText();
-          config.stack.push(top);
-
-          Parallel::barrier(comm);
-          if(comment.empty())
-            logStatus<<"--- "<<program->name()<<" ---"<<Log::endl;
-          else
+          std::string str = program->name();
+          if(buildCacheConfig(config.stack.top().xmlNode, global, config.getVarList(), str) &&
+             collectFileNames(config.stack.top().xmlNode, global, config.getVarList(), inputs, outputs) && outputs.size())
           {
-            Bool resolved;
-            comment = StringParser::parse("comment", comment, config.getVarList(), resolved);
-            logStatus<<"--- "<<program->name()<<" ("<<comment<<") ---"<<Log::endl;
+            key = buildCacheHash(str);
+            auto iter = buildCache.find(key);
+            unchanged = (iter != buildCache.end()) && (iter->second == buildCacheState(inputs, outputs));
+            buildCache.erase(key);
+          }
+        }
+        Parallel::broadCast(unchanged, 0, comm);
+
+        Parallel::barrier(comm);
+        if(unchanged)
+        {
+          logStatus<<"--- "<<program->name()<<text<<" (unchanged, skipped) ---"<<Log::endl;
+          buildCache[key] = buildCacheState(inputs, outputs);
+          config.stack.top().xmlNode->clearChildren();
+        }
+        else
+        {
+          logStatus<<"--- "<<program->name()<<text<<" ---"<<Log::endl;
+          {
+            GROOPS_PROFILE(program->name())
+            program->run(config, comm);
+            Parallel::barrier(comm);
+          }
+          Profiler::report(comm);
+
+          if(!key.empty())
+          {
+            buildCache[key] = buildCacheState(inputs, outputs);
+            OutFile file(buildCacheFileName);
+            for(const auto &entry : buildCache)
+              file<<entry.first<<" "<<entry.second<<std::endl;
           }
-          program->run(config, comm);
-          Parallel::barrier(comm);
-          break;
         }
+      }
 
       endChoice(config);
     }
@@ -730,6 +923,218 @@ void ProgramConfig::run(VariableList &variableList, Parallel::CommunicatorPtr co
   }
 }
 
+/***********************************************/
+
+void ProgramConfig::runParallel(VariableList &variableList, UInt processCount, Bool parallelLog, Parallel::CommunicatorPtr comm) const
+{
+  try
+  {
+    if((processCount == 0) || (Parallel::size(comm) < 3))
+    {
+      run(variableList, comm);
+      return;
+    }
+
+    // gather all programs (loops and conditions are evaluated)
+    // --------------------------------------------------------
+    class Task
+    {
+    public:
+      Program::Program     *program;
+      std::string           comment, nodeName;
+      XmlNodePtr            xmlNode;
+      VariableList          varList;
+      std::set<std::string> inputs, outputs;
+      Bool                  isBarrier;
+    };
+    std::vector<Task> tasks;
+
+    Config config;
+    const std::string name = copy(config, variableList);
+    std::string type;
+    while(readConfigChoice(config, name, type, OPTIONAL, "", ""))
+    {
+      auto renamed = Program::RenamedProgram::find(type);
+      if(renamed)
+        renameDeprecatedChoice(config, type, renamed->oldName, renamed->newName, renamed->time);
+
+      Program::Program *program = Program::Program::find(type);
+      if(program && readConfigChoiceElement(config, program->name(), type, ""))
+      {
+        Task task;
+        task.program   = program;
+        task.comment   = comment(config);
+        task.nodeName  = config.currentNodeName();
+        task.xmlNode   = config.stack.top().xmlNode->clone();
+        task.varList   = config.getVarList();
+        task.isBarrier = !collectFileNames(task.xmlNode, global, task.varList, task.inputs, task.outputs) || (task.inputs.empty() && task.outputs.empty());
+        config.stack.top().xmlNode->clearChildren(); // elements are read at execution
+        tasks.push_back(std::move(task));
+      }
+
+      endChoice(config);
+    }
+
+    // dependencies
+    // ------------
+    auto intersects = [](const std::set<std::string> &a, const std::set<std::string> &b)
+    {
+      return std::any_of(a.begin(), a.end(), [&](const std::string &x) {return b.count(x);});
+    };
+
+    std::vector<std::vector<UInt>> predecessors(tasks.size()), successors(tasks.size());
+    for(UInt k=0; k<tasks.size(); k++)
+      for(UInt i=0; i<k; i++)
+        if(tasks.at(i).isBarrier || tasks.at(k).isBarrier ||
+           intersects(tasks.at(i).outputs, tasks.at(k).inputs) || intersects(tasks.at(i).outputs, tasks.at(k).outputs) ||
+           intersects(tasks.at(i).inputs,  tasks.at(k).outputs))
+        {
+          predecessors.at(k).push_back(i);
+          successors.at(i).push_back(k);
+        }
+
+    // priority: longest chain of dependent programs
+    std::vector<UInt> level(tasks.size(), 1);
+    for(UInt i=tasks.size(); i-->0;)
+      for(UInt k : successors.at(i))
+        level.at(i) = std::max(level.at(i), level.at(k)+1);
+
+    // groups of processes
+    // -------------------
+    processCount = std::min(processCount, Parallel::size(comm)-1);
+    const UInt rank = Parallel::myRank(comm);
+    auto commLocal = Parallel::splitCommunicator(rank ? (rank-1)/processCount : NULLINDEX, rank, comm); // processes of a program
+    auto commLoop  = Parallel::splitCommunicator(((rank == 0) || ((rank-1)%processCount == 0)) ?  0 : NULLINDEX, rank, comm); // 'main' processes of all groups
+
+    Bool failed = FALSE;
+    if(commLoop && Parallel::isMaster(commLoop))
+    {
+      // scheduler
+      // ---------
+      logStatus<<"run "<<tasks.size()<<" programs with "<<Parallel::size(commLoop)-1<<" groups of processes"<<Log::endl;
+      const auto timeStart = std::chrono::steady_clock::now();
+      auto seconds = [&]() {return std::chrono::duration<Double>(std::chrono::steady_clock::now()-timeStart).count();};
+
+      std::vector<Double> start(tasks.size()), end(tasks.size());
+      std::vector<UInt>   count(tasks.size()), ready, freeWorkers;
+      for(UInt i=0; i<tasks.size(); i++)
+      {
+        count.at(i) = predecessors.at(i).size();
+        if(!count.at(i))
+          ready.push_back(i);
+      }
+
+      const UInt workerCount = Parallel::size(commLoop)-1;
+      UInt running = 0;
+      for(;;)
+      {
+        while(!failed && freeWorkers.size() && ready.size())
+        {
+          auto iter = std::max_element(ready.begin(), ready.end(), [&](UInt a, UInt b) {return (level.at(a) < level.at(b)) || ((level.at(a) == level.at(b)) && (a > b));});
+          const UInt idTask = *iter;
+          ready.erase(iter);
+          start.at(idTask) = seconds();
+          Parallel::send(idTask, freeWorkers.back(), commLoop);
+          freeWorkers.pop_back();
+          running++;
+        }
+        if(!running && (failed || ready.empty()) && (freeWorkers.size() == workerCount))
+          break;
+
+        Vector3d msg; // worker, finished task (or -1), failed (single message from arbitrary process)
+        Parallel::receive(msg, NULLINDEX, commLoop);
+        if(msg.y() >= 0)
+        {
+          const UInt idTask = static_cast<UInt>(msg.y());
+          end.at(idTask) = seconds();
+          running--;
+          if(msg.z())
+            failed = TRUE;
+          for(UInt k : successors.at(idTask))
+            if(--count.at(k) == 0)
+              ready.push_back(k);
+        }
+        freeWorkers.push_back(static_cast<UInt>(msg.x()));
+      }
+      for(UInt worker : freeWorkers)
+        Parallel::send(NULLINDEX, worker, commLoop); // end signal
+
+      // realized critical path
+      if(!failed && tasks.size())
+      {
+        std::vector<UInt> path;
+        UInt idTask = std::distance(end.begin(), std::max_element(end.begin(), end.end()));
+        for(;;)
+        {
+          path.push_back(idTask);
+          if(predecessors.at(idTask).empty())
+            break;
+          idTask = *std::max_element(predecessors.at(idTask).begin(), predecessors.at(idTask).end(), [&](UInt a, UInt b) {return end.at(a) < end.at(b);});
+        }
+        Double sum = 0;
+        for(UInt i=0; i<tasks.size(); i++)
+          sum += end.at(i)-start.at(i);
+        logInfo<<"wall time: "<<seconds()%"%.1f s"s<<", sum of all programs: "<<sum%"%.1f s"s<<", critical path:"<<Log::endl;
+        for(UInt i=path.size(); i-->0;)
+          logInfo<<"  "<<path.at(i)+1<<". "<<tasks.at(path.at(i)).program->name()<<tasks.at(path.at(i)).comment
+                 <<": "<<start.at(path.at(i))%"%.1f s"s<<" - "<<end.at(path.at(i))%"%.1f s"s<<Log::endl;
+      }
+    }
+    else
+    {
+      // groups of processes
+      // -------------------
+      UInt idTask = NULLINDEX;
+      for(;;)
+      {
+        if(Parallel::isMaster(commLocal))
+        {
+          Parallel::send(Vector3d(static_cast<Double>(Parallel::myRank(commLoop)), (idTask == NULLINDEX) ? -1. : static_cast<Double>(idTask), failed ? 1. : 0.), 0, commLoop);
+          Parallel::receive(idTask, 0, commLoop);
+        }
+        Parallel::broadCast(idTask, 0, commLocal);
+        if(idTask == NULLINDEX) // end signal?
+          break;
+
+        failed = FALSE;
+        Bool outputOld = Log::enableOutput(parallelLog && Parallel::isMaster(commLocal));
+        try
+        {
+          Parallel::broadCastExceptions(commLocal, [&](Parallel::CommunicatorPtr commLocal)
+          {
+            const Task &task = tasks.at(idTask);
+            Config config;
+            config.push(task.xmlNode->clone(), Config::SEQUENCE, task.nodeName);
+            config.createSchema = FALSE;
+            config.global       = global;
+            config.varList      = task.varList;
+            logStatus<<"--- "<<idTask+1<<". "<<task.program->name()<<task.comment<<" ---"<<Log::endl;
+            task.program->run(config, commLocal);
+            config.notEmptyWarning();
+            Parallel::barrier(commLocal);
+          });
+        }
+        catch(std::exception &e)
+        {
+          if(Parallel::isMaster(commLocal))
+            logError<<e.what()<<Log::endl;
+          failed = TRUE;
+        }
+        Log::enableOutput(outputOld);
+      }
+    }
+
+    Parallel::barrier(comm);
+    Parallel::broadCast(failed, 0, comm);
+    if(failed)
+      throw(Exception("at least one program failed"));
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
 /***********************************************/
 /*** Functions *********************************/
 /***********************************************/
@@ -147,8 +147,40 @@ public:
 * @ingroup config */
 class ProgramConfig : public Config
 {
+  static std::string comment(Config &config);
+
 public:
   void run(VariableList &variableList, Parallel::CommunicatorPtr comm) const;
+
+  /** @brief Skip programs which are unchanged since the last run.
+  * A program is skipped in @a run() if the hash of its config (links and variables resolved)
+  * and the size and modification time of all its inputfile* and outputfile* files
+  * are the same as recorded in @p fileName after its last execution.
+  * Programs with unresolvable config, without output files, or tagged with 'System'
+  * (e.g. FileRemove, RunCommand, LoopPrograms) are always executed.
+  * @param fileName build cache, read at call and rewritten after each executed program (empty: disabled). */
+  static void setBuildCache(const FileName &fileName);
+
+  /** @brief File names of all inputfile* elements (including nested ones) resolvable with @p variableList.
+  * File names depending on unknown variables (e.g. inner loop variables) are omitted.
+  * Used to prefetch the input files of upcoming iterations. */
+  std::set<std::string> inputFileNames(const VariableList &variableList) const;
+
+  /** @brief Executes independent programs concurrently on groups of processes.
+  * The dependencies between the programs are inferred from the file names of
+  * all inputfile* and outputfile* elements (including nested ones).
+  * Programs without file names or with file names which cannot be resolved
+  * (e.g. depending on inner loop variables) wait for all previous programs
+  * and all following programs wait for them.
+  * The first process schedules the ready programs (longest chain of dependent programs first)
+  * and the realized critical path is logged at the end.
+  * If @p processCountPerProgram is zero or less than three processes are available
+  * the programs are executed in order with all processes (see @a run()).
+  * @param variableList global variables.
+  * @param processCountPerProgram number of processes in each group.
+  * @param parallelLog all groups write output to screen and log file.
+  * @param comm communicator. */
+  void runParallel(VariableList &variableList, UInt processCountPerProgram, Bool parallelLog, Parallel::CommunicatorPtr comm) const;
 };
 
 /***** FUNCTIONS ***********************************/
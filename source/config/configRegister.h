@@ -248,7 +248,7 @@ public:
   virtual void registerConfigSchema(Config &config) const = 0;
   virtual void generateDocumentation(Documentation &documentation) const = 0;
 
-  static std::vector<SchemaClass*> classList(SchemaClass *schemaClass=nullptr)
+  static const std::vector<SchemaClass*> &classList(SchemaClass *schemaClass=nullptr)
   {
     static std::vector<SchemaClass*> list;
     if(schemaClass != nullptr)
@@ -281,7 +281,7 @@ public:
   RenamedSchemaClass(const Renamed &renamed) {renamedList(renamed);}
   virtual ~RenamedSchemaClass() {}
 
-  static std::vector<Renamed> renamedList(const Renamed &renamed = Renamed("", "", Time()))
+  static const std::vector<Renamed> &renamedList(const Renamed &renamed = Renamed("", "", Time()))
   {
     static std::vector<Renamed> list;
     if(!renamed.oldName.empty())
@@ -33,6 +33,11 @@
 #define blas_dsyrk   FORTRANCALL(wrapdsyrk , WRAPDSYRK )
 #define blas_dsyr2k  FORTRANCALL(wrapdsyr2k, WRAPDSYR2K)
 
+// single precision
+#define blas_sgemm   FORTRANCALL(wrapsgemm , WRAPSGEMM )
+#define blas_strsm   FORTRANCALL(wrapstrsm , WRAPSTRSM )
+#define blas_ssyrk   FORTRANCALL(wrapssyrk , WRAPSSYRK )
+
 extern "C"
 {
 void   blas_dswap (const F77Int &n,                         const F77Double x[], const F77Int &incx, F77Double y[], const F77Int &inxy);
@@ -50,6 +55,11 @@ void   blas_dtrmm (const F77Bool &left,   const F77Bool &upper,  const F77Bool &
 void   blas_dtrsm (const F77Bool &left,   const F77Bool &upper,  const F77Bool &trans, const F77Bool &unitDiag, const F77Int &m, const F77Int &n, const F77Double &alpha, const F77Double A[], const F77Int &ldA, F77Double B[], const F77Int &ldB);
 void   blas_dsyrk (const F77Bool &upper,  const F77Bool &trans,  const F77Int  &n, const F77Int &k, const F77Double &alpha, const F77Double A[], const F77Int &ldA, const F77Double &beta, F77Double C[], const F77Int &ldC);
 void   blas_dsyr2k(const F77Bool &upper,  const F77Bool &trans,  const F77Int  &n, const F77Int &k, const F77Double &alpha, const F77Double A[], const F77Int &ldA, const F77Double B[], const F77Int &ldB, const F77Double &beta, F77Double C[], const F77Int &ldC);
+
+// single precision
+void   blas_sgemm (const F77Bool &transA, const F77Bool &transB, const F77Int  &m, const F77Int &n, const F77Int &k, const F77Float &alpha, const F77Float A[], const F77Int &ldA, const F77Float B[], const F77Int &ldB, const F77Float &beta, F77Float C[], const F77Int &ldC);
+void   blas_strsm (const F77Bool &left,   const F77Bool &upper,  const F77Bool &trans, const F77Bool &unitDiag, const F77Int &m, const F77Int &n, const F77Float &alpha, const F77Float A[], const F77Int &ldA, F77Float B[], const F77Int &ldB);
+void   blas_ssyrk (const F77Bool &upper,  const F77Bool &trans,  const F77Int  &n, const F77Int &k, const F77Float &alpha, const F77Float A[], const F77Int &ldA, const F77Float &beta, F77Float C[], const F77Int &ldC);
 }
 
 /***********************************************/
@@ -19,6 +19,7 @@
 
 #define wrapdlacpy  FORTRANCALL(wrapdlacpy, WRAPDLACPY)
 #define wrapdpotrf  FORTRANCALL(wrapdpotrf, WRAPDPOTRF)
+#define wrapspotrf  FORTRANCALL(wrapspotrf, WRAPSPOTRF)
 #define wrapdpotri  FORTRANCALL(wrapdpotri, WRAPDPOTRI)
 #define wrapdpstrf  FORTRANCALL(wrapdpstrf, WRAPDPSTRF)
 #define wrapdtrtri  FORTRANCALL(wrapdtrtri, WRAPDTRTRI)
@@ -40,6 +41,11 @@
 #define wrapdgeev   FORTRANCALL(wrapdgeev , WRAPDGEEV )
 #define wrapdgesvd  FORTRANCALL(wrapdgesvd, WRAPDGESVD)
 #define wrapdgesdd  FORTRANCALL(wrapdgesdd, WRAPDGESDD)
+#define wrapdtrttf  FORTRANCALL(wrapdtrttf, WRAPDTRTTF)
+#define wrapdtfttr  FORTRANCALL(wrapdtfttr, WRAPDTFTTR)
+#define wrapdpftrf  FORTRANCALL(wrapdpftrf, WRAPDPFTRF)
+#define wrapdsfrk   FORTRANCALL(wrapdsfrk , WRAPDSFRK )
+#define wrapdtfsm   FORTRANCALL(wrapdtfsm , WRAPDTFSM )
 
 /***********************************************/
 
@@ -48,6 +54,7 @@ void lapack_dlacpy(UInt m, UInt n, const Double A[], UInt ldA, Double B[], UInt
 
 // Cholesky, Inverse
 Int lapack_dpotrf(Bool upper, UInt n, Double A[], UInt ldA);
+Int lapack_spotrf(Bool upper, UInt n, Float  A[], UInt ldA);
 Int lapack_dpotri(Bool upper, UInt n, Double A[], UInt ldA);
 Int lapack_dtrtri(Bool upper, UInt n, Double A[], UInt ldA);
 Int lapack_dlaumm(Bool upper, UInt n, Double A[], UInt ldA);
@@ -82,6 +89,13 @@ Int lapack_dgeev(Bool jobvl, Bool jobvr, UInt n, Double A[], UInt ldA, Double WR
 Int lapack_dgesvd(Bool jobu, Bool jobvt, UInt m, UInt n, Double A[], UInt ldA, Double S[], Double U[], UInt ldU, Double VT[], UInt ldvt);
 Int lapack_dgesdd(Bool jobz, UInt m, UInt n, Double A[], UInt ldA, Double S[], Double U[], UInt ldU, Double VT[], UInt ldvt);
 
+// rectangular full packed format (RFP)
+Int  lapack_dtrttf(Bool upper, UInt n, const Double A[], UInt ldA, Double ARF[]);
+Int  lapack_dtfttr(Bool upper, UInt n, const Double ARF[], Double A[], UInt ldA);
+Int  lapack_dpftrf(Bool upper, UInt n, Double ARF[]);
+void lapack_dsfrk (Bool upper, Bool trans, UInt n, UInt k, Double alpha, const Double A[], UInt ldA, Double beta, Double C[]);
+void lapack_dtfsm (Bool left, Bool upper, Bool trans, UInt m, UInt n, Double alpha, const Double ARF[], Double B[], UInt ldB);
+
 /***********************************************/
 /***********************************************/
 
@@ -89,6 +103,7 @@ extern "C"
 {
 void wrapdlacpy(const F77Int &m, const F77Int &n, const F77Double A[], const F77Int &ldA, F77Double B[], const F77Int &ldB);
 void wrapdpotrf(const F77Int &upper, const F77Int &n, F77Double A[], const F77Int &ldA, F77Int &info);
+void wrapspotrf(const F77Int &upper, const F77Int &n, F77Float  A[], const F77Int &ldA, F77Int &info);
 void wrapdpotri(const F77Int &upper, const F77Int &n, F77Double A[], const F77Int &ldA, F77Int &info);
 void wrapdpstrf(const F77Int &upper, const F77Int &n, F77Double A[], const F77Int &ldA, F77Int ipiv[], F77Int &rank, F77Double &tol, F77Double work[], F77Int &info);
 void wrapdtrtri(const F77Int &upper, const F77Int &n, F77Double A[], const F77Int &ldA, F77Int &info);
@@ -110,6 +125,11 @@ void wrapdsyev (const F77Int &jobz, const F77Int &upper, const F77Int &n, F77Dou
 void wrapdgeev (const F77Int &jobvl, const F77Int &jobvr, const F77Int &n, F77Double A[], const F77Int &ldA, F77Double WR[], F77Double WI[], F77Double VL[], const F77Int &ldVL, F77Double VR[], const F77Int &ldVR, F77Double work[], const F77Int &lwork, F77Int &info);
 void wrapdgesvd(const F77Int &jobu, const F77Int &jobvt, const F77Int &m, const F77Int &n, F77Double A[], const F77Int &ldA, F77Double S[], F77Double U[], const F77Int &ldU, F77Double VT[], const F77Int &ldvt, F77Double work[], const F77Int &lwork, F77Int &info);
 void wrapdgesdd(const F77Int &jobz, const F77Int &m, const F77Int &n, F77Double A[], const F77Int &ldA, F77Double S[], F77Double U[], const F77Int &ldU, F77Double VT[], const F77Int &ldvt, F77Double work[], const F77Int &lwork, F77Int iwork[], F77Int &info);
+void wrapdtrttf(const F77Int &upper, const F77Int &n, const F77Double A[], const F77Int &ldA, F77Double ARF[], F77Int &info);
+void wrapdtfttr(const F77Int &upper, const F77Int &n, const F77Double ARF[], F77Double A[], const F77Int &ldA, F77Int &info);
+void wrapdpftrf(const F77Int &upper, const F77Int &n, F77Double ARF[], F77Int &info);
+void wrapdsfrk (const F77Int &upper, const F77Int &trans, const F77Int &n, const F77Int &k, const F77Double &alpha, const F77Double A[], const F77Int &ldA, const F77Double &beta, F77Double C[]);
+void wrapdtfsm (const F77Int &left, const F77Int &upper, const F77Int &trans, const F77Int &m, const F77Int &n, const F77Double &alpha, const F77Double ARF[], F77Double B[], const F77Int &ldB);
 }
 
 /***** INLINES *********************************/
@@ -126,6 +146,13 @@ inline Int lapack_dpotrf(Bool upper, UInt n, Double A[], UInt ldA)
   return info;
 }
 
+inline Int lapack_spotrf(Bool upper, UInt n, Float A[], UInt ldA)
+{
+  F77Int info;
+  wrapspotrf(upper, static_cast<F77Int>(n), A, static_cast<F77Int>(ldA), info);
+  return info;
+}
+
 inline Int lapack_dpotri(Bool upper, UInt n, Double A[], UInt ldA)
 {
   F77Int info;
@@ -328,6 +355,37 @@ inline Int lapack_dgesdd(Bool jobz, UInt m, UInt n, Double A[], UInt ldA, Double
   return info;
 }
 
+inline Int lapack_dtrttf(Bool upper, UInt n, const Double A[], UInt ldA, Double ARF[])
+{
+  F77Int info;
+  wrapdtrttf(upper, static_cast<F77Int>(n), A, static_cast<F77Int>(ldA), ARF, info);
+  return info;
+}
+
+inline Int lapack_dtfttr(Bool upper, UInt n, const Double ARF[], Double A[], UInt ldA)
+{
+  F77Int info;
+  wrapdtfttr(upper, static_cast<F77Int>(n), ARF, A, static_cast<F77Int>(ldA), info);
+  return info;
+}
+
+inline Int lapack_dpftrf(Bool upper, UInt n, Double ARF[])
+{
+  F77Int info;
+  wrapdpftrf(upper, static_cast<F77Int>(n), ARF, info);
+  return info;
+}
+
+inline void lapack_dsfrk(Bool upper, Bool trans, UInt n, UInt k, Double alpha, const Double A[], UInt ldA, Double beta, Double C[])
+{
+  wrapdsfrk(upper, trans, static_cast<F77Int>(n), static_cast<F77Int>(k), alpha, A, static_cast<F77Int>(ldA), beta, C);
+}
+
+inline void lapack_dtfsm(Bool left, Bool upper, Bool trans, UInt m, UInt n, Double alpha, const Double ARF[], Double B[], UInt ldB)
+{
+  wrapdtfsm(left, upper, trans, static_cast<F77Int>(m), static_cast<F77Int>(n), alpha, ARF, B, static_cast<F77Int>(ldB));
+}
+
 /***********************************************/
 
 #endif /* __GROOPS_LAPACK__ */
@@ -21,6 +21,20 @@ c
       end
 c
 c *******************************************
+c
+      subroutine wrapspotrf(upper,n,A,ldA,info)
+      integer   upper
+      character uplo
+      external spotrf
+      if(upper.eq.0) then
+        uplo = 'L'
+      else
+        uplo = 'U'
+      endif
+      call spotrf(uplo,n,A,ldA,info)
+      end
+c
+c *******************************************
 c
       subroutine wrapdpstrf(upper,n,A,ldA,piv,rank,
      $                      tol,work,info)
@@ -306,4 +320,89 @@ c
       end
 c
 c *******************************************
+c
+      subroutine wrapdtrttf(upper,n,A,ldA,ARF,info)
+      integer   upper
+      character uplo
+      external dtrttf
+      if(upper.eq.0) then
+        uplo = 'L'
+      else
+        uplo = 'U'
+      endif
+      call dtrttf('N',uplo,n,A,ldA,ARF,info)
+      end
+c
+c *******************************************
+c
+      subroutine wrapdtfttr(upper,n,ARF,A,ldA,info)
+      integer   upper
+      character uplo
+      external dtfttr
+      if(upper.eq.0) then
+        uplo = 'L'
+      else
+        uplo = 'U'
+      endif
+      call dtfttr('N',uplo,n,ARF,A,ldA,info)
+      end
+c
+c *******************************************
+c
+      subroutine wrapdpftrf(upper,n,ARF,info)
+      integer   upper
+      character uplo
+      external dpftrf
+      if(upper.eq.0) then
+        uplo = 'L'
+      else
+        uplo = 'U'
+      endif
+      call dpftrf('N',uplo,n,ARF,info)
+      end
+c
+c *******************************************
+c
+      subroutine wrapdsfrk(upper,trans,n,k,alpha,A,ldA,beta,C)
+      integer   upper, trans
+      character uplo, tr
+      external dsfrk
+      if(upper.eq.0) then
+        uplo = 'L'
+      else
+        uplo = 'U'
+      endif
+      if(trans.eq.0) then
+        tr = 'N'
+      else
+        tr = 'T'
+      endif
+      call dsfrk('N',uplo,tr,n,k,alpha,A,ldA,beta,C)
+      end
+c
+c *******************************************
+c
+      subroutine wrapdtfsm(left,upper,trans,m,n,alpha,ARF,B,ldB)
+      integer   left, upper, trans
+      character side, uplo, tr
+      external dtfsm
+      if(left.eq.0) then
+        side = 'R'
+      else
+        side = 'L'
+      endif
+      if(upper.eq.0) then
+        uplo = 'L'
+      else
+        uplo = 'U'
+      endif
+      if(trans.eq.0) then
+        tr = 'N'
+      else
+        tr = 'T'
+      endif
+      call dtfsm('N',side,uplo,tr,'N',m,n,alpha,ARF,B,ldB)
+      end
+c
+c *******************************************
 c
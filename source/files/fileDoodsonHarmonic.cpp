@@ -15,6 +15,7 @@
 #include "base/import.h"
 #include "base/doodson.h"
 #include "inputOutput/fileArchive.h"
+#include "inputOutput/fileCache.h"
 #include "files/fileFormatRegister.h"
 #include "files/fileDoodsonHarmonic.h"
 
@@ -89,8 +90,28 @@ void readFileDoodsonHarmonic(const FileName &fileName, DoodsonHarmonic &x)
 {
   try
   {
-    InFileArchive file(fileName, FILE_DOODSONHARMONIC_TYPE);
-    file>>nameValue("doodsonHarmonic", x);
+    FileCache::read<DoodsonHarmonic>(fileName, FILE_DOODSONHARMONIC_TYPE, x, [](const FileName &fileName, DoodsonHarmonic &x)
+    {
+      InFileArchive file(fileName, FILE_DOODSONHARMONIC_TYPE);
+      file>>nameValue("doodsonHarmonic", x);
+    },
+    [](DoodsonHarmonic &x, UInt process, Parallel::CommunicatorPtr comm)
+    {
+      Parallel::broadCast(x.GM,      process, comm);
+      Parallel::broadCast(x.R,       process, comm);
+      Parallel::broadCast(x.doodson, process, comm);
+      x.cnmCos.resize(x.doodson.size());
+      x.snmCos.resize(x.doodson.size());
+      x.cnmSin.resize(x.doodson.size());
+      x.snmSin.resize(x.doodson.size());
+      for(UInt i=0; i<x.doodson.size(); i++)
+      {
+        Parallel::broadCastShared(x.cnmCos.at(i), process, comm);
+        Parallel::broadCastShared(x.snmCos.at(i), process, comm);
+        Parallel::broadCastShared(x.cnmSin.at(i), process, comm);
+        Parallel::broadCastShared(x.snmSin.at(i), process, comm);
+      }
+    });
   }
   catch(std::exception &e)
   {
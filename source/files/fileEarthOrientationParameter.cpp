@@ -14,6 +14,7 @@
 
 #include "base/import.h"
 #include "inputOutput/fileArchive.h"
+#include "inputOutput/fileCache.h"
 #include "files/fileFormatRegister.h"
 #include "files/fileEarthOrientationParameter.h"
 
@@ -54,22 +55,25 @@ void readFileEarthOrientationParameter(const FileName &fileName, Matrix &EOP)
 {
   try
   {
-    InFileArchive file(fileName, FILE_EARTHORIENTATIONPARAMETER_TYPE);
-    UInt count;
-    file>>nameValue("count", count);
-    EOP = Matrix(count, 7);
-    for(UInt i=0; i<count; i++)
+    FileCache::read<Matrix>(fileName, FILE_EARTHORIENTATIONPARAMETER_TYPE, EOP, [](const FileName &fileName, Matrix &EOP)
     {
-      file>>beginGroup("eop");
-      file>>nameValue("mjd",     EOP(i,0));
-      file>>nameValue("xp",      EOP(i,1));
-      file>>nameValue("yp",      EOP(i,2));
-      file>>nameValue("deltaUT", EOP(i,3));
-      file>>nameValue("lod",     EOP(i,4));
-      file>>nameValue("dX",      EOP(i,5));
-      file>>nameValue("dY",      EOP(i,6));
-      file>>endGroup("eop");
-    }
+      InFileArchive file(fileName, FILE_EARTHORIENTATIONPARAMETER_TYPE);
+      UInt count;
+      file>>nameValue("count", count);
+      EOP = Matrix(count, 7);
+      for(UInt i=0; i<count; i++)
+      {
+        file>>beginGroup("eop");
+        file>>nameValue("mjd",     EOP(i,0));
+        file>>nameValue("xp",      EOP(i,1));
+        file>>nameValue("yp",      EOP(i,2));
+        file>>nameValue("deltaUT", EOP(i,3));
+        file>>nameValue("lod",     EOP(i,4));
+        file>>nameValue("dX",      EOP(i,5));
+        file>>nameValue("dY",      EOP(i,6));
+        file>>endGroup("eop");
+      }
+    });
   }
   catch(std::exception &e)
   {
@@ -174,18 +174,27 @@ Matrix InFileEphemerides::interpolate(const Time &time, Planet planet)
     const UInt idSub = static_cast<UInt>(std::floor(t));
     t = 2.*(t-idSub)-1.; // [-1, 1) in subinterval idSub
 
-    // Chebyshev polynomials and derivative in second column
-    Matrix p(degree.at(idBody)+1, 2);
-    p(0, 0) = 1.;
-    p(1, 0) = t;
-    p(1, 1) = 2./dt;
-    for(UInt n=2; n<p.rows(); n++)
+    // Chebyshev polynomials and derivative accumulated directly (avoids small matrix products)
+    const Matrix &c = coeff.at(idBody).at(idSub);
+    Matrix posVel(c.rows(), 2);
+    Double p0 = 1., p1 = t, d0 = 0., d1 = 2./dt;
+    for(UInt i=0; i<c.rows(); i++)
     {
-      p(n, 0) = 2*t*p(n-1, 0) - p(n-2, 0);
-      p(n, 1) = 2*t*p(n-1, 1) - p(n-2, 1) + 4./dt*p(n-1, 0);
+      posVel(i, 0) = c(i, 0) + c(i, 1) * p1;
+      posVel(i, 1) = c(i, 1) * d1;
+    }
+    for(UInt n=2; n<c.columns(); n++)
+    {
+      const Double p2 = 2*t*p1 - p0;
+      const Double d2 = 2*t*d1 - d0 + 4./dt*p1;
+      for(UInt i=0; i<c.rows(); i++)
+      {
+        posVel(i, 0) += c(i, n) * p2;
+        posVel(i, 1) += c(i, n) * d2;
+      }
+      p0 = p1; p1 = p2;
+      d0 = d1; d1 = d2;
     }
-
-    Matrix posVel = coeff.at(idBody).at(idSub) * p;
     if(planet == MOON)
     {
       posVel *= earthMoonRatio/(1.+earthMoonRatio);     // relative to earth-moon bary center
@@ -25,15 +25,65 @@ GROOPS_REGISTER_FILEFORMAT(GnssAntennaDefinition, "gnssAntennaDefinition")
 /***********************************************/
 
 Vector GnssAntennaDefinition::antennaVariations(Angle azimut, Angle elevation, const std::vector<GnssType> &types, NoPatternFoundAction noPatternFoundAction) const
+{
+  try
+  {
+    return antennaVariations(azimut, elevation, types, findAntennaPatterns(types, noPatternFoundAction));
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+// bilinear interpolation weights of four grid points in pattern (azimut x zenit)
+static void interpolationWeights(const GnssAntennaPattern &p, Angle azimut, Angle elevation, UInt idx[4], Double w[4])
+{
+  Double tauA  = std::fmod(Double(azimut)/(2*PI)+1,1) * p.pattern.rows();
+  Double tauZ  = (PI/2-Double(elevation))/Double(p.dZenit);
+  const UInt idxA1 = static_cast<UInt>(std::floor(tauA));
+  const UInt idxA2 = (idxA1+1)%p.pattern.rows();
+  const UInt idxZ1 = std::min(static_cast<UInt>(std::floor(tauZ)), p.pattern.columns()-1);
+  const UInt idxZ2 = std::min(idxZ1+1, p.pattern.columns()-1);
+  tauA -= std::floor(tauA);
+  tauZ -= std::floor(tauZ);
+
+  const UInt ld = p.pattern.ld();
+  idx[0] = idxA1 + ld*idxZ1;  w[0] = (1-tauA) * (1-tauZ);
+  idx[1] = idxA1 + ld*idxZ2;  w[1] = (1-tauA) *  (tauZ);
+  idx[2] = idxA2 + ld*idxZ1;  w[2] =  (tauA)  * (1-tauZ);
+  idx[3] = idxA2 + ld*idxZ2;  w[3] =  (tauA)  *  (tauZ);
+}
+
+/***********************************************/
+
+Vector GnssAntennaDefinition::antennaVariations(Angle azimut, Angle elevation, const std::vector<GnssType> &types, const std::vector<UInt> &idPattern) const
 {
   try
   {
     Vector acv(types.size());
+    const Vector3d direction = polar(azimut, elevation, 1.);
+    const GnssAntennaPattern *grid = nullptr; // pattern with the grid of the current weights
+    UInt   idx[4];
+    Double w[4];
     for(UInt idType=0; idType<types.size(); idType++)
       if((types.at(idType) == GnssType::PHASE) || (types.at(idType) == GnssType::RANGE))
       {
-        const UInt idPattern = findAntennaPattern(types.at(idType), noPatternFoundAction);
-        acv(idType) = (idPattern == NULLINDEX) ? NAN_EXPR : pattern.at(idPattern).antennaVariations(azimut, elevation);
+        if(idPattern.at(idType) == NULLINDEX)
+        {
+          acv(idType) = NAN_EXPR;
+          continue;
+        }
+        const GnssAntennaPattern &p = pattern.at(idPattern.at(idType));
+        if(!grid || (p.pattern.rows() != grid->pattern.rows()) || (p.pattern.columns() != grid->pattern.columns()) || (p.dZenit != grid->dZenit))
+        {
+          interpolationWeights(p, azimut, elevation, idx, w);
+          grid = &p;
+        }
+        const Double *values = p.pattern.field();
+        acv(idType) = w[0]*values[idx[0]] + w[1]*values[idx[1]] + w[2]*values[idx[2]] + w[3]*values[idx[3]] - inner(p.offset, direction);
       }
 
     return acv;
@@ -79,6 +129,24 @@ UInt GnssAntennaDefinition::findAntennaPattern(const GnssType &type, NoPatternFo
 
 /***********************************************/
 
+std::vector<UInt> GnssAntennaDefinition::findAntennaPatterns(const std::vector<GnssType> &types, NoPatternFoundAction noPatternFoundAction) const
+{
+  try
+  {
+    std::vector<UInt> idPattern(types.size(), NULLINDEX);
+    for(UInt idType=0; idType<types.size(); idType++)
+      if((types.at(idType) == GnssType::PHASE) || (types.at(idType) == GnssType::RANGE))
+        idPattern.at(idType) = findAntennaPattern(types.at(idType), noPatternFoundAction);
+    return idPattern;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 UInt GnssAntennaDefinition::find(const std::vector<GnssAntennaDefinitionPtr> &antennaList, const std::string &name, const std::string &serial, const std::string radome)
 {
   try
@@ -104,20 +172,13 @@ Double GnssAntennaPattern::antennaVariations(Angle azimut, Angle elevation, Bool
 {
   try
   {
-    Double tauA  = std::fmod(Double(azimut)/(2*PI)+1,1) * pattern.rows();
-    Double tauZ  = (PI/2-Double(elevation))/Double(dZenit);
-    const UInt idxA1 = static_cast<UInt>(std::floor(tauA));
-    const UInt idxA2 = (idxA1+1)%pattern.rows();
-    const UInt idxZ1 = std::min(static_cast<UInt>(std::floor(tauZ)), pattern.columns()-1);
-    const UInt idxZ2 = std::min(idxZ1+1, pattern.columns()-1);
-    tauA -= std::floor(tauA);
-    tauZ -= std::floor(tauZ);
+    UInt   idx[4];
+    Double w[4];
+    interpolationWeights(*this, azimut, elevation, idx, w);
 
     // bilinear interpolation
-    Double acv = (1-tauA) * (1-tauZ) * pattern(idxA1, idxZ1)
-               + (1-tauA) *  (tauZ)  * pattern(idxA1, idxZ2)
-               +  (tauA)  * (1-tauZ) * pattern(idxA2, idxZ1)
-               +  (tauA)  *  (tauZ)  * pattern(idxA2, idxZ2);
+    const Double *values = pattern.field();
+    Double acv = w[0]*values[idx[0]] + w[1]*values[idx[1]] + w[2]*values[idx[2]] + w[3]*values[idx[3]];
 
     if(applyOffset)
       acv -= inner(offset, polar(azimut, elevation, 1.));
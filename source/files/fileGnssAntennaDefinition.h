@@ -128,9 +128,16 @@ class GnssAntennaDefinition
 
   Vector antennaVariations(Angle azimut, Angle elevation, const std::vector<GnssType> &types, NoPatternFoundAction noPatternFoundAction) const;
 
+  /** @brief Antenna variations with patterns already resolved by @ref findAntennaPatterns.
+  * The interpolation weights are computed only once for all patterns with the same grid. */
+  Vector antennaVariations(Angle azimut, Angle elevation, const std::vector<GnssType> &types, const std::vector<UInt> &idPattern) const;
+
   /** @brief Returns id of pattern matching @p type or of nearest frequency pattern depending on @p noPatternFoundAction. Returns NULLINDEX if there are no patterns. */
   UInt findAntennaPattern(const GnssType &type, NoPatternFoundAction noPatternFoundAction) const;
 
+  /** @brief Returns ids of patterns for all @p types (see @ref findAntennaPattern). NULLINDEX for types other than phase and range. */
+  std::vector<UInt> findAntennaPatterns(const std::vector<GnssType> &types, NoPatternFoundAction noPatternFoundAction) const;
+
   static UInt find(const std::vector<GnssAntennaDefinitionPtr> &antennaList, const std::string &name, const std::string &serial, const std::string radome);
 };
 
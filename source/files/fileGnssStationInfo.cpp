@@ -60,7 +60,7 @@ UInt GnssStationInfo::findReceiver(const Time &time) const
 
 /***********************************************/
 
-Vector GnssStationInfo::antennaVariations(const Time &time, Angle azimut, Angle elevation, const std::vector<GnssType> &types, GnssAntennaDefinition::NoPatternFoundAction noPatternFoundAction) const
+const GnssAntennaDefinition &GnssStationInfo::antennaDefinition(const Time &time) const
 {
   try
   {
@@ -69,7 +69,7 @@ Vector GnssStationInfo::antennaVariations(const Time &time, Angle azimut, Angle
       throw(Exception(markerName+"."+markerNumber+": no antenna definition found at "+time.dateTimeStr()));
     if(!antenna.at(idAnt).antennaDef)
       throw(Exception("no antenna definition for "+antenna.at(idAnt).str()));
-    return antenna.at(idAnt).antennaDef->antennaVariations(azimut, elevation, types, noPatternFoundAction);
+    return *antenna.at(idAnt).antennaDef;
   }
   catch(std::exception &e)
   {
@@ -79,16 +79,44 @@ Vector GnssStationInfo::antennaVariations(const Time &time, Angle azimut, Angle
 
 /***********************************************/
 
-Vector GnssStationInfo::accuracy(const Time &time, Angle azimut, Angle elevation, const std::vector<GnssType> &types, GnssAntennaDefinition::NoPatternFoundAction noPatternFoundAction) const
+const GnssAntennaDefinition &GnssStationInfo::accuracyDefinition(const Time &time) const
 {
   try
   {
-    UInt idAnt = findAntenna(time);
+    const UInt idAnt = findAntenna(time);
     if(idAnt == NULLINDEX)
       throw(Exception(markerName+"."+markerNumber+": no antenna accuracy found at "+time.dateTimeStr()));
     if(!antenna.at(idAnt).accuracyDef)
       throw(Exception("no accuracy definition for "+antenna.at(idAnt).str()));
-    return antenna.at(idAnt).accuracyDef->antennaVariations(azimut, elevation, types, noPatternFoundAction);
+    return *antenna.at(idAnt).accuracyDef;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Vector GnssStationInfo::antennaVariations(const Time &time, Angle azimut, Angle elevation, const std::vector<GnssType> &types, GnssAntennaDefinition::NoPatternFoundAction noPatternFoundAction) const
+{
+  try
+  {
+    return antennaDefinition(time).antennaVariations(azimut, elevation, types, noPatternFoundAction);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Vector GnssStationInfo::accuracy(const Time &time, Angle azimut, Angle elevation, const std::vector<GnssType> &types, GnssAntennaDefinition::NoPatternFoundAction noPatternFoundAction) const
+{
+  try
+  {
+    return accuracyDefinition(time).antennaVariations(azimut, elevation, types, noPatternFoundAction);
   }
   catch(std::exception &e)
   {
@@ -137,6 +137,11 @@ class GnssStationInfo
   Vector antennaVariations(const Time &time, Angle azimut, Angle elevation, const std::vector<GnssType> &type, GnssAntennaDefinition::NoPatternFoundAction noPatternFoundAction) const;
   Vector accuracy         (const Time &time, Angle azimut, Angle elevation, const std::vector<GnssType> &type, GnssAntennaDefinition::NoPatternFoundAction noPatternFoundAction) const;
 
+  /** @brief Antenna definition (antenna center variations) valid at @p time. Throws an exception if not available. */
+  const GnssAntennaDefinition &antennaDefinition (const Time &time) const;
+  /** @brief Antenna accuracy definition valid at @p time. Throws an exception if not available. */
+  const GnssAntennaDefinition &accuracyDefinition(const Time &time) const;
+
   void   fillAntennaPattern (const std::vector<GnssAntennaDefinitionPtr> &antennaList);
   void   fillAntennaAccuracy(const std::vector<GnssAntennaDefinitionPtr> &antennaList);
   void   fillReceiverDefinition(const std::vector<GnssReceiverDefinitionPtr> &receiverList);
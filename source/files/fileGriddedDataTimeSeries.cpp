@@ -15,6 +15,7 @@
 #include "base/import.h"
 #include "base/basisSplines.h"
 #include "inputOutput/fileArchive.h"
+#include "inputOutput/logging.h"
 #include "files/fileFormatRegister.h"
 #include "files/fileGriddedData.h"
 #include "files/fileGriddedDataTimeSeries.h"
@@ -155,18 +156,23 @@ Matrix InFileGriddedDataTimeSeries::data(const Time &time)
 /***********************************************/
 /***********************************************/
 
-void writeFileGriddedDataTimeSeries(const FileName &fileName, UInt splineDegree, const std::vector<Time> &times,
-                                    const GriddedData &grid, const std::vector<Matrix> &data)
+void OutFileGriddedDataTimeSeries::open(const FileName &name, UInt splineDegree, const std::vector<Time> &times, const GriddedData &grid, UInt dataCount)
 {
   try
   {
+    close();
     if(!grid.isValid())
       throw(Exception("GriddedData is not valid"));
-    if(times.size()+splineDegree != data.size()+1)
-      throw(Exception("spline degree, times.size(), and data.size() not fit"));
-    const UInt dataCount = (data.size() ? data.front().columns() : 0);
+    if(times.size()+splineDegree < 1)
+      throw(Exception("spline degree and times.size() not fit"));
+
+    times_     = times;
+    pointCount_ = grid.points.size();
+    dataCount_ = dataCount;
+    nodeCount_ = times.size()+splineDegree-1;
+    indexNode  = 0;
 
-    OutFileArchive file(fileName, FILE_GRIDDEDDATATIMESERIES_TYPE);
+    file.open(name, FILE_GRIDDEDDATATIMESERIES_TYPE);
     file<<nameValue("splineDegree", splineDegree);
     file<<nameValue("timeCount",    times.size());
     file<<nameValue("dataCount",    dataCount);
@@ -175,30 +181,78 @@ void writeFileGriddedDataTimeSeries(const FileName &fileName, UInt splineDegree,
     file.comment("=====");
     for(UInt idEpoch=0; idEpoch<times.size(); idEpoch++)
       file<<nameValue("time", times.at(idEpoch));
-    for(UInt idEpoch=0; idEpoch<data.size(); idEpoch++)
-    {
-      file<<beginGroup("node");
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW_EXTRA("filename=<"+name.str()+">", e)
+  }
+}
 
-      // comment
-      std::string str;
-      for(UInt i=0; i<dataCount; i++)
-      {
-        std::string str2 = "data"+i%"%i"s;
-        str += str2 + std::string(26-str2.size(), ' ');
-      }
-      file.comment(times.at(idEpoch).dateTimeStr());
-      file.comment(str);
-      file.comment(std::string(str.size(), '='));
+/***********************************************/
 
-      for(UInt i=0; i<grid.points.size(); i++)
-      {
-        file<<beginGroup("points");
-        for(UInt k=0; k<dataCount; k++)
-          file<<nameValue("value", data.at(idEpoch)(i, k));
-        file<<endGroup("points");
-      }
-      file<<endGroup("node");
+void OutFileGriddedDataTimeSeries::close()
+{
+  if(!file.fileName().empty() && (indexNode != nodeCount_))
+    logWarning<<file.fileName()<<": "<<indexNode<<" nodes written, but "<<nodeCount_<<" expected"<<Log::endl;
+  file.close();
+  times_.clear();
+  nodeCount_ = indexNode = 0;
+}
+
+/***********************************************/
+
+void OutFileGriddedDataTimeSeries::writeNode(const_MatrixSliceRef data)
+{
+  try
+  {
+    if(indexNode >= nodeCount_)
+      throw(Exception("more nodes than expected ("+nodeCount_%"%i)"s));
+    if((data.rows() != pointCount_) || (data.columns() != dataCount_))
+      throw(Exception("data("+data.rows()%"%i x "s+data.columns()%"%i) must be (points x dataCount) = ("s+pointCount_%"%i x "s+dataCount_%"%i)"s));
+
+    file<<beginGroup("node");
+
+    // comment
+    std::string str;
+    for(UInt i=0; i<dataCount_; i++)
+    {
+      std::string str2 = "data"+i%"%i"s;
+      str += str2 + std::string(26-str2.size(), ' ');
+    }
+    if(indexNode < times_.size())
+      file.comment(times_.at(indexNode).dateTimeStr());
+    file.comment(str);
+    file.comment(std::string(str.size(), '='));
+
+    for(UInt i=0; i<pointCount_; i++)
+    {
+      file<<beginGroup("points");
+      for(UInt k=0; k<dataCount_; k++)
+        file<<nameValue("value", data(i, k));
+      file<<endGroup("points");
     }
+    file<<endGroup("node");
+    indexNode++;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW_EXTRA("filename=<"+file.fileName().str()+">", e)
+  }
+}
+
+/***********************************************/
+/***********************************************/
+
+void writeFileGriddedDataTimeSeries(const FileName &fileName, UInt splineDegree, const std::vector<Time> &times,
+                                    const GriddedData &grid, const std::vector<Matrix> &data)
+{
+  try
+  {
+    if(times.size()+splineDegree != data.size()+1)
+      throw(Exception("spline degree, times.size(), and data.size() not fit"));
+    OutFileGriddedDataTimeSeries file(fileName, splineDegree, times, grid, (data.size() ? data.front().columns() : 0));
+    for(const Matrix &d : data)
+      file.writeNode(d);
   }
   catch(std::exception &e)
   {
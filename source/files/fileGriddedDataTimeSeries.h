@@ -39,7 +39,9 @@ const char *const FILE_GRIDDEDDATATIMESERIES_TYPE = "griddedDataTimeSeries";
 
 /***** CLASS ***********************************/
 
-/** @brief Time series of gridded values. */
+/** @brief Time series of gridded values.
+* The nodes are read on demand. Only the splineDegree+1 nodes of the current interpolation interval are kept in memory,
+* binary files are accessed by seeking directly to the nodes. */
 class InFileGriddedDataTimeSeries
 {
   InFileArchive       file;
@@ -60,7 +62,7 @@ public:
   void close();
 
   UInt splineDegree() const {return splineDegree_;}
-  UInt nodeCount()    const {return times_.size()+splineDegree_;}  //!< number of spline nodal points (agree with times().size() for spline degree 1)
+  UInt nodeCount()    const {return times_.size()+splineDegree_-1;}  //!< number of spline nodal points (agree with times().size() for spline degree 1)
   UInt dataCount()    const {return dataCount_;}                   //!< number of data columns
 
   const GriddedData       &grid()  const {return grid_;}
@@ -73,6 +75,34 @@ public:
   Matrix data(const Time &time);
 };
 
+/***** CLASS ***********************************/
+
+/** @brief Write a time series of gridded values node by node.
+* Only one node must be kept in memory. */
+class OutFileGriddedDataTimeSeries
+{
+  OutFileArchive    file;
+  std::vector<Time> times_;
+  UInt              pointCount_, dataCount_, nodeCount_, indexNode;
+
+public:
+  OutFileGriddedDataTimeSeries() : pointCount_(0), dataCount_(0), nodeCount_(0), indexNode(0) {}
+  OutFileGriddedDataTimeSeries(const FileName &name, UInt splineDegree, const std::vector<Time> &times, const GriddedData &grid, UInt dataCount) {open(name, splineDegree, times, grid, dataCount);}
+ ~OutFileGriddedDataTimeSeries() {close();}
+
+  /** @brief Write the header with the points of @p grid.
+  * Exactly times.size()+splineDegree-1 nodes must be written afterwards. */
+  void open(const FileName &name, UInt splineDegree, const std::vector<Time> &times, const GriddedData &grid, UInt dataCount);
+  void close();
+
+  FileName fileName()   const {return file.fileName();}
+  UInt     pointCount() const {return pointCount_;}
+  UInt     dataCount()  const {return dataCount_;}
+
+  /// Write next node: data(points x data columns).
+  void writeNode(const_MatrixSliceRef data);
+};
+
 /***** FUNCTIONS *******************************/
 
 /** @brief Write into a GriddedData time series file. */
@@ -14,10 +14,13 @@
 
 #include "base/import.h"
 #include "inputOutput/fileArchive.h"
+#include "inputOutput/archiveBinary.h"
 #include "inputOutput/logging.h"
+#include "inputOutput/fileCache.h"
 #include "files/fileFormatRegister.h"
 #include "files/fileMatrix.h"
 #include "files/fileInstrument.h"
+#include <cstring>
 
 GROOPS_REGISTER_FILEFORMAT(Instrument, FILE_INSTRUMENT_TYPE)
 
@@ -282,7 +285,28 @@ void Arc::sort()
 {
   try
   {
-    std::stable_sort(epoch.begin(), epoch.end(), [](const std::unique_ptr<Epoch> &x, const std::unique_ptr<Epoch> &y) {return x->time < y->time;});
+    auto less = [](const std::unique_ptr<Epoch> &x, const std::unique_ptr<Epoch> &y) {return x->time < y->time;};
+
+    // start of ascending runs
+    std::vector<UInt> runStart(1, 0);
+    for(UInt i=1; i<epoch.size(); i++)
+      if(less(epoch.at(i), epoch.at(i-1)))
+        runStart.push_back(i);
+    runStart.push_back(epoch.size());
+
+    // pairwise merge of neighboring runs (stable)
+    while(runStart.size() > 2)
+    {
+      std::vector<UInt> runStartNew(1, 0);
+      for(UInt i=2; i<runStart.size(); i+=2)
+      {
+        std::inplace_merge(epoch.begin()+runStart.at(i-2), epoch.begin()+runStart.at(i-1), epoch.begin()+runStart.at(i), less);
+        runStartNew.push_back(runStart.at(i));
+      }
+      if(runStartNew.back() != epoch.size())
+        runStartNew.push_back(epoch.size());
+      runStart.swap(runStartNew);
+    }
   }
   catch(std::exception &e)
   {
@@ -382,6 +406,32 @@ void Arc::append(const Arc &arc)
 
 /***********************************************/
 
+void Arc::append(Arc &&arc)
+{
+  try
+  {
+    if(&arc==this)
+      throw(Exception("append same arc: not implemented"));
+    if(arc.size() == 0)
+      return;
+    if(size() == 0)
+      type = arc.type;
+    if(type != arc.getType())
+      throw(Exception("instruments types are different: "+getTypeName()+", "+arc.getTypeName()));
+
+    if(epoch.capacity() < size()+arc.size())
+      epoch.reserve(std::max(size()+arc.size(), 2*size())); // amortized for many appended arcs
+    std::move(arc.epoch.begin(), arc.epoch.end(), std::back_inserter(epoch));
+    arc.epoch.clear();
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 void Arc::synchronize(const std::vector<Time> &time, Double margin)
 {
   try
@@ -668,6 +718,91 @@ void Arc::printStatistics(const std::vector<Arc> &arcList)
 /***********************************************/
 /***********************************************/
 
+ArcColumns::ArcColumns(const Arc &arc) : type(arc.getType()), times(arc.times())
+{
+  try
+  {
+    if(!arc.size())
+      return;
+    const UInt count = arc.at(0).data().rows();
+    data = Matrix(arc.size(), count);
+    for(UInt i=0; i<arc.size(); i++)
+    {
+      const Vector x = arc.at(i).data();
+      if(x.rows() != count)
+        throw(Exception("varying number of data columns in arc"));
+      copy(x.trans(), data.row(i));
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+ArcColumns::ArcColumns(const std::vector<Time> &times_, const_MatrixSliceRef data_, Epoch::Type type_)
+  : type(type_), times(times_), data(data_)
+{
+  if(times.size() != data.rows())
+    throw(Exception("Dimension error: times.size = "+times.size()%"%i, data("s+data.rows()%"%i x "s+data.columns()%"%i)"s));
+}
+
+/***********************************************/
+
+Arc ArcColumns::arc() const
+{
+  try
+  {
+    if(!size())
+      return Arc(type);
+    Arc arc(type);
+    auto epoch = std::unique_ptr<Epoch>(Epoch::create(type));
+    for(UInt i=0; i<size(); i++)
+    {
+      epoch->time = times.at(i);
+      if(data.columns())
+        epoch->setData(data.row(i).trans());
+      arc.push_back(*epoch);
+    }
+    return arc;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Matrix ArcColumns::matrix() const
+{
+  try
+  {
+    if(!size())
+      return Matrix();
+    Matrix A(size(), 1+data.columns());
+    for(UInt i=0; i<size(); i++)
+      A(i,0) = times.at(i).mjd();
+    copy(data, A.column(1, data.columns()));
+
+    if(getType() == Epoch::STARCAMERA)
+      for(UInt i=1; i<size(); i++)
+        if(inner(A.slice(i-1,1,1,4), A.slice(i,1,1,4))<0)
+         A.slice(i,1,1,4) *= -1.;
+
+    return A;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+/***********************************************/
+
 void Arc::load(InArchive  &ia)
 {
   try
@@ -788,6 +923,62 @@ void InstrumentFile::close()
   fileName  = FileName();
   arcCount_ = 0;
   type      = Epoch::EMPTY;
+  arcStart.clear();
+}
+
+/***********************************************/
+
+// position file at the beginning of arc arcNo
+void InstrumentFile::seekArc(UInt arcNo)
+{
+  try
+  {
+    if(arcNo>=arcCount_)
+      throw(Exception("index >= arcCount"));
+
+    // start of arc already known?
+    if(file.canSeek() && (arcNo < arcStart.size()))
+    {
+      if(arcNo != index)
+        file.seek(arcStart.at(arcNo));
+      index = arcNo;
+      return;
+    }
+
+    // behind arc in file -> restart at beginning
+    if(arcNo<index)
+      open(FileName(fileName));
+
+    // skip arcs: in binary files all epochs of types with fixed data columns have the same size
+    const Bool isFixedSize = file.canSeek() && (dataCount() != NULLINDEX);
+    auto epoch = std::unique_ptr<Epoch>(Epoch::create(type));
+    while(index < arcNo)
+    {
+      if(file.canSeek() && (arcStart.size() == index))
+        arcStart.push_back(file.position());
+      UInt count;
+      file>>beginGroup("arc");
+      file>>nameValue("pointCount", count);
+      for(UInt i=0; i<count; i++)
+      {
+        const std::streampos pos = isFixedSize ? file.position() : std::streampos(0);
+        file>>nameValue("epoch", *epoch);
+        if(isFixedSize)
+        {
+          file.seek(pos + static_cast<std::streamoff>(count) * (file.position()-pos));
+          break;
+        }
+      }
+      file>>endGroup("arc");
+      index++;
+    }
+    if(file.canSeek() && (arcStart.size() == index))
+      arcStart.push_back(file.position());
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
 }
 
 /***********************************************/
@@ -802,35 +993,209 @@ Arc InstrumentFile::readArc(UInt i)
     if(i>=arcCount_)
       throw(Exception("index >= arcCount"));
 
-    // behind arc in file -> restart at beginning
-    if(i<index)
-      open(FileName(fileName));
-
     // special case: convert matrix to instrument arc
     if(file.type().empty() || (file.type() == FILE_MATRIX_TYPE))
     {
+      // behind arc in file -> restart at beginning
+      if(i<index)
+        open(FileName(fileName));
       Matrix B;
       std::swap(A, B);
       index++;
       return Arc(B, type);
     }
 
-    Arc arc;
+    seekArc(i);
+    Arc arc(type);
     auto epoch = std::unique_ptr<Epoch>(Epoch::create(type));
-    while(index <= i)
+    UInt count;
+    file>>beginGroup("arc");
+    file>>nameValue("pointCount", count);
+    for(UInt i=0; i<count; i++)
     {
-      arc = Arc(type);
-      UInt count;
-      file>>beginGroup("arc");
-      file>>nameValue("pointCount", count);
-      for(UInt i=0; i<count; i++)
+      file>>nameValue("epoch", *epoch);
+      arc.push_back(*epoch);
+    }
+    file>>endGroup("arc");
+    index++;
+    return arc;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Arc InstrumentFile::readArcShared(UInt arcNo)
+{
+  try
+  {
+    if(fileName.empty())
+      return Arc();
+
+    UInt fileSize;
+    const std::string key = FileCache::key("InstrumentArc:"+arcNo%"%i"s, fileName, fileSize);
+    if(key.empty())
+      return readArc(arcNo);
+
+    auto arc = std::static_pointer_cast<const Arc>(FileCache::find(key));
+    if(!arc)
+    {
+      auto arcNew = std::make_shared<Arc>(readArc(arcNo));
+      const UInt size = arcNew->size() ? (arcNew->size() * (1+arcNew->at(0).data().rows()) * sizeof(Double)) : 0;
+      FileCache::insert(key, arcNew, size);
+      arc = arcNew;
+    }
+    return *arc;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void InstrumentFile::readArc(UInt arcNo, const std::function<Bool(const Epoch &epoch)> &func)
+{
+  try
+  {
+    if(fileName.empty())
+      return;
+
+    if(arcNo>=arcCount_)
+      throw(Exception("index >= arcCount"));
+
+    // special case: convert matrix to instrument arc
+    if(file.type().empty() || (file.type() == FILE_MATRIX_TYPE))
+    {
+      const Arc arc = readArc(arcNo);
+      for(UInt i=0; i<arc.size(); i++)
+        if(!func(arc.at(i)))
+          break;
+      return;
+    }
+
+    seekArc(arcNo);
+    auto epoch = std::unique_ptr<Epoch>(Epoch::create(type));
+    UInt count;
+    file>>beginGroup("arc");
+    file>>nameValue("pointCount", count);
+    for(UInt i=0; i<count; i++)
+    {
+      file>>nameValue("epoch", *epoch);
+      if(!func(*epoch))
       {
-        file>>nameValue("epoch", *epoch);
-        arc.push_back(*epoch);
+        index = arcCount_; // stopped within the arc -> file position unknown
+        return;
       }
-      file>>endGroup("arc");
-      index++;
     }
+    file>>endGroup("arc");
+    index++;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+// Is the binary record of an epoch the time (mjdInt, mjdMod) followed by the data columns as Double?
+// Then whole arcs are written/read as one block without single epochs.
+// Tested by writing and reading a probe epoch, as the format may depend on the file version.
+static Bool isBlockEpoch(Epoch::Type type, UInt version)
+{
+  try
+  {
+    const UInt count = Epoch::dataCount(type);
+    if((type == Epoch::EMPTY) || (count == NULLINDEX))
+      return FALSE;
+
+    const Time time(58000, 0.25);
+    Vector values(count);
+    std::vector<Double> record(2+count);
+    const Int64 mjdInt = time.mjdInt();
+    std::memcpy(&record.at(0), &mjdInt, sizeof(Int64));
+    record.at(1) = time.mjdMod();
+    for(UInt i=0; i<count; i++)
+      record.at(2+i) = values(i) = i+1.;
+
+    auto epoch = std::unique_ptr<Epoch>(Epoch::create(type));
+    epoch->time = time;
+    epoch->setData(values);
+    std::stringstream ss;
+    OutArchiveBinary oa(ss, ""/*type*/, version);
+    const std::string header = ss.str();
+    epoch->save(oa);
+    const std::string bytes = ss.str().substr(header.size());
+    if((bytes.size() != record.size()*sizeof(Double)) || std::memcmp(bytes.data(), record.data(), bytes.size()))
+      return FALSE;
+
+    InArchiveBinary ia(ss);
+    auto epochLoaded = std::unique_ptr<Epoch>(Epoch::create(type));
+    epochLoaded->load(ia);
+    return (epochLoaded->time == time) && (maxabs(epochLoaded->data()-values) == 0);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+ArcColumns InstrumentFile::readArcColumns(UInt arcNo)
+{
+  try
+  {
+    if(fileName.empty())
+      return ArcColumns();
+
+    // matrix files or undefined data columns
+    const UInt count = dataCount();
+    if(file.type().empty() || (file.type() == FILE_MATRIX_TYPE) || (count == NULLINDEX))
+      return ArcColumns(readArc(arcNo));
+
+    if(arcNo>=arcCount_)
+      throw(Exception("index >= arcCount"));
+
+    seekArc(arcNo);
+    ArcColumns arc(type);
+    auto epoch = std::unique_ptr<Epoch>(Epoch::create(type));
+    UInt pointCount;
+    file>>beginGroup("arc");
+    file>>nameValue("pointCount", pointCount);
+    arc.times.resize(pointCount);
+    arc.data = Matrix(pointCount, count);
+    if(pointCount && (file.inArchive().archiveType() == InArchive::BINARY) && isBlockEpoch(type, file.version()))
+    {
+      std::vector<Double> block(pointCount*(2+count));
+      if(file.inArchive().loadBlock(block.data(), block.size()))
+      {
+        for(UInt i=0; i<pointCount; i++)
+        {
+          const Double *record = &block.at(i*(2+count));
+          Int64 mjdInt;
+          std::memcpy(&mjdInt, record, sizeof(Int64));
+          arc.times.at(i) = Time(static_cast<Int>(mjdInt), record[1]);
+          for(UInt k=0; k<count; k++)
+            arc.data(i,k) = record[2+k];
+        }
+        pointCount = 0; // all epochs read
+      }
+    }
+    for(UInt i=0; i<pointCount; i++)
+    {
+      file>>nameValue("epoch", *epoch);
+      arc.times.at(i) = epoch->time;
+      if(count)
+        copy(epoch->data().trans(), arc.data.row(i));
+    }
+    file>>endGroup("arc");
+    index++;
     return arc;
   }
   catch(std::exception &e)
@@ -859,6 +1224,75 @@ Arc InstrumentFile::read(const FileName &name)
 
 /***********************************************/
 
+void InstrumentFile::write(const FileName &name, const std::vector<ArcColumns> &arcList)
+{
+  try
+  {
+    // determine type
+    Epoch::Type type = Epoch::EMPTY;
+    for(const ArcColumns &arc : arcList)
+      if(arc.size())
+      {
+        if((type != Epoch::EMPTY) && (type != arc.getType()))
+          throw(Exception("arcList contain different instruments types"+Epoch::getTypeName(type)+", "+Epoch::getTypeName(arc.getType())));
+        type = arc.getType();
+      }
+
+    OutFileArchive file(name, FILE_INSTRUMENT_TYPE);
+    file.comment(Epoch::getTypeName(type));
+    file<<nameValue("satelliteType", static_cast<Int>(type));
+    file<<nameValue("arcCount",      arcList.size());
+    const std::string comment = Epoch::fileFormatString(type);
+    file.comment(comment);
+    file.comment(std::string(comment.size(), '='));
+    std::unique_ptr<Epoch> epoch;
+    if(type != Epoch::EMPTY)
+      epoch = std::unique_ptr<Epoch>(Epoch::create(type));
+    // fixed size epochs are written as one block per arc in binary files
+    Bool isBlock = (file.outArchive().archiveType() == OutArchive::BINARY) && isBlockEpoch(type, FILE_VERSION);
+    for(const ArcColumns &arc : arcList)
+      isBlock = isBlock && (!arc.size() || (arc.data.columns() == Epoch::dataCount(type)));
+    for(const ArcColumns &arc : arcList)
+    {
+      file<<beginGroup("arc");
+      file<<nameValue("pointCount", arc.size());
+      if(isBlock && arc.size())
+      {
+        const UInt count = arc.data.columns();
+        std::vector<Double> block(arc.size()*(2+count));
+        for(UInt i=0; i<arc.size(); i++)
+        {
+          Double *record = &block.at(i*(2+count));
+          const Int64 mjdInt = arc.times.at(i).mjdInt();
+          std::memcpy(record, &mjdInt, sizeof(Int64));
+          record[1] = arc.times.at(i).mjdMod();
+          for(UInt k=0; k<count; k++)
+            record[2+k] = arc.data(i,k);
+        }
+        file.outArchive().saveBlock(block.data(), block.size());
+        file<<endGroup("arc");
+        continue;
+      }
+      for(UInt i=0; i<arc.size(); i++)
+      {
+        epoch->time = arc.times.at(i);
+        if(arc.data.columns())
+          epoch->setData(arc.data.row(i).trans());
+        file<<beginGroup("epoch");
+        epoch->save(file.outArchive());
+        file<<endGroup("epoch");
+      }
+      file<<endGroup("arc");
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 void InstrumentFile::checkArcCount(const std::vector<std::reference_wrapper<const InstrumentFile>> &fileList)
 {
   UInt arcCountOld = 0;
@@ -251,7 +251,8 @@ public:
   /** @brief Name of data type (e.g. ORBIT, ACCELEROMETER). */
   std::string getTypeName() const {return Epoch::getTypeName(getType());}
 
-  /** @brief Sort epochs in ascending temporal order. */
+  /** @brief Sort epochs in ascending temporal order (stable).
+  * Already sorted parts (e.g. appended files) are merged in O(n log k) for k sorted runs. */
   void sort();
 
   /** @brief Remove consecutive epochs with equal time stamps. */
@@ -266,6 +267,9 @@ public:
   /** @brief Append another arc. */
   void append(const Arc &arc);
 
+  /** @brief Append another arc. The epochs are moved without copying. */
+  void append(Arc &&arc);
+
   /** @brief Synchronize all epochs with a given time list.
   * All epochs are removed which are not in the time list.
   * @param time list of valid points in time (all other epochs will be removed)
@@ -379,6 +383,41 @@ public:
   const EpochType &back() const {return at(size()-1);}
 };
 
+/***** CLASS ***********************************/
+
+/** @brief Arc with satellite instrument data in columnar storage.
+* Instead of a list of single allocated epochs the points in time and the data
+* are stored contiguously as @a times and @a data matrix (one row per epoch, without time column).
+* The @a data can be used directly in matrix computations.
+* Only for instrument types with a defined number of data columns (see Epoch::dataCount()). */
+class ArcColumns
+{
+public:
+  Epoch::Type       type;  //!< Data type (e.g. ORBIT, ACCELEROMETER).
+  std::vector<Time> times; //!< Points in time of epochs.
+  Matrix            data;  //!< Data of epochs (epochs x dataCount), without time.
+
+  ArcColumns(Epoch::Type type_=Epoch::EMPTY) : type(type_) {} //!< Default Constructor
+
+  /** @brief Conversion from Arc. */
+  explicit ArcColumns(const Arc &arc);
+
+  /** @brief Constructor from @a times and @a data (one row per epoch, without time column). */
+  ArcColumns(const std::vector<Time> &times, const_MatrixSliceRef data, Epoch::Type type);
+
+  /** @brief Number of epochs. */
+  UInt size() const {return times.size();}
+
+  /** @brief Data type (e.g. ORBIT, ACCELEROMETER). */
+  Epoch::Type getType() const {return size() ? type : Epoch::EMPTY;}
+
+  /** @brief Conversion to Arc. */
+  Arc arc() const;
+
+  /** @brief Time series of data as matrix (first column is MJD), same as Arc::matrix(). */
+  Matrix matrix() const;
+};
+
 /***** TYPES ***********************************/
 
 class InstrumentFile;
@@ -411,6 +450,9 @@ class InstrumentFile
   UInt          arcCount_;
   UInt          index;
   Matrix        A; // if a matrix file is open
+  std::vector<std::streampos> arcStart; // known file positions of arcs (seekable files only)
+
+  void seekArc(UInt arcNo);
 
 public:
   InstrumentFile() : type(Epoch::EMPTY), arcCount_(0) {}       //!< Default constructor.
@@ -442,9 +484,30 @@ public:
 
   /** @brief Read a single Arc.
   * The operation is faster, if the arcs in read in increasing order.
+  * In uncompressed binary files preceding arcs are skipped without reading the epochs
+  * and already passed arcs are accessed directly.
   * If the file is not open, a empty Arc is returned. */
   Arc readArc(UInt arcNo);
 
+  /** @brief Read a single Arc shared with other readers of the same file.
+  * Several observation classes often read the same arcs (e.g. orbit and star camera of a satellite).
+  * The arc is kept in the process wide FileCache (keyed by file and arc number) and
+  * further calls for the same arc of the unchanged file return a copy without reading the file again.
+  * If the cache is disabled, this is the same as readArc(). */
+  Arc readArcShared(UInt arcNo);
+
+  /** @brief Read a single Arc epoch by epoch.
+  * Each epoch is passed to @a func directly after reading without storing the whole arc.
+  * If @a func returns FALSE, the reading is stopped and the rest of the arc is skipped.
+  * If the file is not open, nothing is done. */
+  void readArc(UInt arcNo, const std::function<Bool(const Epoch &epoch)> &func);
+
+  /** @brief Read a single Arc in columnar storage.
+  * The data are read directly into the matrix without creating single epochs.
+  * The operation is faster, if the arcs in read in increasing order.
+  * If the file is not open, a empty Arc is returned. */
+  ArcColumns readArcColumns(UInt arcNo);
+
   /** @brief Test number of arcs of multiple files.
   * Test whether files are divided into the same number of arcs otherwise an expection is thrown.
   * Files which are not open are ignored. */
@@ -493,6 +556,9 @@ public:
     }
   }
 
+  /** @brief Write a list of arcs in columnar storage to file. */
+  static void write(const FileName &name, const std::vector<ArcColumns> &arcList);
+
   /** @brief Factory for Instrument file. */
   static InstrumentFilePtr newFile(const std::string &name="") {return std::make_shared<InstrumentFile>(name);}
 };
@@ -14,6 +14,7 @@
 
 #include "base/import.h"
 #include "inputOutput/fileArchive.h"
+#include "inputOutput/fileCache.h"
 #include "files/fileFormatRegister.h"
 #include "files/fileInstrument.h"
 #include "files/fileMatrix.h"
@@ -41,13 +42,92 @@ void readFileMatrix(const FileName &fileName, Matrix &x)
 {
   try
   {
+    FileCache::read<Matrix>(fileName, FILE_MATRIX_TYPE, x, [](const FileName &fileName, Matrix &x)
+    {
+      InFileArchive file(fileName, ""/*arbitrary type*/);
+      if(file.type().empty() || (file.type() == FILE_MATRIX_TYPE))
+        file>>nameValue("matrix", x);
+      else if(file.type() == FILE_INSTRUMENT_TYPE)
+        x = InstrumentFile::read(fileName).matrix();
+      else
+        throw(Exception("file type is '"+file.type()+"' but must be '"+FILE_MATRIX_TYPE+"' or '"+FILE_INSTRUMENT_TYPE+"'"));
+    }, Parallel::broadCastShared);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void readFileMatrix(const FileName &fileName, std::function<std::array<UInt,4>(UInt rows, UInt columns)> range, Matrix &x)
+{
+  try
+  {
+    auto readComplete = [&]()
+    {
+      readFileMatrix(fileName, x);
+      if(x.getType() == Matrix::SYMMETRIC)
+        fillSymmetric(x);
+      const std::array<UInt,4> r = range(x.rows(), x.columns());
+      if((r[0] != 0) || (r[1] != 0) || (r[2] != x.rows()) || (r[3] != x.columns()))
+        x = x.slice(r[0], r[1], r[2], r[3]);
+    };
+
     InFileArchive file(fileName, ""/*arbitrary type*/);
-    if(file.type().empty() || (file.type() == FILE_MATRIX_TYPE))
-      file>>nameValue("matrix", x);
-    else if(file.type() == FILE_INSTRUMENT_TYPE)
-      x = InstrumentFile::read(fileName).matrix();
+    if(!file.canSeek() || (!file.type().empty() && (file.type() != FILE_MATRIX_TYPE)))
+    {
+      file.close();
+      readComplete();
+      return;
+    }
+
+    UInt type, rows, columns, uplo = 0;
+    file>>nameValue("type", type);
+    if(static_cast<Matrix::Type>(type) == Matrix::GENERAL)
+      file>>nameValue("rows", rows)>>nameValue("columns", columns);
     else
-      throw(Exception("file type is '"+file.type()+"' but must be '"+FILE_MATRIX_TYPE+"' or '"+FILE_INSTRUMENT_TYPE+"'"));
+    {
+      file>>nameValue("uplo", uplo)>>nameValue("dimension", rows);
+      columns = rows;
+    }
+    const std::array<UInt,4> r = range(rows, columns);
+    if(((r[0] == 0) && (r[1] == 0) && (r[2] == rows) && (r[3] == columns)) || (uplo != 0)) // complete or lower triangle stored
+    {
+      file.close();
+      readComplete();
+      return;
+    }
+    if((r[0]+r[2] > rows) || (r[1]+r[3] > columns))
+      throw(Exception("Dimension error: ("+rows%"%i x "s+columns%"%i).slice("s+r[0]%"%i, "s+r[1]%"%i, "s+r[2]%"%i, "s+r[3]%"%i)"s));
+
+    // seek to the needed elements (stored columnwise, upper triangle packed)
+    const std::streampos start = file.position();
+    auto read = [&](UInt offset, UInt count, MatrixSliceRef A)
+    {
+      file.seek(start + static_cast<std::streamoff>(offset*sizeof(Double)));
+      for(UInt i=0; i<count; i++)
+        file>>nameValue("cell", A(i%A.rows(), i/A.rows()));
+    };
+
+    x = Matrix(r[2], r[3]);
+    for(UInt s=0; s<r[3]; s++)
+    {
+      const UInt col = r[1]+s;
+      if(static_cast<Matrix::Type>(type) == Matrix::GENERAL)
+        read(col*rows+r[0], r[2], x.column(s));
+      else if(r[0] <= col)
+        read(col*(col+1)/2+r[0], std::min(r[2], col+1-r[0]), x.slice(0, s, std::min(r[2], col+1-r[0]), 1));
+    }
+    // lower triangle of symmetric matrix from rows of upper triangle
+    if(static_cast<Matrix::Type>(type) == Matrix::SYMMETRIC)
+      for(UInt z=0; z<r[2]; z++)
+      {
+        const UInt row = r[0]+z;
+        if(r[1] < row)
+          read(row*(row+1)/2+r[1], std::min(r[3], row-r[1]), x.slice(z, 0, 1, std::min(r[3], row-r[1])));
+      }
   }
   catch(std::exception &e)
   {
@@ -57,6 +57,12 @@ void writeFileMatrix(const FileName &fileName, const const_MatrixSlice &x);
 /** @brief Read from a Matrix file. */
 void readFileMatrix(const FileName &fileName, Matrix &x);
 
+/** @brief Read a part of a Matrix file.
+* @a range is called with the dimension of the complete matrix and returns {startRow, startColumn, rows, columns} of the part.
+* From binary files only the needed part is read (matrices larger than memory).
+* Symmetric matrices are returned completely filled. */
+void readFileMatrix(const FileName &fileName, std::function<std::array<UInt,4>(UInt rows, UInt columns)> range, Matrix &x);
+
 /// @}
 
 /***********************************************/
@@ -14,6 +14,7 @@
 #define DOCSTRING_FILEFORMAT_NormalEquation
 
 #include "base/import.h"
+#include <unordered_map>
 #include "inputOutput/fileArchive.h"
 #include "parallel/matrixDistributed.h"
 #include "files/fileFormatRegister.h"
@@ -61,6 +62,13 @@ static void writeInfoFile(const FileName &name, const NormalEquationInfo &info,
 
 /***********************************************/
 
+FileName fileNameNormalEquationBlock(const FileName &name, UInt blockCount, UInt i, UInt k)
+{
+  return name.appendBaseName((blockCount>1) ? "."+i%"%02i-"s+k%"%02i"s : ""s);
+}
+
+/***********************************************/
+
 void writeFileNormalEquation(const FileName &name, NormalEquationInfo info, const Matrix &N, const Matrix &n)
 {
   try
@@ -105,7 +113,7 @@ void writeFileNormalEquation(const FileName &name, NormalEquationInfo info, cons
     for(UInt i=0; i<blockCount; i++)
       for(UInt k=i; k<blockCount; k++)
         if(info.usedBlocks(i,k) > 0)
-          writeFileMatrix(name.appendBaseName((blockCount>1) ? "."+i%"%02i-"s+k%"%02i"s : ""s), N.at(i).at(k));
+          writeFileMatrix(fileNameNormalEquationBlock(name, blockCount, i, k), N.at(i).at(k));
   }
   catch(std::exception &e)
   {
@@ -135,7 +143,7 @@ void writeFileNormalEquation(const FileName &name, NormalEquationInfo info, cons
     for(UInt i=0; i<normal.blockCount(); i++)
       for(UInt k=i; k<normal.blockCount(); k++)
         if(normal.isMyRank(i,k) && !isStrictlyZero(normal.N(i, k)))
-          writeFileMatrix(name.appendBaseName((normal.blockCount()>1) ? "."+i%"%02i-"s+k%"%02i"s : ""s), normal.N(i, k));
+          writeFileMatrix(fileNameNormalEquationBlock(name, normal.blockCount(), i, k), normal.N(i, k));
   }
   catch(std::exception &e)
   {
@@ -236,32 +244,166 @@ static void readInfoFile(const FileName &name, NormalEquationInfo &info, Matrix
 
 /***********************************************/
 
-void readFileNormalEquation(const FileName &name, NormalEquationInfo &info, Matrix &N, Matrix &n)
+void InFileNormalEquation::open(const FileName &name)
 {
   try
   {
-    readInfoFile(name, info, n);
-    const std::vector<UInt> *blockIndex = &info.blockIndex; // just for readability
+    _name = name;
+    readInfoFile(name, _info, _n);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+// the parts of the names are sent as dictionaries and indices,
+// as most objects, types and intervals are repeated many times
+static void broadCastParameterNames(std::vector<ParameterName> &names, Parallel::CommunicatorPtr comm)
+{
+  try
+  {
+    if(Parallel::size(comm) <= 1)
+      return;
+
+    const std::array<std::string ParameterName::*, 4> parts = {&ParameterName::object, &ParameterName::type, &ParameterName::temporal, &ParameterName::interval};
+    std::array<std::vector<std::string>, 4> dictionary;
+    std::vector<UInt> index;
+    if(Parallel::isMaster(comm))
+    {
+      std::array<std::unordered_map<std::string, UInt>, 4> dictionaryIndex;
+      index.reserve(parts.size()*names.size());
+      for(const auto &name : names)
+        for(UInt k=0; k<parts.size(); k++)
+        {
+          auto iter = dictionaryIndex[k].emplace(name.*parts[k], dictionary[k].size());
+          if(iter.second)
+            dictionary[k].push_back(name.*parts[k]);
+          index.push_back(iter.first->second);
+        }
+    }
+
+    for(auto &dict : dictionary)
+      Parallel::broadCast(dict, 0, comm);
+    Parallel::broadCast(index, 0, comm);
+
+    if(!Parallel::isMaster(comm))
+    {
+      names.resize(index.size()/parts.size());
+      for(UInt i=0; i<names.size(); i++)
+        for(UInt k=0; k<parts.size(); k++)
+          names[i].*parts[k] = dictionary[k].at(index.at(parts.size()*i+k));
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void InFileNormalEquation::open(const FileName &name, Parallel::CommunicatorPtr comm)
+{
+  try
+  {
+    _name = name;
+    if(Parallel::isMaster(comm))
+      readInfoFile(name, _info, _n);
+    broadCastParameterNames(_info.parameterName, comm);
+    Parallel::broadCast(_info.lPl,              0, comm);
+    Parallel::broadCast(_info.observationCount, 0, comm);
+    Parallel::broadCast(_info.blockIndex,       0, comm);
+    Parallel::broadCast(_info.usedBlocks,       0, comm);
+    Parallel::broadCast(_n,                     0, comm);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
 
-    // read normal equation
-    if(blockIndex->size() == 2)
+/***********************************************/
+
+FileName InFileNormalEquation::blockFileName(UInt i, UInt k) const
+{
+  return fileNameNormalEquationBlock(_name, blockCount(), i, k);
+}
+
+/***********************************************/
+
+void InFileNormalEquation::readBlock(UInt i, UInt k, Matrix &N) const
+{
+  try
+  {
+    if((i > k) || (k >= blockCount()))
+      throw(Exception("block ("+i%"%i, "s+k%"%i) out of range"s));
+
+    if(!isBlockUsed(i, k))
     {
-      readFileMatrix(name, N);
-      if(N.rows() != blockIndex->back())
-        throw(Exception("<"+name.str()+"> dimension error"));
+      N = (i == k) ? Matrix(blockSize(i), Matrix::SYMMETRIC) : Matrix(blockSize(i), blockSize(k));
+      return;
     }
-    else
+
+    readFileMatrix(blockFileName(i, k), N);
+    if((N.rows() != blockSize(i)) || (N.columns() != blockSize(k)))
+      throw(Exception("<"+blockFileName(i, k).str()+"> dimension error"));
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void InFileNormalEquation::readParameterRange(UInt start, UInt count, Matrix &N) const
+{
+  try
+  {
+    if(start+count > parameterCount())
+      throw(Exception("parameter range exceeds normal matrix dimension"));
+
+    // complete matrix in one block: avoid copy
+    if((blockCount() == 1) && (start == 0) && (count == parameterCount()))
     {
-      N = Matrix(blockIndex->back(), Matrix::SYMMETRIC);
-      for(UInt i=0; i<blockIndex->size()-1; i++)
-        for(UInt k=i; k<blockIndex->size()-1; k++)
-          if(!info.usedBlocks.size() || (info.usedBlocks.size() && info.usedBlocks(i,k) > 0))
-          {
-            Matrix M;
-            readFileMatrix(name.appendBaseName("."+i%"%02i-"s+k%"%02i"s), M);
-            copy(M, N.slice(blockIndex->at(i), blockIndex->at(k), blockIndex->at(i+1)-blockIndex->at(i), blockIndex->at(k+1)-blockIndex->at(k)));
-          }
+      readBlock(0, 0, N);
+      return;
     }
+
+    N = Matrix(count, Matrix::SYMMETRIC);
+    for(UInt i=0; i<blockCount(); i++)
+      for(UInt k=i; k<blockCount(); k++)
+      {
+        // intersection of block with range
+        const UInt row0 = std::max(start, blockIndex(i)), row1 = std::min(start+count, blockIndex(i+1));
+        const UInt col0 = std::max(start, blockIndex(k)), col1 = std::min(start+count, blockIndex(k+1));
+        if((row0 >= row1) || (col0 >= col1) || !isBlockUsed(i, k))
+          continue;
+        Matrix M;
+        readBlock(i, k, M);
+        copy(M.slice(row0-blockIndex(i), col0-blockIndex(k), row1-row0, col1-col0), N.slice(row0-start, col0-start, row1-row0, col1-col0));
+      }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+/***********************************************/
+
+void readFileNormalEquation(const FileName &name, NormalEquationInfo &info, Matrix &N, Matrix &n)
+{
+  try
+  {
+    InFileNormalEquation file(name);
+    file.readParameterRange(0, file.parameterCount(), N);
+    info = file.info();
+    n    = file.rightHandSide();
   }
   catch(std::exception &e)
   {
@@ -275,20 +417,22 @@ void readFileNormalEquation(const FileName &name, NormalEquationInfo &info, Matr
 {
   try
   {
-    readInfoFile(name, info, n);
+    InFileNormalEquation file;
+    file.open(name, comm);
 
-    // read normal equation
-    normal.initEmpty(info.blockIndex, comm);
+    // each process reads its own blocks
+    normal.initEmpty(file.info().blockIndex, comm);
     for(UInt i=0; i<normal.blockCount(); i++)
       for(UInt k=i; k<normal.blockCount(); k++)
-      {
-        if((!info.usedBlocks.size() || (info.usedBlocks.size() && info.usedBlocks(i,k) > 0)))
+        if(file.isBlockUsed(i, k))
         {
           normal.setBlock(i, k);
           if(normal.isMyRank(i,k))
-            readFileMatrix(name.appendBaseName((normal.blockCount()>1) ? "."+i%"%02i-"s+k%"%02i"s : ""s), normal.N(i,k));
+            file.readBlock(i, k, normal.N(i,k));
         }
-      }
+
+    info = file.info();
+    n    = file.rightHandSide();
   }
   catch(std::exception &e)
   {
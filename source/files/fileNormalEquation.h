@@ -67,8 +67,55 @@ public:
     : parameterName(parameterName_), lPl(lPl_), observationCount(observationCount_) {}
 };
 
+/***********************************************/
+
+/** @brief Lazy access to a system of normal equations.
+* At open only the information file, the parameter names and the right hand sides are read.
+* The blocks of the normal matrix are read on demand, so programs which need
+* only some blocks or a subset of parameters do not load the complete matrix. */
+class InFileNormalEquation
+{
+  FileName           _name;
+  NormalEquationInfo _info;
+  Matrix             _n;
+
+public:
+  InFileNormalEquation() {}
+  explicit InFileNormalEquation(const FileName &name) {open(name);}
+
+  /** @brief Read information file, parameter names and right hand sides. */
+  void open(const FileName &name);
+
+  /** @brief Collective open: must be called on every process in @p comm.
+  * The information file, parameter names and right hand sides are read at master only and distributed,
+  * afterwards every process can read its own blocks independently. */
+  void open(const FileName &name, Parallel::CommunicatorPtr comm);
+
+  const NormalEquationInfo &info()          const {return _info;}                 //!< info incl. parameter names and block structure.
+  const Matrix             &rightHandSide() const {return _n;}                    //!< right hand sides.
+  UInt parameterCount()         const {return _info.blockIndex.back();}            //!< dimension of normal matrix.
+  UInt blockCount()             const {return _info.blockIndex.size()-1;}          //!< number of blocks in row/column.
+  UInt blockIndex(UInt i)       const {return _info.blockIndex.at(i);}             //!< start parameter of block.
+  UInt blockSize(UInt i)        const {return _info.blockIndex.at(i+1)-_info.blockIndex.at(i);}
+  Bool isBlockUsed(UInt i, UInt k) const {return !_info.usedBlocks.size() || (_info.usedBlocks(i,k) > 0);} //!< file with block (i<=k) exists.
+
+  /** @brief File name of block (i,k) with i<=k. */
+  FileName blockFileName(UInt i, UInt k) const;
+
+  /** @brief Read block (i,k) with i<=k of the normal matrix.
+  * Unused blocks are returned as zero matrices (SYMMETRIC for diagonal blocks). */
+  void readBlock(UInt i, UInt k, Matrix &N) const;
+
+  /** @brief Read the symmetric (upper) submatrix of the parameters [@a start, @a start+@a count).
+  * Only the overlapping blocks are read. */
+  void readParameterRange(UInt start, UInt count, Matrix &N) const;
+};
+
 /***** FUNCTIONS ********************************/
 
+/** @brief File name of block (i,k) of a normal matrix splitted into @a blockCount x @a blockCount blocks. */
+FileName fileNameNormalEquationBlock(const FileName &name, UInt blockCount, UInt i, UInt k);
+
 /** @brief Write a system of normal equations. */
 void writeFileNormalEquation(const FileName &name, NormalEquationInfo info, const Matrix &N, const Matrix &n);
 
@@ -90,8 +137,9 @@ void writeFileNormalEquation(const FileName &name, NormalEquationInfo info, cons
 /** @brief Read a system of normal equations. */
 void readFileNormalEquation(const FileName &name, NormalEquationInfo &info, Matrix &N, Matrix &n);
 
-/** @brief Write a system of normal equations.
-* Must be called on every process in @p comm. */
+/** @brief Read a system of normal equations.
+* Must be called on every process in @p comm.
+* Each process reads only the blocks it owns. */
 void readFileNormalEquation(const FileName &name, NormalEquationInfo &info, MatrixDistributed &normal, Matrix &n, Parallel::CommunicatorPtr comm);
 
 /** @brief Read a system of normal equations.
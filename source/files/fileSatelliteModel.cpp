@@ -444,6 +444,79 @@ Vector3d SatelliteModel::accelerationPressure(const Vector3d &direction, Double
 
 /***********************************************/
 
+Vector3d SatelliteModel::accelerationPressure(const std::vector<Double> &dx, const std::vector<Double> &dy, const std::vector<Double> &dz,
+                                              const std::vector<Double> &visible, const std::vector<Double> &infrared) const
+{
+  try
+  {
+    if(mass == 0.)
+      throw(Exception("No SatelliteModel given: "+satelliteName));
+    const UInt count = dx.size();
+    if((dy.size() != count) || (dz.size() != count) || (visible.size() != count) || (infrared.size() != count))
+      throw(Exception("size mismatch"));
+
+    Vector3d a;
+    for(const Surface &surface : surfaces)
+    {
+      // see Surface::accelerationPressure: acc = cosPhi*(A*visible+B*infrared)*direction - (cosPhi*(C*visible+D*infrared) + cosPhi^2*(E*visible+F*infrared))*normal
+      Double factorDiffusion, factorReflexion, factorReemission;
+      if(surface.type == Surface::PLATE)
+      {
+        factorDiffusion  = 2./3.;
+        factorReflexion  = 2.;
+        factorReemission = surface.hasThermalReemission ? 2./3. : 0.;
+      }
+      else if(surface.type == Surface::CYLINDER)
+      {
+        factorDiffusion  = PI/6.;
+        factorReflexion  = 4./3.;
+        factorReemission = surface.hasThermalReemission ? PI/6. : 0.;
+      }
+      else
+      {
+        // not implemented: only an error if the surface is illuminated
+        for(UInt i=0; i<count; i++)
+          surface.accelerationPressure(Vector3d(dx[i], dy[i], dz[i]), visible[i], infrared[i], a);
+        continue;
+      }
+
+      const Double A  = surface.area*(surface.absorptionVisible +surface.diffusionVisible);
+      const Double B  = surface.area*(surface.absorptionInfrared+surface.diffusionInfrared);
+      const Double C  = surface.area*(factorDiffusion*surface.diffusionVisible  + factorReemission*surface.absorptionVisible);
+      const Double D  = surface.area*(factorDiffusion*surface.diffusionInfrared + factorReemission*surface.absorptionInfrared);
+      const Double E  = surface.area*factorReflexion*surface.reflexionVisible;
+      const Double F  = surface.area*factorReflexion*surface.reflexionInfrared;
+      const Double nx = surface.normal.x();
+      const Double ny = surface.normal.y();
+      const Double nz = surface.normal.z();
+
+      Double sumX = 0, sumY = 0, sumZ = 0, sumNormal = 0;
+      for(UInt i=0; i<count; i++)
+      {
+        const Double cosPhi = std::max(0., -(dx[i]*nx + dy[i]*ny + dz[i]*nz));
+        const Double factorDirection = cosPhi*(A*visible[i] + B*infrared[i]);
+        sumX      += factorDirection*dx[i];
+        sumY      += factorDirection*dy[i];
+        sumZ      += factorDirection*dz[i];
+        sumNormal += cosPhi*(C*visible[i] + D*infrared[i]) + cosPhi*cosPhi*(E*visible[i] + F*infrared[i]);
+      }
+      a += Vector3d(sumX, sumY, sumZ) - sumNormal * surface.normal;
+    }
+
+    for(auto module : modules)
+      for(UInt i=0; i<count; i++)
+        module->accelerationPressure(*this, Vector3d(dx[i], dy[i], dz[i]), visible[i], infrared[i], a);
+
+    return (1./mass) * a;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 Vector3d SatelliteModel::accelerationThrust() const
 {
   try
@@ -168,6 +168,16 @@ public:
   * @return acceleration [m/s^2] in satellite frame (SRF) */
   Vector3d accelerationPressure(const Vector3d &direction, Double visible, Double infrared) const;
 
+  /** @brief Summed acceleration of many incident radiations (e.g. albedo of grid cells).
+  * Same as the sum of accelerationPressure() for each direction, but each surface is evaluated
+  * for all directions at once (directions given as separate coordinate arrays).
+  * @param dx, dy, dz unit vectors of incoming radiation (in satellite frame, SRF)
+  * @param visible magnitudes of incident visible radiation [N/m^2]
+  * @param infrared magnitudes of incident infrared radiation [N/m^2]
+  * @return acceleration [m/s^2] in satellite frame (SRF) */
+  Vector3d accelerationPressure(const std::vector<Double> &dx, const std::vector<Double> &dy, const std::vector<Double> &dz,
+                                const std::vector<Double> &visible, const std::vector<Double> &infrared) const;
+
   /** @brief Acceleration of satellite due to thrust. */
   Vector3d accelerationThrust() const;
 };
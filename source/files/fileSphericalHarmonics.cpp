@@ -15,6 +15,7 @@
 #include "base/import.h"
 #include "base/sphericalHarmonics.h"
 #include "inputOutput/fileArchive.h"
+#include "inputOutput/fileCache.h"
 #include "files/fileFormatRegister.h"
 #include "files/fileSphericalHarmonics.h"
 
@@ -41,8 +42,24 @@ void readFileSphericalHarmonics(const FileName &fileName, SphericalHarmonics &x)
 {
   try
   {
-    InFileArchive file(fileName, FILE_POTENTIALCOEFFICIENTS_TYPE);
-    file>>nameValue("potentialCoefficients", x);
+    FileCache::read<SphericalHarmonics>(fileName, FILE_POTENTIALCOEFFICIENTS_TYPE, x, [](const FileName &fileName, SphericalHarmonics &x)
+    {
+      InFileArchive file(fileName, FILE_POTENTIALCOEFFICIENTS_TYPE);
+      file>>nameValue("potentialCoefficients", x);
+    },
+    [](SphericalHarmonics &x, UInt process, Parallel::CommunicatorPtr comm)
+    {
+      Double GM = x.GM(), R = x.R();
+      Bool   interior = x.isInterior();
+      Parallel::broadCast(GM,       process, comm);
+      Parallel::broadCast(R,        process, comm);
+      Parallel::broadCast(interior, process, comm);
+      Parallel::broadCastShared(x.cnm(),       process, comm);
+      Parallel::broadCastShared(x.snm(),       process, comm);
+      Parallel::broadCastShared(x.sigma2cnm(), process, comm);
+      Parallel::broadCastShared(x.sigma2snm(), process, comm);
+      x = SphericalHarmonics(GM, R, x.cnm(), x.snm(), x.sigma2cnm(), x.sigma2snm(), interior);
+    });
   }
   catch(std::exception &e)
   {
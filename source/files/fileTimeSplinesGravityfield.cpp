@@ -62,8 +62,77 @@ void InFileTimeSplinesGravityfield::open(const FileName &name, UInt maxDegree, U
           dataEpochSize = file.position() - dataStart;
       }
 
-      index = 0;
+      index    = 0;
+      nextNode = harmonics.size();
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+SphericalHarmonics InFileTimeSplinesGravityfield::readNode(UInt node)
+{
+  try
+  {
+    // binary files: direct access, otherwise skip nodes
+    if((node != nextNode) && file.canSeek())
+      file.seek(dataStart + static_cast<std::streamoff>(node * dataEpochSize));
+    else
+      for(; nextNode<node; nextNode++)
+      {
+        Matrix cnm, snm;
+        file>>beginGroup("node");
+        file>>nameValue("cnm", cnm);
+        file>>nameValue("snm", snm);
+        file>>endGroup("node");
+      }
+
+    Matrix cnm, snm;
+    file>>beginGroup("node");
+    file>>nameValue("cnm", cnm);
+    file>>nameValue("snm", snm);
+    file>>endGroup("node");
+    nextNode = node+1;
+    return SphericalHarmonics(GM, R, cnm, snm).get(_maxDegree, _minDegree);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void InFileTimeSplinesGravityfield::moveWindow(UInt idx)
+{
+  try
+  {
+    // sequential file behind the needed nodes? -> start from the beginning
+    if(!file.canSeek() && (idx < index))
+      open(FileName(file.fileName()), _maxDegree, _minDegree);
+
+    // nodes already in memory are kept, only the missing nodes are read
+    const UInt count = harmonics.size();
+    if((idx > index) && (idx < index+count))
+    {
+      std::move(harmonics.begin()+(idx-index), harmonics.end(), harmonics.begin());
+      for(UInt i=index+count-idx; i<count; i++)
+        harmonics.at(i) = readNode(idx+i);
+    }
+    else if((idx < index) && (idx+count > index))
+    {
+      std::move_backward(harmonics.begin(), harmonics.end()-(index-idx), harmonics.end());
+      for(UInt i=0; i<index-idx; i++)
+        harmonics.at(i) = readNode(idx+i);
     }
+    else if(idx != index)
+      for(UInt i=0; i<count; i++)
+        harmonics.at(i) = readNode(idx+i);
+    index = idx;
   }
   catch(std::exception &e)
   {
@@ -93,33 +162,10 @@ SphericalHarmonics InFileTimeSplinesGravityfield::sphericalHarmonics(const Time
       return SphericalHarmonics();
     }
 
-    // Schon ueberlesen? -> dann von vorne anfangen
-    if(time<times.at(index))
-      open(FileName(file.fileName()), this->_maxDegree, this->_minDegree);
-
-    // Seek to appropriate interval. The current position in the file is degree+1 intervals ahead of index
-    if(file.canSeek() && (time>times.at(index+1))) // If the time is larger than the last index that has already been read in
-    {
-      UInt seekIndex = index;
-      while(time>=times.at(seekIndex+1))
-        seekIndex++;
-      index = seekIndex - (degree+1);
-      file.seek(dataStart + static_cast<std::streamoff>(seekIndex * dataEpochSize));
-    }
-
-    // Interpolationsintervall suchen
-    while(time>=times.at(index+1))
-    {
-      for(UInt i=0; i+1<harmonics.size(); i++)
-        harmonics.at(i) = harmonics.at(i+1);
-      Matrix cnm, snm;
-      file>>beginGroup("node");
-      file>>nameValue("cnm", cnm);
-      file>>nameValue("snm", snm);
-      file>>endGroup("node");
-      harmonics.at(degree) = SphericalHarmonics(GM, R, cnm, snm).get(_maxDegree, _minDegree);
-      index++;
-    }
+    // interval with times(idx) <= time < times(idx+1)
+    const UInt idx = static_cast<UInt>(std::distance(times.begin(), std::upper_bound(times.begin(), times.end(), time))) - 1;
+    if(idx != index)
+      moveWindow(idx);
 
     const Double       t     = (time-times.at(index)).mjd()/(times.at(index+1)-times.at(index)).mjd();
     const Vector       coeff = BasisSplines::compute(t, degree);
@@ -136,6 +182,40 @@ SphericalHarmonics InFileTimeSplinesGravityfield::sphericalHarmonics(const Time
 
 /***********************************************/
 
+UInt InFileTimeSplinesGravityfield::nodeWeights(const Time &time, Vector &weights) const
+{
+  try
+  {
+    if(file.fileName().empty() || (time<times.at(0)) || (time>=times.at(times.size()-1)))
+      return NULLINDEX;
+    const UInt idx = static_cast<UInt>(std::distance(times.begin(), std::upper_bound(times.begin(), times.end(), time))) - 1;
+    weights = BasisSplines::compute((time-times.at(idx)).mjd()/(times.at(idx+1)-times.at(idx)).mjd(), degree);
+    return idx;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+const SphericalHarmonics &InFileTimeSplinesGravityfield::node(UInt node)
+{
+  try
+  {
+    if((node < index) || (node >= index+harmonics.size()))
+      moveWindow(std::min(node, times.size()-2));
+    return harmonics.at(node-index);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 void writeFileTimeSplinesGravityfield(const FileName &fileName,
                                       Double GM, Double R, UInt splineDegree,
                                       const std::vector<Time> &times,
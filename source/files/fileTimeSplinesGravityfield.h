@@ -58,10 +58,14 @@ class InFileTimeSplinesGravityfield
   UInt               degree;
   UInt               _maxDegree, _minDegree;
   std::vector<Time>  times;
-  std::vector<SphericalHarmonics> harmonics;
+  std::vector<SphericalHarmonics> harmonics; // nodes index ... index+degree
+  UInt               nextNode;                // position in file
   std::streampos     dataStart;
   std::streamoff     dataEpochSize;
 
+  SphericalHarmonics readNode(UInt node);
+  void               moveWindow(UInt idx);
+
 public:
   InFileTimeSplinesGravityfield() {}
   InFileTimeSplinesGravityfield(const FileName &name, UInt maxDegree=INFINITYDEGREE, UInt minDegree=0) {open(name, maxDegree, minDegree);}
@@ -72,6 +76,15 @@ public:
 
   SphericalHarmonics sphericalHarmonics(const Time &time, Double factor=1.0);
 
+  /** @brief Spline weights at @p time.
+  * sphericalHarmonics(time) = sum_k weights(k) * node(first+k).
+  * @return index first of the nodes, NULLINDEX if @p time is not covered by the file. */
+  UInt nodeWeights(const Time &time, Vector &weights) const;
+
+  /** @brief Spherical harmonics of a spline node (the node window is moved if needed). */
+  const SphericalHarmonics &node(UInt node);
+
+
   UInt maxDegree() const {return _maxDegree;}
   UInt minDegree() const {return _minDegree;}
 };
@@ -45,6 +45,37 @@ OrbitArc VariationalEquationArc::orbitArc() const
 
 /***********************************************/
 
+void VariationalEquationArc::roundStates(Double relativeAccuracy)
+{
+  try
+  {
+    if(relativeAccuracy <= 0)
+      return;
+    // keep only the significant bits of the mantissa
+    const Int bits = static_cast<Int>(std::ceil(-std::log2(relativeAccuracy)));
+    if(bits >= 52)
+      return;
+    auto roundMatrix = [&](Matrix &A)
+    {
+      for(UInt s=0; s<A.columns(); s++)
+        for(UInt z=0; z<A.rows(); z++)
+        {
+          int exponent;
+          const Double mantissa = std::frexp(A(z,s), &exponent);
+          A(z,s) = std::ldexp(std::round(std::ldexp(mantissa, bits)), exponent-bits);
+        }
+    };
+    roundMatrix(PosState);
+    roundMatrix(VelState);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 void FileVariationalEquation::open(const FileName &fileName)
 {
   try
@@ -72,6 +103,9 @@ void FileVariationalEquation::open(const FileName &fileName)
 
 void FileVariationalEquation::close()
 {
+  if(_next.valid())
+    _next.wait();
+  _next = std::future<VariationalEquationArc>();
   if(!_fileName.empty())
     _file.close();
   _fileName = FileName();
@@ -90,16 +124,32 @@ VariationalEquationArc FileVariationalEquation::readArc(UInt arcNo)
     if(arcNo>=_arcCount)
       throw(Exception("arcNo >= arcCount"));
 
+    // arc read ahead in the meantime (arc _index-1)
+    VariationalEquationArc arc;
+    const Bool readAhead = _next.valid();
+    if(readAhead)
+      arc = _next.get();
+
     // arc already read -> restart
-    if(arcNo<_index)
+    if((arcNo<_index) && !(readAhead && (arcNo+1 == _index)))
       open(FileName(_fileName));
 
-    VariationalEquationArc arc;
     while(_index <= arcNo)
     {
       _file>>nameValue("arc", arc);
       _index++;
     }
+
+    // read next arc in a separate thread
+    if(_index < _arcCount)
+      _next = std::async(std::launch::async, [this]()
+      {
+        VariationalEquationArc arc;
+        _file>>nameValue("arc", arc);
+        _index++;
+        return arc;
+      });
+
     return arc;
   }
   catch(std::exception &e)
@@ -111,14 +161,14 @@ VariationalEquationArc FileVariationalEquation::readArc(UInt arcNo)
 /***********************************************/
 /***********************************************/
 
-void writeFileVariationalEquation(const FileName &fileName, SatelliteModelPtr satellite, VariationalEquationArc arc)
+void writeFileVariationalEquation(const FileName &fileName, SatelliteModelPtr satellite, VariationalEquationArc arc, Double relativeAccuracy)
 {
-  writeFileVariationalEquation(fileName, satellite, std::vector<VariationalEquationArc>(1, arc));
+  writeFileVariationalEquation(fileName, satellite, std::vector<VariationalEquationArc>(1, arc), relativeAccuracy);
 }
 
 /***********************************************/
 
-void writeFileVariationalEquation(const FileName &fileName, SatelliteModelPtr satellite, std::vector<VariationalEquationArc> arcList)
+void writeFileVariationalEquation(const FileName &fileName, SatelliteModelPtr satellite, std::vector<VariationalEquationArc> arcList, Double relativeAccuracy)
 {
   try
   {
@@ -126,7 +176,10 @@ void writeFileVariationalEquation(const FileName &fileName, SatelliteModelPtr sa
     file<<nameValue("satellite", satellite);
     file<<nameValue("arcCount", arcList.size());
     for(auto iter=arcList.begin(); iter!=arcList.end(); iter++)
+    {
+      iter->roundStates(relativeAccuracy);
       file<<nameValue("arc", *iter);
+    }
   }
   catch(std::exception &e)
   {
@@ -23,6 +23,10 @@ the derivatives of the orbit with respect to the satellite state vector for each
 transformations (rotations) between the satellite, celestial, and terrestrial frame
 and a satellite macro model (see \file{SatelliteModel}{satelliteModel}).
 
+The state transition matrices can be stored with a reduced relative accuracy (e.g. float precision).
+The rounded values have many zero bits and the files become much smaller
+if written compressed (extension \file{*.gz}{fileFormatGeneral}).
+
 The reference orbit can be extracted with \program{Variational2Orbit}.
 
 See also: \program{PreprocessingVariationalEquation}.
@@ -36,6 +40,7 @@ See also: \program{PreprocessingVariationalEquation}.
 #include "inputOutput/fileArchive.h"
 #include "files/fileInstrument.h"
 #include "files/fileSatelliteModel.h"
+#include <future>
 
 /** @addtogroup filesGroup */
 /// @{
@@ -58,6 +63,10 @@ class VariationalEquationArc
 
   OrbitArc orbitArc() const;
 
+  /** @brief Round the state transition matrices to @a relativeAccuracy.
+  * The rounded values have many zero bits and can be compressed efficiently. */
+  void roundStates(Double relativeAccuracy);
+
   void save(OutArchive &oa) const;
   void load(InArchive  &ia);
 };
@@ -72,10 +81,11 @@ class FileVariationalEquation
   SatelliteModelPtr _satellite;
   UInt              _arcCount;
   UInt              _index;
+  std::future<VariationalEquationArc> _next; // next arc read ahead in a separate thread
 
 public:
   /// Default Constructor.
-  FileVariationalEquation() : _arcCount(0) {}
+  FileVariationalEquation() : _arcCount(0), _index(0) {}
 
   /// Constructor.
   FileVariationalEquation(const FileName &fileName) {open(fileName);}
@@ -97,17 +107,20 @@ public:
   SatelliteModelPtr satellite() const {return _satellite;}
 
   /** @brief Read a single Arc.
-  * The operation is faster, if the arcs is read in increasing order. */
+  * The operation is faster, if the arcs is read in increasing order.
+  * The following arc is read in a separate thread in the meantime. */
   VariationalEquationArc readArc(UInt arcNo);
 };
 
 /***** FUNCTIONS *******************************/
 
-/** @brief Write a variational equation file. */
-void writeFileVariationalEquation(const FileName &fileName, SatelliteModelPtr satellite, VariationalEquationArc arc);
+/** @brief Write a variational equation file.
+* If @a relativeAccuracy is given, the state transition matrices are rounded (see VariationalEquationArc::roundStates()). */
+void writeFileVariationalEquation(const FileName &fileName, SatelliteModelPtr satellite, VariationalEquationArc arc, Double relativeAccuracy=0);
 
-/** @brief Write a variational equation file. */
-void writeFileVariationalEquation(const FileName &fileName, SatelliteModelPtr satellite, std::vector<VariationalEquationArc> arcs);
+/** @brief Write a variational equation file.
+* If @a relativeAccuracy is given, the state transition matrices are rounded (see VariationalEquationArc::roundStates()). */
+void writeFileVariationalEquation(const FileName &fileName, SatelliteModelPtr satellite, std::vector<VariationalEquationArc> arcs, Double relativeAccuracy=0);
 
 /***********************************************/
 
@@ -32,7 +32,8 @@ void Gnss::init(const std::vector<Time> &times, const Time &timeMargin,
 {
   try
   {
-    this->times = times;
+    this->times    = times;
+    this->timeGrid = TimeGrid::fromTimes(times);
 
     // init earth rotation
     // -------------------
@@ -79,8 +80,20 @@ Rotary3d Gnss::rotationCrf2Trf(const Time &time) const
 {
   try
   {
-    const UInt idx = std::min((times.size()-1), static_cast<UInt>(std::distance(times.begin(),
-                     std::upper_bound(times.begin(), times.end(), time, [](const Time &t, const Time &s) {return (t-s).seconds() < 0.5;}))));
+    // first epoch greater than time-0.5 seconds
+    auto isAfter = [&](const Time &s) {return (time-s).seconds() < 0.5;};
+    UInt idx;
+    if(timeGrid.count())
+    {
+      idx = timeGrid.upperBound(time-seconds2time(0.5));
+      while((idx < times.size()) && !isAfter(times.at(idx)))
+        idx++;
+      while((idx > 0) && isAfter(times.at(idx-1)))
+        idx--;
+    }
+    else
+      idx = static_cast<UInt>(std::distance(times.begin(), std::upper_bound(times.begin(), times.end(), time, [](const Time &t, const Time &s) {return (t-s).seconds() < 0.5;})));
+    idx = std::min(times.size()-1, idx);
     const Double xp      = eop(idx, 0);
     const Double yp      = eop(idx, 1);
     const Double sp      = eop(idx, 2);
@@ -338,6 +351,7 @@ Bool Gnss::basicObservationEquations(const GnssNormalEquationInfo &/*normalEquat
 {
   try
   {
+    GROOPS_PROFILE("Gnss::observationEquations")
     std::vector<GnssType> type;
     if(!receivers.at(idRecv)->observation(idTrans, idEpoch) ||
        !receivers.at(idRecv)->observation(idTrans, idEpoch)->observationList(GnssObservation::RANGE | GnssObservation::PHASE, type))
@@ -358,6 +372,7 @@ void Gnss::designMatrix(const GnssNormalEquationInfo &normalEquationInfo, const
 {
   try
   {
+    GROOPS_PROFILE("Gnss::designMatrix")
     if(eqn.l.rows())
       parametrization->designMatrix(normalEquationInfo, eqn, A);
   }
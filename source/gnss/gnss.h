@@ -47,6 +47,7 @@ class Gnss
 {
 public:
   std::vector<Time>               times;           // Epochs
+  TimeGrid                        timeGrid;        // times if equally spaced
   std::vector<GnssTransmitterPtr> transmitters;    // GNSS satellites
   std::vector<GnssReceiverPtr>    receivers;       // stations & LEOs
   GnssParametrizationPtr          parametrization; // parameters
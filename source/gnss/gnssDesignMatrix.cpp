@@ -22,6 +22,8 @@ GnssDesignMatrix::GnssDesignMatrix(const GnssNormalEquationInfo &normalEquationI
       blockIndices(normalEquationInfo.blockIndices()),
       indexUsedParameter(normalEquationInfo.blockCount()),
       countUsedParameter(normalEquationInfo.blockCount()),
+      rowStartUsedParameter(normalEquationInfo.blockCount()),
+      rowEndUsedParameter(normalEquationInfo.blockCount()),
       row(0),
       rows(l_.rows()),
       A(l_.rows(), normalEquationInfo.parameterCount()),
@@ -35,7 +37,10 @@ void GnssDesignMatrix::init(const_MatrixSliceRef l)
 {
   try
   {
-    this->l = l;
+    if((this->l.rows() == l.rows()) && (this->l.columns() == l.columns()))
+      copy(l, this->l); // reuse memory
+    else
+      this->l = l;
     if(A.rows() < l.rows())
       A = Matrix(l.rows(), blockIndices.back());
     row  = 0;
@@ -44,9 +49,12 @@ void GnssDesignMatrix::init(const_MatrixSliceRef l)
     for(UInt i : indexUsedBlock)
     {
       for(UInt k=0; k<indexUsedParameter[i].size(); k++)
-        A.column(blockIndices[i]+indexUsedParameter[i][k], countUsedParameter[i][k]).setNull();
+        A.slice(rowStartUsedParameter[i][k], blockIndices[i]+indexUsedParameter[i][k],
+                rowEndUsedParameter[i][k]-rowStartUsedParameter[i][k], countUsedParameter[i][k]).setNull();
       indexUsedParameter[i].clear();
       countUsedParameter[i].clear();
+      rowStartUsedParameter[i].clear();
+      rowEndUsedParameter[i].clear();
     }
 
     indexUsedBlock.clear();
@@ -97,18 +105,26 @@ MatrixSlice GnssDesignMatrix::column(const GnssParameterIndex &index)
     {
       indexUsedParameter[block].insert(indexUsedParameter[block].begin()+idx, col);
       countUsedParameter[block].insert(countUsedParameter[block].begin()+idx, cols);
+      rowStartUsedParameter[block].insert(rowStartUsedParameter[block].begin()+idx, row);
+      rowEndUsedParameter[block].insert(rowEndUsedParameter[block].begin()+idx, row+rows);
     }
     else // merge
     {
       const UInt end = std::max(col+cols, indexUsedParameter[block][idx]+countUsedParameter[block][idx]);
       indexUsedParameter[block][idx] = std::min(col, indexUsedParameter[block][idx]);
       countUsedParameter[block][idx] = end - indexUsedParameter[block][idx];
+      rowStartUsedParameter[block][idx] = std::min(row,      rowStartUsedParameter[block][idx]);
+      rowEndUsedParameter[block][idx]   = std::max(row+rows, rowEndUsedParameter[block][idx]);
       // merge with following parameter group?
       while((idx+1 < indexUsedParameter[block].size()) && (indexUsedParameter[block][idx]+countUsedParameter[block][idx]+gap >= indexUsedParameter[block][idx+1]))
       {
         countUsedParameter[block][idx] = std::max(countUsedParameter[block][idx], indexUsedParameter[block][idx+1]+countUsedParameter[block][idx+1]-indexUsedParameter[block][idx]);
+        rowStartUsedParameter[block][idx] = std::min(rowStartUsedParameter[block][idx], rowStartUsedParameter[block][idx+1]);
+        rowEndUsedParameter[block][idx]   = std::max(rowEndUsedParameter[block][idx],   rowEndUsedParameter[block][idx+1]);
         indexUsedParameter[block].erase(indexUsedParameter[block].begin()+idx+1);
         countUsedParameter[block].erase(countUsedParameter[block].begin()+idx+1);
+        rowStartUsedParameter[block].erase(rowStartUsedParameter[block].begin()+idx+1);
+        rowEndUsedParameter[block].erase(rowEndUsedParameter[block].begin()+idx+1);
       }
     }
 
@@ -122,6 +138,16 @@ MatrixSlice GnssDesignMatrix::column(const GnssParameterIndex &index)
 
 /***********************************************/
 
+Bool GnssDesignMatrix::usedRows(UInt block, UInt k, UInt &rowStart, UInt &rowCount) const
+{
+  rowStart = std::max(row, rowStartUsedParameter[block][k]);
+  const UInt rowEnd = std::min(row+rows, rowEndUsedParameter[block][k]);
+  rowCount = (rowEnd > rowStart) ? (rowEnd-rowStart) : 0;
+  return (rowCount > 0);
+}
+
+/***********************************************/
+
 Matrix GnssDesignMatrix::mult(const_MatrixSliceRef x)
 {
   try
@@ -133,7 +159,9 @@ Matrix GnssDesignMatrix::mult(const_MatrixSliceRef x)
       {
         const UInt index = blockIndices[block]+indexUsedParameter[block][k];
         const UInt count = countUsedParameter[block][k];
-        matMult(1., A.slice(row, index, rows, count), x.row(index, count), y);
+        UInt rowStart, rowCount;
+        if(usedRows(block, k, rowStart, rowCount))
+          matMult(1., A.slice(rowStart, index, rowCount, count), x.row(index, count), y.row(rowStart-row, rowCount));
       }
 
     return y;
@@ -150,6 +178,7 @@ Matrix GnssDesignMatrix::mult(const std::vector<Matrix> &x, UInt startBlock, UIn
 {
   try
   {
+    GROOPS_PROFILE("GnssDesignMatrix::mult")
     Matrix y(rows, x.at(startBlock).columns());
     for(UInt block : indexUsedBlock)
       if((startBlock <= block) && (block < startBlock+countBlock))
@@ -157,7 +186,9 @@ Matrix GnssDesignMatrix::mult(const std::vector<Matrix> &x, UInt startBlock, UIn
         {
           const UInt index = blockIndices[block]+indexUsedParameter[block][k];
           const UInt count = countUsedParameter[block][k];
-          matMult(1., A.slice(row, index, rows, count), x.at(block).row(indexUsedParameter[block][k], count), y);
+          UInt rowStart, rowCount;
+          if(usedRows(block, k, rowStart, rowCount))
+            matMult(1., A.slice(rowStart, index, rowCount, count), x.at(block).row(indexUsedParameter[block][k], count), y.row(rowStart-row, rowCount));
         }
     return y;
   }
@@ -173,13 +204,16 @@ void GnssDesignMatrix::transMult(const_MatrixSliceRef l, std::vector<Matrix> &x,
 {
   try
   {
+    GROOPS_PROFILE("GnssDesignMatrix::transMult")
     for(UInt block : indexUsedBlock)
       if((startBlock <= block) && (block < startBlock+countBlock))
         for(UInt k=0; k<indexUsedParameter[block].size(); k++)
         {
           const UInt index = blockIndices[block]+indexUsedParameter[block][k];
           const UInt count = countUsedParameter[block][k];
-          matMult(1., A.slice(row, index, rows, count).trans(), l, x.at(block).row(indexUsedParameter[block][k], count));
+          UInt rowStart, rowCount;
+          if(usedRows(block, k, rowStart, rowCount))
+            matMult(1., A.slice(rowStart, index, rowCount, count).trans(), l.row(rowStart-row, rowCount), x.at(block).row(indexUsedParameter[block][k], count));
         }
   }
   catch(std::exception &e)
@@ -194,6 +228,22 @@ void GnssDesignMatrix::accumulateNormals(MatrixDistributed &normals, std::vector
 {
   try
   {
+    accumulateNormalMatrix(normals);
+    accumulateRightHandSide(n, lPl, obsCount);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void GnssDesignMatrix::accumulateNormalMatrix(MatrixDistributed &normals, Double factor)
+{
+  try
+  {
+    GROOPS_PROFILE("GnssDesignMatrix::accumulateNormalMatrix")
     for(UInt ii=0; ii<indexUsedBlock.size(); ii++)
     {
       const UInt blocki = indexUsedBlock[ii];
@@ -213,29 +263,59 @@ void GnssDesignMatrix::accumulateNormals(MatrixDistributed &normals, std::vector
       {
         const UInt index = indexUsedParameter[blocki][i];
         const UInt count = countUsedParameter[blocki][i];
-        const const_MatrixSlice Ai(A.slice(row, blockIndices[blocki]+index, rows, count).trans());
-
-        // right hand side
-        matMult(1., Ai, l.row(row, rows), n.at(blocki).row(index, count));
+        UInt rowStart, rowCount;
+        if(!usedRows(blocki, i, rowStart, rowCount))
+          continue;
 
         // diagonal block
-        rankKUpdate(1., Ai.trans(), normals.N(blocki, blocki).slice(index, index, count, count));
+        rankKUpdate(factor, A.slice(rowStart, blockIndices[blocki]+index, rowCount, count), normals.N(blocki, blocki).slice(index, index, count, count));
+
+        // only the common non-zero rows contribute to the products with other parameter groups
+        auto product = [&](UInt blockk, UInt k, MatrixSliceRef N)
+        {
+          const UInt start = std::max(rowStart, rowStartUsedParameter[blockk][k]);
+          const UInt end   = std::min({rowStart+rowCount, rowEndUsedParameter[blockk][k], row+rows});
+          if(end > start)
+            matMult(factor, A.slice(start, blockIndices[blocki]+index, end-start, count).trans(),
+                    A.slice(start, blockIndices[blockk]+indexUsedParameter[blockk][k], end-start, countUsedParameter[blockk][k]), N);
+        };
+
         for(UInt k=i+1; k<indexUsedParameter[blocki].size(); k++)
-          matMult(1., Ai, A.slice(row, blockIndices[blocki]+indexUsedParameter[blocki][k], rows, countUsedParameter[blocki][k]),
-                  normals.N(blocki, blocki).slice(index, indexUsedParameter[blocki][k], count, countUsedParameter[blocki][k]));
+          product(blocki, k, normals.N(blocki, blocki).slice(index, indexUsedParameter[blocki][k], count, countUsedParameter[blocki][k]));
 
         // other blocks
         for(UInt kk=ii+1; kk<indexUsedBlock.size(); kk++)
         {
           const UInt blockk = indexUsedBlock[kk];
           for(UInt k=0; k<indexUsedParameter[blockk].size(); k++)
-            matMult(1., Ai, A.slice(row, blockIndices[blockk]+indexUsedParameter[blockk][k], rows, countUsedParameter[blockk][k]),
-                    normals.N(blocki, blockk).slice(index, indexUsedParameter[blockk][k], count, countUsedParameter[blockk][k]));
+            product(blockk, k, normals.N(blocki, blockk).slice(index, indexUsedParameter[blockk][k], count, countUsedParameter[blockk][k]));
         }
       }
     }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void GnssDesignMatrix::accumulateRightHandSide(std::vector<Matrix> &n, Double &lPl, UInt &obsCount)
+{
+  try
+  {
+    GROOPS_PROFILE("GnssDesignMatrix::accumulateRightHandSide")
+    for(UInt blocki : indexUsedBlock)
+      for(UInt i=0; i<indexUsedParameter[blocki].size(); i++)
+      {
+        const UInt index = indexUsedParameter[blocki][i];
+        const UInt count = countUsedParameter[blocki][i];
+        UInt rowStart, rowCount;
+        if(usedRows(blocki, i, rowStart, rowCount))
+          matMult(1., A.slice(rowStart, blockIndices[blocki]+index, rowCount, count).trans(), l.row(rowStart, rowCount), n.at(blocki).row(index, count));
+      }
 
-    // accumulate right hand side
     obsCount += rows;
     lPl      += quadsum(l);
   }
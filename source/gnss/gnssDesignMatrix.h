@@ -29,9 +29,14 @@ class GnssDesignMatrix
   std::vector<UInt>              indexUsedBlock;
   std::vector<std::vector<UInt>> indexUsedParameter;
   std::vector<std::vector<UInt>> countUsedParameter;
+  std::vector<std::vector<UInt>> rowStartUsedParameter; // rows of A (non-zero part of the parameter group)
+  std::vector<std::vector<UInt>> rowEndUsedParameter;
   UInt                           row, rows;
   Matrix                         A;
 
+  // intersection of the non-zero rows of a parameter group with the selected rows
+  Bool usedRows(UInt block, UInt k, UInt &rowStart, UInt &rowCount) const;
+
 public:
   Vector l;
 
@@ -45,6 +50,8 @@ public:
   Matrix            mult(const std::vector<Matrix> &x, UInt startBlock, UInt countBlock);
   void              transMult(const_MatrixSliceRef l, std::vector<Matrix> &x, UInt startBlock, UInt countBlock);
   void              accumulateNormals(MatrixDistributed &normals, std::vector<Matrix> &n, Double &lPl, UInt &obsCount);
+  void              accumulateNormalMatrix(MatrixDistributed &normals, Double factor=1.); //!< only N += factor * A'A
+  void              accumulateRightHandSide(std::vector<Matrix> &n, Double &lPl, UInt &obsCount); //!< only n += A'l
 };
 
 /// @}
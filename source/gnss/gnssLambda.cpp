@@ -11,8 +11,11 @@
 /***********************************************/
 
 #include "base/import.h"
+#include "parallel/threadPool.h"
 #include "inputOutput/logging.h"
 #include "gnssLambda.h"
+#include <atomic>
+#include <mutex>
 
 /***********************************************/
 
@@ -66,12 +69,23 @@ void GnssLambda::choleskyReversePivot(Matrix &N, Transformation &Z, Bool timing)
 {
   try
   {
-    Vector tmp(N.rows());
+    // the rows are computed in panels of blockSize rows,
+    // the trailing matrix is updated with a rank k update after each panel
+    const UInt blockSize = 128;
+    Vector tmp(N.rows()); // squared sum of the computed rows of the current panel
+    UInt blockStart = 0;
     if(timing) logTimerStart;
     for(UInt i=0; i<N.rows(); i++)
     {
       if(timing) logTimerLoop(i, N.rows());
 
+      if(i == blockStart+blockSize)
+      {
+        rankKUpdate(-1., N.slice(blockStart, i, i-blockStart, N.rows()-i), N.slice(i, i, N.rows()-i, N.rows()-i));
+        tmp.fill(0.);
+        blockStart = i;
+      }
+
       // find minimium
       UInt   k    = i;
       Double minN = N(i,i)-tmp(i);
@@ -96,8 +110,8 @@ void GnssLambda::choleskyReversePivot(Matrix &N, Transformation &Z, Bool timing)
       N(i,i)  = std::sqrt(N(i,i));
       if(i+1<N.rows())
       {
-        if(i > 0)
-          matMult(-1., N.slice(0, i, i, 1).trans(), N.slice(0, i+1, i, N.rows()-1-i), N.slice(i, i+1, 1, N.rows()-1-i));
+        if(i > blockStart)
+          matMult(-1., N.slice(blockStart, i, i-blockStart, 1).trans(), N.slice(blockStart, i+1, i-blockStart, N.rows()-1-i), N.slice(i, i+1, 1, N.rows()-1-i));
         N.slice(i,i+1,1,N.rows()-1-i) *= 1./N(i,i);
         for(UInt k=i+1; k<N.rows(); k++)
           tmp(k) += std::pow(N(i,k), 2);
@@ -134,6 +148,38 @@ inline Bool GnssLambda::choleskyReduce(UInt i, UInt k, MatrixSliceRef W, Transfo
 
 /***********************************************/
 
+// reduce elements (i, k) of row i for k >= kStart (same as choleskyReduce(i, k) for k=kStart,...,dim-1)
+// the reductions are applied column by column, only the columns of W are accessed
+void GnssLambda::choleskyReduceRow(UInt i, UInt kStart, MatrixSliceRef W, Transformation &Z)
+{
+  try
+  {
+    std::vector<UInt>   index; // reduced rows
+    std::vector<Double> alpha;
+    for(UInt k=kStart; k<W.columns(); k++)
+    {
+      Double w = W(i,k);
+      for(UInt j=0; j<index.size(); j++)
+        w -= alpha[j] * W(index[j],k);
+      const Double a = std::round(w);
+      if(a != 0.)
+      {
+        w -= a * W(k,k);
+        index.push_back(k);
+        alpha.push_back(a);
+        Z.reduce(a, k, i);
+      }
+      W(i,k) = w;
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 Vector GnssLambda::choleskyTransform(MatrixSliceRef W, Transformation &Z, Bool timing)
 {
   try
@@ -150,8 +196,7 @@ Vector GnssLambda::choleskyTransform(MatrixSliceRef W, Transformation &Z, Bool t
 
     // decorrelate
     for(UInt i=dim; i-->0;)
-      for(UInt k=i+1; k<dim; k++)
-        choleskyReduce(i, k, W, Z);
+      choleskyReduceRow(i, i+1, W, Z);
 
     std::vector<Double> delta(dim-1);
     for(UInt i=0; i<dim-1; i++)
@@ -203,8 +248,7 @@ Vector GnssLambda::choleskyTransform(MatrixSliceRef W, Transformation &Z, Bool t
       {
         // mathematically only choleskyReduce(i, i+1, W, Z) is needed
         if(choleskyReduce(i, i+1, W, Z))
-          for(UInt k=i+2; k<dim; k++)
-            choleskyReduce(i, k, W, Z);
+          choleskyReduceRow(i, i+2, W, Z);
         delta[i] = d[i] + std::pow(W(i,i+1), 2) * d[i+1];
         if(delta[i] < d[i+1])
           ratio.insert(std::make_pair(delta[i]/d[i+1], i));
@@ -214,8 +258,7 @@ Vector GnssLambda::choleskyTransform(MatrixSliceRef W, Transformation &Z, Bool t
 
     // decorrelate rest of the triangle
     for(UInt i=dim; i-->0;)
-      for(UInt k=i+1; k<dim; k++)
-        choleskyReduce(i, k, W, Z);
+      choleskyReduceRow(i, i+1, W, Z);
 
     return d;
   }
@@ -227,74 +270,152 @@ Vector GnssLambda::choleskyTransform(MatrixSliceRef W, Transformation &Z, Bool t
 
 /***********************************************/
 
+// depth first search with zig-zag enumeration of the integer candidates,
+// the last ambiguity is initialized with xIntLast and only searched if searchLast.
+// xBar.column(0) must contain xFloat, the other columns are used for intermediate results.
+// bound() returns the norm of the best solution so far,
+// found(xInt, norm) is called for each better solution and returns the new bound.
+// returns the number of search steps.
+template<typename Bound, typename Found>
+static UInt searchDepthFirst(const_MatrixSliceRef W, const_MatrixSliceRef d, MatrixSliceRef xBar, Double xIntLast, Bool searchLast,
+                             UInt maxSearchSteps, Bound bound, Found found)
+{
+  const UInt dim  = W.rows();
+  const UInt iMax = (searchLast) ? dim-1 : dim-2;
+  std::vector<Double> xInt(dim, 0);
+  std::vector<Double> norm(dim, 0);
+  std::vector<Double> step(dim, 0);
+  std::vector<Double> dx  (dim, 0);
+
+  // xBar vector of step i starts at xBar(dim-1-i, dim-1-i), reverse order
+  UInt i  = dim-1;
+  xInt[i] = xIntLast;
+  dx[i]   = xInt[i] - xBar(dim-1, dim-1-i);
+  step[i] = (dx[i] < 0) ? 1 : -1;
+  Double minNorm = bound();
+  Double newNorm = dx[i]*dx[i]/d(i,0);
+
+  UInt iter=0;
+  for(; iter<maxSearchSteps; iter++)
+  {
+    minNorm = std::min(minNorm, bound());
+
+    // move down
+    const UInt lastValidXBar = i;
+    while((newNorm < minNorm) && (i-- > 0))
+    {
+      // compute new xBar
+      for(UInt k=lastValidXBar; k-->i;)
+        xBar(i+dim-1-k, dim-1-k) = xBar(i+dim-2-k, dim-2-k) + dx[k+1] * W(i,k+1);
+
+      xInt[i]  = std::round(xBar(dim-1, dim-1-i));
+      dx[i]    = xInt[i] - xBar(dim-1, dim-1-i);
+      step[i]  = (dx[i] < 0) ? 1 : -1;
+      norm[i]  = newNorm;
+      newNorm += dx[i]*dx[i]/d(i,0);
+    }
+
+    // new solution?
+    if(newNorm < minNorm)
+    {
+      i = 0;
+      minNorm = found(xInt, newNorm);
+      newNorm = 2e99;
+    }
+
+    // move up
+    while((newNorm >= minNorm) && (i++ < iMax))
+    {
+      xInt[i] += step[i];
+      dx[i]   += step[i];
+      step[i]  = (step[i]>0) ? (-step[i]-1) : (-step[i]+1); // zig-zag search
+      newNorm  = norm[i] + dx[i]*dx[i]/d(i,0);
+    }
+
+    if(newNorm >= minNorm)
+      break;
+  } // for(iter)
+
+  return iter;
+}
+
+/***********************************************/
+
 Bool GnssLambda::searchInteger(const_MatrixSliceRef xFloat, MatrixSliceRef W, const_MatrixSliceRef d,
                                UInt maxSearchSteps, Vector &solution, Double &minNorm)
 {
   try
   {
     const UInt dim = W.rows();
-    std::vector<Double> xInt(dim, 0);
-    std::vector<Double> norm(dim, 0);
-    std::vector<Double> step(dim, 0);
-    std::vector<Double> dx  (dim, 0);
-
-    // store xBar in lower triangle of W
-    // xBar vector of step i starts at W(dim-1-i, dim-1-i), reverse order
-    MatrixSlice xBar(W);
-    copy(xFloat, xBar.column(0));
-
-    UInt i  = dim-1;
-    xInt[i] = std::round(xBar(dim-1, dim-1-i));
-    dx[i]   = xInt[i] - xBar(dim-1, dim-1-i);
-    step[i] = (dx[i] < 0) ? 1 : -1;
     minNorm = 1e99;
-    Double newNorm = dx[i]*dx[i]/d(i,0);
 
-    UInt iter=0;
-    for(; iter<maxSearchSteps; iter++)
+    if((dim < 2) || (Parallel::threadCount() <= 1) || Parallel::isThreadWorker())
     {
-      // move down
-      const UInt lastValidXBar = i;
-      while((newNorm < minNorm) && (i-- > 0))
-      {
-        // compute new xBar
-        for(UInt k=lastValidXBar; k-->i;)
-          xBar(i+dim-1-k, dim-1-k) = xBar(i+dim-2-k, dim-2-k) + dx[k+1] * W(i,k+1);
-
-        xInt[i]  = std::round(xBar(dim-1, dim-1-i));
-        dx[i]    = xInt[i] - xBar(dim-1, dim-1-i);
-        step[i]  = (dx[i] < 0) ? 1 : -1;
-        norm[i]  = newNorm;
-        newNorm += dx[i]*dx[i]/d(i,0);
-      }
+      // store xBar in lower triangle of W
+      MatrixSlice xBar(W);
+      copy(xFloat, xBar.column(0));
 
-      // new solution?
-      if(newNorm < minNorm)
-      {
-        i = 0;
-        solution = Vector(xInt);
-        minNorm  = newNorm;
-        newNorm  = 2e99;
-      }
+      const UInt iter = searchDepthFirst(W, d, xBar, std::round(xFloat(dim-1,0)), TRUE/*searchLast*/, maxSearchSteps,
+                                         [&]() {return minNorm;},
+                                         [&](const std::vector<Double> &xInt, Double norm) {solution = Vector(xInt); return minNorm = norm;});
 
-      // move up
-      while((newNorm >= minNorm) && (i++ < dim-1))
-      {
-        xInt[i] += step[i];
-        dx[i]   += step[i];
-        step[i]  = (step[i]>0) ? (-step[i]-1) : (-step[i]+1); // zig-zag search
-        newNorm  = norm[i] + dx[i]*dx[i]/d(i,0);
-      }
+      // restore diagonal
+      for(UInt i=0; i<dim; i++)
+        W(i,i) = 1.;
 
-      if(newNorm >= minNorm)
-        break;
-    } // for(iter)
+      return (iter < maxSearchSteps);
+    }
 
-    // restore diagonal
-    for(UInt i=0; i<dim; i++)
-      W(i,i) = 1.;
+    // parallel search: the candidates of the last ambiguity (subtrees) are distributed over the threads
+    // the norm of the best solution so far is shared between the threads
+    const Double xLast     = xFloat(dim-1, 0);
+    const Double stepFirst = (std::round(xLast) - xLast < 0) ? 1 : -1;
+    std::mutex          mutex;
+    std::atomic<Double> minNormShared(1e99);
+    std::atomic<UInt>   nextCandidate(0), steps(0);
+    std::atomic<Bool>   completed(TRUE);
+    Parallel::threadLoop(0, Parallel::threadCount(), [&](UInt /*idThread*/)
+    {
+      Matrix xBar(dim, dim);
+      copy(xFloat, xBar.column(0));
+      for(;;)
+      {
+        // zig-zag order: round(xLast), then alternating +/-1, -/+1, +/-2, ...
+        const UInt   k     = nextCandidate++;
+        const Double xInt  = std::round(xLast) + ((k%2) ? 1 : -1) * stepFirst * static_cast<Double>((k+1)/2);
+        const Double normK = std::pow(xInt-xLast, 2)/d(dim-1,0);
+        if(normK >= minNormShared)
+          break; // all following candidates have a larger norm
+        if(steps >= maxSearchSteps)
+        {
+          completed = FALSE;
+          break;
+        }
+
+        const UInt maxSteps = maxSearchSteps - steps;
+        const UInt iter = searchDepthFirst(W, d, xBar, xInt, FALSE/*searchLast*/, maxSteps,
+                                           [&]() {return minNormShared.load();},
+                                           [&](const std::vector<Double> &xInt, Double norm)
+                                           {
+                                             std::lock_guard<std::mutex> lock(mutex);
+                                             if(norm < minNormShared)
+                                             {
+                                               solution      = Vector(xInt);
+                                               minNormShared = norm;
+                                             }
+                                             return minNormShared.load();
+                                           });
+        steps += iter;
+        if(iter >= maxSteps)
+        {
+          completed = FALSE;
+          break;
+        }
+      }
+    });
+    minNorm = minNormShared;
 
-    return (iter < maxSearchSteps);
+    return completed;
   }
   catch(std::exception &e)
   {
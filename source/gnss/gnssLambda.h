@@ -57,6 +57,7 @@ namespace GnssLambda
   // LAMBDA method
   void   choleskyReversePivot(Matrix &N, Transformation &Z, Bool timing);
   Bool   choleskyReduce(UInt i, UInt k, MatrixSliceRef W, Transformation &transformation);
+  void   choleskyReduceRow(UInt i, UInt kStart, MatrixSliceRef W, Transformation &transformation);
   Vector choleskyTransform(MatrixSliceRef W, Transformation &transformation, Bool timing);
   Bool   searchInteger(const_MatrixSliceRef xFloat, MatrixSliceRef W, const_MatrixSliceRef d, UInt maxSearchSteps, Vector &solution, Double &minNorm);
   Vector searchIntegerBlocked(const_MatrixSliceRef xFloat, MatrixSliceRef W, const_MatrixSliceRef d,
@@ -18,6 +18,17 @@
 
 /***********************************************/
 
+// reuse the memory of the previous observation equation if the dimension fits
+static void resizeNull(Matrix &A, UInt rows, UInt columns)
+{
+  if((A.rows() == rows) && (A.columns() == columns) && (A.getType() == Matrix::GENERAL))
+    A.setNull();
+  else
+    A = Matrix(rows, columns);
+}
+
+/***********************************************/
+
 static void positionVelocityTime(const GnssReceiver &receiver, const GnssTransmitter &transmitter, const Rotary3d &rotCrf2Trf, UInt idEpoch,
                                  Time &timeRecv,  Vector3d &posRecv,  Vector3d &velRecv,  Angle &azimutRecv,  Angle &elevationRecv,
                                  Time &timeTrans, Vector3d &posTrans, Vector3d &velTrans, Angle &azimutTrans, Angle &elevationTrans,
@@ -59,6 +70,54 @@ static void positionVelocityTime(const GnssReceiver &receiver, const GnssTransmi
 }
 
 
+/***********************************************/
+
+GnssObservation::GnssObservation(const GnssObservation &x)
+  : obs(x.packed ? std::vector<GnssSingleObservation>(x.packed, x.packed+x.packedSize) : x.obs),
+    packed(nullptr), packedSize(0), track(x.track), STEC(x.STEC), dSTEC(x.dSTEC)
+{
+}
+
+/***********************************************/
+
+GnssObservation &GnssObservation::operator=(const GnssObservation &x)
+{
+  if(this != &x)
+  {
+    obs        = x.packed ? std::vector<GnssSingleObservation>(x.packed, x.packed+x.packedSize) : x.obs;
+    packed     = nullptr;
+    packedSize = 0;
+    track      = x.track;
+    STEC       = x.STEC;
+    dSTEC      = x.dSTEC;
+  }
+  return *this;
+}
+
+/***********************************************/
+
+GnssSingleObservation *GnssObservation::pack(GnssSingleObservation *memory)
+{
+  unpack();
+  packedSize = obs.size();
+  packed     = memory;
+  std::move(obs.begin(), obs.end(), packed);
+  obs.clear();
+  obs.shrink_to_fit();
+  return packed + packedSize;
+}
+
+/***********************************************/
+
+void GnssObservation::unpack()
+{
+  if(!packed)
+    return;
+  obs.assign(packed, packed+packedSize);
+  packed     = nullptr;
+  packedSize = 0;
+}
+
 /***********************************************/
 
 Bool GnssObservation::init(const GnssReceiver &receiver, const GnssTransmitter &transmitter, const std::function<Rotary3d(const Time &time)> &rotationCrf2Trf,
@@ -66,6 +125,7 @@ Bool GnssObservation::init(const GnssReceiver &receiver, const GnssTransmitter &
 {
   try
   {
+    unpack();
     if((!receiver.useable(idEpoch)) || (!transmitter.useable(idEpoch)))
       return FALSE;
 
@@ -272,9 +332,9 @@ void GnssObservationEquation::compute(const GnssObservation &observation, const
     dSTEC       = observation.dSTEC;
     types       = types_;
     rankDeficit = 0;
-    l           = Vector(obsCount);
-    sigma       = Vector(obsCount);
-    sigma0      = Vector(obsCount);
+    resizeNull(l,      obsCount, 1);
+    resizeNull(sigma,  obsCount, 1);
+    resizeNull(sigma0, obsCount, 1);
 
     for(UInt i=0; i<obsCount; i++)
     {
@@ -325,7 +385,7 @@ void GnssObservationEquation::compute(const GnssObservation &observation, const
 
     // design matrix
     // -------------
-    A = Matrix(obsCount, 10 + obsCount + T.columns());
+    resizeNull(A, obsCount, 10 + obsCount + T.columns());
     for(UInt i=0; i<obsCount; i++)
     {
       if((types.at(i) == GnssType::RANGE) || (types.at(i) == GnssType::PHASE))
@@ -345,7 +405,8 @@ void GnssObservationEquation::compute(const GnssObservation &observation, const
       A(i, idxUnit+i) = 1.0; // unit matrix
     }  // for(i=0..obsCount)
     copy(T, A.column(idxUnit + obsCount, T.columns()));
-    B = A.column(idxSTEC);
+    resizeNull(B, obsCount, 1);
+    copy(A.column(idxSTEC), B);
 
     // antenna correction and other corrections
     // ----------------------------------------
@@ -50,6 +50,10 @@ public:
 class GnssObservation
 {
   std::vector<GnssSingleObservation> obs;
+  GnssSingleObservation *packed;     // in continuous memory of the receiver (see pack())
+  UInt                   packedSize;
+
+  void unpack();
 
 public:
   typedef UInt Group;
@@ -61,18 +65,27 @@ public:
   GnssTrack *track; ///< phase ambiguities
   Double     STEC, dSTEC;  ///< total ionosphere slant TEC along the path and estimated part of STEC
 
-  GnssObservation() : track(nullptr), STEC(0.), dSTEC(0.) {}
-
-  UInt size() const                                      {return obs.size();}
-  GnssSingleObservation       &at(UInt idType)           {return obs.at(idType);}
-  const GnssSingleObservation &at(UInt idType) const     {return obs.at(idType);}
-  GnssSingleObservation       &at(GnssType type)         {return obs.at(index(type));}
-  const GnssSingleObservation &at(GnssType type) const   {return obs.at(index(type));}
+  GnssObservation() : packed(nullptr), packedSize(0), track(nullptr), STEC(0.), dSTEC(0.) {}
+  GnssObservation(const GnssObservation &x);
+  GnssObservation(GnssObservation &&x) = default;
+  GnssObservation &operator=(const GnssObservation &x);
+  GnssObservation &operator=(GnssObservation &&x) = default;
+
+  UInt size() const                                      {return packed ? packedSize : obs.size();}
+  GnssSingleObservation       &at(UInt idType)           {return packed ? packed[checkIndex(idType)] : obs.at(idType);}
+  const GnssSingleObservation &at(UInt idType) const     {return packed ? packed[checkIndex(idType)] : obs.at(idType);}
+  GnssSingleObservation       &at(GnssType type)         {return at(index(type));}
+  const GnssSingleObservation &at(GnssType type) const   {return at(index(type));}
   UInt index(GnssType type) const;
-  void push_back(const GnssSingleObservation &singleObs) {obs.push_back(singleObs);}
-  void erase(UInt idType)                                {obs.erase(obs.begin()+idType); obs.shrink_to_fit();}
+  void push_back(const GnssSingleObservation &singleObs) {unpack(); obs.push_back(singleObs);}
+  void erase(UInt idType)                                {unpack(); obs.erase(obs.begin()+idType); obs.shrink_to_fit();}
   void shrink_to_fit()                                   {obs.shrink_to_fit();}
 
+  /** @brief Moves the single observations to continuous @p memory (with at least size() elements), which must outlive this object.
+  * Used by GnssReceiver to store all observations of a receiver sequentially in one memory block.
+  * @return memory behind the moved observations. */
+  GnssSingleObservation *pack(GnssSingleObservation *memory);
+
   Bool init(const GnssReceiver &receiver, const GnssTransmitter &transmitter, const std::function<Rotary3d(const Time &time)> &rotationCrf2Trf,
             UInt idEpoch, Angle elevationCutOff, Double &phaseWindupOld);
 
@@ -80,6 +93,9 @@ public:
   Bool observationList         (Group group, std::vector<GnssType> &types) const;
   void setDecorrelatedResiduals(const std::vector<GnssType> &types, const_MatrixSliceRef residuals, const_MatrixSliceRef redundancy);
   void updateParameter         (const_MatrixSliceRef x, const_MatrixSliceRef covariance=Matrix());
+
+private:
+  UInt checkIndex(UInt idType) const {if(idType >= packedSize) throw(std::out_of_range("GnssObservation::at")); return idType;}
 };
 
 /***** CLASS ***********************************/
@@ -14,6 +14,7 @@
 #include "base/import.h"
 #include "base/planets.h"
 #include "base/sphericalHarmonics.h"
+#include <atomic>
 #include "config/config.h"
 // #include "files/fileGnssIonosphereMaps.h"
 #include "classes/magnetosphere/magnetosphere.h"
@@ -21,7 +22,26 @@
 
 /***********************************************/
 
-GnssParametrizationIonosphereMap::GnssParametrizationIonosphereMap(Config &config)
+namespace
+{
+  // Quantities of the last epoch (per thread).
+  // designMatrix is called for all transmitters of a receiver with the same receiver time.
+  struct IonosphereMapEpochCache
+  {
+    UInt                id = NULLINDEX;
+    Time                time;
+    Rotary3d            rotary;
+    std::vector<UInt>   idx;
+    std::vector<Double> factor;
+  };
+
+  thread_local IonosphereMapEpochCache epochCache;
+  std::atomic<UInt> epochCacheIdNext(0);
+}
+
+/***********************************************/
+
+GnssParametrizationIonosphereMap::GnssParametrizationIonosphereMap(Config &config) : cacheId(epochCacheIdNext++)
 {
   try
   {
@@ -199,40 +219,81 @@ Double GnssParametrizationIonosphereMap::mapping(Angle elevation) const
 
 /***********************************************/
 
-void GnssParametrizationIonosphereMap::designMatrix(const GnssNormalEquationInfo &/*normalEquationInfo*/, const GnssObservationEquation &eqn, GnssDesignMatrix &A) const
+// spherical harmonics at the pierce point in the solar-geomagnetic frame
+Vector GnssParametrizationIonosphereMap::sphericalHarmonics(const GnssObservationEquation &eqn) const
 {
   try
   {
-    if(!index.size() || !selectedReceivers.at(eqn.receiver->idRecv()))
-      return;
+    if((epochCache.id != cacheId) || !(epochCache.time == eqn.timeRecv))
+    {
+      epochCache.id     = cacheId;
+      epochCache.time   = eqn.timeRecv;
+      epochCache.rotary = magnetosphere->rotaryCelestial2SolarGeomagneticFrame(eqn.timeRecv);
+      temporal->factors(eqn.timeRecv, epochCache.idx, epochCache.factor);
+    }
 
-    // spatial representation
     Matrix Cnm, Snm;
-    const Rotary3d rot   = magnetosphere->rotaryCelestial2SolarGeomagneticFrame(eqn.timeRecv);
-    const Vector3d point = rot.rotate(intersection(eqn.posRecv, eqn.posTrans, eqn.elevationRecvLocal));
+    const Vector3d point = epochCache.rotary.rotate(intersection(eqn.posRecv, eqn.posTrans, eqn.elevationRecvLocal));
     SphericalHarmonics::CnmSnm(normalize(point), maxDegree, Cnm, Snm);
-    Matrix Ynm(1, (maxDegree+1)*(maxDegree+1));
+    Vector Ynm((maxDegree+1)*(maxDegree+1));
     UInt count = 0;
     for(UInt n=0; n<=maxDegree; n++)
     {
-      Ynm(0, count++) = Cnm(n,0);
+      Ynm(count++) = Cnm(n,0);
       for(UInt m=1; m<=n; m++)
       {
-        Ynm(0, count++) = Cnm(n,m);
-        Ynm(0, count++) = Snm(n,m);
+        Ynm(count++) = Cnm(n,m);
+        Ynm(count++) = Snm(n,m);
       }
     }
+    return Ynm;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+// temporal factors (cached together with the rotation of the epoch)
+void GnssParametrizationIonosphereMap::temporalFactors(const Time &time, std::vector<UInt> &idx, std::vector<Double> &factor) const
+{
+  try
+  {
+    if((epochCache.id != cacheId) || !(epochCache.time == time))
+    {
+      temporal->factors(time, idx, factor);
+      return;
+    }
+    idx    = epochCache.idx;
+    factor = epochCache.factor;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
 
-    // VTEC -> STEC
-    Matrix B(eqn.l.rows(), Ynm.columns());
-    matMult(mapping(eqn.elevationRecvLocal), eqn.A.column(GnssObservationEquation::idxSTEC), Ynm, B);
+void GnssParametrizationIonosphereMap::designMatrix(const GnssNormalEquationInfo &/*normalEquationInfo*/, const GnssObservationEquation &eqn, GnssDesignMatrix &A) const
+{
+  try
+  {
+    if(!index.size() || !selectedReceivers.at(eqn.receiver->idRecv()))
+      return;
+
+    // spatial representation
+    const Vector Ynm = sphericalHarmonics(eqn);
 
-    // temporal representation
+    // temporal representation, VTEC -> STEC
     std::vector<UInt>   idx;
     std::vector<Double> factor;
-    temporal->factors(eqn.timeRecv, idx, factor);
+    temporalFactors(eqn.timeRecv, idx, factor);
+    const Double factorMapping = mapping(eqn.elevationRecvLocal);
     for(UInt i=0; i<factor.size(); i++)
-      axpy(factor.at(i), B, A.column(index.at(idx.at(i))));
+      matMult(factor.at(i)*factorMapping, eqn.A.column(GnssObservationEquation::idxSTEC), Ynm.trans(), A.column(index.at(idx.at(i))));
   }
   catch(std::exception &e)
   {
@@ -276,21 +337,7 @@ Double GnssParametrizationIonosphereMap::updateParameter(const GnssNormalEquatio
                                           nullptr/*reduceModels*/, idEpoch, FALSE/*decorrelate*/, {}/*types*/);
 
               // spatial representation
-              Matrix Cnm, Snm;
-              const Rotary3d rot   = magnetosphere->rotaryCelestial2SolarGeomagneticFrame(eqn.timeRecv);
-              const Vector3d point = rot.rotate(intersection(eqn.posRecv, eqn.posTrans, eqn.elevationRecvLocal));
-              SphericalHarmonics::CnmSnm(normalize(point), maxDegree, Cnm, Snm);
-              Double dVTEC = 0;
-              UInt count = 0;
-              for(UInt n=0; n<=maxDegree; n++)
-              {
-                dVTEC += Cnm(n,0) * dx(count++);
-                for(UInt m=1; m<=n; m++)
-                {
-                   dVTEC += Cnm(n,m) * dx(count++);
-                   dVTEC += Snm(n,m) * dx(count++);
-                }
-              }
+              const Double dVTEC = inner(sphericalHarmonics(eqn), dx);
 
               recv->observation(idTrans, idEpoch)->STEC += mapping(eqn.elevationRecvLocal) * dVTEC;
               if(info.update(dVTEC))
@@ -66,9 +66,12 @@ class GnssParametrizationIonosphereMap : public GnssParametrizationBase
   MagnetospherePtr                magnetosphere;
   std::vector<Vector>             x;
   std::vector<GnssParameterIndex> index;
+  UInt                            cacheId;
 
   Vector3d intersection(const Vector3d &posRecv, const Vector3d &posTrans, Angle elevation) const;
   Double   mapping(Angle elevation) const;
+  Vector   sphericalHarmonics(const GnssObservationEquation &eqn) const;
+  void     temporalFactors(const Time &time, std::vector<UInt> &idx, std::vector<Double> &factor) const;
 
 public:
   GnssParametrizationIonosphereMap(Config &config);
@@ -20,6 +20,22 @@
 
 /***********************************************/
 
+namespace
+{
+  // Earth rotation of the last epoch (per thread).
+  // observationCorrections is called for all transmitters of a receiver with the same receiver time.
+  struct IonosphereSTECEpochCache
+  {
+    Bool     isSet = FALSE;
+    Time     time;
+    Rotary3d rotEarth;
+  };
+
+  thread_local IonosphereSTECEpochCache epochCache;
+}
+
+/***********************************************/
+
 GnssParametrizationIonosphereSTEC::GnssParametrizationIonosphereSTEC(Config &config)
 {
   try
@@ -123,7 +139,13 @@ void GnssParametrizationIonosphereSTEC::observationCorrections(GnssObservationEq
     // ----------------------------------------------------------
     // second order magentic effect
     const Vector3d piercePoint = intersection(eqn.posRecv, eqn.posTrans);
-    const Rotary3d rotEarth    = Planets::celestial2TerrestrialFrame(eqn.timeRecv);
+    if(!epochCache.isSet || !(epochCache.time == eqn.timeRecv))
+    {
+      epochCache.isSet    = TRUE;
+      epochCache.time     = eqn.timeRecv;
+      epochCache.rotEarth = Planets::celestial2TerrestrialFrame(eqn.timeRecv);
+    }
+    const Rotary3d &rotEarth   = epochCache.rotEarth;
     const Vector3d b           = rotEarth.inverseRotate(magnetosphere->magenticFieldVector(eqn.timeRecv, rotEarth.rotate(piercePoint))); // magentic field vector in CRF
     const Vector3d k           = normalize(eqn.posRecv - eqn.posTrans); // line of sight
     const Double   s           = 1e16*7527.*LIGHT_VELOCITY*inner(b, k);
@@ -16,6 +16,7 @@
 #include "config/config.h"
 #include "files/fileInstrument.h"
 #include "files/fileMatrix.h"
+#include "files/fileParameterName.h"
 #include "gnss/gnss.h"
 #include "classes/ephemerides/ephemerides.h"
 #include "classes/parametrizationAcceleration/parametrizationAcceleration.h"
@@ -64,7 +65,7 @@ GnssParametrizationTransmitterDynamicOrbits::~GnssParametrizationTransmitterDyna
 
 /***********************************************/
 
-void GnssParametrizationTransmitterDynamicOrbits::init(Gnss *gnss, Parallel::CommunicatorPtr /*comm*/)
+void GnssParametrizationTransmitterDynamicOrbits::init(Gnss *gnss, Parallel::CommunicatorPtr comm)
 {
   try
   {
@@ -74,33 +75,53 @@ void GnssParametrizationTransmitterDynamicOrbits::init(Gnss *gnss, Parallel::Com
     // stochastic pulses in interval
     pulses.erase(std::remove_if(pulses.begin(), pulses.end(), [&](auto &p) {return (p <= gnss->times.front()) || (p >= gnss->times.back());}), pulses.end());
 
-    VariableList fileNameVariableList;
-    addVariable("prn", "***", fileNameVariableList);
     parameters.resize(gnss->transmitters.size(), nullptr);
+    std::vector<UInt> idTransList;
     for(UInt idTrans=0; idTrans<gnss->transmitters.size(); idTrans++)
       if(selectedTransmitters.at(idTrans) && gnss->transmitters.at(idTrans)->useable())
       {
         auto para = new Parameter();
         parameters.at(idTrans) = para;
         para->trans = gnss->transmitters.at(idTrans);
-
-        fileNameVariableList["prn"]->setValue(gnss->transmitters.at(idTrans)->name());
-        VariationalEquationFromFile file;
-        file.open(fileNameVariational(fileNameVariableList), nullptr/*parametrizationGravity*/, parametrizationAcceleration, pulses, ephemerides, integrationDegree);
-
-        auto variationalEquation = file.integrateArc(gnss->times.front(), gnss->times.back(), TRUE/*computePosition*/, TRUE/*computeVelocity*/);
-        para->times     = variationalEquation.times;
-        para->PosDesign = variationalEquation.PosDesign;
-        para->VelDesign = variationalEquation.VelDesign;
-        para->x         = Vector(para->PosDesign.columns());
-        para->polynomial.init(para->times, interpolationDegree);
-
-        // parameter names
-        file.parameterNameSatellite(para->parameterNames);
-        file.parameterNameSatelliteArc(para->parameterNames);
-        for(auto &name : para->parameterNames)
-          name.object = gnss->transmitters.at(idTrans)->name();
+        idTransList.push_back(idTrans);
       }
+
+    // integrate the variational equations of the transmitters distributed over all processes
+    std::vector<UInt> processNo(idTransList.size());
+    for(UInt i=0; i<idTransList.size(); i++)
+      processNo.at(i) = i % Parallel::size(comm);
+
+    Parallel::forEachProcess(idTransList.size(), [&](UInt i)
+    {
+      auto para = parameters.at(idTransList.at(i));
+      VariableList fileNameVariableList;
+      addVariable("prn", para->trans->name(), fileNameVariableList);
+      VariationalEquationFromFile file;
+      file.open(fileNameVariational(fileNameVariableList), nullptr/*parametrizationGravity*/, parametrizationAcceleration, pulses, ephemerides, integrationDegree);
+
+      auto variationalEquation = file.integrateArc(gnss->times.front(), gnss->times.back(), TRUE/*computePosition*/, TRUE/*computeVelocity*/);
+      para->times     = variationalEquation.times;
+      para->PosDesign = variationalEquation.PosDesign;
+      para->VelDesign = variationalEquation.VelDesign;
+
+      // parameter names
+      file.parameterNameSatellite(para->parameterNames);
+      file.parameterNameSatelliteArc(para->parameterNames);
+      for(auto &name : para->parameterNames)
+        name.object = para->trans->name();
+    }, processNo, comm, FALSE/*timing*/);
+
+    // distribute the results to all processes
+    for(UInt i=0; i<idTransList.size(); i++)
+    {
+      auto para = parameters.at(idTransList.at(i));
+      Parallel::broadCast(para->times,          processNo.at(i), comm);
+      Parallel::broadCast(para->PosDesign,      processNo.at(i), comm);
+      Parallel::broadCast(para->VelDesign,      processNo.at(i), comm);
+      Parallel::broadCast(para->parameterNames, processNo.at(i), comm);
+      para->x = Vector(para->PosDesign.columns());
+      para->polynomial.init(para->times, interpolationDegree);
+    }
   }
   catch(std::exception &e)
   {
@@ -207,6 +228,7 @@ Double GnssParametrizationTransmitterDynamicOrbits::updateParameter(const GnssNo
         const Vector dvel = para->polynomial.interpolate(para->trans->timesPosVel, para->VelDesign * dx, 3);
         para->trans->pos += reshape(dpos, 3, para->trans->pos.rows()).trans();
         para->trans->vel += reshape(dvel, 3, para->trans->vel.rows()).trans();
+        para->trans->initOrbitTable();
 
         for(UInt i=0; i<para->trans->timesPosVel.size(); i++)
           if(info.update(1e3*norm(dpos.row(3*i, 3))))
@@ -14,6 +14,7 @@
 
 #include "base/import.h"
 #include "parallel/matrixDistributed.h"
+#include <mutex>
 #include "config/configRegister.h"
 #include "config/config.h"
 #include "inputOutput/logging.h"
@@ -35,6 +36,7 @@
 #include "gnss/gnssProcessingStep/gnssProcessingStepSelectNormalsBlockStructure.h"
 #include "gnss/gnssProcessingStep/gnssProcessingStepSelectReceivers.h"
 #include "gnss/gnssProcessingStep/gnssProcessingStepForEachReceiverSeparately.h"
+#include "gnss/gnssProcessingStep/gnssProcessingStepSlidingWindow.h"
 #include "gnss/gnssProcessingStep/gnssProcessingStepGroup.h"
 #include "gnss/gnssProcessingStep/gnssProcessingStepDisableTransmitterShadowEpochs.h"
 
@@ -56,6 +58,7 @@ GROOPS_REGISTER_CLASS(GnssProcessingStep, "gnssProcessingStepType",
                       GnssProcessingStepSelectNormalsBlockStructure,
                       GnssProcessingStepSelectReceivers,
                       GnssProcessingStepForEachReceiverSeparately,
+                      GnssProcessingStepSlidingWindow,
                       GnssProcessingStepGroup,
                       GnssProcessingStepDisableTransmitterShadowEpochs)
 
@@ -100,6 +103,8 @@ GnssProcessingStep::GnssProcessingStep(Config &config, const std::string &name)
         bases.push_back(new GnssProcessingStepSelectReceivers(config));
       if(readConfigChoiceElement(config, "forEachReceiverSeparately",      type, "process receiver by receiver, transmitter parameters disabled"))
         bases.push_back(new GnssProcessingStepForEachReceiverSeparately(config));
+      if(readConfigChoiceElement(config, "slidingWindow",                  type, "process time windows shifted through the epochs"))
+        bases.push_back(new GnssProcessingStepSlidingWindow(config));
       if(readConfigChoiceElement(config, "group",                          type, "group processing steps"))
         bases.push_back(new GnssProcessingStepGroup(config));
       if(readConfigChoiceElement(config, "disableTransmitterShadowEpochs", type, "disable transmitter epochs in eclipse"))
@@ -151,7 +156,8 @@ void GnssProcessingStep::process(GnssProcessingStep::State &state)
 
 GnssProcessingStep::State::State(GnssPtr gnss, Parallel::CommunicatorPtr comm) :
   gnss(gnss), normalEquationInfo(gnss->times.size(), gnss->receivers.size(), gnss->transmitters.size(), comm),
-  changedNormalEquationInfo(TRUE), sigmaType(gnss->receivers.size()), sigmaFactor(gnss->receivers.size())
+  changedNormalEquationInfo(TRUE), sigmaType(gnss->receivers.size()), sigmaFactor(gnss->receivers.size()),
+  keepNormals(FALSE), thresholdSigmaNormals(0.)
 {
   try
   {
@@ -197,11 +203,25 @@ void GnssProcessingStep::State::regularizeNotUsedParameters(UInt blockStart, UIn
 /***********************************************/
 
 void GnssProcessingStep::State::collectNormalsBlocks(UInt blockStart, UInt blockCount)
+{
+  try
+  {
+    collectNormalsBlocksNonBlocking(blockStart, blockCount)();
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+std::function<void()> GnssProcessingStep::State::collectNormalsBlocksNonBlocking(UInt blockStart, UInt blockCount)
 {
   try
   {
     if(Parallel::size(normals.communicator()) <= 1)
-      return;
+      return [](){};
 
     auto countBlocks = [&]()
     {
@@ -243,25 +263,60 @@ void GnssProcessingStep::State::collectNormalsBlocks(UInt blockStart, UInt block
     Parallel::reduceSum(usedRanks, 0, normals.communicator());
     Parallel::broadCast(usedRanks, 0, normals.communicator());
 
+    // the blocks in flight are moved out of the normals (_N may be reallocated by new blocks in the meantime)
+    struct Reduction
+    {
+      UInt                 ik; // NULLINDEX: right hand side
+      UInt                 idBlock;
+      Matrix               x;
+      Parallel::RequestPtr request;
+    };
+    auto reductions = std::make_shared<std::list<Reduction>>();
+
     // reduce sum normals
     i = 0;
     for(UInt idBlock=blockStart; idBlock<blockStart+blockCount; idBlock++)
       normals.loopBlockRow(idBlock, {idBlock, normals.blockCount()}, [&](UInt /*k*/, UInt ik)
       {
-        std::vector<Bool> usedRank(usedRanks.columns());
-        for(UInt idProcess=0; idProcess<usedRank.size(); idProcess++)
-          usedRank[idProcess] = usedRanks(i, idProcess);
-        normals.reduceSum(normals._N[ik], ik, usedRank, TRUE/*free*/);
+        std::vector<UInt> ranks = {normals._rank[ik]};
+        for(UInt idProcess=0; idProcess<usedRanks.columns(); idProcess++)
+          if(usedRanks(i, idProcess) && (idProcess != normals._rank[ik]))
+            ranks.push_back(idProcess);
         i++;
+        if(ranks.size() < 2)
+          return;
+        Parallel::CommunicatorPtr commNew = Parallel::createCommunicator(ranks, normals.comm);
+        if(!commNew)
+          return;
+        reductions->push_back(Reduction{ik, idBlock, std::move(normals._N[ik]), nullptr});
+        normals._N[ik] = Matrix();
+        reductions->back().request = Parallel::reduceSumNonBlocking(reductions->back().x, 0, commNew);
       });
 
     // right hand side
     for(UInt idBlock=blockStart; idBlock<blockStart+blockCount; idBlock++)
     {
-      Parallel::reduceSum(n.at(idBlock), 0, normals.comm);
-      if(!Parallel::isMaster(normals.comm))
-        n.at(idBlock).setNull();
+      reductions->push_back(Reduction{NULLINDEX, idBlock, std::move(n.at(idBlock)), nullptr});
+      n.at(idBlock) = Matrix();
+      reductions->back().request = Parallel::reduceSumNonBlocking(reductions->back().x, 0, normals.comm);
     }
+
+    return [this, reductions]()
+    {
+      for(Reduction &r : *reductions)
+      {
+        Parallel::wait(r.request);
+        if(r.ik == NULLINDEX)
+        {
+          n.at(r.idBlock) = std::move(r.x);
+          if(!Parallel::isMaster(normals.comm))
+            n.at(r.idBlock).setNull();
+        }
+        else if(normals.isMyRank(r.ik))
+          normals._N[r.ik] = std::move(r.x);
+      }
+      reductions->clear();
+    };
   }
   catch(std::exception &e)
   {
@@ -275,117 +330,406 @@ void GnssProcessingStep::State::buildNormals(Bool constraintsOnly, Bool solveEpo
 {
   try
   {
-    normals.initEmpty(normalEquationInfo.blockIndices(), normalEquationInfo.comm);
+    // normal matrix of the last iteration can be updated?
+    const Bool storeNormals = keepNormals && !constraintsOnly && !solveEpochParameters;
+    const Bool reuseNormals = storeNormals && (normalsLast.blockIndex() == normalEquationInfo.blockIndices());
+    if(keepNormals && !constraintsOnly && solveEpochParameters)
+      logWarning<<"normal matrix cannot be reused without keepEpochNormalsInMemory"<<Log::endl;
+    MatrixDistributed normalsDelta, normalsConstraints; // only used with reuseNormals
+    if(reuseNormals)
+    {
+      normals = normalsLast;
+      normalsDelta.initEmpty(normalEquationInfo.blockIndices(), normalEquationInfo.comm);
+      normalsConstraints.initEmpty(normalEquationInfo.blockIndices(), normalEquationInfo.comm); // constraints are already contained in normals
+    }
+    else
+    {
+      normals.initEmpty(normalEquationInfo.blockIndices(), normalEquationInfo.comm);
+      if(storeNormals)
+        sigmaNormalsLast = std::vector<std::vector<Double>>(gnss->receivers.size());
+    }
     n.resize(normals.blockCount());
     for(UInt i=0; i<normals.blockCount(); i++)
       n.at(i) = Vector(normals.blockSize(i));
     lPl = Vector(1);
     obsCount = 0;
 
+    // sigmas of the observation equations in normalsLast (in order of the loops)
+    std::vector<UInt> idxSigma(gnss->receivers.size(), 0);
+    UInt countUpdatedEqn = 0;
+    auto sigmaChanged = [&](UInt idRecv, const GnssObservationEquation &eqn)
+    {
+      std::vector<Double> &sigmaLast = sigmaNormalsLast.at(idRecv);
+      if(idxSigma.at(idRecv)+eqn.sigma.rows() > sigmaLast.size())
+        throw(Exception("observations changed since the last normal equations"));
+      Bool changed = FALSE;
+      for(UInt i=0; i<eqn.sigma.rows(); i++)
+        changed = changed || (std::fabs(eqn.sigma(i)-sigmaLast.at(idxSigma.at(idRecv)+i)) > thresholdSigmaNormals*sigmaLast.at(idxSigma.at(idRecv)+i));
+      return changed;
+    };
+    // observation equation with sigmas of normalsLast, set new sigmas as used
+    auto equationLast = [&](UInt idRecv, GnssObservationEquation &eqn)
+    {
+      std::vector<Double> &sigmaLast = sigmaNormalsLast.at(idRecv);
+      for(UInt i=0; i<eqn.sigma.rows(); i++)
+      {
+        const Double factor = eqn.sigma(i)/sigmaLast.at(idxSigma.at(idRecv)+i);
+        if(eqn.l.size()) eqn.l.row(i) *= factor;
+        if(eqn.A.size()) eqn.A.row(i) *= factor;
+        if(eqn.B.size()) eqn.B.row(i) *= factor;
+        std::swap(eqn.sigma(i), sigmaLast.at(idxSigma.at(idRecv)+i));
+      }
+      idxSigma.at(idRecv) += eqn.sigma.rows();
+      countUpdatedEqn++;
+    };
+    auto storeSigma = [&](UInt idRecv, const GnssObservationEquation &eqn)
+    {
+      sigmaNormalsLast.at(idRecv).insert(sigmaNormalsLast.at(idRecv).end(), eqn.sigma.field(), eqn.sigma.field()+eqn.sigma.rows());
+    };
+
     // Loop over all epochs
     // --------------------
     Parallel::barrier(normalEquationInfo.comm);
-    logStatus<<"accumulate normals"<<Log::endl;
+    logStatus<<"accumulate normals"<<(reuseNormals ? " (update of last iteration)" : "")<<Log::endl;
     GnssDesignMatrix A(normalEquationInfo);
     std::vector<GnssObservationEquation> eqns(gnss->transmitters.size());
+    std::vector<GnssObservationEquation> eqnsLast(reuseNormals ? gnss->transmitters.size() : 0);
     UInt blockStart = 0; // first block, which is not regularized and reduced
     UInt blockCount = 0;
     UInt idLoop     = 0;
+
+    // epochs of a block group are distributed over threads
+    // ----------------------------------------------------
+    const Bool threaded = !constraintsOnly && !storeNormals && (Parallel::threadCount() > 1);
+    std::vector<UInt> chunkEpochs;
+    auto accumulateEpochsThreaded = [&](const std::vector<UInt> &idEpochs)
+    {
+      std::vector<std::pair<UInt, UInt>> tasks; // (idEpoch, idRecv)
+      for(UInt idEpoch : idEpochs)
+        for(UInt idRecv=0; idRecv<gnss->receivers.size(); idRecv++)
+          if(normalEquationInfo.estimateReceiver.at(idRecv) && gnss->receivers.at(idRecv)->isMyRank())
+            tasks.push_back(std::make_pair(idEpoch, idRecv));
+      if(!tasks.size())
+        return;
+
+      std::mutex mutex; // models are not thread safe
+      const UInt threads = std::min(Parallel::threadCount(), tasks.size());
+      Parallel::threadLoop(0, threads, [&](UInt idThread)
+      {
+        MatrixDistributed normalsThread;
+        normalsThread.initEmpty(normalEquationInfo.blockIndices(), normalEquationInfo.comm);
+        std::vector<Matrix> nThread(normals.blockCount());
+        Double lPlThread      = 0;
+        UInt   obsCountThread = 0;
+        GnssDesignMatrix AThread(normalEquationInfo);
+        std::vector<GnssObservationEquation> eqnsThread(gnss->transmitters.size());
+        for(UInt i=0; i<nThread.size(); i++)
+          nThread.at(i) = Vector(normals.blockSize(i));
+
+        for(UInt k=idThread; k<tasks.size(); k+=threads)
+        {
+          const UInt idEpoch = tasks.at(k).first;
+          const UInt idRecv  = tasks.at(k).second;
+          UInt countEqn = 0;
+          for(UInt idTrans=0; idTrans<gnss->receivers.at(idRecv)->idTransmitterSize(idEpoch); idTrans++)
+          {
+            {
+              std::lock_guard<std::mutex> lock(mutex);
+              if(!gnss->basicObservationEquations(normalEquationInfo, idRecv, idTrans, idEpoch, eqnsThread.at(countEqn)))
+                continue;
+            }
+            eqnsThread.at(countEqn).eliminateGroupParameters();
+            if(!normalEquationInfo.accumulateEpochObservations)
+            {
+              AThread.init(eqnsThread.at(countEqn).l);
+              {
+                std::lock_guard<std::mutex> lock(mutex);
+                gnss->designMatrix(normalEquationInfo, eqnsThread.at(countEqn), AThread);
+              }
+              AThread.accumulateNormals(normalsThread, nThread, lPlThread, obsCountThread);
+              obsCountThread -= eqnsThread.at(countEqn).rankDeficit;
+            }
+            countEqn++;
+          }
+
+          if(normalEquationInfo.accumulateEpochObservations)
+          {
+            // copy all observations to a single vector
+            AThread.init(Vector(std::accumulate(eqnsThread.begin(), eqnsThread.begin()+countEqn, UInt(0), [](UInt count, auto &eqn) {return count+eqn.l.rows();})));
+            UInt idx=0;
+            {
+              std::lock_guard<std::mutex> lock(mutex);
+              for(UInt i=0; i<countEqn; i++)
+              {
+                copy(eqnsThread.at(i).l, AThread.l.row(idx, eqnsThread.at(i).l.rows()));
+                gnss->designMatrix(normalEquationInfo, eqnsThread.at(i), AThread.selectRows(idx, eqnsThread.at(i).l.rows()));
+                idx += eqnsThread.at(i).l.rows();
+              }
+            }
+            AThread.selectRows(0, 0); // select all
+            AThread.accumulateNormals(normalsThread, nThread, lPlThread, obsCountThread);
+            obsCountThread -= std::accumulate(eqnsThread.begin(), eqnsThread.end(), UInt(0), [](UInt count, auto &eqn) {return count+eqn.rankDeficit;});
+          }
+        } // for(k)
+
+        // merge partial normals
+        std::lock_guard<std::mutex> lock(mutex);
+        for(UInt i=0; i<normalsThread.blockCount(); i++)
+          for(auto &bc : normalsThread._column.at(i))
+            if(normalsThread._N.at(bc.second).size())
+            {
+              normals.setBlock(i, bc.first);
+              if(!normals.N(i, bc.first).size())
+                normals.N(i, bc.first) = std::move(normalsThread._N.at(bc.second));
+              else
+                axpy(1., normalsThread._N.at(bc.second), normals.N(i, bc.first));
+            }
+        for(UInt i=0; i<nThread.size(); i++)
+          axpy(1., nThread.at(i), n.at(i));
+        lPl(0)   += lPlThread;
+        obsCount += obsCountThread;
+      });
+    };
+
+    auto eliminateEpochParameters = [&](UInt blockStart, UInt blockCount)
+    {
+      if(solveEpochParameters && !constraintsOnly)
+      {
+        regularizeNotUsedParameters(blockStart, blockCount);
+        normals.cholesky(FALSE, blockStart, blockCount, FALSE);
+        normals.triangularTransSolve(n, blockStart, blockCount, FALSE);
+        if(Parallel::isMaster(normalEquationInfo.comm))
+          for(UInt idBlock=blockStart; idBlock<blockStart+blockCount; idBlock++)
+          {
+            lPl(0)   -= quadsum(n.at(idBlock)); // lPl = lPl - n1' N1^(-1) n1
+            obsCount -= normals.blockSize(idBlock);
+          }
+      }
+
+      if(solveEpochParameters)
+      {
+        // remove N12 (epoch <-> other parameters)
+        for(UInt idBlock=blockStart; idBlock<blockStart+blockCount; idBlock++)
+          normals.loopBlockRow(idBlock, {normalEquationInfo.blockInterval(), normals.blockCount()}, [&](UInt /*k*/, UInt ik)
+          {
+            if(normals._N[ik].size())
+              normals._N[ik] = Matrix();
+          });
+      }
+    };
+
+    // block group in flight: reduction of the normals and elimination of the epoch parameters
+    std::function<void()> pending;
+    UInt pendingStart = 0;
+    UInt pendingCount = 0;
+    auto finishPending = [&]()
+    {
+      if(!pending)
+        return;
+      auto finish = std::move(pending);
+      pending = nullptr;
+      finish();
+    };
+
     logTimerStart;
     for(UInt idEpoch : normalEquationInfo.idEpochs)
     {
       logTimerLoop(idLoop++, normalEquationInfo.idEpochs.size());
 
-      gnss->constraintsEpoch(normalEquationInfo, idEpoch, normals, n, lPl(0), obsCount);
+      gnss->constraintsEpoch(normalEquationInfo, idEpoch, (reuseNormals ? normalsConstraints : normals), n, lPl(0), obsCount);
+
+      if(threaded)
+        chunkEpochs.push_back(idEpoch);
 
       // loop over all receivers
-      if(!constraintsOnly)
+      if(!constraintsOnly && !threaded)
         for(UInt idRecv=0; idRecv<gnss->receivers.size(); idRecv++)
           if(normalEquationInfo.estimateReceiver.at(idRecv) && gnss->receivers.at(idRecv)->isMyRank())
           {
             // all observation equations for this epoch
             UInt countEqn = 0;
+            Bool changedEpoch = FALSE;
             for(UInt idTrans=0; idTrans<gnss->receivers.at(idRecv)->idTransmitterSize(idEpoch); idTrans++)
               if(gnss->basicObservationEquations(normalEquationInfo, idRecv, idTrans, idEpoch, eqns.at(countEqn)))
               {
+                const Bool changed = reuseNormals && sigmaChanged(idRecv, eqns.at(countEqn));
+                if(changed)
+                {
+                  eqnsLast.at(countEqn) = eqns.at(countEqn);
+                  equationLast(idRecv, eqnsLast.at(countEqn));
+                  eqnsLast.at(countEqn).eliminateGroupParameters();
+                }
+                else if(reuseNormals)
+                  idxSigma.at(idRecv) += eqns.at(countEqn).sigma.rows();
+                else if(storeNormals)
+                  storeSigma(idRecv, eqns.at(countEqn));
+
                 eqns.at(countEqn).eliminateGroupParameters();
                 if(!normalEquationInfo.accumulateEpochObservations)
                 {
                   A.init(eqns.at(countEqn).l);
                   gnss->designMatrix(normalEquationInfo, eqns.at(countEqn), A);
-                  A.accumulateNormals(normals, n, lPl(0), obsCount);
+                  if(!reuseNormals)
+                    A.accumulateNormals(normals, n, lPl(0), obsCount);
+                  else
+                  {
+                    A.accumulateRightHandSide(n, lPl(0), obsCount);
+                    if(changed)
+                    {
+                      // replace the contribution of the last iteration
+                      A.accumulateNormalMatrix(normalsDelta, +1.);
+                      A.init(eqnsLast.at(countEqn).l);
+                      gnss->designMatrix(normalEquationInfo, eqnsLast.at(countEqn), A);
+                      A.accumulateNormalMatrix(normalsDelta, -1.);
+                    }
+                  }
                   obsCount -= eqns.at(countEqn).rankDeficit;
                 }
+                else if(!changed && reuseNormals)
+                  eqnsLast.at(countEqn) = eqns.at(countEqn); // unchanged part of the epoch
+                changedEpoch = changedEpoch || changed;
                 countEqn++;
               }
 
             if(normalEquationInfo.accumulateEpochObservations)
             {
               // copy all observations to a single vector
-              A.init(Vector(std::accumulate(eqns.begin(), eqns.end(), UInt(0), [](UInt count, auto &eqn) {return count+eqn.l.rows();})));
-              UInt idx=0;
-              for(UInt i=0; i<countEqn; i++)
+              auto designEpoch = [&](const std::vector<GnssObservationEquation> &eqnList)
+              {
+                A.init(Vector(std::accumulate(eqnList.begin(), eqnList.end(), UInt(0), [](UInt count, auto &eqn) {return count+eqn.l.rows();})));
+                UInt idx=0;
+                for(UInt i=0; i<countEqn; i++)
+                {
+                  copy(eqnList.at(i).l, A.l.row(idx, eqnList.at(i).l.rows()));
+                  gnss->designMatrix(normalEquationInfo, eqnList.at(i), A.selectRows(idx, eqnList.at(i).l.rows()));
+                  idx += eqnList.at(i).l.rows();
+                }
+                A.selectRows(0, 0); // select all
+              };
+
+              designEpoch(eqns);
+              if(!reuseNormals)
+                A.accumulateNormals(normals, n, lPl(0), obsCount);
+              else
               {
-                copy(eqns.at(i).l, A.l.row(idx, eqns.at(i).l.rows()));
-                gnss->designMatrix(normalEquationInfo, eqns.at(i), A.selectRows(idx, eqns.at(i).l.rows()));
-                idx += eqns.at(i).l.rows();
+                A.accumulateRightHandSide(n, lPl(0), obsCount);
+                if(changedEpoch)
+                {
+                  // replace the contribution of the last iteration
+                  A.accumulateNormalMatrix(normalsDelta, +1.);
+                  designEpoch(eqnsLast);
+                  A.accumulateNormalMatrix(normalsDelta, -1.);
+                }
               }
-              A.selectRows(0, 0); // select all
-              A.accumulateNormals(normals, n, lPl(0), obsCount);
               obsCount -= std::accumulate(eqns.begin(), eqns.end(), UInt(0), [](UInt count, auto &eqn) {return count+eqn.rankDeficit;});
             }
          } // for(idRecv)
 
+      // normals are collected at the end
+      if(reuseNormals)
+        continue;
+
       // perform following steps not every epoch
       blockCount += normalEquationInfo.blockCountEpoch(idEpoch);
       if((blockCount < normalEquationInfo.defaultBlockCountReduction) && (idEpoch != normalEquationInfo.idEpochs.back()))
         continue;
 
-      collectNormalsBlocks(blockStart, blockCount);
-
-      if(solveEpochParameters && !constraintsOnly)
+      if(threaded)
       {
-        regularizeNotUsedParameters(blockStart, blockCount);
-        normals.cholesky(FALSE, blockStart, blockCount, FALSE);
-        normals.triangularTransSolve(n, blockStart, blockCount, FALSE);
-        if(Parallel::isMaster(normalEquationInfo.comm))
-          for(UInt idBlock=blockStart; idBlock<blockStart+blockCount; idBlock++)
-          {
-            lPl(0)   -= quadsum(n.at(idBlock)); // lPl = lPl - n1' N1^(-1) n1
-            obsCount -= normals.blockSize(idBlock);
-          }
+        accumulateEpochsThreaded(chunkEpochs);
+        chunkEpochs.clear();
       }
 
-      if(solveEpochParameters)
+      // the last block group must be finished first, if its elimination changes the blocks of this group
+      Bool coupled = FALSE;
+      for(UInt idBlock=pendingStart; idBlock<pendingStart+pendingCount; idBlock++)
+        normals.loopBlockRow(idBlock, {blockStart, blockStart+blockCount}, [&](UInt /*k*/, UInt /*ik*/) {coupled = TRUE;});
+      if(coupled)
+        finishPending();
+
+      // the reduction of this group runs while the last group is eliminated and the next epochs are accumulated
+      auto collect = collectNormalsBlocksNonBlocking(blockStart, blockCount);
+      finishPending();
+      pending = [&, collect, start = blockStart, count = blockCount]()
       {
-        // remove N12 (epoch <-> other parameters)
-        for(UInt idBlock=blockStart; idBlock<blockStart+blockCount; idBlock++)
-          normals.loopBlockRow(idBlock, {normalEquationInfo.blockInterval(), normals.blockCount()}, [&](UInt /*k*/, UInt ik)
-          {
-            if(normals._N[ik].size())
-              normals._N[ik] = Matrix();
-          });
-      }
+        collect();
+        eliminateEpochParameters(start, count);
+      };
+      pendingStart = blockStart;
+      pendingCount = blockCount;
+      if(Parallel::size(normalEquationInfo.comm) <= 1)
+        finishPending();
 
       blockStart += blockCount;
       blockCount  = 0;
     } // for(idEpoch)
+    finishPending();
     Parallel::barrier(normalEquationInfo.comm);
     logTimerLoopEnd(normalEquationInfo.idEpochs.size());
 
     // other observations and constraints
     // ----------------------------------
-    gnss->constraints(normalEquationInfo, normals, n, lPl(0), obsCount);
+    gnss->constraints(normalEquationInfo, (reuseNormals ? normalsConstraints : normals), n, lPl(0), obsCount);
+
+    // add updates to the normal matrix of the last iteration
+    // ------------------------------------------------------
+    if(reuseNormals)
+    {
+      std::swap(normals, normalsDelta);
+      if(Parallel::size(normals.comm)>1)
+        collectNormalsBlocks(0, normals.blockCount()); // includes right hand side
+      std::swap(normals, normalsDelta);
+
+      for(UInt i=0; i<normalsDelta.blockCount(); i++)
+        normalsDelta.loopBlockRow(i, {i, normalsDelta.blockCount()}, [&](UInt k, UInt ik)
+        {
+          if(normals.index(i, k) == NULLINDEX)
+            normals.setBlock(i, k, normalsDelta._rank[ik]);
+          if(normals.rank(i, k) != normalsDelta._rank[ik])
+            throw(Exception("block ("+i%"%i, "s+k%"%i) is distributed differently"s));
+          if(normalsDelta.isMyRank(ik) && normalsDelta._N[ik].size())
+          {
+            if(!normals.N(i, k).size())
+              normals.N(i, k) = Matrix(normalsDelta._N[ik].rows(), normalsDelta._N[ik].columns());
+            axpy(1., normalsDelta._N[ik], normals.N(i, k));
+          }
+          normalsDelta._N[ik] = Matrix();
+        });
+
+      Parallel::reduceSum(countUpdatedEqn, 0, normalEquationInfo.comm);
+      logInfo<<"  "<<countUpdatedEqn<<" observation equations with changed weights updated"<<Log::endl;
+    }
 
     // collect normal equations
     // ------------------------
     if(Parallel::size(normals.comm)>1)
     {
-      logStatus<<"collect normal equations"<<Log::endl;
-      collectNormalsBlocks(blockStart, normals.blockCount()-blockStart);
+      if(!reuseNormals)
+      {
+        logStatus<<"collect normal equations"<<Log::endl;
+        collectNormalsBlocks(blockStart, normals.blockCount()-blockStart);
+      }
       Parallel::reduceSum(lPl,      0, normalEquationInfo.comm);
       Parallel::reduceSum(obsCount, 0, normalEquationInfo.comm);
     }
+
+    if(storeNormals)
+      normalsLast = normals;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void GnssProcessingStep::State::resetNormalsLast()
+{
+  try
+  {
+    normalsLast = MatrixDistributed();
+    sigmaNormalsLast.clear();
   }
   catch(std::exception &e)
   {
@@ -486,6 +830,7 @@ Double GnssProcessingStep::State::estimateSolution(const std::function<Vector(co
       // reconstruct N12
       // ---------------
       GnssDesignMatrix A(normalEquationInfo);
+      GnssObservationEquation eqn; // reused for all equations
       UInt idLoop = 0;
       logTimerStart;
       for(UInt idEpoch : normalEquationInfo.idEpochs)
@@ -493,7 +838,6 @@ Double GnssProcessingStep::State::estimateSolution(const std::function<Vector(co
         logTimerLoop(idLoop++, normalEquationInfo.idEpochs.size());
 
         // loop over all receivers
-        GnssObservationEquation eqn;
         for(UInt idRecv=0; idRecv<gnss->receivers.size(); idRecv++)
           if(normalEquationInfo.estimateReceiver.at(idRecv) && gnss->receivers.at(idRecv)->isMyRank())
             for(UInt idTrans=0; idTrans<gnss->receivers.at(idRecv)->idTransmitterSize(idEpoch); idTrans++)
@@ -602,6 +946,7 @@ Double GnssProcessingStep::State::estimateSolution(const std::function<Vector(co
     Parallel::barrier(normalEquationInfo.comm);
     logStatus<<"Compute residuals"<<Log::endl;
     GnssDesignMatrix A(normalEquationInfo);
+    GnssObservationEquation eqn; // reused for all equations
     UInt idLoop = 0;
     logTimerStart;
     for(UInt idEpoch : normalEquationInfo.idEpochs)
@@ -612,7 +957,6 @@ Double GnssProcessingStep::State::estimateSolution(const std::function<Vector(co
       for(UInt idRecv=0; idRecv<gnss->receivers.size(); idRecv++)
         if(normalEquationInfo.estimateReceiver.at(idRecv) && gnss->receivers.at(idRecv)->isMyRank())
         {
-          GnssObservationEquation eqn;
           for(UInt idTrans=0; idTrans<gnss->receivers.at(idRecv)->idTransmitterSize(idEpoch); idTrans++)
             if(gnss->basicObservationEquations(normalEquationInfo, idRecv, idTrans, idEpoch, eqn))
             {
@@ -27,8 +27,9 @@ Some steps such as \configClass{selectParametrizations}{gnssProcessingStepType:s
 \configClass{selectEpochs}{gnssProcessingStepType:selectEpochs},
 \configClass{selectNormalsBlockStructure}{gnssProcessingStepType:selectNormalsBlockStructure}, and
 \configClass{selectReceivers}{gnssProcessingStepType:selectReceivers} affect all subsequent steps.
-In case these steps are used within a \configClass{group}{gnssProcessingStepType:group} or
-\configClass{forEachReceiverSeparately}{gnssProcessingStepType:forEachReceiverSeparately} step,
+In case these steps are used within a \configClass{group}{gnssProcessingStepType:group},
+\configClass{forEachReceiverSeparately}{gnssProcessingStepType:forEachReceiverSeparately}, or
+\configClass{slidingWindow}{gnssProcessingStepType:slidingWindow} step,
 they only affect the steps within this level.
 
 For usage examples see cookbooks on \reference{GNSS satellite orbit determination and network analysis}{cookbook.gnssNetwork:processing}
@@ -78,13 +79,20 @@ public:
     UInt                               obsCount; // at master (after solve)
     std::vector<std::vector<GnssType>> sigmaType;
     std::vector<std::vector<Double>>   sigmaFactor; // for each receiver and type
+    // reuse of the normal matrix in the next iteration (see GnssProcessingStepEstimate)
+    Bool                               keepNormals;
+    Double                             thresholdSigmaNormals; // relative change of sigma to update an observation equation
+    MatrixDistributed                  normalsLast;           // normal matrix of the last buildNormals
+    std::vector<std::vector<Double>>   sigmaNormalsLast;      // for each receiver: sigmas of the observation equations in normalsLast
 
     /** @brief Constructor. */
     State(GnssPtr gnss, Parallel::CommunicatorPtr comm);
 
     void regularizeNotUsedParameters(UInt blockStart, UInt blockCount);
     void collectNormalsBlocks       (UInt blockStart, UInt blockCount);
+    std::function<void()> collectNormalsBlocksNonBlocking(UInt blockStart, UInt blockCount); // returned function waits for the reduction
     void buildNormals               (Bool constraintsOnly, Bool solveEpochParameters);
+    void resetNormalsLast           ();
     Double estimateSolution         (const std::function<Vector(const_MatrixSliceRef xFloat, MatrixSliceRef W, const_MatrixSliceRef d, Vector &xInt, Double &sigma)> &searchInteger,
                                      Bool computeResiduals,  Bool computeWeights, Bool adjustSigma0, Double huber, Double huberPower);
     void residualsStatistics        (UInt idRecv, UInt idTrans,
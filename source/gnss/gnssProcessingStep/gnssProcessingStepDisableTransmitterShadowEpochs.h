@@ -108,23 +108,36 @@ inline void GnssProcessingStepDisableTransmitterShadowEpochs::process(GnssProces
           }
         }
 
-        Double factorPreviousEpoch = 1.0;
+        // eclipse factors of all useable epochs
+        std::vector<UInt>     idEpochs;
+        std::vector<Time>     times;
+        std::vector<Vector3d> positions;
         for(UInt idEpoch=0; idEpoch<state.gnss->times.size(); idEpoch++)
           if(trans->useable(idEpoch))
           {
-            const Double factor = eclipse->factor(state.gnss->times.at(idEpoch), trans->positionCoM(state.gnss->times.at(idEpoch)), ephemerides);
-            if((factorPreviousEpoch < 0.5) && (factor >= 0.5))
-              timeShadowExit = state.gnss->times.at(idEpoch);
+            idEpochs.push_back(idEpoch);
+            times.push_back(state.gnss->times.at(idEpoch));
+            positions.push_back(trans->positionCoM(state.gnss->times.at(idEpoch)));
+          }
+        const Vector factors = eclipse->factors(times, positions, ephemerides);
 
-            // set satellite unuseable during shadow crossing and post-shadow recovery maneuver
-            if((disableShadowEpochs && factor < 0.5) || (disablePostShadowEpochs && state.gnss->times.at(idEpoch) < timeShadowExit+recoveryTime))
-            {
-              trans->disable(idEpoch);
-              countEpochs++;
-            }
+        Double factorPreviousEpoch = 1.0;
+        for(UInt i=0; i<idEpochs.size(); i++)
+        {
+          const UInt   idEpoch = idEpochs.at(i);
+          const Double factor  = factors(i);
+          if((factorPreviousEpoch < 0.5) && (factor >= 0.5))
+            timeShadowExit = state.gnss->times.at(idEpoch);
+
+          // set satellite unuseable during shadow crossing and post-shadow recovery maneuver
+          if((disableShadowEpochs && factor < 0.5) || (disablePostShadowEpochs && state.gnss->times.at(idEpoch) < timeShadowExit+recoveryTime))
+          {
+            trans->disable(idEpoch);
+            countEpochs++;
+          }
 
-            factorPreviousEpoch = factor;
-          } // for(idEpoch)
+          factorPreviousEpoch = factor;
+        } // for(idEpoch)
       }
 
     if(countEpochs)
@@ -60,6 +60,15 @@ separately
 \begin{equation}
   \hat{\sigma}_{[\tau\nu a]}^{recv} = \sqrt{\frac{\hat{\M\epsilon}^T\M P\hat{\M\epsilon}}{r}}.
 \end{equation}
+
+With \config{incrementalNormals} the normal matrix of the previous iteration is reused.
+The right hand side is computed from scratch, but only observation equations whose
+accuracies have changed by more than the relative \config{sigmaThreshold} are updated
+in the normal matrix (old contribution removed, new one added). The normal matrix is
+rebuilt completely if the parameter changes of the previous iteration exceed \config{maxParameterChange},
+as the linearization point of the design matrix is then too different.
+This requires \config{keepEpochNormalsInMemory} in \configClass{selectNormalsBlockStructure}{gnssProcessingStepType:selectNormalsBlockStructure}
+and doubles the memory of the normal matrix.
 )";
 #endif
 
@@ -79,6 +88,8 @@ class GnssProcessingStepEstimate : public GnssProcessingStepBase
   Double huber, huberPower;
   Double convergenceThreshold;
   UInt   iterCount;
+  Bool   incrementalNormals;
+  Double sigmaThreshold, maxParameterChange;
 
 public:
   GnssProcessingStepEstimate(Config &config);
@@ -98,6 +109,13 @@ inline GnssProcessingStepEstimate::GnssProcessingStepEstimate(Config &config)
     readConfig(config, "huberPower",           huberPower,           Config::DEFAULT, "1.5",  "residuals > huber: sigma=(e/huber)^huberPower*sigma0");
     readConfig(config, "convergenceThreshold", convergenceThreshold, Config::DEFAULT, "0.01", "[m] stop iteration once full convergence is reached");
     readConfig(config, "maxIterationCount",    iterCount,            Config::DEFAULT, "3",    "maximum number of iterations");
+    incrementalNormals = readConfigSequence(config, "incrementalNormals", Config::OPTIONAL, "", "reuse normal matrix of the previous iteration");
+    if(incrementalNormals)
+    {
+      readConfig(config, "sigmaThreshold",     sigmaThreshold,     Config::DEFAULT, "0.05", "update observation equations with larger relative change of sigma");
+      readConfig(config, "maxParameterChange", maxParameterChange, Config::DEFAULT, "1.0",  "[m] rebuild normal matrix if the last iteration changed parameters more");
+      endSequence(config);
+    }
   }
   catch(std::exception &e)
   {
@@ -112,12 +130,20 @@ inline void GnssProcessingStepEstimate::process(GnssProcessingStep::State &state
   try
   {
     logStatus<<"=== estimate ================================================"<<Log::endl;
+    state.keepNormals           = incrementalNormals;
+    state.thresholdSigmaNormals = sigmaThreshold;
+    state.resetNormalsLast();
     for(UInt iter=0; iter<iterCount; iter++)
     {
       logStatus<<iter+1<<". iteration  --------------------------"<<Log::endl;
-      if(convergenceThreshold > state.estimateSolution(nullptr/*resolveAmbiguities*/, computeResiduals, computeWeights, adjustSigma0, huber, huberPower))
+      const Double maxChange = state.estimateSolution(nullptr/*resolveAmbiguities*/, computeResiduals, computeWeights, adjustSigma0, huber, huberPower);
+      if(incrementalNormals && (maxChange > maxParameterChange))
+        state.resetNormalsLast(); // linearization point changed too much
+      if(convergenceThreshold > maxChange)
         break;
     }
+    state.keepNormals = FALSE;
+    state.resetNormalsLast();
   }
   catch(std::exception &e)
   {
@@ -25,6 +25,11 @@ During \reference{GNSS satellite orbit determination and network analysis}{cookb
 initial processing of the core network to process all other stations individually. In that case provide the same station list as
 \configFile{inputfileExcludeStationList}{stringList} in this step that was used as \configFile{inputfileStationList}{stringList} in the
 \configClass{selectReceivers}{gnssProcessingStepType:selectReceivers} step where the core network was selected.
+
+The receivers are independent problems. Each receiver is processed by the process which holds its observations
+with a process local communicator, so no communication between the processes is needed
+and the run time scales with the number of processes.
+The results of all receivers are only gathered at the end of this step.
 )";
 #endif
 
@@ -92,6 +97,8 @@ inline void GnssProcessingStepForEachReceiverSeparately::process(GnssProcessingS
     state.normalEquationInfo.comm = Parallel::createCommunicator({Parallel::myRank(state.normalEquationInfo.comm)}, state.normalEquationInfo.comm);
     state.normalEquationInfo.isEachReceiverSeparately = TRUE;
 
+    // each process handles its own receivers without any communication
+    UInt countProcessed = 0, countFailed = 0;
     for(UInt idRecv=0; idRecv<state.gnss->receivers.size(); idRecv++)
       if(estimateSingleReceiver.at(idRecv) && state.gnss->receivers.at(idRecv)->isMyRank())
       {
@@ -108,12 +115,14 @@ inline void GnssProcessingStepForEachReceiverSeparately::process(GnssProcessingS
           GnssProcessingStepPtr processingSteps;
           configProcessingSteps.read(processingSteps, varList);
           processingSteps->process(state);
+          countProcessed++;
         }
         catch(std::exception &e)
         {
           logError<<state.gnss->receivers.at(idRecv)->name()<<": disabled due to exception in single receiver loop:"<<Log::endl;
           logError<<e.what()<<Log::endl;
           state.gnss->receivers.at(idRecv)->disable();
+          countFailed++;
         }
       } // for(idRecv)
 
@@ -121,10 +130,11 @@ inline void GnssProcessingStepForEachReceiverSeparately::process(GnssProcessingS
     std::swap(state.normalEquationInfo, normalEquationInfoOld);
     state.changedNormalEquationInfo = TRUE;
 
-    // synchronize transceivers
+    // gather results: synchronize transceivers
     state.gnss->synchronizeTransceivers(state.normalEquationInfo.comm);
-
-    Parallel::barrier(state.normalEquationInfo.comm);
+    Parallel::reduceSum(countProcessed, 0, state.normalEquationInfo.comm);
+    Parallel::reduceSum(countFailed,    0, state.normalEquationInfo.comm);
+    logInfo<<"  "<<countProcessed<<" receivers processed, "<<countFailed<<" receivers disabled"<<Log::endl;
   }
   catch(std::exception &e)
   {
@@ -20,6 +20,8 @@ static const char *docstringGnssProcessingStepResolveAmbiguities = R"(
 Performs a least squares adjustment like \configClass{processingStep:estimate}{gnssProcessingStepType:estimate}
 but with additional integer phase ambiguity resolution.
 After this step all resolved ambiguities are removed from the normal equation system.
+Therefore a subsequent ResolveAmbiguities step (e.g. after outlier downweighting) keeps the already
+fixed ambiguities and decorrelates and searches only the remaining float ambiguities.
 
 Integer ambiguity resolution is performed based on the least squares ambiguity decorrelation adjustment
 (LAMBDA) method (Teunissen 1995, DOI \href{https://doi.org/10.1007/BF00863419}{10.1007/BF00863419}), specifically
@@ -35,6 +35,11 @@ If \config{keepEpochNormalsInMemory}=\verb|no| epoch blocks are eliminated after
 of parameters in the normal equation system. \config{defaultBlockCountReduction} controls after how many epoch blocks
 an elimination step is performed. For larger processing setups or high sampling rates epoch block elimination is recommended
 as the large number of clock parameters require a lot of memory.
+The epoch parameters (e.g. receiver and transmitter clocks) are eliminated by the Schur complement
+into the interval and ambiguity parts directly during the accumulation. Only the decomposed diagonal
+epoch blocks are kept, the coupling with the other parameters is set up again from the observations
+for the back substitution after the solve. With \config{defaultBlockCountReduction}=\verb|1|
+each epoch is eliminated immediately and the memory is dominated by the interval and ambiguity parts.
 )";
 #endif
 
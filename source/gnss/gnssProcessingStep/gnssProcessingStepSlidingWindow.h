@@ -0,0 +1,137 @@
+/***********************************************/
+/**
+* @file gnssProcessingStepSlidingWindow.h
+*
+* @brief GNSS processing step: SlidingWindow.
+*
+* @author GROOPS Developers
+* @date 2026-10-14
+*
+*/
+/***********************************************/
+
+#ifndef __GROOPS_GNSSPROCESSINGSTEPSLIDINGWINDOW__
+#define __GROOPS_GNSSPROCESSINGSTEPSLIDINGWINDOW__
+
+// Latex documentation
+#ifdef DOCSTRING_GnssProcessingStep
+static const char *docstringGnssProcessingStepSlidingWindow = R"(
+\subsection{SlidingWindow}\label{gnssProcessingStepType:slidingWindow}
+Perform these processing steps for a time window of \config{windowLength} seconds,
+which is shifted by \config{windowShift} seconds through the selected epochs.
+Only the epochs within the window are used in the processing steps, so epoch parameters
+(e.g. clocks) are only set up within the window. All other parameters start with the
+solution of the previous window as apriori values.
+
+This step can be used to generate near real-time products (e.g. clocks and orbits)
+from the latest data without reprocessing the full batch. The variables \config{variableLoopTimeStart}
+and \config{variableLoopTimeEnd} are set for each window and can be used in the output file names
+of \configClass{writeResults}{gnssProcessingStepType:writeResults}.
+)";
+#endif
+
+/***********************************************/
+
+#include "config/config.h"
+#include "gnss/gnssProcessingStep/gnssProcessingStep.h"
+
+/***** CLASS ***********************************/
+
+/** @brief GNSS processing step: SlidingWindow.
+* @ingroup gnssProcessingStepGroup
+* @see GnssProcessingStep */
+class GnssProcessingStepSlidingWindow : public GnssProcessingStepBase
+{
+  Double      windowLength, windowShift;
+  std::string nameTimeStart, nameTimeEnd, nameIndex;
+  Config      configProcessingSteps;
+
+public:
+  GnssProcessingStepSlidingWindow(Config &config);
+  void process(GnssProcessingStep::State &state) override;
+  Bool expectInitializedParameters() const override {return FALSE;}
+};
+
+/***********************************************/
+
+inline GnssProcessingStepSlidingWindow::GnssProcessingStepSlidingWindow(Config &config)
+{
+  try
+  {
+    GnssProcessingStepPtr processingSteps;
+
+    readConfig(config, "windowLength",          windowLength,  Config::MUSTSET,  "86400",       "[seconds] length of each time window");
+    readConfig(config, "windowShift",           windowShift,   Config::MUSTSET,  "3600",        "[seconds] shift of the window between the iterations");
+    readConfig(config, "variableLoopTimeStart", nameTimeStart, Config::OPTIONAL, "loopTime",    "variable with starting time of each window");
+    readConfig(config, "variableLoopTimeEnd",   nameTimeEnd,   Config::OPTIONAL, "loopTimeEnd", "variable with ending time of each window");
+    readConfig(config, "variableLoopIndex",     nameIndex,     Config::OPTIONAL, "",            "variable with index of current window (starts with zero)");
+    readConfigLater(config, "processingStep", processingSteps, configProcessingSteps, Config::MUSTSET, "", "steps are processed consecutively");
+    if(isCreateSchema(config)) return;
+
+    if((windowLength <= 0) || (windowShift <= 0))
+      throw(Exception("windowLength and windowShift must be positive"));
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+inline void GnssProcessingStepSlidingWindow::process(GnssProcessingStep::State &state)
+{
+  try
+  {
+    logStatus<<"=== sliding window =========================================="<<Log::endl;
+    GnssNormalEquationInfo normalEquationInfoOld = state.normalEquationInfo;
+    const std::vector<UInt> idEpochs = state.normalEquationInfo.idEpochs;
+    if(!idEpochs.size())
+      return;
+    const Time timeFirst = state.gnss->times.at(idEpochs.front());
+    const Time timeLast  = state.gnss->times.at(idEpochs.back());
+
+    for(UInt idWindow=0; ; idWindow++)
+    {
+      const Time timeStart = timeFirst + seconds2time(idWindow*windowShift);
+      const Time timeEnd   = timeStart + seconds2time(windowLength);
+      if(timeStart > timeLast)
+        break;
+
+      state.normalEquationInfo.idEpochs.clear();
+      for(UInt idEpoch : idEpochs)
+        if((timeStart <= state.gnss->times.at(idEpoch)) && (state.gnss->times.at(idEpoch) < timeEnd))
+          state.normalEquationInfo.idEpochs.push_back(idEpoch);
+
+      if(state.normalEquationInfo.idEpochs.size())
+      {
+        logStatus<<"=== window "<<timeStart.dateTimeStr()<<" - "<<timeEnd.dateTimeStr()<<" ("<<state.normalEquationInfo.idEpochs.size()<<" epochs) ==="<<Log::endl;
+        state.changedNormalEquationInfo = TRUE;
+
+        VariableList varList;
+        if(!nameTimeStart.empty()) addVariable(nameTimeStart, timeStart.mjd(), varList);
+        if(!nameTimeEnd.empty())   addVariable(nameTimeEnd,   timeEnd.mjd(),   varList);
+        if(!nameIndex.empty())     addVariable(nameIndex,     idWindow,        varList);
+
+        GnssProcessingStepPtr processingSteps;
+        configProcessingSteps.read(processingSteps, varList);
+        processingSteps->process(state);
+      }
+
+      if(timeEnd > timeLast) // last window reached the end
+        break;
+    }
+
+    // restore old state
+    std::swap(state.normalEquationInfo, normalEquationInfoOld);
+    state.changedNormalEquationInfo = TRUE;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+#endif
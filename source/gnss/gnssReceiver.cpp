@@ -13,6 +13,7 @@
 /***********************************************/
 
 #include <random>
+#include <mutex>
 #include "base/import.h"
 #include "base/string.h"
 #include "parser/expressionParser.h"
@@ -20,6 +21,7 @@
 #include "files/fileInstrument.h"
 #include "inputOutput/logging.h"
 #include "misc/varianceComponentEstimation.h"
+#include "parallel/threadPool.h"
 #include "gnss/gnssLambda.h"
 #include "gnss/gnssObservation.h"
 #include "gnss/gnssTransmitter.h"
@@ -30,7 +32,7 @@
 GnssReceiver::GnssReceiver(Bool isMyRank, Bool isEarthFixed, const std::string &name, const GnssStationInfo &info,
                            GnssAntennaDefinition::NoPatternFoundAction noPatternFoundAction, const Vector &useableEpochs,
                            Bool integerAmbiguities, Double wavelengthFactor)
-  : GnssTransceiver(name, info, noPatternFoundAction, useableEpochs), isMyRank_(isMyRank),
+  : GnssTransceiver(name, info, noPatternFoundAction, useableEpochs), memoryObservations("observations"), isMyRank_(isMyRank),
     isEarthFixed_(isEarthFixed), integerAmbiguities(integerAmbiguities), wavelengthFactor(wavelengthFactor)
 {
 }
@@ -49,6 +51,9 @@ void GnssReceiver::disable(UInt idEpoch)
       isMyRank_ = FALSE;
       obsMem.clear();
       obsMem.shrink_to_fit();
+      singleObsMem.clear();
+      singleObsMem.shrink_to_fit();
+      memoryObservations.set(0);
       observations_.clear();
       observations_.shrink_to_fit();
       tracks.clear();
@@ -62,6 +67,16 @@ void GnssReceiver::disable(UInt idEpoch)
 
 /***********************************************/
 
+UInt GnssReceiver::countObservations() const
+{
+  UInt count = 0;
+  for(const auto &obs : obsMem)
+    count += obs.size();
+  return count;
+}
+
+/***********************************************/
+
 GnssObservation *GnssReceiver::observation(UInt idTrans, UInt idEpoch) const
 {
   if((idEpoch < observations_.size()) && (idTrans < observations_.at(idEpoch).size()))
@@ -93,6 +108,18 @@ void GnssReceiver::signalComposition(UInt /*idEpoch*/, const std::vector<GnssTyp
 {
   try
   {
+    // composition depends only on the types -> computed once for each combination of types
+    {
+      std::lock_guard<std::mutex> lock(mutexCompositions);
+      auto iter = compositions.find(types);
+      if(iter != compositions.end())
+      {
+        typesTrans = iter->second.first;
+        A          = iter->second.second;
+        return;
+      }
+    }
+
     // composed type = factor1 * type1 + factor2 * type2
     static const std::vector<std::tuple<GnssType, GnssType, GnssType, Double, Double>> composites =
       {{GnssType::C1XG,  GnssType::C1SG, GnssType::C1LG, 0.5, 0.5},
@@ -168,6 +195,9 @@ void GnssReceiver::signalComposition(UInt /*idEpoch*/, const std::vector<GnssTyp
 
         throw(Exception("composite signal not implemented: "+type.str()));
       } // for(idType)
+
+    std::lock_guard<std::mutex> lock(mutexCompositions);
+    compositions[types] = std::make_pair(typesTrans, A);
   }
   catch(std::exception &e)
   {
@@ -224,6 +254,31 @@ void GnssReceiver::ObservationEquationList::deleteObservationEquation(UInt idTra
     eqn[idEpoch][idTrans] = nullptr;
 }
 
+/***********************************************/
+
+// the single observations of all epochs are stored sequentially in one memory block
+// instead of a separate allocation for each observation
+void GnssReceiver::packObservations()
+{
+  try
+  {
+    UInt count = 0;
+    for(const auto &obs : obsMem)
+      count += obs.size();
+    singleObsMem.clear();
+    singleObsMem.resize(count);
+    singleObsMem.shrink_to_fit();
+    GnssSingleObservation *memory = singleObsMem.data();
+    for(auto &obs : obsMem)
+      memory = obs.pack(memory);
+    memoryObservations.set(obsMem.capacity()*sizeof(GnssObservation) + singleObsMem.capacity()*sizeof(GnssSingleObservation));
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
 /***********************************************/
 /***********************************************/
 
@@ -233,41 +288,55 @@ void GnssReceiver::readObservations(const FileName &fileName, const std::vector<
 {
   try
   {
-    GnssReceiverArc arc = InstrumentFile::read(fileName);
+    InstrumentFile file(fileName);
+    if(file.arcCount() && (file.getType() != Epoch::GNSSRECEIVER))
+      throw(Exception(fileName.str()+": instrument type "+file.getTypeName()+" is not GNSSRECEIVER"));
 
     std::vector<Time> observationTimes;
     Vector phaseWindup(transmitters.size());
     std::map<GnssType, UInt> removedTypes;
+    std::map<GnssType, UInt> indexTransmitter; // satellite number (PRN) -> idTrans
+    std::vector<std::pair<UInt, UInt>> indexObs; // (idEpoch, idTrans) of obsMem
+    obsMem.clear();
 
+    // the epochs are processed directly after reading (without storing the whole file),
+    // reading is stopped after the last epoch
     UInt idEpoch = 0;
-    for(UInt arcEpoch=0; arcEpoch<arc.size(); arcEpoch++)
+    auto processEpoch = [&](const Epoch &epochArc)
     {
+      const GnssReceiverEpoch &epoch = static_cast<const GnssReceiverEpoch&>(epochArc);
+
       // search time slot
-      while((idEpoch < times.size()) && (times.at(idEpoch)+timeMargin < arc.at(arcEpoch).time))
+      while((idEpoch < times.size()) && (times.at(idEpoch)+timeMargin < epoch.time))
         disable(idEpoch++);
       if(idEpoch >= times.size())
-        break;
-      if((arc.at(arcEpoch).time+timeMargin < times.at(idEpoch)) || !useable(idEpoch))
-        continue;
-      times.at(idEpoch) = arc.at(arcEpoch).time;
-//    clk.at(idEpoch)   = arc.at(arcEpoch).clockError;
-      observationTimes.push_back(arc.at(arcEpoch).time);
+        return FALSE;
+      if((epoch.time+timeMargin < times.at(idEpoch)) || !useable(idEpoch))
+        return TRUE;
+      times.at(idEpoch) = epoch.time;
+//    clk.at(idEpoch)   = epoch.clockError;
+      observationTimes.push_back(epoch.time);
 
       const std::vector<GnssType> receiverTypes = definedTypes(times.at(idEpoch));
 
       // create observation class for each satellite
       UInt idObs  = 0;
-      for(UInt k=0; k<arc.at(arcEpoch).satellite.size(); k++)
+      Bool hasObs = FALSE;
+      GnssObservation obs;
+      for(UInt k=0; k<epoch.satellite.size(); k++)
       {
         // find list of observation types for this satellite
-        GnssType satType = arc.at(arcEpoch).satellite.at(k);
+        GnssType satType = epoch.satellite.at(k);
         UInt idType = 0;
-        while(arc.at(arcEpoch).obsType.at(idType) != satType)
+        while(epoch.obsType.at(idType) != satType)
           idType++;
 
         // search transmitter index for satellite number (PRN)
-        const UInt idTrans = std::distance(transmitters.begin(), std::find_if(transmitters.begin(), transmitters.end(),
-                                                                              [&](auto t) {return t->PRN() == satType;}));
+        auto iter = indexTransmitter.find(satType);
+        if(iter == indexTransmitter.end())
+          iter = indexTransmitter.insert(std::make_pair(satType, std::distance(transmitters.begin(), std::find_if(transmitters.begin(), transmitters.end(),
+                                                                                  [&](auto t) {return t->PRN() == satType;})))).first;
+        const UInt idTrans = iter->second;
         std::vector<GnssType> transmitterTypes;
         if(idTrans < transmitters.size())
           transmitterTypes = transmitters.at(idTrans)->definedTypes(times.at(idEpoch));
@@ -276,11 +345,11 @@ void GnssReceiver::readObservations(const FileName &fileName, const std::vector<
         if((satType == GnssType::GLONASS) && transmitterTypes.size() && (transmitterTypes.front().frequencyNumber() != 9999))
           satType.setFrequencyNumber(transmitterTypes.front().frequencyNumber());
 
-        GnssObservation *obs = new GnssObservation();
-        for(; (idType<arc.at(arcEpoch).obsType.size()) && (arc.at(arcEpoch).obsType.at(idType)==satType); idType++, idObs++)
-          if((idTrans < transmitters.size()) && arc.at(arcEpoch).observation.at(idObs)  && !std::isnan(arc.at(arcEpoch).observation.at(idObs)))
+        obs = GnssObservation();
+        for(; (idType<epoch.obsType.size()) && (epoch.obsType.at(idType)==satType); idType++, idObs++)
+          if((idTrans < transmitters.size()) && epoch.observation.at(idObs)  && !std::isnan(epoch.observation.at(idObs)))
           {
-            GnssType type = arc.at(arcEpoch).obsType.at(idType) + satType;
+            GnssType type = epoch.obsType.at(idType) + satType;
             // remove GLONASS frequency number
             if((type == GnssType::GLONASS) && !((type == GnssType::G1) || (type == GnssType::G2)))
               type.setFrequencyNumber(9999);
@@ -324,32 +393,34 @@ void GnssReceiver::readObservations(const FileName &fileName, const std::vector<
                 }
 
             if(use)
-              obs->push_back(GnssSingleObservation(type, arc.at(arcEpoch).observation.at(idObs)));
+              obs.push_back(GnssSingleObservation(type, epoch.observation.at(idObs)));
           }
 
         std::vector<GnssType> types;
-        if((obs->size() == 0) || (idTrans >= transmitters.size()) ||
-           !obs->init(*this, *transmitters.at(idTrans), rotationCrf2Trf, idEpoch, elevationCutOff, phaseWindup(idTrans)) ||
-           !obs->observationList(group, types))
-        {
-          delete obs;
+        if((obs.size() == 0) || (idTrans >= transmitters.size()) ||
+           !obs.init(*this, *transmitters.at(idTrans), rotationCrf2Trf, idEpoch, elevationCutOff, phaseWindup(idTrans)) ||
+           !obs.observationList(group, types))
           continue;
-        }
 
         if(observations_.size() <= idEpoch)
           observations_.resize(idEpoch+1);
         if(observations_.at(idEpoch).size() <= idTrans)
           observations_.at(idEpoch).resize(idTrans+1, nullptr);
-        if(observations_[idEpoch][idTrans])
-          logWarning<<"observation already exists"<<Log::endl;
-        std::swap(observations_[idEpoch][idTrans], obs);
-        delete obs;
+        obs.shrink_to_fit();
+        obsMem.push_back(std::move(obs));
+        indexObs.push_back(std::make_pair(idEpoch, idTrans));
+        hasObs = TRUE;
       } // for(satellite)
 
-      if((observations_.size() <= idEpoch) || (observations_[idEpoch].size() == 0))
+      if(!hasObs)
         disable(idEpoch);
       idEpoch++;
-    } // for(arcEpoch)
+      return TRUE;
+    };
+
+    for(UInt arcNo=0; (arcNo<file.arcCount()) && (idEpoch<times.size()); arcNo++)
+      file.readArc(arcNo, processEpoch);
+    file.close();
 
     for(UInt idEpoch=observations_.size(); idEpoch<times.size(); idEpoch++)
       disable(idEpoch);
@@ -366,27 +437,17 @@ void GnssReceiver::readObservations(const FileName &fileName, const std::vector<
     // ---------------
     observationSampling = medianSampling(observationTimes).seconds();
 
-    // Copy observations to a continuous memory block
-    // ----------------------------------------------
-    // count observations
-    UInt count = 0;
-    for(const auto &obsEpoch : observations_)
-      for(const GnssObservation *obs : obsEpoch)
-        if(obs)
-          count++;
-    obsMem.resize(count);
+    // observations are stored in a continuous memory block
+    // ----------------------------------------------------
     obsMem.shrink_to_fit();
-    // copy
-    count = 0;
-    for(auto &obsEpoch : observations_)
-      for(GnssObservation *&obs : obsEpoch)
-        if(obs)
-        {
-          obsMem.at(count) = *obs;
-          obsMem.at(count).shrink_to_fit();
-          delete obs;
-          obs = &obsMem.at(count++);
-        }
+    for(UInt i=0; i<obsMem.size(); i++)
+    {
+      GnssObservation *&obs = observations_[indexObs[i].first][indexObs[i].second];
+      if(obs)
+        logWarning<<"observation already exists"<<Log::endl;
+      obs = &obsMem[i];
+    }
+    packObservations();
   }
   catch(std::exception &e)
   {
@@ -413,6 +474,22 @@ void GnssReceiver::simulateObservations(const std::vector<GnssType> &types,
       if(useable(idEpoch))
         updateClockError(idEpoch, clock(idEpoch)/LIGHT_VELOCITY);
 
+    // the rotation only depends on the receiver time of the epoch
+    // and is computed once for all transmitters of the epoch
+    Time     timeRotation;
+    Rotary3d rotation;
+    Bool     isRotation = FALSE;
+    auto rotationCrf2TrfEpoch = [&](const Time &time)
+    {
+      if(!isRotation || (time != timeRotation))
+      {
+        rotation     = rotationCrf2Trf(time);
+        timeRotation = time;
+        isRotation   = TRUE;
+      }
+      return rotation;
+    };
+
     // Simulate zero observations
     // --------------------------
     Vector phaseWindup(transmitters.size());
@@ -484,7 +561,7 @@ void GnssReceiver::simulateObservations(const std::vector<GnssType> &types,
 
         std::vector<GnssType> types;
         if((obs->size() == 0) || (idTrans >= transmitters.size()) ||
-           !obs->init(*this, *transmitters.at(idTrans), rotationCrf2Trf, idEpoch, elevationCutOff, phaseWindup(idTrans)) ||
+           !obs->init(*this, *transmitters.at(idTrans), rotationCrf2TrfEpoch, idEpoch, elevationCutOff, phaseWindup(idTrans)) ||
            !obs->observationList(group, types))
         {
           delete obs;
@@ -530,6 +607,7 @@ void GnssReceiver::simulateObservations(const std::vector<GnssType> &types,
           delete obs;
           obs = &obsMem.at(count++);
         }
+    packObservations();
 
     // ambiguities
     // -----------
@@ -569,13 +647,18 @@ void GnssReceiver::simulateObservations(const std::vector<GnssType> &types,
 
     // reduced observations
     // --------------------
-    ObservationEquationList eqnList(*this, transmitters, rotationCrf2Trf, reduceModels, group);
+    ObservationEquationList eqnList(*this, transmitters, rotationCrf2TrfEpoch, reduceModels, group);
     removeLowElevationTracks(eqnList, elevationTrackMinimum);
 
+    // obs noise of all transmitters in one call
+    std::vector<UInt> columnTrans(transmitters.size()+1, 0);
+    for(UInt idTrans=0; idTrans<transmitters.size(); idTrans++)
+      columnTrans.at(idTrans+1) = columnTrans.at(idTrans) + typesTrans.at(idTrans).size();
+    const Matrix noise = columnTrans.back() ? noiseObs->noise(times.size(), columnTrans.back()) : Matrix();
+
     for(UInt idTrans=0; idTrans<transmitters.size(); idTrans++)
       if(typesTrans.at(idTrans).size())
       {
-        const Matrix eps = noiseObs->noise(times.size(), typesTrans.at(idTrans).size()); // obs noise
         UInt idx;
         for(UInt idEpoch=0; idEpoch<times.size(); idEpoch++)
           if(eqnList(idTrans, idEpoch))
@@ -584,7 +667,7 @@ void GnssReceiver::simulateObservations(const std::vector<GnssType> &types,
             GnssObservation *obs = observation(idTrans, idEpoch);
             for(UInt idType=0; idType<obs->size(); idType++)
               if(obs->at(idType).type.isInList(eqn.types, idx))
-                obs->at(idType).observation = -eqn.l(idx) + eqn.sigma(idx) * eps(idEpoch, GnssType::index(typesTrans.at(idTrans), obs->at(idType).type));
+                obs->at(idType).observation = -eqn.l(idx) + eqn.sigma(idx) * noise(idEpoch, columnTrans.at(idTrans)+GnssType::index(typesTrans.at(idTrans), obs->at(idType).type));
           }
       }
   }
@@ -1106,9 +1189,40 @@ void GnssReceiver::cycleSlipsDetection(ObservationEquationList &eqnList, UInt mi
 {
   try
   {
+    // the linear combinations of the existing tracks are independent
+    // and analyzed in parallel threads, the tracks are split afterwards
+    class TrackSlips
+    {
+    public:
+      std::vector<GnssType> typesPhase;
+      std::vector<UInt>     idEpochs;
+      Vector                slips;
+      Double                cycles2tecu;
+    };
+
+    const std::vector<GnssTrackPtr> tracksOld = tracks; // keeps the tracks alive (unique pointers in index)
+    std::vector<TrackSlips> trackSlips(tracksOld.size());
+    std::map<const GnssTrack*, UInt> index;
+    for(UInt i=0; i<tracksOld.size(); i++)
+      if(tracksOld.at(i)->countObservations() >= std::max(minObsCountPerTrack, windowSize))
+        index[tracksOld.at(i).get()] = i;
+    Parallel::threadLoop(0, tracksOld.size(), [&](UInt i)
+    {
+      if(index.count(tracksOld.at(i).get()))
+        cycleSlipsLinearCombinations(eqnList, tracksOld.at(i), lambda, extraTypes,
+                                     trackSlips.at(i).typesPhase, trackSlips.at(i).idEpochs, trackSlips.at(i).slips, trackSlips.at(i).cycles2tecu);
+    });
+
     for(UInt idTrack=0; idTrack<tracks.size(); idTrack++)
     {
-      if(tracks.at(idTrack)->countObservations() >= std::max(minObsCountPerTrack, windowSize))
+      auto iter = index.find(tracks.at(idTrack).get());
+      if(iter != index.end())
+      {
+        TrackSlips &s = trackSlips.at(iter->second);
+        cycleSlipsDetection(eqnList, tracks.at(idTrack), windowSize, tecSigmaFactor, extraTypes, s.typesPhase, s.idEpochs, s.slips, s.cycles2tecu);
+        index.erase(iter);
+      }
+      else if(tracks.at(idTrack)->countObservations() >= std::max(minObsCountPerTrack, windowSize)) // new tracks from splitting
         cycleSlipsDetection(eqnList, tracks.at(idTrack), lambda, windowSize, tecSigmaFactor, extraTypes);
       if(tracks.at(idTrack)->countObservations() < minObsCountPerTrack)
         deleteTrack(eqnList, idTrack--);
@@ -1122,29 +1236,56 @@ void GnssReceiver::cycleSlipsDetection(ObservationEquationList &eqnList, UInt mi
 
 /***********************************************/
 
-void GnssReceiver::cycleSlipsDetection(ObservationEquationList &eqnList, GnssTrackPtr track, Double lambda, UInt windowSize, Double tecSigmaFactor, const std::vector<GnssType> &extraTypes)
+void GnssReceiver::cycleSlipsLinearCombinations(ObservationEquationList &eqnList, GnssTrackPtr track, Double lambda, const std::vector<GnssType> &extraTypes,
+                                                std::vector<GnssType> &typesPhase, std::vector<UInt> &idEpochs, Vector &slips, Double &cycles2tecu) const
 {
   try
   {
     // determine Melbourne-Wuebbena-like linear combinations
     // -----------------------------------------------------
-    std::vector<GnssType> typesPhase;
-    std::vector<UInt>     idEpochs;
-    Matrix                combinations;
-    Double                cycles2tecu;
+    Matrix combinations;
     linearCombinations(eqnList, track, extraTypes, typesPhase, idEpochs, combinations, cycles2tecu);
 
-    Vector slips(idEpochs.size());
+    slips = Vector(idEpochs.size());
+    if(combinations.columns())
+      copy(totalVariationDenoising(combinations.column(0), lambda), combinations.column(0));
     for(UInt k=0; k<combinations.columns(); k++)
-    {
-      Vector smoothed = combinations.column(k);
-      if(k == 0)
-        smoothed = totalVariationDenoising(smoothed, lambda);
       for(UInt i=1; i<idEpochs.size(); i++) // cycle slip if denoised difference exceeds 3/4 cycle
-        if(std::fabs(smoothed(i)-smoothed(i-1)) > 0.75)
+        if(std::fabs(combinations(i, k)-combinations(i-1, k)) > 0.75)
           slips(i) = TRUE;
-    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void GnssReceiver::cycleSlipsDetection(ObservationEquationList &eqnList, GnssTrackPtr track, Double lambda, UInt windowSize, Double tecSigmaFactor, const std::vector<GnssType> &extraTypes)
+{
+  try
+  {
+    std::vector<GnssType> typesPhase;
+    std::vector<UInt>     idEpochs;
+    Vector                slips;
+    Double                cycles2tecu;
+    cycleSlipsLinearCombinations(eqnList, track, lambda, extraTypes, typesPhase, idEpochs, slips, cycles2tecu);
+    cycleSlipsDetection(eqnList, track, windowSize, tecSigmaFactor, extraTypes, typesPhase, idEpochs, slips, cycles2tecu);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
 
+void GnssReceiver::cycleSlipsDetection(ObservationEquationList &eqnList, GnssTrackPtr track, UInt windowSize, Double tecSigmaFactor, const std::vector<GnssType> &extraTypes,
+                                       const std::vector<GnssType> &typesPhase, std::vector<UInt> &idEpochs, const Vector &slips, Double cycles2tecu)
+{
+  try
+  {
     for(UInt i=slips.rows(); i-->0;)
       if(slips(i))
       {
@@ -15,6 +15,7 @@
 #ifndef __GROOPS_GNSSRECEIVER__
 #define __GROOPS_GNSSRECEIVER__
 
+#include "inputOutput/profiler.h"
 #include "files/fileInstrument.h"
 #include "classes/noiseGenerator/noiseGenerator.h"
 #include "gnss/gnssObservation.h"
@@ -38,7 +39,14 @@ typedef std::shared_ptr<GnssTrack>    GnssTrackPtr;
 class GnssReceiver : public GnssTransceiver
 {
   std::vector<GnssObservation> obsMem;
+  std::vector<GnssSingleObservation> singleObsMem; // single observations of obsMem in one continuous memory block
   std::vector<std::vector<GnssObservation*>> observations_; // observations at receiver (for each epoch, for each transmitter)
+  Profiler::MemoryAccount memoryObservations; // size of obsMem and singleObsMem
+
+  mutable std::mutex mutexCompositions;
+  mutable std::map<std::vector<GnssType>, std::pair<std::vector<GnssType>, Matrix>> compositions; // signalComposition for each combination of observed types
+
+  void packObservations();
 
 public:
   // public variables
@@ -70,6 +78,9 @@ public:
 
   Bool isMyRank() const {return isMyRank_;}
 
+  /** @brief Number of single observations (all epochs, transmitters, and types) stored at this process. */
+  UInt countObservations() const;
+
   /** @brief Clock error.
   * error = clock time - system time [s] */
   Double clockError(UInt idEpoch) const {return clk.at(idEpoch);}
@@ -99,7 +110,8 @@ public:
 
   /** @brief Transformation matrix for observed (composed) types from orignal transmitted types.
   * E.g. C2DG = C1CG - C1WG + C2WG.
-  * Returns the @a typesTrans and the transformation matrix @a A (dimension: types.size() times typesTrans.size()). */
+  * Returns the @a typesTrans and the transformation matrix @a A (dimension: types.size() times typesTrans.size()).
+  * The result is computed only once for each combination of @a types. */
   virtual void signalComposition(UInt /*idEpoch*/, const std::vector<GnssType> &types, std::vector<GnssType> &typesTrans, Matrix &A) const;
 
   /** @brief All observations between receiver and transmitter at one epoch. */
@@ -180,6 +192,12 @@ public:
   void linearCombinations(ObservationEquationList &eqnList, GnssTrackPtr track, const std::vector<GnssType> &extraTypes,
                           std::vector<GnssType> &typesPhase, std::vector<UInt> &idEpochs, Matrix &combinations, Double &cycles2tecu) const;
 
+  /** @brief Cycle slips (@p slips at @p idEpochs) of a @p track in the Melbourne-Wuebbena like combinations.
+  * The first combination is smoothed by total variation denoising with regularization parameter @p lambda.
+  * Does not modify the track and can be called for different tracks in parallel threads. */
+  void cycleSlipsLinearCombinations(ObservationEquationList &eqnList, GnssTrackPtr track, Double lambda, const std::vector<GnssType> &extraTypes,
+                                    std::vector<GnssType> &typesPhase, std::vector<UInt> &idEpochs, Vector &slips, Double &cycles2tecu) const;
+
   void rangeAndTec(ObservationEquationList &eqnList, UInt idTrans, const std::vector<UInt> &idEpochs,
                    const std::vector<GnssType> &typesPhase, Vector &range, Vector &tec) const;
 
@@ -197,6 +215,8 @@ public:
   * @param extraTypes GPS L5 observations are handled separately due to temporal changing bias.*/
   void cycleSlipsDetection(ObservationEquationList &eqnList, UInt minObsCountPerTrack, Double lambda, UInt windowSize, Double tecSigmaFactor, const std::vector<GnssType> &extraTypes={});
   void cycleSlipsDetection(ObservationEquationList &eqnList, GnssTrackPtr track, Double lambda, UInt windowSize, Double tecSigmaFactor, const std::vector<GnssType> &extraTypes);
+  void cycleSlipsDetection(ObservationEquationList &eqnList, GnssTrackPtr track, UInt windowSize, Double tecSigmaFactor, const std::vector<GnssType> &extraTypes,
+                           const std::vector<GnssType> &typesPhase, std::vector<UInt> &idEpochs, const Vector &slips, Double cycles2tecu);
 
   /** @brief repair cycle slip differences at same frequencies (e.g. between L1CG and L1WG).
   * Allows to reduce the number of integer ambiguities.
@@ -163,7 +163,7 @@ void GnssReceiverGeneratorLowEarthOrbiter::init(const std::vector<Time> &times,
         if(!fileNameObs.empty())
         {
           logStatus<<"read observations"<<Log::endl;
-          auto rotationCrf2Trf = std::bind(&EarthRotation::rotaryMatrix, earthRotation, std::placeholders::_1);
+          auto rotationCrf2Trf = [&](const Time &time) {return earthRotation->rotaryMatrix(time);};
           recv->readObservations(fileNameObs, transmitters,  rotationCrf2Trf, timeMargin, elevationCutOff,
                                  useType, ignoreType, GnssObservation::RANGE | GnssObservation::PHASE);
 
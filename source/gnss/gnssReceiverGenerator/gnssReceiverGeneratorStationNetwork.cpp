@@ -11,6 +11,7 @@
 */
 /***********************************************/
 
+#include <future>
 #include "base/import.h"
 #include "base/string.h"
 #include "base/planets.h"
@@ -165,68 +166,118 @@ void GnssReceiverGeneratorStationNetwork::init(const std::vector<Time> &times, c
     // read observations at single nodes
     // ---------------------------------
     logStatus<<"read observations"<<Log::endl;
-    Vector receiverAlternative(receiversWithAlternatives.size());
-    logTimerStart;
+    // distribute stations to nodes: largest observation files first to the node with the least load
+    std::vector<UInt> processNo(receiversWithAlternatives.size());
+    if(Parallel::isMaster(comm))
+    {
+      std::vector<UInt> fileSize(receiversWithAlternatives.size(), 1);
+      if(!fileNameObs.empty())
+        for(UInt i=0; i<receiversWithAlternatives.size(); i++)
+        {
+          fileNameVariableList["station"]->setValue(receiversWithAlternatives.at(i).front()->name());
+          fileSize.at(i) = std::max(System::fileSize(fileNameObs(fileNameVariableList)), UInt(1));
+        }
+      std::vector<UInt> index(fileSize.size());
+      std::iota(index.begin(), index.end(), 0);
+      std::stable_sort(index.begin(), index.end(), [&](UInt i, UInt k) {return fileSize.at(i) > fileSize.at(k);});
+      std::vector<UInt> load(Parallel::size(comm), 0);
+      for(UInt i : index)
+      {
+        processNo.at(i) = std::distance(load.begin(), std::min_element(load.begin(), load.end()));
+        load.at(processNo.at(i)) += fileSize.at(i);
+      }
+    }
+    Parallel::broadCast(processNo, 0, comm);
+
+    std::vector<UInt> myStations;
     for(UInt i=0; i<receiversWithAlternatives.size(); i++)
-      if(i%Parallel::size(comm) == Parallel::myRank(comm)) // distribute to nodes
+      if(processNo.at(i) == Parallel::myRank(comm))
+        myStations.push_back(i);
+
+    // the observation file of the next station is read in the background (into the file system cache),
+    // while the current station is processed
+    auto prefetch = [&](UInt idx)
+    {
+      if(fileNameObs.empty() || (idx >= myStations.size()))
+        return std::future<void>();
+      fileNameVariableList["station"]->setValue(receiversWithAlternatives.at(myStations.at(idx)).front()->name());
+      const std::string name = fileNameObs(fileNameVariableList).str();
+      return std::async(std::launch::async, [name]()
+      {
+        std::ifstream file(name, std::ios::binary);
+        std::vector<char> buffer(1024*1024);
+        while(file.read(buffer.data(), buffer.size()) || file.gcount())
+          ;
+      });
+    };
+
+    // init receiver and read observations, returns FALSE if not enough observations
+    auto initReceiver = [&](GnssReceiverPtr recv)
+    {
+      fileNameVariableList["station"]->setValue(recv->name());
+      recv->isMyRank_ = TRUE;
+
+      recv->times = times;
+      recv->clk.resize(times.size(), 0);
+      recv->pos.resize(times.size(), recv->info.approxPosition);
+      recv->vel.resize(times.size());
+      recv->offset.resize(times.size());
+      recv->global2local.resize(times.size(), inverse(localNorthEastUp(recv->info.approxPosition, Ellipsoid())));
+      recv->local2antenna.resize(times.size());
+      for(UInt idEpoch=0; idEpoch<times.size(); idEpoch++)
       {
-        logTimerLoop(i, receiversWithAlternatives.size());
-        for(UInt k=0; k<receiversWithAlternatives.at(i).size(); k++) // test alternatives
+        const UInt idAnt = recv->info.findAntenna(times.at(idEpoch));
+        if((idAnt != NULLINDEX) && recv->info.antenna.at(idAnt).antennaDef && recv->info.antenna.at(idAnt).accuracyDef)
         {
-          try
-          {
-            fileNameVariableList["station"]->setValue(receiversWithAlternatives.at(i).at(k)->name());
-            GnssReceiverPtr recv = receiversWithAlternatives.at(i).at(k);
-            recv->isMyRank_ = TRUE;
-
-            recv->times = times;
-            recv->clk.resize(times.size(), 0);
-            recv->pos.resize(times.size(), recv->info.approxPosition);
-            recv->vel.resize(times.size());
-            recv->offset.resize(times.size());
-            recv->global2local.resize(times.size(), inverse(localNorthEastUp(recv->info.approxPosition, Ellipsoid())));
-            recv->local2antenna.resize(times.size());
-            for(UInt idEpoch=0; idEpoch<times.size(); idEpoch++)
-            {
-              const UInt idAnt = recv->info.findAntenna(times.at(idEpoch));
-              if((idAnt != NULLINDEX) && recv->info.antenna.at(idAnt).antennaDef && recv->info.antenna.at(idAnt).accuracyDef)
-              {
-                recv->offset.at(idEpoch)        = recv->info.antenna.at(idAnt).position - recv->info.referencePoint(times.at(idEpoch));
-                recv->local2antenna.at(idEpoch) = recv->info.antenna.at(idAnt).local2antennaFrame;
-              }
-              else
-                recv->disable(idEpoch);
-            }
+          recv->offset.at(idEpoch)        = recv->info.antenna.at(idAnt).position - recv->info.referencePoint(times.at(idEpoch));
+          recv->local2antenna.at(idEpoch) = recv->info.antenna.at(idAnt).local2antennaFrame;
+        }
+        else
+          recv->disable(idEpoch);
+      }
 
-            // simulation case
-            if(fileNameObs.empty())
-            {
-              receiverAlternative(i) = 1;
-              break;
-            }
+      // simulation case
+      if(fileNameObs.empty())
+        return TRUE;
 
-            auto rotationCrf2Trf = std::bind(&EarthRotation::rotaryMatrix, earthRotation, std::placeholders::_1);
-            recv->readObservations(fileNameObs(fileNameVariableList), transmitters, rotationCrf2Trf, timeMargin, elevationCutOff,
-                                  useType, ignoreType, GnssObservation::RANGE | GnssObservation::PHASE);
+      auto rotationCrf2Trf = [&](const Time &time) {return earthRotation->rotaryMatrix(time);};
+      recv->readObservations(fileNameObs(fileNameVariableList), transmitters, rotationCrf2Trf, timeMargin, elevationCutOff,
+                            useType, ignoreType, GnssObservation::RANGE | GnssObservation::PHASE);
 
-            // count epochs with observations
-            UInt countEpochs = 0;
-            for(UInt idEpoch=0; idEpoch<times.size(); idEpoch++)
-              if(recv->useable(idEpoch))
-                countEpochs++;
-            if(countEpochs*recv->observationSampling < minEstimableEpochsRatio*times.size()*medianSampling(times).seconds())
-              continue;
+      // count epochs with observations
+      UInt countEpochs = 0;
+      for(UInt idEpoch=0; idEpoch<times.size(); idEpoch++)
+        if(recv->useable(idEpoch))
+          countEpochs++;
+      return (countEpochs*recv->observationSampling >= minEstimableEpochsRatio*times.size()*medianSampling(times).seconds());
+    };
 
-            // found valid station
-            receiverAlternative(i) = k+1;
-            break;
-          }
-          catch(std::exception &e)
+    Vector receiverAlternative(receiversWithAlternatives.size());
+    std::future<void> prefetched = prefetch(0);
+    logTimerStart;
+    for(UInt idx=0; idx<myStations.size(); idx++)
+    {
+      const UInt i = myStations.at(idx);
+      logTimerLoop(i, receiversWithAlternatives.size());
+      if(prefetched.valid())
+        prefetched.wait();
+      prefetched = prefetch(idx+1);
+      for(UInt k=0; k<receiversWithAlternatives.at(i).size(); k++) // test alternatives
+      {
+        try
+        {
+          if(initReceiver(receiversWithAlternatives.at(i).at(k)))
           {
-            logWarning<<receiversWithAlternatives.at(i).at(k)->name()<<" disabled: "<<e.what()<<Log::endl;
+            receiverAlternative(i) = k+1; // found valid station
+            break;
           }
         }
+        catch(std::exception &e)
+        {
+          logWarning<<receiversWithAlternatives.at(i).at(k)->name()<<" disabled: "<<e.what()<<Log::endl;
+        }
       }
+    }
     Parallel::barrier(comm);
     logTimerLoopEnd(receiversWithAlternatives.size());
     Parallel::reduceSum(receiverAlternative, 0, comm);
@@ -241,9 +292,75 @@ void GnssReceiverGeneratorStationNetwork::init(const std::vector<Time> &times, c
         if(receivers.size() >= maxStationCount)
           break;
       }
-    receiversAll.insert(receiversAll.end(), receivers.begin(), receivers.end());
     logInfo<<"  "<<receivers.size()<<" of "<<stationName.size()<<" stations used"<<Log::endl;
 
+    // balance the number of observations of the processes
+    // ----------------------------------------------------
+    // includes receivers of other generators, moved stations are read again at the new process
+    if(!fileNameObs.empty() && (Parallel::size(comm) > 1))
+    {
+      const UInt myRank = Parallel::myRank(comm);
+      Vector load(Parallel::size(comm));
+      for(auto &recv : receiversAll)
+        if(recv->isMyRank())
+          load(myRank) += recv->countObservations();
+      Vector count(receivers.size()), process(receivers.size());
+      for(UInt i=0; i<receivers.size(); i++)
+        if(receivers.at(i)->isMyRank())
+        {
+          count(i)   = receivers.at(i)->countObservations();
+          process(i) = myRank;
+          load(myRank) += count(i);
+        }
+      Parallel::reduceSum(load,    0, comm);
+      Parallel::reduceSum(count,   0, comm);
+      Parallel::reduceSum(process, 0, comm);
+      Parallel::broadCast(load,    0, comm);
+      Parallel::broadCast(count,   0, comm);
+      Parallel::broadCast(process, 0, comm);
+
+      // move stations from the process with the most to the one with the least observations
+      // as long as the load is more than 5% above average and the difference is reduced
+      Vector processNew = process;
+      const Double average = sum(load)/load.rows();
+      for(;;)
+      {
+        UInt idMax = 0, idMin = 0;
+        for(UInt p=1; p<load.rows(); p++)
+        {
+          if(load(p) > load(idMax)) idMax = p;
+          if(load(p) < load(idMin)) idMin = p;
+        }
+        const Double diff = load(idMax)-load(idMin);
+        if(load(idMax) <= 1.05*average)
+          break;
+        UInt idBest = NULLINDEX;
+        for(UInt i=0; i<receivers.size(); i++)
+          if((processNew(i) == idMax) && (count(i) > 0) && (count(i) < diff) &&
+             ((idBest == NULLINDEX) || (std::fabs(count(i)-diff/2) < std::fabs(count(idBest)-diff/2))))
+            idBest = i;
+        if(idBest == NULLINDEX)
+          break;
+        processNew(idBest) = idMin;
+        load(idMax) -= count(idBest);
+        load(idMin) += count(idBest);
+      }
+
+      UInt countMoved = 0;
+      for(UInt i=0; i<receivers.size(); i++)
+        if(processNew(i) != process(i))
+        {
+          countMoved++;
+          if(process(i) == myRank)
+            receivers.at(i)->disable(); // release observations, state is synchronized from the new process
+          else if((processNew(i) == myRank) && !initReceiver(receivers.at(i)))
+            throw(Exception(receivers.at(i)->name()+": reading observations at new process failed"));
+        }
+      if(countMoved)
+        logInfo<<"  "<<countMoved<<" stations moved to balance the number of observations"<<Log::endl;
+    }
+    receiversAll.insert(receiversAll.end(), receivers.begin(), receivers.end());
+
     // tides & loading
     // ---------------
     logStatus<<"compute tides & loading"<<Log::endl;
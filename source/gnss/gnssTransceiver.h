@@ -13,6 +13,7 @@
 #ifndef __GROOPS_GNSSTRANSCEIVER__
 #define __GROOPS_GNSSTRANSCEIVER__
 
+#include <mutex>
 #include "base/gnssType.h"
 #include "files/fileGnssSignalBias.h"
 #include "files/fileGnssStationInfo.h"
@@ -36,6 +37,11 @@ class GnssTransceiver
    UInt        countUseableEpochs;
    GnssAntennaDefinition::NoPatternFoundAction noPatternFoundAction;
 
+   // resolved antenna patterns for (antenna definition, types)
+   mutable std::mutex mutexPatterns;
+   mutable std::map<std::pair<const GnssAntennaDefinition*, std::vector<GnssType>>, std::vector<UInt>> idPatterns;
+   const std::vector<UInt> &findAntennaPatterns(const GnssAntennaDefinition &antenna, const std::vector<GnssType> &types) const;
+
 public:
    UInt            id_; // set by Gnss::init()
    GnssStationInfo info;
@@ -127,8 +133,8 @@ inline Vector GnssTransceiver::antennaVariations(const Time &time, Angle azimut,
 {
   try
   {
-    Vector corr(types.size());
-    corr += info.antennaVariations(time, azimut, elevation, types, noPatternFoundAction);
+    const GnssAntennaDefinition &antenna = info.antennaDefinition(time);
+    Vector corr = antenna.antennaVariations(azimut, elevation, types, findAntennaPatterns(antenna, types));
     corr += signalBias.compute(types);
     return corr;
   }
@@ -144,7 +150,27 @@ inline Vector GnssTransceiver::accuracy(const Time &time, Angle azimut, Angle el
 {
   try
   {
-    return info.accuracy(time, azimut, elevation, types, noPatternFoundAction);
+    const GnssAntennaDefinition &antenna = info.accuracyDefinition(time);
+    return antenna.antennaVariations(azimut, elevation, types, findAntennaPatterns(antenna, types));
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+inline const std::vector<UInt> &GnssTransceiver::findAntennaPatterns(const GnssAntennaDefinition &antenna, const std::vector<GnssType> &types) const
+{
+  try
+  {
+    std::lock_guard<std::mutex> lock(mutexPatterns);
+    const auto key = std::make_pair(&antenna, types);
+    auto iter = idPatterns.find(key);
+    if(iter == idPatterns.end())
+      iter = idPatterns.emplace(key, antenna.findAntennaPatterns(types, noPatternFoundAction)).first;
+    return iter->second;
   }
   catch(std::exception &e)
   {
@@ -37,6 +37,12 @@ class GnssTransmitter : public GnssTransceiver
   std::vector<Double>      clk;
   std::vector<Vector3d>    offset;   // between CoM and ARF in SRF
   std::vector<Transform3d> crf2srf, srf2arf;
+  UInt                     interpolationDegree;
+  Time                     timeTable;       // first node of the hermite tables
+  Double                   samplingTable;   // node distance [seconds]
+  Matrix                   tablePos, tableVel; // for each node (x,y,z), 1st and 2nd derivatives
+
+  Bool interpolateTable(const Matrix &table, const Time &time, Vector3d &x) const;
 
 public:
   std::vector<Time> timesPosVel;
@@ -48,7 +54,8 @@ public:
                   const std::vector<Transform3d> &crf2srf, const std::vector<Transform3d> &srf2arf,
                   const std::vector<Time> &timesPosVel, const_MatrixSliceRef position, const_MatrixSliceRef velocity, UInt interpolationDegree)
   : GnssTransceiver(name, info, noPatternFoundAction, useableEpochs),
-    type(prn), polynomial(timesPosVel, interpolationDegree), clk(clock), offset(offset), crf2srf(crf2srf), srf2arf(srf2arf), timesPosVel(timesPosVel), pos(position), vel(velocity) {}
+    type(prn), polynomial(timesPosVel, interpolationDegree), clk(clock), offset(offset), crf2srf(crf2srf), srf2arf(srf2arf),
+    interpolationDegree(interpolationDegree), timesPosVel(timesPosVel), pos(position), vel(velocity) {initOrbitTable();}
 
   /// Destructor.
   virtual ~GnssTransmitter() {}
@@ -68,6 +75,12 @@ public:
   * error = observed clock time - system time [s] */
   void updateClockError(UInt idEpoch, Double deltaClock) {clk.at(idEpoch) += deltaClock;}
 
+  /** @brief Precompute the orbit interpolation.
+  * Positions and velocities are interpolated with quintic hermite polynomials between nodes every 60 seconds
+  * (or the orbit sampling, if smaller). Values and derivatives at the nodes are computed with the interpolation polynomial of @a pos and @a vel.
+  * Must be called after @a pos or @a vel are changed. */
+  void initOrbitTable();
+
   /** @brief center of mass in celestial reference frame (CRF). */
   Vector3d positionCoM(const Time &time) const;
 
@@ -83,10 +96,72 @@ public:
 
 /***********************************************/
 
+inline void GnssTransmitter::initOrbitTable()
+{
+  try
+  {
+    tablePos = tableVel = Matrix();
+    if(timesPosVel.size() < 2)
+      return;
+    samplingTable = std::min(60., medianSampling(timesPosVel).seconds());
+    timeTable     = timesPosVel.front();
+    const UInt count = static_cast<UInt>(std::floor((timesPosVel.back()-timesPosVel.front()).seconds()/samplingTable))+1;
+    if(count < 2)
+      return;
+    std::vector<Time> times(count);
+    for(UInt i=0; i<count; i++)
+      times.at(i) = timeTable + seconds2time(i*samplingTable);
+
+    // nodes outside the valid interpolation range are NAN
+    Polynomial polynomial(timesPosVel, interpolationDegree, FALSE/*throwException*/);
+    tablePos = Matrix(count, 9);
+    copy(polynomial.interpolate  (times, pos), tablePos.column(0, 3));
+    copy(polynomial.derivative   (times, pos), tablePos.column(3, 3));
+    copy(polynomial.derivative2nd(times, pos), tablePos.column(6, 3));
+    tableVel = Matrix(count, 9);
+    copy(polynomial.interpolate  (times, vel), tableVel.column(0, 3));
+    copy(polynomial.derivative   (times, vel), tableVel.column(3, 3));
+    copy(polynomial.derivative2nd(times, vel), tableVel.column(6, 3));
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+inline Bool GnssTransmitter::interpolateTable(const Matrix &table, const Time &time, Vector3d &x) const
+{
+  if((table.rows() < 2) || (time < timeTable))
+    return FALSE;
+  const Double tau = (time-timeTable).seconds()/samplingTable;
+  if(tau > table.rows()-1)
+    return FALSE;
+  const UInt   idx = std::min(static_cast<UInt>(tau), table.rows()-2);
+  const Double t   = tau - idx;
+  const Double t3  = t*t*t;
+  const Double h   = samplingTable;
+  const Double f[6] = {1-t3*(10-15*t+6*t*t),              // value at idx
+                       (t-t3*(6-8*t+3*t*t))*h,            // 1st derivative at idx
+                       0.5*t*t*std::pow(1-t, 3)*h*h,      // 2nd derivative at idx
+                       t3*(10-15*t+6*t*t),                // value at idx+1
+                       -t3*(4-7*t+3*t*t)*h,               // 1st derivative at idx+1
+                       0.5*t3*(1-t)*(1-t)*h*h};           // 2nd derivative at idx+1
+  auto value = [&](UInt k) {return f[0]*table(idx,k) + f[1]*table(idx,k+3) + f[2]*table(idx,k+6) + f[3]*table(idx+1,k) + f[4]*table(idx+1,k+3) + f[5]*table(idx+1,k+6);};
+  x = Vector3d(value(0), value(1), value(2));
+  return !std::isnan(x.x()+x.y()+x.z());
+}
+
+/***********************************************/
+
 inline Vector3d GnssTransmitter::positionCoM(const Time &time) const
 {
   try
   {
+    Vector3d x;
+    if(interpolateTable(tablePos, time, x))
+      return x;
     return Vector3d(polynomial.interpolate({time}, pos));
   }
   catch(std::exception &e)
@@ -101,6 +176,9 @@ inline Vector3d GnssTransmitter::velocity(const Time &time) const
 {
   try
   {
+    Vector3d x;
+    if(interpolateTable(tableVel, time, x))
+      return x;
     return Vector3d(polynomial.interpolate({time}, vel));
   }
   catch(std::exception &e)
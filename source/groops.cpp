@@ -15,7 +15,8 @@
 *
 @verbatim
 Gravity Recovery Object Oriented Programming System (GROOPS)
-Usage: groops [--log <logfile.txt>] [--settings <groopsDefaults.xml>] [--silent] [--global name=value] <configfile.xml>
+Usage: groops [--log <logfile.txt>] [--settings <groopsDefaults.xml>] [--silent] [--threads <count>] [--blas-threads <count>] [--build-cache <cache.txt>] [--file-cache <MB>] [--gpu <size>] [--profile] [--trace <trace.json>] [--global name=value] <configfile.xml>
+       groops [options] --queue <directory/>
        groops --write-settings <groopsDefaults.xml>
        groops --xsd <schemafile.xsd>
        groops --doc <documentation/>
@@ -25,6 +26,15 @@ Usage: groops [--log <logfile.txt>] [--settings <groopsDefaults.xml>] [--silent]
 -g, --global         pass a global variable to config files as name=value pair
 -c, --settings       read constants from file (default search: groopsDefaults.xml)
 -s, --silent         runs silently
+-t, --threads        number of threads per process used in thread parallel loops (0: cores of the node shared by the processes at the node, default: 1)
+-B, --blas-threads   number of threads per process used by BLAS/LAPACK outside of thread parallel loops (0: cores of the node shared by the processes at the node,
+                     default: 0 with several processes at a node and no *_NUM_THREADS environment variable, otherwise unchanged)
+-b, --build-cache    skip programs whose config and files are unchanged since the last run recorded in this file
+-f, --file-cache     maximum size of model files kept in memory after reading (0: disabled, default: 1024 MB)
+-G, --gpu            minimum matrix dimension of operations computed on the GPU, if compiled with CUDA (0: disabled, default: 1024)
+-p, --profile        log a summary of the time spent in hot spots after each program
+-T, --trace          write all profiled scopes as Chrome trace (JSON, view with Perfetto), implies --profile
+-q, --queue          resident mode: run config files (*.xml) placed in this directory until a file 'stop' appears
 -d, --doc            generate documentation files (latex/html/...)
 -x, --xsd            write xsd-schema of xml-configfile options
 -C, --write-settings write the users current settings to file
@@ -75,7 +85,11 @@ GitHub repository: https://github.com/groops-devs/groops
 #include "programs/program.h"
 #include "inputOutput/settings.h"
 #include "inputOutput/system.h"
+#include "inputOutput/fileCache.h"
+#include "base/matrixGpu.h"
 #include "config/generateDocumentation.h"
+#include <thread>
+#include <chrono>
 
 /***********************************************/
 
@@ -84,7 +98,8 @@ static void groopsHelp(const std::string &progName, Parallel::CommunicatorPtr co
   if(Parallel::isMaster(comm))
   {
     std::cout<<"Gravity Recovery Object Oriented Programming System (GROOPS)"<<std::endl;
-    std::cout<<"Usage: "<<progName<<" [--log <logfile.txt>] [--settings <groopsDefaults.xml>] [--silent] [--global name=value] <configfile.xml>"<<std::endl;
+    std::cout<<"Usage: "<<progName<<" [--log <logfile.txt>] [--settings <groopsDefaults.xml>] [--silent] [--threads <count>] [--blas-threads <count>] [--build-cache <cache.txt>] [--file-cache <MB>] [--gpu <size>] [--profile] [--trace <trace.json>] [--global name=value] <configfile.xml>"<<std::endl;
+    std::cout<<"       "<<progName<<" [options] --queue <directory/>"<<std::endl;
     std::cout<<"       "<<progName<<" --write-settings <groopsDefaults.xml>"<<std::endl;
     std::cout<<"       "<<progName<<" --xsd <schemafile.xsd>"<<std::endl;
     std::cout<<"       "<<progName<<" --doc <documentation/>"<<std::endl;
@@ -94,6 +109,15 @@ static void groopsHelp(const std::string &progName, Parallel::CommunicatorPtr co
     std::cout<<" -g, --global         pass a global variable to config files as name=value pair"<<std::endl;
     std::cout<<" -c, --settings       read constants from file (default search: groopsDefaults.xml)"<<std::endl;
     std::cout<<" -s, --silent         runs silently"<<std::endl;
+    std::cout<<" -t, --threads        number of threads per process used in thread parallel loops (0: cores of the node shared by the processes at the node, default: 1)"<<std::endl;
+    std::cout<<" -B, --blas-threads   number of threads per process used by BLAS/LAPACK outside of thread parallel loops (0: cores of the node shared by the processes at the node,"<<std::endl;
+    std::cout<<"                      default: 0 with several processes at a node and no *_NUM_THREADS environment variable, otherwise unchanged)"<<std::endl;
+    std::cout<<" -b, --build-cache    skip programs whose config and files are unchanged since the last run recorded in this file"<<std::endl;
+    std::cout<<" -f, --file-cache     maximum size of model files kept in memory after reading (0: disabled, default: 1024 MB)"<<std::endl;
+    std::cout<<" -G, --gpu            minimum matrix dimension of operations computed on the GPU, if compiled with CUDA (0: disabled, default: 1024)"<<std::endl;
+    std::cout<<" -p, --profile        log a summary of the time spent in hot spots after each program"<<std::endl;
+    std::cout<<" -T, --trace          write all profiled scopes as Chrome trace (JSON, view with Perfetto), implies --profile"<<std::endl;
+    std::cout<<" -q, --queue          resident mode: run config files (*.xml) placed in this directory until a file 'stop' appears"<<std::endl;
     std::cout<<" -d, --doc            generate documentation files (latex/html/...)"<<std::endl;
     std::cout<<" -x, --xsd            write xsd-schema of xml-configfile options"<<std::endl;
     std::cout<<" -C, --write-settings write the users current settings to file"<<std::endl;
@@ -106,6 +130,75 @@ static void groopsHelp(const std::string &progName, Parallel::CommunicatorPtr co
 
 /***********************************************/
 
+// Resident mode: the processes stay alive and run the config files placed in a directory.
+// A job <name>.xml is renamed to <name>.xml.running and afterwards to <name>.xml.done or <name>.xml.failed,
+// the log is written to <name>.xml.log. Model files read by previous jobs stay in the file cache.
+static void runQueue(const FileName &directory, const std::map<std::string, std::string> &commandlineGlobals, Parallel::CommunicatorPtr comm)
+{
+  try
+  {
+    const FileName stopFileName = directory.append(FileName("stop"));
+    logStatus<<"waiting for config files in <"<<directory<<">, stop with <"<<stopFileName<<">"<<Log::endl;
+    for(;;)
+    {
+      // master waits for next job
+      std::string jobName;
+      if(Parallel::isMaster(comm))
+        for(;;)
+        {
+          if(System::exists(stopFileName))
+          {
+            System::remove(stopFileName);
+            break;
+          }
+          for(const auto &fileName : System::directoryContent(directory))
+            if((fileName.typeExtension().str() == "xml") && System::rename(directory.append(fileName), directory.append(FileName(fileName.str()+".running"))))
+            {
+              jobName = fileName.str();
+              break;
+            }
+          if(!jobName.empty())
+            break;
+          std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        }
+      Parallel::broadCast(jobName, 0, comm);
+      if(jobName.empty())
+        break;
+
+      const Double startTime = Profiler::seconds();
+      Log::setLogFile(directory.append(FileName(jobName+".log")));
+      logStatus<<"=== Starting job <"<<jobName<<"> ==="<<Log::endl;
+      Bool failed = FALSE;
+      try
+      {
+        Parallel::broadCastExceptions(comm, [&](Parallel::CommunicatorPtr comm)
+        {
+          FileName configFileName = directory.append(FileName(jobName+".running"));
+          Config config(configFileName, commandlineGlobals);
+          ProgramConfig programs;
+          readConfig(config, "program", programs, Config::OPTIONAL, "", "");
+          programs.run(config.getVarList(), comm);
+        });
+      }
+      catch(std::exception &e)
+      {
+        if(Parallel::isMaster(comm))
+          logError<<e.what()<<Log::endl;
+        failed = TRUE;
+      }
+      logStatus<<"=== Finished job <"<<jobName<<"> "<<(failed ? "with errors " : "")<<"("<<(Profiler::seconds()-startTime)%"%.1f s) ==="s<<Log::endl;
+      if(Parallel::isMaster(comm))
+        System::rename(directory.append(FileName(jobName+".running")), directory.append(FileName(jobName+(failed ? ".failed" : ".done"))));
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 int main(int argc, char *argv[])
 {
   Parallel::CommunicatorPtr comm = Parallel::init(argc, argv);
@@ -127,8 +220,16 @@ int main(int argc, char *argv[])
       FileName docFileName;
       FileName settingsFileName;
       FileName writeSettingsFileName;
-      Bool     silent   = FALSE;
-      Bool     workDone = FALSE;
+      FileName buildCacheFileName;
+      FileName traceFileName;
+      FileName queueDirectory;
+      Bool     profile       = FALSE;
+      Bool     silent        = FALSE;
+      UInt     threads       = 1;
+      UInt     blasThreads   = NULLINDEX;
+      UInt     fileCacheSize = 1024; // MB
+      UInt     gpuMinSize    = 1024;
+      Bool     workDone      = FALSE;
       std::map<std::string, std::string> commandlineGlobals;
       std::vector<FileName> configFileNames;
 
@@ -151,7 +252,15 @@ int main(int argc, char *argv[])
         else if((opt == "-d") || (opt == "--doc"))            {docFileName           = FileName(optArg());}
         else if((opt == "-c") || (opt == "--settings"))       {settingsFileName      = FileName(optArg());}
         else if((opt == "-C") || (opt == "--write-settings")) {writeSettingsFileName = FileName(optArg());}
+        else if((opt == "-b") || (opt == "--build-cache"))    {buildCacheFileName    = FileName(optArg());}
+        else if((opt == "-T") || (opt == "--trace"))          {traceFileName         = FileName(optArg()); profile = TRUE;}
+        else if((opt == "-f") || (opt == "--file-cache"))     {fileCacheSize = static_cast<UInt>(std::stoul(optArg()));}
+        else if((opt == "-G") || (opt == "--gpu"))            {gpuMinSize    = static_cast<UInt>(std::stoul(optArg()));}
+        else if((opt == "-q") || (opt == "--queue"))          {queueDirectory        = FileName(optArg());}
+        else if((opt == "-p") || (opt == "--profile"))        {profile = TRUE;}
         else if((opt == "-s") || (opt == "--silent"))         {silent = TRUE;}
+        else if((opt == "-t") || (opt == "--threads"))        {threads = static_cast<UInt>(std::stoul(optArg()));}
+        else if((opt == "-B") || (opt == "--blas-threads"))   {blasThreads = static_cast<UInt>(std::stoul(optArg()));}
         else if((opt == "-h") || (opt == "--help"))           {groopsHelp(argv[0], comm);}
         else if((opt == "-g") || (opt == "--global"))
         {
@@ -181,6 +290,16 @@ int main(int argc, char *argv[])
       // start logging
       // -------------
       Log::setSilent(silent);
+      // the cores of a node are shared by the processes at the node
+      const std::vector<UInt> node = Parallel::nodeIndex(comm);
+      const UInt processesAtNode = std::count(node.begin(), node.end(), node.at(Parallel::myRank(comm)));
+      Parallel::setThreadCount(threads, processesAtNode);
+      if((blasThreads != NULLINDEX) ||
+         ((processesAtNode > 1) && !std::getenv("OPENBLAS_NUM_THREADS") && !std::getenv("MKL_NUM_THREADS") && !std::getenv("OMP_NUM_THREADS")))
+        Parallel::setBlasThreadCount((blasThreads != NULLINDEX) ? blasThreads : 0, processesAtNode);
+      FileCache::setMaxSize(fileCacheSize*1024*1024);
+      MatrixGpu::setMinSize(gpuMinSize);
+      Profiler::enable(profile, !traceFileName.empty());
       if(!System::isDirectory(logFileName))
         Log::setLogFile(logFileName);
       logStatus<<"=== Starting GROOPS ==="<<Log::endl;
@@ -234,6 +353,11 @@ int main(int argc, char *argv[])
 
       // Starting Programs
       // -----------------
+      if(!buildCacheFileName.empty())
+      {
+        logInfo<<"build cache: <"<<buildCacheFileName<<">"<<Log::endl;
+        ProgramConfig::setBuildCache(buildCacheFileName);
+      }
       for(auto &configFileName : configFileNames)
       {
         // If the user specifies a directory as the logging target,
@@ -254,11 +378,21 @@ int main(int argc, char *argv[])
         workDone = TRUE;
       }
 
+      // resident mode
+      // -------------
+      if(!queueDirectory.empty())
+      {
+        workDone = TRUE;
+        runQueue(queueDirectory, commandlineGlobals, comm);
+      }
+
       // ============================================
 
       if(!workDone)
         groopsHelp(argv[0], comm);
 
+      Profiler::writeTrace(traceFileName, comm);
+
       Parallel::barrier(comm);
       logStatus<<"=== Finished GROOPS ==="<<Log::endl;
       Parallel::barrier(comm);
@@ -137,6 +137,10 @@ public:
   virtual void endTag  (const std::string &/*name*/) {}
   virtual void endLine() {}
   virtual void comment(const std::string &/*text*/) {}
+
+  /** @brief Write @a count values as one unformatted block (binary archives only).
+  * Returns FALSE if not supported, the values must then be saved one by one. */
+  virtual Bool saveBlock(const Double */*x*/, UInt /*count*/) {return FALSE;}
 };
 
 /***** CLASS ***********************************/
@@ -163,6 +167,10 @@ public:
   virtual void startTag(const std::string &/*name*/) {}
   virtual void endTag  (const std::string &/*name*/) {}
 
+  /** @brief Read @a count values written with OutArchive::saveBlock (binary archives only).
+  * Returns FALSE if not supported, the values must then be loaded one by one. */
+  virtual Bool loadBlock(Double */*x*/, UInt /*count*/) {return FALSE;}
+
   virtual void load(std::string &x) = 0;
   virtual void load(Int      &x) = 0;
   virtual void load(UInt     &x) = 0;
@@ -11,9 +11,11 @@
 /***********************************************/
 
 #include "base/importStd.h"
+#include "base/string.h"
 #include "base/doodson.h"
 #include "base/sphericalHarmonics.h"
 #include "base/gnssType.h"
+#include "parallel/threadPool.h"
 #include "archive.h"
 #include "archiveAscii.h"
 
@@ -37,7 +39,7 @@ OutArchiveAscii::OutArchiveAscii(std::ostream &_stream, const std::string &type,
 void OutArchiveAscii::endLine()
 {
   if(!isNewLine)
-    stream<<std::endl;
+    stream<<'\n'; // no flush
   isNewLine = TRUE;
 }
 
@@ -48,20 +50,26 @@ void OutArchiveAscii::comment(const std::string &text)
   if(text.empty())
     return;
   endLine();
-  stream<<"# "<<text<<std::endl;
+  stream<<"# "<<text<<'\n';
+}
+
+/***********************************************/
+
+// printf gives the same result as the stream formatting but avoids the locale overhead
+static Int formatDouble(char *buffer, UInt size, Double x, Int width, Int precision, Bool science)
+{
+  const Int count = std::snprintf(buffer, size, science ? "%*.*e" : "%*.*f", width, precision, x);
+  if((count < 0) || (count >= static_cast<Int>(size)))
+    throw(Exception("cannot format number"));
+  return count;
 }
 
 /***********************************************/
 
 void OutArchiveAscii::saveDouble(Double x, Int width, Int precision, Bool science)
 {
-  if(science)
-    stream.setf(std::ios::scientific,std::ios::floatfield);
-  else
-    stream.setf(std::ios::fixed,std::ios::floatfield);
-  stream.width(width);
-  stream.precision(precision);
-  stream<<x;
+  char buffer[512];
+  stream.write(buffer, formatDouble(buffer, sizeof(buffer), x, width, precision, science));
 }
 
 /***********************************************/
@@ -133,21 +141,11 @@ Double InArchiveAscii::readDouble(std::istream &stream_)
 {
   try
   {
-    std::string dummy;
-    stream_>>dummy;
-
-    auto dpos = dummy.find_first_of("Dd");
-    if(dpos != std::string::npos)
-      dummy[dpos] = 'e';
-
-    try
-    {
-      return std::stod(dummy);
-    }
-    catch(std::invalid_argument &)
-    {
-      throw(Exception("cannot read number: "+dummy));
-    }
+    thread_local std::string token; // reused buffer
+    stream_>>token;
+    if(token.empty())
+      throw(Exception("cannot read number"));
+    return String::toDouble(token.data(), token.data()+token.size());
   }
   catch(std::exception &e)
   {
@@ -157,13 +155,13 @@ Double InArchiveAscii::readDouble(std::istream &stream_)
 
 /***********************************************/
 
-void OutArchiveAscii::save(const Int      &x) {stream<<' '<<std::setw(i_width)<<x; isNewLine = FALSE;}
-void OutArchiveAscii::save(const UInt     &x) {stream<<' '<<std::setw(i_width)<<x; isNewLine = FALSE;}
-void OutArchiveAscii::save(const Double   &x) {saveDouble(x);                      isNewLine = FALSE;}
-void OutArchiveAscii::save(const Bool     &x) {stream<<' '<<x;                     isNewLine = FALSE;}
-void OutArchiveAscii::save(const Angle    &x) {saveDouble(x*RAD2DEG);              isNewLine = FALSE;}
-void OutArchiveAscii::save(const Doodson  &x) {stream<<' '<<x.code();              isNewLine = FALSE;}
-void OutArchiveAscii::save(const GnssType &x) {stream<<' '<<x.str();               isNewLine = FALSE;}
+void OutArchiveAscii::save(const Int      &x) {char s[32]; stream.write(s, std::snprintf(s, sizeof(s), " %*d",  i_width, x)); isNewLine = FALSE;}
+void OutArchiveAscii::save(const UInt     &x) {char s[32]; stream.write(s, std::snprintf(s, sizeof(s), " %*zu", i_width, x)); isNewLine = FALSE;}
+void OutArchiveAscii::save(const Double   &x) {saveDouble(x);                                                                  isNewLine = FALSE;}
+void OutArchiveAscii::save(const Bool     &x) {stream<<' '<<x;                                                                 isNewLine = FALSE;}
+void OutArchiveAscii::save(const Angle    &x) {saveDouble(x*RAD2DEG);                                                          isNewLine = FALSE;}
+void OutArchiveAscii::save(const Doodson  &x) {stream<<' '<<x.code();                                                          isNewLine = FALSE;}
+void OutArchiveAscii::save(const GnssType &x) {stream<<' '<<x.str();                                                           isNewLine = FALSE;}
 
 /***********************************************/
 
@@ -230,11 +228,8 @@ void OutArchiveAscii::save(const Time &x)
     LongDouble mjd = x.mjdMod();
     mjd += x.mjdInt();
 
-    stream<<' ';
-    stream.setf(std::ios::fixed,std::ios::floatfield);
-    stream.width(5+1+18);
-    stream.precision(18);
-    stream<<mjd;
+    char buffer[64];
+    stream.write(buffer, std::snprintf(buffer, sizeof(buffer), " %*.*Lf", 5+1+18, 18, mjd));
   }
   catch(std::exception &e)
   {
@@ -288,16 +283,47 @@ void OutArchiveAscii::save(const const_MatrixSlice &A)
   {
     endLine();
 
-    if(A.getType()==Matrix::GENERAL)
+    // rows are formatted in parallel threads and written in order
+    auto saveRows = [&](std::function<UInt(UInt)> columnStart, std::function<UInt(UInt)> columnEnd)
     {
-      stream<<"Matrix( "<<A.rows()<<" x "<<A.columns()<<" )"<<std::endl;
-      for(UInt i=0; i<A.rows(); i++)
+      std::vector<UInt> rowStart(1, 0); // chunks of rows with about the same number of elements
+      for(UInt i=0, count=0; i<A.rows(); i++)
       {
-        for(UInt k=0; k<A.columns(); k++)
-          saveDouble(A(i,k));
-        stream<<std::endl;
+        count += columnEnd(i)-columnStart(i);
+        if((count >= 65536) || (i+1 == A.rows()))
+        {
+          rowStart.push_back(i+1);
+          count = 0;
+        }
       }
-      stream<<std::endl;
+
+      const UInt batchSize = 4*Parallel::threadCount();
+      std::vector<std::string> text(batchSize);
+      for(UInt batch=0; batch+1<rowStart.size(); batch+=batchSize)
+      {
+        const UInt count = std::min(batchSize, rowStart.size()-1-batch);
+        Parallel::threadLoop(0, count, [&](UInt c)
+        {
+          std::string &str = text.at(c);
+          str.clear();
+          char buffer[512];
+          for(UInt i=rowStart.at(batch+c); i<rowStart.at(batch+c+1); i++)
+          {
+            for(UInt k=columnStart(i); k<columnEnd(i); k++)
+              str.append(buffer, formatDouble(buffer, sizeof(buffer), A(i,k), 26, 18, TRUE));
+            str += '\n';
+          }
+        });
+        for(UInt c=0; c<count; c++)
+          stream.write(text.at(c).data(), text.at(c).size());
+      }
+    };
+
+    if(A.getType()==Matrix::GENERAL)
+    {
+      stream<<"Matrix( "<<A.rows()<<" x "<<A.columns()<<" )"<<std::endl;
+      saveRows([](UInt /*i*/) {return 0;}, [&](UInt /*i*/) {return A.columns();});
+      stream<<'\n';
       return;
     }
 
@@ -312,23 +338,9 @@ void OutArchiveAscii::save(const const_MatrixSlice &A)
     stream<<"( "<<A.rows()<<" x "<<A.columns()<<" )"<<std::endl;
 
     if(A.isUpper())
-    {
-      for(UInt i=0; i<A.rows(); i++)
-      {
-        for(UInt k=i; k<A.columns(); k++)
-          saveDouble(A(i,k));
-        stream<<std::endl;
-      }
-    }
+      saveRows([](UInt i) {return i;}, [&](UInt /*i*/) {return A.columns();});
     else
-    {
-      for(UInt i=0; i<A.rows(); i++)
-      {
-        for(UInt k=0; k<=i; k++)
-          saveDouble(A(i,k));
-        stream<<std::endl;
-      }
-    }
+      saveRows([](UInt /*i*/) {return 0;}, [](UInt i) {return i+1;});
   }
   catch(std::exception &e)
   {
@@ -367,14 +379,11 @@ void InArchiveAscii::load(Matrix &A)
         if(line.empty())
           break;
         values.resize(i+1);
-        std::stringstream ss(line);
-        for(;;)
+        for(auto pos = line.find_first_not_of(" \t\r"); (pos != std::string::npos) && (line.at(pos) != '#');)
         {
-          std::string dummy;
-          ss>>dummy;
-          if(ss.fail() || ss.bad() || (dummy.at(0) == '#'))
-            break;
-          values.at(i).push_back(std::stod(dummy));
+          const auto end = std::min(line.find_first_of(" \t\r", pos), line.size());
+          values.at(i).push_back(String::toDouble(line, pos, end-pos));
+          pos = line.find_first_not_of(" \t\r", end);
         }
       }
       A = Matrix(values.size(), values.at(0).size());
@@ -387,12 +396,41 @@ void InArchiveAscii::load(Matrix &A)
     std::string type;
     UInt rows, columns;
     stream>>type>>rows>>c>>columns>>c;
+
+    // values are read line by line (faster than token extraction from stream)
+    std::string line;
+    std::size_t pos = 0;
+    auto readValue = [&]()
+    {
+      for(;;)
+      {
+        pos = line.find_first_not_of(" \t\r", pos);
+        if((pos != std::string::npos) && (line.at(pos) != '#'))
+          break;
+        if(!std::getline(stream, line))
+          throw(Exception("cannot read number"));
+        pos = 0;
+      }
+      // strtod directly in the line, the general parser handles the rest (e.g. Fortran exponent 'D')
+      const char *begin = line.c_str()+pos;
+      char *ptr;
+      Double x = std::strtod(begin, &ptr);
+      const char *end = ptr;
+      if((end == begin) || !(std::isspace(static_cast<unsigned char>(*end)) || (*end == '\0')))
+      {
+        end = line.c_str() + std::min(line.find_first_of(" \t\r", pos), line.size());
+        x   = String::toDouble(begin, end);
+      }
+      pos = end-line.c_str();
+      return x;
+    };
+
     if(type=="Matrix(")
     {
       A = Matrix(rows,columns);
       for(UInt i=0; i<A.rows(); i++)
         for(UInt k=0; k<A.columns(); k++)
-          A(i,k) = readDouble(stream);
+          A(i,k) = readValue();
       return;
     }
 
@@ -410,11 +448,11 @@ void InArchiveAscii::load(Matrix &A)
     if(A.isUpper())
       for(UInt i=0; i<A.rows(); i++)
         for(UInt k=i; k<A.columns(); k++)
-          A(i,k) = readDouble(stream);
+          A(i,k) = readValue();
     else
       for(UInt i=0; i<A.rows(); i++)
         for(UInt k=0; k<=i; k++)
-          A(i,k) = readDouble(stream);
+          A(i,k) = readValue();
   }
   catch(std::exception &e)
   {
@@ -456,12 +494,13 @@ void OutArchiveAscii::save(const SphericalHarmonics &harm)
       for(UInt m=0; m<=n; m++)
       {
         // RR: changed setw(4) to setw(5)
-        stream<<"gfc "<<std::setw(5)<<n<<std::setw(5)<<m;
+        char buffer[32];
+        stream.write(buffer, std::snprintf(buffer, sizeof(buffer), "gfc %5zu%5zu", n, m));
         saveDouble(harm.cnm()(n,m),20,12,TRUE);
         saveDouble(harm.snm()(n,m),20,12,TRUE);
         if(hasErrors) saveDouble(sqrt(harm.sigma2cnm()(n,m)),20,12,TRUE);
         if(hasErrors) saveDouble(sqrt(harm.sigma2snm()(n,m)),20,12,TRUE);
-        stream<<std::endl;
+        stream<<'\n';
       }
     stream<<std::endl;
   }
@@ -529,20 +568,29 @@ void InArchiveAscii::load(SphericalHarmonics &harm)
       }
       if(line.empty())
         break;
-      std::stringstream ss(line);
-      ss.exceptions(std::ios::badbit|std::ios::failbit);
-      std::string tag;
-      ss>>tag;
-      if((tag != "gfc")&&(tag != "gfct"))
+
+      // split line into tokens without a stream
+      std::size_t pos = 0;
+      auto token = [&]()
+      {
+        const auto start = line.find_first_not_of(" \t\r", pos);
+        if(start == std::string::npos)
+          throw(Exception("missing value in line: "+line));
+        pos = std::min(line.find_first_of(" \t\r", start), line.size());
+        return std::make_pair(line.data()+start, line.data()+pos);
+      };
+      const auto tag = token();
+      const std::string tagStr(tag.first, tag.second);
+      if((tagStr != "gfc")&&(tagStr != "gfct"))
         continue;
-      UInt n,m;
-      ss>>n>>m;
-      cnm(n,m) = readDouble(ss);
-      snm(n,m) = readDouble(ss);
+      auto t = token(); const UInt n = static_cast<UInt>(String::toInt(t.first, t.second));
+      t = token();      const UInt m = static_cast<UInt>(String::toInt(t.first, t.second));
+      t = token(); cnm(n,m) = String::toDouble(t.first, t.second);
+      t = token(); snm(n,m) = String::toDouble(t.first, t.second);
       if(hasErrors)
       {
-        sigma2cnm(n,m) = std::pow(readDouble(ss), 2);
-        sigma2snm(n,m) = std::pow(readDouble(ss), 2);
+        t = token(); sigma2cnm(n,m) = std::pow(String::toDouble(t.first, t.second), 2);
+        t = token(); sigma2snm(n,m) = std::pow(String::toDouble(t.first, t.second), 2);
       }
     }
 
@@ -245,8 +245,7 @@ void InArchiveBinary::load(GnssType &x)
 
 void OutArchiveBinary::save(const Vector &x)
 {
-  Matrix A = x;
-  save(A);
+  save(static_cast<const const_MatrixSlice&>(x));
 }
 
 /***********************************************/
@@ -263,9 +262,23 @@ void InArchiveBinary::load(Vector &x)
   }
   else
   {
-    Matrix A;
-    load(A);
-    x = A;
+    UInt type;
+    load(type);
+    if(static_cast<Matrix::Type>(type)!=Matrix::GENERAL)
+    {
+      Matrix A;
+      loadMatrix(type, A);
+      x = A;
+      return;
+    }
+    // column vector is read directly
+    UInt rows, columns;
+    load(rows); load(columns);
+    if(columns > 1)
+      throw(Exception("Matrix assignment to Vector with more than 1 column"));
+    x = Vector(rows*columns);
+    if(x.size())
+      stream.read(reinterpret_cast<char*>(x.field()), x.size()*sizeof(Double));
   }
 }
 
@@ -286,9 +299,16 @@ void OutArchiveBinary::save(const const_MatrixSlice &x)
       for(UInt s=0; s<x.columns(); s++)
         stream.write(reinterpret_cast<const char*>(&x(0,s)), x.rows()*sizeof(Double));
     else
+    {
+      // row major order: gather each column into a contiguous buffer
+      std::vector<Double> buffer(x.rows());
       for(UInt s=0; s<x.columns(); s++)
+      {
         for(UInt z=0; z<x.rows(); z++)
-          save(x(z,s));
+          buffer[z] = x(z,s);
+        stream.write(reinterpret_cast<const char*>(buffer.data()), buffer.size()*sizeof(Double));
+      }
+    }
   }
   else
   {
@@ -307,14 +327,16 @@ void OutArchiveBinary::save(const const_MatrixSlice &x)
     }
     else
     {
-      if(x.isUpper())
-        for(UInt s=0; s<x.columns(); s++)
-          for(UInt z=0; z<=s; z++)
-            save(x(z,s));
-      else
-        for(UInt s=0; s<x.columns(); s++)
-          for(UInt z=s; z<x.rows(); z++)
-            save(x(z,s));
+      // row major order: gather the triangular part of each column into a contiguous buffer
+      std::vector<Double> buffer(x.rows());
+      for(UInt s=0; s<x.columns(); s++)
+      {
+        const UInt start = x.isUpper() ? 0   : s;
+        const UInt count = x.isUpper() ? s+1 : x.rows()-s;
+        for(UInt z=0; z<count; z++)
+          buffer[z] = x(start+z,s);
+        stream.write(reinterpret_cast<const char*>(buffer.data()), count*sizeof(Double));
+      }
     }
   }
 }
@@ -325,6 +347,13 @@ void InArchiveBinary::load(Matrix &x)
 {
   UInt type;
   load(type);
+  loadMatrix(type, x);
+}
+
+/***********************************************/
+
+void InArchiveBinary::loadMatrix(UInt type, Matrix &x)
+{
   if(static_cast<Matrix::Type>(type)==Matrix::GENERAL)
   {
     UInt rows, columns;
@@ -358,6 +387,27 @@ void InArchiveBinary::load(Matrix &x)
 /***********************************************/
 /***********************************************/
 
+Bool OutArchiveBinary::saveBlock(const Double *x, UInt count)
+{
+  if(count)
+    stream.write(reinterpret_cast<const char*>(x), count*sizeof(Double));
+  return TRUE;
+}
+
+/***********************************************/
+
+Bool InArchiveBinary::loadBlock(Double *x, UInt count)
+{
+  if(oldVersion)
+    return FALSE;
+  if(count)
+    stream.read(reinterpret_cast<char*>(x), count*sizeof(Double));
+  return TRUE;
+}
+
+/***********************************************/
+/***********************************************/
+
 void OutArchiveBinary::save(const SphericalHarmonics &harm)
 {
   save(harm.GM());
@@ -32,6 +32,7 @@ public:
   OutArchiveBinary &operator=(const OutArchiveBinary &) = delete;
 
   ArchiveType archiveType() const override {return BINARY;}
+  Bool saveBlock(const Double *x, UInt count) override;
 
 protected:
   void save(const std::string &x) override;
@@ -68,6 +69,7 @@ public:
   ArchiveType archiveType() const override {return BINARY;}
   std::string type()        const override {return typeStr;}
   UInt        version()     const override {return _version;}
+  Bool loadBlock(Double *x, UInt count) override;
 
 protected:
   void load(std::string &x) override;
@@ -82,6 +84,9 @@ protected:
   void load(SphericalHarmonics &x) override;
   void load(Doodson  &x) override;
   void load(GnssType &x) override;
+
+private:
+  void loadMatrix(UInt type, Matrix &x);
 };
 
 /***********************************************/
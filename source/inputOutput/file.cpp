@@ -14,7 +14,16 @@
 #include "base/constants.h"
 #include "base/string.h"
 #include "external/compress.h"
+#include "parallel/threadPool.h"
+#include "inputOutput/profiler.h"
 #include "file.h"
+#include <cstring>
+#include <cstdio>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
 
 /***** CLASS ***********************************/
 
@@ -159,18 +168,626 @@ StreambufGZ::int_type StreambufGZ::sync()
   return 0;
 }
 
+/***********************************************/
+/***** CLASS ***********************************/
+/***********************************************/
+
+// gz files with helper threads (used if more than one thread is available).
+// Output is compressed in blocks as independent gzip members (like pigz/bgzip) in parallel,
+// the concatenated members are a valid gz file for all readers.
+// Input is decompressed ahead in a helper thread.
+class StreambufGZThreaded : public std::streambuf
+{
+private:
+  static constexpr UInt blockSize   = 1024*1024; // uncompressed size of blocks
+  static constexpr UInt putbackSize = 4;
+  static constexpr UInt maxChunks   = 4;         // decompressed blocks ahead
+
+  Bool               opened;
+  std::ios::openmode mode;
+
+  // output
+  std::FILE                            *fileOut;
+  std::vector<char>                     blockOut;
+  std::deque<std::future<std::string>>  jobs;
+  UInt                                  maxJobs;
+  Bool                                  written, failed;
+
+  // input
+  zlib::gzFile                  fileIn;
+  std::thread                   reader;
+  std::mutex                    mutex;
+  std::condition_variable       conditionFilled, conditionEmptied;
+  std::deque<std::vector<char>> chunks;
+  std::vector<char>             current;
+  Bool                          eof, stopReading;
+
+  static std::string compress(const std::string &data);
+  Bool writeJob();
+  StreambufGZThreaded::int_type flush_buffer();
+  void readAhead();
+
+public:
+  StreambufGZThreaded() : opened(FALSE), fileOut(nullptr), maxJobs(1), written(FALSE), failed(FALSE), eof(FALSE), stopReading(FALSE) {}
+ ~StreambufGZThreaded() {close();}
+
+  bool is_open() const {return opened;}
+
+  StreambufGZThreaded *open(const FileName &fileName, std::ios::openmode openMode);
+  StreambufGZThreaded *close();
+
+  virtual StreambufGZThreaded::int_type underflow() override;
+  virtual StreambufGZThreaded::int_type overflow(StreambufGZThreaded::int_type c) override;
+  virtual StreambufGZThreaded::int_type sync() override;
+};
+
+/***********************************************/
+
+// compress a block as single gzip member
+std::string StreambufGZThreaded::compress(const std::string &data)
+{
+  zlib::z_stream stream;
+  std::memset(&stream, 0, sizeof(stream));
+  if(zlib::deflateInit2_(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15+16/*gzip header*/, 8, Z_DEFAULT_STRATEGY,
+                         ZLIB_VERSION, static_cast<int>(sizeof(zlib::z_stream))) != Z_OK)
+    throw(Exception("cannot initialize zlib compression"));
+  std::string result(zlib::deflateBound(&stream, data.size()), '\0');
+  stream.next_in   = reinterpret_cast<zlib::Bytef*>(const_cast<char*>(data.data()));
+  stream.avail_in  = static_cast<zlib::uInt>(data.size());
+  stream.next_out  = reinterpret_cast<zlib::Bytef*>(&result[0]);
+  stream.avail_out = static_cast<zlib::uInt>(result.size());
+  const int status = zlib::deflate(&stream, Z_FINISH);
+  result.resize(stream.total_out);
+  zlib::deflateEnd(&stream);
+  if(status != Z_STREAM_END)
+    throw(Exception("zlib compression failed"));
+  return result;
+}
+
+/***********************************************/
+
+// write the oldest compressed block to file
+Bool StreambufGZThreaded::writeJob()
+{
+  try
+  {
+    const std::string data = jobs.front().get();
+    jobs.pop_front();
+    if(std::fwrite(data.data(), 1, data.size(), fileOut) != data.size())
+      failed = TRUE;
+    written = TRUE;
+  }
+  catch(...)
+  {
+    jobs.pop_front();
+    failed = TRUE;
+  }
+  return !failed;
+}
+
+/***********************************************/
+
+StreambufGZThreaded::int_type StreambufGZThreaded::flush_buffer()
+{
+  auto w = pptr() - pbase();
+  if(w > 0)
+  {
+    jobs.push_back(std::async(std::launch::async, &StreambufGZThreaded::compress, std::string(pbase(), w)));
+    setp(blockOut.data(), blockOut.data()+blockOut.size());
+  }
+  while(jobs.size() > maxJobs)
+    if(!writeJob())
+      return traits_type::eof();
+  return w;
+}
+
+/***********************************************/
+
+void StreambufGZThreaded::readAhead()
+{
+  for(;;)
+  {
+    std::vector<char> chunk(putbackSize+blockSize);
+    const auto num = zlib::gzread(fileIn, chunk.data()+putbackSize, blockSize);
+    std::unique_lock<std::mutex> lock(mutex);
+    if(num <= 0) // ERROR or EOF
+    {
+      eof = TRUE;
+      conditionFilled.notify_all();
+      return;
+    }
+    chunk.resize(putbackSize+num);
+    conditionEmptied.wait(lock, [&]{return stopReading || (chunks.size() < maxChunks);});
+    if(stopReading)
+      return;
+    chunks.push_back(std::move(chunk));
+    conditionFilled.notify_all();
+  }
+}
+
+/***********************************************/
+
+StreambufGZThreaded *StreambufGZThreaded::open(const FileName &fileName, std::ios::openmode openMode)
+{
+  if(is_open())
+    return nullptr;
+  mode = openMode;
+  // no append nor read/write mode
+  if((mode & std::ios::ate) || (mode & std::ios::app) || ((mode & std::ios::in) && (mode & std::ios::out)))
+    throw(Exception("openMode combination not allowed for .gz files"));
+
+  if(mode & std::ios::out)
+  {
+    fileOut = std::fopen(fileName.c_str(), "wb");
+    if(!fileOut)
+      return nullptr;
+    blockOut.resize(blockSize);
+    setp(blockOut.data(), blockOut.data()+blockOut.size());
+    maxJobs = 2*Parallel::threadCount();
+    written = failed = FALSE;
+  }
+  else
+  {
+    fileIn = zlib::gzopen(fileName.c_str(), "rb");
+    if(!fileIn)
+      return nullptr;
+    eof = stopReading = FALSE;
+    current.assign(putbackSize, 0);
+    setg(current.data()+putbackSize, current.data()+putbackSize, current.data()+putbackSize);
+    reader = std::thread(&StreambufGZThreaded::readAhead, this);
+  }
+  opened = TRUE;
+  return this;
+}
+
+/***********************************************/
+
+StreambufGZThreaded *StreambufGZThreaded::close()
+{
+  if(!is_open())
+    return nullptr;
+  opened = FALSE;
+
+  if(mode & std::ios::out)
+  {
+    if(flush_buffer() == traits_type::eof())
+      failed = TRUE;
+    if(!written && jobs.empty()) // empty file must be a valid gz file
+      jobs.push_back(std::async(std::launch::async, &StreambufGZThreaded::compress, std::string()));
+    while(jobs.size())
+      writeJob();
+    if(std::fclose(fileOut) != 0)
+      failed = TRUE;
+    fileOut = nullptr;
+    return failed ? nullptr : this;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopReading = TRUE;
+  }
+  conditionEmptied.notify_all();
+  reader.join();
+  chunks.clear();
+  return (zlib::gzclose(fileIn) == Z_OK) ? this : nullptr;
+}
+
+/***********************************************/
+
+// used for input buffer only
+StreambufGZThreaded::int_type StreambufGZThreaded::underflow()
+{
+  if(gptr() && (gptr() < egptr()))
+    return traits_type::to_int_type(*gptr());
+
+  if(!(mode & std::ios::in) || !opened)
+    return traits_type::eof();
+
+  std::vector<char> chunk;
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    conditionFilled.wait(lock, [&]{return eof || chunks.size();});
+    if(chunks.empty())
+      return traits_type::eof();
+    chunk = std::move(chunks.front());
+    chunks.pop_front();
+  }
+  conditionEmptied.notify_all();
+
+  // keep putback area
+  auto n_putback = gptr() - eback();
+  if(n_putback > static_cast<decltype(n_putback)>(putbackSize))
+    n_putback = putbackSize;
+  std::memcpy(chunk.data()+(putbackSize-n_putback), gptr()-n_putback, n_putback);
+  std::swap(current, chunk);
+  setg(current.data()+(putbackSize-n_putback), current.data()+putbackSize, current.data()+current.size()); // beginning of putback area, read position, end of buffer
+
+  return traits_type::to_int_type(*gptr()); // return next character
+}
+
+/***********************************************/
+
+// used for output buffer only
+StreambufGZThreaded::int_type StreambufGZThreaded::overflow(StreambufGZThreaded::int_type c)
+{
+  if(!(mode & std::ios::out) || !opened)
+    return traits_type::eof();
+  if(flush_buffer() == traits_type::eof())
+    return traits_type::eof();
+  if(c != traits_type::eof())
+  {
+    *pptr() = c;
+    pbump(1);
+  }
+  return c;
+}
+
+/***********************************************/
+
+// blocks are written when full or at close
+StreambufGZThreaded::int_type StreambufGZThreaded::sync()
+{
+  return failed ? -1 : 0;
+}
+
 #endif // LIB_Z
 
 /***********************************************/
 /***** CLASS ***********************************/
 /***********************************************/
 
+#ifdef GROOPS_DISABLE_ZSTD
+#else
+
+#include <zstd.h>
+
+// zst files (https://facebook.github.io/zstd).
+// Output is compressed by the worker threads of the library (if more than one thread is available),
+// concatenated frames are read as one stream.
+class StreambufZstd : public std::streambuf
+{
+private:
+  static constexpr UInt blockSize   = 1024*1024; // uncompressed size of output buffer
+  static constexpr UInt putbackSize = 4;
+
+  Bool               opened;
+  std::ios::openmode mode;
+  std::FILE         *file;
+  ZSTD_CCtx         *cctx;
+  ZSTD_DCtx         *dctx;
+  std::vector<char>  data;   // uncompressed
+  std::vector<char>  packed; // compressed
+  ZSTD_inBuffer      input;  // compressed input not yet decompressed
+
+  Bool compress(ZSTD_EndDirective directive);
+
+public:
+  StreambufZstd() : opened(FALSE), file(nullptr), cctx(nullptr), dctx(nullptr) {}
+ ~StreambufZstd() {close();}
+
+  bool is_open() const {return opened;}
+
+  StreambufZstd *open(const FileName &fileName, std::ios::openmode openMode);
+  StreambufZstd *close();
+
+  virtual StreambufZstd::int_type underflow() override;
+  virtual StreambufZstd::int_type overflow(StreambufZstd::int_type c) override;
+  virtual StreambufZstd::int_type sync() override;
+};
+
+/***********************************************/
+
+// compress the output buffer and write the result to file
+Bool StreambufZstd::compress(ZSTD_EndDirective directive)
+{
+  ZSTD_inBuffer in = {pbase(), static_cast<std::size_t>(pptr()-pbase()), 0};
+  for(;;)
+  {
+    ZSTD_outBuffer out = {packed.data(), packed.size(), 0};
+    const std::size_t remaining = ZSTD_compressStream2(cctx, &out, &in, directive);
+    if(ZSTD_isError(remaining))
+      return FALSE;
+    if(out.pos && (std::fwrite(packed.data(), 1, out.pos, file) != out.pos))
+      return FALSE;
+    if((directive == ZSTD_e_continue) ? (in.pos == in.size) : (remaining == 0))
+      break;
+  }
+  setp(data.data(), data.data()+data.size());
+  return TRUE;
+}
+
+/***********************************************/
+
+StreambufZstd *StreambufZstd::open(const FileName &fileName, std::ios::openmode openMode)
+{
+  if(is_open())
+    return nullptr;
+  mode = openMode;
+  // no append nor read/write mode
+  if((mode & std::ios::ate) || (mode & std::ios::app) || ((mode & std::ios::in) && (mode & std::ios::out)))
+    throw(Exception("openMode combination not allowed for .zst files"));
+
+  file = std::fopen(fileName.c_str(), (mode & std::ios::out) ? "wb" : "rb");
+  if(!file)
+    return nullptr;
+
+  if(mode & std::ios::out)
+  {
+    cctx = ZSTD_createCCtx();
+    ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel, ZSTD_CLEVEL_DEFAULT);
+    ZSTD_CCtx_setParameter(cctx, ZSTD_c_checksumFlag, 1);
+    if((Parallel::threadCount() > 1) && !Parallel::isThreadWorker())
+      ZSTD_CCtx_setParameter(cctx, ZSTD_c_nbWorkers, static_cast<int>(Parallel::threadCount())); // fails silently without multithreading support
+    data.resize(blockSize);
+    packed.resize(ZSTD_CStreamOutSize());
+    setp(data.data(), data.data()+data.size());
+  }
+  else
+  {
+    dctx = ZSTD_createDCtx();
+    data.resize(putbackSize+ZSTD_DStreamOutSize());
+    packed.resize(ZSTD_DStreamInSize());
+    input = {packed.data(), 0, 0};
+    setg(data.data()+putbackSize, data.data()+putbackSize, data.data()+putbackSize);
+  }
+  opened = TRUE;
+  return this;
+}
+
+/***********************************************/
+
+StreambufZstd *StreambufZstd::close()
+{
+  if(!is_open())
+    return nullptr;
+  opened = FALSE;
+
+  Bool ok = TRUE;
+  if(mode & std::ios::out)
+  {
+    ok = compress(ZSTD_e_end);
+    ZSTD_freeCCtx(cctx);
+    cctx = nullptr;
+  }
+  else
+  {
+    ZSTD_freeDCtx(dctx);
+    dctx = nullptr;
+  }
+  ok = (std::fclose(file) == 0) && ok;
+  file = nullptr;
+  return ok ? this : nullptr;
+}
+
+/***********************************************/
+
+// used for input buffer only
+StreambufZstd::int_type StreambufZstd::underflow()
+{
+  if(gptr() && (gptr() < egptr()))
+    return traits_type::to_int_type(*gptr());
+
+  if(!(mode & std::ios::in) || !opened)
+    return traits_type::eof();
+
+  // keep putback area
+  auto n_putback = gptr() - eback();
+  if(n_putback > static_cast<decltype(n_putback)>(putbackSize))
+    n_putback = putbackSize;
+  std::memmove(data.data()+(putbackSize-n_putback), gptr()-n_putback, n_putback);
+
+  ZSTD_outBuffer out = {data.data()+putbackSize, data.size()-putbackSize, 0};
+  for(;;)
+  {
+    const std::size_t status = ZSTD_decompressStream(dctx, &out, &input);
+    if(ZSTD_isError(status))
+      return traits_type::eof();
+    if(out.pos)
+      break;
+    // need more input
+    input.size = std::fread(packed.data(), 1, packed.size(), file);
+    input.pos  = 0;
+    if(input.size == 0) // ERROR or EOF
+      return traits_type::eof();
+  }
+
+  setg(data.data()+(putbackSize-n_putback), data.data()+putbackSize, data.data()+putbackSize+out.pos); // beginning of putback area, read position, end of buffer
+  return traits_type::to_int_type(*gptr()); // return next character
+}
+
+/***********************************************/
+
+// used for output buffer only
+StreambufZstd::int_type StreambufZstd::overflow(StreambufZstd::int_type c)
+{
+  if(!(mode & std::ios::out) || !opened || !compress(ZSTD_e_continue))
+    return traits_type::eof();
+  if(c != traits_type::eof())
+  {
+    *pptr() = c;
+    pbump(1);
+  }
+  return c;
+}
+
+/***********************************************/
+
+// data is handed over to the compressor, frames are finished at close
+StreambufZstd::int_type StreambufZstd::sync()
+{
+  if((mode & std::ios::out) && opened && (pptr() > pbase()) && !compress(ZSTD_e_continue))
+    return -1;
+  return 0;
+}
+
+#endif // LIB_ZSTD
+
+/***********************************************/
+/***** CLASS ***********************************/
+/***********************************************/
+
+// uncompressed output with a background writer thread (used for archives if more than one thread is available).
+// Full blocks are handed to the writer thread, at most maxBlocks are pending.
+class StreambufAsync : public std::streambuf
+{
+private:
+  static constexpr UInt blockSize = 1024*1024;
+  static constexpr UInt maxBlocks = 8;
+
+  std::FILE                    *file;
+  std::vector<char>             block;
+  std::thread                   writer;
+  std::mutex                    mutex;
+  std::condition_variable       conditionFilled, conditionEmptied;
+  std::deque<std::vector<char>> blocks;
+  Bool                          stopWriting, failed;
+  UInt                          memoryCategory; // accounting of allocated blocks
+
+  void write();
+  StreambufAsync::int_type flush_buffer();
+
+public:
+  StreambufAsync() : file(nullptr), stopWriting(FALSE), failed(FALSE), memoryCategory(Profiler::memoryCategoryIndex("file buffers")) {}
+ ~StreambufAsync() {close();}
+
+  bool is_open() const {return file != nullptr;}
+
+  StreambufAsync *open(const FileName &fileName, std::ios::openmode openMode);
+  StreambufAsync *close();
+
+  virtual StreambufAsync::int_type overflow(StreambufAsync::int_type c) override;
+  virtual StreambufAsync::int_type sync() override;
+};
+
+/***********************************************/
+
+// writer thread
+void StreambufAsync::write()
+{
+  for(;;)
+  {
+    std::vector<char> data;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      conditionFilled.wait(lock, [&]{return stopWriting || blocks.size();});
+      if(blocks.empty()) // stopped and all blocks written
+        return;
+      data = std::move(blocks.front());
+      blocks.pop_front();
+    }
+    conditionEmptied.notify_all();
+    if(std::fwrite(data.data(), 1, data.size(), file) != data.size())
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      failed = TRUE;
+    }
+    Profiler::memoryAdd(memoryCategory, -static_cast<Int64>(blockSize));
+  }
+}
+
+/***********************************************/
+
+StreambufAsync::int_type StreambufAsync::flush_buffer()
+{
+  auto w = pptr() - pbase();
+  if(w > 0)
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    conditionEmptied.wait(lock, [&]{return blocks.size() < maxBlocks;});
+    if(failed)
+      return traits_type::eof();
+    block.resize(w);
+    blocks.push_back(std::move(block));
+    block.resize(blockSize);
+    Profiler::memoryAdd(memoryCategory, blockSize);
+    setp(block.data(), block.data()+block.size());
+  }
+  conditionFilled.notify_all();
+  return w;
+}
+
+/***********************************************/
+
+StreambufAsync *StreambufAsync::open(const FileName &fileName, std::ios::openmode openMode)
+{
+  if(is_open() || (openMode & std::ios::in) || (openMode & std::ios::app) || (openMode & std::ios::ate))
+    return nullptr;
+  file = std::fopen(fileName.c_str(), "wb");
+  if(!file)
+    return nullptr;
+  block.resize(blockSize);
+  Profiler::memoryAdd(memoryCategory, blockSize);
+  setp(block.data(), block.data()+block.size());
+  stopWriting = failed = FALSE;
+  writer = std::thread(&StreambufAsync::write, this);
+  return this;
+}
+
+/***********************************************/
+
+StreambufAsync *StreambufAsync::close()
+{
+  if(!is_open())
+    return nullptr;
+  Bool ok = (flush_buffer() != traits_type::eof());
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopWriting = TRUE;
+  }
+  conditionFilled.notify_all();
+  writer.join();
+  blocks.clear();
+  std::vector<char>().swap(block);
+  Profiler::memoryAdd(memoryCategory, -static_cast<Int64>(blockSize));
+  setp(nullptr, nullptr);
+  ok = (std::fclose(file) == 0) && ok && !failed;
+  file = nullptr;
+  return ok ? this : nullptr;
+}
+
+/***********************************************/
+
+StreambufAsync::int_type StreambufAsync::overflow(StreambufAsync::int_type c)
+{
+  if(!is_open() || (flush_buffer() == traits_type::eof()))
+    return traits_type::eof();
+  if(c != traits_type::eof())
+  {
+    *pptr() = c;
+    pbump(1);
+  }
+  return c;
+}
+
+/***********************************************/
+
+// blocks are written when full or at close
+StreambufAsync::int_type StreambufAsync::sync()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return failed ? -1 : 0;
+}
+
+/***********************************************/
+/***** CLASS ***********************************/
+/***********************************************/
+
 StreamBase::StreamBase() : buffer(nullptr), canSeek_(FALSE) {}
-StreamBase::~StreamBase() {close();}
+
+StreamBase::~StreamBase()
+{
+  try
+  {
+    close();
+  }
+  catch(std::exception &/*e*/)
+  {
+  }
+}
 
 /***********************************************/
 
-void StreamBase::open(const FileName &fileName, std::ios::openmode openMode)
+void StreamBase::open(const FileName &fileName, std::ios::openmode openMode, Bool asynchronous)
 {
   try
   {
@@ -187,14 +804,17 @@ void StreamBase::open(const FileName &fileName, std::ios::openmode openMode)
     if(openMode == std::ios::in)
     {
       std::ifstream file(fileName.c_str(), std::ios::binary);
-      unsigned char magic[2] = {0};
+      unsigned char magic[4] = {0};
       file.read(reinterpret_cast<char*>(magic), sizeof(magic));
       const unsigned char magicCompress[2] = {0x1f, 0x9d};
       const unsigned char magicZlib[2]     = {0x1f, 0x8b};
-      if(std::memcmp(magic, magicZlib, sizeof(magic)) == 0)
+      const unsigned char magicZstd[4]     = {0x28, 0xb5, 0x2f, 0xfd};
+      if(std::memcmp(magic, magicZlib, sizeof(magicZlib)) == 0)
         fileFormat = "GZ";
-      else if(std::memcmp(magic, magicCompress, sizeof(magic)) == 0)
+      else if(std::memcmp(magic, magicCompress, sizeof(magicCompress)) == 0)
         fileFormat = "Z";
+      else if(std::memcmp(magic, magicZstd, sizeof(magicZstd)) == 0)
+        fileFormat = "ZST";
     }
 
     if(fileFormat == "GZ")
@@ -202,9 +822,31 @@ void StreamBase::open(const FileName &fileName, std::ios::openmode openMode)
 #ifdef GROOPS_DISABLE_Z
       throw(Exception("compiled without Z library"));
 #else
-      buffer = new StreambufGZ();
+      if((Parallel::threadCount() > 1) && !Parallel::isThreadWorker())
+      {
+        buffer = new StreambufGZThreaded();
+        std::ios::init(buffer);
+        if(!static_cast<StreambufGZThreaded*>(buffer)->open(fileName, openMode))
+          clear(rdstate() | std::ios::badbit);
+      }
+      else
+      {
+        buffer = new StreambufGZ();
+        std::ios::init(buffer);
+        if(!static_cast<StreambufGZ*>(buffer)->open(fileName, openMode))
+          clear(rdstate() | std::ios::badbit);
+      }
+      canSeek_ = FALSE;
+#endif
+    }
+    else if(fileFormat == "ZST")
+    {
+#ifdef GROOPS_DISABLE_ZSTD
+      throw(Exception("compiled without zstd library"));
+#else
+      buffer = new StreambufZstd();
       std::ios::init(buffer);
-      if(!static_cast<StreambufGZ*>(buffer)->open(fileName, openMode))
+      if(!static_cast<StreambufZstd*>(buffer)->open(fileName, openMode))
         clear(rdstate() | std::ios::badbit);
       canSeek_ = FALSE;
 #endif
@@ -217,6 +859,15 @@ void StreamBase::open(const FileName &fileName, std::ios::openmode openMode)
       buffer = new std::stringbuf(decompress_file(fileName.c_str()));
       std::ios::init(buffer);
     }
+    else if(asynchronous && (Parallel::threadCount() > 1) && !Parallel::isThreadWorker() &&
+            !((openMode & std::ios::in) || (openMode & std::ios::app) || (openMode & std::ios::ate)))
+    {
+      buffer = new StreambufAsync();
+      std::ios::init(buffer);
+      if(!static_cast<StreambufAsync*>(buffer)->open(fileName, openMode))
+        clear(rdstate() | std::ios::badbit);
+      canSeek_ = FALSE;
+    }
     else
     {
       buffer = new std::filebuf();
@@ -241,12 +892,22 @@ void StreamBase::close()
 {
   try
   {
+    Bool failed = FALSE;
     if(buffer)
     {
+      // wait for background writer
+      if(dynamic_cast<StreambufAsync*>(buffer))
+        failed = !static_cast<StreambufAsync*>(buffer)->close();
+#ifndef GROOPS_DISABLE_ZSTD
+      if(dynamic_cast<StreambufZstd*>(buffer))
+        failed = !static_cast<StreambufZstd*>(buffer)->close();
+#endif
       delete buffer;
       buffer = nullptr;
       std::ios::init(nullptr);
     }
+    if(failed)
+      throw(Exception("error by writing file"));
     fileName_ = FileName();
     canSeek_  = FALSE;
   }
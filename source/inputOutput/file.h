@@ -36,7 +36,7 @@ public:
   StreamBase(const StreamBase &) = delete;
   StreamBase &operator=(const StreamBase &) = delete;
 
-  void open(const FileName &fileName, std::ios::openmode openMode);
+  void open(const FileName &fileName, std::ios::openmode openMode, Bool asynchronous=FALSE);
   void close();
 
   FileName fileName() const {return fileName_;}
@@ -55,7 +55,10 @@ public:
   OutFile(const OutFile &) = delete;
   OutFile &operator=(const OutFile &) = delete;
 
-  void open(const FileName &fileName, std::ios::openmode openMode=std::ios::out) {StreamBase::open(fileName, openMode);}
+  /** @brief Open file for writing.
+  * With @p asynchronous the output is written by a background thread (if threads are available).
+  * close() waits until all data are written. */
+  void open(const FileName &fileName, std::ios::openmode openMode=std::ios::out, Bool asynchronous=FALSE) {StreamBase::open(fileName, openMode, asynchronous);}
   void close() {StreamBase::close();}
 
   OutFile &operator<<(std::ostream  &(*pf)(std::ostream  &)) {pf(*this); return *this;}
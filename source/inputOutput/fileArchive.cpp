@@ -29,9 +29,21 @@ OutFileArchive::OutFileArchive(const FileName &fileName, const std::string &type
 
 /***********************************************/
 
-OutFileArchive::~OutFileArchive()
+// write errors of the background writer are reported at close
+OutFileArchive::~OutFileArchive() noexcept(false)
 {
-  close();
+  if(!std::uncaught_exception())
+  {
+    close();
+    return;
+  }
+  try
+  {
+    close();
+  }
+  catch(std::exception &/*e*/)
+  {
+  }
 }
 
 /***********************************************/
@@ -40,6 +52,7 @@ void OutFileArchive::open(const FileName &fileName, const std::string &type)
 {
   try
   {
+    GROOPS_PROFILE("OutFileArchive::open")
     close();
     if(fileName.empty())
       return;
@@ -48,19 +61,19 @@ void OutFileArchive::open(const FileName &fileName, const std::string &type)
     const std::string extension = String::upperCase(fileName.typeExtension());
     if(extension == "XML")
     {
-      file.open(fileName);
+      file.open(fileName, std::ios::out, TRUE/*asynchronous*/);
       file.exceptions(std::ios::badbit | std::ios::failbit);
       archive = new OutArchiveXml(file, type, FILE_VERSION);
     }
     else if(extension == "DAT")
     {
-      file.open(fileName, std::ios::binary | std::ios::out);
+      file.open(fileName, std::ios::binary | std::ios::out, TRUE/*asynchronous*/);
       file.exceptions(std::ios::badbit | std::ios::failbit);
       archive = new OutArchiveBinary(file, type, FILE_VERSION);
     }
     else
     {
-      file.open(fileName);
+      file.open(fileName, std::ios::out, TRUE/*asynchronous*/);
       file.exceptions(std::ios::badbit | std::ios::failbit);
       archive = new OutArchiveAscii(file, type, FILE_VERSION);
     }
@@ -112,6 +125,7 @@ void InFileArchive::open(const FileName &fileName, const std::string &typeStr)
 {
   try
   {
+    GROOPS_PROFILE("InFileArchive::open")
     close();
     if(fileName.empty())
       return;
@@ -16,6 +16,7 @@
 #include "base/exception.h"
 #include "inputOutput/archive.h"
 #include "inputOutput/file.h"
+#include "inputOutput/profiler.h"
 
 /** @addtogroup archiveGroup */
 /// @{
@@ -38,7 +39,7 @@ class OutFileArchive
 public:
   OutFileArchive() : archive(nullptr)  {}
   OutFileArchive(const FileName &fileName, const std::string &type);
- ~OutFileArchive();
+ ~OutFileArchive() noexcept(false);
 
   OutFileArchive(const InFile &) = delete;
   OutFileArchive &operator=(const InFile &) = delete;
@@ -80,6 +81,8 @@ public:
   std::streampos position();
   void           seek(std::streampos pos);
 
+  InArchive &inArchive() {return *archive;}
+
   template<typename T> inline InFileArchive &operator>>(T &x);
   template<typename T> inline InFileArchive &operator>>(const T &x);
 };
@@ -95,6 +98,7 @@ inline OutFileArchive &OutFileArchive::operator<<(const T &x)
 {
   try
   {
+    GROOPS_PROFILE("OutFileArchive::write")
     if(!archive)
       throw(Exception("no file open"));
     (*archive)<<x;
@@ -113,6 +117,7 @@ inline InFileArchive &InFileArchive::operator>>(T &x)
 {
   try
   {
+    GROOPS_PROFILE("InFileArchive::read")
     if(!archive)
       throw(Exception("no file open"));
     (*archive)>>x;
@@ -131,6 +136,7 @@ inline InFileArchive &InFileArchive::operator>>(const T &x)
 {
   try
   {
+    GROOPS_PROFILE("InFileArchive::read")
     if(!archive)
       throw(Exception("no file open"));
     (*archive)>>x;
@@ -0,0 +1,136 @@
+/***********************************************/
+/**
+* @file fileCache.cpp
+*
+* @brief Process wide cache of read-only model files.
+*
+* @author GROOPS Developers
+* @date 2026-10-15
+*
+*/
+/***********************************************/
+
+#include "base/importStd.h"
+#include "inputOutput/system.h"
+#include "inputOutput/profiler.h"
+#include "inputOutput/fileCache.h"
+#include <mutex>
+
+/***********************************************/
+
+namespace FileCache
+{
+  class Entry
+  {
+  public:
+    std::string                 key;
+    std::shared_ptr<const void> object;
+    UInt                        size;
+  };
+
+  static std::mutex       mutex;
+  static UInt             maxSize  = 1024*1024*1024;
+  static UInt             usedSize = 0;
+  static std::list<Entry> entries; // most recently used first
+
+  static thread_local Parallel::CommunicatorPtr commNodeShared;
+}
+
+/***********************************************/
+
+void FileCache::setMaxSize(UInt bytes)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  maxSize = bytes;
+  while(entries.size() && (usedSize > maxSize))
+  {
+    usedSize -= entries.back().size;
+    entries.pop_back();
+  }
+}
+
+/***********************************************/
+
+void FileCache::clear()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  entries.clear();
+  usedSize = 0;
+}
+
+/***********************************************/
+
+FileCache::NodeShared::NodeShared(Parallel::CommunicatorPtr comm) : commOld(commNodeShared)
+{
+  commNodeShared = comm;
+}
+
+/***********************************************/
+
+FileCache::NodeShared::~NodeShared()
+{
+  commNodeShared = commOld;
+}
+
+/***********************************************/
+
+Parallel::CommunicatorPtr FileCache::nodeSharedCommunicator()
+{
+  return commNodeShared;
+}
+
+/***********************************************/
+
+std::string FileCache::key(const std::string &type, const FileName &fileName, UInt &size)
+{
+  try
+  {
+    size = 0;
+    if(!maxSize || fileName.empty())
+      return std::string();
+    const std::string status = System::fileStatus(fileName); // size:modification time
+    if(status.empty())
+      return std::string();
+    size = static_cast<UInt>(std::stoull(status));
+    if(size > maxSize)
+      return std::string();
+    return type+"|"+fileName.str()+"|"+status;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+std::shared_ptr<const void> FileCache::find(const std::string &key)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  auto iter = std::find_if(entries.begin(), entries.end(), [&](const Entry &entry) {return entry.key == key;});
+  if(iter == entries.end())
+    return nullptr;
+  entries.splice(entries.begin(), entries, iter); // move to front
+  Profiler::count("file cache hits [MB]", 1e-6*iter->size);
+  return iter->object;
+}
+
+/***********************************************/
+
+void FileCache::insert(const std::string &key, std::shared_ptr<const void> object, UInt size)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  if(size > maxSize)
+    return;
+  if(std::any_of(entries.begin(), entries.end(), [&](const Entry &entry) {return entry.key == key;})) // read concurrently by another thread
+    return;
+  entries.push_front(Entry{key, object, size});
+  usedSize += size;
+  while(usedSize > maxSize)
+  {
+    usedSize -= entries.back().size;
+    entries.pop_back();
+  }
+}
+
+/***********************************************/
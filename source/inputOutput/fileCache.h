@@ -0,0 +1,155 @@
+/***********************************************/
+/**
+* @file fileCache.h
+*
+* @brief Process wide cache of read-only model files.
+*
+* The same large files (e.g. ocean tides, static gravity fields, earth orientation parameter)
+* are often read by several class instances or in every iteration of a loop.
+* The cache keeps the objects already read, keyed by type, file name, size and modification time of the file.
+* The returned copies share the memory of matrices with the cached object until they are modified (copy-on-write).
+* Other expensive read-only objects (e.g. Legendre functions of grid rows) can be stored with find/insert under their own keys.
+* The size of the cache is limited with the command line option --file-cache.
+* Within the scope of a FileCache::NodeShared object the matrices of the files are stored only once
+* per shared memory node (see Parallel::broadCastShared()).
+*
+* @author GROOPS Developers
+* @date 2026-10-15
+*
+*/
+/***********************************************/
+
+#ifndef __GROOPS_FILECACHE__
+#define __GROOPS_FILECACHE__
+
+#include "base/importStd.h"
+#include "inputOutput/fileName.h"
+#include "parallel/parallel.h"
+#include <typeinfo>
+
+/** @addtogroup inputOutputGroup */
+/// @{
+
+/***** FUNCTIONS *******************************/
+
+/** @brief Process wide cache of read-only model files. */
+namespace FileCache
+{
+  /** @brief Maximum size of all cached files in bytes (sum of the file sizes on disk).
+  * Zero disables the cache. Default: 1 GB. */
+  void setMaxSize(UInt bytes);
+
+  /** @brief Removes all objects from the cache. */
+  void clear();
+
+  /** @brief Reads the object @p x from @p fileName.
+  * If the unchanged file was read before as the same @p fileType, a copy of the cached object is returned.
+  * Otherwise @p readFunc is called and the object is stored in the cache.
+  * Within the scope of a NodeShared object only the master reads the file
+  * and @p broadCastFunc distributes the object (if given). */
+  template<typename T> void read(const FileName &fileName, const std::string &fileType, T &x, std::function<void(const FileName &fileName, T &x)> readFunc,
+                                 std::function<void(T &x, UInt process, Parallel::CommunicatorPtr comm)> broadCastFunc=nullptr);
+
+  /** @brief Files read within the lifetime of this object are stored once per shared memory node.
+  * The master process of @p comm reads the file and the matrices are distributed to the other processes
+  * with Parallel::broadCastShared(). The processes of a node map the same memory read-only.
+  * Every process in @p comm must read the same files in the same order (e.g. while reading the config of a program).
+  * Files read by worker threads or by the master alone (e.g. inside Parallel::forEach()) must not be in the scope.
+  * Supported for matrix, potential coefficients and doodson harmonic files, other files are read by each process.
+  * A nested object with @p comm=nullptr suspends the scope. */
+  class NodeShared
+  {
+    Parallel::CommunicatorPtr commOld;
+
+  public:
+    explicit NodeShared(Parallel::CommunicatorPtr comm);
+   ~NodeShared();
+    NodeShared(const NodeShared &) = delete;
+    NodeShared &operator=(const NodeShared &) = delete;
+  };
+
+  /// Internal: Communicator of the active NodeShared scope of this thread or nullptr.
+  Parallel::CommunicatorPtr nodeSharedCommunicator();
+
+  /// Internal: Key of the file (empty if the file cannot be cached) and size of the file.
+  std::string key(const std::string &type, const FileName &fileName, UInt &size);
+
+  /// Cached object or nullptr.
+  std::shared_ptr<const void> find(const std::string &key);
+
+  /// Insert object (@p size in bytes) and remove the least recently used objects if the cache is full.
+  void insert(const std::string &key, std::shared_ptr<const void> object, UInt size);
+}
+
+/// @}
+
+/***********************************************/
+/***** INLINES *********************************/
+/***********************************************/
+
+template<typename T>
+inline void FileCache::read(const FileName &fileName, const std::string &fileType, T &x, std::function<void(const FileName &fileName, T &x)> readFunc,
+                            std::function<void(T &x, UInt process, Parallel::CommunicatorPtr comm)> broadCastFunc)
+{
+  try
+  {
+    UInt size;
+    const std::string key = FileCache::key(std::string(typeid(T).name())+":"+fileType, fileName, size);
+
+    Parallel::CommunicatorPtr comm = nodeSharedCommunicator();
+    if(comm && broadCastFunc)
+    {
+      // already cached at all processes?
+      auto objectCached = key.empty() ? nullptr : std::static_pointer_cast<const T>(find(key));
+      UInt found = (objectCached != nullptr);
+      Parallel::reduceMin(found, 0, comm);
+      Parallel::broadCast(found, 0, comm);
+      if(found)
+      {
+        x = *objectCached;
+        return;
+      }
+
+      auto object = std::make_shared<T>();
+      Parallel::broadCastExceptions(comm, [&](Parallel::CommunicatorPtr comm)
+      {
+        if(!Parallel::isMaster(comm))
+          return;
+        NodeShared suspend(nullptr);
+        if(objectCached)
+          *object = *objectCached;
+        else
+          readFunc(fileName, *object);
+      });
+      broadCastFunc(*object, 0, comm);
+      if(!key.empty())
+        insert(key, object, size);
+      x = *object;
+      return;
+    }
+
+    if(key.empty())
+    {
+      readFunc(fileName, x);
+      return;
+    }
+
+    auto object = std::static_pointer_cast<const T>(find(key));
+    if(!object)
+    {
+      auto objectNew = std::make_shared<T>();
+      readFunc(fileName, *objectNew);
+      insert(key, objectNew, size);
+      object = objectNew;
+    }
+    x = *object;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+#endif
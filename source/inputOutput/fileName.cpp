@@ -10,6 +10,7 @@
 */
 /***********************************************/
 
+#include <cstring>
 #include "base/importStd.h"
 #include "base/string.h"
 #include "parser/stringParser.h"
@@ -17,6 +18,41 @@
 
 /*************************************************/
 
+FileName::FileName(const std::string &name) : name_(name)
+{
+  if(name_.find('{') != std::string::npos)
+    template_ = std::make_shared<StringParser::Template>(name_);
+}
+
+/*************************************************/
+
+// position of the '.' before the full extension (with an additional ".gz", ".zst" or ".z")
+static std::string::size_type fullExtensionPos(const std::string &name)
+{
+  auto pos = name.rfind('.');
+  if((pos == std::string::npos) || (pos+1 == name.size()) || (pos == 0))
+    return pos;
+  auto isPack = [&](const char *ext)
+  {
+    const UInt len = std::strlen(ext);
+    if(name.size()-pos-1 != len)
+      return FALSE;
+    for(UInt i=0; i<len; i++)
+      if(std::toupper(name[pos+1+i]) != ext[i])
+        return FALSE;
+    return TRUE;
+  };
+  if(isPack("GZ") || isPack("Z") || isPack("ZST"))
+  {
+    auto posNew = name.rfind('.', pos-1);
+    if(posNew != std::string::npos)
+      pos = posNew;
+  }
+  return pos;
+}
+
+/*************************************************/
+
 FileName FileName::append(const FileName& fileName) const
 {
   if(empty())
@@ -38,14 +74,7 @@ FileName FileName::fullExtension() const
   auto pos = name_.rfind('.');
   if((pos == std::string::npos) || (pos+1 == name_.size()))
     return FileName();
-  std::string ext = String::upperCase(name_.substr(pos+1));
-  if((pos > 0) && (ext == "GZ" || ext == "Z"))
-  {
-    auto posNew = name_.rfind('.', pos-1);
-    if(posNew != std::string::npos)
-      pos = posNew;
-  }
-  return FileName(name_.substr(pos+1));
+  return FileName(name_.substr(fullExtensionPos(name_)+1));
 }
 
 /*************************************************/
@@ -71,7 +100,7 @@ FileName FileName::packExtension() const
 
 FileName FileName::stripFullExtension() const
 {
-  auto pos = name_.rfind("."+fullExtension().str());
+  auto pos = fullExtensionPos(name_);
   if(pos == std::string::npos)
     return *this;
   return FileName(name_.substr(0, pos));
@@ -108,11 +137,13 @@ FileName FileName::stripDirectory() const
 
 FileName FileName::appendBaseName(const std::string &text) const
 {
-  auto pos = name_.rfind("."+fullExtension().str());
+  auto pos = fullExtensionPos(name_);
   if(pos == std::string::npos)
     return FileName(name_+text);
-  std::string tmp = name_;
-  return FileName(tmp.insert(pos, text));
+  std::string tmp;
+  tmp.reserve(name_.size()+text.size());
+  tmp.append(name_, 0, pos).append(text).append(name_, pos, std::string::npos);
+  return FileName(tmp);
 }
 
 /*************************************************/
@@ -121,7 +152,9 @@ FileName FileName::operator()(const VariableList &varList) const
 {
   try
   {
-    return FileName(StringParser::parse(name_, varList));
+    if(!template_)
+      return *this;
+    return FileName(template_->parse(varList));
   }
   catch(std::exception &e)
   {
@@ -16,20 +16,24 @@
 #include "base/importStd.h"
 
 class VariableList;
+namespace StringParser {class Template;}
 
 /***** CLASS ***********************************/
 
 /** @brief File names.
+* Names with variables {name} are parsed once at construction,
+* the replacement with @ref operator()(const VariableList &) only looks up the variables.
 * @ingroup inputOutputGroup */
 class FileName
 {
   std::string name_;
+  std::shared_ptr<const StringParser::Template> template_; // only if name_ contains variables
 
 public:
   FileName() {}                                      //!< Constructor.
   FileName(const FileName &) = default;              //!< Copy constructor.
-  FileName(const std::string &name) : name_(name) {} //!< Constructor.
-  FileName(const char *name) : name_(name) {}        //!< Constructor.
+  FileName(const std::string &name);                 //!< Constructor.
+  FileName(const char *name) : FileName(std::string(name)) {} //!< Constructor.
   FileName &operator=(const FileName &) = default;   //!< Assignement.
 
   operator std::string()  const {return name_;}         //!< Cast to  string.
@@ -46,13 +50,13 @@ public:
 
   /** @brief Extension.
   * Returns the string of all characters in the FileName
-  * after (but not including) the last '.' character plus an additional ".gz" or ".z".
+  * after (but not including) the last '.' character plus an additional ".gz", ".zst" or ".z".
   * Example: FileName("name.txt.gz").typeExtension() returns "txt.gz". */
   FileName fullExtension() const;
 
   /** @brief Extension.
   * Returns the string of all characters in the FileName
-  * after (but not including) the last '.' character without an additional ".gz" or ".z".
+  * after (but not including) the last '.' character without an additional ".gz", ".zst" or ".z".
   * Example: FileName("name.txt.gz").typeExtension() returns "txt". */
   FileName typeExtension() const;
 
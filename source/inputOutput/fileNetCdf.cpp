@@ -272,6 +272,28 @@ NetCdf::Attribute NetCdf::Variable::attribute(const std::string &name) const
 
 /***********************************************/
 
+void NetCdf::Variable::setChunking(const std::vector<UInt> &chunkSizes) const
+{
+  if(chunkSizes.size() != dimensions().size())
+    throw(Exception("Chunk sizes must be given for all "+dimensions().size()%"%i dimensions of variable <"s+name()+">."));
+  const Int status = nc_def_var_chunking(groupId, varId, NC_CHUNKED, chunkSizes.data());
+  if(status != NC_NOERR)
+    throw(Exception("Variable <"+name()+">: "+nc_strerror(status)));
+}
+
+/***********************************************/
+
+void NetCdf::Variable::setCompression(UInt deflateLevel, Bool shuffle) const
+{
+  if(deflateLevel == 0)
+    return;
+  const Int status = nc_def_var_deflate(groupId, varId, shuffle ? 1 : 0, 1, static_cast<Int>(std::min(deflateLevel, UInt(9))));
+  if(status != NC_NOERR)
+    throw(Exception("Variable <"+name()+">: "+nc_strerror(status)));
+}
+
+/***********************************************/
+
 void NetCdf::Variable::setValues(const std::vector<UInt> &start, const std::vector<UInt> &count, const Vector &val) const
 {
   nc_type ncType = 0;
@@ -125,6 +125,19 @@ namespace NetCdf
 
     // -------------------
 
+    /** @brief Set the chunk sizes of the variable (HDF5 storage layout).
+    * Must be called before any data is written.
+    * @param chunkSizes number of elements of a chunk along each dimension (must be of size @a dimensionCount) */
+    void setChunking(const std::vector<UInt> &chunkSizes) const;
+
+    /** @brief Enable the deflate compression of the variable.
+    * Must be called before any data is written.
+    * @param deflateLevel compression level between 1 (fastest) and 9 (smallest file), 0 disables the compression
+    * @param shuffle reorder the bytes of the values before compression (improves the compression of floating point data) */
+    void setCompression(UInt deflateLevel, Bool shuffle=TRUE) const;
+
+    // -------------------
+
     /** @brief Write a slice of data values to the variable.
     * Double values will be cast to the data type of the variable.
     * @param start start index of the data point (must be of size @a dimensionCount)
@@ -17,6 +17,7 @@
 #include "inputOutput/system.h"
 #include "files/fileGnssStationInfo.h"
 #include "config/config.h"
+#include "parallel/threadPool.h"
 #include "fileSinex.h"
 
 /***********************************************/
@@ -193,6 +194,14 @@ void Sinex::readFile(const FileName &fileName)
 
     std::string line, blockLabel;
     BlockType blockType = UNKNOWN;
+    std::vector<std::string> lines((Parallel::threadCount() > 1) ? 65536 : 0); // data lines of current block, handed over in batches to parse in parallel
+    UInt lineCount = 0;
+    auto flushLines = [&]()
+    {
+      if(lineCount && (_blocks.find(blockType) != _blocks.end()))
+        _blocks.at(blockType)->readLines(lines, lineCount);
+      lineCount = 0;
+    };
     if(file.peek() == '%')
       std::getline(file, _header);
     else
@@ -227,6 +236,7 @@ void Sinex::readFile(const FileName &fileName)
       {
         if(blockLabel != String::trim(line.substr(1)))
           throw(Exception("SINEX block ends unexpectedly: '" + line + "' in block '" + blockLabel + "'"));
+        flushLines();
         blockLabel.clear();
         blockType = UNKNOWN;
         continue;
@@ -246,8 +256,16 @@ void Sinex::readFile(const FileName &fileName)
       // data lines
       if(_blocks.find(blockType) == _blocks.end())
         continue;
-      _blocks.at(blockType)->readLine(line);
+      if(lines.empty())
+      {
+        _blocks.at(blockType)->readLine(line);
+        continue;
+      }
+      std::swap(lines.at(lineCount++), line); // reuse the string buffers
+      if(lineCount == lines.size())
+        flushLines();
     }
+    flushLines();
   }
   catch(std::exception &e)
   {
@@ -318,9 +336,9 @@ Time Sinex::str2time(const std::string &line, std::size_t pos, Bool fourDigitYea
   try
   {
     UInt posOffset = fourDigitYear ? 2 : 0;
-    UInt year = static_cast<UInt>(String::toInt(line.substr(pos+0, 2+posOffset)));
-    UInt day  = static_cast<UInt>(String::toInt(line.substr(pos+3+posOffset, 3)));
-    UInt sec  = static_cast<UInt>(String::toInt(line.substr(pos+7+posOffset, 5)));
+    UInt year = static_cast<UInt>(String::toInt(line, pos+0, 2+posOffset));
+    UInt day  = static_cast<UInt>(String::toInt(line, pos+3+posOffset, 3));
+    UInt sec  = static_cast<UInt>(String::toInt(line, pos+7+posOffset, 5));
     Time time;
     if(year != 0 || day != 0 || sec != 0)
     {
@@ -801,7 +819,7 @@ void Sinex::SinexSolutionVector::readLine(const std::string &line)
   try
   {
     Parameter parameter;
-    parameter.parameterIndex = static_cast<UInt>(String::toInt(line.substr(1, 5)));
+    parameter.parameterIndex = static_cast<UInt>(String::toInt(line, 1, 5));
     parameter.parameterType  = String::trim(line.substr(7, 6));
     parameter.siteCode       = String::trim(line.substr(14, 4));
     parameter.pointCode      = String::trim(line.substr(19, 2));
@@ -809,9 +827,9 @@ void Sinex::SinexSolutionVector::readLine(const std::string &line)
     parameter.time           = str2time(line, 27);
     parameter.unit           = String::trim(line.substr(40, 4));
     parameter.constraintCode = String::trim(line.substr(45, 1));
-    parameter.value          = String::toDouble(line.substr(47, 21));
+    parameter.value          = String::toDouble(line, 47, 21);
     if(blockType() != SOLUTION_NORMAL_EQUATION_VECTOR && line.length() > 68)
-      parameter.sigma        = String::toDouble(line.substr(69, 11));
+      parameter.sigma        = String::toDouble(line, 69, 11);
     _parameters.resize(parameter.parameterIndex);
     _parameters.back() = parameter;
   }
@@ -1016,15 +1034,62 @@ std::string Sinex::SinexSolutionMatrix::label() const
 
 /***********************************************/
 
+// returns the number of values in a SINEX matrix line
+static UInt readMatrixLine(const std::string &line, UInt &row, UInt &column, Double value[3])
+{
+  row    = static_cast<UInt>(String::toInt(line, 1, 5)) - 1;
+  column = static_cast<UInt>(String::toInt(line, 7, 5)) - 1;
+  UInt count = 0;
+  for(UInt k = 0; k < 3; k++)
+    if(line.length() >= 13+k*22+21)
+      value[count++] = String::toDouble(line, 13+k*22, 21);
+  return count;
+}
+
+/***********************************************/
+
 void Sinex::SinexSolutionMatrix::readLine(const std::string &line)
 {
   try
   {
-    UInt i = static_cast<UInt>(String::toInt(line.substr(1, 5))) - 1;
-    UInt j = static_cast<UInt>(String::toInt(line.substr(7, 5))) - 1;
-    for(UInt k = 0; k < 3; k++)
-      if(line.length() >= 13+k*22+21)
-        _matrix(i,j+k) += String::toDouble(line.substr(13+k*22, 21));
+    UInt   row, column;
+    Double value[3];
+    const UInt count = readMatrixLine(line, row, column, value);
+    for(UInt k = 0; k < count; k++)
+      _matrix(row, column+k) += value[k];
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void Sinex::SinexSolutionMatrix::readLines(const std::vector<std::string> &lines, UInt count)
+{
+  try
+  {
+    class Entry
+    {
+    public:
+      UInt   row, column, count;
+      Double value[3];
+    };
+
+    // parse lines in parallel
+    constexpr UInt chunkSize = 1024;
+    std::vector<Entry> entries(count);
+    Parallel::threadLoop(0, (count+chunkSize-1)/chunkSize, [&](UInt chunk)
+    {
+      for(UInt idx=chunk*chunkSize; idx<std::min(count, (chunk+1)*chunkSize); idx++)
+        entries.at(idx).count = readMatrixLine(lines.at(idx), entries.at(idx).row, entries.at(idx).column, entries.at(idx).value);
+    });
+
+    // accumulate in order (the same element may appear in several lines)
+    for(const Entry &entry : entries)
+      for(UInt k = 0; k < entry.count; k++)
+        _matrix(entry.row, entry.column+k) += entry.value[k];
   }
   catch(std::exception &e)
   {
@@ -1048,20 +1113,47 @@ Bool Sinex::SinexSolutionMatrix::writeBlock(std::ostream &file) const
     file << header() << std::endl;
     const UInt size    = _matrix.rows();
     const Bool isUpper = _matrix.isUpper();
-    for(UInt i = 0; i < size; i++)
-      for(UInt j = (isUpper ? i : 0); j < (isUpper ? size : i+1); j++)
-        if(_matrix(i,j) != 0.)
+
+    // chunks of rows with about the same number of elements
+    std::vector<UInt> rowStart(1, 0);
+    for(UInt i=0, count=0; i<size; i++)
+    {
+      count += (isUpper ? size-i : i+1);
+      if((count >= 1048576) || (i+1 == size))
+      {
+        rowStart.push_back(i+1);
+        count = 0;
+      }
+    }
+
+    // chunks are formatted in parallel and written in order
+    const UInt batchSize = 4*Parallel::threadCount();
+    std::vector<std::string> text(batchSize);
+    for(UInt batch=0; batch+1<rowStart.size(); batch+=batchSize)
+    {
+      const UInt count = std::min(batchSize, rowStart.size()-1-batch);
+      Parallel::threadLoop(0, count, [&](UInt c)
+      {
+        std::string &str = text.at(c);
+        str.clear();
+        char line[128];
+        for(UInt i=rowStart.at(batch+c); i<rowStart.at(batch+c+1); i++)
         {
-          file << " " << std::setw(5) << i+1 << " " << std::setw(5) << j+1;
-          for(UInt k = 0; k < 3; k++)
-          {
-            if(j < (isUpper ? size : i+1) && _matrix(i,j) != 0.)
-              file << " " << std::right << std::setw(21) << std::setprecision(14) << _matrix(i, (k<2) ? j++ : j);
-            else
-              break;
-          }
-          file << std::endl;
+          const UInt jEnd = (isUpper ? size : i+1);
+          for(UInt j=(isUpper ? i : 0); j<jEnd; j++)
+            if(_matrix(i,j) != 0.)
+            {
+              Int len = std::snprintf(line, sizeof(line), " %5u %5u", static_cast<unsigned>(i+1), static_cast<unsigned>(j+1));
+              for(UInt k=0; (k<3) && (j<jEnd) && (_matrix(i,j) != 0.); k++)
+                len += std::snprintf(line+len, sizeof(line)-len, " %21.14e", _matrix(i, (k<2) ? j++ : j));
+              line[len++] = '\n';
+              str.append(line, len);
+            }
         }
+      });
+      for(UInt c=0; c<count; c++)
+        file.write(text.at(c).data(), text.at(c).size());
+    }
     file << "-" << label() << std::endl;
 
     return TRUE;
@@ -1078,7 +1170,7 @@ void Sinex::SinexSolutionStatistics::readLine(const std::string &line)
 {
   try
   {
-    _values[String::trim(line.substr(1, 30))] = String::toDouble(line.substr(32, 22));
+    _values[String::trim(line.substr(1, 30))] = String::toDouble(line, 32, 22);
   }
   catch(std::exception &e)
   {
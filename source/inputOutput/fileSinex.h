@@ -177,6 +177,7 @@ public:
   virtual std::string header()    const = 0;
   virtual std::string label()     const { return _label; }
   virtual void        readLine(const std::string &line) = 0;
+  virtual void        readLines(const std::vector<std::string> &lines, UInt count) { for(UInt i=0; i<count; i++) readLine(lines.at(i)); }
   virtual Bool        writeBlock(std::ostream &file) const = 0;
 };
 
@@ -247,7 +248,8 @@ public:
   virtual std::string label()  const;
   virtual std::string header() const { return "*PARA1 PARA2 _______PARA2+0_______ _______PARA2+1_______ _______PARA2+2_______"; }
   virtual void        readLine(const std::string &line);
-  virtual Bool        writeBlock(std::ostream &file) const;
+  virtual void        readLines(const std::vector<std::string> &lines, UInt count); // parsed in parallel threads
+  virtual Bool        writeBlock(std::ostream &file) const;                         // formatted in parallel threads
   virtual Type        type()   const { return _type; }
   virtual Matrix      matrix() const { return _matrix; }
   virtual void        setMatrix(const_MatrixSliceRef matrix, Type type = INFORMATION) { _matrix = matrix; _type = type; }
@@ -11,6 +11,7 @@
 */
 /***********************************************/
 
+#include <chrono>
 #include "base/import.h"
 #include "base/string.h"
 #include "inputOutput/system.h"
@@ -24,27 +25,37 @@ class Logging
 public:
   enum Type : UInt {STATUS, INFO, WARNINGONCE, WARNING, ERROR};
 
+  typedef std::chrono::steady_clock Clock;
+
   Type              type;
   UInt              rank;
   Bool              enabled, silent, newLine, isLogfile;
   std::stringstream ss;
   std::function<void(UInt type, const std::string &str)> send;
   OutFile           file;
+  Clock::time_point fileFlushTime;
+
+  // lines of other processes are collected and sent in bunches to the main process
+  std::string       buffer;
+  Type              bufferType;
+  Clock::time_point sendTime;
 
   Logging();
  ~Logging();
 
   void setRank(UInt rank_)       {rank = rank_;}
-  Bool enableOutput(Bool enable) {std::swap(enable, enabled);  return enable;}
+  Bool enableOutput(Bool enable) {flush(); std::swap(enable, enabled);  return enable;}
   void setSilent(Bool silent_)   {silent = silent_;}
   void setLogFile(const std::string &name);
 
   std::ostream &startLine(Type type);
   std::ostream &endLine(std::ostream &stream);
   void receive(UInt type, const std::string &str);
+  void flush();
 
   // Timer
   std::stack<Time> startTime;
+  Clock::time_point timerTime;
   void   startTimer();
   void   loopTimer(UInt idx, UInt count, UInt processCount);
   void   loopTimerEnd(UInt count);
@@ -54,7 +65,7 @@ static Logging logging;
 
 /***********************************************/
 
-Logging::Logging() : type(STATUS), rank(0), enabled(TRUE), silent(FALSE), newLine(FALSE)
+Logging::Logging() : type(STATUS), rank(0), enabled(TRUE), silent(FALSE), newLine(FALSE), isLogfile(FALSE), bufferType(STATUS)
 {
   send = std::bind(&Logging::receive, this, std::placeholders::_1, std::placeholders::_2);
   startTimer();
@@ -116,14 +127,30 @@ std::ostream &Logging::endLine(std::ostream &stream)
 
     // send log line to main process
     if(enabled || (type == WARNING) || (type == ERROR))
+    {
       for(const std::string &str :  String::split(ss.str(), '\n'))
       {
         if(rank == 0)
           receive(type, str);
+        else if((type == STATUS) || (type == INFO))
+        {
+          if(bufferType != type)
+            flush();
+          bufferType = type;
+          buffer    += rank%"%4i. process: "s+str+'\n';
+        }
         else
+        {
+          flush();
           send(type, rank%"%4i. process: "s+str);
+        }
       }
 
+      // send collected lines at most once per second (or if buffer is large)
+      if(!buffer.empty() && ((buffer.size() > 65536) || (Clock::now()-sendTime > std::chrono::seconds(1))))
+        flush();
+    }
+
     ss.str("");
     return stream;
   }
@@ -140,29 +167,46 @@ void Logging::receive(UInt type, const std::string &str)
 {
   try
   {
+    // str can contain several lines collected by another process
+    const std::vector<std::string> lines = String::split(str, '\n');
+    const UInt count = ((lines.size() > 1) && lines.back().empty()) ? lines.size()-1 : lines.size();
+
     if(!silent || (type == WARNINGONCE) || (type == WARNING) || (type == ERROR))
     {
       if(newLine)
-        std::cout<<std::endl<<std::flush;
+        std::cout<<'\n';
       newLine = FALSE;
-      if((type == STATUS) || (type == INFO))
-        std::cout<<str<<std::endl<<std::flush;
-      else
-        std::cerr<<"\033[1;31m"<<str<<"\033[0m"<<std::endl<<std::flush; // ANSI escape sequence: red and bold
+      for(UInt i=0; i<count; i++)
+        if((type == STATUS) || (type == INFO))
+          std::cout<<lines.at(i)<<'\n';
+        else
+          std::cerr<<"\033[1;31m"<<lines.at(i)<<"\033[0m\n"; // ANSI escape sequence: red and bold
+      std::cout<<std::flush;
     }
 
     if(isLogfile)
     {
-      file<<System::now()%"%y-%m-%d %H:%M:%S"s;
-      switch(type)
+      const std::string timeStr = System::now()%"%y-%m-%d %H:%M:%S"s;
+      for(UInt i=0; i<count; i++)
+      {
+        file<<timeStr;
+        switch(type)
+        {
+          case STATUS:      file<<" Status  "; break;
+          case INFO:        file<<" Info    "; break;
+          case WARNINGONCE: file<<" WARNING "; break;
+          case WARNING:     file<<" WARNING "; break;
+          case ERROR:       file<<" ERROR   "; break;
+        }
+        file<<lines.at(i)<<'\n';
+      }
+      // the log file is flushed at most once per second, warnings and errors immediately
+      const auto now = Clock::now();
+      if(((type != STATUS) && (type != INFO)) || (now-fileFlushTime > std::chrono::seconds(1)))
       {
-        case STATUS:      file<<" Status  "; break;
-        case INFO:        file<<" Info    "; break;
-        case WARNINGONCE: file<<" WARNING "; break;
-        case WARNING:     file<<" WARNING "; break;
-        case ERROR:       file<<" ERROR   "; break;
+        file.flush();
+        fileFlushTime = now;
       }
-      file<<str<<std::endl;
     }
   }
   catch(std::exception &e)
@@ -171,6 +215,23 @@ void Logging::receive(UInt type, const std::string &str)
   }
 }
 
+// send collected lines of this process to main process
+void Logging::flush()
+{
+  try
+  {
+    if(buffer.empty())
+      return;
+    send(bufferType, buffer);
+    buffer.clear();
+    sendTime = Clock::now();
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
 /***********************************************/
 /***********************************************/
 
@@ -179,6 +240,7 @@ void Logging::startTimer()
   try
   {
     startTime.push(System::now());
+    timerTime = Clock::time_point();
   }
   catch(std::exception &e)
   {
@@ -195,12 +257,11 @@ void Logging::loopTimer(UInt idx, UInt count, UInt processCount)
     if((count == 0) || (rank != 0) || !enabled || silent)
       return;
 
-    if(idx >= 5000)
-    {
-      const UInt digits = static_cast<UInt>(std::log10(idx+1)) + 1;
-      if((idx+1) % static_cast<UInt>(std::pow(10, digits-3)))
-        return;
-    }
+    // update the screen at most 5 times per second
+    const auto now = Clock::now();
+    if((idx+1 < count) && (now-timerTime < std::chrono::milliseconds(200)))
+      return;
+    timerTime = now;
 
     const Double diff    = (System::now()-startTime.top()).mjd();
     const Double perStep = (idx >= processCount) ? diff/(idx/processCount) : 0.;
@@ -0,0 +1,422 @@
+/***********************************************/
+/**
+* @file profiler.cpp
+*
+* @brief Scoped timers and counters for hot spots.
+*
+* @author GROOPS Developers
+* @date 2026-10-14
+*
+*/
+/***********************************************/
+
+#include "base/import.h"
+#include "inputOutput/file.h"
+#include "inputOutput/system.h"
+#include "parallel/parallel.h"
+#include "profiler.h"
+#include <chrono>
+#include <map>
+#include <mutex>
+
+/***** CLASS ***********************************/
+
+namespace Profiler
+{
+  typedef std::chrono::steady_clock Clock;
+
+  class Stat
+  {
+  public:
+    UInt   count   = 0;
+    Double seconds = 0;
+    Double maximum = 0; // max. seconds of a single process
+  };
+
+  class Event
+  {
+  public:
+    std::string name;
+    Double      start, duration; // [microseconds]
+  };
+
+  // buffer of each thread, kept after the end of the thread
+  class ThreadData
+  {
+  public:
+    std::mutex                     mutex; // uncontended, except during report
+    UInt                           id;
+    std::string                    path;
+    std::vector<UInt>              pathLength;
+    std::vector<Clock::time_point> startTime;
+    std::map<std::string, Stat>    stats;
+    std::map<std::string, Double>  counters;
+    std::vector<Event>             events;
+  };
+
+  std::atomic<bool>                               enabled_(false);
+  static Bool                                     traceEnabled = FALSE;
+  static Clock::time_point                        timeZero     = Clock::now();
+  static std::mutex                               mutexThreads;
+  static std::vector<std::unique_ptr<ThreadData>> threads;
+
+  static ThreadData &threadData()
+  {
+    thread_local ThreadData *data = nullptr;
+    if(!data)
+    {
+      std::lock_guard<std::mutex> lock(mutexThreads);
+      threads.push_back(std::unique_ptr<ThreadData>(new ThreadData()));
+      data = threads.back().get();
+      data->id = threads.size()-1;
+    }
+    return *data;
+  }
+
+  // memory categories, the first one collects all not assigned allocations
+  constexpr UInt                                  memoryCategoryMax = 64;
+  static std::mutex                               mutexMemory;
+  static std::vector<std::string>                 memoryNames(1, "other");
+  static std::array<std::atomic<Int64>, memoryCategoryMax> memoryCurrent, memoryPeak; // [bytes]
+  static thread_local UInt                        memoryCategoryThread = 0;
+
+  class MemoryStat
+  {
+  public:
+    Int64 current = 0, peak = 0; // max. of processes
+    UInt  rank    = 0;           // process with peak
+  };
+
+  static std::string sortKey(std::string path) // parents before children
+  {
+    std::replace(path.begin(), path.end(), '/', '\x01');
+    return path;
+  }
+}
+
+/***********************************************/
+
+void Profiler::enable(Bool enable, Bool trace)
+{
+  traceEnabled = enable && trace;
+  enabled_.store(enable);
+}
+
+/***********************************************/
+
+Double Profiler::seconds()
+{
+  return std::chrono::duration<Double>(Clock::now()-timeZero).count();
+}
+
+/***********************************************/
+
+void Profiler::Scope::start(const char *name)
+{
+  ThreadData &data = threadData();
+  std::lock_guard<std::mutex> lock(data.mutex);
+  data.pathLength.push_back(data.path.size());
+  if(!data.path.empty())
+    data.path += '/';
+  data.path += name;
+  data.startTime.push_back(Clock::now());
+}
+
+/***********************************************/
+
+void Profiler::Scope::stop()
+{
+  const Clock::time_point time = Clock::now();
+  ThreadData &data = threadData();
+  std::lock_guard<std::mutex> lock(data.mutex);
+  const Double seconds = std::chrono::duration<Double>(time-data.startTime.back()).count();
+  Stat &stat = data.stats[data.path];
+  stat.count++;
+  stat.seconds += seconds;
+  if(traceEnabled)
+  {
+    const UInt pos = (data.pathLength.back() == 0) ? 0 : data.pathLength.back()+1;
+    data.events.push_back(Event{data.path.substr(pos), 1e6*std::chrono::duration<Double>(data.startTime.back()-timeZero).count(), 1e6*seconds});
+  }
+  data.path.resize(data.pathLength.back());
+  data.pathLength.pop_back();
+  data.startTime.pop_back();
+}
+
+/***********************************************/
+
+void Profiler::count(const char *name, Double value)
+{
+  if(!isEnabled())
+    return;
+  ThreadData &data = threadData();
+  std::lock_guard<std::mutex> lock(data.mutex);
+  data.counters[data.path.empty() ? std::string(name) : data.path+"/"+name] += value;
+}
+
+/***********************************************/
+
+UInt Profiler::memoryCategoryIndex(const char *name)
+{
+  std::lock_guard<std::mutex> lock(mutexMemory);
+  auto iter = std::find(memoryNames.begin(), memoryNames.end(), name);
+  if(iter != memoryNames.end())
+    return std::distance(memoryNames.begin(), iter);
+  if(memoryNames.size() >= memoryCategoryMax)
+    return 0;
+  memoryNames.push_back(name);
+  return memoryNames.size()-1;
+}
+
+/***********************************************/
+
+UInt Profiler::memoryCategory()
+{
+  return memoryCategoryThread;
+}
+
+/***********************************************/
+
+void Profiler::memoryAdd(UInt category, Int64 bytes)
+{
+  const Int64 current = memoryCurrent[category].fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  Int64 peak = memoryPeak[category].load(std::memory_order_relaxed);
+  while((current > peak) && !memoryPeak[category].compare_exchange_weak(peak, current, std::memory_order_relaxed));
+}
+
+/***********************************************/
+
+Profiler::MemoryCategory::MemoryCategory(const char *name) : categoryOld(0), active(isEnabled())
+{
+  if(!active)
+    return;
+  categoryOld = memoryCategoryThread;
+  memoryCategoryThread = memoryCategoryIndex(name);
+}
+
+/***********************************************/
+
+Profiler::MemoryCategory::~MemoryCategory()
+{
+  if(active)
+    memoryCategoryThread = categoryOld;
+}
+
+/***********************************************/
+
+void Profiler::logMemory()
+{
+  try
+  {
+    UInt current, peak;
+    if(System::memoryUsage(current, peak))
+      logInfo<<"memory [MB]: resident "<<1e-6*current%"%.1f"s<<" (peak "<<1e-6*peak%"%.1f)"s<<Log::endl;
+    if(!isEnabled())
+      return;
+    std::lock_guard<std::mutex> lock(mutexMemory);
+    for(UInt i=0; i<memoryNames.size(); i++)
+      if(memoryPeak[i].load())
+        logInfo<<"  "<<memoryNames.at(i)<<": "<<1e-6*memoryCurrent[i].load()%"%.1f"s<<" (peak "<<1e-6*memoryPeak[i].load()%"%.1f)"s<<Log::endl;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void Profiler::report(Parallel::CommunicatorPtr comm)
+{
+  try
+  {
+    if(!isEnabled() || threadData().pathLength.size())
+      return;
+    enabled_.store(false); // do not record the communication of the report
+
+    // collect all threads of this process
+    std::map<std::string, Stat>   stats;
+    std::map<std::string, Double> counters;
+    {
+      std::lock_guard<std::mutex> lockThreads(mutexThreads);
+      for(auto &data : threads)
+      {
+        std::lock_guard<std::mutex> lock(data->mutex);
+        for(auto &s : data->stats)
+        {
+          stats[s.first].count   += s.second.count;
+          stats[s.first].seconds += s.second.seconds;
+        }
+        for(auto &c : data->counters)
+          counters[c.first] += c.second;
+        data->stats.clear();
+        data->counters.clear();
+      }
+    }
+
+    // aggregate over processes
+    std::stringstream ss;
+    ss.precision(15);
+    for(auto &s : stats)
+      ss<<"S\t"<<s.first<<"\t"<<s.second.count<<"\t"<<s.second.seconds<<"\n";
+    for(auto &c : counters)
+      ss<<"C\t"<<c.first<<"\t"<<c.second<<"\n";
+    for(auto &s : stats)
+      s.second.maximum = s.second.seconds;
+
+    // memory of this process, peaks are reset to the current values
+    std::map<std::string, MemoryStat> memory;
+    {
+      std::lock_guard<std::mutex> lock(mutexMemory);
+      for(UInt i=0; i<memoryNames.size(); i++)
+        if(memoryPeak[i].load())
+        {
+          const Int64 current = memoryCurrent[i].load();
+          memory[memoryNames.at(i)] = MemoryStat{current, memoryPeak[i].exchange(current), 0};
+        }
+    }
+    UInt residentCurrent, residentPeak;
+    if(System::memoryUsage(residentCurrent, residentPeak))
+      memory["resident set size"] = MemoryStat{static_cast<Int64>(residentCurrent), static_cast<Int64>(residentPeak), 0};
+    for(auto &m : memory)
+      ss<<"M\t"<<m.first<<"\t"<<m.second.current<<"\t"<<m.second.peak<<"\n";
+
+    if(Parallel::isMaster(comm))
+    {
+      for(UInt process=1; process<Parallel::size(comm); process++)
+      {
+        std::string str;
+        Parallel::receive(str, process, comm);
+        std::stringstream in(str);
+        std::string line;
+        while(std::getline(in, line))
+        {
+          std::vector<std::string> fields;
+          std::stringstream ls(line);
+          for(std::string field; std::getline(ls, field, '\t');)
+            fields.push_back(field);
+          if((fields.size() == 4) && (fields.at(0) == "S"))
+          {
+            Stat &stat = stats[fields.at(1)];
+            const Double seconds = std::stod(fields.at(3));
+            stat.count   += std::stoull(fields.at(2));
+            stat.seconds += seconds;
+            stat.maximum  = std::max(stat.maximum, seconds);
+          }
+          else if((fields.size() == 3) && (fields.at(0) == "C"))
+            counters[fields.at(1)] += std::stod(fields.at(2));
+          else if((fields.size() == 4) && (fields.at(0) == "M"))
+          {
+            MemoryStat &stat = memory[fields.at(1)];
+            const Int64 peak = std::stoll(fields.at(3));
+            stat.current = std::max(stat.current, static_cast<Int64>(std::stoll(fields.at(2))));
+            if(peak > stat.peak)
+            {
+              stat.peak = peak;
+              stat.rank = process;
+            }
+          }
+        }
+      }
+
+      if(stats.size() || counters.size())
+      {
+        std::vector<std::string> paths;
+        for(auto &s : stats)
+          paths.push_back(s.first);
+        std::sort(paths.begin(), paths.end(), [](const std::string &a, const std::string &b) {return sortKey(a) < sortKey(b);});
+
+        logInfo<<"profile ("<<Parallel::size(comm)<<" processes): calls, total [s] summed over processes, max. [s] of a process, self [s]"<<Log::endl;
+        for(const auto &path : paths)
+        {
+          // time not spent in child scopes
+          Double self = stats[path].seconds;
+          for(auto iter = stats.upper_bound(path+"/"); (iter != stats.end()) && (iter->first.compare(0, path.size()+1, path+"/") == 0); iter++)
+            if(iter->first.find('/', path.size()+1) == std::string::npos)
+              self -= iter->second.seconds;
+          const UInt depth = std::count(path.begin(), path.end(), '/');
+          const std::string name = path.substr(path.find_last_of('/')+1);
+          logInfo<<std::string(2*depth+2, ' ')<<name<<std::string(std::max(40-static_cast<Int>(2*depth+name.size()), 1), ' ')
+                 <<stats[path].count%"%9i"s<<stats[path].seconds%"%12.3f"s<<stats[path].maximum%"%12.3f"s<<self%"%12.3f"s<<Log::endl;
+        }
+        for(auto &c : counters)
+          logInfo<<"  "<<c.first<<": "<<c.second%"%.6g"s<<Log::endl;
+      }
+
+      if(memory.size())
+      {
+        logInfo<<"memory [MB]: current, peak (max. of processes), process with peak"<<Log::endl;
+        for(auto &m : memory)
+          logInfo<<"  "<<m.first<<std::string(std::max(40-static_cast<Int>(m.first.size()), 1), ' ')
+                 <<1e-6*m.second.current%"%12.1f"s<<1e-6*m.second.peak%"%12.1f"s<<m.second.rank%"%9i"s<<Log::endl;
+      }
+    }
+    else
+      Parallel::send(ss.str(), 0, comm);
+
+    enabled_.store(true);
+  }
+  catch(std::exception &e)
+  {
+    enabled_.store(true);
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void Profiler::writeTrace(const FileName &fileName, Parallel::CommunicatorPtr comm)
+{
+  try
+  {
+    if(!traceEnabled || fileName.empty())
+      return;
+    enabled_.store(false);
+
+    std::stringstream ss;
+    ss.precision(15);
+    {
+      std::lock_guard<std::mutex> lockThreads(mutexThreads);
+      for(auto &data : threads)
+      {
+        std::lock_guard<std::mutex> lock(data->mutex);
+        for(auto &event : data->events)
+        {
+          std::string name;
+          for(char c : event.name)
+            if((c != '"') && (c != '\\'))
+              name += c;
+          ss<<",\n{\"name\":\""<<name<<"\",\"ph\":\"X\",\"ts\":"<<event.start<<",\"dur\":"<<event.duration
+            <<",\"pid\":"<<Parallel::myRank(comm)<<",\"tid\":"<<data->id<<"}";
+        }
+        data->events.clear();
+      }
+    }
+
+    if(Parallel::isMaster(comm))
+    {
+      logStatus<<"write profiling trace to <"<<fileName<<">"<<Log::endl;
+      OutFile file(fileName);
+      file<<"{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":\"rank 0\"}}";
+      file<<ss.str();
+      for(UInt process=1; process<Parallel::size(comm); process++)
+      {
+        std::string str;
+        Parallel::receive(str, process, comm);
+        file<<",\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":"<<process<<",\"args\":{\"name\":\"rank "<<process<<"\"}}"<<str;
+      }
+      file<<"\n]}"<<std::endl;
+    }
+    else
+      Parallel::send(ss.str(), 0, comm);
+
+    enabled_.store(true);
+  }
+  catch(std::exception &e)
+  {
+    enabled_.store(true);
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
@@ -0,0 +1,140 @@
+/***********************************************/
+/**
+* @file profiler.h
+*
+* @brief Scoped timers and counters for hot spots.
+*
+* Placing GROOPS_PROFILE("name") at the begin of a block measures the time
+* spent in this block. Nested scopes build a hierarchy (e.g. "NormalEquationDesign/accumulate/rankKUpdate").
+* Profiling is disabled by default and enabled with the command line option --profile.
+* If disabled, a scope costs only the check of a flag.
+*
+* With profiling enabled, matrix memory is accounted in categories (e.g. "normals blocks", "design matrix"),
+* selected with GROOPS_MEMORY_CATEGORY("name") for allocations within a block.
+*
+* @author GROOPS Developers
+* @date 2026-10-14
+*
+*/
+/***********************************************/
+
+#ifndef __GROOPS_PROFILER__
+#define __GROOPS_PROFILER__
+
+#include "base/importStd.h"
+#include <atomic>
+
+/** @addtogroup inputOutputGroup */
+/// @{
+
+/***** DEFINES *********************************/
+
+#define GROOPS_PROFILE_CONCAT2(a, b) a##b
+#define GROOPS_PROFILE_CONCAT(a, b)  GROOPS_PROFILE_CONCAT2(a, b)
+#define GROOPS_PROFILE(name)         Profiler::Scope GROOPS_PROFILE_CONCAT(profilerScope, __LINE__)(name);
+#define GROOPS_MEMORY_CATEGORY(name) Profiler::MemoryCategory GROOPS_PROFILE_CONCAT(memoryCategory, __LINE__)(name);
+
+/***********************************************/
+
+class FileName;
+namespace Parallel
+{
+  class Communicator;
+  typedef std::shared_ptr<Communicator> CommunicatorPtr;
+}
+
+/** @brief Scoped timers and counters.
+* Each thread records into its own buffer, so scopes can be used in thread parallel loops.
+* Scopes in worker threads of Parallel::threadLoop() start a new hierarchy at top level. */
+namespace Profiler
+{
+  extern std::atomic<bool> enabled_;
+
+  /** @brief Enable profiling, optionally with recording of all scopes for a trace file. */
+  void enable(Bool enable, Bool trace=FALSE);
+
+  /** @brief Is profiling enabled? */
+  inline Bool isEnabled() {return enabled_.load(std::memory_order_relaxed);}
+
+  /** @brief Monotonic wall clock time [seconds], e.g. for busy times in parallel loops. */
+  Double seconds();
+
+  /** @brief Add @a value to counter @a name (within the current scope). */
+  void count(const char *name, Double value);
+
+  /** @brief Log a hierarchical summary of all scopes and counters aggregated over all processes in @a comm and reset.
+  * Includes current and peak memory of the categories and the resident memory (maximum of the processes).
+  * Must be called by every process in @a comm. Only the outermost call (no open scopes) is reported. */
+  void report(Parallel::CommunicatorPtr comm);
+
+  /** @brief Log current and peak memory of this process (e.g. within loops). Resident memory is always reported,
+  * the memory categories only if profiling is enabled. Other processes log only with enabled output (see Log::enableOutput). */
+  void logMemory();
+
+  /** @brief Index of memory category @a name (created at first use). */
+  UInt memoryCategoryIndex(const char *name);
+
+  /** @brief Memory category of allocations in the current thread. */
+  UInt memoryCategory();
+
+  /** @brief Add @a bytes (negative if freed) to memory @a category. */
+  void memoryAdd(UInt category, Int64 bytes);
+
+  /** @brief Write all recorded scopes of all processes as Chrome trace (JSON), viewable with Perfetto.
+  * Must be called by every process in @a comm. */
+  void writeTrace(const FileName &fileName, Parallel::CommunicatorPtr comm);
+
+  /** @brief Measures the time between construction and destruction. */
+  class Scope
+  {
+    Bool active;
+    void start(const char *name);
+    void stop();
+
+  public:
+    explicit Scope(const char *name) : active(isEnabled()) {if(active) start(name);}
+    explicit Scope(const std::string &name) : active(isEnabled()) {if(active) start(name.c_str());}
+   ~Scope() {if(active) stop();}
+
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+  };
+
+  /** @brief Matrix allocations of the current thread between construction and destruction are accounted to a memory category.
+  * The memory is accounted to the category until it is freed. */
+  class MemoryCategory
+  {
+    UInt categoryOld;
+    Bool active;
+
+  public:
+    explicit MemoryCategory(const char *name);
+   ~MemoryCategory();
+
+    MemoryCategory(const MemoryCategory &) = delete;
+    MemoryCategory &operator=(const MemoryCategory &) = delete;
+  };
+
+  /** @brief Memory of a data structure (e.g. the size of containers) accounted to a memory category until destruction.
+  * Copies start with zero bytes. */
+  class MemoryAccount
+  {
+    UInt  category;
+    Int64 bytes;
+
+  public:
+    explicit MemoryAccount(const char *name) : category(memoryCategoryIndex(name)), bytes(0) {}
+    MemoryAccount(const MemoryAccount &x) : category(x.category), bytes(0) {}
+   ~MemoryAccount() {set(0);}
+    MemoryAccount &operator=(const MemoryAccount &) {return *this;}
+
+    /** @brief Set the current memory size in bytes. */
+    void set(Int64 bytesNew) {memoryAdd(category, bytesNew-bytes); bytes = bytesNew;}
+  };
+}
+
+/***********************************************/
+
+/// @}
+
+#endif
@@ -87,6 +87,34 @@ Bool System::remove(const FileName &fileName)
 
 /***********************************************/
 
+Bool System::rename(const FileName &fileNameOld, const FileName &fileNameNew)
+{
+  std::error_code ec;
+  fs::rename(fileNameOld.str(), fileNameNew.str(), ec);
+  return !ec;
+}
+
+/***********************************************/
+
+std::vector<FileName> System::directoryContent(const FileName &directory)
+{
+  try
+  {
+    std::vector<FileName> fileNames;
+    for(const auto &entry : fs::directory_iterator(directory.str()))
+      if(fs::is_regular_file(entry.status()))
+        fileNames.push_back(FileName(entry.path().filename().string()));
+    std::sort(fileNames.begin(), fileNames.end(), [](const FileName &a, const FileName &b) {return a.str() < b.str();});
+    return fileNames;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 Bool System::exists(const FileName &fileName)
 {
   return fs::exists(fileName.str());
@@ -101,6 +129,29 @@ Bool System::isDirectory(const FileName &fileName)
 
 /***********************************************/
 
+UInt System::fileSize(const FileName &fileName)
+{
+  std::error_code ec;
+  if(fs::is_directory(fileName.str(), ec))
+    return 0;
+  const auto size = fs::file_size(fileName.str(), ec);
+  return ec ? 0 : static_cast<UInt>(size);
+}
+
+/***********************************************/
+
+std::string System::fileStatus(const FileName &fileName)
+{
+  std::error_code ec;
+  const auto time = fs::last_write_time(fileName.str(), ec);
+  if(ec)
+    return std::string();
+  const UInt size = fs::is_directory(fileName.str()) ? 0 : static_cast<UInt>(fs::file_size(fileName.str(), ec));
+  return std::to_string(size)+":"+std::to_string(time.time_since_epoch().count());
+}
+
+/***********************************************/
+
 FileName System::currentWorkingDirectory()
 {
   return FileName(fs::current_path().string());
@@ -117,3 +168,19 @@ Time System::now()
 }
 
 /***********************************************/
+
+Bool System::memoryUsage(UInt &current, UInt &peak)
+{
+  current = peak = 0;
+  std::ifstream file("/proc/self/status");
+  for(std::string line; std::getline(file, line);)
+  {
+    if(line.compare(0, 6, "VmRSS:") == 0)
+      current = 1024*static_cast<UInt>(std::strtoull(line.c_str()+6, nullptr, 10)); // kB
+    else if(line.compare(0, 6, "VmHWM:") == 0)
+      peak    = 1024*static_cast<UInt>(std::strtoull(line.c_str()+6, nullptr, 10)); // kB
+  }
+  return (current != 0);
+}
+
+/***********************************************/
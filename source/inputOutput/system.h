@@ -42,17 +42,35 @@ namespace System
   * @return TRUE if the file was deleted. */
   Bool remove(const FileName &fileName);
 
+  /** @brief Rename or move a file.
+  * @return TRUE if the file was renamed. */
+  Bool rename(const FileName &fileNameOld, const FileName &fileNameNew);
+
+  /** @brief Names of all regular files in a directory (without path), sorted alphabetically. */
+  std::vector<FileName> directoryContent(const FileName &directory);
+
   /** @brief Checks if the given file or path corresponds to an existing file or directory. */
   Bool exists(const FileName &fileName);
 
   /** @brief Check whether fileName is an existing directory */
   Bool isDirectory(const FileName &fileName);
 
+  /** @brief Size of a file in bytes, zero if the file does not exist or is a directory. */
+  UInt fileSize(const FileName &fileName);
+
+  /** @brief Size and last modification time of a file as string.
+  * Can be compared to detect changes of the file. Empty if the file does not exist. */
+  std::string fileStatus(const FileName &fileName);
+
   /** @brief Current working directory as FileName. */
   FileName currentWorkingDirectory();
 
   /** @brief Current time as used by the file system. */
   Time now();
+
+  /** @brief Resident memory of this process in bytes (@p current and @p peak since start).
+  * Returns FALSE if not available on this system (read from /proc/self/status). */
+  Bool memoryUsage(UInt &current, UInt &peak);
 }
 
 /***********************************************/
@@ -17,17 +17,91 @@
 
 /***********************************************/
 
+SatelliteTrackingArc GraceKBandGeometry::satelliteTracking(const OrbitArc &orbit1, const OrbitArc &orbit2, Matrix &lineOfSight, Matrix &rangeRatePartial)
+{
+  try
+  {
+    Arc::checkSynchronized({orbit1, orbit2});
+    const UInt epochCount = orbit1.size();
+
+    // relative position, velocity, acceleration as columns (x,y,z)
+    Matrix pos(epochCount, 3), vel(epochCount, 3), acc(epochCount, 3);
+    auto copyRow = [](const Vector3d &v, MatrixSliceRef row) {row(0,0) = v.x(); row(0,1) = v.y(); row(0,2) = v.z();};
+    for(UInt i=0; i<epochCount; i++)
+    {
+      copyRow(orbit2.at(i).position     - orbit1.at(i).position,     pos.row(i));
+      copyRow(orbit2.at(i).velocity     - orbit1.at(i).velocity,     vel.row(i));
+      copyRow(orbit2.at(i).acceleration - orbit1.at(i).acceleration, acc.row(i));
+    }
+
+    Matrix A(epochCount, 4);
+    lineOfSight      = Matrix(epochCount, 3);
+    rangeRatePartial = Matrix(epochCount, 3);
+    const Double *px = pos.field(), *py = px+pos.ld(), *pz = py+pos.ld();
+    const Double *vx = vel.field(), *vy = vx+vel.ld(), *vz = vy+vel.ld();
+    const Double *ax = acc.field(), *ay = ax+acc.ld(), *az = ay+acc.ld();
+    Double *range = A.field()+A.ld(), *rangeRate = range+A.ld(), *rangeAcc = rangeRate+A.ld();
+    Double *ex = lineOfSight.field(),      *ey = ex+lineOfSight.ld(),      *ez = ey+lineOfSight.ld();
+    Double *dx = rangeRatePartial.field(), *dy = dx+rangeRatePartial.ld(), *dz = dy+rangeRatePartial.ld();
+    for(UInt i=0; i<epochCount; i++)
+    {
+      range[i]     = std::sqrt(px[i]*px[i]+py[i]*py[i]+pz[i]*pz[i]);
+      rangeRate[i] = (px[i]*vx[i]+py[i]*vy[i]+pz[i]*vz[i])/range[i];
+      rangeAcc[i]  = ((vx[i]*vx[i]+vy[i]*vy[i]+vz[i]*vz[i])-std::pow(rangeRate[i],2))/range[i]
+                   + (px[i]*ax[i]+py[i]*ay[i]+pz[i]*az[i])/range[i];
+      ex[i] = px[i]/range[i];
+      ey[i] = py[i]/range[i];
+      ez[i] = pz[i]/range[i];
+      dx[i] = (vx[i]-rangeRate[i]*ex[i])/range[i];
+      dy[i] = (vy[i]-rangeRate[i]*ey[i])/range[i];
+      dz[i] = (vz[i]-rangeRate[i]*ez[i])/range[i];
+    }
+
+    return Arc(orbit1.times(), A, Epoch::Type::SATELLITETRACKING);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+SatelliteTrackingArc GraceKBandGeometry::satelliteTracking(const OrbitArc &orbit1, const OrbitArc &orbit2)
+{
+  Matrix lineOfSight, rangeRatePartial;
+  return satelliteTracking(orbit1, orbit2, lineOfSight, rangeRatePartial);
+}
+
+/***********************************************/
+
 SatelliteTrackingArc GraceKBandGeometry::antennaCenterCorrection(const OrbitArc &orbit1, const OrbitArc &orbit2,
                                                                  const StarCameraArc &starCamera1, const StarCameraArc &starCamera2,
                                                                  const Vector3d &center1, const Vector3d &center2, UInt degree)
 {
   try
   {
-    Matrix A(orbit1.size(), 4);
-    for(UInt i=0; i<A.rows(); i++)
+    Arc::checkSynchronized({orbit1, orbit2, starCamera1, starCamera2});
+    const UInt epochCount = orbit1.size();
+
+    // antenna centers in CRF, rotated as columns (x,y,z) for the whole arc
+    std::vector<Rotary3d> rot1(epochCount), rot2(epochCount);
+    Matrix v1(epochCount, 3), v2(epochCount, 3);
+    for(UInt i=0; i<epochCount; i++)
+    {
+      rot1.at(i) = starCamera1.at(i).rotary;
+      rot2.at(i) = starCamera2.at(i).rotary;
+      v1(i,0) = center1.x(); v1(i,1) = center1.y(); v1(i,2) = center1.z();
+      v2(i,0) = center2.x(); v2(i,1) = center2.y(); v2(i,2) = center2.z();
+    }
+    rotate(rot1, v1);
+    rotate(rot2, v2);
+
+    Matrix A(epochCount, 4);
+    for(UInt i=0; i<epochCount; i++)
     {
-      const Vector3d u = (orbit2.at(i).position - orbit1.at(i).position);                                       // center of mass vector
-      const Vector3d v = (starCamera2.at(i).rotary.rotate(center2) - starCamera1.at(i).rotary.rotate(center1)); // combined antenna offset vector
+      const Vector3d u = (orbit2.at(i).position - orbit1.at(i).position);                         // center of mass vector
+      const Vector3d v(v2(i,0)-v1(i,0), v2(i,1)-v1(i,1), v2(i,2)-v1(i,2)); // combined antenna offset vector
       A(i,1) = u.r() - (u+v).r();  // COM - ANT -> AOC
     }
 
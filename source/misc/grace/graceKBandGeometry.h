@@ -23,6 +23,22 @@
 * @ingroup miscGroup */
 namespace GraceKBandGeometry
 {
+  /** @brief Computes ranges, range rates, and range accelerations between the centers of mass.
+  * The geometry of the whole arc is computed at once in columns (x,y,z) of the arc arrays.
+  * @param orbit1 Orbit of the first satellite (positions, velocities, accelerations)
+  * @param orbit2 Orbit of the second satellite (positions, velocities, accelerations)
+  * @param[out] lineOfSight epochCount x 3 unit vectors from satellite 1 to satellite 2,
+  *             which are also the partials of the range with respect to the position of satellite 2 (negative for satellite 1)
+  *             and of the range rate with respect to the velocity of satellite 2.
+  * @param[out] rangeRatePartial epochCount x 3 partials of the range rate with respect to the position of satellite 2
+  *             (negative for satellite 1).
+  * @return SatelliteTrackingArc with ranges, range rates, and range accelerations */
+  SatelliteTrackingArc satelliteTracking(const OrbitArc &orbit1, const OrbitArc &orbit2, Matrix &lineOfSight, Matrix &rangeRatePartial);
+
+  /** @brief Computes ranges, range rates, and range accelerations between the centers of mass.
+  * @see satelliteTracking(const OrbitArc &, const OrbitArc &, Matrix &, Matrix &) */
+  SatelliteTrackingArc satelliteTracking(const OrbitArc &orbit1, const OrbitArc &orbit2);
+
   /** @brief Computes the antenna offset correction.
   * @param orbit1 Orbit of the first satellite
   * @param orbit2 Orbit of the second satellite
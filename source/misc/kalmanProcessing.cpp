@@ -51,9 +51,10 @@ void AutoregressiveModel::distributedNormalsBlock(UInt epochCount, UInt row, UIn
   if(!hasNormals)
     this->computeNormalEquation();
 
-  for(UInt l = 0; l<epochCount-this->order(); l++)
-    if( (row>=l) && (column<=this->order()+l) )
-      axpy(1.0, N.at(row-l).at(column-l), X);
+  // only the epochs l with l <= row <= column <= l+order contribute
+  const UInt lStart = (column > this->order()) ? column-this->order() : 0;
+  for(UInt l = lStart; (l<=row) && (l+this->order()<epochCount); l++)
+    axpy(1.0, N.at(row-l).at(column-l), X);
 }
 
 /***********************************************/
@@ -286,3 +287,197 @@ std::vector< std::vector< std::vector<Matrix> > > AutoregressiveModelSequence::n
 }
 
 /***********************************************/
+/***********************************************/
+
+void KalmanProcessing::addMatrix(const_MatrixSliceRef A, MatrixDistributed &N)
+{
+  try
+  {
+    Parallel::CommunicatorPtr comm = N.communicator();
+    UInt count = A.rows();
+    Parallel::broadCast(count, 0, comm);
+    if(!count)
+      return;
+
+    Matrix A2;
+    if(Parallel::isMaster(comm))
+    {
+      A2 = A;
+      if(A2.getType() == Matrix::SYMMETRIC)
+        fillSymmetric(A2);
+    }
+
+    // master holds temporary copies of foreign blocks, which are added at the parent processes
+    const UInt blockCount = N.index2block(count-1)+1;
+    for(UInt i=0; i<blockCount; i++)
+      for(UInt k=i; k<blockCount; k++)
+        if(Parallel::isMaster(comm))
+        {
+          if(!N.isMyRank(i, k))
+            N.N(i, k) = ((i == k) ? Matrix(N.blockSize(i), Matrix::SYMMETRIC) : Matrix(N.blockSize(i), N.blockSize(k)));
+          const UInt rows    = std::min(N.blockSize(i), count-N.blockIndex(i));
+          const UInt columns = std::min(N.blockSize(k), count-N.blockIndex(k));
+          axpy(1., A2.slice(N.blockIndex(i), N.blockIndex(k), rows, columns), N.N(i, k).slice(0, 0, rows, columns));
+        }
+    N.reduceSum(FALSE/*timing*/);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void KalmanProcessing::addPropagation(const_MatrixSliceRef B, MatrixDistributed &P, MatrixDistributed &N)
+{
+  try
+  {
+    // P*B' at all processes
+    Matrix PB = P.multiply(B.trans());
+    Parallel::broadCast(PB, 0, P.communicator());
+
+    // each process computes its own blocks
+    for(UInt i=0; i<N.blockCount(); i++)
+      for(UInt k=i; k<N.blockCount(); k++)
+        if(N.isMyRank(i, k))
+        {
+          Matrix BPB(N.blockSize(i), N.blockSize(k));
+          matMult(1., B.row(N.blockIndex(i), N.blockSize(i)), PB.column(N.blockIndex(k), N.blockSize(k)), BPB);
+          axpy(1., BPB, N.N(i, k));
+        }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Matrix KalmanProcessing::collectMatrix(const MatrixDistributed &N)
+{
+  try
+  {
+    Parallel::CommunicatorPtr comm = N.communicator();
+    Matrix A;
+    if(Parallel::isMaster(comm))
+      A = Matrix(N.parameterCount(), Matrix::SYMMETRIC);
+
+    for(UInt i=0; i<N.blockCount(); i++)
+      for(UInt k=i; k<N.blockCount(); k++)
+      {
+        if(Parallel::isMaster(comm))
+        {
+          Matrix tmp;
+          if(!N.isMyRank(i, k))
+            Parallel::receive(tmp, N.rank(i, k), comm);
+          copy(N.isMyRank(i, k) ? N.N(i, k) : tmp, A.slice(N.blockIndex(i), N.blockIndex(k), N.blockSize(i), N.blockSize(k)));
+        }
+        else if(N.isMyRank(i, k))
+          Parallel::send(N.N(i, k), 0, comm);
+      }
+
+    if(Parallel::isMaster(comm))
+      fillSymmetric(A);
+    return A;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void KalmanProcessing::squareRootPrediction(const_MatrixSliceRef model, Matrix &R, Matrix &z)
+{
+  try
+  {
+    const UInt dim   = model.rows();
+    const UInt order = model.columns()/dim-1;
+    const UInt count = order*dim;
+    if(R.rows() != count)
+      throw(Exception("dimension of AR model and state does not match ("+R.rows()%"%i"s+" vs. "s+count%"%i)"s));
+
+    // parameters: [x(t-p), x(t), x(t-1), ... , x(t-p+1)]
+    // old state:  [x(t-1), ... , x(t-p)]
+    Matrix A(count+dim, count+dim);
+    Matrix l(count+dim, 1);
+    zeroUnusedTriangle(R);
+    copy(R.column(count-dim, dim), A.slice(0, 0, count, dim));
+    copy(R.column(0, count-dim),   A.slice(0, 2*dim, count, count-dim));
+    copy(z, l.row(0, count));
+    // AR model: [x(t-p), ... , x(t-1), x(t)]
+    copy(model.column(0, dim), A.slice(count, 0, dim, dim));
+    for(UInt k=1; k<=order; k++)
+      copy(model.column(k*dim, dim), A.slice(count, (order-k+1)*dim, dim, dim));
+
+    const Vector tau = QR_decomposition(A);
+    QTransMult(A, tau, l);
+
+    R = Matrix(count, Matrix::TRIANGULAR, Matrix::UPPER);
+    copy(A.slice(dim, dim, count, count), R);
+    zeroUnusedTriangle(R);
+    z = l.row(dim, count);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void KalmanProcessing::squareRootUpdate(const_MatrixSliceRef N, const_MatrixSliceRef n, Matrix &R, Matrix &z)
+{
+  try
+  {
+    // square root of normal equations: H'H = N, H'y = n
+    Matrix H = N;
+    Matrix y = n;
+    try
+    {
+      cholesky(H);
+      triangularSolve(1., H.trans(), y);
+      zeroUnusedTriangle(H);
+      H.setType(Matrix::GENERAL);
+    }
+    catch(std::exception &/*e*/)
+    {
+      // singular normal equations
+      H = N;
+      const Vector eigen = eigenValueDecomposition(H);
+      const Double threshold = 1e-12*std::fabs(eigen(eigen.rows()-1));
+      y = H.trans()*n;
+      H = H.trans();
+      for(UInt i=0; i<eigen.rows(); i++)
+      {
+        const Double w = (eigen(i) > threshold) ? std::sqrt(eigen(i)) : 0.;
+        H.row(i) *= w;
+        y.row(i) *= (w > 0) ? 1./w : 0.;
+      }
+    }
+
+    Matrix A(R.rows()+H.rows(), R.columns());
+    Matrix l(R.rows()+H.rows(), 1);
+    zeroUnusedTriangle(R);
+    copy(R, A.row(0, R.rows()));
+    copy(H, A.slice(R.rows(), 0, H.rows(), H.columns()));
+    copy(z, l.row(0, R.rows()));
+    copy(y, l.row(R.rows(), y.rows()));
+
+    const Vector tau = QR_decomposition(A);
+    QTransMult(A, tau, l);
+
+    copy(A.row(0, R.rows()), R);
+    zeroUnusedTriangle(R);
+    z = l.row(0, R.rows());
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
@@ -89,6 +89,7 @@ J Geod 93, 2543–2552 (2019). \url{https://doi.org/10.1007/s00190-019-01314-1}
 
 #include "base/matrix.h"
 #include "config/config.h"
+#include "parallel/matrixDistributed.h"
 
 /***** CLASS ***********************************/
 
@@ -170,6 +171,9 @@ public:
   /** @brief Dimension (number of parameters) of the model. */
   UInt dimension() const { return _arModels.front().dimension(); }
 
+  /** @brief Pseudo observation equation of the AR model with @a order in the sequence. */
+  Matrix pseudoObservationEquation(UInt order) const { return _arModels.at(order).pseudoObservationEquation(); }
+
   /** @brief Return the normal equation block (row, column) in a matrix with blockCount blocks. */
   Matrix distributedNormalsBlock(UInt blockCount, UInt row, UInt column);
 
@@ -189,6 +193,35 @@ public:
 /** @brief Creates an instance of the class AutoregressiveModelSequence. */
 template<> Bool readConfig(Config &config, const std::string &name, AutoregressiveModelSequence &arModelSequence, Config::Appearance mustSet, const std::string &defaultValue, const std::string &annotation);
 
+/***** FUNCTIONS *******************************/
+
+/** @brief State covariance matrices distributed over several processes.
+* The matrices are stored as upper triangle of a dense MatrixDistributed (all blocks set). */
+namespace KalmanProcessing
+{
+  /** @brief Adds the symmetric matrix @a A to the upper left part of @a N.
+  * The input must be valid at master only. */
+  void addMatrix(const_MatrixSliceRef A, MatrixDistributed &N);
+
+  /** @brief Adds the propagated covariance matrix @f$ \mathbf{B}\mathbf{P}\mathbf{B}^T @f$ to @a N.
+  * @a B must be valid at all processes. @a P and @a N must have the same block structure. */
+  void addPropagation(const_MatrixSliceRef B, MatrixDistributed &P, MatrixDistributed &N);
+
+  /** @brief Collects the full symmetric matrix.
+  * Output is valid at master only. */
+  Matrix collectMatrix(const MatrixDistributed &N);
+
+  /** @brief Time update of the square root information filter.
+  * The state is given by the triangular factor @a R of the information matrix and @a z, with @f$ \mathbf{R}\mathbf{x} = \mathbf{z} @f$.
+  * The AR model @a model (pseudo observation equations with unit weight) predicts the next state.
+  * The state leaving the AR(1) representation is eliminated with a QR decomposition. */
+  void squareRootPrediction(const_MatrixSliceRef model, Matrix &R, Matrix &z);
+
+  /** @brief Measurement update of the square root information filter.
+  * The normal equations @a N, @a n refer to the first parameters of the state. */
+  void squareRootUpdate(const_MatrixSliceRef N, const_MatrixSliceRef n, Matrix &R, Matrix &z);
+}
+
 /***********************************************/
 
 #endif /* __GROOPS_KALMANPROCESSING__ */
@@ -13,6 +13,7 @@
 
 #include "base/import.h"
 #include "inputOutput/logging.h"
+#include "inputOutput/fileCache.h"
 #include "miscGriddedData.h"
 
 /***********************************************/
@@ -219,6 +220,24 @@ void printStatistics(const GriddedDataRectangular &grid)
 /***********************************************/
 /***********************************************/
 
+// Legendre functions of a row of a rectangular grid.
+// Repeated synthesis on the same grid (e.g. in loops) takes them from the process wide cache.
+static Matrix legendreFunctions(Angle theta, Double r, UInt maxDegree)
+{
+  std::stringstream ss;
+  ss<<std::hexfloat<<"legendreFunctions|"<<maxDegree<<"|"<<static_cast<Double>(theta)<<"|"<<r;
+  const std::string key = ss.str();
+
+  auto Pnm = std::static_pointer_cast<const Matrix>(FileCache::find(key));
+  if(Pnm)
+    return *Pnm;
+  auto PnmNew = std::make_shared<Matrix>(SphericalHarmonics::Pnm(theta, r, maxDegree, FALSE));
+  FileCache::insert(key, PnmNew, PnmNew->size()*sizeof(Double));
+  return *PnmNew;
+}
+
+/***********************************************/
+
 std::vector<Double> synthesisSphericalHarmonics(const SphericalHarmonics &harm, const std::vector<Vector3d> &points, KernelPtr kernel, Parallel::CommunicatorPtr comm, Bool timing)
 {
   try
@@ -228,29 +247,17 @@ std::vector<Double> synthesisSphericalHarmonics(const SphericalHarmonics &harm,
     std::vector<Double>   r;
     if(GriddedData(Ellipsoid(), points, std::vector<Double>(), std::vector<std::vector<Double>>()).isRectangle(lambda, phi, r))
     {
-      if(!Parallel::isMaster(comm))
-        return field;
-
       // spherical harmonics with recatangular grid
-      Matrix cossinm(lambda.size(), 2*harm.maxDegree()+1);
-      for(UInt i=0; i<lambda.size(); i++)
-      {
-        cossinm(i,0) = 1.;
-        for(UInt m=1; m<=harm.maxDegree(); m++)
-        {
-          cossinm(i,2*m-1) = cos(m*static_cast<Double>(lambda.at(i)));
-          cossinm(i,2*m+0) = sin(m*static_cast<Double>(lambda.at(i)));
-        }
-      }
-
-      // Compute Legendre functions for each phi (row)
-      // Parallel::forEach(phi.size(), [&](UInt i)
-      for(UInt i=0; i<phi.size(); i++)
+      // Legendre functions are computed only once for each phi (row),
+      // the rows are distributed over the processes
+      std::vector<Vector> sums(phi.size());
+      Parallel::forEach(sums, [&](UInt i)
       {
         const Vector3d p  = polar(lambda.at(0), phi.at(i), r.at(i));
         const Vector   kn = kernel->inverseCoefficients(p, harm.maxDegree(), harm.isInterior());
 
-        Matrix Pnm = SphericalHarmonics::Pnm(Angle(PI/2-phi.at(i)), r.at(i)/harm.R(), harm.maxDegree(), harm.isInterior());
+        Matrix Pnm = harm.isInterior() ? SphericalHarmonics::Pnm(Angle(PI/2-phi.at(i)), r.at(i)/harm.R(), harm.maxDegree(), TRUE)
+                                        : legendreFunctions(Angle(PI/2-phi.at(i)), r.at(i)/harm.R(), harm.maxDegree());
         for(UInt n=0; n<=harm.maxDegree(); n++)
           Pnm.slice(n,0,1,n+1) *= harm.GM()/harm.R()*kn(n);
 
@@ -261,11 +268,32 @@ std::vector<Double> synthesisSphericalHarmonics(const SphericalHarmonics &harm,
           sum(2*m-1) = inner(harm.cnm().slice(m,m,harm.maxDegree()-m+1,1), Pnm.slice(m,m,harm.maxDegree()-m+1,1));
           sum(2*m+0) = inner(harm.snm().slice(m,m,harm.maxDegree()-m+1,1), Pnm.slice(m,m,harm.maxDegree()-m+1,1));
         }
-        Vector row = cossinm * sum;
+        return sum;
+      }, comm, timing);
+
+      if(!Parallel::isMaster(comm))
+        return field;
+
+      Matrix cossinm(lambda.size(), 2*harm.maxDegree()+1);
+      for(UInt k=0; k<lambda.size(); k++)
+      {
+        cossinm(k,0) = 1.;
+        for(UInt m=1; m<=harm.maxDegree(); m++)
+        {
+          cossinm(k,2*m-1) = cos(m*static_cast<Double>(lambda.at(k)));
+          cossinm(k,2*m+0) = sin(m*static_cast<Double>(lambda.at(k)));
+        }
+      }
+
+      // synthesis along all rows at once (lambda x phi)
+      Matrix sum(2*harm.maxDegree()+1, phi.size());
+      for(UInt i=0; i<phi.size(); i++)
+        copy(sums.at(i), sum.column(i));
+      sums.clear();
+      const Matrix values = cossinm * sum;
+      for(UInt i=0; i<phi.size(); i++)
         for(UInt k=0; k<lambda.size(); k++)
-          field.at(i*lambda.size()+k) = row(k);
-      } //);
-      // Parallel::reduceSum(field);
+          field.at(i*lambda.size()+k) = values(k,i);
       return field;
     } // if(isRectangle)
 
@@ -283,6 +311,397 @@ std::vector<Double> synthesisSphericalHarmonics(const SphericalHarmonics &harm,
 
 /***********************************************/
 
+Matrix synthesisSphericalHarmonics(Double GM, Double R, const_MatrixSliceRef x, const std::vector<Vector3d> &points, KernelPtr kernel, Parallel::CommunicatorPtr comm, Bool timing)
+{
+  try
+  {
+    const UInt maxDegree = static_cast<UInt>(std::round(std::sqrt(x.rows())))-1;
+    if((maxDegree+1)*(maxDegree+1) != x.rows())
+      throw(Exception("number of coefficients ("+x.rows()%"%i) does not correspond to a complete maximum degree"s));
+
+    Matrix field;
+    std::vector<Angle>  lambda, phi;
+    std::vector<Double> r;
+    if(GriddedData(Ellipsoid(), points, std::vector<Double>(), std::vector<std::vector<Double>>()).isRectangle(lambda, phi, r))
+    {
+      // coefficients sorted orderwise: cnm(m..maxDegree, m), snm(m..maxDegree, m)
+      Matrix xOrder(x.rows(), x.columns());
+      UInt idx = 0;
+      for(UInt m=0; m<=maxDegree; m++)
+      {
+        for(UInt n=m; n<=maxDegree; n++)
+          copy(x.row(n*n+((m>0) ? 2*m-1 : 0)), xOrder.row(idx++));
+        if(m>0)
+          for(UInt n=m; n<=maxDegree; n++)
+            copy(x.row(n*n+2*m), xOrder.row(idx++));
+      }
+
+      Matrix cossinm(lambda.size(), 2*maxDegree+1);
+      for(UInt k=0; k<lambda.size(); k++)
+      {
+        cossinm(k,0) = 1.;
+        for(UInt m=1; m<=maxDegree; m++)
+        {
+          cossinm(k,2*m-1) = cos(m*static_cast<Double>(lambda.at(k)));
+          cossinm(k,2*m+0) = sin(m*static_cast<Double>(lambda.at(k)));
+        }
+      }
+
+      // Legendre functions are computed only once for each phi (row),
+      // the rows are distributed over the processes
+      std::vector<Matrix> rows(phi.size());
+      Parallel::forEach(rows, [&](UInt i)
+      {
+        const Vector3d p  = polar(lambda.at(0), phi.at(i), r.at(i));
+        const Vector   kn = kernel->inverseCoefficients(p, maxDegree, FALSE);
+
+        Matrix Pnm = legendreFunctions(Angle(PI/2-phi.at(i)), r.at(i)/R, maxDegree);
+        for(UInt n=0; n<=maxDegree; n++)
+          Pnm.slice(n,0,1,n+1) *= GM/R*kn(n);
+
+        Matrix sum(2*maxDegree+1, x.columns());
+        UInt idx = 0;
+        for(UInt m=0; m<=maxDegree; m++)
+        {
+          const UInt count = maxDegree-m+1;
+          matMult(1., Pnm.slice(m,m,count,1).trans(), xOrder.row(idx, count), sum.row((m>0) ? 2*m-1 : 0));
+          idx += count;
+          if(m>0)
+          {
+            matMult(1., Pnm.slice(m,m,count,1).trans(), xOrder.row(idx, count), sum.row(2*m));
+            idx += count;
+          }
+        }
+        return cossinm * sum; // lambda x expansions
+      }, comm, timing);
+
+      if(Parallel::isMaster(comm))
+      {
+        field = Matrix(points.size(), x.columns());
+        for(UInt i=0; i<phi.size(); i++)
+          copy(rows.at(i), field.row(i*lambda.size(), lambda.size()));
+      }
+      return field;
+    } // if(isRectangle)
+
+    // arbitrary point distribution: synthesis matrix for blocks of points (about 80 MB each)
+    const UInt processCount = 4*Parallel::size(comm);
+    const UInt blockSize    = std::max(UInt(1), std::min(UInt(10000000)/x.rows(), (points.size()+processCount-1)/processCount));
+    std::vector<Matrix> blocks((points.size()+blockSize-1)/blockSize);
+    Parallel::forEach(blocks, [&](UInt i)
+    {
+      const std::vector<Vector3d> pointsBlock(points.begin()+i*blockSize, points.begin()+std::min(points.size(), (i+1)*blockSize));
+      return synthesisSphericalHarmonicsMatrix(maxDegree, GM, R, pointsBlock, kernel) * x;
+    }, comm, timing);
+
+    if(Parallel::isMaster(comm))
+    {
+      field = Matrix(points.size(), x.columns());
+      for(UInt i=0; i<blocks.size(); i++)
+        copy(blocks.at(i), field.row(i*blockSize, blocks.at(i).rows()));
+    }
+    return field;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Vector synthesisSphericalHarmonicsWeightedSum(UInt maxDegree, Double GM, Double R, const std::vector<Vector3d> &points, const std::vector<Double> &weights, KernelPtr kernel, Parallel::CommunicatorPtr comm)
+{
+  try
+  {
+    if(points.size() != weights.size())
+      throw(Exception("number of points ("+points.size()%"%i) and weights ("s+weights.size()%"%i) differ"s));
+
+    Vector b((maxDegree+1)*(maxDegree+1));
+    std::vector<Angle>  lambda, phi;
+    std::vector<Double> r;
+    if(GriddedData(Ellipsoid(), points, std::vector<Double>(), std::vector<std::vector<Double>>()).isRectangle(lambda, phi, r))
+    {
+      Matrix cossinm(lambda.size(), 2*maxDegree+1);
+      for(UInt k=0; k<lambda.size(); k++)
+      {
+        cossinm(k,0) = 1.;
+        for(UInt m=1; m<=maxDegree; m++)
+        {
+          cossinm(k,2*m-1) = cos(m*static_cast<Double>(lambda.at(k)));
+          cossinm(k,2*m+0) = sin(m*static_cast<Double>(lambda.at(k)));
+        }
+      }
+
+      // weights are summed along each row (phi) for each order,
+      // Legendre functions are computed only once for each row
+      Parallel::forEach(phi.size(), [&](UInt i)
+      {
+        const Matrix sum = Vector(std::vector<Double>(weights.begin()+i*lambda.size(), weights.begin()+(i+1)*lambda.size())).trans() * cossinm;
+
+        const Vector3d p   = polar(lambda.at(0), phi.at(i), r.at(i));
+        const Vector   kn  = kernel->inverseCoefficients(p, maxDegree, FALSE);
+        const Matrix   Pnm = legendreFunctions(Angle(PI/2-phi.at(i)), r.at(i)/R, maxDegree);
+        UInt idx = 0;
+        for(UInt n=0; n<=maxDegree; n++)
+        {
+          const Double factor = GM/R*kn(n);
+          b(idx++) += factor * Pnm(n,0) * sum(0,0);
+          for(UInt m=1; m<=n; m++)
+          {
+            b(idx++) += factor * Pnm(n,m) * sum(0,2*m-1);
+            b(idx++) += factor * Pnm(n,m) * sum(0,2*m+0);
+          }
+        }
+      }, comm);
+      Parallel::reduceSum(b, 0, comm);
+      return b;
+    } // if(isRectangle)
+
+    // arbitrary point distribution: synthesis matrix for blocks of points
+    const UInt blockSize = std::max(UInt(1), std::min(UInt(10000000)/b.rows(), UInt(1000)));
+    Parallel::forEach((points.size()+blockSize-1)/blockSize, [&](UInt i)
+    {
+      const UInt count = std::min(blockSize, points.size()-i*blockSize);
+      const std::vector<Vector3d> pointsBlock(points.begin()+i*blockSize, points.begin()+i*blockSize+count);
+      matMult(1., synthesisSphericalHarmonicsMatrix(maxDegree, GM, R, pointsBlock, kernel).trans(),
+              Vector(std::vector<Double>(weights.begin()+i*blockSize, weights.begin()+i*blockSize+count)), b);
+    }, comm);
+    Parallel::reduceSum(b, 0, comm);
+    return b;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+std::vector<SphericalHarmonics> analysisSphericalHarmonics(UInt maxDegree, Double GM, Double R, const std::vector<Vector3d> &points, const std::vector<Double> &weights,
+                                                           const std::vector<std::vector<Double>> &values, KernelPtr kernel, Parallel::CommunicatorPtr comm, Bool timing)
+{
+  try
+  {
+    if(points.size() != weights.size())
+      throw(Exception("number of points ("+points.size()%"%i) and weights ("s+weights.size()%"%i) differ"s));
+    for(const auto &field : values)
+      if(field.size() != points.size())
+        throw(Exception("number of points ("+points.size()%"%i) and values ("s+field.size()%"%i) differ"s));
+
+    // coefficients for each field (columns) sorted degreewise
+    Matrix x((maxDegree+1)*(maxDegree+1), values.size());
+    std::vector<Angle>  lambda, phi;
+    std::vector<Double> r;
+    if(GriddedData(Ellipsoid(), points, std::vector<Double>(), std::vector<std::vector<Double>>()).isRectangle(lambda, phi, r))
+    {
+      Matrix cossinm(lambda.size(), 2*maxDegree+1);
+      for(UInt k=0; k<lambda.size(); k++)
+      {
+        cossinm(k,0) = 1.;
+        for(UInt m=1; m<=maxDegree; m++)
+        {
+          cossinm(k,2*m-1) = cos(m*static_cast<Double>(lambda.at(k)));
+          cossinm(k,2*m+0) = sin(m*static_cast<Double>(lambda.at(k)));
+        }
+      }
+
+      // weighted values are summed along each row (phi) for each order and field,
+      // Legendre functions are computed only once for each row
+      Parallel::forEach(phi.size(), [&](UInt i)
+      {
+        Matrix l(lambda.size(), values.size());
+        for(UInt idField=0; idField<values.size(); idField++)
+          for(UInt k=0; k<lambda.size(); k++)
+            l(k, idField) = weights.at(i*lambda.size()+k) * values.at(idField).at(i*lambda.size()+k);
+        const Matrix sum = cossinm.trans() * l; // (2*maxDegree+1) x fields
+
+        const Vector3d p   = polar(lambda.at(0), phi.at(i), r.at(i));
+        const Vector   kn  = kernel->coefficients(p, maxDegree);
+        const Matrix   Pnm = legendreFunctions(Angle(PI/2-phi.at(i)), 1., maxDegree);
+        for(UInt n=0; n<=maxDegree; n++)
+        {
+          const Double factor = kn(n) * R/(4*PI*GM) * std::pow(r.at(i)/R, n+1);
+          axpy(factor*Pnm(n,0), sum.row(0), x.row(n*n));
+          for(UInt m=1; m<=n; m++)
+          {
+            axpy(factor*Pnm(n,m), sum.row(2*m-1), x.row(n*n+2*m-1));
+            axpy(factor*Pnm(n,m), sum.row(2*m+0), x.row(n*n+2*m+0));
+          }
+        }
+      }, comm, timing);
+    }
+    else
+    {
+      // arbitrary point distribution
+      Parallel::forEach(points.size(), [&](UInt i)
+      {
+        Matrix l(1, values.size());
+        for(UInt idField=0; idField<values.size(); idField++)
+          l(0, idField) = weights.at(i) * values.at(idField).at(i);
+
+        const Vector kn = kernel->coefficients(points.at(i), maxDegree);
+        Matrix Cnm, Snm;
+        SphericalHarmonics::CnmSnm(points.at(i)/points.at(i).r(), maxDegree, Cnm, Snm);
+        for(UInt n=0; n<=maxDegree; n++)
+        {
+          const Double factor = kn(n) * R/(4*PI*GM) * std::pow(points.at(i).r()/R, n+1);
+          axpy(factor*Cnm(n,0), l, x.row(n*n));
+          for(UInt m=1; m<=n; m++)
+          {
+            axpy(factor*Cnm(n,m), l, x.row(n*n+2*m-1));
+            axpy(factor*Snm(n,m), l, x.row(n*n+2*m+0));
+          }
+        }
+      }, comm, timing);
+    }
+    Parallel::reduceSum(x, 0, comm);
+
+    std::vector<SphericalHarmonics> harms(values.size());
+    if(Parallel::isMaster(comm))
+      for(UInt idField=0; idField<values.size(); idField++)
+      {
+        Matrix cnm(maxDegree+1, Matrix::TRIANGULAR, Matrix::LOWER);
+        Matrix snm(maxDegree+1, Matrix::TRIANGULAR, Matrix::LOWER);
+        for(UInt n=0; n<=maxDegree; n++)
+        {
+          cnm(n,0) = x(n*n, idField);
+          for(UInt m=1; m<=n; m++)
+          {
+            cnm(n,m) = x(n*n+2*m-1, idField);
+            snm(n,m) = x(n*n+2*m+0, idField);
+          }
+        }
+        harms.at(idField) = SphericalHarmonics(GM, R, cnm, snm);
+      }
+    return harms;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+std::vector<Double> varianceSphericalHarmonics(Double GM, Double R, Matrix covariance, const std::vector<Vector3d> &points, KernelPtr kernel, Parallel::CommunicatorPtr comm, Bool timing)
+{
+  try
+  {
+    if(!covariance.size())
+      return std::vector<Double>(points.size(), 0.);
+    const UInt maxDegree = static_cast<UInt>(std::round(std::sqrt(covariance.rows())))-1;
+    if((maxDegree+1)*(maxDegree+1) != covariance.rows())
+      throw(Exception("number of coefficients ("+covariance.rows()%"%i) does not correspond to a complete maximum degree"s));
+    const Bool isFull = (covariance.getType() == Matrix::SYMMETRIC);
+
+    // parameters with variance
+    std::vector<UInt> index;
+    for(UInt i=0; i<covariance.rows(); i++)
+      if((isFull ? covariance(i,i) : covariance(i,0)) > 0)
+        index.push_back(i);
+
+    // factorization C = W^T W
+    Matrix W;
+    if(isFull)
+    {
+      if(index.size() == covariance.rows())
+        std::swap(W, covariance);
+      else
+      {
+        W = Matrix(index.size(), Matrix::SYMMETRIC, Matrix::UPPER);
+        for(UInt s=0; s<index.size(); s++)
+          for(UInt z=0; z<=s; z++)
+            W(z,s) = covariance.isUpper() ? covariance(index.at(z), index.at(s)) : covariance(index.at(s), index.at(z));
+        covariance = Matrix();
+      }
+      cholesky(W);
+    }
+    else
+    {
+      W = Matrix(index.size(), 1);
+      for(UInt z=0; z<index.size(); z++)
+        W(z,0) = std::sqrt(covariance(index.at(z),0));
+    }
+
+    // synthesis for blocks of points: variance = ||W a||^2
+    const UInt blockSize = std::max(UInt(1), std::min(UInt(10000000)/((maxDegree+1)*(maxDegree+1)), UInt(1000)));
+    std::vector<Vector> blocks((points.size()+blockSize-1)/blockSize);
+    Parallel::forEach(blocks, [&](UInt i)
+    {
+      const std::vector<Vector3d> pointsBlock(points.begin()+i*blockSize, points.begin()+std::min(points.size(), (i+1)*blockSize));
+      const Matrix A = synthesisSphericalHarmonicsMatrix(maxDegree, GM, R, pointsBlock, kernel);
+      Matrix WA(index.size(), A.rows());
+      for(UInt z=0; z<index.size(); z++)
+        copy(A.column(index.at(z)).trans(), WA.row(z));
+      if(isFull)
+        triangularMult(1., W, WA);
+      else
+        for(UInt z=0; z<index.size(); z++)
+          WA.row(z) *= W(z,0);
+      Vector variance(A.rows());
+      for(UInt k=0; k<A.rows(); k++)
+        variance(k) = quadsum(WA.column(k));
+      return variance;
+    }, comm, timing);
+
+    std::vector<Double> variance;
+    if(Parallel::isMaster(comm))
+      for(UInt i=0; i<blocks.size(); i++)
+        for(UInt k=0; k<blocks.at(i).rows(); k++)
+          variance.push_back(blocks.at(i)(k));
+    return variance;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+std::vector<Double> covarianceSphericalHarmonics(Double GM, Double R, const_MatrixSliceRef covariance, const Vector3d &point0, const std::vector<Vector3d> &points, KernelPtr kernel, Parallel::CommunicatorPtr comm, Bool timing)
+{
+  try
+  {
+    if(!covariance.size())
+      return std::vector<Double>(points.size(), 0.);
+    const UInt maxDegree = static_cast<UInt>(std::round(std::sqrt(covariance.rows())))-1;
+    if((maxDegree+1)*(maxDegree+1) != covariance.rows())
+      throw(Exception("number of coefficients ("+covariance.rows()%"%i) does not correspond to a complete maximum degree"s));
+
+    // covariance between coefficients and source point: g = C a0
+    const Matrix a0 = synthesisSphericalHarmonicsMatrix(maxDegree, GM, R, {point0}, kernel).trans();
+    Vector g(covariance.rows());
+    if(covariance.getType() == Matrix::SYMMETRIC)
+      matMult(1., covariance, a0, g);
+    else
+      for(UInt i=0; i<g.rows(); i++)
+        g(i) = covariance(i,0) * a0(i,0);
+
+    const UInt blockSize = std::max(UInt(1), std::min(UInt(10000000)/covariance.rows(), UInt(1000)));
+    std::vector<Vector> blocks((points.size()+blockSize-1)/blockSize);
+    Parallel::forEach(blocks, [&](UInt i)
+    {
+      const std::vector<Vector3d> pointsBlock(points.begin()+i*blockSize, points.begin()+std::min(points.size(), (i+1)*blockSize));
+      return Vector(synthesisSphericalHarmonicsMatrix(maxDegree, GM, R, pointsBlock, kernel) * g);
+    }, comm, timing);
+
+    std::vector<Double> cov;
+    if(Parallel::isMaster(comm))
+      for(UInt i=0; i<blocks.size(); i++)
+        for(UInt k=0; k<blocks.at(i).rows(); k++)
+          cov.push_back(blocks.at(i)(k));
+    return cov;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 Matrix synthesisSphericalHarmonicsMatrix(UInt maxDegree, Double GM, Double R, const std::vector<Vector3d> &points, KernelPtr kernel, Bool isInterior)
 {
   try
@@ -43,10 +43,86 @@ namespace MiscGriddedData
   * @param points harm is evaluated at these points (fast on rectangular grid)
   * @param kernel define the ouput functional.
   * @param comm   communicator for parallel computation.
-  * @param timing start a loop timer for all grid points (only relevant for non-rectangular grids).
+  * @param timing start a loop timer for all grid points (rows of rectangular grids).
   * @return values at @a points (only valid at master). */
   std::vector<Double> synthesisSphericalHarmonics(const SphericalHarmonics &harmonic, const std::vector<Vector3d> &points, KernelPtr kernel, Parallel::CommunicatorPtr comm, Bool timing = TRUE);
 
+  /** @brief Generates functionals of several spherical harmonics expansions (e.g. a time series) on a grid.
+  * The Legendre functions and kernel coefficients are computed only once for all expansions
+  * (per row of rectangular grids or per block of points) and applied by matrix multiplications.
+  * Must be called from every node in parallel computations.
+  * @param GM geocentric gravitational constant
+  * @param R reference radius
+  * @param x coefficients of each expansion as column, sorted degreewise as SphericalHarmonics::x() (must be given at all nodes)
+  * @param points evaluation points (fast on rectangular grid)
+  * @param kernel define the ouput functional.
+  * @param comm   communicator for parallel computation.
+  * @param timing start a loop timer for all blocks of points (rows of rectangular grids).
+  * @return values at @a points (rows) for each expansion (columns), only valid at master. */
+  Matrix synthesisSphericalHarmonics(Double GM, Double R, const_MatrixSliceRef x, const std::vector<Vector3d> &points, KernelPtr kernel, Parallel::CommunicatorPtr comm, Bool timing = TRUE);
+
+  /** @brief Linear functional of a weighted sum of synthesized values (e.g. area mean).
+  * Computes the vector b with sum_k w_k f(p_k) = b^T x for the spherical harmonics vector x,
+  * which equals A^T w with A from @a synthesisSphericalHarmonicsMatrix.
+  * On rectangular grids the weights are summed along each row first, so the Legendre functions are computed once per row.
+  * Must be called from every node in parallel computations.
+  * @param maxDegree maximum expansion degree
+  * @param GM geocentric gravitational constant
+  * @param R reference radius
+  * @param points evaluation points
+  * @param weights of each point (e.g. area/totalArea)
+  * @param kernel define the ouput functional.
+  * @param comm   communicator for parallel computation.
+  * @return vector b sorted degreewise as SphericalHarmonics::x() (only valid at master). */
+  Vector synthesisSphericalHarmonicsWeightedSum(UInt maxDegree, Double GM, Double R, const std::vector<Vector3d> &points, const std::vector<Double> &weights, KernelPtr kernel, Parallel::CommunicatorPtr comm);
+
+  /** @brief Spherical harmonics analysis of functionals on a grid with a quadrature formula.
+  * Computes for each value field
+  * @f[ c_{nm} = \frac{1}{4\pi}\frac{R}{GM} \sum_i f_i \left(\frac{r_i}{R}\right)^{n+1} k_n C_{nm}(\lambda_i,\vartheta_i)\,\Delta\Phi_i. @f]
+  * On rectangular grids the sums along each row are computed first for all orders and fields
+  * and the Legendre functions are computed only once per row.
+  * Together with suitable weights (e.g. Gauss grids) this is an exact analysis.
+  * Must be called from every node in parallel computations.
+  * @param maxDegree maximum expansion degree
+  * @param GM geocentric gravitational constant
+  * @param R reference radius
+  * @param points grid points (fast on rectangular grid)
+  * @param weights area elements @f$\Delta\Phi_i@f$ of each point
+  * @param values fields of values at @a points (as GriddedData::values)
+  * @param kernel type of the input values.
+  * @param comm   communicator for parallel computation.
+  * @param timing start a loop timer for all points (rows of rectangular grids).
+  * @return spherical harmonics for each field (only valid at master). */
+  std::vector<SphericalHarmonics> analysisSphericalHarmonics(UInt maxDegree, Double GM, Double R, const std::vector<Vector3d> &points, const std::vector<Double> &weights,
+                                                             const std::vector<std::vector<Double>> &values, KernelPtr kernel, Parallel::CommunicatorPtr comm, Bool timing = TRUE);
+
+  /** @brief Variances of functionals on a grid propagated from the covariance matrix of spherical harmonics.
+  * The covariance matrix is factorized once (C = W^T W, parameters without variance are skipped)
+  * and the synthesis is computed for blocks of points, so the propagation uses matrix-matrix products.
+  * Must be called from every node in parallel computations.
+  * @param GM geocentric gravitational constant
+  * @param R reference radius
+  * @param covariance SYMMETRIC matrix or vector of variances, sorted degreewise as SphericalHarmonics::x() (must be given at all nodes)
+  * @param points evaluation points
+  * @param kernel define the ouput functional.
+  * @param comm   communicator for parallel computation.
+  * @param timing start a loop timer for all blocks of points.
+  * @return variances at @a points (only valid at master). */
+  std::vector<Double> varianceSphericalHarmonics(Double GM, Double R, Matrix covariance, const std::vector<Vector3d> &points, KernelPtr kernel, Parallel::CommunicatorPtr comm, Bool timing = TRUE);
+
+  /** @brief Covariances between functionals at a point and on a grid propagated from the covariance matrix of spherical harmonics.
+  * Must be called from every node in parallel computations.
+  * @param GM geocentric gravitational constant
+  * @param R reference radius
+  * @param covariance SYMMETRIC matrix or vector of variances, sorted degreewise as SphericalHarmonics::x()
+  * @param point0 source point
+  * @param points evaluation points
+  * @param kernel define the ouput functional.
+  * @param comm   communicator for parallel computation.
+  * @param timing start a loop timer for all blocks of points.
+  * @return covariances between @a point0 and @a points (only valid at master). */
+  std::vector<Double> covarianceSphericalHarmonics(Double GM, Double R, const_MatrixSliceRef covariance, const Vector3d &point0, const std::vector<Vector3d> &points, KernelPtr kernel, Parallel::CommunicatorPtr comm, Bool timing = TRUE);
+
   /** @brief Generates a linear functional for the synthesis of spherical harmonics coefficients on a grid.
   * This function generates a matrix A which represents the synthesis of a spherical harmonics vector x by matrix multiplication (y = Ax).
   * The columns of A start a degree zero are sorted degreewise.
@@ -210,14 +210,6 @@ void NormalsShortTimeStaticLongTime::init(ObservationPtr observation, const std:
     n        = Matrix(parameterCount(), observation->rightSideCount());
     lPl      = Vector(observation->rightSideCount());
     obsCount = 0;
-    if(countTemporalParameters)
-    {
-      normalsTemporal.resize(timesInterval.size()-1);
-      for(UInt idInterval=0; idInterval<timesInterval.size()-1; idInterval++)
-        normalsTemporal.at(idInterval).initEmpty(blockIndex, comm);
-      nTemporal.clear();
-      nTemporal.resize(timesInterval.size()-1, Matrix(parameterCount(), observation->rightSideCount()));
-    }
 
     // compute correct block indices
     // -----------------------------
@@ -254,6 +246,20 @@ void NormalsShortTimeStaticLongTime::init(ObservationPtr observation, const std:
 
 /***********************************************/
 
+std::vector<std::pair<UInt, Double>> NormalsShortTimeStaticLongTime::targetBlocks(UInt idInterval, UInt idBlock, Bool withZeros) const
+{
+  // static and long time blocks get the temporal factors of the interval
+  if(!blockCountTemporal || (idBlock < blockIndexTemporal.at(0)) || (idBlock >= blockIndexTemporal.at(0)+blockCountTemporal))
+    return {{idBlock, 1.}};
+  std::vector<std::pair<UInt, Double>> blocks;
+  for(UInt k=0; k<blockIndexTemporal.size(); k++)
+    if(withZeros || factorTemporal.at(k).at(idInterval))
+      blocks.push_back({idBlock-blockIndexTemporal.at(0)+blockIndexTemporal.at(k), factorTemporal.at(k).at(idInterval)});
+  return blocks;
+}
+
+/***********************************************/
+
 void NormalsShortTimeStaticLongTime::setBlocks(const std::vector<UInt> &arcsInterval)
 {
   try
@@ -262,20 +268,17 @@ void NormalsShortTimeStaticLongTime::setBlocks(const std::vector<UInt> &arcsInte
       if(arcsInterval.at(idInterval+1)-arcsInterval.at(idInterval) > 0)
         for(UInt i=0; i<indexN.at(idInterval).size(); i++)
           for(UInt k=i; k<indexN.at(idInterval).size(); k++)
-          {
-            const Bool isTemporal1 = blockCountTemporal && (blockIndexTemporal.at(0) <= indexN.at(idInterval).at(i)) && (indexN.at(idInterval).at(i) < blockIndexTemporal.at(0)+blockCountTemporal);
-            const Bool isTemporal2 = blockCountTemporal && (blockIndexTemporal.at(0) <= indexN.at(idInterval).at(k)) && (indexN.at(idInterval).at(k) < blockIndexTemporal.at(0)+blockCountTemporal);
-            if(isTemporal1 || isTemporal2)
-            {
-              normalsTemporal.at(idInterval).setBlock(indexN.at(idInterval).at(i), indexN.at(idInterval).at(k));
-              normalsTemporal.at(idInterval).N(indexN.at(idInterval).at(i), indexN.at(idInterval).at(k)) = Matrix();
-            }
-            else
-            {
-              setBlock(indexN.at(idInterval).at(i), indexN.at(idInterval).at(k));
-              N(indexN.at(idInterval).at(i), indexN.at(idInterval).at(k)) = Matrix();
-            }
-          }
+            for(const auto &block1 : targetBlocks(idInterval, indexN.at(idInterval).at(i), TRUE))
+              for(const auto &block2 : targetBlocks(idInterval, indexN.at(idInterval).at(k), TRUE))
+              {
+                const UInt row = std::min(block1.first, block2.first);
+                const UInt col = std::max(block1.first, block2.first);
+                if(!isBlockUsed(row, col))
+                {
+                  setBlock(row, col);
+                  N(row, col) = Matrix();
+                }
+              }
   }
   catch(std::exception &e)
   {
@@ -293,10 +296,6 @@ void NormalsShortTimeStaticLongTime::setNull()
     n.setNull();
     lPl.setNull();
     obsCount = 0;
-    for(UInt idInterval=0; idInterval+1<normalsTemporal.size(); idInterval++)
-      normalsTemporal.at(idInterval).setNull();
-    for(UInt idInterval=0; idInterval+1<nTemporal.size(); idInterval++)
-      nTemporal.at(idInterval).setNull();
   }
   catch(std::exception &e)
   {
@@ -332,8 +331,20 @@ void NormalsShortTimeStaticLongTime::accumulate(UInt idInterval, Matrix &l, Matr
     MatrixSlice A_bar( A.row(B.columns(), A.rows()-B.columns()) );
     MatrixSlice l_bar( l.row(B.columns(), l.rows()-B.columns()) );
 
+    // --- lambda -------------------
+    auto block = [&](UInt row, UInt col) -> Matrix&
+    {
+      Matrix &N2 = N(row, col);
+      if(N2.size() == 0)
+        N2 = (row == col) ? Matrix(blockSize(row), Matrix::SYMMETRIC) : Matrix(blockSize(row), blockSize(col));
+      return N2;
+    };
+    // ------------------------------
+
     // build normals
     // -------------
+    // the interval normals of static and long time blocks are added
+    // with the temporal factors of the interval directly to the combined normals
     obsCount += l_bar.rows();
     for(UInt i=0; i<l_bar.columns(); i++)
       lPl(i) += quadsum(l_bar.column(i)) + quadsum(l2.column(i));
@@ -341,28 +352,64 @@ void NormalsShortTimeStaticLongTime::accumulate(UInt idInterval, Matrix &l, Matr
     {
       const UInt idxN1 = indexN.at(idInterval).at(i);
       const UInt idxA1 = indexA.at(idInterval).at(i);
-      const Bool isTemporal1 = blockCountTemporal && (blockIndexTemporal.at(0) <= idxN1) && (idxN1 < blockIndexTemporal.at(0)+blockCountTemporal);
+      const auto blocks1 = targetBlocks(idInterval, idxN1);
+      const Bool isTemporal1 = (blocks1.size() != 1) || (blocks1.front().first != idxN1);
 
       // right hand sides
-      Matrix &n2 = (isTemporal1) ? nTemporal.at(idInterval) : n;
-      matMult(1., A_bar.column(idxA1, blockSize(idxN1)).trans(), l_bar, n2.row(blockIndex(idxN1), blockSize(idxN1)));
+      if(!isTemporal1)
+        matMult(1., A_bar.column(idxA1, blockSize(idxN1)).trans(), l_bar, n.row(blockIndex(idxN1), blockSize(idxN1)));
+      else
+      {
+        const Matrix n2 = A_bar.column(idxA1, blockSize(idxN1)).trans() * l_bar;
+        for(const auto &block1 : blocks1)
+          axpy(block1.second, n2, n.row(blockIndex(block1.first), blockSize(block1.first)));
+      }
 
       // normal matrix diagonal block
-      Matrix &N2 = (isTemporal1) ? normalsTemporal.at(idInterval).N(idxN1, idxN1) : N(idxN1, idxN1);
-      if(N2.size() == 0)
-        N2 = Matrix(blockSize(idxN1), Matrix::SYMMETRIC);
-      rankKUpdate(1.0, A_bar.column(idxA1, blockSize(idxN1)), N2);
+      if(!isTemporal1)
+        ::rankKUpdate(1.0, A_bar.column(idxA1, blockSize(idxN1)), block(idxN1, idxN1));
+      else
+      {
+        Matrix N2(blockSize(idxN1), Matrix::SYMMETRIC);
+        ::rankKUpdate(1.0, A_bar.column(idxA1, blockSize(idxN1)), N2);
+        Matrix N2Full = N2;
+        fillSymmetric(N2Full);
+        N2Full.setType(Matrix::GENERAL);
+        for(UInt p=0; p<blocks1.size(); p++)
+          for(UInt q=p; q<blocks1.size(); q++)
+          {
+            const Double factor = blocks1.at(p).second * blocks1.at(q).second;
+            const UInt   row    = std::min(blocks1.at(p).first, blocks1.at(q).first);
+            const UInt   col    = std::max(blocks1.at(p).first, blocks1.at(q).first);
+            axpy(factor, (row == col) ? N2 : N2Full, block(row, col));
+          }
+      }
 
       // normal matrix, other blocks
       for(UInt k=i+1; k<indexA.at(idInterval).size(); k++)
       {
         const UInt idxN2 = indexN.at(idInterval).at(k);
         const UInt idxA2 = indexA.at(idInterval).at(k);
-        const Bool isTemporal2 = blockCountTemporal && (blockIndexTemporal.at(0) <= idxN2) && (idxN2 < blockIndexTemporal.at(0)+blockCountTemporal);
-        Matrix &N2 = (isTemporal1 || isTemporal2) ? normalsTemporal.at(idInterval).N(idxN1, idxN2) : N(idxN1, idxN2);
-        if(N2.size() == 0)
-          N2 = Matrix(blockSize(idxN1), blockSize(idxN2));
-        matMult(1.0, A_bar.column(idxA1, blockSize(idxN1)).trans(), A_bar.column(idxA2, blockSize(idxN2)), N2);
+        const auto blocks2 = targetBlocks(idInterval, idxN2);
+        const Bool isTemporal2 = (blocks2.size() != 1) || (blocks2.front().first != idxN2);
+        if(!isTemporal1 && !isTemporal2)
+        {
+          matMult(1.0, A_bar.column(idxA1, blockSize(idxN1)).trans(), A_bar.column(idxA2, blockSize(idxN2)), block(idxN1, idxN2));
+          continue;
+        }
+
+        const Matrix N2 = A_bar.column(idxA1, blockSize(idxN1)).trans() * A_bar.column(idxA2, blockSize(idxN2));
+        for(const auto &block1 : blocks1)
+          for(const auto &block2 : blocks2)
+          {
+            const Double factor = block1.second * block2.second;
+            if(block1.first < block2.first)
+              axpy(factor, N2, block(block1.first, block2.first));
+            else if(block1.first > block2.first)
+              axpy(factor, N2.trans(), block(block2.first, block1.first));
+            else
+              axpy(factor, N2+N2.trans(), block(block1.first, block1.first));
+          }
       }
     }
   }
@@ -383,126 +430,11 @@ void NormalsShortTimeStaticLongTime::reduceSum(Bool timing)
     Parallel::reduceSum(lPl,      0, communicator());
     MatrixDistributed::reduceSum(timing);
 
-    if(blockCountTemporal == 0)
-      return;
-    if(timing) logStatus<<"setup long time normal equations"<<Log::endl;
-
-    // right hand side
-    for(UInt idInterval=0; idInterval<nTemporal.size(); idInterval++)
-      Parallel::reduceSum(nTemporal.at(idInterval), 0, communicator());
-
-    if(Parallel::isMaster(communicator()))
-      for(UInt blockRow=0; blockRow<blockCountTemporal; blockRow++)
-        for(UInt k=0; k<blockIndexTemporal.size(); k++)
-           for(UInt idInterval=0; idInterval<nTemporal.size(); idInterval++)
-             axpy(factorTemporal.at(k).at(idInterval),
-                  nTemporal.at(idInterval).row(blockIndex(blockRow+blockIndexTemporal.at(0)), blockSize(blockRow+blockIndexTemporal.at(k))),
-                  n.row(blockIndex(blockRow+blockIndexTemporal.at(k)), blockSize(blockRow+blockIndexTemporal.at(k))));
-
-    for(UInt idInterval=0; idInterval<normalsTemporal.size(); idInterval++)
-      normalsTemporal.at(idInterval).reduceSum(FALSE);
-
-    // --- lambda -------------------
-    auto send = [&](Matrix &N, UInt rankSource, UInt rankDest)
-    {
-      if(rankSource == rankDest)
-        return;
-      if(Parallel::myRank(communicator()) == rankSource)
-        Parallel::send(N, rankDest, communicator());
-      if(Parallel::myRank(communicator()) == rankDest)
-        Parallel::receive(N, rankSource, communicator());
-    };
-    // ------------------------------
-
-    for(UInt blockRow=0; blockRow<blockIndexTemporal.at(1); blockRow++)
-      for(UInt blockCol=blockRow; blockCol<blockIndexTemporal.at(1); blockCol++)
-      {
-        // --- lambda -------------------
-        auto reduceTemporal = [&](const std::vector<Double> &factor, Bool trans, UInt blocki, UInt blockk)
-        {
-          setBlock(blocki, blockk);
-          Matrix N2;
-          if(isMyRank(blockRow, blockCol))
-          {
-            N2 = Matrix(blockSize(blockRow), blockSize(blockCol));
-            for(UInt idInterval=0; idInterval<normalsTemporal.size(); idInterval++)
-              if(normalsTemporal.at(idInterval).isMyRank(blockRow, blockCol))
-                axpy(factor.at(idInterval), normalsTemporal.at(idInterval).N(blockRow, blockCol), N2);
-          }
-          send(N2, rank(blockRow, blockCol), rank(blocki, blockk));
-          if(isMyRank(blocki, blockk))
-          {
-            if(blockRow == blockCol)
-              N2.setType(Matrix::SYMMETRIC);
-            if((blockRow == blockCol) && (blocki != blockk))
-            {
-              fillSymmetric(N2);
-              N2.setType(Matrix::GENERAL);
-            }
-            N(blocki, blockk) = (trans) ? N2.trans() : N2;
-          }
-        };
-        // ------------------------------
-
-        // upper blocks
-        // ------------
-        if((blockRow < blockIndexTemporal.at(0)) &&
-           (blockIndexTemporal.at(0) <= blockCol) && (blockCol < blockIndexTemporal.at(0)+blockCountTemporal))
-        {
-          for(UInt k=0; k<blockIndexTemporal.size(); k++)
-            reduceTemporal(factorTemporal.at(k), FALSE, blockRow, blockCol-blockIndexTemporal.at(0)+blockIndexTemporal.at(k));
-        }
-
-        // temporal blocks
-        // ---------------
-        if((blockIndexTemporal.at(0) <= blockRow) && (blockRow < blockIndexTemporal.at(0)+blockCountTemporal) &&
-           (blockIndexTemporal.at(0) <= blockCol) && (blockCol < blockIndexTemporal.at(0)+blockCountTemporal))
-        {
-          for(UInt k=0; k<blockIndexTemporal.size(); k++)
-            for(UInt l=k; l<blockIndexTemporal.size(); l++)
-            {
-              std::vector<Double> factor(factorTemporal.at(0).size());
-              std::transform(factorTemporal.at(k).begin(), factorTemporal.at(k).end(), factorTemporal.at(l).begin(), factor.begin(), std::multiplies<Double>());
-              reduceTemporal(factor, FALSE,
-                             blockRow-blockIndexTemporal.at(0)+blockIndexTemporal.at(k),
-                             blockCol-blockIndexTemporal.at(0)+blockIndexTemporal.at(l));
-            }
-        }
-
-        // right side blocks
-        // -----------------
-        if((blockIndexTemporal.at(0) <= blockRow) && (blockRow < blockIndexTemporal.at(0)+blockCountTemporal) &&
-           (blockIndexTemporal.at(0)+blockCountTemporal <= blockCol))
-        {
-          reduceTemporal(factorTemporal.at(0), FALSE, blockRow, blockCol);
-          for(UInt k=1; k<blockIndexTemporal.size(); k++)
-            reduceTemporal(factorTemporal.at(k), TRUE, blockCol, blockRow-blockIndexTemporal.at(0)+blockIndexTemporal.at(k));
-        }
-
-        // free memory
-        for(UInt idInterval=0; idInterval<normalsTemporal.size(); idInterval++)
-          if(normalsTemporal.at(idInterval).isBlockUsed(blockRow, blockCol))
-            normalsTemporal.at(idInterval).N(blockRow, blockCol) = Matrix();
-      }
-
-    // fill symmetric
-    // --------------
-    for(UInt k=0; k<blockIndexTemporal.size(); k++)
-      for(UInt l=k+1; l<blockIndexTemporal.size(); l++)
-         for(UInt blockRow=0; blockRow<blockCountTemporal; blockRow++)
-           for(UInt blockCol=blockRow+1; blockCol<blockCountTemporal; blockCol++)
-           {
-             const UInt rowSource = blockIndexTemporal.at(k)+blockRow;
-             const UInt colSource = blockIndexTemporal.at(l)+blockCol;
-             const UInt rowDest   = blockIndexTemporal.at(k)+blockCol;
-             const UInt colDest   = blockIndexTemporal.at(l)+blockRow;
-
-             Matrix N2 = N(rowSource, colSource).trans();
-             setBlock(rowDest, colDest);
-             send(N2, rank(rowSource, colSource), rank(rowDest, colDest));
-             if(isMyRank(rowDest, colDest))
-               N(rowDest, colDest) = N2;
-           }
+    // blocks without any contribution
+    for(UInt i=0; i<blockCount(); i++)
+      for(UInt k=i; k<blockCount(); k++)
+        if(isBlockUsed(i, k) && isMyRank(i, k) && (N(i, k).size() == 0))
+          N(i, k) = (i == k) ? Matrix(blockSize(i), Matrix::SYMMETRIC) : Matrix(blockSize(i), blockSize(k));
   }
   catch(std::exception &e)
   {
@@ -510,7 +442,6 @@ void NormalsShortTimeStaticLongTime::reduceSum(Bool timing)
   }
 }
 
-
 /***********************************************/
 
 void NormalsShortTimeStaticLongTime::addShortTimeNormals(Double sigma2, const std::vector<std::vector<std::vector<Matrix>>> &normalsShortTime)
@@ -42,9 +42,10 @@ public:
   std::vector<UInt>                blockIndexShortTime;
   UInt                             blockCountTemporal;
   std::vector<UInt>                blockIndexTemporal; // static + for each temporal
-  std::vector<MatrixDistributed>   normalsTemporal;
-  std::vector<Matrix>              nTemporal;
-  std::vector<std::vector<Double>> factorTemporal;
+  std::vector<std::vector<Double>> factorTemporal;     // static + for each temporal, for each interval
+
+  /// Blocks of the combined normals (with temporal factor) a block of interval normals contributes to.
+  std::vector<std::pair<UInt, Double>> targetBlocks(UInt idInterval, UInt idBlock, Bool withZeros=FALSE) const;
 
   void init(ObservationPtr observation, const std::vector<Time> &timesInterval,
             UInt defaultBlockSize, Parallel::CommunicatorPtr comm, Bool sortStateBeforeGravityParameter,
@@ -60,6 +61,8 @@ public:
   /** @brief Add observation equations to the normal system.
   * The design matrix @p A must contain only parameters valid in interval @p idInterval
   * (Computed with @a setInterval()).
+  * Static parameters selected for long time variations are expanded with the temporal factors of the interval
+  * and added to the combined normals immediately, no normals are kept per interval.
   * The input matrices @p l, @p A, and @p B might be destroyed. */
   void accumulate(UInt idInterval, Matrix &l, Matrix &A, Matrix &B);
 
@@ -16,6 +16,7 @@
 #include "config/configRegister.h"
 #include "files/fileMatrix.h"
 #include "files/fileInstrument.h"
+#include "covarianceSst.h"
 #include "covariancePod.h"
 
 /***********************************************/
@@ -72,6 +73,80 @@ void CovariancePod::testInput(const OrbitArc &pod, const ObservationSigmaArc &si
 
 /***********************************************/
 
+UInt CovariancePod::lastNonZeroLag(const_MatrixSliceRef covFunction)
+{
+  for(UInt idx=covFunction.rows(); idx-->0;)
+    if(covFunction(idx,1) || covFunction(idx,2) || covFunction(idx,3))
+      return idx;
+  return 0;
+}
+
+/***********************************************/
+
+// max. epoch distance with non-zero covariance (0: epoch block diagonal)
+UInt CovariancePod::bandwidth(const OrbitArc &pod, const_MatrixSliceRef covFunction)
+{
+  if(!covFunction.size() || (pod.size() < 2))
+    return 0;
+  const Double sampling = covFunction(1,0)-covFunction(0,0);
+  const UInt   lastLag  = lastNonZeroLag(covFunction);
+  UInt band = 0;
+  for(UInt z=0; z<pod.size(); z++)
+  {
+    UInt s = z+1;
+    while((s<pod.size()) && (static_cast<UInt>(round((pod.at(s).time-pod.at(z).time).seconds()/sampling)) <= lastLag))
+      s++;
+    band = std::max(band, s-1-z);
+  }
+  return band;
+}
+
+/***********************************************/
+
+// in place cholesky decomposition W^T W of a band matrix given in the upper triangle
+void CovariancePod::choleskyBand(MatrixSliceRef W, UInt bandwidth)
+{
+  try
+  {
+    for(UInt i=0; i<W.rows(); i++)
+    {
+      Double d = W(i,i);
+      for(UInt k=((i>bandwidth) ? i-bandwidth : 0); k<i; k++)
+        d -= W(k,i)*W(k,i);
+      if(d <= 0)
+        throw(Exception("matrix is not positive definite (row "+i%"%i)"s));
+      W(i,i) = std::sqrt(d);
+      for(UInt j=i+1; j<std::min(W.columns(), i+bandwidth+1); j++)
+      {
+        Double x = W(i,j);
+        for(UInt k=((j>bandwidth) ? j-bandwidth : 0); k<i; k++)
+          x -= W(k,i)*W(k,j);
+        W(i,j) = x/W(i,i);
+      }
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+// A := W^-T A with W upper triangular band matrix
+void CovariancePod::triangularSolveBand(const_MatrixSliceRef W, UInt bandwidth, MatrixSliceRef A)
+{
+  for(UInt i=0; i<A.rows(); i++)
+  {
+    for(UInt k=((i>bandwidth) ? i-bandwidth : 0); k<i; k++)
+      if(W(k,i))
+        axpy(-W(k,i), A.row(k), A.row(i));
+    A.row(i) *= 1./W(i,i);
+  }
+}
+
+/***********************************************/
+
 Matrix CovariancePod::covariance(UInt arcNo, const OrbitArc &pod)
 {
   try
@@ -115,10 +190,13 @@ Matrix CovariancePod::covariance(UInt arcNo, const OrbitArc &pod)
     // covariance function in orbit system
     // -----------------------------------
     const Double sampling = covFunction(1,0)-covFunction(0,0);
+    const UInt   lastLag  = lastNonZeroLag(covFunction);
     for(UInt z=0; z<pod.size(); z++)
       for(UInt s=z; s<pod.size(); s++)
       {
         UInt idx = static_cast<UInt>(round((pod.at(s).time-pod.at(z).time).seconds()/sampling));
+        if(idx > lastLag)
+          break;
         C(3*z+0, 3*s+0) += sigma2 * covFunction(idx, 1+0);
         C(3*z+1, 3*s+1) += sigma2 * covFunction(idx, 1+1);
         C(3*z+2, 3*s+2) += sigma2 * covFunction(idx, 1+2);
@@ -265,16 +343,81 @@ Matrix CovariancePod::decorrelate(const OrbitArc &pod, Double sigmaArc, const Ob
           copy(D * WA.row(3*i,3), WA.row(3*i,3));
     }
 
+    // covariance function vanishes after a few epochs: band matrix
+    // -------------------------------------------------------------
+    const UInt band = bandwidth(pod, covFunction);
+    if(8*band < pod.size())
+    {
+      Matrix W(3*pod.size(), Matrix::TRIANGULAR, Matrix::UPPER);
+      if(covFunction.size())
+      {
+        const Double sampling = covFunction(1,0)-covFunction(0,0);
+        for(UInt z=0; z<pod.size(); z++)
+          for(UInt s=z; s<std::min(pod.size(), z+band+1); s++)
+          {
+            UInt idx = static_cast<UInt>(round((pod.at(s).time-pod.at(z).time).seconds()/sampling));
+            if(idx >= covFunction.rows())
+              break;
+            for(UInt k=0; k<3; k++)
+              W(3*z+k, 3*s+k) = sigmaArc*sigmaArc * covFunction(idx, 1+k);
+          }
+      }
+
+      for(UInt i=0; i<sigmaEpoch.size(); i++)
+        for(UInt k=0; k<3; k++)
+          W(3*i+k,3*i+k) += pow(sigmaEpoch.at(i).sigma, 2);
+
+      choleskyBand(W, 3*band);
+      for(MatrixSliceRef WA : A)
+        if(WA.size())
+          triangularSolveBand(W, 3*band, WA);
+      return W;
+    }
+
+    // regular sampling and constant epoch sigmas: Toeplitz matrix for each axis
+    // --------------------------------------------------------------------------
+    Bool isToeplitz = covFunction.size() && (pod.size() > 1);
+    for(UInt i=1; isToeplitz && (i<sigmaEpoch.size()); i++)
+      isToeplitz = (sigmaEpoch.at(i).sigma == sigmaEpoch.at(0).sigma);
+    const Double delta = (pod.size() > 1) ? (pod.at(1).time-pod.at(0).time).seconds() : 0.;
+    for(UInt i=2; isToeplitz && (i<pod.size()); i++)
+      isToeplitz = (std::fabs((pod.at(i).time-pod.at(0).time).seconds() - i*delta) < 1e-4*delta);
+    if(isToeplitz)
+    {
+      const Double sampling = covFunction(1,0)-covFunction(0,0);
+      Matrix W(3*pod.size(), Matrix::TRIANGULAR, Matrix::UPPER);
+      for(UInt k=0; k<3; k++)
+      {
+        Vector c(pod.size());
+        for(UInt i=0; i<pod.size(); i++)
+          c(i) = sigmaArc*sigmaArc * covFunction(static_cast<UInt>(round(i*delta/sampling)), 1+k);
+        if(sigmaEpoch.size())
+          c(0) += pow(sigmaEpoch.at(0).sigma, 2);
+        const Matrix Wk = CovarianceSst::choleskyToeplitz(c);
+        for(UInt z=0; z<pod.size(); z++)
+          for(UInt s=z; s<pod.size(); s++)
+            W(3*z+k, 3*s+k) = Wk(z,s);
+      }
+
+      for(MatrixSliceRef WA : A)
+        if(WA.size())
+          triangularSolve(1., W.trans(), WA);
+      return W;
+    }
+
     // covariance function in orbit system
     // -----------------------------------
     Matrix W(3*pod.size(), Matrix::SYMMETRIC, Matrix::UPPER);
     if(covFunction.size())
     {
       const Double sampling = covFunction(1,0)-covFunction(0,0);
+      const UInt   lastLag  = lastNonZeroLag(covFunction);
       for(UInt z=0; z<pod.size(); z++)
         for(UInt s=z; s<pod.size(); s++)
         {
           UInt idx = static_cast<UInt>(round((pod.at(s).time-pod.at(z).time).seconds()/sampling));
+          if(idx > lastLag)
+            break;
           W(3*z+0, 3*s+0) = sigmaArc*sigmaArc * covFunction(idx, 1+0);
           W(3*z+1, 3*s+1) = sigmaArc*sigmaArc * covFunction(idx, 1+1);
           W(3*z+2, 3*s+2) = sigmaArc*sigmaArc * covFunction(idx, 1+2);
@@ -91,6 +91,10 @@ class CovariancePod
   Matrix         covFunction;
 
   static void testInput(const OrbitArc &pod, const ObservationSigmaArc &sigmaEpoch, const Covariance3dArc &covPod, const_MatrixSliceRef covFunction);
+  static UInt lastNonZeroLag(const_MatrixSliceRef covFunction);
+  static UInt bandwidth(const OrbitArc &pod, const_MatrixSliceRef covFunction);
+  static void choleskyBand(MatrixSliceRef W, UInt bandwidth);
+  static void triangularSolveBand(const_MatrixSliceRef W, UInt bandwidth, MatrixSliceRef A);
 
 public:
   /// Constructor
@@ -114,6 +118,7 @@ public:
   /** @brief Decorrelates observation equations.
   * The observations must be given as x,y,z per epoch in CRF [m].
   * The list of observation vector and design matrices are decorrelated.
+  * If the covariance function vanishes after a few epochs the banded structure is exploited (O(n) instead of O(n^3)).
   * @return Cholesky decomposition of the covariance matrix (without orbit rotation and epoch wise covariance matrix). */
   static Matrix decorrelate(const OrbitArc &pod, Double sigmaArc, const ObservationSigmaArc &sigmaEpoch,
                             const Covariance3dArc &covPod, const_MatrixSliceRef covFunction,
@@ -140,6 +140,16 @@ void CovarianceSst::decorrelate(UInt arcNo, const std::vector<Time> &times, cons
       return;
     }
 
+    // special case 3: Toeplitz matrix
+    // --------------------------------
+    Vector c;
+    if(fileNamesCovarianceMatrix.empty() &&
+       toeplitzRow(times.size(), (sigmaArc.size() ? sigmaArc(arcNo) : 1.), fileSigmaEpoch.readArc(arcNo), covFunction, c))
+    {
+      decorrelateToeplitz(c, A);
+      return;
+    }
+
     Matrix W = covariance(arcNo, times);
     cholesky(W);
 
@@ -189,8 +199,17 @@ MatrixSliceRef CovarianceSst::decorrelate(const std::vector<Time> &times, Double
 {
   try
   {
-    covariance(times, sigmaArc, sigmaEpoch, covFunction, W);
-    cholesky(W);
+    Vector c;
+    if(!W.size() && toeplitzRow(times.size(), sigmaArc, sigmaEpoch, covFunction, c))
+    {
+      testInput(times, sigmaEpoch, covFunction, W);
+      W = choleskyToeplitz(c);
+    }
+    else
+    {
+      covariance(times, sigmaArc, sigmaEpoch, covFunction, W);
+      cholesky(W);
+    }
 
     for(MatrixSliceRef WA : A)
       if(WA.size())
@@ -205,3 +224,116 @@ MatrixSliceRef CovarianceSst::decorrelate(const std::vector<Time> &times, Double
 }
 
 /***********************************************/
+
+Bool CovarianceSst::toeplitzRow(UInt count, Double sigmaArc, const ObservationSigmaArc &sigmaEpoch, const_MatrixSliceRef covFunction, Vector &c)
+{
+  // the covariance function is given for the lags of the epoch index -> Toeplitz as long as the epoch sigmas are constant
+  if(!covFunction.size() || (covFunction.rows() < count) || (sigmaEpoch.size() && (sigmaEpoch.size() != count)))
+    return FALSE;
+  for(UInt i=1; i<sigmaEpoch.size(); i++)
+    if(sigmaEpoch.at(i).sigma != sigmaEpoch.at(0).sigma)
+      return FALSE;
+
+  c = std::pow(sigmaArc, 2) * covFunction.slice(0, 1, count, 1);
+  if(sigmaEpoch.size() && count)
+    c(0) += std::pow(sigmaEpoch.at(0).sigma, 2);
+  return TRUE;
+}
+
+/***********************************************/
+
+// generalized Schur algorithm:
+// the generators u and v are transformed by hyperbolic rotations,
+// after step k the elements u(k..n-1) are the k-th row of the Cholesky factor
+static void toeplitzSchurInit(const Vector &c, Vector &u, Vector &v)
+{
+  if(!c.size() || (c(0) <= 0))
+    throw(Exception("Toeplitz matrix is not positive definite"));
+  u = (1./std::sqrt(c(0))) * c;
+  v = u;
+  v(0) = 0.;
+}
+
+static void toeplitzSchurStep(UInt k, Vector &u, Vector &v)
+{
+  const UInt n = u.rows();
+  for(UInt j=n; j-->k;)
+    u(j) = u(j-1);
+  const Double rho = v(k)/u(k);
+  if(!(std::fabs(rho) < 1.))
+    throw(Exception("Toeplitz matrix is not positive definite (row "+k%"%i)"s));
+  const Double s = std::sqrt((1.-rho)*(1.+rho));
+  for(UInt j=k; j<n; j++)
+  {
+    const Double uj = u(j);
+    u(j) = (uj   - rho*v(j))/s;
+    v(j) = (v(j) - rho*uj)/s;
+  }
+}
+
+/***********************************************/
+
+Matrix CovarianceSst::choleskyToeplitz(const Vector &c)
+{
+  try
+  {
+    const UInt n = c.rows();
+    Matrix W(n, Matrix::TRIANGULAR, Matrix::UPPER);
+    Vector u, v;
+    toeplitzSchurInit(c, u, v);
+    for(UInt k=0; k<n; k++)
+    {
+      if(k)
+        toeplitzSchurStep(k, u, v);
+      copy(u.row(k, n-k).trans(), W.slice(k, k, 1, n-k));
+    }
+    return W;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void CovarianceSst::decorrelateToeplitz(const Vector &c, const std::list<MatrixSlice> &A)
+{
+  try
+  {
+    const UInt n         = c.rows();
+    const UInt blockSize = 512;
+    Vector u, v;
+    toeplitzSchurInit(c, u, v);
+
+    // W^T x = a with W = [T B; 0 W2] solved block wise
+    for(UInt start=0; start<n; start+=blockSize)
+    {
+      const UInt count = std::min(blockSize, n-start);
+      Matrix T(count, Matrix::TRIANGULAR, Matrix::UPPER);
+      Matrix B(count, n-start-count);
+      for(UInt k=start; k<start+count; k++)
+      {
+        if(k)
+          toeplitzSchurStep(k, u, v);
+        copy(u.row(k, start+count-k).trans(), T.slice(k-start, k-start, 1, start+count-k));
+        if(B.size())
+          copy(u.row(start+count, n-start-count).trans(), B.row(k-start));
+      }
+
+      for(MatrixSliceRef WA : A)
+        if(WA.size())
+        {
+          triangularSolve(1., T.trans(), WA.row(start, count));
+          if(B.size())
+            matMult(-1., B.trans(), WA.row(start, count), WA.row(start+count, n-start-count));
+        }
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
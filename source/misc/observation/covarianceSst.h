@@ -74,6 +74,7 @@ class CovarianceSst
   Vector                covMatrixSigmas;
 
   static void testInput(const std::vector<Time> &times, const ObservationSigmaArc &sigmaEpoch, const_MatrixSliceRef covFunction, const_MatrixSliceRef W);
+  static Bool toeplitzRow(UInt count, Double sigmaArc, const ObservationSigmaArc &sigmaEpoch, const_MatrixSliceRef covFunction, Vector &c);
 
 public:
   /// Constructor
@@ -119,6 +120,19 @@ public:
   static MatrixSliceRef decorrelate(const std::vector<Time> &times, Double sigmaArc, const ObservationSigmaArc &sigmaEpoch,
                                     const_MatrixSliceRef covFunction, Matrix &W, const std::list<MatrixSlice> &A);
 
+  /** @brief Cholesky decomposition of a symmetric Toeplitz matrix.
+  * Generalized Schur algorithm with O(n^2) operations.
+  * @param c first row of the positive definite Toeplitz matrix
+  * @return upper triangular matrix W (@f$ C = W^TW @f$) */
+  static Matrix choleskyToeplitz(const Vector &c);
+
+  /** @brief Decorrelates observation equations with a Toeplitz covariance matrix.
+  * The Cholesky factor is computed block wise with the generalized Schur algorithm and is never stored completely.
+  * The memory is linear in the number of observations.
+  * @param c first row of the positive definite Toeplitz covariance matrix
+  * @param[in,out] A Matrices to be decorrelated */
+  static void decorrelateToeplitz(const Vector &c, const std::list<MatrixSlice> &A);
+
   /** @brief creates an derived instance of this class. */
   static CovarianceSstPtr create(Config &config, const std::string &name) {return std::make_shared<CovarianceSst>(config, name);}
 };
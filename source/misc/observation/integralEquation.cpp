@@ -10,6 +10,7 @@
 */
 /***********************************************/
 
+#include <mutex>
 #include "base/import.h"
 #include "files/fileInstrument.h"
 #include "classes/earthRotation/earthRotation.h"
@@ -97,10 +98,9 @@ IntegralEquation::Arc  IntegralEquation::integrateArc(const OrbitArc &orbit, con
     // Integral mit dem Kern K(tau, tau')
     // und Drehung in das erdfeste System
     // ----------------------------------
-    if(IntegrationPos.rows()!=3*posCount)
-      IntegrationPos = integrationMatrixPosition(T, posCount);
+    const auto IntegrationPos = integrationMatrix(FALSE, T, posCount);
     for(UInt i=0; i<posCount; i++)
-      matMult(1., IntegrationPos.slice(3, 3*i, 3*posCount-3, 3), rotEarth.at(i).matrix().trans(), VPos.slice(3, 3*i, 3*posCount-3, 3));
+      matMult(1., IntegrationPos->slice(3, 3*i, 3*posCount-3, 3), rotEarth.at(i).matrix().trans(), VPos.slice(3, 3*i, 3*posCount-3, 3));
 
     // Referenzpositionen und Randwerte
     // --------------------------------
@@ -148,7 +148,7 @@ IntegralEquation::Arc  IntegralEquation::integrateArc(const OrbitArc &orbit, con
       Inv(i,i) = 1.0;
     // I +- K*Tensor
     for(UInt i=0; i<posCount; i++)
-      matMult(-1., IntegrationPos.slice(3,3*i,3*posCount-3,3), tensor.at(i), Inv.slice(3,3*i,3*posCount-3,3));
+      matMult(-1., IntegrationPos->slice(3,3*i,3*posCount-3,3), tensor.at(i), Inv.slice(3,3*i,3*posCount-3,3));
 
     // (I-K*tensor)^-1(Gravity*g+vBound-vPos)+pos
     // wobei A = (Gravity, Boundary, Reference)
@@ -206,9 +206,8 @@ IntegralEquation::Arc  IntegralEquation::integrateArc(const OrbitArc &orbit, con
     if(computeVelocity)
     {
       // Integral mit dem Kern (d/dt K(tau, tau'))
-      if(IntegrationVel.rows()!=3*posCount)
-        IntegrationVel = integrationMatrixVelocity(T, posCount);
-      arc.VVel = IntegrationVel * arc.VAcc;
+      const auto IntegrationVel = integrationMatrix(TRUE, T, posCount);
+      arc.VVel = (*IntegrationVel) * arc.VAcc;
 
       // Randwerte
       // ---------
@@ -220,11 +219,11 @@ IntegralEquation::Arc  IntegralEquation::integrateArc(const OrbitArc &orbit, con
       }
 
       // indirekter Effekt
-      matMult(1., IntegrationVel, arc.VAccBoundary, arc.VVelBoundary);
+      matMult(1., *IntegrationVel, arc.VAccBoundary, arc.VVelBoundary);
 
       // Referenzgeschwindigkeiten
       // -------------------------
-      arc.vVel = IntegrationVel * arc.vAcc;
+      arc.vVel = (*IntegrationVel) * arc.vAcc;
 
         // Randwerte - pos
       for(UInt i=0; i<posCount; i++)
@@ -299,6 +298,33 @@ void IntegralEquation::interpolateArc(const std::vector<OrbitArc> &pod, const Or
 /***********************************************/
 /***********************************************/
 
+std::shared_ptr<const Matrix> IntegralEquation::integrationMatrix(Bool velocity, Double T, UInt posCount) const
+{
+  try
+  {
+    // the matrices depend only on the arc configuration -> shared by all arcs and instances
+    static std::mutex mutex;
+    static std::map<std::tuple<Bool, UInt, Double, UInt>, std::shared_ptr<const Matrix>> matrices;
+
+    const auto key = std::make_tuple(velocity, W.size(), T, posCount);
+    std::lock_guard<std::mutex> lock(mutex);
+    auto iter = matrices.find(key);
+    if(iter != matrices.end())
+      return iter->second;
+    if(matrices.size() >= 16) // do not accumulate matrices of arbitrary arcs
+      matrices.clear();
+    auto matrix = std::make_shared<const Matrix>(velocity ? integrationMatrixVelocity(T, posCount) : integrationMatrixPosition(T, posCount));
+    matrices[key] = matrix;
+    return matrix;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 Matrix IntegralEquation::integrationMatrixPosition(Double T, UInt posCount) const
 {
   try
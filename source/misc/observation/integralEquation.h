@@ -26,8 +26,9 @@ class IntegralEquation
 {
   UInt                integrationDegree, interpolationDegree;
   std::vector<Matrix> W;
-  mutable Matrix      IntegrationPos;
-  mutable Matrix      IntegrationVel;
+
+  // cached integration matrices for arcs with length T and posCount positions
+  std::shared_ptr<const Matrix> integrationMatrix(Bool velocity, Double T, UInt posCount) const;
 
 public:
 
@@ -292,8 +292,9 @@ ObservationMiscDualSstVariational::Arc ObservationMiscDualSstVariational::comput
     // =============================================
 
     const std::vector<Time> timesSst = sst1.at(0).times();
-    VariationalEquationFromFile::ObservationEquation eqn1 = variationalEquation1.integrateArc(timesSst.at(0), timesSst.back(), TRUE/*position*/, computeVelocity, rotSat1);
-    VariationalEquationFromFile::ObservationEquation eqn2 = variationalEquation2.integrateArc(timesSst.at(0), timesSst.back(), TRUE/*position*/, computeVelocity, rotSat2);
+    VariationalEquationFromFile::ObservationEquation eqn1, eqn2;
+    VariationalEquationFromFile::integrateArc(variationalEquation1, variationalEquation2, timesSst.at(0), timesSst.back(), TRUE/*position*/, computeVelocity,
+                                              rotSat1, rotSat2, eqn1, eqn2);
     Polynomial polynomial(eqn1.times, interpolationDegree);
 
     // =============================================
@@ -336,6 +337,9 @@ ObservationMiscDualSstVariational::Arc ObservationMiscDualSstVariational::comput
 
     if(countSst)
     {
+      // same interpolation for all quantities
+      const Polynomial::Plan interpolationSst = polynomial.plan(timesSst);
+
       // inter satellite vectors
       // -----------------------
       std::vector<Vector3d> pos12(countSst);
@@ -343,7 +347,7 @@ ObservationMiscDualSstVariational::Arc ObservationMiscDualSstVariational::comput
       std::vector<Vector3d> e12  (countSst);
       Vector sst0(countSst);
 
-      Vector dpos0 = polynomial.interpolate(timesSst, eqn2.pos0-eqn1.pos0, 3);
+      Vector dpos0 = interpolationSst.apply(eqn2.pos0-eqn1.pos0, 3);
       for(UInt i=0; i<countSst; i++)
       {
         pos12.at(i) = Vector3d(dpos0(3*i+0), dpos0(3*i+1), dpos0(3*i+2));
@@ -352,7 +356,7 @@ ObservationMiscDualSstVariational::Arc ObservationMiscDualSstVariational::comput
 
       if(computeVelocity)
       {
-        Vector dvel0 = polynomial.interpolate(timesSst, eqn2.vel0-eqn1.vel0, 3);
+        Vector dvel0 = interpolationSst.apply(eqn2.vel0-eqn1.vel0, 3);
         for(UInt i=0; i<countSst; i++)
           vel12.at(i) = Vector3d(dvel0(3*i+0), dvel0(3*i+1), dvel0(3*i+2));
       }
@@ -362,9 +366,9 @@ ObservationMiscDualSstVariational::Arc ObservationMiscDualSstVariational::comput
       {
         Matrix PosGravity;
         if(gravityCount) axpy(-1, eqn1.PosDesign.column(0, gravityCount), eqn2.PosDesign.column(0, gravityCount)); // gravity field difference
-        if(gravityCount) PosGravity = polynomial.interpolate(timesSst, eqn2.PosDesign.column(0, gravityCount));
-        Matrix PosState1  = polynomial.interpolate(timesSst, eqn1.PosDesign.column(gravityCount,state1Count), 3);
-        Matrix PosState2  = polynomial.interpolate(timesSst, eqn2.PosDesign.column(gravityCount,state2Count), 3);
+        if(gravityCount) PosGravity = interpolationSst.apply(eqn2.PosDesign.column(0, gravityCount), 3);
+        Matrix PosState1  = interpolationSst.apply(eqn1.PosDesign.column(gravityCount,state1Count), 3);
+        Matrix PosState2  = interpolationSst.apply(eqn2.PosDesign.column(gravityCount,state2Count), 3);
 
         Double rho0  = pos12.at(0).r();
         for(UInt i=0; i<countSst; i++)
@@ -395,12 +399,12 @@ ObservationMiscDualSstVariational::Arc ObservationMiscDualSstVariational::comput
         Matrix PosGravity, VelGravity;
         if(gravityCount) axpy(-1, eqn1.PosDesign.column(0, gravityCount), eqn2.PosDesign.column(0, gravityCount)); // gravity field difference
         if(gravityCount) axpy(-1, eqn1.VelDesign.column(0, gravityCount), eqn2.VelDesign.column(0, gravityCount)); // gravity field difference
-        if(gravityCount) PosGravity = polynomial.interpolate(timesSst, eqn2.PosDesign.column(0, gravityCount), 3);
-        if(gravityCount) VelGravity = polynomial.interpolate(timesSst, eqn2.VelDesign.column(0, gravityCount), 3);
-        Matrix PosState1  = polynomial.interpolate(timesSst, eqn1.PosDesign.column(gravityCount,state1Count), 3);
-        Matrix PosState2  = polynomial.interpolate(timesSst, eqn2.PosDesign.column(gravityCount,state2Count), 3);
-        Matrix VelState1  = polynomial.interpolate(timesSst, eqn1.VelDesign.column(gravityCount,state1Count), 3);
-        Matrix VelState2  = polynomial.interpolate(timesSst, eqn2.VelDesign.column(gravityCount,state2Count), 3);
+        if(gravityCount) PosGravity = interpolationSst.apply(eqn2.PosDesign.column(0, gravityCount), 3);
+        if(gravityCount) VelGravity = interpolationSst.apply(eqn2.VelDesign.column(0, gravityCount), 3);
+        Matrix PosState1  = interpolationSst.apply(eqn1.PosDesign.column(gravityCount,state1Count), 3);
+        Matrix PosState2  = interpolationSst.apply(eqn2.PosDesign.column(gravityCount,state2Count), 3);
+        Matrix VelState1  = interpolationSst.apply(eqn1.VelDesign.column(gravityCount,state1Count), 3);
+        Matrix VelState2  = interpolationSst.apply(eqn2.VelDesign.column(gravityCount,state2Count), 3);
 
         for(UInt i=0; i<countSst; i++)
         {
@@ -161,8 +161,8 @@ ObservationMiscPod::Arc ObservationMiscPodIntegral::computeArc(UInt arcNo, Covar
 {
   try
   {
-    OrbitArc      orbit      = orbitFile.readArc(arcNo);
-    StarCameraArc starCamera = starCameraFile.readArc(arcNo);
+    OrbitArc      orbit      = orbitFile.readArcShared(arcNo);
+    StarCameraArc starCamera = starCameraFile.readArcShared(arcNo);
     const UInt    rhsCount   = rhs.size();
     const UInt    epochCount = orbit.size();
 
@@ -196,9 +196,7 @@ ObservationMiscPod::Arc ObservationMiscPodIntegral::computeArc(UInt arcNo, Covar
 
     // calculate earthrotation
     // -----------------------
-    std::vector<Rotary3d> rotEarth(epochCount);
-    for(UInt k=0; k<epochCount; k++)
-      rotEarth.at(k) = earthRotation->rotaryMatrix(orbit.at(k).time);
+    std::vector<Rotary3d> rotEarth = earthRotation->rotaryMatrix(orbit.times());
 
     // reference acceleration
     // ----------------------
@@ -228,10 +228,10 @@ ObservationMiscSst::Arc ObservationMiscSstIntegral::computeArc(UInt arcNo, Covar
 {
   try
   {
-    OrbitArc      orbit1      = orbit1File.readArc(arcNo);
-    OrbitArc      orbit2      = orbit2File.readArc(arcNo);
-    StarCameraArc starCamera1 = starCamera1File.readArc(arcNo);
-    StarCameraArc starCamera2 = starCamera2File.readArc(arcNo);
+    OrbitArc      orbit1      = orbit1File.readArcShared(arcNo);
+    OrbitArc      orbit2      = orbit2File.readArcShared(arcNo);
+    StarCameraArc starCamera1 = starCamera1File.readArcShared(arcNo);
+    StarCameraArc starCamera2 = starCamera2File.readArcShared(arcNo);
     ::Arc::checkSynchronized({orbit1, orbit2, starCamera1, starCamera2});
     const UInt    rhsCount    = rhs.size();
     const UInt    epochCount  = orbit1.size();
@@ -316,49 +316,38 @@ ObservationMiscSst::Arc ObservationMiscSstIntegral::computeArc(UInt arcNo, Covar
     // calculate earthrotation
     // -----------------------
     std::vector<Time> times = sst.at(0).at(0).times();
-    std::vector<Rotary3d> rotEarth(epochCount);
-    for(UInt k=0; k<epochCount; k++)
-      rotEarth.at(k) = earthRotation->rotaryMatrix(times.at(k));
+    std::vector<Rotary3d> rotEarth = earthRotation->rotaryMatrix(times);
 
     // =============================================
 
     // reference acceleration
     // ----------------------
-    // satellite 1
+    // both satellites at the same epochs
     Matrix g1(3*epochCount, rhsCount);
-    for(UInt j=0; j<rhsCount; j++)
-    {
-      AccelerometerArc accelerometer = rhs.at(j)->accelerometer1File->readArc(arcNo);
-      for(UInt k=0; k<epochCount; k++)
-      {
-        Vector3d gv = rhs.at(j)->forces->acceleration(satellite1, orbit1.at(k).time, orbit1.at(k).position, orbit1.at(k).velocity,
-                                                     starCamera1.at(k).rotary, rotEarth.at(k), earthRotation, ephemerides);
-        // accelerometer [-> TRF]
-        if(accelerometer.size())
-          gv += rotEarth.at(k).rotate(starCamera1.at(k).rotary.rotate(accelerometer.at(k).acceleration));
-        // sort into vector
-        g1(3*k+0, j) = gv.x();
-        g1(3*k+1, j) = gv.y();
-        g1(3*k+2, j) = gv.z();
-      }
-    }
-
-    // satellite 2
     Matrix g2(3*epochCount, rhsCount);
     for(UInt j=0; j<rhsCount; j++)
     {
-      AccelerometerArc accelerometer = rhs.at(j)->accelerometer2File->readArc(arcNo);
+      AccelerometerArc accelerometer1 = rhs.at(j)->accelerometer1File->readArc(arcNo);
+      AccelerometerArc accelerometer2 = rhs.at(j)->accelerometer2File->readArc(arcNo);
       for(UInt k=0; k<epochCount; k++)
       {
-        Vector3d gv = rhs.at(j)->forces->acceleration(satellite2, orbit2.at(k).time, orbit2.at(k).position, orbit2.at(k).velocity,
-                                                     starCamera2.at(k).rotary, rotEarth.at(k), earthRotation, ephemerides);
+        std::vector<Vector3d> gv = rhs.at(j)->forces->acceleration({satellite1, satellite2}, orbit1.at(k).time,
+                                                                   {orbit1.at(k).position, orbit2.at(k).position},
+                                                                   {orbit1.at(k).velocity, orbit2.at(k).velocity},
+                                                                   {starCamera1.at(k).rotary, starCamera2.at(k).rotary},
+                                                                   rotEarth.at(k), earthRotation, ephemerides);
         // accelerometer [-> TRF]
-        if(accelerometer.size())
-          gv += rotEarth.at(k).rotate(starCamera2.at(k).rotary.rotate(accelerometer.at(k).acceleration));
+        if(accelerometer1.size())
+          gv.at(0) += rotEarth.at(k).rotate(starCamera1.at(k).rotary.rotate(accelerometer1.at(k).acceleration));
+        if(accelerometer2.size())
+          gv.at(1) += rotEarth.at(k).rotate(starCamera2.at(k).rotary.rotate(accelerometer2.at(k).acceleration));
         // sort into vector
-        g2(3*k+0, j) = gv.x();
-        g2(3*k+1, j) = gv.y();
-        g2(3*k+2, j) = gv.z();
+        g1(3*k+0, j) = gv.at(0).x();
+        g1(3*k+1, j) = gv.at(0).y();
+        g1(3*k+2, j) = gv.at(0).z();
+        g2(3*k+0, j) = gv.at(1).x();
+        g2(3*k+1, j) = gv.at(1).y();
+        g2(3*k+2, j) = gv.at(1).z();
       }
     }
 
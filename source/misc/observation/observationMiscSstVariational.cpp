@@ -230,8 +230,9 @@ ObservationMiscSstVariational::Arc ObservationMiscSstVariational::computeArc(UIn
     // =============================================
 
     std::vector<Time> timesSst = sst.at(0).times();
-    VariationalEquationFromFile::ObservationEquation eqn1 = variationalEquation1.integrateArc(timesSst.at(0), timesSst.back(), TRUE/*position*/, computeVelocity, rotSat1);
-    VariationalEquationFromFile::ObservationEquation eqn2 = variationalEquation2.integrateArc(timesSst.at(0), timesSst.back(), TRUE/*position*/, computeVelocity, rotSat2);
+    VariationalEquationFromFile::ObservationEquation eqn1, eqn2;
+    VariationalEquationFromFile::integrateArc(variationalEquation1, variationalEquation2, timesSst.at(0), timesSst.back(), TRUE/*position*/, computeVelocity,
+                                              rotSat1, rotSat2, eqn1, eqn2);
     Polynomial polynomial(eqn1.times, interpolationDegree);
 
     // =============================================
@@ -274,6 +275,9 @@ ObservationMiscSstVariational::Arc ObservationMiscSstVariational::computeArc(UIn
 
     if(countSst)
     {
+      // same interpolation for all quantities
+      const Polynomial::Plan interpolationSst = polynomial.plan(timesSst);
+
       // inter satellite vectors
       // -----------------------
       std::vector<Vector3d> pos12(epochCount);
@@ -281,7 +285,7 @@ ObservationMiscSstVariational::Arc ObservationMiscSstVariational::computeArc(UIn
       std::vector<Vector3d> e12  (epochCount);
       Vector sst0(epochCount);
 
-      Vector dpos0 = polynomial.interpolate(timesSst, eqn2.pos0-eqn1.pos0, 3);
+      Vector dpos0 = interpolationSst.apply(eqn2.pos0-eqn1.pos0, 3);
       for(UInt i=0; i<epochCount; i++)
       {
         pos12.at(i) = Vector3d(dpos0(3*i+0), dpos0(3*i+1), dpos0(3*i+2));
@@ -290,7 +294,7 @@ ObservationMiscSstVariational::Arc ObservationMiscSstVariational::computeArc(UIn
 
       if(computeVelocity)
       {
-        Vector dvel0 = polynomial.interpolate(timesSst, eqn2.vel0-eqn1.vel0, 3);
+        Vector dvel0 = interpolationSst.apply(eqn2.vel0-eqn1.vel0, 3);
         for(UInt i=0; i<epochCount; i++)
           vel12.at(i) = Vector3d(dvel0(3*i+0), dvel0(3*i+1), dvel0(3*i+2));
       }
@@ -300,9 +304,9 @@ ObservationMiscSstVariational::Arc ObservationMiscSstVariational::computeArc(UIn
       {
         Matrix PosGravity;
         if(gravityCount) axpy(-1, eqn1.PosDesign.column(0, gravityCount), eqn2.PosDesign.column(0, gravityCount)); // gravity field difference
-        if(gravityCount) PosGravity = polynomial.interpolate(timesSst, eqn2.PosDesign.column(0, gravityCount));
-        Matrix PosState1  = polynomial.interpolate(timesSst, eqn1.PosDesign.column(gravityCount,state1Count), 3);
-        Matrix PosState2  = polynomial.interpolate(timesSst, eqn2.PosDesign.column(gravityCount,state2Count), 3);
+        if(gravityCount) PosGravity = interpolationSst.apply(eqn2.PosDesign.column(0, gravityCount), 3);
+        Matrix PosState1  = interpolationSst.apply(eqn1.PosDesign.column(gravityCount,state1Count), 3);
+        Matrix PosState2  = interpolationSst.apply(eqn2.PosDesign.column(gravityCount,state2Count), 3);
 
         Double rho0  = pos12.at(0).r();
         for(UInt i=0; i<epochCount; i++)
@@ -329,12 +333,12 @@ ObservationMiscSstVariational::Arc ObservationMiscSstVariational::computeArc(UIn
         Matrix PosGravity, VelGravity;
         if(gravityCount) axpy(-1, eqn1.PosDesign.column(0, gravityCount), eqn2.PosDesign.column(0, gravityCount)); // gravity field difference
         if(gravityCount) axpy(-1, eqn1.VelDesign.column(0, gravityCount), eqn2.VelDesign.column(0, gravityCount)); // gravity field difference
-        if(gravityCount) PosGravity = polynomial.interpolate(timesSst, eqn2.PosDesign.column(0, gravityCount), 3);
-        if(gravityCount) VelGravity = polynomial.interpolate(timesSst, eqn2.VelDesign.column(0, gravityCount), 3);
-        Matrix PosState1  = polynomial.interpolate(timesSst, eqn1.PosDesign.column(gravityCount,state1Count), 3);
-        Matrix PosState2  = polynomial.interpolate(timesSst, eqn2.PosDesign.column(gravityCount,state2Count), 3);
-        Matrix VelState1  = polynomial.interpolate(timesSst, eqn1.VelDesign.column(gravityCount,state1Count), 3);
-        Matrix VelState2  = polynomial.interpolate(timesSst, eqn2.VelDesign.column(gravityCount,state2Count), 3);
+        if(gravityCount) PosGravity = interpolationSst.apply(eqn2.PosDesign.column(0, gravityCount), 3);
+        if(gravityCount) VelGravity = interpolationSst.apply(eqn2.VelDesign.column(0, gravityCount), 3);
+        Matrix PosState1  = interpolationSst.apply(eqn1.PosDesign.column(gravityCount,state1Count), 3);
+        Matrix PosState2  = interpolationSst.apply(eqn2.PosDesign.column(gravityCount,state2Count), 3);
+        Matrix VelState1  = interpolationSst.apply(eqn1.VelDesign.column(gravityCount,state1Count), 3);
+        Matrix VelState2  = interpolationSst.apply(eqn2.VelDesign.column(gravityCount,state2Count), 3);
 
         for(UInt i=0; i<epochCount; i++)
         {
@@ -19,7 +19,11 @@
 
 /***********************************************/
 
-VariationalEquation::VariationalEquation() : parameterCount_(0), gravityCount(0), satCount(0), satArcCount(0)
+constexpr UInt VariationalEquation::blockSizeGravity;
+
+/***********************************************/
+
+VariationalEquation::VariationalEquation() : parameterCount_(0), gravityCount(0), satCount(0), satArcCount(0), idEpochGravity(NULLINDEX)
 {
 }
 
@@ -93,7 +97,8 @@ void VariationalEquation::computeIndices()
     satArcCount      = (parameterAcceleration) ? parameterAcceleration->parameterCountArc() + 6 : 6; // inclusive state vector
     parameterCount_ += satArcCount;
 
-    idEpochAlpha = NULLINDEX; // current arc is invalid
+    idEpochAlpha   = NULLINDEX; // current arc is invalid
+    idEpochGravity = NULLINDEX;
   }
   catch(std::exception &e)
   {
@@ -110,6 +115,7 @@ void VariationalEquation::setArc(VariationalEquationArc &arc)
     this->arc = arc;
     if(arc.times.size() == 0)
       throw(Exception("empty arc"));
+    idEpochGravity = NULLINDEX;
 
     if(parameterAcceleration)
     {
@@ -350,6 +356,47 @@ void VariationalEquation::computeAlpha(UInt idEpoch)
 
 /***********************************************/
 
+void VariationalEquation::computeGravity(UInt idEpoch)
+{
+  try
+  {
+    const UInt count = std::min(blockSizeGravity, arc.times.size()-idEpoch);
+
+    // satellites with the same epochs
+    std::vector<VariationalEquation*> group = {this};
+    for(VariationalEquation *eqn : gravityGroup)
+      if((eqn != this) && (eqn->parameterGravity == parameterGravity) && (eqn->gravityCount == gravityCount) &&
+         (eqn->arc.times.size() >= idEpoch+count) && (eqn->arc.times.at(idEpoch) == arc.times.at(idEpoch)) &&
+         (eqn->arc.times.at(idEpoch+count-1) == arc.times.at(idEpoch+count-1)))
+        group.push_back(eqn);
+
+    std::vector<Time>     times;
+    std::vector<Vector3d> points;
+    times.reserve(group.size()*count);
+    points.reserve(group.size()*count);
+    for(VariationalEquation *eqn : group)
+      for(UInt i=idEpoch; i<idEpoch+count; i++)
+      {
+        times.push_back(eqn->arc.times.at(i));
+        points.push_back(eqn->arc.rotEarth.at(i).rotate(Vector3d(eqn->arc.pos0(3*i+0,0), eqn->arc.pos0(3*i+1,0), eqn->arc.pos0(3*i+2,0))));
+      }
+
+    Matrix G(3*points.size(), gravityCount);
+    parameterGravity->gravity(times, points, G);
+    for(UInt k=0; k<group.size(); k++)
+    {
+      group.at(k)->Gravity        = G.row(3*k*count, 3*count);
+      group.at(k)->idEpochGravity = idEpoch;
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 Matrix VariationalEquation::computeIntegrand(UInt idEpoch)
 {
   try
@@ -366,16 +413,21 @@ Matrix VariationalEquation::computeIntegrand(UInt idEpoch)
 
     Matrix F(6, Alpha.columns());
     if(gravityCount)
-      parameterGravity->gravity(arc.times.at(idEpoch), arc.rotEarth.at(idEpoch).rotate(pos), F.slice(3, idxGravity, 3, gravityCount));
+    {
+      if((idEpochGravity == NULLINDEX) || (idEpoch < idEpochGravity) || (3*(idEpoch-idEpochGravity) >= Gravity.rows()))
+        computeGravity(idEpoch);
+      copy(Gravity.row(3*(idEpoch-idEpochGravity), 3), F.slice(3, idxGravity, 3, gravityCount));
+    }
     if(satCount || satArcCount)
     {
       parameterAcceleration->compute(satellite, arc.times.at(idEpoch), pos, vel, arc.rotSat.at(idEpoch), arc.rotEarth.at(idEpoch), ephemerides,
                                      F.slice(3, idxSat, 3, satCount), F.slice(3, idxSatArc, 3, satArcCount-6));
     }
 
+    const Matrix rotEarth = arc.rotEarth.at(idEpoch).matrix();
     Matrix Z(6,6);
-    matMult(1., arc.rotEarth.at(idEpoch).matrix(), arc.PosState.row(3*idEpoch,3), Z.row(0,3));
-    matMult(1., arc.rotEarth.at(idEpoch).matrix(), arc.VelState.row(3*idEpoch,3), Z.row(3,3));
+    matMult(1., rotEarth, arc.PosState.row(3*idEpoch,3), Z.row(0,3));
+    matMult(1., rotEarth, arc.VelState.row(3*idEpoch,3), Z.row(3,3));
     solveInPlace(Z, F);
 
     return F;
@@ -89,6 +89,13 @@ public:
   * @param[out] VelDesign (3 x parameterCount()) design matrix. */
   void velocity(UInt idEpoch, MatrixSliceRef vel0, MatrixSliceRef VelDesign);
 
+  /** @brief Compute the gravity field designs together with other satellites.
+  * The gravity field designs of the integrands are computed in blocks of epochs in one batched call
+  * for all variational equations of the @a group with the same epochs and the same gravity parametrization
+  * (e.g. both GRACE satellites). The integration of all satellites should progress epoch by epoch together.
+  * An empty @a group computes the designs of this satellite only. */
+  void setGravityGroup(const std::vector<VariationalEquation*> &group) {gravityGroup = group;}
+
 private:
   SatelliteModelPtr              satellite;
   VariationalEquationArc         arc;
@@ -115,6 +122,13 @@ private:
   UInt                idIntegrand;
   std::vector<Matrix> Integrand;
 
+  // gravity field designs (terrestrial frame) of the integrands in blocks of epochs
+  static constexpr UInt blockSizeGravity = 32;
+  std::vector<VariationalEquation*> gravityGroup;
+  UInt                idEpochGravity;
+  Matrix              Gravity;
+
+  void   computeGravity(UInt idEpoch);
   void   initIntegration();
   void   computeAlpha(UInt idEpoch);
   Matrix computeIntegrand(UInt idEpoch);
@@ -155,6 +155,58 @@ void VariationalEquationFromFile::parameterNameSatelliteArc(std::vector<Paramete
 /***********************************************/
 
 VariationalEquationFromFile::ObservationEquation VariationalEquationFromFile::integrateArc(Time timeStart, Time timeEnd, Bool computePosition, Bool computeVelocity, std::vector<Rotary3d> rotSat)
+{
+  try
+  {
+    ObservationEquation eqn;
+    const UInt epochStart = initEquation(timeStart, timeEnd, computePosition, computeVelocity, rotSat, eqn);
+    for(UInt i=0; i<eqn.times.size(); i++)
+      computeEpoch(epochStart, i, computePosition, computeVelocity, eqn);
+    return eqn;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void VariationalEquationFromFile::integrateArc(VariationalEquationFromFile &variationalEquation1, VariationalEquationFromFile &variationalEquation2,
+                                               Time timeStart, Time timeEnd, Bool computePosition, Bool computeVelocity,
+                                               const std::vector<Rotary3d> &rotSat1, const std::vector<Rotary3d> &rotSat2,
+                                               ObservationEquation &eqn1, ObservationEquation &eqn2)
+{
+  try
+  {
+    const UInt epochStart1 = variationalEquation1.initEquation(timeStart, timeEnd, computePosition, computeVelocity, rotSat1, eqn1);
+    const UInt epochStart2 = variationalEquation2.initEquation(timeStart, timeEnd, computePosition, computeVelocity, rotSat2, eqn2);
+
+    const std::vector<VariationalEquation*> group = {&variationalEquation1.variationalEquation, &variationalEquation2.variationalEquation};
+    variationalEquation1.variationalEquation.setGravityGroup(group);
+    variationalEquation2.variationalEquation.setGravityGroup(group);
+    for(UInt i=0; i<std::max(eqn1.times.size(), eqn2.times.size()); i++)
+    {
+      if(i < eqn1.times.size())
+        variationalEquation1.computeEpoch(epochStart1, i, computePosition, computeVelocity, eqn1);
+      if(i < eqn2.times.size())
+        variationalEquation2.computeEpoch(epochStart2, i, computePosition, computeVelocity, eqn2);
+    }
+    variationalEquation1.variationalEquation.setGravityGroup({});
+    variationalEquation2.variationalEquation.setGravityGroup({});
+  }
+  catch(std::exception &e)
+  {
+    variationalEquation1.variationalEquation.setGravityGroup({});
+    variationalEquation2.variationalEquation.setGravityGroup({});
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+UInt VariationalEquationFromFile::initEquation(Time timeStart, Time timeEnd, Bool computePosition, Bool computeVelocity,
+                                               const std::vector<Rotary3d> &rotSat, ObservationEquation &eqn)
 {
   try
   {
@@ -176,7 +228,7 @@ VariationalEquationFromFile::ObservationEquation VariationalEquationFromFile::in
     if(rotSat.size())
       replaceStarCamera(epochStart, epochEnd, rotSat);
 
-    ObservationEquation eqn;
+    eqn = ObservationEquation();
     for(UInt idEpoch=epochStart; idEpoch<=epochEnd; idEpoch++)
       eqn.times.push_back(arc.times.at(idEpoch));
 
@@ -193,35 +245,44 @@ VariationalEquationFromFile::ObservationEquation VariationalEquationFromFile::in
     eqn.rotSat.resize(eqn.times.size());
     eqn.rotEarth.resize(eqn.times.size());
 
-    for(UInt i=0; i<eqn.times.size(); i++)
-    {
-      const UInt idEpoch = epochStart+i;
+    return epochStart;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
 
-      if(computePosition)
-      {
-        Matrix PosDesign(3, variationalEquation.parameterCount());
-        variationalEquation.position(idEpoch, eqn.pos0.row(3*i,3), PosDesign);
-        if(gravityCount+satCount)
-          copy(PosDesign.column(0, gravityCount+satCount), eqn.PosDesign.slice(3*i,0,3,gravityCount+satCount));
-        if(satArcCount)
-          copy(PosDesign.column(idxSatArc, satArcCount), eqn.PosDesign.slice(3*i,idxSatArc+arcNo*satArcCount,3,satArcCount));
-      }
+/***********************************************/
 
-      if(computeVelocity)
-      {
-        Matrix VelDesign(3, variationalEquation.parameterCount());
-        variationalEquation.velocity(idEpoch, eqn.vel0.row(3*i,3), VelDesign);
-        if(gravityCount+satCount)
-          copy(VelDesign.column(0, gravityCount+satCount), eqn.VelDesign.slice(3*i,0,3,gravityCount+satCount));
-        if(satArcCount)
-          copy(VelDesign.column(idxSatArc, satArcCount), eqn.VelDesign.slice(3*i,idxSatArc+arcNo*satArcCount,3,satArcCount));
-      }
+void VariationalEquationFromFile::computeEpoch(UInt epochStart, UInt i, Bool computePosition, Bool computeVelocity, ObservationEquation &eqn)
+{
+  try
+  {
+    const UInt idEpoch = epochStart+i;
 
-      eqn.rotSat.at(i)   = arc.rotSat.at(idEpoch);
-      eqn.rotEarth.at(i) = arc.rotEarth.at(idEpoch);
-    } // for(i=times)
+    if(computePosition)
+    {
+      Matrix PosDesign(3, variationalEquation.parameterCount());
+      variationalEquation.position(idEpoch, eqn.pos0.row(3*i,3), PosDesign);
+      if(gravityCount+satCount)
+        copy(PosDesign.column(0, gravityCount+satCount), eqn.PosDesign.slice(3*i,0,3,gravityCount+satCount));
+      if(satArcCount)
+        copy(PosDesign.column(idxSatArc, satArcCount), eqn.PosDesign.slice(3*i,idxSatArc+arcNo*satArcCount,3,satArcCount));
+    }
 
-    return eqn;
+    if(computeVelocity)
+    {
+      Matrix VelDesign(3, variationalEquation.parameterCount());
+      variationalEquation.velocity(idEpoch, eqn.vel0.row(3*i,3), VelDesign);
+      if(gravityCount+satCount)
+        copy(VelDesign.column(0, gravityCount+satCount), eqn.VelDesign.slice(3*i,0,3,gravityCount+satCount));
+      if(satArcCount)
+        copy(VelDesign.column(idxSatArc, satArcCount), eqn.VelDesign.slice(3*i,idxSatArc+arcNo*satArcCount,3,satArcCount));
+    }
+
+    eqn.rotSat.at(i)   = arc.rotSat.at(idEpoch);
+    eqn.rotEarth.at(i) = arc.rotEarth.at(idEpoch);
   }
   catch(std::exception &e)
   {
@@ -112,6 +112,14 @@ public:
   /** @brief Setup observation equations. */
   ObservationEquation integrateArc(Time timeStart, Time timeEnd, Bool computePosition, Bool computeVelocity, std::vector<Rotary3d> rotSat={});
 
+  /** @brief Setup observation equations of two satellites.
+  * Same as @ref integrateArc of both satellites, but the epochs are integrated together
+  * and the gravity field designs of both satellites (same epochs) are computed in one batched call. */
+  static void integrateArc(VariationalEquationFromFile &variationalEquation1, VariationalEquationFromFile &variationalEquation2,
+                           Time timeStart, Time timeEnd, Bool computePosition, Bool computeVelocity,
+                           const std::vector<Rotary3d> &rotSat1, const std::vector<Rotary3d> &rotSat2,
+                           ObservationEquation &eqn1, ObservationEquation &eqn2);
+
   VariationalEquationArc refineVariationalEquationArc(UInt arcNo, const_MatrixSliceRef x);
 
 private:
@@ -126,6 +134,8 @@ private:
   UInt  idxSatArc,  satArcCount;
 
   void getArc(const Time &time);
+  UInt initEquation(Time timeStart, Time timeEnd, Bool computePosition, Bool computeVelocity, const std::vector<Rotary3d> &rotSat, ObservationEquation &eqn);
+  void computeEpoch(UInt epochStart, UInt i, Bool computePosition, Bool computeVelocity, ObservationEquation &eqn);
 };
 
 /***********************************************/
@@ -10,8 +10,10 @@
 */
 /***********************************************/
 
-#include <random>
 #include "base/import.h"
+#include "base/fourier.h"
+#include "base/random.h"
+#include "parallel/threadPool.h"
 #include "inputOutput/logging.h"
 #include "files/fileMatrix.h"
 #include "varianceComponentEstimation.h"
@@ -20,22 +22,36 @@
 
 Matrix Vce::monteCarlo(UInt rows, UInt columns)
 {
-  // init random generator
-  static std::mt19937_64 generator;
-  static Bool init = FALSE;
-  if(!init)
+  return monteCarlo(rows, columns, Random::randomSeed());
+}
+
+/***********************************************/
+
+Matrix Vce::monteCarlo(UInt rows, UInt columns, UInt64 seed, UInt rowStart)
+{
+  try
   {
-   std::random_device randomDevice;
-   generator.seed(randomDevice());
-   init = TRUE;
+    // each column is an independent stream with 64 random signs per index
+    Matrix e(rows, columns);
+    const Double factor = 1./std::sqrt(columns);
+    Parallel::threadLoop(0, columns, [&](UInt k)
+    {
+      const Random random(seed, k);
+      UInt64 bits = 0;
+      for(UInt i=0; i<rows; i++)
+      {
+        const UInt row = rowStart+i;
+        if((i == 0) || (row%64 == 0))
+          bits = random.uint64(row/64);
+        e(i, k) = ((bits >> (row%64)) & 1) ? factor : -factor;
+      }
+    });
+    return e;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
   }
-
-  Matrix e(rows, columns);
-  std::uniform_int_distribution<Int> binary(0,1);
-  for(UInt i=0; i<rows; i++)
-    for(UInt k=0; k<columns; k++)
-      e(i, k) = binary(generator) * 2 - 1;
-  return 1./std::sqrt(columns) * e;
 }
 
 /***********************************************/
@@ -152,6 +168,30 @@ Matrix Vce::cosTransform(UInt length)
 
 /***********************************************/
 
+Vector Vce::cosTransformTrans(const Vector &x)
+{
+  try
+  {
+    const UInt n = x.rows();
+    if(n < 2)
+      return cosTransform(n).trans() * x;
+
+    // cosTransform(n)^T = diag(0.5,1,...,1,0.5) * (DCT-I + first and last column) / sqrt(2(n-1))
+    Vector y = Fourier::cosTransformation(x);
+    for(UInt k=0; k<n; k++)
+      y(k) += x(0) + ((k%2) ? -x(n-1) : x(n-1));
+    y(0)   *= 0.5;
+    y(n-1) *= 0.5;
+    return 1./std::sqrt(2.*(n-1)) * y;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 Matrix Vce::readCovarianceFunction(const FileName &name, UInt length, UInt columns, Double sampling)
 {
   try
@@ -263,11 +303,14 @@ void Vce::psd(const_MatrixSliceRef R, const_MatrixSliceRef WWe,
       e.row(1, e.rows()-1) *= 2.; // consider lower triangular of matrix
       r.row(1, r.rows()-1) *= 2.;
 
+      // inner products with all columns of CosTransform
+      const Vector eCos = cosTransformTrans(e);
+      const Vector rCos = cosTransformTrans(r);
+
       for(UInt idFreq=0; idFreq<Psd.rows(); idFreq++)
       {
-        const_MatrixSliceRef cov(CosTransform.column(idFreq));
-        const Double ePeTmp        = pow(sigma,2) * Psd(idFreq, idAxis) * inner(e, cov);
-        const Double redundancyTmp = pow(sigma,2) * Psd(idFreq, idAxis) * inner(r, cov);
+        const Double ePeTmp        = pow(sigma,2) * Psd(idFreq, idAxis) * eCos(idFreq);
+        const Double redundancyTmp = pow(sigma,2) * Psd(idFreq, idAxis) * rCos(idFreq);
         if((ePeTmp>0)&&(ePeTmp==ePeTmp)&&(redundancyTmp>0)&&(redundancyTmp==redundancyTmp))
         {
           ePe(idFreq, idAxis)        += ePeTmp;
@@ -23,9 +23,15 @@
 namespace Vce
 {
   /** @brief Random vector to estimate trace of a matrix
-  * The number of @p columns increases the reliability. */
+  * The number of @p columns increases the reliability.
+  * Each call uses a new (non reproducible) random seed. */
   Matrix monteCarlo(UInt rows, UInt columns);
 
+  /** @brief Rows @p rowStart ... @p rowStart+@p rows-1 of a reproducible random matrix for trace estimation.
+  * The values depend only on @p seed, @p columns, and the row index, so processes and threads
+  * can generate their part of the matrix independently. */
+  Matrix monteCarlo(UInt rows, UInt columns, UInt64 seed, UInt rowStart=0);
+
   /** @brief Estimates the standardDeviation in case of otuliers.
   * The quadratic sum of residuals @p ePe and the @p redundancy are computed with downweigthed data. */
   Double standardDeviation(Double ePe, Double redundancy, Double huber, Double huberPower);
@@ -49,6 +55,11 @@ namespace Vce
   * @endcode */
   Matrix cosTransform(UInt length);
 
+  /** @brief Product with the transposed cos transformation matrix.
+  * Computes @code cosTransform(x.rows()).trans() * x @endcode
+  * with FFT in O(n log n) operations instead of the dense product. */
+  Vector cosTransformTrans(const Vector &x);
+
   /** @brief Read covariance function from file or construct default function.
   * The covariance function must be saved as matrix.
   * The first column contains the time steps in seconds.
@@ -100,7 +111,7 @@ namespace Vce
   * @param WWe Weighted residuals Sigma^-1 e.
   * @param index Index of observations in the covariance function.
   * @param sigma Accuracy of the arc.
-  * @param CosTransform To transform PSD to covariance function.
+  * @param CosTransform To transform PSD to covariance function (only the size is used, the transformation is computed with FFT).
   * @param Psd Approximate PSD of the covariance function.
   * @param[in,out] ePe Updated squared sum of residuals.
   * @param[in,out] redundancy Updated for each axis (column) and frequency (row).
@@ -12,8 +12,12 @@
 /***********************************************/
 
 #include "base/import.h"
+#include "external/lapack/blas.h"
+#include "external/lapack/lapack.h"
 #include "parallel/parallel.h"
+#include "parallel/threadPool.h"
 #include "matrixDistributed.h"
+#include <chrono>
 
 /***********************************************/
 
@@ -142,6 +146,14 @@ std::vector<Bool> MatrixDistributed::usedRanksInColumn(const std::array<UInt,2>
 
 /***********************************************/
 
+// independent block operations of one step are computed in parallel threads
+static void runTasks(const std::vector<std::function<void()>> &tasks)
+{
+  Parallel::threadLoop(0, tasks.size(), [&](UInt k) {tasks.at(k)();});
+}
+
+/***********************************************/
+
 std::vector<Bool> MatrixDistributed::usedRanksInRow(UInt row, const std::array<UInt,2> &cols) const
 {
   try
@@ -255,7 +267,24 @@ void MatrixDistributed::setCalculateRank(std::function<UInt(UInt, UInt, UInt)> c
   {
     calcRank = calcRank_;
     if(calcRank == nullptr)
+    {
       calcRank = calculateRankBlockCyclic;
+      if(comm)
+      {
+        // processes of the same shared memory node consecutively in the process grid
+        // -> block rows (broadcasts in cholesky) stay mostly within a node
+        std::vector<UInt> node = Parallel::nodeIndex(comm);
+        std::vector<UInt> order(node.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](UInt i, UInt k) {return node.at(i) < node.at(k);});
+        if(!std::is_sorted(order.begin(), order.end()))
+          calcRank = [order](UInt i, UInt k, UInt commSize)
+          {
+            const UInt rank = calculateRankBlockCyclic(i, k, commSize);
+            return (commSize == order.size()) ? order.at(rank) : rank;
+          };
+      }
+    }
   }
   catch(std::exception &e)
   {
@@ -289,6 +318,7 @@ UInt MatrixDistributed::setBlock(UInt i, UInt k, UInt rank)
 {
   try
   {
+    GROOPS_MEMORY_CATEGORY("normals blocks")
     if(rank == NULLINDEX)
       rank = this->rank(i, k); // rank of used block
     if(rank == NULLINDEX)
@@ -360,6 +390,101 @@ void MatrixDistributed::eraseBlocks(UInt start, UInt count)
 }
 
 /***********************************************/
+
+void MatrixDistributed::eraseZeroBlocks()
+{
+  try
+  {
+    // zero blocks are marked at the parent processes
+    Vector isZero(_N.size());
+    for(UInt ik=0; ik<_N.size(); ik++)
+      if(isMyRank(ik) && isStrictlyZero(_N[ik]))
+        isZero(ik) = 1;
+    Parallel::reduceSum(isZero, 0, comm);
+    Parallel::broadCast(isZero, 0, comm);
+
+    std::vector<std::vector<std::pair<UInt, UInt>>> _rowNew(blockCount());      // each column, used row -> idx to _N and _rank
+    std::vector<std::vector<std::pair<UInt, UInt>>> _columnNew(blockCount());   // each row, used column -> idx to _N and _rank
+    std::vector<Matrix>               _NNew;                            // unorderd list of used blocks
+    std::vector<UInt>                 _rankNew;                         // unorderd list of rank of used blocks
+    for(UInt i=0; i<blockCount(); i++)
+      loopBlockRow(i, {0, blockCount()}, [&](UInt k, UInt ik)
+      {
+        if((i == k) || !isZero(ik))
+        {
+          _columnNew[i].push_back(std::pair<UInt, UInt>(k, _NNew.size()));
+          _rowNew[k].push_back(std::pair<UInt, UInt>(i, _NNew.size()));
+          _NNew.push_back(_N[ik]);
+          _rankNew.push_back(_rank[ik]);
+        }
+      });
+
+    _row    = _rowNew;
+    _column = _columnNew;
+    _N      = _NNew;
+    _rank   = _rankNew;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+/***********************************************/
+
+void MatrixDistributed::rankKUpdate(Double factor, const_MatrixSliceRef A, UInt startIndex)
+{
+  try
+  {
+    GROOPS_PROFILE("MatrixDistributed::rankKUpdate")
+    GROOPS_MEMORY_CATEGORY("normals blocks")
+    if(!A.columns())
+      return;
+
+    const UInt blockStart = index2block(startIndex);
+    const UInt blockEnd   = index2block(startIndex+A.columns()-1);
+
+    // column blocks of A without any contribution (e.g. inactive temporal parameters)
+    std::vector<Byte> isZero(blockEnd-blockStart+1, FALSE); // no std::vector<Bool>: written concurrently
+    if(isZero.size() > 1)
+      Parallel::threadLoop(blockStart, blockEnd+1, [&](UInt i)
+      {
+        const UInt idxN = (blockIndex(i) < startIndex) ? (startIndex-blockIndex(i)) : 0;
+        const UInt idxA = (blockIndex(i) < startIndex) ? 0 : (blockIndex(i)-startIndex);
+        isZero.at(i-blockStart) = isStrictlyZero(A.column(idxA, std::min(blockSize(i)-idxN, A.columns()-idxA)));
+      });
+
+    std::vector<std::pair<UInt, UInt>> blocks;
+    for(UInt i=blockStart; i<=blockEnd; i++)
+      for(UInt k=i; k<=blockEnd; k++)
+        if(!isZero.at(i-blockStart) && !isZero.at(k-blockStart))
+          blocks.push_back({i, k});
+
+    Parallel::threadLoop(0, blocks.size(), [&](UInt idx)
+    {
+      const UInt i     = blocks.at(idx).first;
+      const UInt k     = blocks.at(idx).second;
+      const UInt idxN1 = (blockIndex(i) < startIndex) ? (startIndex-blockIndex(i)) : 0;
+      const UInt idxA1 = (blockIndex(i) < startIndex) ? 0 : (blockIndex(i)-startIndex);
+      const UInt cols1 = std::min(blockSize(i)-idxN1, A.columns()-idxA1);
+      if(i == k)
+      {
+        ::rankKUpdate(factor, A.column(idxA1, cols1), N(i,i).slice(idxN1, idxN1, cols1, cols1));
+        return;
+      }
+      const UInt idxN2 = (blockIndex(k) < startIndex) ? (startIndex-blockIndex(k)) : 0;
+      const UInt idxA2 = (blockIndex(k) < startIndex) ? 0 : (blockIndex(k)-startIndex);
+      const UInt cols2 = std::min(blockSize(k)-idxN2, A.columns()-idxA2);
+      matMult(factor, A.column(idxA1, cols1).trans(), A.column(idxA2, cols2), N(i,k).slice(idxN1, idxN2, cols1, cols2));
+    });
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
 /***********************************************/
 
 void MatrixDistributed::setNull()
@@ -389,6 +514,7 @@ void MatrixDistributed::reduceSum(UInt i, UInt k)
 {
   try
   {
+    GROOPS_MEMORY_CATEGORY("normals blocks")
     if(Parallel::size(comm)<=1)
       return;
 
@@ -417,9 +543,33 @@ void MatrixDistributed::reduceSum(Bool timing)
 {
   try
   {
+    GROOPS_PROFILE("MatrixDistributed::reduceSum")
+    GROOPS_MEMORY_CATEGORY("normals blocks")
     if(Parallel::size(comm)<=1)
       return;
 
+    // blocks with contributions from processes other than the parent process
+    Vector contributions(_N.size());
+    for(UInt ik=0; ik<_N.size(); ik++)
+      if(!isMyRank(ik) && _N[ik].size())
+        contributions(ik) = 1;
+    Parallel::reduceSum(contributions, 0, comm);
+    Parallel::broadCast(contributions, 0, comm);
+
+    // non blocking reduction of several blocks at once, the memory of blocks in flight is limited
+    constexpr UInt maxInFlight = 512*1024*1024/sizeof(Double); // 512 MB
+    std::list<std::pair<UInt, Parallel::RequestPtr>> requests;
+    UInt inFlight = 0;
+    auto waitForFirst = [&]()
+    {
+      const UInt ik = requests.front().first;
+      Parallel::wait(requests.front().second);
+      requests.pop_front();
+      inFlight -= _N[ik].size();
+      if(!isMyRank(ik))
+        _N[ik] = Matrix();
+    };
+
     if(timing) logTimerStart;
     UInt idxBlock = 0;
     for(UInt i=0; i<blockCount(); i++)
@@ -428,14 +578,20 @@ void MatrixDistributed::reduceSum(Bool timing)
         if(timing) logTimerLoop(idxBlock++, _N.size());
         if(isMyRank(ik) && (_N[ik].size() == 0))
           _N[ik] = ((i==k) ? Matrix(blockSize(i), Matrix::SYMMETRIC) : Matrix(blockSize(i), blockSize(k)));
-        UInt color = _N[ik].size()  ? idxBlock : NULLINDEX;
-        UInt key   = isMyRank(ik) ? 0 : Parallel::myRank(comm)+1;
-        Parallel::CommunicatorPtr commNew = Parallel::splitCommunicator(color, key, comm);
-        if(commNew && (Parallel::size(commNew)>1))
-          Parallel::reduceSum(_N[ik], 0, commNew);
-        if(!isMyRank(ik))
-          _N[ik] = Matrix();
+        if(!contributions(ik))
+          return;
+        if(_N[ik].size() == 0) // zero contribution
+          _N[ik] = ((i==k) ? Matrix(blockSize(i), Matrix::SYMMETRIC) : Matrix(blockSize(i), blockSize(k)));
+        while(requests.size() && (inFlight+_N[ik].size() > maxInFlight))
+          waitForFirst();
+        requests.push_back(std::make_pair(ik, Parallel::reduceSumNonBlocking(_N[ik], _rank[ik], comm)));
+        inFlight += _N[ik].size();
       });
+    while(requests.size())
+      waitForFirst();
+    for(UInt ik=0; ik<_N.size(); ik++)
+      if(!isMyRank(ik))
+        _N[ik] = Matrix();
     Parallel::barrier(comm);
     if(timing) logTimerLoopEnd(_N.size());
   }
@@ -452,6 +608,8 @@ void MatrixDistributed::cholesky(Bool timing, UInt startBlock, UInt countBlock,
 {
   try
   {
+    GROOPS_PROFILE("MatrixDistributed::cholesky")
+    GROOPS_MEMORY_CATEGORY("normals blocks")
     if(timing) logTimerStart;
     for(UInt i=startBlock; i<blockCount(); i++)
       if(blockSize(i))
@@ -466,18 +624,19 @@ void MatrixDistributed::cholesky(Bool timing, UInt startBlock, UInt countBlock,
           if(ii == NULLINDEX)
             ii = setBlock(i,i);
 
+          // distribute top column to right hand side blocks
+          if(Parallel::size(comm) > 1)
+            broadCast(_N[zi], zi, usedRanksInRow(z, {i+1, blockCount()}));
+
           // column rank k update
+          std::vector<std::function<void()>> tasks;
           if(isMyRank(zi))
           {
             if(_N[ii].size() == 0)
               _N[ii] = Matrix(blockSize(i), Matrix::SYMMETRIC, Matrix::UPPER);
-            rankKUpdate(-1., _N[zi], _N[ii]);
+            tasks.push_back([&, zi, ii]() {::rankKUpdate(-1., _N[zi], _N[ii]);});
           }
 
-          // distribute top column to right hand side blocks
-          if(Parallel::size(comm) > 1)
-            broadCast(_N[zi], zi, usedRanksInRow(z, {i+1, blockCount()}));
-
           // dgemm
           loopBlockRow(z, {i+1, blockCount()}, [&](UInt s, UInt zs)
           {
@@ -486,9 +645,10 @@ void MatrixDistributed::cholesky(Bool timing, UInt startBlock, UInt countBlock,
             {
               if(_N[is].size() == 0)
                 _N[is] = Matrix(blockSize(i), blockSize(s));
-              matMult(-1., _N[zi].trans(), _N[zs], _N[is]);
+              tasks.push_back([&, zi, zs, is]() {matMult(-1., _N[zi].trans(), _N[zs], _N[is]);});
             }
           });
+          runTasks(tasks);
 
           // free column
           if(!isMyRank(zi) && _N[zi].size())
@@ -520,11 +680,13 @@ void MatrixDistributed::cholesky(Bool timing, UInt startBlock, UInt countBlock,
             broadCast(_N[ii], ii, usedRanksInRow(i, {i+1, blockCount()}));
 
           // triangularSolve to row
+          std::vector<std::function<void()>> tasks;
           loopBlockRow(i, {i+1, blockCount()}, [&](UInt /*s*/, UInt is)
           {
             if(isMyRank(is))
-              ::triangularSolve(1., _N[ii].trans(), _N[is]);
+              tasks.push_back([&, is]() {::triangularSolve(1., _N[ii].trans(), _N[is]);});
           });
+          runTasks(tasks);
 
           // free diagonal
           if(ii != NULLINDEX && !isMyRank(ii) && _N[ii].size())
@@ -542,10 +704,19 @@ void MatrixDistributed::cholesky(Bool timing, UInt startBlock, UInt countBlock,
 
 /***********************************************/
 
-Matrix MatrixDistributed::solve(const_MatrixSliceRef n, Bool timing)
+Matrix MatrixDistributed::solve(const_MatrixSliceRef n, Bool timing, Bool mixedPrecision)
 {
   try
   {
+    GROOPS_PROFILE("MatrixDistributed::solve")
+    if(mixedPrecision)
+    {
+      Matrix x;
+      if(solveMixedPrecision(n, x, timing))
+        return x;
+      logWarning<<"mixed precision refinement did not converge -> solve in double precision"<<Log::endl;
+    }
+
     cholesky(timing);
 
     UInt rhsCount = n.columns();
@@ -575,6 +746,494 @@ Matrix MatrixDistributed::solve(const_MatrixSliceRef n, Bool timing)
   }
 }
 
+/***********************************************/
+/***** Mixed precision *************************/
+/***********************************************/
+
+// single precision copy of a block (column major)
+static std::vector<Float> toSingle(const Matrix &A)
+{
+  std::vector<Float> W(A.rows()*A.columns());
+  for(UInt k=0; k<A.columns(); k++)
+    for(UInt i=0; i<A.rows(); i++)
+      W[i+k*A.rows()] = static_cast<Float>(A(i,k));
+  return W;
+}
+
+/***********************************************/
+
+// double precision copy of a single precision block (zero matrix if empty)
+static Matrix toDouble(const std::vector<Float> &W, UInt rows, UInt columns, Matrix::Type type=Matrix::GENERAL)
+{
+  Matrix A = (type == Matrix::GENERAL) ? Matrix(rows, columns) : Matrix(rows, type, Matrix::UPPER);
+  if(W.size())
+    for(UInt k=0; k<columns; k++)
+      for(UInt i=0; i<rows; i++)
+        A(i,k) = W[i+k*rows];
+  return A;
+}
+
+/***********************************************/
+
+void MatrixDistributed::broadCastSingle(std::vector<Float> &x, UInt size, UInt idx, const std::vector<Bool> &usedRank)
+{
+  try
+  {
+    std::vector<UInt> ranks = {_rank[idx]};
+    for(UInt idProcess=0; idProcess<usedRank.size(); idProcess++)
+      if(usedRank.at(idProcess) && (idProcess != _rank[idx]))
+        ranks.push_back(idProcess);
+    if(ranks.size() < 2)
+      return;
+    Parallel::CommunicatorPtr commNew = Parallel::createCommunicator(ranks, comm);
+    if(!commNew)
+      return;
+    x.resize(size);
+    Parallel::broadCast(reinterpret_cast<Byte*>(x.data()), size*sizeof(Float), 0, commNew);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void MatrixDistributed::choleskySingle(Bool timing)
+{
+  try
+  {
+    if(timing) logTimerStart;
+    for(UInt i=0; i<blockCount(); i++)
+      if(blockSize(i))
+      {
+        if(timing) logTimerLoop(i, blockCount());
+        const UInt ii = index(i,i);
+        if(ii == NULLINDEX)
+          throw(Exception("Diagonal block ("+i%"%i, "s+i%"%i) is not set."s));
+
+        loopBlockColumn({0, i}, i, [&](UInt z, UInt zi)
+        {
+          // distribute top column to right hand side blocks
+          if(Parallel::size(comm) > 1)
+            broadCastSingle(_W[zi], blockSize(z)*blockSize(i), zi, usedRanksInRow(z, {i+1, blockCount()}));
+
+          // column rank k update
+          std::vector<std::function<void()>> tasks;
+          if(isMyRank(zi))
+          {
+            if(_W[ii].size() == 0)
+              _W[ii].resize(blockSize(i)*blockSize(i), 0.);
+            tasks.push_back([&, z, zi]() {blas_ssyrk(TRUE/*upper*/, TRUE/*trans*/, blockSize(i), blockSize(z), -1., _W[zi].data(), blockSize(z), 1., _W[ii].data(), blockSize(i));});
+          }
+
+          // sgemm
+          loopBlockRow(z, {i+1, blockCount()}, [&](UInt s, UInt zs)
+          {
+            const UInt is = setBlock(i, s);
+            _W.resize(_N.size());
+            if(isMyRank(zs))
+            {
+              if(_W[is].size() == 0)
+                _W[is].resize(blockSize(i)*blockSize(s), 0.);
+              tasks.push_back([&, z, s, zi, zs, is]() {blas_sgemm(TRUE/*transA*/, FALSE/*transB*/, blockSize(i), blockSize(s), blockSize(z), -1., _W[zi].data(), blockSize(z),
+                                                                   _W[zs].data(), blockSize(z), 1., _W[is].data(), blockSize(i));});
+            }
+          });
+          runTasks(tasks);
+
+          // free column
+          if(!isMyRank(zi))
+            _W[zi] = std::vector<Float>();
+        }); // for(row z)
+
+        // collect right row elements from top block
+        if((i>0) && (Parallel::size(comm) > 1))
+          loopBlockRow(i, {i, blockCount()}, [&](UInt s, UInt is)
+          {
+            std::vector<Bool> usedRank(Parallel::size(comm), FALSE);
+            loopBlockColumn({0, i}, i, [&](UInt z, UInt /*zi*/)
+            {
+              const UInt zs = index(z,s);
+              if(zs != NULLINDEX)
+                usedRank.at(_rank[zs]) = TRUE;
+            });
+            Matrix x = toDouble(_W[is], blockSize(i), blockSize(s));
+            reduceSum(x, is, usedRank);
+            _W[is] = (isMyRank(is)) ? toSingle(x) : std::vector<Float>();
+          });
+
+        // cholesky (not positive definite in single precision -> NaN, detected in the refinement)
+        if(isMyRank(ii))
+        {
+          _W[ii].resize(blockSize(i)*blockSize(i), 0.);
+          if(lapack_spotrf(TRUE/*upper*/, blockSize(i), _W[ii].data(), blockSize(i)) != 0)
+            std::fill(_W[ii].begin(), _W[ii].end(), NAN_EXPR);
+        }
+
+        // distribute diagonal element to row
+        if(Parallel::size(comm) > 1)
+          broadCastSingle(_W[ii], blockSize(i)*blockSize(i), ii, usedRanksInRow(i, {i+1, blockCount()}));
+
+        // triangularSolve to row
+        std::vector<std::function<void()>> tasks;
+        loopBlockRow(i, {i+1, blockCount()}, [&](UInt s, UInt is)
+        {
+          if(isMyRank(is))
+            tasks.push_back([&, s, is]() {blas_strsm(TRUE/*left*/, TRUE/*upper*/, TRUE/*trans*/, FALSE/*unitDiag*/, blockSize(i), blockSize(s), 1., _W[ii].data(), blockSize(i), _W[is].data(), blockSize(i));});
+        });
+        runTasks(tasks);
+
+        // free diagonal
+        if(!isMyRank(ii))
+          _W[ii] = std::vector<Float>();
+      }
+    Parallel::barrier(comm);
+    if(timing) logTimerLoopEnd(blockCount());
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void MatrixDistributed::triangularTransSolveSingle(std::vector<Matrix> &x)
+{
+  try
+  {
+    for(UInt i=0; i<blockCount(); i++)
+      if(blockSize(i))
+      {
+        const UInt ii = index(i,i);
+
+        // collect
+        if(Parallel::size(comm) > 1)
+        {
+          std::vector<Bool> usedRank = usedRanksInColumn({0, i}, i);
+          usedRank.at(0) = TRUE; // master
+          reduceSum(x.at(i), ii, usedRank);
+        }
+
+        // solve
+        if(isMyRank(ii))
+          ::triangularSolve(1., toDouble(_W[ii], blockSize(i), blockSize(i), Matrix::TRIANGULAR).trans(), x.at(i));
+
+        // distribute to row
+        if(Parallel::size(comm) > 1)
+        {
+          std::vector<Bool> usedRank = usedRanksInRow(i, {i, blockCount()});
+          usedRank.at(0) = TRUE; // master
+          broadCast(x.at(i), ii, usedRank);
+        }
+
+        // reduce
+        std::vector<std::function<void()>> tasks;
+        loopBlockRow(i, {i+1, blockCount()}, [&](UInt s, UInt is)
+        {
+          if(isMyRank(is) && _W[is].size())
+            tasks.push_back([&, s, is]() {matMult(-1., toDouble(_W[is], blockSize(i), blockSize(s)).trans(), x.at(i), x.at(s));});
+        });
+        runTasks(tasks);
+
+        // free
+        if(!Parallel::isMaster(comm))
+          x.at(i).setNull();
+      }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void MatrixDistributed::triangularSolveSingle(std::vector<Matrix> &x)
+{
+  try
+  {
+    for(UInt i=blockCount(); i-->0;)
+      if(blockSize(i))
+      {
+        const UInt ii = index(i,i);
+
+        // collect
+        if(Parallel::size(comm) > 1)
+        {
+          std::vector<Bool> usedRank = usedRanksInRow(i, {i, blockCount()});
+          usedRank.at(0) = TRUE; // master
+          reduceSum(x.at(i), ii, usedRank);
+        }
+
+        // solve
+        if(isMyRank(ii))
+          ::triangularSolve(1., toDouble(_W[ii], blockSize(i), blockSize(i), Matrix::TRIANGULAR), x.at(i));
+
+        // distribute to top column
+        if(Parallel::size(comm) > 1)
+        {
+          std::vector<Bool> usedRank = usedRanksInColumn({0, i}, i);
+          usedRank.at(0) = TRUE; // master
+          broadCast(x.at(i), ii, usedRank);
+        }
+
+        // reduce
+        std::vector<std::function<void()>> tasks;
+        loopBlockColumn({0, i}, i, [&](UInt z, UInt zi)
+        {
+          if(isMyRank(zi) && _W[zi].size())
+            tasks.push_back([&, z, zi]() {matMult(-1., toDouble(_W[zi], blockSize(z), blockSize(i)), x.at(i), x.at(z));});
+        });
+        runTasks(tasks);
+
+        // free
+        if(!Parallel::isMaster(comm))
+          x.at(i).setNull();
+      }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Matrix MatrixDistributed::multiply(const_MatrixSliceRef x)
+{
+  try
+  {
+    GROOPS_PROFILE("MatrixDistributed::multiply")
+    UInt rhsCount = x.columns();
+    Parallel::broadCast(rhsCount, 0, comm);
+    Matrix x2 = (Parallel::isMaster(comm)) ? Matrix(x) : Matrix(dimension(), rhsCount);
+    if(Parallel::size(comm) > 1)
+      Parallel::broadCast(x2, 0, comm);
+
+    // each block row of the result in a separate thread
+    Matrix y(dimension(), rhsCount);
+    Parallel::threadLoop(0, blockCount(), [&](UInt i)
+    {
+      MatrixSlice yi(y.row(blockIndex(i), blockSize(i)));
+      loopBlockColumn({0, i}, i, [&](UInt z, UInt zi)
+      {
+        if(isMyRank(zi) && _N[zi].size())
+          matMult(1., _N[zi].trans(), x2.row(blockIndex(z), blockSize(z)), yi);
+      });
+      loopBlockRow(i, {i, blockCount()}, [&](UInt s, UInt is)
+      {
+        if(isMyRank(is) && _N[is].size())
+          matMult(1., _N[is], x2.row(blockIndex(s), blockSize(s)), yi);
+      });
+    });
+
+    Parallel::reduceSum(y, 0, comm);
+    return y;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Bool MatrixDistributed::solveMixedPrecision(const_MatrixSliceRef n, Matrix &x, Bool timing)
+{
+  try
+  {
+    // Frobenius norm of the symmetric matrix
+    Double norm = 0;
+    for(UInt i=0; i<blockCount(); i++)
+      loopBlockRow(i, {i, blockCount()}, [&](UInt s, UInt is)
+      {
+        if(!isMyRank(is))
+          return;
+        const Matrix &N = _N[is];
+        for(UInt k=0; k<N.columns(); k++)
+          for(UInt z=0; z<((s == i) ? k+1 : N.rows()); z++)
+            norm += (((s == i) && (z == k)) ? 1. : 2.) * N(z,k) * N(z,k);
+      });
+    Parallel::reduceSum(norm, 0, comm);
+    norm = std::sqrt(norm);
+
+    // single precision Cholesky decomposition
+    _W.clear();
+    _W.resize(_N.size());
+    for(UInt idx=0; idx<_N.size(); idx++)
+      if(isMyRank(idx) && _N[idx].size())
+        _W[idx] = toSingle(_N[idx]);
+    choleskySingle(timing);
+
+    UInt rhsCount = n.columns();
+    Parallel::broadCast(rhsCount, 0, comm);
+    auto solveSingle = [&](const_MatrixSliceRef r)
+    {
+      std::vector<Matrix> y(blockCount());
+      for(UInt i=0; i<blockCount(); i++)
+        y.at(i) = (Parallel::isMaster(comm)) ? Matrix(r.row(blockIndex(i), blockSize(i))) : Matrix(blockSize(i), rhsCount);
+      triangularTransSolveSingle(y);
+      triangularSolveSingle(y);
+      Matrix d(dimension(), rhsCount);
+      if(Parallel::isMaster(comm))
+        for(UInt i=0; i<blockCount(); i++)
+          copy(y.at(i), d.row(blockIndex(i), blockSize(i)));
+      return d;
+    };
+
+    // iterative refinement with residuals in double precision
+    // converged if the backward error is in the order of double precision
+    const UInt maxIter = 30;
+    Bool converged = FALSE;
+    Bool failed    = FALSE;
+    x = solveSingle(n);
+    for(UInt iter=0; (iter<maxIter) && !converged && !failed; iter++)
+    {
+      Matrix r = multiply(x);
+      if(Parallel::isMaster(comm))
+      {
+        r *= -1.;
+        axpy(1., n, r);
+        failed    = !std::isfinite(quadsum(x)) || !std::isfinite(quadsum(r));
+        converged = !failed && (maxabs(r) <= std::sqrt(Double(dimension())) * std::numeric_limits<Double>::epsilon() * norm * maxabs(x));
+        if(converged && timing)
+          logInfo<<"  mixed precision refinement converged after "<<iter<<" iterations"<<Log::endl;
+      }
+      Parallel::broadCast(converged, 0, comm);
+      Parallel::broadCast(failed,    0, comm);
+      if(!converged && !failed)
+        axpy(1., solveSingle(r), x);
+    }
+
+    // replace the matrix by the Cholesky decomposition
+    if(converged)
+      for(UInt i=0; i<blockCount(); i++)
+        loopBlockRow(i, {i, blockCount()}, [&](UInt s, UInt is)
+        {
+          if(isMyRank(is))
+            _N[is] = toDouble(_W[is], blockSize(i), blockSize(s), (s == i) ? Matrix::TRIANGULAR : Matrix::GENERAL);
+        });
+    _W.clear();
+
+    return converged;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Matrix MatrixDistributed::solveConjugateGradient(const_MatrixSliceRef n, UInt maxIter, Double threshold, Bool timing)
+{
+  try
+  {
+    UInt rhsCount = n.columns();
+    Parallel::broadCast(rhsCount, 0, comm);
+
+    // preconditioner: Cholesky decomposition of the diagonal blocks
+    std::vector<Matrix> W(blockCount());
+    for(UInt i=0; i<blockCount(); i++)
+      if(blockSize(i) && isMyRank(i,i))
+        W.at(i) = N(i,i);
+    Parallel::threadLoop(0, blockCount(), [&](UInt i) {if(W.at(i).size()) ::cholesky(W.at(i));});
+
+    auto precondition = [&](const_MatrixSliceRef r)
+    {
+      Matrix z = (Parallel::isMaster(comm)) ? Matrix(r) : Matrix(dimension(), rhsCount);
+      if(Parallel::size(comm) > 1)
+        Parallel::broadCast(z, 0, comm);
+      Parallel::threadLoop(0, blockCount(), [&](UInt i)
+      {
+        MatrixSlice zi(z.row(blockIndex(i), blockSize(i)));
+        if(W.at(i).size())
+        {
+          ::triangularSolve(1., W.at(i).trans(), zi);
+          ::triangularSolve(1., W.at(i), zi);
+        }
+        else
+          zi.setNull();
+      });
+      if(Parallel::size(comm) > 1)
+        Parallel::reduceSum(z, 0, comm);
+      return z;
+    };
+
+    // each column is an independent system, quantities are computed at master only
+    Matrix x, r, p, z;
+    Vector rz(rhsCount), norm0(rhsCount);
+    if(Parallel::isMaster(comm))
+    {
+      x = Matrix(dimension(), rhsCount);
+      r = n;
+      for(UInt k=0; k<rhsCount; k++)
+        norm0(k) = norm(r.column(k));
+    }
+    z = precondition(r);
+    if(Parallel::isMaster(comm))
+    {
+      p = z;
+      for(UInt k=0; k<rhsCount; k++)
+        rz(k) = inner(r.column(k), z.column(k));
+    }
+
+    Bool   converged = FALSE;
+    Double ratio     = 1.;
+    UInt   iter      = 0;
+    if(timing) logTimerStart;
+    for(; (iter<maxIter) && !converged; iter++)
+    {
+      if(timing) logTimerLoop(iter, maxIter);
+      const Matrix q = multiply(p);
+      if(Parallel::isMaster(comm))
+      {
+        ratio = 0.;
+        for(UInt k=0; k<rhsCount; k++)
+        {
+          const Double pq    = inner(p.column(k), q.column(k));
+          const Double alpha = (pq > 0) ? rz(k)/pq : 0.;
+          axpy( alpha, p.column(k), x.column(k));
+          axpy(-alpha, q.column(k), r.column(k));
+          if(norm0(k) > 0)
+            ratio = std::max(ratio, norm(r.column(k))/norm0(k));
+        }
+        converged = (ratio <= threshold);
+      }
+      Parallel::broadCast(converged, 0, comm);
+      if(converged)
+        break;
+
+      z = precondition(r);
+      if(Parallel::isMaster(comm))
+        for(UInt k=0; k<rhsCount; k++)
+        {
+          const Double rzNew = inner(r.column(k), z.column(k));
+          const Double beta  = (rz(k) > 0) ? rzNew/rz(k) : 0.;
+          rz(k) = rzNew;
+          p.column(k) *= beta;
+          axpy(1., z.column(k), p.column(k));
+        }
+    }
+    if(timing) logTimerLoopEnd(maxIter);
+
+    if(converged)
+      logInfo<<"  conjugate gradient converged after "<<iter+1<<" iterations"<<Log::endl;
+    else
+      logWarning<<"conjugate gradient not converged after "<<maxIter<<" iterations (residual ratio = "<<ratio<<")"<<Log::endl;
+
+    if(!Parallel::isMaster(comm))
+      x = Matrix(dimension(), rhsCount);
+    return x;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
 /***********************************************/
 
 void MatrixDistributed::triangularSolve(MatrixSliceRef x2)
@@ -610,6 +1269,7 @@ void MatrixDistributed::triangularSolve(std::vector<Matrix> &x, UInt startBlock,
 {
   try
   {
+    GROOPS_PROFILE("MatrixDistributed::triangularSolve")
     for(UInt i=startBlock+countBlock; i-->startBlock;)
       if(blockSize(i))
       {
@@ -636,11 +1296,13 @@ void MatrixDistributed::triangularSolve(std::vector<Matrix> &x, UInt startBlock,
         }
 
         // reduce
+        std::vector<std::function<void()>> tasks;
         loopBlockColumn({startBlock, i}, i, [&](UInt z, UInt zi)
         {
           if(isMyRank(zi))
-            matMult(-1., _N[zi], x.at(i), x.at(z));
+            tasks.push_back([&, z, zi]() {matMult(-1., _N[zi], x.at(i), x.at(z));});
         });
+        runTasks(tasks);
 
         // free
         if(!Parallel::isMaster(comm))
@@ -688,6 +1350,7 @@ void MatrixDistributed::triangularTransSolve(std::vector<Matrix> &x, UInt startB
 {
   try
   {
+    GROOPS_PROFILE("MatrixDistributed::triangularTransSolve")
     for(UInt i=startBlock; i<startBlock+countBlock; i++)
       if(blockSize(i))
       {
@@ -714,11 +1377,13 @@ void MatrixDistributed::triangularTransSolve(std::vector<Matrix> &x, UInt startB
         }
 
         // reduce
+        std::vector<std::function<void()>> tasks;
         loopBlockRow(i, {i+1, blockCount()}, [&](UInt s, UInt is)
         {
           if(isMyRank(is) && _N[is].size())
-            matMult(-1., _N[is].trans(), x.at(i), x.at(s));
+            tasks.push_back([&, s, is]() {matMult(-1., _N[is].trans(), x.at(i), x.at(s));});
         });
+        runTasks(tasks);
 
         // free
         if(!Parallel::isMaster(comm))
@@ -762,6 +1427,8 @@ void MatrixDistributed::choleskyInverse(Bool timing, UInt startBlock, UInt count
 {
   try
   {
+    GROOPS_PROFILE("MatrixDistributed::choleskyInverse")
+    GROOPS_MEMORY_CATEGORY("normals blocks")
     if(timing) logTimerStart;
     for(UInt i=startBlock; i<startBlock+countBlock; i++)
       if(blockSize(i))
@@ -827,11 +1494,13 @@ void MatrixDistributed::choleskyInverse(Bool timing, UInt startBlock, UInt count
           broadCast(_N[ii], ii, usedRanksInColumn({startBlock, i+1}, i));
 
         // triangularSolve to column
+        std::vector<std::function<void()>> tasks;
         loopBlockColumn({startBlock, i}, i, [&](UInt /*z*/, UInt zi)
         {
           if(isMyRank(zi))
-            ::triangularSolve(-1., _N[ii].trans(), _N[zi].trans());
+            tasks.push_back([&, zi]() {::triangularSolve(-1., _N[ii].trans(), _N[zi].trans());});
         });
+        runTasks(tasks);
 
         // free diagonal
         if((!isMyRank(ii)) && _N[ii].size())
@@ -857,6 +1526,8 @@ void MatrixDistributed::choleskyProduct(Bool timing)
 {
   try
   {
+    GROOPS_PROFILE("MatrixDistributed::choleskyProduct")
+    GROOPS_MEMORY_CATEGORY("normals blocks")
     if(timing) logTimerStart;
     for(UInt i=0; i<blockCount(); i++)
       if(blockSize(i))
@@ -869,11 +1540,13 @@ void MatrixDistributed::choleskyProduct(Bool timing)
           broadCast(_N[ii], ii, usedRanksInColumn({0, i+1}, i));
 
         // compute triangularMult
+        std::vector<std::function<void()>> tasks;
         loopBlockColumn({0, i}, i, [&](UInt /*z*/, UInt zi)
         {
           if(isMyRank(zi))
-            triangularMult(1., _N[ii], _N[zi].trans());
+            tasks.push_back([&, zi]() {triangularMult(1., _N[ii], _N[zi].trans());});
         });
+        runTasks(tasks);
 
         // W'W
         if(isMyRank(ii))
@@ -888,7 +1561,8 @@ void MatrixDistributed::choleskyProduct(Bool timing)
             broadCast(_N[is], is, usedRanksInColumn({0, i+1}, s));
           });
 
-        // dgemm
+        // dgemm (block rows z in parallel threads)
+        std::vector<std::vector<std::pair<UInt, UInt>>> products(i); // for each z: (zs, is)
         for(UInt z=0; z<i; z++)
           loopBlockRow(i, {i+1, blockCount()}, [&](UInt s, UInt is)
           {
@@ -898,9 +1572,14 @@ void MatrixDistributed::choleskyProduct(Bool timing)
               const UInt zi = setBlock(z, i);
               if(!_N[zi].size())
                 _N[zi] = Matrix(blockSize(z), blockSize(i));
-              matMult(1., _N[zs], _N[is].trans(), _N[zi]);
+              products.at(z).push_back({zs, is});
             }
           });
+        Parallel::threadLoop(0, i, [&](UInt z)
+        {
+          for(const auto &p : products.at(z))
+            matMult(1., _N[p.first], _N[p.second].trans(), _N[index(z, i)]);
+        });
 
         // free row elements
         loopBlockRow(i, {i+1, blockCount()}, [&](UInt /*s*/, UInt is)
@@ -929,7 +1608,7 @@ void MatrixDistributed::choleskyProduct(Bool timing)
           {
             if(_N[ii].size() == 0)
               _N[ii] = Matrix(blockSize(i), Matrix::SYMMETRIC, Matrix::UPPER);
-            rankKUpdate(1., _N[is].trans(), _N[ii]);
+            ::rankKUpdate(1., _N[is].trans(), _N[ii]);
           }
         });
 
@@ -959,6 +1638,8 @@ void MatrixDistributed::cholesky2SparseInverse(Bool timing)
 {
   try
   {
+    GROOPS_PROFILE("MatrixDistributed::cholesky2SparseInverse")
+    GROOPS_MEMORY_CATEGORY("normals blocks")
     if(timing) logTimerStart;
     for(UInt i=blockCount(); i-->0;)
       if(blockSize(i))
@@ -998,7 +1679,7 @@ void MatrixDistributed::cholesky2SparseInverse(Bool timing)
           });
 
         // symm. matMult
-        std::vector<Matrix> Uij(blockCount());
+        std::map<UInt, Matrix> Uij; // only used blocks of the row
         loopBlockRow(i, {i+1, blockCount()}, [&](UInt j, UInt ij) // loop over columns
         {
           std::vector<Bool> usedRank(Parallel::size(comm), FALSE);
@@ -1010,15 +1691,15 @@ void MatrixDistributed::cholesky2SparseInverse(Bool timing)
               usedRank.at(_rank[jk]) = TRUE;
               if(isMyRank(jk))
               {
-                if(!Uij.at(j).size())
-                  Uij.at(j) = Matrix(blockSize(i), blockSize(j));
-                matMult(1., _N[ik], ((k>j) ? _N[jk].trans() : _N[jk]), Uij.at(j));
+                if(!Uij[j].size())
+                  Uij[j] = Matrix(blockSize(i), blockSize(j));
+                matMult(1., _N[ik], ((k>j) ? _N[jk].trans() : _N[jk]), Uij[j]);
               }
             }
           });
-          if(isMyRank(ij) && !Uij.at(j).size())
-            Uij.at(j) = Matrix(blockSize(i), blockSize(j));
-          reduceSum(Uij.at(j), ij, usedRank);
+          if(isMyRank(ij) && !Uij[j].size())
+            Uij[j] = Matrix(blockSize(i), blockSize(j));
+          reduceSum(Uij[j], ij, usedRank);
         });
 
         // free row elements
@@ -1036,8 +1717,8 @@ void MatrixDistributed::cholesky2SparseInverse(Bool timing)
           if(isMyRank(ij))
           {
             _N[ii].setType(Matrix::GENERAL);
-            matMult(1.0, Uij.at(j), _N[ij].trans(), _N[ii]);
-            _N[ij] = Uij.at(j);
+            matMult(1.0, Uij[j], _N[ij].trans(), _N[ii]);
+            _N[ij] = Uij[j];
           }
         });
 
@@ -1059,6 +1740,8 @@ void MatrixDistributed::reorder(const std::vector<UInt> &index, const std::vecto
 {
   try
   {
+    GROOPS_MEMORY_CATEGORY("normals blocks")
+    GROOPS_PROFILE("MatrixDistributed::reorder")
     if(index.size() != blockIndexNew.back())
       throw(Exception("index and blockIndex do not match."));
 
@@ -1091,62 +1774,99 @@ void MatrixDistributed::reorder(const std::vector<UInt> &index, const std::vecto
     };
     // ----------------------------
 
-    UInt idxRowStart = 0;
-    UInt idxRowEnd   = 0;
+    // idx range of each old block row
+    std::vector<UInt> idxBlock(blockCount()+1, idx.size());
+    for(UInt i=blockCount(); i-->0;)
+      idxBlock.at(i) = std::distance(idx.begin(), std::lower_bound(idx.begin(), idx.begin()+idxBlock.at(i+1), i, [](const std::array<UInt,4> &a, UInt i){return a[0] < i;}));
+
+    // calls func(ik, ikNew, rowOld, colOld, rows, cols, row, col, transpose) for all continuous pieces of old block (i,k)
+    // in the same order at all processes
+    auto forEachPiece = [&](UInt i, UInt k, UInt ik, auto func)
+    {
+      UInt rows, cols;
+      for(UInt z=idxBlock.at(i); z<idxBlock.at(i+1); z+=rows)
+      {
+        const UInt iNew = idx.at(z)[2];
+        const UInt row  = idx.at(z)[3];
+        rows = continuousRange(z);
+        for(UInt s=((i==k) ? z : idxBlock.at(k)); s<idxBlock.at(k+1); s+=cols)
+        {
+          const UInt kNew = idx.at(s)[2];
+          const UInt col  = idx.at(s)[3];
+          cols = continuousRange(s);
+          if((iNew > kNew) || ((iNew == kNew) && (row > col))) // transpose to access upper triangle?
+            func(ik, matrixNew.index(kNew, iNew), idx.at(z)[1], idx.at(s)[1], rows, cols, row, col, TRUE);
+          else
+            func(ik, matrixNew.index(iNew, kNew), idx.at(z)[1], idx.at(s)[1], rows, cols, row, col, FALSE);
+        }
+      }
+    };
+
     for(UInt i=0; i<blockCount(); i++)   // loop over all block rows
     {
-      idxRowStart = std::distance(idx.begin(), std::lower_bound(idx.begin()+idxRowEnd,   idx.end(), i, [](const std::array<UInt,4> &a, UInt i){return a[0] < i;}));
-      idxRowEnd   = std::distance(idx.begin(), std::upper_bound(idx.begin()+idxRowStart, idx.end(), i, [](UInt i, const std::array<UInt,4> &a){return i < a[0];}));
+      // new blocks
+      loopBlockRow(i, {i, blockCount()}, [&](UInt k, UInt /*ik*/)
+      {
+        std::set<UInt> blocksRow, blocksCol;
+        for(UInt z=idxBlock.at(i); z<idxBlock.at(i+1); z++)
+          blocksRow.insert(idx.at(z)[2]);
+        for(UInt s=idxBlock.at(k); s<idxBlock.at(k+1); s++)
+          blocksCol.insert(idx.at(s)[2]);
+        for(UInt iNew : blocksRow)
+          for(UInt kNew : blocksCol)
+            matrixNew.setBlock(std::min(iNew, kNew), std::max(iNew, kNew));
+      });
 
+      // copy local pieces and pack the others for the owner of the new block
+      std::vector<std::vector<Double>> send(Parallel::size(comm));
       loopBlockRow(i, {i, blockCount()}, [&](UInt k, UInt ik)
       {
-        const UInt idxColStart = std::distance(idx.begin(), std::lower_bound(idx.begin()+idxRowStart, idx.end(), k, [](const std::array<UInt,4> &a, UInt k){return a[0] < k;}));
-        const UInt idxColEnd   = std::distance(idx.begin(), std::upper_bound(idx.begin()+idxColStart, idx.end(), k, [](UInt k, const std::array<UInt,4> &a){return k < a[0];}));
-
-        // distribute block
-        std::vector<Bool> usedRank(Parallel::size(comm), FALSE);
-        for(UInt z=idxRowStart; z<idxRowEnd; z += continuousRange(z))
-          for(UInt s=((i==k) ? z : idxColStart); s<idxColEnd; s += continuousRange(s))
+        if(!isMyRank(ik))
+          return;
+        forEachPiece(i, k, ik, [&](UInt ik, UInt ikNew, UInt rowOld, UInt colOld, UInt rows, UInt cols, UInt row, UInt col, Bool transpose)
+        {
+          if(matrixNew.isMyRank(ikNew))
           {
-            UInt iNew = idx.at(z)[2];
-            UInt kNew = idx.at(s)[2];
-            if(kNew < iNew)
-              std::swap(iNew, kNew);
-            const UInt ikNew = matrixNew.setBlock(iNew, kNew);
-            usedRank.at(matrixNew._rank[ikNew]) = TRUE;
+            if(transpose)
+              copy(_N[ik].slice(rowOld, colOld, rows, cols), matrixNew._N[ikNew].trans().slice(row, col, rows, cols));
+            else
+              copy(_N[ik].slice(rowOld, colOld, rows, cols), matrixNew._N[ikNew].slice(row, col, rows, cols));
+            return;
           }
-        broadCast(_N[ik], ik, usedRank);
+          std::vector<Double> &buffer = send.at(matrixNew._rank[ikNew]);
+          for(UInt s=0; s<cols; s++)
+            buffer.insert(buffer.end(), _N[ik].field()+(colOld+s)*_N[ik].ld()+rowOld, _N[ik].field()+(colOld+s)*_N[ik].ld()+rowOld+rows);
+        });
+        _N[ik] = Matrix();
+      });
 
-        // copy elements
-        UInt rows, cols;
-        if(usedRank.at(Parallel::myRank(comm)))
-          for(UInt z=idxRowStart; z<idxRowEnd; z+=rows)
-          {
-            UInt iNew = idx.at(z)[2];
-            UInt row  = idx.at(z)[3];
-            rows = continuousRange(z);
-            for(UInt s=((i==k) ? z : idxColStart); s<idxColEnd; s += cols)
-            {
-              UInt kNew = idx.at(s)[2];
-              UInt col  = idx.at(s)[3];
-              cols = continuousRange(s);
-              if((iNew > kNew) || ((iNew == kNew) && (row > col))) // transpose to access upper triangle?
-              {
-                const UInt kiNew = matrixNew.index(kNew, iNew);
-                if(matrixNew.isMyRank(kiNew))
-                  copy(_N[ik].slice(idx.at(z)[1], idx.at(s)[1], rows, cols), matrixNew._N[kiNew].trans().slice(row, col, rows, cols));
-              }
-              else
-              {
-                const UInt ikNew = matrixNew.index(iNew, kNew);
-                if(matrixNew.isMyRank(ikNew))
-                  copy(_N[ik].slice(idx.at(z)[1], idx.at(s)[1], rows, cols), matrixNew._N[ikNew].slice(row, col, rows, cols));
-              }
-            }
-          }
+      if(Parallel::size(comm) < 2)
+        continue;
+      std::vector<std::vector<Double>> receive = Parallel::allToAll(send, comm);
+      send.clear();
 
-        _N[ik] = Matrix();
-      }); // for(block[ik])
+      // unpack pieces from other processes
+      std::vector<UInt> pos(Parallel::size(comm), 0);
+      loopBlockRow(i, {i, blockCount()}, [&](UInt k, UInt ik)
+      {
+        if(isMyRank(ik))
+          return;
+        forEachPiece(i, k, ik, [&](UInt ik, UInt ikNew, UInt /*rowOld*/, UInt /*colOld*/, UInt rows, UInt cols, UInt row, UInt col, Bool transpose)
+        {
+          if(!matrixNew.isMyRank(ikNew))
+            return;
+          const UInt p = _rank[ik];
+          Matrix &N = matrixNew._N[ikNew];
+          const Double *buffer = receive.at(p).data()+pos.at(p);
+          for(UInt s=0; s<cols; s++)
+            for(UInt z=0; z<rows; z++)
+              if(transpose)
+                N(col+s, row+z) = *buffer++;
+              else
+                N(row+z, col+s) = *buffer++;
+          pos.at(p) += rows*cols;
+        });
+      });
     } // for(block row i)
 
     *this = matrixNew;
@@ -1159,6 +1879,104 @@ void MatrixDistributed::reorder(const std::vector<UInt> &index, const std::vecto
 
 /***********************************************/
 
+std::vector<UInt> MatrixDistributed::minimumDegreeOrder(UInt startBlock, UInt countBlock) const
+{
+  try
+  {
+    GROOPS_PROFILE("MatrixDistributed::minimumDegreeOrder")
+    const UInt endBlock = std::min(startBlock+countBlock, blockCount());
+
+    // block graph (blocks before startBlock are not considered)
+    std::vector<std::set<UInt>> adjacent(blockCount());
+    for(UInt i=startBlock; i<blockCount(); i++)
+      loopBlockRow(i, {i+1, blockCount()}, [&](UInt k, UInt /*ik*/)
+      {
+        adjacent[i].insert(k);
+        adjacent[k].insert(i);
+      });
+
+    // degree: number of parameters of the adjacent blocks (columns of the dgemm updates)
+    std::vector<UInt> degree(blockCount(), 0);
+    std::set<std::pair<UInt, UInt>> queue; // {degree, block}, ties in original order
+    auto computeDegree = [&](UInt i)
+    {
+      degree[i] = 0;
+      for(UInt k : adjacent[i])
+        degree[i] += blockSize(k);
+    };
+    for(UInt i=startBlock; i<endBlock; i++)
+    {
+      computeDegree(i);
+      queue.insert({degree[i], i});
+    }
+
+    std::vector<UInt> order(blockCount());
+    std::iota(order.begin(), order.end(), 0);
+    for(UInt idx=startBlock; idx<endBlock; idx++)
+    {
+      const UInt i = queue.begin()->second;
+      queue.erase(queue.begin());
+      order.at(idx) = i;
+
+      // symbolic elimination: neighbors become a clique (fill blocks)
+      const std::vector<UInt> neighbors(adjacent[i].begin(), adjacent[i].end());
+      for(UInt k : neighbors)
+        adjacent[k].erase(i);
+      for(UInt z=0; z<neighbors.size(); z++)
+        for(UInt s=z+1; s<neighbors.size(); s++)
+        {
+          adjacent[neighbors[z]].insert(neighbors[s]);
+          adjacent[neighbors[s]].insert(neighbors[z]);
+        }
+      adjacent[i].clear();
+
+      for(UInt k : neighbors)
+        if(k < endBlock)
+        {
+          queue.erase({degree[k], k});
+          computeDegree(k);
+          queue.insert({degree[k], k});
+        }
+    }
+
+    return order;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+std::vector<UInt> MatrixDistributed::reorderBlocks(const std::vector<UInt> &blockOrder)
+{
+  try
+  {
+    if(blockOrder.size() != blockCount())
+      throw(Exception("blockOrder ("+blockOrder.size()%"%i) does not match block count ("s+blockCount()%"%i)."s));
+
+    std::vector<UInt> index;
+    std::vector<UInt> blockIndexNew(1, 0);
+    index.reserve(parameterCount());
+    for(UInt i : blockOrder)
+    {
+      for(UInt k=0; k<blockSize(i); k++)
+        index.push_back(blockIndex(i)+k);
+      blockIndexNew.push_back(index.size());
+    }
+
+    reorder(index, blockIndexNew, calcRank);
+    return index;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 std::vector<UInt> MatrixDistributed::computeBlockIndex(UInt parameterCount, UInt blockSize)
 {
   if(parameterCount==0)
@@ -1175,3 +1993,91 @@ std::vector<UInt> MatrixDistributed::computeBlockIndex(UInt parameterCount, UInt
 }
 
 /***********************************************/
+
+std::vector<UInt> MatrixDistributed::estimateMemory(const std::vector<UInt> &blockIndex, UInt processCount, std::function<UInt(UInt, UInt, UInt)> calcRank)
+{
+  try
+  {
+    if(calcRank == nullptr)
+      calcRank = calculateRankBlockCyclic;
+    std::vector<UInt> bytes(std::max(processCount, UInt(1)), 0);
+    for(UInt i=0; i+1<blockIndex.size(); i++)
+      for(UInt k=i; k+1<blockIndex.size(); k++)
+        bytes.at(calcRank(i, k, bytes.size())) += (blockIndex.at(i+1)-blockIndex.at(i)) * (blockIndex.at(k+1)-blockIndex.at(k)) * sizeof(Double);
+    return bytes;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+UInt MatrixDistributed::autotuneBlockSize(UInt parameterCount, Parallel::CommunicatorPtr comm)
+{
+  try
+  {
+    static std::map<UInt, Double> flopRate; // block size -> flops/second of a panel
+
+    UInt blockSize = 2048;
+    if(Parallel::isMaster(comm))
+    {
+      const Double n = static_cast<Double>(parameterCount);
+      std::vector<UInt> candidates;
+      for(UInt b=128; b<=4096; b*=2)
+        if(7./3.*b*b*b <= 0.01*n*n*n/3) // benchmark effort
+          candidates.push_back(b);
+
+      if(candidates.size() > 1)
+      {
+        Double timeBest = 0;
+        for(UInt b : candidates)
+        {
+          if(!flopRate.count(b))
+          {
+            // one panel: cholesky of diagonal block, triangular solve and rank-k update of an off-diagonal block
+            Matrix A(b, b), N0(b, Matrix::SYMMETRIC);
+            for(UInt z=0; z<b; z++)
+              for(UInt s=0; s<b; s++)
+                A(z,s) = std::sin(1.+z+3.*s);
+            for(UInt z=0; z<b; z++)
+              N0(z,z) = b;
+            UInt   count = 0;
+            Double time  = 0;
+            while(time < 0.05)
+            {
+              Matrix W = N0, B = A, C(b, Matrix::SYMMETRIC);
+              const auto start = std::chrono::steady_clock::now();
+              ::cholesky(W);
+              ::triangularSolve(1., W.trans(), B);
+              ::rankKUpdate(-1., B, C);
+              time += std::chrono::duration<Double>(std::chrono::steady_clock::now()-start).count();
+              count++;
+            }
+            flopRate[b] = count*(1./3.+1.+1.)*b*b*b/time;
+          }
+
+          // sequential chain of diagonal blocks and parallel work on the remaining blocks
+          const Double blockCount = std::ceil(n/b);
+          const Double workers    = std::min(static_cast<Double>(Parallel::size(comm)*Parallel::threadCount()), blockCount*(blockCount+1)/2);
+          const Double time       = (n*n*n/3/workers + blockCount*(4./3.)*b*b*b)/flopRate.at(b);
+          if((timeBest == 0) || (time < timeBest))
+          {
+            timeBest  = time;
+            blockSize = b;
+          }
+        }
+        logInfo<<"  autotuned block size: "<<blockSize<<Log::endl;
+      }
+    }
+    Parallel::broadCast(blockSize, 0, comm);
+    return blockSize;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
@@ -22,6 +22,8 @@
 
 /** @brief Representation of a positve definte matrix in distributed memory
 * All algorithms operate only on the upper triangle of the matrix.
+* Within each process the independent block operations of one step (e.g. the updates of a block row
+* in the Cholesky decomposition) are computed in parallel threads (see Parallel::threadLoop).
 * @ingroup parallelGroup */
 class MatrixDistributed
 {
@@ -65,6 +67,14 @@ class MatrixDistributed
   void triangularTransSolve(std::vector<Matrix> &x) {triangularTransSolve(x, 0, blockCount(), TRUE);}
   void triangularTransSolve(std::vector<Matrix> &x, UInt startBlock, UInt countBlock, Bool collect);
 
+  // mixed precision solve
+  std::vector<std::vector<Float>> _W; // single precision Cholesky factor, unorderd list of used blocks (same as _N)
+  void   broadCastSingle(std::vector<Float> &x, UInt size, UInt idx, const std::vector<Bool> &usedRank);
+  void   choleskySingle(Bool timing);
+  void   triangularTransSolveSingle(std::vector<Matrix> &x);
+  void   triangularSolveSingle(std::vector<Matrix> &x);
+  Bool   solveMixedPrecision(const_MatrixSliceRef n, Matrix &x, Bool timing);
+
 public:
   /// Default constructor.
   MatrixDistributed();
@@ -113,6 +123,11 @@ public:
   * @param count number of rows/columns to remove  */
   void eraseBlocks(UInt startIndex, UInt count=1);
 
+  /** @brief Removes all off-diagonal blocks containing only zeros.
+  * The sparse block structure is exploited by the following operations (e.g. in the Cholesky decomposition).
+  * This function must be called by all processes within the communcator in the matrix! */
+  void eraseZeroBlocks();
+
   // =========================================
 
   Parallel::CommunicatorPtr communicator() const {return comm;}
@@ -134,10 +149,19 @@ public:
   /// Fill all matrix blocks with zero.
   void setNull();
 
+  /** @brief Adds @a factor * A^T A to the blocks of the upper triangle.
+  * The columns of @a A correspond to the parameters @a startIndex ... @a startIndex+A.columns()-1.
+  * The affected blocks must be allocated in the calling process (e.g. accumulation of normals before reduceSum()).
+  * The independent block updates are computed in parallel threads (see Parallel::threadLoop).
+  * Column blocks of @a A which are strictly zero are skipped (block-sparse design matrices). */
+  void rankKUpdate(Double factor, const_MatrixSliceRef A, UInt startIndex=0);
+
   /// Reduce block (@a i, @a k) on its parent process. After the operation, the memory on all other processes is freed.
   void reduceSum(UInt i, UInt k);
 
-  /// Reduce all assigned blocks of the matrix on their parent processes. After the operation, the memory on all other processes is freed.
+  /** @brief Reduce all assigned blocks of the matrix on their parent processes. After the operation, the memory on all other processes is freed.
+  * The blocks are reduced non blocking, several blocks (up to 512 MB) are in flight at the same time.
+  * Blocks without contributions from other processes are skipped. */
   void reduceSum(Bool timing=TRUE);
 
   // =========================================
@@ -153,8 +177,25 @@ public:
 
   /** @brief Solve the system of equations \f$ \mathbf{N}\mathbf{x} = \mathbf{n}\f$
   * Performs @a cholesky, @a triangularTransSolve, and @a triangularSolve.
+  * With @p mixedPrecision the Cholesky decomposition is computed in single precision and the solution
+  * is refined iteratively with residuals computed in double precision. If the refinement does not converge
+  * (e.g. ill-conditioned matrix) the system is solved in double precision instead.
+  * Afterwards the matrix contains the Cholesky decomposition in both cases, but in the mixed precision case
+  * with single precision accuracy only.
+  * The input must be valid at master only. Output is valid at master only. */
+  Matrix solve(const_MatrixSliceRef n, Bool timing=TRUE, Bool mixedPrecision=FALSE);
+
+  /** @brief Solve the system of equations \f$ \mathbf{N}\mathbf{x} = \mathbf{n}\f$ with preconditioned conjugate gradients.
+  * The matrix is not changed, only products \f$ \mathbf{N}\mathbf{p}\f$ are computed.
+  * The Cholesky decompositions of the diagonal blocks are used as block diagonal preconditioner.
+  * Each column of @a n is solved independently. The iteration stops if the residual norms
+  * of all columns are reduced by the factor @p threshold or after @p maxIter iterations.
   * The input must be valid at master only. Output is valid at master only. */
-  Matrix solve(const_MatrixSliceRef n, Bool timing=TRUE);
+  Matrix solveConjugateGradient(const_MatrixSliceRef n, UInt maxIter, Double threshold, Bool timing=TRUE);
+
+  /** @brief Product \f$ \mathbf{N}\mathbf{x}\f$ with the symmetric matrix.
+  * The input must be valid at master only. Output is valid at master only. */
+  Matrix multiply(const_MatrixSliceRef x);
 
   /** @brief Solve a triangular system of equations \f$ \mathbf{W}\mathbf{y} = \mathbf{x}\f$
   * \f$ \mathbf{W} \f$ is assumed to be an upper triangular matrix.
@@ -188,12 +229,42 @@ public:
   * @param calcRank: function handler to determine the process rank of block(i,k) (default: block cyclic distribution). */
   void reorder(const std::vector<UInt> &index, const std::vector<UInt> &blockIndex, std::function<UInt(UInt, UInt, UInt)> calcRank=nullptr);
 
+  /** @brief Fill reducing order of blocks for the Cholesky decomposition (minimum degree at block level).
+  * Computed from the sparse block structure only (symbolic elimination of the block graph).
+  * The blocks within [@a startBlock, @a startBlock+@a countBlock) are reordered, all other blocks keep their position.
+  * The result is the same at all processes.
+  * @return new block i is old block order.at(i). */
+  std::vector<UInt> minimumDegreeOrder(UInt startBlock=0, UInt countBlock=MAX_UINT) const;
+
+  /** @brief Reorder complete blocks, e.g. with @a blockOrder from @ref minimumDegreeOrder.
+  * This function must be called by all processes within the communcator in the matrix!
+  * @param blockOrder new block i is old block blockOrder.at(i)
+  * @return indices of the original parameters in the reordered matrix (see @ref reorder). */
+  std::vector<UInt> reorderBlocks(const std::vector<UInt> &blockOrder);
+
   // =========================================
 
   /** @brief Compute boundary indices for distributed blocks from parameter count and block size.
   * If blockSize is zero, the matrix consists of a single block. */
   static std::vector<UInt> computeBlockIndex(UInt parameterCount, UInt blockSize=2048);
 
+  /** @brief Block size with the shortest estimated Cholesky decomposition on this machine and process layout.
+  * The throughput of a block panel (cholesky, triangularSolve, and rank-k update of one block)
+  * is measured for candidate block sizes at master. The runtime is estimated from the throughput,
+  * the number of processes and threads which can work on different blocks, and the sequential chain of diagonal blocks.
+  * Only block sizes which can be measured with less than 1% of the decomposition effort are tested,
+  * otherwise 2048 is returned. The measured throughputs are kept for further calls.
+  * This function must be called by all processes within @p comm. */
+  static UInt autotuneBlockSize(UInt parameterCount, Parallel::CommunicatorPtr comm);
+
+  /** @brief Estimated memory in bytes at each process of a matrix with all blocks of the upper triangle used, without allocating it.
+  * Helps to choose the block size and the number of processes in advance.
+  * Temporary memory (e.g. local copies of blocks during accumulation before @ref reduceSum) is not included.
+  * @param blockIndex see @ref computeBlockIndex
+  * @param processCount number of processes of the communicator
+  * @param calcRank rank calculation of blocks (default: @ref calculateRankBlockCyclic) */
+  static std::vector<UInt> estimateMemory(const std::vector<UInt> &blockIndex, UInt processCount, std::function<UInt(UInt, UInt, UInt)> calcRank=nullptr);
+
   friend class GnssProcessingStep;
   friend class GnssParametrizationAmbiguities;
 };
@@ -18,6 +18,8 @@
 #include "base/import.h"
 #include "inputOutput/archiveBinary.h"
 #include "inputOutput/logging.h"
+#include "inputOutput/profiler.h"
+#include "parallel/threadPool.h"
 
 /***********************************************/
 
@@ -66,6 +68,10 @@ namespace Parallel
   /** @brief Process index. */
   UInt myRank(CommunicatorPtr comm);
 
+  /** @brief Index of the shared memory node (host) of each process in @a comm.
+  * Nodes are numbered in order of their lowest rank. */
+  std::vector<UInt> nodeIndex(CommunicatorPtr comm);
+
   /** @brief Is ths the master process (rank==0)? */
   inline Bool isMaster(CommunicatorPtr comm) {return (myRank(comm) == 0);}
 
@@ -75,6 +81,10 @@ namespace Parallel
   /** @brief Non blocking check of extra channels. */
   void peek(CommunicatorPtr comm);
 
+  /** @brief Non blocking check whether a message from process with rank @a process is waiting to be received.
+  * If @a process = NULLINDEX then messages from an arbitrary process are checked. */
+  Bool probe(UInt process, CommunicatorPtr comm);
+
   /** @brief Distribute exceptions thrown in @p func by a single node to all nodes.
   * Must be called by every process in @a comm.
   * Exceptions causes memory leaks due to unfinished communications.
@@ -138,6 +148,15 @@ namespace Parallel
   template<> void broadCast(Matrix   &x, UInt process, CommunicatorPtr comm);
   ///@}
 
+  /** @brief Distribute @a x at @a process to all other processes, stored only once per shared memory node.
+  * The elements are placed in a shared memory window (MPI-3) at each node
+  * and the processes of the node map them read-only instead of storing an own copy.
+  * Writing to @a x copies the elements into the private memory of the process (copy on write).
+  * The windows are released at the end of the program.
+  * Without MPI-3 this is the same as broadCast().
+  * Must be called by every process in @a comm. */
+  void broadCastShared(Matrix &x, UInt process, CommunicatorPtr comm);
+
   /** @brief Sum up @a x at all processes (also rank 0) and send the result to @a process. */
   ///@{
   void reduceSum(UInt    &x, UInt process, CommunicatorPtr comm);
@@ -146,6 +165,25 @@ namespace Parallel
   void reduceSum(Matrix  &x, UInt process, CommunicatorPtr comm);
   ///@}
 
+  /** @brief Handle of a non blocking communication. */
+  class Request;
+  typedef std::shared_ptr<Request> RequestPtr;
+
+  /** @brief Non blocking version of reduceSum().
+  * Sum up @a x at all processes (also rank 0) and send the result to @a process.
+  * @a x must not be accessed until wait() is called with the returned request.
+  * Must be called by every process in @a comm in the same order. */
+  RequestPtr reduceSumNonBlocking(Matrix &x, UInt process, CommunicatorPtr comm);
+
+  /** @brief Blocks until the non blocking communication @a request is completed. */
+  void wait(RequestPtr request);
+
+  /** @brief Sparse all-to-all exchange.
+  * @a send.at(p) is sent to process p, the data received from process p is returned at index p.
+  * The own entry is not transmitted. The sizes are exchanged beforehand and only non-empty messages are sent.
+  * Must be called by every process in @a comm. */
+  std::vector<std::vector<Double>> allToAll(const std::vector<std::vector<Double>> &send, CommunicatorPtr comm);
+
   /** @brief Find min/max of @a x at all processes (also rank 0) and send the result to @a process. */
   ///@{
   void reduceMin(UInt   &x, UInt process, CommunicatorPtr comm);
@@ -154,30 +192,42 @@ namespace Parallel
   void reduceMax(Double &x, UInt process, CommunicatorPtr comm);
   ///@}
 
+  /** @brief Log the load balance of a parallel loop if profiling is enabled.
+  * @a busySeconds is the time spent in the loop function at this process, @a loopSeconds the duration of the loop.
+  * Logs the max/mean ratio of the busy times and the process with the largest busy time at master.
+  * Must be called by every process in @a comm. */
+  void logLoadImbalance(Double busySeconds, Double loopSeconds, CommunicatorPtr comm);
+
   // =========================================================
 
   /** @brief Parallelized loop.
   * Calls @a func(i) for every @a i in [0,count).
-  * The different calls are distributed other the processes (without master).
+  * The different calls are distributed in blocks other the processes.
+  * The master computes as well if no process is waiting for work.
   * @return The process number for @a i is returned (valid at master). */
   template<typename T> std::vector<UInt> forEach(UInt count, T func, CommunicatorPtr comm, Bool timing=TRUE);
 
   /** @brief Parallelized loop.
   * Calls @a vec[i]=func(i) for every @a i in [0,vec.size()).
-  * The different calls are distributed other the processes (without master).
+  * The different calls are distributed in blocks other the processes.
+  * The master computes as well if no process is waiting for work.
   * The result in @a vec is only valid at master.
   * @return The process number for @a i is returned (valid at master). */
   template<typename A, typename T> std::vector<UInt> forEach(std::vector<A> &vec, T func, CommunicatorPtr comm, Bool timing=TRUE);
 
   /** @brief Parallelized loop.
   * Calls @a func(i) for every @a i in [0,count).
-  * The different calls are distributed other the processes (without master).
+  * The different calls are distributed in blocks other the processes,
+  * each process stays in an @a interval as long as possible.
+  * The master computes as well if no process is waiting for work.
   * @return The process number for @a i is returned (valid at master). */
   template<typename T> std::vector<UInt> forEachInterval(UInt count, const std::vector<UInt> &interval, T func, CommunicatorPtr comm, Bool timing=TRUE);
 
   /** @brief Parallelized loop.
   * Calls @a vec[i]=func(i) for every @a i in [0,vec.size()).
-  * The different calls are distributed other the processes (without master).
+  * The different calls are distributed in blocks other the processes,
+  * each process stays in an @a interval as long as possible.
+  * The master computes as well if no process is waiting for work.
   * The result in @a vec is only valid at master.
   * @return The process number for @a i is returned (valid at master). */
   template<typename A, typename T> std::vector<UInt> forEachInterval(std::vector<A> &vec, const std::vector<UInt> &interval, T func, CommunicatorPtr comm, Bool timing=TRUE);
@@ -193,6 +243,27 @@ namespace Parallel
   * The different calls are distributed using @a processNo (without master).
   * The result in @a vec is only valid at master. */
   template<typename A, typename T> void forEachProcess(std::vector<A> &vec, T func, const std::vector<UInt> &processNo, CommunicatorPtr comm, Bool timing=TRUE);
+
+  /** @brief Parallelized loop (hybrid: processes and threads).
+  * Calls @a func(i) for every @a i in [0,count).
+  * Blocks of loop numbers are distributed other the processes (without master)
+  * and each block is computed by the threadCount() threads of the process (see threadLoop()).
+  * The threads share the memory of the process, e.g. read-only models.
+  * @a func must be thread safe.
+  * @return The process number for @a i is returned (valid at master). */
+  template<typename T> std::vector<UInt> forEachThread(UInt count, T func, CommunicatorPtr comm, Bool timing=TRUE);
+
+  /** @brief Parallelized loop (hybrid: processes and threads).
+  * Calls @a vec[i]=func(i) for every @a i in [0,vec.size()).
+  * Blocks of loop numbers are distributed other the processes (without master)
+  * and each block is computed by the threadCount() threads of the process (see threadLoop()).
+  * The threads share the memory of the process, e.g. read-only models.
+  * @a func must be thread safe.
+  * The result in @a vec is only valid at master.
+  * @return The process number for @a i is returned (valid at master). */
+  template<typename A, typename T> std::vector<UInt> forEachThread(std::vector<A> &vec, T func, CommunicatorPtr comm, Bool timing=TRUE);
+
+  class LoopScheduler;
 } // end namespace Parallel
 
 /***********************************************/
@@ -206,6 +277,35 @@ namespace Single
   template<typename T> void forEach(UInt count, T func, Bool timing=TRUE);
 } // end namespace Single
 
+/***********************************************/
+
+/** @brief Distribution of loop numbers in blocks (guided self-scheduling).
+* Used in Parallel::forEachInterval and Parallel::forEachThread.
+* The block size decreases with the remaining loop numbers.
+* A process stays in its interval as long as possible,
+* afterwards it continues in an unused interval or in the interval with the most remaining loop numbers.
+* @ingroup parallelGroup */
+class Parallel::LoopScheduler
+{
+  std::vector<UInt> interval, countInInterval, processedInterval;
+  std::set<std::pair<UInt, UInt>> started; // (remaining loop numbers, idInterval) of started intervals
+  UInt nextUnused, left, processCount;
+
+  UInt leftInInterval(UInt id) const {return interval.at(id+1)-interval.at(id)-countInInterval.at(id);}
+
+public:
+  LoopScheduler(const std::vector<UInt> &interval, UInt processCount);
+
+  /** @brief Should the master compute further loop numbers itself?
+  * Near the end of the loop the master only distributes to avoid waiting processes. */
+  Bool masterMayCompute() const {return left > 2*processCount;}
+
+  /** @brief Next block of loop numbers [@a start, @a start+@a blockSize) for @a process.
+  * The block contains at least @a minSize loop numbers (if available).
+  * @a blockSize is zero if all loop numbers are distributed. */
+  void next(UInt process, UInt minSize, UInt &start, UInt &blockSize);
+};
+
 /***********************************************/
 /***** INLINES ***********************************/
 /***********************************************/
@@ -274,6 +374,44 @@ inline void Parallel::broadCast(T &x, UInt process, CommunicatorPtr comm)
 /***********************************************/
 /***********************************************/
 
+inline Parallel::LoopScheduler::LoopScheduler(const std::vector<UInt> &interval_, UInt processCount_)
+  : interval(interval_), countInInterval(interval_.size()-1, 0), processedInterval(processCount_, NULLINDEX),
+    nextUnused(0), left(interval_.back()-interval_.front()), processCount(processCount_)
+{
+}
+
+/***********************************************/
+
+inline void Parallel::LoopScheduler::next(UInt process, UInt minSize, UInt &start, UInt &blockSize)
+{
+  start = blockSize = 0;
+  if(left == 0)
+    return;
+
+  // can we compute in the same interval?
+  UInt idInterval = processedInterval.at(process);
+  if((idInterval == NULLINDEX) || (leftInInterval(idInterval) == 0))
+  {
+    // search an unused interval
+    while((nextUnused < countInInterval.size()) && (countInInterval.at(nextUnused) || !leftInInterval(nextUnused)))
+      nextUnused++;
+    // otherwise the interval with the most loop numbers left
+    idInterval = (nextUnused < countInInterval.size()) ? nextUnused : started.rbegin()->second;
+    processedInterval.at(process) = idInterval;
+  }
+
+  const UInt leftOld = leftInInterval(idInterval);
+  start     = interval.at(idInterval) + countInInterval.at(idInterval);
+  blockSize = std::min(leftOld, std::max(std::max(minSize, UInt(1)), left/(2*processCount)));
+  countInInterval.at(idInterval) += blockSize;
+  left -= blockSize;
+  started.erase({leftOld, idInterval});
+  if(leftOld > blockSize)
+    started.insert({leftOld-blockSize, idInterval});
+}
+
+/***********************************************/
+
 template<typename T>
 inline std::vector<UInt> Parallel::forEach(UInt count, T func, CommunicatorPtr comm, Bool timing)
 {
@@ -320,74 +458,65 @@ inline std::vector<UInt> Parallel::forEachInterval(UInt count, const std::vector
 
     // parallel version
     // ----------------
+    const Double loopStart = Profiler::seconds();
+    Double busy = 0; // time spent in func
     if(isMaster(comm))
     {
-      std::vector<UInt> countInInterval(interval.size()-1, 0);
-      std::vector<UInt> processedInterval(size(comm), NULLINDEX);
-
-      // master distributes the loop numbers
-      UInt process, index;
+      // master distributes blocks of loop numbers
+      // and computes itself if no process is waiting
+      LoopScheduler scheduler(interval, size(comm));
+      UInt process, start, blockSize, computed = 0;
       if(timing) Log::startTimer();
-      for(UInt i=0; i<count; i++)
+      for(UInt finished=0; finished<size(comm)-1;)
       {
-        receive(process, NULLINDEX, comm); // which process needs work?
-        receive(index,   process, comm);  // loop numer be computed at process
-
-        // can we compute func in the same interval?
-        UInt idInterval = processedInterval.at(process);
-        if((idInterval==NULLINDEX) || (countInInterval.at(idInterval) >= interval.at(idInterval+1)-interval.at(idInterval)))
+        if(scheduler.masterMayCompute() && !probe(NULLINDEX, comm))
         {
-          // search new interval to compute
-          UInt maxLeft = 0;
-          for(UInt k=0; k<countInInterval.size(); k++)
-          {
-            UInt left = interval.at(k+1)-interval.at(k)-countInInterval.at(k);
-            // interval not used?
-            if((countInInterval.at(k) == 0) && (left>0))
-            {
-              idInterval = k;
-              break;
-            }
-            if(left>maxLeft)
-            {
-              maxLeft = left;
-              idInterval = k;
-            }
-          }
-          processedInterval.at(process) = idInterval;
+          scheduler.next(0, 1, start, blockSize);
+          std::fill(processNo.begin()+start, processNo.begin()+start+blockSize, 0);
+          busy -= Profiler::seconds();
+          for(UInt i=start; i<start+blockSize; i++)
+            func(i);
+          busy += Profiler::seconds();
+          if(timing) Log::loopTimer(computed+blockSize-1, count, size(comm));
+          computed += blockSize;
+          continue;
         }
 
-        UInt id = interval.at(idInterval) + countInInterval.at(idInterval);
-        countInInterval.at(idInterval)++;
-        send(id, process, comm);       // send new loop number to be computed at process
-        processNo.at(id) = process;
-        if(timing) Log::loopTimer(i, count, size(comm)-1);
-      }
-      // send to all processes the end signal (NULLINDEX)
-      for(UInt i=1; i<size(comm); i++)
-      {
-        receive(process, NULLINDEX, comm); // which process needs work?
-        receive(index,   process, comm);  // loop numer be computed at process
-        send(NULLINDEX, process, comm);    // end signal
+        receive(process,   NULLINDEX, comm); // which process needs work?
+        receive(start,     process,   comm); // block computed at process
+        receive(blockSize, process,   comm);
+        if(timing && blockSize) Log::loopTimer(computed+blockSize-1, count, size(comm));
+        computed += blockSize;
+
+        scheduler.next(process, 1, start, blockSize);
+        send(start,     process, comm);      // send new block of loop numbers
+        send(blockSize, process, comm);      // empty block is the end signal
+        std::fill(processNo.begin()+start, processNo.begin()+start+blockSize, process);
+        if(blockSize == 0)
+          finished++;
       }
       if(timing) Log::loopTimerEnd(count);
     }
     else // clients
     {
-      send(myRank(comm), 0, comm);
-      send(NULLINDEX, 0, comm); // no results computed yet
+      UInt start = 0, blockSize = 0; // no results computed yet
       for(;;)
       {
-        UInt i;
-        receive(i,0, comm);
-        if(i==NULLINDEX)
-          break;
-        func(i);
         send(myRank(comm), 0, comm);
-        send(i, 0, comm);
+        send(start,        0, comm);
+        send(blockSize,    0, comm);
+        receive(start,     0, comm);
+        receive(blockSize, 0, comm);
+        if(blockSize == 0)
+          break;
+        busy -= Profiler::seconds();
+        for(UInt i=start; i<start+blockSize; i++)
+          func(i);
+        busy += Profiler::seconds();
       }
     }
 
+    logLoadImbalance(busy, Profiler::seconds()-loopStart, comm);
     broadCast(processNo, 0, comm);
     return processNo;
   }
@@ -429,81 +558,69 @@ inline std::vector<UInt> Parallel::forEachInterval(std::vector<A> &vec, const st
 
     // parallel version
     // ----------------
+    const Double loopStart = Profiler::seconds();
+    Double busy = 0; // time spent in func
     if(isMaster(comm))
     {
-      std::vector<UInt> countInInterval(interval.size()-1, 0);
-      std::vector<UInt> processedInterval(size(comm), NULLINDEX);
-
-      // master distributes the loop numbers
-      UInt process, index;
+      // master distributes blocks of loop numbers
+      // and computes itself if no process is waiting
+      LoopScheduler scheduler(interval, size(comm));
+      UInt process, start, blockSize, computed = 0;
       if(timing) Log::startTimer();
-      for(UInt i=0; i<vec.size(); i++)
+      for(UInt finished=0; finished<size(comm)-1;)
       {
-        receive(process, NULLINDEX, comm); // which process needs work?
-        receive(index,   process, comm);  // loop numer be computed at process
-        if(index!=NULLINDEX)
+        if(scheduler.masterMayCompute() && !probe(NULLINDEX, comm))
         {
-          receive(vec[index], process, comm); // receive result
+          scheduler.next(0, 1, start, blockSize);
+          std::fill(processNo.begin()+start, processNo.begin()+start+blockSize, 0);
+          busy -= Profiler::seconds();
+          for(UInt i=start; i<start+blockSize; i++)
+            vec[i] = func(i);
+          busy += Profiler::seconds();
+          if(timing) Log::loopTimer(computed+blockSize-1, vec.size(), size(comm));
+          computed += blockSize;
+          continue;
         }
 
-        // can we compute func in the same interval?
-        UInt idInterval = processedInterval.at(process);
-        if((idInterval==NULLINDEX) || (countInInterval.at(idInterval) >= interval.at(idInterval+1)-interval.at(idInterval)))
-        {
-          // search new interval to compute
-          UInt maxLeft = 0;
-          for(UInt k=0; k<countInInterval.size(); k++)
-          {
-            UInt left = interval.at(k+1)-interval.at(k)-countInInterval.at(k);
-            // interval not used?
-            if((countInInterval.at(k) == 0) && (left>0))
-            {
-              idInterval = k;
-              break;
-            }
-            if(left>maxLeft)
-            {
-              maxLeft = left;
-              idInterval = k;
-            }
-          }
-          processedInterval.at(process) = idInterval;
-        }
-
-        UInt id = interval.at(idInterval) + countInInterval.at(idInterval);
-        countInInterval.at(idInterval)++;
-        send(id, process, comm);           // send new loop number to be computed at process
-        processNo.at(id) = process;
-        if(timing) Log::loopTimer(i, vec.size(), size(comm)-1);
-      }
-      // send to all processes the end signal (NULLINDEX)
-      for(UInt i=1; i<size(comm); i++)
-      {
-        receive(process, NULLINDEX, comm);    // which process needs work?
-        receive(index,   process, comm);      // loop numer be computed at process
-        if(index!=NULLINDEX)
-          receive(vec[index], process, comm); // receive result
-        send(NULLINDEX, process, comm);       // end signal
+        receive(process,   NULLINDEX, comm); // which process needs work?
+        receive(start,     process,   comm); // block computed at process
+        receive(blockSize, process,   comm);
+        for(UInt i=start; i<start+blockSize; i++)
+          receive(vec[i], process, comm);    // receive results
+        if(timing && blockSize) Log::loopTimer(computed+blockSize-1, vec.size(), size(comm));
+        computed += blockSize;
+
+        scheduler.next(process, 1, start, blockSize);
+        send(start,     process, comm);      // send new block of loop numbers
+        send(blockSize, process, comm);      // empty block is the end signal
+        std::fill(processNo.begin()+start, processNo.begin()+start+blockSize, process);
+        if(blockSize == 0)
+          finished++;
       }
       if(timing) Log::loopTimerEnd(vec.size());
     }
     else // clients
     {
-      send(myRank(comm), 0, comm);
-      send(NULLINDEX, 0, comm); // no results computed yet
+      UInt start = 0, blockSize = 0; // no results computed yet
       for(;;)
       {
-        UInt i;
-        receive(i,0, comm);
-        if(i==NULLINDEX)
-          break;
-        vec[i] = func(i);
         send(myRank(comm), 0, comm);
-        send(i, 0, comm);
-        send(vec[i], 0, comm);
+        send(start,        0, comm);
+        send(blockSize,    0, comm);
+        for(UInt i=start; i<start+blockSize; i++)
+          send(vec[i], 0, comm);
+        receive(start,     0, comm);
+        receive(blockSize, 0, comm);
+        if(blockSize == 0)
+          break;
+        busy -= Profiler::seconds();
+        for(UInt i=start; i<start+blockSize; i++)
+          vec[i] = func(i);
+        busy += Profiler::seconds();
       }
     }
 
+    logLoadImbalance(busy, Profiler::seconds()-loopStart, comm);
     broadCast(processNo, 0, comm);
     return processNo;
   }
@@ -525,13 +642,17 @@ inline void Parallel::forEachProcess(UInt count, T func, const std::vector<UInt>
       procs.insert(p);
 
     UInt idx;
+    const Double loopStart = Profiler::seconds();
+    Double busy = 0; // time spent in func
     if(timing) Log::startTimer();
     for(UInt i=0; i<count; i++)
     {
       if(timing) Log::loopTimer(i, count, procs.size());
       if(myRank(comm) == processNo.at(i))
       {
+        busy -= Profiler::seconds();
         func(i);
+        busy += Profiler::seconds();
         if(!isMaster(comm)) send(i, 0, comm);
       } // if(arcs.at(i))
       else if(isMaster(comm))
@@ -540,6 +661,7 @@ inline void Parallel::forEachProcess(UInt count, T func, const std::vector<UInt>
       }
     } // for(i)
     if(timing) Log::loopTimerEnd(count);
+    logLoadImbalance(busy, Profiler::seconds()-loopStart, comm);
     barrier(comm);
   }
   catch(std::exception &e)
@@ -560,13 +682,17 @@ inline void Parallel::forEachProcess(std::vector<A> &vec, T func, const std::vec
       procs.insert(p);
 
     UInt idx = 0;
+    const Double loopStart = Profiler::seconds();
+    Double busy = 0; // time spent in func
     if(timing) Log::startTimer();
     for(UInt i=0; i<vec.size(); i++)
     {
       if(timing) Log::loopTimer(i, vec.size(), procs.size());
       if(myRank(comm) == processNo.at(i))
       {
+        busy -= Profiler::seconds();
         vec[i] = func(i);
+        busy += Profiler::seconds();
         if(!isMaster(comm)) send(i, 0, comm);
         if(!isMaster(comm)) send(vec[i], 0, comm);
       } // if(arcs.at(i))
@@ -577,6 +703,7 @@ inline void Parallel::forEachProcess(std::vector<A> &vec, T func, const std::vec
       }
     } // for(i)
     if(timing) Log::loopTimerEnd(vec.size());
+    logLoadImbalance(busy, Profiler::seconds()-loopStart, comm);
     barrier(comm);
   }
   catch(std::exception &e)
@@ -585,6 +712,168 @@ inline void Parallel::forEachProcess(std::vector<A> &vec, T func, const std::vec
   }
 }
 
+/***********************************************/
+
+template<typename T>
+inline std::vector<UInt> Parallel::forEachThread(UInt count, T func, CommunicatorPtr comm, Bool timing)
+{
+  try
+  {
+    std::vector<UInt> processNo(count, 0);
+
+    // single process version
+    // ----------------------
+    if(size(comm) < 3)
+    {
+      if(isMaster(comm))
+      {
+        if(timing) Log::startTimer();
+        threadLoop(0, count, func, [&](UInt i) {if(timing) Log::loopTimer(i, count, threadCount());});
+        if(timing) Log::loopTimerEnd(count);
+      }
+      return processNo;
+    }
+
+    // parallel version
+    // ----------------
+    const Double loopStart = Profiler::seconds();
+    Double busy = 0; // time spent in func
+    if(isMaster(comm))
+    {
+      // master distributes blocks of loop numbers
+      LoopScheduler scheduler({0, count}, size(comm));
+      UInt process, start, blockSize, threads, computed = 0;
+      if(timing) Log::startTimer();
+      for(UInt finished=0; finished<size(comm)-1;)
+      {
+        receive(process,   NULLINDEX, comm); // which process needs work?
+        receive(start,     process,   comm); // block computed at process
+        receive(blockSize, process,   comm);
+        receive(threads,   process,   comm); // number of threads at process
+        if(timing && blockSize) Log::loopTimer(computed+blockSize-1, count, (size(comm)-1)*threads);
+        computed += blockSize;
+
+        scheduler.next(process, threads, start, blockSize);
+        send(start,     process, comm);      // send new block of loop numbers
+        send(blockSize, process, comm);      // empty block is the end signal
+        std::fill(processNo.begin()+start, processNo.begin()+start+blockSize, process);
+        if(blockSize == 0)
+          finished++;
+      }
+      if(timing) Log::loopTimerEnd(count);
+    }
+    else // clients
+    {
+      UInt start = 0, blockSize = 0; // no results computed yet
+      for(;;)
+      {
+        send(myRank(comm),  0, comm);
+        send(start,         0, comm);
+        send(blockSize,     0, comm);
+        send(threadCount(), 0, comm);
+        receive(start,     0, comm);
+        receive(blockSize, 0, comm);
+        if(blockSize == 0)
+          break;
+        busy -= Profiler::seconds();
+        threadLoop(start, start+blockSize, func);
+        busy += Profiler::seconds();
+      }
+    }
+
+    logLoadImbalance(busy, Profiler::seconds()-loopStart, comm);
+    broadCast(processNo, 0, comm);
+    return processNo;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+template<typename A, typename T>
+inline std::vector<UInt> Parallel::forEachThread(std::vector<A> &vec, T func, CommunicatorPtr comm, Bool timing)
+{
+  try
+  {
+    std::vector<UInt> processNo(vec.size(), 0);
+
+    // single process version
+    // ----------------------
+    if(size(comm) < 3)
+    {
+      if(isMaster(comm))
+      {
+        if(timing) Log::startTimer();
+        threadLoop(0, vec.size(), [&](UInt i) {vec[i] = func(i);}, [&](UInt i) {if(timing) Log::loopTimer(i, vec.size(), threadCount());});
+        if(timing) Log::loopTimerEnd(vec.size());
+      }
+      return processNo;
+    }
+
+    // parallel version
+    // ----------------
+    const Double loopStart = Profiler::seconds();
+    Double busy = 0; // time spent in func
+    if(isMaster(comm))
+    {
+      // master distributes blocks of loop numbers
+      LoopScheduler scheduler({0, vec.size()}, size(comm));
+      UInt process, start, blockSize, threads, computed = 0;
+      if(timing) Log::startTimer();
+      for(UInt finished=0; finished<size(comm)-1;)
+      {
+        receive(process,   NULLINDEX, comm); // which process needs work?
+        receive(start,     process,   comm); // block computed at process
+        receive(blockSize, process,   comm);
+        for(UInt i=start; i<start+blockSize; i++)
+          receive(vec[i], process, comm);    // receive results
+        receive(threads,   process,   comm); // number of threads at process
+        if(timing && blockSize) Log::loopTimer(computed+blockSize-1, vec.size(), (size(comm)-1)*threads);
+        computed += blockSize;
+
+        scheduler.next(process, threads, start, blockSize);
+        send(start,     process, comm);      // send new block of loop numbers
+        send(blockSize, process, comm);      // empty block is the end signal
+        std::fill(processNo.begin()+start, processNo.begin()+start+blockSize, process);
+        if(blockSize == 0)
+          finished++;
+      }
+      if(timing) Log::loopTimerEnd(vec.size());
+    }
+    else // clients
+    {
+      UInt start = 0, blockSize = 0; // no results computed yet
+      for(;;)
+      {
+        send(myRank(comm), 0, comm);
+        send(start,        0, comm);
+        send(blockSize,    0, comm);
+        for(UInt i=start; i<start+blockSize; i++)
+          send(vec[i], 0, comm);
+        send(threadCount(), 0, comm);
+        receive(start,     0, comm);
+        receive(blockSize, 0, comm);
+        if(blockSize == 0)
+          break;
+        busy -= Profiler::seconds();
+        threadLoop(start, start+blockSize, [&](UInt i) {vec[i] = func(i);});
+        busy += Profiler::seconds();
+      }
+    }
+
+    logLoadImbalance(busy, Profiler::seconds()-loopStart, comm);
+    broadCast(processNo, 0, comm);
+    return processNo;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
 /***********************************************/
 /***********************************************/
 
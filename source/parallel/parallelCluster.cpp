@@ -26,6 +26,11 @@ namespace Parallel
 
 /***********************************************/
 
+/// Minimum message size for hierarchical (node aware) broadcast and reduce.
+constexpr UInt HIERARCHICAL_MIN_BYTES = 1024*1024;
+
+/***********************************************/
+
 inline void check(int errorcode)
 {
   if(errorcode != MPI_SUCCESS)
@@ -37,12 +42,16 @@ inline void check(int errorcode)
   }
 }
 
+
 /***********************************************/
 /***********************************************/
 
 class Mpi
 {
 public:
+  std::vector<MPI_Win>                 windows;      // shared memory windows (see broadCastShared)
+  std::vector<std::shared_ptr<Double>> windowFields; // keeps matrices in windows copy on write
+
   Mpi(int argc, char *argv[])
   {
     int provided;
@@ -51,6 +60,8 @@ public:
 
  ~Mpi()
   {
+    for(MPI_Win &win : windows)
+      MPI_Win_free(&win);
     MPI_Finalize();
   }
 };
@@ -217,6 +228,18 @@ public:
   MPI_Comm             comm;
   std::vector<HiddenChannelPtr> channels;
 
+  // shared memory nodes for hierarchical collectives (initialized at first use)
+  Bool              topologyInit = FALSE;
+  MPI_Comm          commNode     = MPI_COMM_NULL; // processes at the same node
+  MPI_Comm          commLeader   = MPI_COMM_NULL; // lowest rank at each node
+  std::vector<UInt> node;                         // node index of each process
+  std::vector<UInt> localRank;                    // rank within the node of each process
+
+  // shared memory windows (initialized at first use)
+  Bool              sharedInit   = FALSE;
+  CommunicatorPtr   commShared;                   // processes at the same node
+  CommunicatorPtr   commSharedLeader;             // lowest rank at each node
+
   Communicator(CommunicatorPtr commParent, MPI_Comm comm_) : comm(comm_)
   {
     if(commParent)
@@ -228,6 +251,10 @@ public:
 
  ~Communicator()
   {
+    if(commNode != MPI_COMM_NULL)
+      MPI_Comm_free(&commNode);
+    if(commLeader != MPI_COMM_NULL)
+      MPI_Comm_free(&commLeader);
     if((comm != MPI_COMM_WORLD) && (comm != MPI_COMM_SELF) && (comm != MPI_COMM_NULL))
       MPI_Comm_free(&comm);
   }
@@ -313,6 +340,42 @@ inline void Communicator::wait(MPI_Request &request)
 /***********************************************/
 /***********************************************/
 
+// Data volume and duration of a communication operation (if profiling is enabled).
+// Counted per operation type and size of the communicator in the scope of the caller.
+class Statistics
+{
+  Bool        active;
+  std::string name;
+  Double      start;
+
+public:
+  Statistics(const char *operation, UInt count, MPI_Datatype datatype, CommunicatorPtr comm) : active(Profiler::isEnabled())
+  {
+    if(!active)
+      return;
+    int size, typeSize;
+    MPI_Comm_size(comm->comm, &size);
+    MPI_Type_size(datatype, &typeSize);
+    name  = "MPI "s+operation+" ("+size%"%i processes)"s;
+    if(count)
+      Profiler::count((name+" [MB]").c_str(), 1e-6*count*typeSize);
+    start = Profiler::seconds();
+  }
+
+ ~Statistics()
+  {
+    if(active)
+      Profiler::count((name+" [s]").c_str(), Profiler::seconds()-start);
+  }
+};
+
+/***********************************************/
+/***********************************************/
+
+static std::vector<UInt> worldNode; // node of each process in MPI_COMM_WORLD (lowest world rank at the node)
+
+/***********************************************/
+
 CommunicatorPtr init(int argc, char *argv[])
 {
   try
@@ -320,6 +383,21 @@ CommunicatorPtr init(int argc, char *argv[])
     auto mpi = std::make_shared<Mpi>(argc, argv);
     CommunicatorPtr comm = std::make_shared<Communicator>(nullptr, MPI_COMM_WORLD);
     comm->mpi = mpi;
+
+    // shared memory node of each process, identified by the lowest world rank at the node
+    int rank, size, leader;
+    check(MPI_Comm_rank(MPI_COMM_WORLD, &rank));
+    check(MPI_Comm_size(MPI_COMM_WORLD, &size));
+    leader = rank;
+#if MPI_VERSION >= 3
+    MPI_Comm commShared;
+    check(MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &commShared));
+    check(MPI_Allreduce(&rank, &leader, 1, MPI_INT, MPI_MIN, commShared));
+    check(MPI_Comm_free(&commShared));
+#endif
+    std::vector<int> leaders(size);
+    check(MPI_Allgather(&leader, 1, MPI_INT, leaders.data(), 1, MPI_INT, MPI_COMM_WORLD));
+    worldNode.assign(leaders.begin(), leaders.end());
     return comm;
   }
   catch(std::exception &e)
@@ -447,10 +525,79 @@ UInt size(CommunicatorPtr comm)
 
 /***********************************************/
 
+std::vector<UInt> nodeIndex(CommunicatorPtr comm)
+{
+  try
+  {
+    MPI_Group group, groupWorld;
+    check(MPI_Comm_group(comm->comm, &group));
+    check(MPI_Comm_group(MPI_COMM_WORLD, &groupWorld));
+    int count;
+    check(MPI_Group_size(group, &count));
+    std::vector<int> ranks(count), ranksWorld(count);
+    std::iota(ranks.begin(), ranks.end(), 0);
+    check(MPI_Group_translate_ranks(group, count, ranks.data(), groupWorld, ranksWorld.data()));
+    check(MPI_Group_free(&group));
+    check(MPI_Group_free(&groupWorld));
+
+    // nodes numbered in order of their lowest rank
+    std::map<UInt, UInt> nodeNumber;
+    std::vector<UInt> index(count);
+    for(int i=0; i<count; i++)
+    {
+      const UInt id = worldNode.size() ? worldNode.at(ranksWorld.at(i)) : static_cast<UInt>(ranksWorld.at(i));
+      index.at(i) = nodeNumber.emplace(id, nodeNumber.size()).first->second;
+    }
+    return index;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+// Sub communicators of the shared memory nodes.
+// Returns TRUE if collectives should be hierarchical (several nodes with more than one process).
+// Must be called by every process in @a comm.
+static Bool isHierarchical(CommunicatorPtr comm)
+{
+  try
+  {
+    if(!comm->topologyInit)
+    {
+      comm->topologyInit = TRUE;
+      comm->node = nodeIndex(comm);
+      const UInt nodeCount = *std::max_element(comm->node.begin(), comm->node.end()) + 1;
+      if((nodeCount < 2) || (nodeCount == comm->node.size()))
+        return FALSE;
+
+      comm->localRank.resize(comm->node.size());
+      std::vector<UInt> count(nodeCount, 0);
+      for(UInt i=0; i<comm->node.size(); i++)
+        comm->localRank.at(i) = count.at(comm->node.at(i))++;
+
+      const int rank = static_cast<int>(myRank(comm));
+      check(MPI_Comm_split(comm->comm, static_cast<int>(comm->node.at(rank)), rank, &comm->commNode));
+      check(MPI_Comm_split(comm->comm, (comm->localRank.at(rank) == 0) ? 0 : MPI_UNDEFINED, rank, &comm->commLeader));
+    }
+    return (comm->commNode != MPI_COMM_NULL);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 void barrier(CommunicatorPtr comm)
 {
   try
   {
+    Statistics statistics("barrier", 0, MPI_BYTE, comm);
+    GROOPS_PROFILE("Parallel::barrier")
     MPI_Request request;
     check(MPI_Ibarrier(comm->comm, &request));
     comm->wait(request);
@@ -475,6 +622,23 @@ void peek(CommunicatorPtr comm)
   }
 }
 
+/***********************************************/
+
+Bool probe(UInt process, CommunicatorPtr comm)
+{
+  try
+  {
+    comm->peek();
+    int flag = 0;
+    check(MPI_Iprobe(((process == NULLINDEX) ? MPI_ANY_SOURCE : static_cast<int>(process)), 17, comm->comm, &flag, MPI_STATUS_IGNORE));
+    return flag;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
 /***********************************************/
 /***********************************************/
 
@@ -673,6 +837,8 @@ inline void send(const void *buffer, UInt count, MPI_Datatype datatype, UInt pro
 {
   try
   {
+    Statistics statistics("send", count, datatype, comm);
+    GROOPS_PROFILE("Parallel::send")
     MPI_Request request;
     check(MPI_Isend(buffer, count, datatype, process, 17, comm->comm, &request));
     comm->wait(request);
@@ -843,6 +1009,8 @@ inline void receive(void *buffer, UInt count, MPI_Datatype datatype, UInt proces
 {
   try
   {
+    Statistics statistics("receive", count, datatype, comm);
+    GROOPS_PROFILE("Parallel::receive")
     MPI_Request request;
     check(MPI_Irecv(buffer, count, datatype, ((process!=NULLINDEX) ? process : MPI_ANY_SOURCE), 17, comm->comm, &request));
     comm->wait(request);
@@ -1026,9 +1194,36 @@ inline void broadCast(void *buffer, UInt count, MPI_Datatype datatype, UInt proc
 {
   try
   {
-    MPI_Request request;
-    check(MPI_Ibcast(buffer, count, datatype, process, comm->comm, &request));
-    comm->wait(request);
+    Statistics statistics("broadCast", (myRank(comm) == process) ? count : 0, datatype, comm);
+    GROOPS_PROFILE("Parallel::broadCast")
+    int typeSize;
+    check(MPI_Type_size(datatype, &typeSize));
+    if((count*typeSize >= HIERARCHICAL_MIN_BYTES) && isHierarchical(comm))
+    {
+      // root -> lowest rank at root node -> lowest ranks at other nodes -> all processes at each node
+      const UInt rank = myRank(comm);
+      const int  rootNode  = static_cast<int>(comm->node.at(process));
+      const int  rootLocal = static_cast<int>(comm->localRank.at(process));
+      MPI_Request request = MPI_REQUEST_NULL;
+      if(rootLocal && (rank == process))
+        check(MPI_Isend(buffer, count, datatype, 0, 555, comm->commNode, &request));
+      else if(rootLocal && (comm->node.at(rank) == comm->node.at(process)) && (comm->localRank.at(rank) == 0))
+        check(MPI_Irecv(buffer, count, datatype, rootLocal, 555, comm->commNode, &request));
+      comm->wait(request);
+      if(comm->commLeader != MPI_COMM_NULL)
+      {
+        check(MPI_Ibcast(buffer, count, datatype, rootNode, comm->commLeader, &request));
+        comm->wait(request);
+      }
+      check(MPI_Ibcast(buffer, count, datatype, 0, comm->commNode, &request));
+      comm->wait(request);
+    }
+    else
+    {
+      MPI_Request request;
+      check(MPI_Ibcast(buffer, count, datatype, process, comm->comm, &request));
+      comm->wait(request);
+    }
     barrier(comm); // prevents rare deadlocks when broadcast is called rapidly within loop, possibly MPI issue?
   }
   catch(std::exception &e)
@@ -1199,6 +1394,91 @@ template<> void broadCast(Matrix &x, UInt process, CommunicatorPtr comm)
   }
 }
 
+/***********************************************/
+
+void broadCastShared(Matrix &x, UInt process, CommunicatorPtr comm)
+{
+  try
+  {
+#if MPI_VERSION >= 3
+    UInt rows  = x.rows();
+    UInt cols  = x.columns();
+    UInt type  = static_cast<UInt>(x.getType());
+    UInt upper = x.isUpper();
+
+    broadCast(rows,  process, comm);
+    broadCast(cols,  process, comm);
+    broadCast(type,  process, comm);
+    broadCast(upper, process, comm);
+
+    if(rows*cols == 0)
+    {
+      x = Matrix(rows, cols);
+      x.setType(static_cast<Matrix::Type>(type), (upper) ? Matrix::UPPER : Matrix::LOWER);
+      return;
+    }
+
+    const int rank = static_cast<int>(myRank(comm));
+    if(!comm->sharedInit)
+    {
+      comm->sharedInit = TRUE;
+      MPI_Comm commShared, commLeader;
+      check(MPI_Comm_split_type(comm->comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &commShared));
+      comm->commShared = std::make_shared<Communicator>(comm, commShared);
+      check(MPI_Comm_split(comm->comm, (myRank(comm->commShared) == 0) ? 0 : MPI_UNDEFINED, rank, &commLeader));
+      if(commLeader != MPI_COMM_NULL)
+        comm->commSharedLeader = std::make_shared<Communicator>(comm, commLeader);
+    }
+    const Bool isLeader = (myRank(comm->commShared) == 0);
+
+    // one window per node, allocated at the lowest rank
+    const UInt size = rows*cols;
+    Double *window  = nullptr;
+    MPI_Win win;
+    check(MPI_Win_allocate_shared(static_cast<MPI_Aint>((isLeader ? size : 0)*sizeof(Double)), sizeof(Double), MPI_INFO_NULL, comm->commShared->comm, &window, &win));
+    comm->mpi->windows.push_back(win);
+    if(!isLeader)
+    {
+      MPI_Aint sizeWindow;
+      int      dispUnit;
+      check(MPI_Win_shared_query(win, 0, &sizeWindow, &dispUnit, &window));
+    }
+
+    // the process fills the window of its own node
+    check(MPI_Win_fence(0, win));
+    int isRoot  = (static_cast<UInt>(rank) == process);
+    int hasRoot = 0;
+    if(isRoot)
+      std::copy_n(static_cast<const const_MatrixSlice &>(x).field(), size, window);
+    check(MPI_Allreduce(&isRoot, &hasRoot, 1, MPI_INT, MPI_MAX, comm->commShared->comm));
+    check(MPI_Win_fence(0, win));
+
+    // distribute to the other nodes
+    if(comm->commSharedLeader)
+    {
+      int root = hasRoot ? static_cast<int>(myRank(comm->commSharedLeader)) : -1;
+      check(MPI_Allreduce(MPI_IN_PLACE, &root, 1, MPI_INT, MPI_MAX, comm->commSharedLeader->comm));
+      constexpr UInt BLOCKSIZE = 200*1024*1024/sizeof(Double); // 200 Mb
+      for(UInt index=0; index<size; index+=BLOCKSIZE)
+        broadCast(window+index, std::min(size-index, BLOCKSIZE), MPI_DOUBLE, static_cast<UInt>(root), comm->commSharedLeader);
+    }
+    check(MPI_Win_fence(0, win));
+
+    // the extra reference forces a copy before any write access
+    std::shared_ptr<Double> field(window, [](Double */*p*/) {});
+    comm->mpi->windowFields.push_back(field);
+    x = Matrix(rows, cols, field);
+    x.setType(static_cast<Matrix::Type>(type), (upper) ? Matrix::UPPER : Matrix::LOWER);
+#else
+    broadCast(x, process, comm);
+#endif
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
 /***********************************************/
 /***********************************************/
 
@@ -1207,9 +1487,48 @@ inline void reduce(const void *sendbuf, void *recvbuf, UInt count, MPI_Datatype
 {
   try
   {
-    MPI_Request request;
-    check(MPI_Ireduce(sendbuf, recvbuf, count, datatype, op, process, comm->comm, &request));
-    comm->wait(request);
+    Statistics statistics("reduce", count, datatype, comm);
+    GROOPS_PROFILE("Parallel::reduce")
+    int typeSize;
+    check(MPI_Type_size(datatype, &typeSize));
+    if((count*typeSize >= HIERARCHICAL_MIN_BYTES) && isHierarchical(comm))
+    {
+      // all processes at each node -> lowest rank at each node -> lowest rank at root node -> root
+      const UInt rank = myRank(comm);
+      const int  rootNode  = static_cast<int>(comm->node.at(process));
+      const int  rootLocal = static_cast<int>(comm->localRank.at(process));
+      const Bool isLeader  = (comm->commLeader != MPI_COMM_NULL);
+      const Bool isRootLeader = isLeader && (comm->node.at(rank) == comm->node.at(process));
+      std::vector<Byte> tmp;
+      void *nodeSum = recvbuf;
+      if(isLeader && !((rank == process) && isRootLeader))
+      {
+        tmp.resize(count*typeSize);
+        nodeSum = tmp.data();
+      }
+
+      MPI_Request request;
+      check(MPI_Ireduce(sendbuf, nodeSum, count, datatype, op, 0, comm->commNode, &request));
+      comm->wait(request);
+      if(isLeader)
+      {
+        check(MPI_Ireduce(isRootLeader ? MPI_IN_PLACE : nodeSum, isRootLeader ? nodeSum : nullptr,
+                          count, datatype, op, rootNode, comm->commLeader, &request));
+        comm->wait(request);
+      }
+      request = MPI_REQUEST_NULL;
+      if(rootLocal && isRootLeader)
+        check(MPI_Isend(nodeSum, count, datatype, rootLocal, 666, comm->commNode, &request));
+      else if(rootLocal && (rank == process))
+        check(MPI_Irecv(recvbuf, count, datatype, 0, 666, comm->commNode, &request));
+      comm->wait(request);
+    }
+    else
+    {
+      MPI_Request request;
+      check(MPI_Ireduce(sendbuf, recvbuf, count, datatype, op, process, comm->comm, &request));
+      comm->wait(request);
+    }
     barrier(comm); // prevents rare deadlocks when reduce is called rapidly within loop, possibly MPI issue?
   }
   catch(std::exception &e)
@@ -1319,6 +1638,122 @@ void reduceSum(Matrix &x, UInt process, CommunicatorPtr comm)
   }
 }
 
+/***********************************************/
+
+class Request
+{
+public:
+  CommunicatorPtr          comm;
+  std::vector<MPI_Request> requests;
+  Matrix                  *x;
+  Vector                   result; // receive buffer at root process
+};
+
+/***********************************************/
+
+RequestPtr reduceSumNonBlocking(Matrix &x, UInt process, CommunicatorPtr comm)
+{
+  try
+  {
+    constexpr UInt BLOCKSIZE = 50*1024*1024/sizeof(Double); // 50 Mb
+
+    RequestPtr request = std::make_shared<Request>();
+    request->comm = comm;
+    request->x    = &x;
+    if(myRank(comm) == process)
+      request->result = Vector(x.size());
+
+    UInt index = 0;
+    while(index<x.size())
+    {
+      const UInt size = std::min(x.size()-index, BLOCKSIZE);
+      request->requests.push_back(MPI_REQUEST_NULL);
+      check(MPI_Ireduce(x.field()+index, (myRank(comm) == process) ? request->result.field()+index : nullptr,
+                        size, MPI_DOUBLE, MPI_SUM, process, comm->comm, &request->requests.back()));
+      index += size;
+    }
+    return request;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void wait(RequestPtr request)
+{
+  try
+  {
+    GROOPS_PROFILE("Parallel::wait")
+    if(!request)
+      return;
+    for(MPI_Request &r : request->requests)
+      request->comm->wait(r);
+    request->requests.clear();
+    if(request->result.size())
+      std::copy_n(request->result.field(), request->result.size(), request->x->field());
+    request->result = Vector();
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+std::vector<std::vector<Double>> allToAll(const std::vector<std::vector<Double>> &send, CommunicatorPtr comm)
+{
+  try
+  {
+    GROOPS_PROFILE("Parallel::allToAll")
+    constexpr UInt BLOCKSIZE = 50*1024*1024/sizeof(Double); // 50 Mb
+
+    const UInt size = Parallel::size(comm);
+    const UInt rank = myRank(comm);
+    std::vector<unsigned long long> sendCount(size, 0), receiveCount(size, 0);
+    UInt countTotal = 0;
+    for(UInt p=0; p<size; p++)
+      if(p != rank)
+      {
+        sendCount.at(p) = send.at(p).size();
+        countTotal += send.at(p).size();
+      }
+    Statistics statistics("allToAll", countTotal, MPI_DOUBLE, comm);
+
+    MPI_Request request;
+    check(MPI_Ialltoall(sendCount.data(), 1, MPI_UNSIGNED_LONG_LONG, receiveCount.data(), 1, MPI_UNSIGNED_LONG_LONG, comm->comm, &request));
+    comm->wait(request);
+
+    std::vector<std::vector<Double>> receive(size);
+    std::vector<MPI_Request> requests;
+    for(UInt p=0; p<size; p++)
+    {
+      receive.at(p).resize(receiveCount.at(p));
+      for(UInt index=0; index<receiveCount.at(p); index+=BLOCKSIZE)
+      {
+        requests.push_back(MPI_REQUEST_NULL);
+        check(MPI_Irecv(receive.at(p).data()+index, static_cast<int>(std::min<UInt>(receiveCount.at(p)-index, BLOCKSIZE)), MPI_DOUBLE, p, 19, comm->comm, &requests.back()));
+      }
+    }
+    for(UInt p=0; p<size; p++)
+      for(UInt index=0; index<sendCount.at(p); index+=BLOCKSIZE)
+      {
+        requests.push_back(MPI_REQUEST_NULL);
+        check(MPI_Isend(send.at(p).data()+index, static_cast<int>(std::min<UInt>(sendCount.at(p)-index, BLOCKSIZE)), MPI_DOUBLE, p, 19, comm->comm, &requests.back()));
+      }
+    for(MPI_Request &r : requests)
+      comm->wait(r);
+    return receive;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
 /***********************************************/
 /***********************************************/
 
@@ -1412,4 +1847,36 @@ void reduceMax(Double &x, UInt process, CommunicatorPtr comm)
 
 /***********************************************/
 
+void logLoadImbalance(Double busySeconds, Double loopSeconds, CommunicatorPtr comm)
+{
+  try
+  {
+    if(!Profiler::isEnabled() || (size(comm) < 3))
+      return;
+
+    Vector busy(size(comm));
+    busy(myRank(comm)) = busySeconds;
+    reduceSum(busy, 0, comm);
+    if(!isMaster(comm))
+      return;
+
+    // the master mainly distributes the work and is not included in the statistics
+    UInt idMax = 1;
+    for(UInt i=2; i<busy.rows(); i++)
+      if(busy(i) > busy(idMax))
+        idMax = i;
+    const Double meanBusy = mean(busy.row(1, busy.rows()-1));
+    logInfo<<"  load of "<<busy.rows()-1<<" processes: busy max/mean = "<<((meanBusy > 0) ? busy(idMax)/meanBusy : 1.)%"%.2f"s
+           <<" (mean "<<meanBusy%"%.2f s"s<<", max "<<busy(idMax)%"%.2f s"s<<" at process "<<idMax
+           <<"), idle "<<(100*std::max(0., 1.-meanBusy/std::max(loopSeconds, 1e-9)))%"%.0f%%"s
+           <<", master busy "<<busy(0)%"%.2f s"s<<" of "<<loopSeconds%"%.2f s"s<<Log::endl;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 } // namespace Parallel
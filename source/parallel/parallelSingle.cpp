@@ -28,8 +28,10 @@ CommunicatorPtr createCommunicator(std::vector<UInt> /*ranks*/, CommunicatorPtr
 CommunicatorPtr selfCommunicator() {return nullptr;}
 UInt myRank(CommunicatorPtr /*comm*/) {return 0;}
 UInt size(CommunicatorPtr /*comm*/)   {return 1;}
+std::vector<UInt> nodeIndex(CommunicatorPtr /*comm*/) {return {0};}
 void barrier(CommunicatorPtr /*comm*/) {}
 void peek(CommunicatorPtr /*comm*/) {}
+Bool probe(UInt /*process*/, CommunicatorPtr /*comm*/) {return FALSE;}
 void broadCastExceptions(CommunicatorPtr comm, std::function<void(CommunicatorPtr)> func) {func(comm);}
 void send(const Byte */*x*/, UInt /*size*/, UInt /*process*/, CommunicatorPtr /*comm*/) {}
 void receive  (Byte  */*x*/, UInt /*size*/, UInt /*process*/, CommunicatorPtr /*comm*/) {}
@@ -61,14 +63,19 @@ template<> void broadCast(GnssType  &/*x*/, UInt /*process*/, CommunicatorPtr /*
 template<> void broadCast(Vector3d  &/*x*/, UInt /*process*/, CommunicatorPtr /*comm*/) {}
 template<> void broadCast(Vector    &/*x*/, UInt /*process*/, CommunicatorPtr /*comm*/) {}
 template<> void broadCast(Matrix    &/*x*/, UInt /*process*/, CommunicatorPtr /*comm*/) {}
+void broadCastShared(Matrix        &/*x*/, UInt /*process*/, CommunicatorPtr /*comm*/) {}
 void reduceSum(UInt     &/*x*/, UInt /*process*/, CommunicatorPtr /*comm*/) {}
 void reduceSum(Double   &/*x*/, UInt /*process*/, CommunicatorPtr /*comm*/) {}
 void reduceSum(Bool     &/*x*/, UInt /*process*/, CommunicatorPtr /*comm*/) {}
 void reduceSum(Matrix   &/*x*/, UInt /*process*/, CommunicatorPtr /*comm*/) {}
+RequestPtr reduceSumNonBlocking(Matrix &/*x*/, UInt /*process*/, CommunicatorPtr /*comm*/) {return nullptr;}
+void wait(RequestPtr /*request*/) {}
+std::vector<std::vector<Double>> allToAll(const std::vector<std::vector<Double>> &/*send*/, CommunicatorPtr /*comm*/) {return std::vector<std::vector<Double>>(1);}
 void reduceMin(UInt     &/*x*/, UInt /*process*/, CommunicatorPtr /*comm*/) {}
 void reduceMin(Double   &/*x*/, UInt /*process*/, CommunicatorPtr /*comm*/) {}
 void reduceMax(UInt     &/*x*/, UInt /*process*/, CommunicatorPtr /*comm*/) {}
 void reduceMax(Double   &/*x*/, UInt /*process*/, CommunicatorPtr /*comm*/) {}
+void logLoadImbalance(Double /*busySeconds*/, Double /*loopSeconds*/, CommunicatorPtr /*comm*/) {}
 
 /***********************************************/
 
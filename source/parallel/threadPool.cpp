@@ -0,0 +1,322 @@
+/***********************************************/
+/**
+* @file threadPool.cpp
+*
+* @brief Shared memory parallelization within one process.
+*
+* @author GROOPS Developers
+* @date 2026-10-14
+*
+*/
+/***********************************************/
+
+#include "base/importStd.h"
+#include "parallel/threadPool.h"
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#ifndef _WIN32
+#include <dlfcn.h>
+#endif
+
+/***** CLASS ***********************************/
+
+// Thread control of the linked BLAS/LAPACK library (symbols looked up at runtime)
+class BlasThreads
+{
+public:
+  typedef void (*SetFunc)(int);
+  typedef int  (*GetFunc)();
+
+  SetFunc set       = nullptr;
+  GetFunc get       = nullptr;
+  Bool    perThread = FALSE; // OpenMP: the setting applies to the calling thread only
+
+  BlasThreads()
+  {
+#ifndef _WIN32
+    auto find = [&](const char *nameSet, const char *nameGet)
+    {
+      void *symbolSet = dlsym(RTLD_DEFAULT, nameSet);
+      void *symbolGet = dlsym(RTLD_DEFAULT, nameGet);
+      if(!symbolSet || !symbolGet)
+        return FALSE;
+      set = reinterpret_cast<SetFunc>(symbolSet);
+      get = reinterpret_cast<GetFunc>(symbolGet);
+      return TRUE;
+    };
+    if(!find("openblas_set_num_threads", "openblas_get_num_threads") &&
+       !find("MKL_Set_Num_Threads",      "MKL_Get_Max_Threads"))
+      perThread = find("omp_set_num_threads", "omp_get_max_threads");
+#endif
+  }
+
+  UInt count() const {return get ? static_cast<UInt>(std::max(get(), 1)) : 1;}
+};
+
+/***********************************************/
+
+class ThreadPool
+{
+  std::vector<std::thread> workers;
+  std::mutex               mutex;
+  std::condition_variable  conditionStart, conditionFinished;
+  UInt                     generation;  // incremented for each new loop
+  UInt                     finished;    // number of workers which have finished the current loop
+  Bool                     stop;
+
+  // current loop
+  const std::function<void(UInt)> *func;
+  UInt                  end;
+  std::atomic<UInt>     next, done;
+  std::atomic<Bool>     failed;
+  std::exception_ptr    exception;
+
+  void work();
+  void workerMain(UInt lastGeneration);
+
+public:
+  ThreadPool() : generation(0), finished(0), stop(FALSE), func(nullptr), end(0), next(0), done(0), failed(FALSE) {}
+ ~ThreadPool() {resize(1);}
+
+  UInt size() const {return workers.size()+1;}
+  void resize(UInt count);
+  void run(UInt start, UInt end, const std::function<void(UInt)> &func, const std::function<void(UInt)> &progress);
+};
+
+static BlasThreads          blasThreads;
+static ThreadPool           threadPool;
+static std::mutex           threadPoolMutex; // only one loop at a time
+static thread_local Bool    insideThreadLoop = FALSE;
+
+/***********************************************/
+
+void ThreadPool::resize(UInt count)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stop = TRUE;
+  }
+  conditionStart.notify_all();
+  for(auto &worker : workers)
+    worker.join();
+  workers.clear();
+  stop = FALSE;
+
+  for(UInt i=1; i<count; i++)
+    workers.emplace_back(&ThreadPool::workerMain, this, generation);
+}
+
+/***********************************************/
+
+void ThreadPool::work()
+{
+  for(;;)
+  {
+    const UInt i = next++;
+    if(i >= end)
+      break;
+    if(!failed)
+    {
+      try
+      {
+        (*func)(i);
+      }
+      catch(...)
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if(!failed)
+          exception = std::current_exception();
+        failed = TRUE;
+      }
+    }
+    done++;
+  }
+}
+
+/***********************************************/
+
+void ThreadPool::workerMain(UInt lastGeneration)
+{
+  insideThreadLoop = TRUE;
+  if(blasThreads.perThread)
+    blasThreads.set(1);
+  for(;;)
+  {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      conditionStart.wait(lock, [&]{return stop || (generation != lastGeneration);});
+      if(stop)
+        return;
+      lastGeneration = generation;
+    }
+
+    work();
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      finished++;
+    }
+    conditionFinished.notify_all();
+  }
+}
+
+/***********************************************/
+
+void ThreadPool::run(UInt start, UInt end_, const std::function<void(UInt)> &func_, const std::function<void(UInt)> &progress)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    func      = &func_;
+    end       = end_;
+    next      = start;
+    done      = 0;
+    failed    = FALSE;
+    exception = nullptr;
+    finished  = 0;
+    generation++;
+  }
+  conditionStart.notify_all();
+
+  // BLAS/LAPACK single threaded inside the loop (no nested oversubscription)
+  const UInt blasCount = blasThreads.count();
+  if(blasCount > 1)
+    blasThreads.set(1);
+
+  // calling thread takes part in the computation
+  insideThreadLoop = TRUE;
+  for(;;)
+  {
+    const UInt i = next++;
+    if(i >= end)
+      break;
+    if(progress)
+      progress(done);
+    if(!failed)
+    {
+      try
+      {
+        func_(i);
+      }
+      catch(...)
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if(!failed)
+          exception = std::current_exception();
+        failed = TRUE;
+      }
+    }
+    done++;
+  }
+  insideThreadLoop = FALSE;
+
+  // wait for workers
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    conditionFinished.wait(lock, [&]{return finished == workers.size();});
+    func = nullptr;
+  }
+  if(blasCount > 1)
+    blasThreads.set(static_cast<int>(blasCount));
+
+  if(exception)
+    std::rethrow_exception(exception);
+}
+
+/***********************************************/
+/***** FUNCTIONS *******************************/
+/***********************************************/
+
+namespace Parallel
+{
+
+UInt threadCount()
+{
+  return threadPool.size();
+}
+
+/***********************************************/
+
+// hardware cores shared by the processes at the node
+static UInt coresPerProcess(UInt processesAtNode)
+{
+  return std::max(static_cast<UInt>(std::thread::hardware_concurrency())/std::max(processesAtNode, UInt(1)), UInt(1));
+}
+
+/***********************************************/
+
+void setThreadCount(UInt count, UInt processesAtNode)
+{
+  try
+  {
+    if(count == 0)
+      count = coresPerProcess(processesAtNode);
+    std::lock_guard<std::mutex> lock(threadPoolMutex);
+    threadPool.resize(count);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+UInt blasThreadCount()
+{
+  return blasThreads.count();
+}
+
+/***********************************************/
+
+Bool setBlasThreadCount(UInt count, UInt processesAtNode)
+{
+  if(!blasThreads.set)
+    return FALSE;
+  if(count == 0)
+    count = coresPerProcess(processesAtNode);
+  blasThreads.set(static_cast<int>(count));
+  return TRUE;
+}
+
+/***********************************************/
+
+Bool isThreadWorker()
+{
+  return insideThreadLoop;
+}
+
+/***********************************************/
+
+void threadLoop(UInt start, UInt end, const std::function<void(UInt)> &func, const std::function<void(UInt)> &progress)
+{
+  try
+  {
+    if(start >= end)
+      return;
+
+    // serial version (nested calls or no extra threads)
+    if(insideThreadLoop || (threadPool.size() <= 1) || (end-start <= 1))
+    {
+      for(UInt i=start; i<end; i++)
+      {
+        if(progress && !insideThreadLoop)
+          progress(i-start);
+        func(i);
+      }
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(threadPoolMutex);
+    threadPool.run(start, end, func, progress);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+} // namespace Parallel
@@ -0,0 +1,65 @@
+/***********************************************/
+/**
+* @file threadPool.h
+*
+* @brief Shared memory parallelization within one process.
+* A pool of worker threads is started once and reused by all thread parallel loops.
+* The number of threads is set at startup (e.g. command line option --threads).
+* The threads of the linked BLAS/LAPACK library (command line option --blas-threads)
+* are controlled as well: inside thread parallel loops BLAS/LAPACK runs single threaded.
+*
+* @author GROOPS Developers
+* @date 2026-10-14
+*
+*/
+/***********************************************/
+
+#ifndef __GROOPS_THREADPOOL__
+#define __GROOPS_THREADPOOL__
+
+#include "base/importStd.h"
+
+/***********************************************/
+
+/** @addtogroup parallelGroup */
+/// @{
+
+namespace Parallel
+{
+  /** @brief Number of threads per process used in thread parallel loops (default: 1). */
+  UInt threadCount();
+
+  /** @brief Set the number of threads per process.
+  * The calling thread is included in @p count.
+  * If @p count is zero the hardware cores are shared by the @p processesAtNode processes running at the same node. */
+  void setThreadCount(UInt count, UInt processesAtNode=1);
+
+  /** @brief Number of threads used by BLAS/LAPACK outside of thread parallel loops.
+  * One if the library provides no thread control. */
+  UInt blasThreadCount();
+
+  /** @brief Set the number of threads used by BLAS/LAPACK outside of thread parallel loops.
+  * If @p count is zero the hardware cores are shared by the @p processesAtNode processes running at the same node.
+  * Supported are OpenBLAS, MKL and OpenMP based libraries (detected at runtime).
+  * @return FALSE if the linked library provides no thread control. */
+  Bool setBlasThreadCount(UInt count, UInt processesAtNode=1);
+
+  /** @brief Is the calling thread a worker of a running thread parallel loop? */
+  Bool isThreadWorker();
+
+  /** @brief Thread parallel loop within the own process.
+  * Calls @a func(i) for every @a i in [@a start, @a end) using threadCount() threads,
+  * which share the memory of the process (e.g. read-only models).
+  * The indices are handed out dynamically, the calling thread takes part in the computation.
+  * @a progress(done) is called by the calling thread only and can be used for timing output.
+  * The first exception thrown by @a func is rethrown in the calling thread after all threads are finished.
+  * Nested calls (inside @a func) are executed serially.
+  * @a func must be thread safe, must not communicate via MPI and should not write log output. */
+  void threadLoop(UInt start, UInt end, const std::function<void(UInt)> &func, const std::function<void(UInt)> &progress=nullptr);
+}
+
+/// @}
+
+/***********************************************/
+
+#endif /* __GROOPS__ */
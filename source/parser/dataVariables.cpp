@@ -370,3 +370,108 @@ void undefineDataVariables(const GriddedDataRectangular &grid, VariableList &var
 
 /***********************************************/
 /***********************************************/
+
+DataVariableColumns::DataVariableColumns(const_MatrixSliceRef data) : _rows(data.rows())
+{
+  try
+  {
+    std::vector<Double> index(data.rows());
+    std::iota(index.begin(), index.end(), 0.);
+    add("index", std::move(index));
+    for(UInt i=0; i<data.columns(); i++)
+    {
+      if(data.isRowMajorOrder())
+      {
+        std::vector<Double> column(data.rows());
+        for(UInt k=0; k<data.rows(); k++)
+          column.at(k) = data(k, i);
+        add("data"+i%"%i"s, std::move(column));
+      }
+      else
+        add("data"+i%"%i"s, data.field()+i*data.ld());
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+DataVariableColumns::DataVariableColumns(const GriddedData &grid) : _rows(grid.points.size())
+{
+  try
+  {
+    std::vector<Double> L(grid.points.size()), B(grid.points.size()), h(grid.points.size());
+    for(UInt i=0; i<grid.points.size(); i++)
+    {
+      Angle L_, B_;
+      grid.ellipsoid(grid.points.at(i), L_, B_, h.at(i));
+      L.at(i) = Double(L_)*RAD2DEG;
+      B.at(i) = Double(B_)*RAD2DEG;
+    }
+    add("longitude", std::move(L));
+    add("latitude",  std::move(B));
+    add("height",    std::move(h));
+    std::vector<Double> x(grid.points.size()), y(grid.points.size()), z(grid.points.size());
+    for(UInt i=0; i<grid.points.size(); i++)
+    {
+      x.at(i) = grid.points.at(i).x();
+      y.at(i) = grid.points.at(i).y();
+      z.at(i) = grid.points.at(i).z();
+    }
+    add("cartesianX", std::move(x));
+    add("cartesianY", std::move(y));
+    add("cartesianZ", std::move(z));
+    add("area", grid.areas.size() ? grid.areas : std::vector<Double>(grid.points.size(), 0.));
+    std::vector<Double> index(grid.points.size());
+    std::iota(index.begin(), index.end(), 0.);
+    add("index", std::move(index));
+    for(UInt i=0; i<grid.values.size(); i++)
+      add("data"+i%"%i"s, grid.values.at(i).data());
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void DataVariableColumns::add(const std::string &name, const Double *column)
+{
+  _names.push_back(name);
+  _slots.push_back(column);
+}
+
+/***********************************************/
+
+void DataVariableColumns::add(const std::string &name, std::vector<Double> column)
+{
+  if(column.size() != _rows)
+    throw(Exception("column '"+name+"' has "+column.size()%"%i rows, expected "s+_rows%"%i"s));
+  buffer.push_back(std::move(column));
+  add(name, buffer.back().data());
+}
+
+/***********************************************/
+
+void DataVariableColumns::add(const std::string &name, const std::vector<Time> &times)
+{
+  std::vector<Double> mjd(times.size());
+  for(UInt i=0; i<times.size(); i++)
+    mjd.at(i) = times.at(i).mjd();
+  add(name, std::move(mjd));
+}
+
+/***********************************************/
+
+Vector DataVariableColumns::evaluate(const ExpressionCompiled &compiled) const
+{
+  Vector result(_rows);
+  evaluate(compiled, result.field());
+  return result;
+}
+
+/***********************************************/
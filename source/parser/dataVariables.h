@@ -137,6 +137,62 @@ void undefineDataVariables(const GriddedDataRectangular &grid, VariableList &var
 
 /***********************************************/
 
+/** @brief Row wise varying variables as columns for vectorized evaluation.
+* @ingroup parserGroup
+* Instead of setting the variables for each row (see @a evaluateDataVariables)
+* the expressions are compiled with the variable names as slots (see @a ExpressionCompiled)
+* and evaluated for all rows at once. The constant variables (e.g. data0mean)
+* must be added to the @a VariableList with @a addDataVariables as before.
+* @code
+* DataVariableColumns columns(data);
+* columns.add("epoch", times);
+* Vector result = columns.evaluate(columns.compile(expr, varList));
+* @endcode */
+class DataVariableColumns
+{
+  UInt                           _rows;
+  std::vector<std::string>       _names;
+  std::vector<const Double*>     _slots;
+  std::list<std::vector<Double>> buffer; // computed columns
+
+public:
+  /** @brief Empty list of columns with @a rows rows. */
+  explicit DataVariableColumns(UInt rows=0) : _rows(rows) {}
+
+  /** @brief Columns of a matrix: index, data0, data1, ... */
+  explicit DataVariableColumns(const_MatrixSliceRef data);
+
+  /** @brief Columns of a grid: longitude, latitude, height, cartesianX, cartesianY, cartesianZ, area, index, data0, data1, ... */
+  explicit DataVariableColumns(const GriddedData &grid);
+
+  DataVariableColumns(const DataVariableColumns &) = delete;
+  DataVariableColumns &operator=(const DataVariableColumns &) = delete;
+
+  /** @brief Add a column, which must stay valid as long as this object is used. */
+  void add(const std::string &name, const Double *column);
+
+  /** @brief Add a column (copied). */
+  void add(const std::string &name, std::vector<Double> column);
+
+  /** @brief Add a time column as MJD. */
+  void add(const std::string &name, const std::vector<Time> &times);
+
+  UInt rows() const {return _rows;}
+  const std::vector<std::string>   &names() const {return _names;}
+  const std::vector<const Double*> &slots() const {return _slots;}
+
+  /** @brief Compile an expression with the columns as slots. */
+  ExpressionCompiled compile(ExpressionVariablePtr expr, const VariableList &varList) const {return ExpressionCompiled(expr, varList, _names);}
+
+  /** @brief Evaluate a compiled expression for all rows into @a result (@a rows() contiguous values). */
+  void evaluate(const ExpressionCompiled &compiled, Double *result) const {compiled.evaluate(_rows, _slots, result);}
+
+  /** @brief Evaluate a compiled expression for all rows. */
+  Vector evaluate(const ExpressionCompiled &compiled) const;
+};
+
+/***********************************************/
+
 /// @}
 
 #endif /* __GROOPS__ */
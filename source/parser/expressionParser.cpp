@@ -87,6 +87,7 @@ public:
   void          usedVariables(const VariableList &/*varList*/, std::set<std::string> &/*usedName*/) const override {}
   ExpressionPtr simplify(const VariableList &/*varList*/, Bool &resolved) const override {resolved = TRUE; return clone();}
   Double        evaluate(const VariableList &/*varList*/) const override {return value;}
+  void          compile(ExpressionCompiled &compiled) const override {compiled.emitValue(value);}
   ExpressionPtr derivative(const std::string &/*var*/) const override {return std::make_shared<ExpressionValue>(0);}
   ExpressionPtr clone() const override {return std::make_shared<ExpressionValue>(value);}
   UInt          priority() const override {return Expression::Priority::VALUE;}
@@ -106,6 +107,7 @@ public:
   void          usedVariables(const VariableList &varList, std::set<std::string> &usedName) const override;
   ExpressionPtr simplify(const VariableList &varList, Bool &resolved) const override;
   Double        evaluate(const VariableList &varList) const override;
+  void          compile(ExpressionCompiled &compiled) const override {compiled.emitVariable(name);}
   ExpressionPtr derivative(const std::string &var) const override  {return exprValue((var == this->name) ? 1 : 0);}
   ExpressionPtr clone() const override {return std::make_shared<ExpressionVar>(name);}
   UInt          priority() const override {return Expression::Priority::VALUE;}
@@ -131,6 +133,7 @@ public:
   void          usedVariables(const VariableList &/*varList*/, std::set<std::string> &/*usedName*/) const override {}
   ExpressionPtr simplify(const VariableList &/*varList*/, Bool &resolved) const override {resolved = TRUE; return clone();}
   Double        evaluate(const VariableList &/*varList*/) const override {return value;}
+  void          compile(ExpressionCompiled &compiled) const override {compiled.emitValue(value);}
   ExpressionPtr derivative(const std::string &/*var*/) const override {return exprValue(0);}
   ExpressionPtr clone()  const override {return create();}
   UInt          priority() const override {return Expression::Priority::FUNCTION;}
@@ -150,8 +153,11 @@ public:
   virtual std::string   name() const {return "operator";}
   virtual std::string   string() const override {return name()+"("+operand->string()+")";}
   virtual ExpressionPtr create(const ExpressionPtr &ob) const = 0;
+  virtual Double        function(Double x) const = 0;
   virtual void          usedVariables(const VariableList &varList, std::set<std::string> &usedName) const override {operand->usedVariables(varList, usedName);}
   virtual ExpressionPtr simplify(const VariableList &varList, Bool &resolved) const override;
+  virtual Double        evaluate(const VariableList &varList) const override {return function(operand->evaluate(varList));}
+  virtual void          compile(ExpressionCompiled &compiled) const override {operand->compile(compiled); compiled.emitFunction(ExpressionCompiled::FUNCTION1, this);}
   virtual ExpressionPtr derivative(const std::string &/*var*/) const override {throw(Exception("Derivative not defined for \""+name()+"\"."));}
   virtual ExpressionPtr clone()  const override {return create(operand->clone());}
   virtual UInt          priority() const override {return Expression::Priority::FUNCTION;}
@@ -171,8 +177,11 @@ public:
   virtual std::string   name() const {return "operator";}
   virtual std::string   string() const override {return name()+"("+left->string()+", "+right->string()+")";}
   virtual ExpressionPtr create(const ExpressionPtr &l, const ExpressionPtr &r) const = 0;
+  virtual Double        function(Double x, Double y) const = 0;
   virtual void          usedVariables(const VariableList &varList, std::set<std::string> &usedName) const override {left->usedVariables(varList, usedName); right->usedVariables(varList, usedName);}
   virtual ExpressionPtr simplify(const VariableList &varList, Bool &resolved) const override;
+  virtual Double        evaluate(const VariableList &varList) const override {return function(left->evaluate(varList), right->evaluate(varList));}
+  virtual void          compile(ExpressionCompiled &compiled) const override {left->compile(compiled); right->compile(compiled); compiled.emitFunction(ExpressionCompiled::FUNCTION2, this);}
   virtual ExpressionPtr derivative(const std::string &/*var*/) const override {throw(Exception("Derivative not defined for \""+name()+"\"."));}
   virtual ExpressionPtr clone()  const override {return create(left->clone(), right->clone());}
   virtual UInt priority() const override {return Expression::Priority::FUNCTION;}
@@ -192,8 +201,11 @@ public:
   virtual std::string   name() const {return "operator";}
   virtual std::string   string() const override {return name()+"("+arg1->string()+", "+arg2->string()+", "+arg3->string()+")";}
   virtual ExpressionPtr create(const ExpressionPtr &a1, const ExpressionPtr &a2, const ExpressionPtr &a3) const = 0;
+  virtual Double        function(Double x, Double y, Double z) const = 0;
   virtual void          usedVariables(const VariableList &varList, std::set<std::string> &usedName) const override {arg1->usedVariables(varList, usedName); arg2->usedVariables(varList, usedName); arg3->usedVariables(varList, usedName);}
   virtual ExpressionPtr simplify(const VariableList &varList, Bool &resolved) const override;
+  virtual Double        evaluate(const VariableList &varList) const override {return function(arg1->evaluate(varList), arg2->evaluate(varList), arg3->evaluate(varList));}
+  virtual void          compile(ExpressionCompiled &compiled) const override {arg1->compile(compiled); arg2->compile(compiled); arg3->compile(compiled); compiled.emitFunction(ExpressionCompiled::FUNCTION3, this);}
   virtual ExpressionPtr derivative(const std::string &/*var*/) const override {throw(Exception("Derivative not defined for \""+name()+"\"."));}
   virtual ExpressionPtr clone()  const override {return create(arg1->clone(), arg2->clone(), arg3->clone());}
   virtual UInt priority() const override {return Expression::Priority::FUNCTION;}
@@ -294,7 +306,8 @@ public:
   explicit ExpressionNegative(const ExpressionPtr &ob) : ExpressionFunction1(ob) {}
   std::string   string() const override {return "-"+operand->string(priority());}
   ExpressionPtr create(const ExpressionPtr &ob) const override {return std::make_shared<ExpressionNegative>(ob);}
-  Double        evaluate(const VariableList &v) const override {return -operand->evaluate(v);}
+  Double        function(Double x) const override {return -x;}
+  void          compile(ExpressionCompiled &compiled) const override {operand->compile(compiled); compiled.emit(ExpressionCompiled::NEGATIVE);}
   ExpressionPtr derivative(const std::string &var) const override {return -operand->derivative(var);}
   UInt priority() const override {return Expression::Priority::UNARY;}
 };
@@ -309,7 +322,8 @@ public:
   ExpressionAdd(const ExpressionPtr &l, const ExpressionPtr &r) : ExpressionFunction2(l, r) {}
   std::string   string() const override {return left->string(priority()) + " + " + right->string(priority());}
   ExpressionPtr create(const ExpressionPtr &l, const ExpressionPtr &r) const override {return std::make_shared<ExpressionAdd>(l, r);}
-  Double        evaluate(const VariableList &v) const override {return left->evaluate(v) + right->evaluate(v);}
+  Double        function(Double x, Double y) const override {return x + y;}
+  void          compile(ExpressionCompiled &compiled) const override {left->compile(compiled); right->compile(compiled); compiled.emit(ExpressionCompiled::ADD);}
   ExpressionPtr derivative(const std::string &var) const override {return left->derivative(var) + right->derivative(var);}
   UInt priority() const override {return Expression::Priority::ADDITIVE;}
 };
@@ -324,7 +338,8 @@ public:
   ExpressionSub(const ExpressionPtr &l, const ExpressionPtr &r) : ExpressionFunction2(l, r) {}
   std::string   string() const override {return left->string(priority()) + " - " + right->string(priority()+1);}
   ExpressionPtr create(const ExpressionPtr &l, const ExpressionPtr &r) const override {return std::make_shared<ExpressionSub>(l, r);}
-  Double        evaluate(const VariableList &v) const override {return left->evaluate(v) - right->evaluate(v);}
+  Double        function(Double x, Double y) const override {return x - y;}
+  void          compile(ExpressionCompiled &compiled) const override {left->compile(compiled); right->compile(compiled); compiled.emit(ExpressionCompiled::SUB);}
   ExpressionPtr derivative(const std::string &var) const override {return left->derivative(var) - right->derivative(var);}
   UInt priority() const override {return Expression::Priority::ADDITIVE;}
 };
@@ -339,7 +354,8 @@ public:
   ExpressionMult(const ExpressionPtr &l, const ExpressionPtr &r) : ExpressionFunction2(l, r) {}
   std::string   string() const override {return left->string(priority()) + "*" + right->string(priority());}
   ExpressionPtr create(const ExpressionPtr &l, const ExpressionPtr &r) const override {return std::make_shared<ExpressionMult>(l, r);}
-  Double        evaluate(const VariableList &v) const override {return left->evaluate(v) * right->evaluate(v);}
+  Double        function(Double x, Double y) const override {return x * y;}
+  void          compile(ExpressionCompiled &compiled) const override {left->compile(compiled); right->compile(compiled); compiled.emit(ExpressionCompiled::MULT);}
   ExpressionPtr derivative(const std::string &var) const override {return left->derivative(var)*right->clone() + left->clone()*right->derivative(var);}
   UInt priority() const override {return Expression::Priority::MULTIPLICATIVE;}
 };
@@ -354,7 +370,8 @@ public:
   ExpressionDiv(const ExpressionPtr &l, const ExpressionPtr &r) : ExpressionFunction2(l, r) {}
   std::string string() const override {return left->string(priority()) + "/" + right->string(priority()+1);}
   inline ExpressionPtr create(const ExpressionPtr &l, const ExpressionPtr &r) const override {return std::make_shared<ExpressionDiv>(l, r);}
-  inline Double        evaluate(const VariableList &v) const override {return left->evaluate(v) / right->evaluate(v);}
+  inline Double        function(Double x, Double y) const override {return x / y;}
+  inline void          compile(ExpressionCompiled &compiled) const override {left->compile(compiled); right->compile(compiled); compiled.emit(ExpressionCompiled::DIV);}
   inline ExpressionPtr derivative(const std::string &var) const override {return (left->derivative(var)*right->clone() - left->clone()*right->derivative(var))/(right->clone()^exprValue(2));}
   UInt priority() const override {return Expression::Priority::MULTIPLICATIVE;}
 };
@@ -369,7 +386,8 @@ public:
   ExpressionPow(const ExpressionPtr &l, const ExpressionPtr &r) : ExpressionFunction2(l, r) {}
   std::string   string() const override {return left->string(priority()) + "^" + right->string(priority());}
   ExpressionPtr create(const ExpressionPtr &l, const ExpressionPtr &r) const override {return std::make_shared<ExpressionPow>(l, r);}
-  Double        evaluate(const VariableList &v) const override {return pow(left->evaluate(v),right->evaluate(v));}
+  Double        function(Double x, Double y) const override {return pow(x,y);}
+  void          compile(ExpressionCompiled &compiled) const override {left->compile(compiled); right->compile(compiled); compiled.emit(ExpressionCompiled::POW);}
   ExpressionPtr derivative(const std::string &var) const override {return left->derivative(var)*right->clone()/left->clone() * (left->clone()^(right->clone()-exprValue(1)));} // this derivative is not completly correct!!!!
   UInt priority() const override {return Expression::Priority::EXPONENTIAL;}
 };
@@ -387,7 +405,7 @@ public:
   std::string   name()   const override {return "operator<";}
   std::string   string() const override {return left->string(priority()) + "<" + right->string(priority());}
   ExpressionPtr create(const ExpressionPtr &l, const ExpressionPtr &r) const override {return std::make_shared<ExpressionLessThan>(l, r);}
-  Double        evaluate(const VariableList &varList) const override {return left->evaluate(varList) < right->evaluate(varList) ? 1.0 : 0.0;}
+  Double        function(Double x, Double y) const override {return x < y ? 1.0 : 0.0;}
   UInt priority() const override {return Expression::Priority::RELATION;}
 };
 
@@ -400,7 +418,7 @@ public:
   std::string   name()   const override {return "operator<=";}
   std::string   string() const override {return left->string(priority()) + "<=" + right->string(priority());}
   ExpressionPtr create(const ExpressionPtr &l, const ExpressionPtr &r) const override {return std::make_shared<ExpressionLessEqualThan>(l, r);}
-  Double        evaluate(const VariableList &varList) const override {return left->evaluate(varList) <= right->evaluate(varList) ? 1.0 : 0.0;}
+  Double        function(Double x, Double y) const override {return x <= y ? 1.0 : 0.0;}
   UInt priority() const override {return Expression::Priority::RELATION;}
 };
 
@@ -413,7 +431,7 @@ public:
   std::string   name()   const override {return "operator>";}
   std::string   string() const override {return left->string(priority()) + ">" + right->string(priority());}
   ExpressionPtr create(const ExpressionPtr &l, const ExpressionPtr &r) const override {return std::make_shared<ExpressionGreaterThan>(l, r);}
-  Double        evaluate(const VariableList &varList) const override {return left->evaluate(varList) > right->evaluate(varList) ? 1.0 : 0.0;}
+  Double        function(Double x, Double y) const override {return x > y ? 1.0 : 0.0;}
   UInt priority() const override {return Expression::Priority::RELATION;}
 };
 
@@ -426,7 +444,7 @@ public:
   std::string   name()   const override {return "operator>=";}
   std::string   string() const override {return left->string(priority()) + ">=" + right->string(priority());}
   ExpressionPtr create(const ExpressionPtr &l, const ExpressionPtr &r) const override {return std::make_shared<ExpressionGreaterEqualThan>(l, r);}
-  Double        evaluate(const VariableList &varList) const override {return left->evaluate(varList) >= right->evaluate(varList) ? 1.0 : 0.0;}
+  Double        function(Double x, Double y) const override {return x >= y ? 1.0 : 0.0;}
   UInt priority() const override {return Expression::Priority::RELATION;}
 };
 
@@ -439,7 +457,7 @@ public:
   std::string   name()   const override {return "operator==";}
   std::string   string() const override {return left->string(priority()) + "==" + right->string(priority());}
   ExpressionPtr create(const ExpressionPtr &l, const ExpressionPtr &r) const override {return std::make_shared<ExpressionEqual>(l, r);}
-  Double        evaluate(const VariableList &varList) const override {return left->evaluate(varList) == right->evaluate(varList) ? 1.0 : 0.0;}
+  Double        function(Double x, Double y) const override {return x == y ? 1.0 : 0.0;}
   UInt priority() const override {return Expression::Priority::EQUALITY;}
 };
 
@@ -452,7 +470,7 @@ public:
   std::string   name()   const override {return "operator!=";}
   std::string   string() const override {return left->string(priority()) + "!=" + right->string(priority());}
   ExpressionPtr create(const ExpressionPtr &l, const ExpressionPtr &r) const override {return std::make_shared<ExpressionNotEqual>(l, r);}
-  Double        evaluate(const VariableList &varList) const override {return left->evaluate(varList) != right->evaluate(varList) ? 1.0 : 0.0;}
+  Double        function(Double x, Double y) const override {return x != y ? 1.0 : 0.0;}
   UInt priority() const override {return Expression::Priority::EQUALITY;}
 };
 
@@ -467,7 +485,7 @@ public:
   std::string   name()   const override {return "operator!";}
   std::string   string() const override {return "!"+operand->string(priority());}
   ExpressionPtr create(const ExpressionPtr &ob) const override {return std::make_shared<ExpressionLogicalNot>(ob);}
-  Double        evaluate(const VariableList &v) const override {return operand->evaluate(v) == 0.0 ? 1.0 : 0.0;}
+  Double        function(Double x) const override {return x == 0.0 ? 1.0 : 0.0;}
   UInt priority() const override {return Expression::Priority::UNARY;}
 };
 
@@ -480,7 +498,7 @@ public:
   std::string   name()   const override {return "operator&&";}
   std::string   string() const override {return left->string(priority()) + "&&" + right->string(priority());}
   ExpressionPtr create(const ExpressionPtr &l, const ExpressionPtr &r) const override {return std::make_shared<ExpressionLogicalAnd>(l, r);}
-  Double        evaluate(const VariableList &varList) const override {return (left->evaluate(varList)!=0.0 &&  right->evaluate(varList)!=0.0) ? 1.0 : 0.0;}
+  Double        function(Double x, Double y) const override {return (x!=0.0 &&  y!=0.0) ? 1.0 : 0.0;}
   UInt priority() const override {return Expression::Priority::LOGICAL_AND;}
 };
 
@@ -493,7 +511,7 @@ public:
   std::string   name()   const override {return "operator||";}
   std::string   string() const override {return left->string(priority()) + "||" + right->string(priority());}
   ExpressionPtr create(const ExpressionPtr &l, const ExpressionPtr &r) const override {return std::make_shared<ExpressionLogicalOr>(l, r);}
-  Double        evaluate(const VariableList &varList) const override {return (left->evaluate(varList)!=0.0 || right->evaluate(varList)!=0.0) ? 1.0 : 0.0;}
+  Double        function(Double x, Double y) const override {return (x!=0.0 || y!=0.0) ? 1.0 : 0.0;}
   UInt priority() const override {return Expression::Priority::LOGICAL_OR;}
 };
 
@@ -505,7 +523,9 @@ public:
   ExpressionIfThenElse(const ExpressionPtr &a1, const ExpressionPtr &a2, const ExpressionPtr &a3) : ExpressionFunction3(a1,a2,a3) {}
   std::string   name() const override {return "if";}
   ExpressionPtr create(const ExpressionPtr &a1, const ExpressionPtr &a2, const ExpressionPtr &a3) const override {return std::make_shared<ExpressionIfThenElse>(a1, a2, a3);}
+  Double        function(Double x, Double y, Double z) const override {return x != 0.0 ? y : z;}
   Double        evaluate(const VariableList &varList) const override {return arg1->evaluate(varList) != 0.0 ? arg2->evaluate(varList) : arg3->evaluate(varList);}
+  void          compile(ExpressionCompiled &compiled) const override {arg1->compile(compiled); arg2->compile(compiled); arg3->compile(compiled); compiled.emit(ExpressionCompiled::IF);}
 };
 FUNCLIST3(ExpressionIfThenElse)
 
@@ -517,7 +537,7 @@ public:
   explicit ExpressionIsNan(const ExpressionPtr &a1) : ExpressionFunction1(a1) {}
   std::string   name() const override {return "isnan";}
   ExpressionPtr create(const ExpressionPtr &a1) const override {return std::make_shared<ExpressionIsNan>(a1);}
-  Double        evaluate(const VariableList &varList) const override {return std::isnan(operand->evaluate(varList));}
+  Double        function(Double x) const override {return std::isnan(x);}
 };
 FUNCLIST1(ExpressionIsNan)
 
@@ -531,7 +551,7 @@ public:
   explicit ExpressionSqrt(const ExpressionPtr &ob) : ExpressionFunction1(ob) {}
   std::string   name() const override {return "sqrt";}
   ExpressionPtr create(const ExpressionPtr &ob) const override {return std::make_shared<ExpressionSqrt>(ob);}
-  Double        evaluate(const VariableList &varList) const override {return std::sqrt(operand->evaluate(varList));}
+  Double        function(Double x) const override {return std::sqrt(x);}
   ExpressionPtr derivative(const std::string &var) const override {return operand->derivative(var)/sqrt(operand->clone());}
 };
 FUNCLIST1(ExpressionSqrt)
@@ -546,7 +566,7 @@ public:
   explicit ExpressionExp(const ExpressionPtr &ob) : ExpressionFunction1(ob) {}
   std::string   name() const override {return "exp";}
   ExpressionPtr create(const ExpressionPtr &ob) const override {return std::make_shared<ExpressionExp>(ob);}
-  Double        evaluate(const VariableList &varList) const override {return std::exp(operand->evaluate(varList));}
+  Double        function(Double x) const override {return std::exp(x);}
   ExpressionPtr derivative(const std::string &var) const override {return operand->derivative(var)*exp(operand->clone());}
 };
 FUNCLIST1(ExpressionExp)
@@ -561,7 +581,7 @@ public:
   explicit ExpressionLog(const ExpressionPtr &ob) : ExpressionFunction1(ob) {}
   std::string   name() const override {return "log";}
   ExpressionPtr create(const ExpressionPtr &ob) const override {return std::make_shared<ExpressionExp>(ob);}
-  Double        evaluate(const VariableList &varList) const override {return std::log(operand->evaluate(varList));}
+  Double        function(Double x) const override {return std::log(x);}
   ExpressionPtr derivative(const std::string &var) const override {return operand->derivative(var)^exprValue(-1);}
 };
 FUNCLIST1(ExpressionLog)
@@ -576,7 +596,7 @@ public:
   explicit ExpressionSin(const ExpressionPtr &ob) : ExpressionFunction1(ob) {}
   std::string   name() const override {return "sin";}
   ExpressionPtr create(const ExpressionPtr &ob) const override {return std::make_shared<ExpressionSin>(ob);}
-  Double        evaluate(const VariableList &varList) const override {return std::sin(operand->evaluate(varList));}
+  Double        function(Double x) const override {return std::sin(x);}
   ExpressionPtr derivative(const std::string &var) const override {return operand->derivative(var)*cos(operand->clone());}
 };
 FUNCLIST1(ExpressionSin)
@@ -591,7 +611,7 @@ public:
   explicit ExpressionCos(const ExpressionPtr &ob) : ExpressionFunction1(ob) {}
   std::string   name() const override {return "cos";}
   ExpressionPtr create(const ExpressionPtr &ob) const override {return std::make_shared<ExpressionCos>(ob);}
-  Double        evaluate(const VariableList &varList) const override {return std::cos(operand->evaluate(varList));}
+  Double        function(Double x) const override {return std::cos(x);}
   ExpressionPtr derivative(const std::string &var) const override {return -operand->derivative(var)*sin(operand->clone());}
 };
 FUNCLIST1(ExpressionCos)
@@ -606,7 +626,7 @@ public:
   explicit ExpressionTan(const ExpressionPtr &ob) : ExpressionFunction1(ob) {}
   std::string   name() const override {return "tan";}
   ExpressionPtr create(const ExpressionPtr &ob) const override {return std::make_shared<ExpressionTan>(ob);}
-  Double        evaluate(const VariableList &varList) const override {return std::tan(operand->evaluate(varList));}
+  Double        function(Double x) const override {return std::tan(x);}
   ExpressionPtr derivative(const std::string &var) const override {return operand->derivative(var)/(cos(operand->clone())^exprValue(2));}
 };
 FUNCLIST1(ExpressionTan)
@@ -621,7 +641,7 @@ public:
   explicit ExpressionAsin(const ExpressionPtr &ob) : ExpressionFunction1(ob) {}
   std::string   name() const override {return "asin";}
   ExpressionPtr create(const ExpressionPtr &ob) const override {return std::make_shared<ExpressionAsin>(ob);}
-  Double        evaluate(const VariableList &varList) const override {return std::asin(operand->evaluate(varList));}
+  Double        function(Double x) const override {return std::asin(x);}
   ExpressionPtr derivative(const std::string &var) const override {return operand->derivative(var)/sqrt(exprValue(1) - ((operand->clone())^exprValue(2)));}
 };
 FUNCLIST1(ExpressionAsin)
@@ -636,7 +656,7 @@ public:
   explicit ExpressionAcos(const ExpressionPtr &ob) : ExpressionFunction1(ob) {}
   std::string   name() const override {return "acos";}
   ExpressionPtr create(const ExpressionPtr &ob) const override {return std::make_shared<ExpressionAcos>(ob);}
-  Double        evaluate(const VariableList &varList) const override {return std::acos(operand->evaluate(varList));}
+  Double        function(Double x) const override {return std::acos(x);}
   ExpressionPtr derivative(const std::string &var) const override {return -operand->derivative(var)/sqrt(exprValue(1) - ((operand->clone())^exprValue(2)));}
 };
 FUNCLIST1(ExpressionAcos)
@@ -651,7 +671,7 @@ public:
   explicit ExpressionAtan(const ExpressionPtr &ob) : ExpressionFunction1(ob) {}
   std::string   name() const override {return "atan";}
   ExpressionPtr create(const ExpressionPtr &ob) const override {return std::make_shared<ExpressionAtan>(ob);}
-  Double        evaluate(const VariableList &varList) const override {return std::atan(operand->evaluate(varList));}
+  Double        function(Double x) const override {return std::atan(x);}
   ExpressionPtr derivative(const std::string &var) const override {return operand->derivative(var)/(exprValue(1) + ((operand->clone())^exprValue(2)));}
 };
 FUNCLIST1(ExpressionAtan)
@@ -666,7 +686,7 @@ public:
   explicit ExpressionAbs(const ExpressionPtr &ob) : ExpressionFunction1(ob) {}
   std::string   name() const override {return "abs";}
   ExpressionPtr create(const ExpressionPtr &ob) const override {return std::make_shared<ExpressionAbs>(ob);}
-  Double        evaluate(const VariableList &varList) const override {return std::fabs(operand->evaluate(varList));}
+  Double        function(Double x) const override {return std::fabs(x);}
 };
 FUNCLIST1(ExpressionAbs)
 
@@ -678,7 +698,7 @@ public:
   explicit ExpressionRound(const ExpressionPtr &ob) : ExpressionFunction1(ob) {}
   std::string   name() const override {return "round";}
   ExpressionPtr create(const ExpressionPtr &ob) const override {return std::make_shared<ExpressionRound>(ob);}
-  Double        evaluate(const VariableList &varList) const override {return std::round(operand->evaluate(varList));}
+  Double        function(Double x) const override {return std::round(x);}
 };
 FUNCLIST1(ExpressionRound)
 
@@ -690,7 +710,7 @@ public:
   explicit ExpressionCeil(const ExpressionPtr &ob) : ExpressionFunction1(ob) {}
   std::string   name() const override {return "ceil";}
   ExpressionPtr create(const ExpressionPtr &ob) const override {return std::make_shared<ExpressionCeil>(ob);}
-  Double        evaluate(const VariableList &varList) const override {return std::ceil(operand->evaluate(varList));}
+  Double        function(Double x) const override {return std::ceil(x);}
 };
 FUNCLIST1(ExpressionCeil)
 
@@ -702,7 +722,7 @@ public:
   explicit ExpressionFloor(const ExpressionPtr &ob) : ExpressionFunction1(ob) {}
   std::string   name() const override {return "floor";}
   ExpressionPtr create(const ExpressionPtr &ob) const override {return std::make_shared<ExpressionFloor>(ob);}
-  Double        evaluate(const VariableList &varList) const override {return std::floor(operand->evaluate(varList));}
+  Double        function(Double x) const override {return std::floor(x);}
 };
 FUNCLIST1(ExpressionFloor)
 
@@ -714,7 +734,7 @@ public:
   explicit ExpressionDeg2Rad(const ExpressionPtr &ob) : ExpressionFunction1(ob) {}
   std::string   name() const override {return "deg2rad";}
   ExpressionPtr create(const ExpressionPtr &ob) const override {return std::make_shared<ExpressionDeg2Rad>(ob);}
-  Double        evaluate(const VariableList &varList) const override {return DEG2RAD * operand->evaluate(varList);}
+  Double        function(Double x) const override {return DEG2RAD * x;}
 };
 FUNCLIST1(ExpressionDeg2Rad)
 
@@ -726,7 +746,7 @@ public:
   explicit ExpressionRad2Deg(const ExpressionPtr &ob) : ExpressionFunction1(ob) {}
   std::string   name() const override {return "rad2deg";}
   ExpressionPtr create(const ExpressionPtr &ob) const override {return std::make_shared<ExpressionRad2Deg>(ob);}
-  Double        evaluate(const VariableList &varList) const override {return RAD2DEG * operand->evaluate(varList);}
+  Double        function(Double x) const override {return RAD2DEG * x;}
 };
 FUNCLIST1(ExpressionRad2Deg)
 
@@ -739,7 +759,7 @@ public:
   ExpressionAtan2(const ExpressionPtr &l, const ExpressionPtr &r) : ExpressionFunction2(l,r) {}
   std::string   name() const override {return "atan2";}
   ExpressionPtr create(const ExpressionPtr &l, const ExpressionPtr &r) const override {return std::make_shared<ExpressionAtan2>(l, r);}
-  Double        evaluate(const VariableList &varList) const override {return std::atan2(left->evaluate(varList), right->evaluate(varList));}
+  Double        function(Double x, Double y) const override {return std::atan2(x, y);}
   ExpressionPtr derivative(const std::string &var) const override {return (left->derivative(var)*right->clone() - left->clone()*right->derivative(var))/((left->clone()^exprValue(2))+(right->clone()^exprValue(2)));}
 };
 FUNCLIST2(ExpressionAtan2)
@@ -752,7 +772,7 @@ public:
   ExpressionMin(const ExpressionPtr &l, const ExpressionPtr &r) : ExpressionFunction2(l,r) {}
   std::string   name() const override {return "min";}
   ExpressionPtr create(const ExpressionPtr &l, const ExpressionPtr &r) const override {return std::make_shared<ExpressionMin>(l, r);}
-  Double        evaluate(const VariableList &varList) const override {return std::min(left->evaluate(varList), right->evaluate(varList));}
+  Double        function(Double x, Double y) const override {return std::min(x, y);}
 };
 FUNCLIST2(ExpressionMin)
 
@@ -764,7 +784,7 @@ public:
   ExpressionMax(const ExpressionPtr &l, const ExpressionPtr &r) : ExpressionFunction2(l,r) {}
   std::string   name() const override {return "max";}
   ExpressionPtr create(const ExpressionPtr &l, const ExpressionPtr &r) const override {return std::make_shared<ExpressionMax>(l, r);}
-  Double        evaluate(const VariableList &varList) const override {return std::max(left->evaluate(varList), right->evaluate(varList));}
+  Double        function(Double x, Double y) const override {return std::max(x, y);}
 };
 FUNCLIST2(ExpressionMax)
 
@@ -776,7 +796,7 @@ public:
   ExpressionMod(const ExpressionPtr &l, const ExpressionPtr &r) : ExpressionFunction2(l,r) {}
   std::string   name() const override {return "mod";}
   ExpressionPtr create(const ExpressionPtr &l, const ExpressionPtr &r) const override {return std::make_shared<ExpressionMod>(l, r);}
-  Double        evaluate(const VariableList &varList) const override {return std::fmod(left->evaluate(varList), right->evaluate(varList));}
+  Double        function(Double x, Double y) const override {return std::fmod(x, y);}
 };
 FUNCLIST2(ExpressionMod)
 
@@ -806,7 +826,7 @@ public:
   ExpressionDate2mjd(const ExpressionPtr &a1, const ExpressionPtr &a2, const ExpressionPtr &a3) : ExpressionFunction3(a1,a2,a3) {}
   std::string   name() const override {return "date2mjd";}
   ExpressionPtr create(const ExpressionPtr &a1, const ExpressionPtr &a2, const ExpressionPtr &a3) const override {return std::make_shared<ExpressionDate2mjd>(a1, a2, a3);}
-  Double        evaluate(const VariableList &varList) const override {return date2time(static_cast<UInt>(arg1->evaluate(varList)), static_cast<UInt>(arg2->evaluate(varList)), static_cast<UInt>(arg3->evaluate(varList))).mjd();}
+  Double        function(Double x, Double y, Double z) const override {return date2time(static_cast<UInt>(x), static_cast<UInt>(y), static_cast<UInt>(z)).mjd();}
 };
 FUNCLIST3(ExpressionDate2mjd)
 
@@ -818,7 +838,7 @@ public:
   explicit ExpressionGps2Utc(const ExpressionPtr &ob) : ExpressionFunction1(ob) {}
   std::string   name() const override {return "gps2utc";}
   ExpressionPtr create(const ExpressionPtr &ob) const override {return std::make_shared<ExpressionGps2Utc>(ob);}
-  Double        evaluate(const VariableList &varList) const override {return timeGPS2UTC(mjd2time(operand->evaluate(varList))).mjd();}
+  Double        function(Double x) const override {return timeGPS2UTC(mjd2time(x)).mjd();}
 };
 FUNCLIST1(ExpressionGps2Utc)
 
@@ -830,7 +850,7 @@ public:
   explicit ExpressionUtc2Gps(const ExpressionPtr &ob) : ExpressionFunction1(ob) {}
   std::string   name() const override {return "utc2gps";}
   ExpressionPtr create(const ExpressionPtr &ob) const override {return std::make_shared<ExpressionUtc2Gps>(ob);}
-  Double        evaluate(const VariableList &varList) const override {return timeUTC2GPS(mjd2time(operand->evaluate(varList))).mjd();}
+  Double        function(Double x) const override {return timeUTC2GPS(mjd2time(x)).mjd();}
 };
 FUNCLIST1(ExpressionUtc2Gps)
 
@@ -842,7 +862,7 @@ public:
   explicit ExpressionDayOfYear(const ExpressionPtr &a1) : ExpressionFunction1(a1) {}
   std::string   name() const override {return "dayofyear";}
   ExpressionPtr create(const ExpressionPtr &a1) const override {return std::make_shared<ExpressionDayOfYear>(a1);}
-  Double        evaluate(const VariableList &varList) const override {return static_cast<Double>(mjd2time(operand->evaluate(varList)).dayOfYear());}
+  Double        function(Double x) const override {return static_cast<Double>(mjd2time(x).dayOfYear());}
 };
 FUNCLIST1(ExpressionDayOfYear)
 
@@ -854,7 +874,7 @@ public:
   explicit ExpressionDecimalYear(const ExpressionPtr &a1) : ExpressionFunction1(a1) {}
   std::string   name() const override {return "decimalyear";}
   ExpressionPtr create(const ExpressionPtr &a1) const override {return std::make_shared<ExpressionDecimalYear>(a1);}
-  Double        evaluate(const VariableList &varList) const override {return mjd2time(operand->evaluate(varList)).decimalYear();}
+  Double        function(Double x) const override {return mjd2time(x).decimalYear();}
 };
 FUNCLIST1(ExpressionDecimalYear)
 
@@ -1524,7 +1544,16 @@ Double ExpressionVariable::evaluate(const VariableList &varList) const
 
     const Status stat = status;
     const_cast<ExpressionVariable*>(this)->status = CIRCULAR;
-    Double d = Expression::parse(text_)->evaluate(varList);
+    Double d;
+    try
+    {
+      d = Expression::parse(text_)->evaluate(varList);
+    }
+    catch(...)
+    {
+      const_cast<ExpressionVariable*>(this)->status = stat; // e.g. not all variables defined
+      throw;
+    }
     const_cast<ExpressionVariable*>(this)->status = stat;
     return d;
   }
@@ -1571,6 +1600,295 @@ std::string ExpressionVariable::getParsedText(const VariableList &varList, Bool
   }
 }
 
+/***********************************************/
+
+ExpressionPtr ExpressionVariable::expression(const VariableList &varList) const
+{
+  try
+  {
+    if(status == UNDEFINED)
+      throw(Exception("undefined variable"));
+    if(status == CIRCULAR)
+      throw(Exception("circular expression"));
+    if(status == VALUE)
+      return exprValue(value);
+    if(status == EXPRESSION)
+      return expr;
+
+    // status == TEXT
+    Bool resolved;
+    std::string text_ = StringParser::parse(name(), this->text, varList, resolved);
+    if(!resolved)
+      throw(Exception("unresolved variables"));
+    return Expression::parse(text_);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW_EXTRA("Expression("+name()+" = '"+getText()+"')", e)
+  }
+}
+
+/***********************************************/
+/***********************************************/
+
+ExpressionCompiled::ExpressionCompiled(ExpressionVariablePtr expr, const VariableList &varList, const std::vector<std::string> &slotNames)
+  : ExpressionCompiled(expr->expression(varList), varList, slotNames)
+{
+}
+
+/***********************************************/
+
+ExpressionCompiled::ExpressionCompiled(ExpressionPtr expr, const VariableList &varList_, const std::vector<std::string> &slotNames_)
+  : slotNames(slotNames_), depth(0), maxDepth(0), varList(nullptr)
+{
+  try
+  {
+    text = expr->string();
+
+    // slot variables must not be resolved by simplify
+    VariableList varListWoSlots = varList_;
+    for(const auto &name : slotNames)
+      varListWoSlots.erase(name);
+
+    varList = &varListWoSlots;
+    compile(expr);
+    varList = nullptr;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW_EXTRA("compile expression '"+text+"'", e)
+  }
+}
+
+/***********************************************/
+
+void ExpressionCompiled::compile(ExpressionPtr expr)
+{
+  Bool resolved;
+  expr = expr->simplify(*varList, resolved);
+  trees.push_back(expr);
+  expr->compile(*this);
+}
+
+/***********************************************/
+
+void ExpressionCompiled::emit(OpCode op)
+{
+  program.push_back(Instruction{op, 0, 0., nullptr});
+  if((op == VALUE) || (op == SLOT))
+    depth++;
+  else if((op == ADD) || (op == SUB) || (op == MULT) || (op == DIV) || (op == POW) || (op == FUNCTION2))
+    depth--;
+  else if((op == IF) || (op == FUNCTION3))
+    depth -= 2;
+  maxDepth = std::max(maxDepth, depth);
+}
+
+/***********************************************/
+
+void ExpressionCompiled::emitValue(Double value)
+{
+  emit(VALUE);
+  program.back().value = value;
+}
+
+/***********************************************/
+
+void ExpressionCompiled::emitVariable(const std::string &name)
+{
+  auto iter = std::find(slotNames.begin(), slotNames.end(), name);
+  if(iter != slotNames.end())
+  {
+    emit(SLOT);
+    program.back().index = std::distance(slotNames.begin(), iter);
+    return;
+  }
+
+  // variable depends on slot variables -> inline
+  auto variable = varList->find(name);
+  if(!variable)
+    throw(Exception("unknown variable: "+name));
+  if(std::find(inlined.begin(), inlined.end(), name) != inlined.end())
+    throw(Exception("circular expression: "+name));
+  inlined.push_back(name);
+  compile(variable->expression(*varList));
+  inlined.pop_back();
+}
+
+/***********************************************/
+
+void ExpressionCompiled::emitFunction(OpCode op, const Expression *function)
+{
+  emit(op);
+  program.back().function = function;
+}
+
+/***********************************************/
+
+Double ExpressionCompiled::evaluate(const Double *slots) const
+{
+  try
+  {
+    if(program.empty())
+      throw(Exception("expression is not compiled"));
+
+    constexpr UInt maxStack = 64;
+    Double stackFixed[maxStack];
+    std::vector<Double> stackLarge;
+    Double *stack = stackFixed;
+    if(maxDepth > maxStack)
+    {
+      stackLarge.resize(maxDepth);
+      stack = stackLarge.data();
+    }
+
+    UInt n = 0; // stack size
+    for(const auto &instr : program)
+      switch(instr.op)
+      {
+        case VALUE:     stack[n++] = instr.value;                break;
+        case SLOT:      stack[n++] = slots[instr.index];         break;
+        case NEGATIVE:  stack[n-1] = -stack[n-1];                break;
+        case ADD:       n--; stack[n-1] += stack[n];             break;
+        case SUB:       n--; stack[n-1] -= stack[n];             break;
+        case MULT:      n--; stack[n-1] *= stack[n];             break;
+        case DIV:       n--; stack[n-1] /= stack[n];             break;
+        case POW:       n--; stack[n-1] = std::pow(stack[n-1], stack[n]); break;
+        case IF:        n-=2; stack[n-1] = (stack[n-1] != 0.) ? stack[n] : stack[n+1]; break;
+        case FUNCTION1: stack[n-1] = static_cast<const ExpressionFunction1*>(instr.function)->function(stack[n-1]); break;
+        case FUNCTION2: n--;  stack[n-1] = static_cast<const ExpressionFunction2*>(instr.function)->function(stack[n-1], stack[n]); break;
+        case FUNCTION3: n-=2; stack[n-1] = static_cast<const ExpressionFunction3*>(instr.function)->function(stack[n-1], stack[n], stack[n+1]); break;
+      }
+    return stack[0];
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW_EXTRA("evaluate '"+text+"'", e)
+  }
+}
+
+/***********************************************/
+
+void ExpressionCompiled::evaluate(UInt count, const std::vector<const Double*> &slots, Double *result) const
+{
+  try
+  {
+    if(program.empty())
+      throw(Exception("expression is not compiled"));
+    if(slots.size() < slotCount())
+      throw(Exception("number of slots ("+slots.size()%"%i) does not match the slot variables ("s+slotCount()%"%i)"s));
+
+    // the stack contains blocks of rows
+    constexpr UInt blockSize = 256;
+    std::vector<Double> buffer(maxDepth*blockSize);
+    auto stack = [&](UInt k) {return buffer.data()+k*blockSize;};
+
+    for(UInt start=0; start<count; start+=blockSize)
+    {
+      const UInt rows = std::min(blockSize, count-start);
+      UInt n = 0; // stack size
+      for(const auto &instr : program)
+      {
+        switch(instr.op)
+        {
+          case VALUE:
+            std::fill_n(stack(n++), rows, instr.value);
+            break;
+          case SLOT:
+            std::copy_n(slots[instr.index]+start, rows, stack(n++));
+            break;
+          case NEGATIVE:
+          {
+            Double *a = stack(n-1);
+            for(UInt i=0; i<rows; i++)
+              a[i] = -a[i];
+            break;
+          }
+          case ADD:
+          {
+            n--;
+            Double *a = stack(n-1); const Double *b = stack(n);
+            for(UInt i=0; i<rows; i++)
+              a[i] += b[i];
+            break;
+          }
+          case SUB:
+          {
+            n--;
+            Double *a = stack(n-1); const Double *b = stack(n);
+            for(UInt i=0; i<rows; i++)
+              a[i] -= b[i];
+            break;
+          }
+          case MULT:
+          {
+            n--;
+            Double *a = stack(n-1); const Double *b = stack(n);
+            for(UInt i=0; i<rows; i++)
+              a[i] *= b[i];
+            break;
+          }
+          case DIV:
+          {
+            n--;
+            Double *a = stack(n-1); const Double *b = stack(n);
+            for(UInt i=0; i<rows; i++)
+              a[i] /= b[i];
+            break;
+          }
+          case POW:
+          {
+            n--;
+            Double *a = stack(n-1); const Double *b = stack(n);
+            for(UInt i=0; i<rows; i++)
+              a[i] = std::pow(a[i], b[i]);
+            break;
+          }
+          case IF:
+          {
+            n-=2;
+            Double *a = stack(n-1); const Double *b = stack(n); const Double *c = stack(n+1);
+            for(UInt i=0; i<rows; i++)
+              a[i] = (a[i] != 0.) ? b[i] : c[i];
+            break;
+          }
+          case FUNCTION1:
+          {
+            auto func = static_cast<const ExpressionFunction1*>(instr.function);
+            Double *a = stack(n-1);
+            for(UInt i=0; i<rows; i++)
+              a[i] = func->function(a[i]);
+            break;
+          }
+          case FUNCTION2:
+          {
+            n--;
+            auto func = static_cast<const ExpressionFunction2*>(instr.function);
+            Double *a = stack(n-1); const Double *b = stack(n);
+            for(UInt i=0; i<rows; i++)
+              a[i] = func->function(a[i], b[i]);
+            break;
+          }
+          case FUNCTION3:
+          {
+            n-=2;
+            auto func = static_cast<const ExpressionFunction3*>(instr.function);
+            Double *a = stack(n-1); const Double *b = stack(n); const Double *c = stack(n+1);
+            for(UInt i=0; i<rows; i++)
+              a[i] = func->function(a[i], b[i], c[i]);
+            break;
+          }
+        }
+      }
+      std::copy_n(stack(0), rows, result+start);
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW_EXTRA("evaluate '"+text+"'", e)
+  }
+}
+
 /***********************************************/
 /***********************************************/
 
@@ -49,6 +49,7 @@ operations and functions are defined:
 
 class Expression;
 class ExpressionVariable;
+class ExpressionCompiled;
 class VariableList;
 typedef std::shared_ptr<Expression> ExpressionPtr;
 typedef std::shared_ptr<ExpressionVariable> ExpressionVariablePtr;
@@ -97,6 +98,9 @@ public:
   * @param var derivative with respect to this variable. */
   virtual ExpressionPtr derivative(const std::string &var) const = 0;
 
+  /// Internal: append bytecode of this (sub)tree (see ExpressionCompiled).
+  virtual void compile(ExpressionCompiled &compiled) const = 0;
+
   /** @brief Deep copy of an expression. */
   virtual ExpressionPtr clone() const = 0;
 
@@ -193,8 +197,92 @@ public:
 
   /** @brief Returns the result of the @a StringParser. */
   std::string getParsedText(const VariableList &varList, Bool &resolved) const;
+
+  /** @brief Expression tree of the variable.
+  * The @a StringParser with the @a varList is called before and
+  * if not all variables {names} can be resolved an exception is thrown. */
+  ExpressionPtr expression(const VariableList &varList) const;
 };
 
+/***** CLASS ***********************************/
+
+/** @brief Expression compiled into flat stack bytecode for fast bulk evaluation.
+* @ingroup parserGroup
+* The variables given as @a slotNames are bound to slots (indices) at compile time,
+* their values are given directly at evaluation without any lookup by name.
+* All other variables are resolved with the variable list and constant parts are simplified.
+* Variables which depend on slot variables (e.g. 'a=2*data0') are compiled inline.
+* The vectorized evaluation computes many rows at once, where the slot values are given as columns.
+* In the vectorized and the compiled scalar evaluation both branches of if(c,x,y) are evaluated.
+* @code
+* ExpressionCompiled compiled(expr, varList, {"data0", "data1"});
+* Double y = compiled.evaluate({1.0, 2.0});
+* compiled.evaluate(rows, {data0Column, data1Column}, result);
+* @endcode */
+class ExpressionCompiled
+{
+public:
+  /** @brief Operation codes (Internal). */
+  enum OpCode : UInt {VALUE, SLOT, NEGATIVE, ADD, SUB, MULT, DIV, POW, IF, FUNCTION1, FUNCTION2, FUNCTION3};
+
+private:
+  struct Instruction
+  {
+    OpCode            op;
+    UInt              index;    // slot index
+    Double            value;    // constant value
+    const Expression *function; // generic function (tree node)
+  };
+
+  std::vector<Instruction>   program;
+  std::vector<ExpressionPtr> trees;     // keep function nodes alive
+  std::vector<std::string>   slotNames;
+  UInt                       depth, maxDepth;
+  std::string                text;
+  // only during compilation
+  const VariableList        *varList;
+  std::vector<std::string>   inlined;   // detect circular definitions
+
+  void compile(ExpressionPtr expr);
+
+public:
+  /// Default constructor (empty program).
+  ExpressionCompiled() : depth(0), maxDepth(0), varList(nullptr) {}
+
+  /** @brief Compile the expression.
+  * @param expr expression variable to compile.
+  * @param varList values of all other variables.
+  * @param slotNames variables which are given at evaluation. */
+  ExpressionCompiled(ExpressionVariablePtr expr, const VariableList &varList, const std::vector<std::string> &slotNames);
+
+  /** @copydoc ExpressionCompiled(ExpressionVariablePtr, const VariableList &, const std::vector<std::string> &) */
+  ExpressionCompiled(ExpressionPtr expr, const VariableList &varList, const std::vector<std::string> &slotNames);
+
+  /** @brief Number of slot variables. */
+  UInt slotCount() const {return slotNames.size();}
+
+  /** @brief Is the result independent of the slot variables? */
+  Bool isConstant() const {return std::none_of(program.begin(), program.end(), [](const Instruction &i) {return i.op == SLOT;});}
+
+  /** @brief Evaluate for one set of slot values.
+  * @param slots values of the slot variables in the order of @a slotNames. */
+  Double evaluate(const Double *slots) const;
+
+  /** @copydoc evaluate(const Double *) const */
+  Double evaluate(const std::vector<Double> &slots) const {return evaluate(slots.data());}
+
+  /** @brief Vectorized evaluation of @a count rows.
+  * @param count number of rows.
+  * @param slots for each slot variable a pointer to @a count contiguous values.
+  * @param[out] result @a count contiguous values. */
+  void evaluate(UInt count, const std::vector<const Double*> &slots, Double *result) const;
+
+  /// Internal: append instructions.
+  void emit(OpCode op);
+  void emitValue(Double value);
+  void emitVariable(const std::string &name);
+  void emitFunction(OpCode op, const Expression *function);
+};
 
 /***** CLASS ***********************************/
 
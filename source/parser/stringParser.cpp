@@ -18,6 +18,22 @@
 
 /***********************************************/
 
+// expressions are parsed only once (e.g. the same text is expanded in every loop iteration)
+static ExpressionPtr parseExpression(const std::string &text)
+{
+  thread_local std::map<std::string, ExpressionPtr> cache;
+  auto iter = cache.find(text);
+  if(iter != cache.end())
+    return iter->second;
+  if(cache.size() > 10000)
+    cache.clear();
+  ExpressionPtr expr = Expression::parse(text);
+  cache[text] = expr;
+  return expr;
+}
+
+/***********************************************/
+
 // parse after '{'
 static std::string parseVar(const std::string &text, const VariableList &varList, std::string::size_type &pos, Bool &resolved)
 {
@@ -84,7 +100,7 @@ static std::string parseVar(const std::string &text, const VariableList &varList
   }
 
   // parse expression
-  ExpressionPtr expr = Expression::parse(result);
+  ExpressionPtr expr = parseExpression(result);
   Double value = 0;
   try
   {
@@ -147,3 +163,112 @@ std::string StringParser::parse(const std::string &text, const VariableList &var
 }
 
 /***********************************************/
+
+StringParser::Template::Template(const std::string &text) : text(text)
+{
+  std::string::size_type pos = 0;
+  for(;;)
+  {
+    auto posOld = pos;
+    pos = text.find('{', posOld);
+    if(pos != posOld)
+      parts.push_back(Part{LITERAL, text.substr(posOld, pos-posOld), "", nullptr});
+    if(pos == std::string::npos)
+      break;
+
+    // nested or incomplete terms are expanded at each call
+    auto end = text.find_first_of("{}", pos+1);
+    if((end == std::string::npos) || (text.at(end) == '{'))
+    {
+      parts.push_back(Part{TEXT, text.substr(pos), "", nullptr});
+      break;
+    }
+
+    const std::string term = text.substr(pos+1, end-pos-1);
+    const auto posColon = term.find(':');
+    if(posColon == std::string::npos)
+    {
+      // trim white space
+      auto start = term.find_first_not_of(" \t");
+      if(start != std::string::npos)
+        parts.push_back(Part{VARIABLE, term.substr(start, term.find_last_not_of(" \t")-start+1), "", nullptr});
+    }
+    else
+    {
+      try
+      {
+        parts.push_back(Part{EXPRESSION, term.substr(0, posColon), term.substr(posColon+1), parseExpression(term.substr(0, posColon))});
+      }
+      catch(std::exception &/*e*/)
+      {
+        parts.push_back(Part{TEXT, text.substr(pos, end-pos+1), "", nullptr});
+      }
+    }
+    pos = end+1;
+  }
+}
+
+/***********************************************/
+
+std::string StringParser::Template::parse(const VariableList &varList, Bool &resolved) const
+{
+  resolved = TRUE;
+  std::string result;
+  for(const Part &part : parts)
+    switch(part.type)
+    {
+      case LITERAL:
+        result += part.text;
+        break;
+      case VARIABLE:
+      {
+        auto variable = varList.find(part.text);
+        if(!variable)
+        {
+          resolved = FALSE;
+          result += '{'+part.text+'}';
+          break;
+        }
+        result += variable->getParsedText(varList, resolved);
+        break;
+      }
+      case EXPRESSION:
+        try
+        {
+          result += part.expr->evaluate(varList)%part.format;
+        }
+        catch(std::exception &/*e*/)
+        {
+          result += '{'+part.text+':'+part.format+'}';
+        }
+        break;
+      case TEXT:
+      {
+        Bool resolvedPart;
+        result += StringParser::parse("(unknown)", part.text, varList, resolvedPart);
+        resolved = resolved && resolvedPart;
+        break;
+      }
+    }
+  return result;
+}
+
+/***********************************************/
+
+std::string StringParser::Template::parse(const VariableList &varList) const
+{
+  try
+  {
+    Bool resolved;
+    std::string result = parse(varList, resolved);
+    if(!resolved)
+      throw(Exception("unresolved variables"));
+    return result;
+  }
+  catch(std::exception &e)
+  {
+    throw(Exception("Parser error in '"+text+"'\n"+e.what()));
+  }
+}
+
+/***********************************************/
@@ -104,6 +104,34 @@ namespace StringParser
   * Convenience function.
   * An expception is thrown if the string cannot resolved completly. */
   std::string parse(const std::string &text, const VariableList &varList);
+
+  /** @brief Text parsed once for repeated expansion.
+  * The text is split into literal parts, variables {variable} and expressions {expression:format} at construction.
+  * An expansion (e.g. a file name in every loop iteration) only looks up the variables and evaluates the expressions.
+  * Nested terms and terms with syntax errors are expanded by @ref parse() at each call. */
+  class Template
+  {
+    enum Type {LITERAL, VARIABLE, EXPRESSION, TEXT};
+    struct Part
+    {
+      Type          type;
+      std::string   text;   // literal, variable name, or unparsed term
+      std::string   format;
+      ExpressionPtr expr;
+    };
+    std::string       text;
+    std::vector<Part> parts;
+
+  public:
+    explicit Template(const std::string &text);
+
+    /** @brief Same as @ref parse(const std::string &, const std::string &, const VariableList &, Bool &). */
+    std::string parse(const VariableList &varList, Bool &resolved) const;
+
+    /** @brief Same as @ref parse(const std::string &, const VariableList &).
+    * An expception is thrown if the string cannot resolved completly. */
+    std::string parse(const VariableList &varList) const;
+  };
 }
 
 /***********************************************/
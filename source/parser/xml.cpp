@@ -23,31 +23,58 @@
 XmlNodePtr XmlNode::clone() const
 {
   XmlNodePtr ptr = create(name_);
-  ptr->text_ = text_;
-  for(auto attr : attribute)
-    ptr->addAttribute(std::make_shared<XmlAttribute>(*attr));
-  for(auto child : children)
-    ptr->addChild(child->clone());
+  ptr->text_     = text_;
+  ptr->children  = children;  // shared until modified
+  ptr->attribute = attribute; // shared until modified
   return ptr;
+}
+
+/***********************************************/
 
+void XmlNode::detachChildren()
+{
+  if(!children)
+    children = std::make_shared<std::list<XmlNodePtr>>();
+  else if(children.use_count() > 1)
+  {
+    auto list = std::make_shared<std::list<XmlNodePtr>>();
+    for(auto child : *children)
+      list->push_back(child->clone());
+    children = list;
+  }
+}
+
+/***********************************************/
+
+void XmlNode::detachAttributes()
+{
+  if(!attribute)
+    attribute = std::make_shared<std::list<XmlAttrPtr>>();
+  else if(attribute.use_count() > 1)
+    attribute = std::make_shared<std::list<XmlAttrPtr>>(*attribute); // attributes itself are not modified
 }
 
 /***********************************************/
 
 UInt XmlNode::getChildCount(const std::string &name)
 {
-  return std::count_if(children.begin(), children.end(), [&name](auto child) {return child->getName() == name;});
+  if(!children)
+    return 0;
+  return std::count_if(children->begin(), children->end(), [&name](auto child) {return child->getName() == name;});
 }
 
 /***********************************************/
 
 XmlNodePtr XmlNode::getChild(const std::string &name)
 {
-  auto iter = std::find_if(children.begin(), children.end(), [&name](auto child) {return child->getName() == name;});
-  if(iter == children.end())
+  if(!children)
+    return XmlNodePtr();
+  detachChildren();
+  auto iter = std::find_if(children->begin(), children->end(), [&name](auto child) {return child->getName() == name;});
+  if(iter == children->end())
     return XmlNodePtr();
   XmlNodePtr ptr = *iter;
-  children.erase(iter);
+  children->erase(iter);
   return ptr;
 }
 
@@ -55,19 +82,25 @@ XmlNodePtr XmlNode::getChild(const std::string &name)
 
 XmlNodePtr XmlNode::findChild(const std::string &name)
 {
-  auto iter = std::find_if(children.begin(), children.end(), [&name](auto child) {return child->getName() == name;});
-  return (iter != children.end()) ? *iter : XmlNodePtr();
+  if(!children)
+    return XmlNodePtr();
+  detachChildren();
+  auto iter = std::find_if(children->begin(), children->end(), [&name](auto child) {return child->getName() == name;});
+  return (iter != children->end()) ? *iter : XmlNodePtr();
 }
 
 /***********************************************/
 
 XmlNodePtr XmlNode::getNextChild()
 {
+  if(!children)
+    return XmlNodePtr();
+  detachChildren();
   XmlNodePtr ptr;
-  if(!children.empty())
+  if(!children->empty())
   {
-    ptr = children.front();
-    children.pop_front();
+    ptr = children->front();
+    children->pop_front();
   }
   return ptr;
 }
@@ -77,11 +110,14 @@ XmlNodePtr XmlNode::getNextChild()
 
 XmlAttrPtr XmlNode::getAttribute(const std::string &name)
 {
-  auto iter = std::find_if(attribute.begin(), attribute.end(), [&name](auto attr) {return attr->getName() == name;});
-  if(iter == attribute.end())
+  if(!attribute)
+    return XmlAttrPtr();
+  detachAttributes();
+  auto iter = std::find_if(attribute->begin(), attribute->end(), [&name](auto attr) {return attr->getName() == name;});
+  if(iter == attribute->end())
     return XmlAttrPtr();
   XmlAttrPtr ptr = *iter;
-  attribute.erase(iter);
+  attribute->erase(iter);
   return ptr;
 }
 
@@ -89,8 +125,10 @@ XmlAttrPtr XmlNode::getAttribute(const std::string &name)
 
 XmlAttrPtr XmlNode::findAttribute(const std::string &name)
 {
-  auto iter = std::find_if(attribute.begin(), attribute.end(), [&name](auto attr) {return attr->getName() == name;});
-  return (iter != attribute.end()) ? *iter : XmlAttrPtr();
+  if(!attribute)
+    return XmlAttrPtr();
+  auto iter = std::find_if(attribute->begin(), attribute->end(), [&name](auto attr) {return attr->getName() == name;});
+  return (iter != attribute->end()) ? *iter : XmlAttrPtr();
 }
 
 
@@ -98,11 +136,14 @@ XmlAttrPtr XmlNode::findAttribute(const std::string &name)
 
 XmlAttrPtr XmlNode::getNextAttribute()
 {
+  if(!attribute)
+    return XmlAttrPtr();
+  detachAttributes();
   XmlAttrPtr ptr;
-  if(!attribute.empty())
+  if(!attribute->empty())
   {
-    ptr = attribute.front();
-    attribute.pop_front();
+    ptr = attribute->front();
+    attribute->pop_front();
   }
   return ptr;
 }
@@ -233,11 +274,12 @@ void XmlNode::write(std::ostream &stream, UInt depth)
   stream<<std::string(depth, '\t')<<"<"<<getName();
 
   // Attribute
-  for(auto attr : attribute)
-    stream<<" "<<attr->getName()<<"=\""<<sanitizeXML(attr->getText())<<"\"";
+  if(attribute)
+    for(auto attr : *attribute)
+      stream<<" "<<attr->getName()<<"=\""<<sanitizeXML(attr->getText())<<"\"";
 
   // short form?
-  if(getText().empty() && children.empty())
+  if(getText().empty() && !hasChildren())
   {
     stream<<"/>"<<std::endl;;
     return;
@@ -246,10 +288,10 @@ void XmlNode::write(std::ostream &stream, UInt depth)
   stream<<">"<<sanitizeXML(getText());
 
   // children
-  if(!children.empty())
+  if(hasChildren())
   {
     stream<<std::endl;
-    for(auto child : children)
+    for(auto child : *children)
       child->write(stream, depth+1);
     stream<<std::string(depth, '\t');
   }
@@ -65,15 +65,22 @@ public:
 * Der Baum wird beim auslesen direkt abgebaut,
 * so dass nur einmal auslesen moeglich ist.
 * Der Speicher wird mit std::shared_ptr verwaltet,
-* so dass man keinen Speicher freigeben muss. */
+* so dass man keinen Speicher freigeben muss.
+*
+* Copies created with @a clone() share the lists of children and attributes with the original
+* until one of them is modified (copy-on-write). Therefore, all member functions returning
+* children or modifying the lists make the lists of this node unique before.
+* Attributes must not be changed after adding them to a node. */
 class XmlNode
 {
-  std::string           name_;
-  std::string           text_;
-  std::list<XmlNodePtr> children;
-  std::list<XmlAttrPtr> attribute;
+  std::string                            name_;
+  std::string                            text_;
+  std::shared_ptr<std::list<XmlNodePtr>> children;  // nullptr if empty
+  std::shared_ptr<std::list<XmlAttrPtr>> attribute; // nullptr if empty
 
   void write(std::ostream &stream, UInt depth=0);
+  void detachChildren();   // copy-on-write: make list of children unique (and allocated)
+  void detachAttributes(); // copy-on-write: make list of attributes unique (and allocated)
 
 public:
   /// Constructor.
@@ -83,7 +90,9 @@ public:
   XmlNode &operator=(const XmlNode &node) = delete;
 
   /** @brief Deep copy.
-  * Creates a copy of the node and of all children. */
+  * Creates a copy of the node and of all children.
+  * The children are copied lazily at the first modification (copy-on-write),
+  * so cloning is cheap for subtrees which are never read. */
   XmlNodePtr clone() const;
 
   /** @brief Name of the node. */
@@ -109,9 +118,12 @@ public:
   template<typename T> void setValue(const T &var);
 
   /** @brief Has the node children nodes? */
-  Bool hasChildren() const {return !children.empty();}
+  Bool hasChildren() const {return children && !children->empty();}
+
+  std::list<XmlNodePtr> &getChildren() {detachChildren(); return *children;}
 
-  std::list<XmlNodePtr> &getChildren() {return children;}
+  /** @brief Removes all children. */
+  void clearChildren() {children = nullptr;}
 
   /** @brief Number of children with @a name. */
   UInt getChildCount(const std::string &name);
@@ -127,19 +139,19 @@ public:
   /** @brief Append a new child.
   * It is not allowed to have the same node multiple times in the tree.
   * (Create a copy with @a clone() before). */
-  void addChild(const XmlNodePtr &child) {children.push_back(child);}
+  void addChild(const XmlNodePtr &child) {detachChildren(); children->push_back(child);}
 
   /** @brief Insert a new child at begin.
   * It is not allowed to have the same node multiple times in the tree.
   * (Create a copy with @a clone() before). */
-  void prependChild(const XmlNodePtr &child) {children.push_front(child);}
+  void prependChild(const XmlNodePtr &child) {detachChildren(); children->push_front(child);}
 
   /** @brief Returns the next child.
   * The child is removed from tree. If child not exists, a NULL pointer is returned. */
   XmlNodePtr getNextChild();
 
   /** @brief Has the node attributes? */
-  Bool hasAttribute() const {return !attribute.empty();}
+  Bool hasAttribute() const {return attribute && !attribute->empty();}
 
   /** @brief Returns the the first attribute with @a name.
   * The attribute is removed from the node. If attribute does not exist, a NULL pointer is returned. */
@@ -151,7 +163,7 @@ public:
 
   /** @brief Append a new attribute.
   * It is not allowed to have the same attribute multiple times in the tree. */
-  void addAttribute(const XmlAttrPtr &attr) {attribute.push_back(attr);}
+  void addAttribute(const XmlAttrPtr &attr) {detachAttributes(); attribute->push_back(attr);}
 
   /** @brief Returns the next attribute.
   * The attribute is removed from the node. If attribute does not exist, a NULL pointer is returned. */
@@ -356,6 +368,12 @@ template<typename T> void XmlNode::setValue(const T &var)
   }
 }
 
+template<> inline void XmlNode::setValue(const Double &var) // Spezialization, same as the stream formatting above without the locale overhead
+{
+  char buffer[64];
+  text_.assign(buffer, std::snprintf(buffer, sizeof(buffer), "%.14e", var));
+}
+
 template<> inline void XmlNode::setValue(const Time  &var) // Spezialization
 {
   setValue(var.mjd());
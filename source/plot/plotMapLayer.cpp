@@ -38,6 +38,10 @@ it must be set with \config{increment}. To get a better display together with so
 the grid should be internally \config{resample}d to higher resolution.
 It is assumed that the points of \configFile{inputfileGriddedData}{griddedData} represents centers of grid cells.
 This assumption can be changed with \config{gridlineRegistered} (e.g if the data starts at the north pole).
+
+Grids finer than the pixels of the output (given by \config{options:width} and \config{options:dpi} of \program{PlotMap})
+are reduced to the mean values of coarser cells with \config{decimate}. This limits the temporary data files and
+the work of GMT to the number of pixels.
 )";
 
 class PlotMapLayerGrid : public PlotMapLayer
@@ -48,10 +52,14 @@ class PlotMapLayerGrid : public PlotMapLayer
   Double intermediateDpi, threshold;
   Char   interpolationMethod;
   Bool   resample;
+  Bool   decimate;
+  Angle  pixelSize;
 
 public:
   PlotMapLayerGrid(Config &config);
   Bool        requiresColorBar() const override {return TRUE;}
+  void        setPixelSize(Angle size) override {pixelSize = size;}
+  void        writeDataFile(const Ellipsoid &ellipsoid, const FileName &workingDirectory, UInt idxLayer) override;
   std::string scriptEntry() const override;
 };
 
@@ -87,6 +95,7 @@ PlotMapLayerGrid::PlotMapLayerGrid(Config &config)
       endSequence(config);
     }
     readConfig(config, "gridlineRegistered", isGridline, Config::DEFAULT,  "0", "treat input as point values instead of cell means");
+    readConfig(config, "decimate",           decimate,   Config::DEFAULT,  "1", "mean of cells smaller than a pixel of the output (dpi)");
     if(isCreateSchema(config)) return;
 
     GriddedData grid;
@@ -134,6 +143,62 @@ PlotMapLayerGrid::PlotMapLayerGrid(Config &config)
 
 /***********************************************/
 
+void PlotMapLayerGrid::writeDataFile(const Ellipsoid &ellipsoid, const FileName &workingDirectory, UInt idxLayer)
+{
+  try
+  {
+    const UInt factor = (decimate && (pixelSize > 0)) ? static_cast<UInt>(std::floor(pixelSize/increment)) : 1;
+    if((factor < 2) || !points.size())
+    {
+      PlotMapLayer::writeDataFile(ellipsoid, workingDirectory, idxLayer);
+      return;
+    }
+
+    // mean values of coarser cells
+    // ----------------------------
+    std::vector<Double> lon(points.size()), lat(points.size());
+    for(UInt i=0; i<points.size(); i++)
+    {
+      Angle  L, B;
+      Double h;
+      ellipsoid(points.at(i), L, B, h);
+      lon.at(i) = L;
+      lat.at(i) = B;
+    }
+    const Double size = factor*Double(increment);
+    const Double minL = *std::min_element(lon.begin(), lon.end()) - 0.5*increment;
+    const Double minB = *std::min_element(lat.begin(), lat.end()) - 0.5*increment;
+    const UInt   rows = static_cast<UInt>(std::floor((*std::max_element(lat.begin(), lat.end())-minB)/size))+1;
+    const UInt   cols = static_cast<UInt>(std::floor((*std::max_element(lon.begin(), lon.end())-minL)/size))+1;
+    Matrix sum(rows, cols), count(rows, cols);
+    for(UInt i=0; i<points.size(); i++)
+      if(!std::isnan(data(i, 0)))
+      {
+        const UInt row = static_cast<UInt>(std::floor((lat.at(i)-minB)/size));
+        const UInt col = static_cast<UInt>(std::floor((lon.at(i)-minL)/size));
+        sum(row, col)   += data(i, 0);
+        count(row, col) += 1;
+      }
+
+    dataFileName = "data."+idxLayer%"%i.dat"s;
+    OutFile file(workingDirectory.append(dataFileName), std::ios::out | std::ios::binary);
+    for(UInt col=0; col<cols; col++)
+      for(UInt row=0; row<rows; row++)
+        if(count(row, col))
+        {
+          std::vector<Double> line = {(minL+(col+0.5)*size)*RAD2DEG, (minB+(row+0.5)*size)*RAD2DEG, sum(row, col)/count(row, col)};
+          file.write(reinterpret_cast<char*>(line.data()), line.size()*sizeof(Double));
+        }
+    increment = Angle(size);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 std::string PlotMapLayerGrid::scriptEntry() const
 {
   try
@@ -530,15 +595,17 @@ void PlotMapLayerPolygon::writeDataFile(const Ellipsoid &/*ellipsoid*/, const Fi
   try
   {
     dataFileName = "polygon."+idxLayer%"%i.dat"s;
-    OutFile file(workingDirectory.append(dataFileName));
-    if(!std::isnan(value)) file<<">-Z"<<value<<std::endl;
+    OutFile file(workingDirectory.append(dataFileName), std::ios::out | std::ios::binary);
+    // records with all values NaN separate the segments in binary GMT files
+    const std::vector<Double> separator(2, NAN_EXPR);
     for(auto &p : polygons)
     {
+      file.write(reinterpret_cast<const char*>(separator.data()), separator.size()*sizeof(Double));
       for(UInt i=0; i<p.L.size(); i++)
       {
-        file<<p.L(i)*RAD2DEG<<" "<<p.B(i)*RAD2DEG<<std::endl;
+        std::vector<Double> line = {p.L(i)*RAD2DEG, p.B(i)*RAD2DEG};
+        file.write(reinterpret_cast<char*>(line.data()), line.size()*sizeof(Double));
       }
-      file<<">"<<std::endl;
     }
   }
   catch(std::exception &e)
@@ -554,9 +621,9 @@ std::string PlotMapLayerPolygon::scriptEntry() const
   try
   {
     std::stringstream ss;
-    ss<<"gmt psxy "<<dataFileName<<" -L -J -R";
+    ss<<"gmt psxy "<<dataFileName<<" -bi2d -L -J -R";
     if(fillColor) ss<<" -G"<<fillColor->str();
-    else if(!std::isnan(value)) ss<<" -CgroopsPlot.cpt";
+    else if(!std::isnan(value)) ss<<" -Z"<<value<<" -CgroopsPlot.cpt";
     if(line)
     {
       ss<<" -W"<<line->str();
@@ -54,6 +54,7 @@ public:
   virtual Bool requiresColorBar() const {return FALSE;}
   virtual void boundary(const Ellipsoid &ellipsoid, Angle &minL, Angle &maxL, Angle &minB, Angle &maxB) const;
   virtual void getIntervalZ(Bool isLogarithmic, Double &minZ, Double &maxZ) const;
+  virtual void setPixelSize(Angle /*pixelSize*/) {} //!< Size of a pixel in the output (details below are not visible).
   virtual void writeDataFile(const Ellipsoid &ellipsoid, const FileName &workingDirectory, UInt idxLayer);
   virtual std::string scriptStatisticsInfo(UInt fontSize, Double width, const FileName &workingDirectory, UInt idxLayer) const;
   virtual std::string scriptEntry() const = 0;
@@ -328,11 +328,18 @@ void PlotBasics::read(Config &config, const std::string &nameProgram_, const Fil
     fileNamePlot = fileNamePlot_;
     title        = title_;
 
+    // each plot needs its own working directory,
+    // as independent plots can be rendered concurrently (e.g. in parallel loops)
+    std::string nameDirectory = "groopsPlot_"+fileNamePlot.baseName().str();
     baseDirectory = fileNamePlot.directory();
     if(std::getenv("GROOPS_PLOTDIR") && removeFiles)
+    {
       baseDirectory = FileName(std::getenv("GROOPS_PLOTDIR"));
+      // plots of different directories share GROOPS_PLOTDIR
+      nameDirectory += "_"+std::to_string(std::hash<std::string>()(System::currentWorkingDirectory().append(fileNamePlot).str()));
+    }
 
-    workingDirectory = baseDirectory.append("groopsPlot_"+fileNamePlot.baseName().str());
+    workingDirectory = baseDirectory.append(nameDirectory);
     System::createDirectories(workingDirectory);
   }
   catch(std::exception &e)
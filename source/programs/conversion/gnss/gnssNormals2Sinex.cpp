@@ -279,8 +279,10 @@ void GnssNormals2Sinex::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
     addVector(solutionNormalEquationVector, timeRef, info.parameterName, n, Vector(), parameterIsConstrained, stationList);
 
     // SOLUTION/NORMAL_EQUATION_MATRIX
-    Sinex::SinexSolutionMatrixPtr solutionNormalEquationMatrix = sinex.addBlock<Sinex::SinexSolutionMatrix>("SOLUTION/NORMAL_EQUATION_MATRIX "s + (N.isUpper() ? "U" : "L"));
+    const std::string labelNormalEquationMatrix = "SOLUTION/NORMAL_EQUATION_MATRIX "s + (N.isUpper() ? "U" : "L");
+    Sinex::SinexSolutionMatrixPtr solutionNormalEquationMatrix = sinex.addBlock<Sinex::SinexSolutionMatrix>(labelNormalEquationMatrix);
     solutionNormalEquationMatrix->setMatrix(N);
+    N = Matrix(); // free memory, the SINEX block holds a copy
 
     // SOLUTION/MATRIX_APRIORI
     if(dN.size())
@@ -302,7 +304,7 @@ void GnssNormals2Sinex::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
     {
       logStatus<<"write coordinates SINEX file <"<<fileNameSinexCoords<<">"<<Log::endl;
       sinex.removeBlock("SOLUTION/NORMAL_EQUATION_VECTOR");
-      sinex.removeBlock("SOLUTION/NORMAL_EQUATION_MATRIX "s + (N.isUpper() ? "U" : "L"));
+      sinex.removeBlock(labelNormalEquationMatrix);
       if(dN.size())
         sinex.removeBlock("SOLUTION/MATRIX_APRIORI "s + (dN.isUpper() ? "U" : "L") + " INFO");
       sinex.writeFile(fileNameSinexCoords);
@@ -11,6 +11,7 @@
 /***********************************************/
 
 #include "base/import.h"
+#include <cstring>
 #include "base/string.h"
 #include "inputOutput/logging.h"
 #include "inputOutput/file.h"
@@ -18,7 +19,7 @@
 
 /***********************************************/
 
-FileInGrace::FileInGrace(const FileName &fileName, UInt &numberOfRecords)
+FileInGrace::FileInGrace(const FileName &fileName, UInt &numberOfRecords) : isBinary(FALSE), pos(0)
 {
   try
   {
@@ -54,6 +55,16 @@ FileInGrace::FileInGrace(const FileName &fileName, UInt &numberOfRecords)
       if(line.find("# End of YAML header") == 0)
         break;
     }
+
+    // records are decoded from memory instead of stream reads per field
+    if(isBinary)
+    {
+      file.exceptions(std::ios::badbit);
+      std::vector<char> block(1<<20);
+      while(file.read(block.data(), block.size()) || file.gcount())
+        buffer.append(block.data(), file.gcount());
+      file.close();
+    }
   }
   catch(std::exception &e)
   {
@@ -71,15 +82,23 @@ void FileInGrace::changeByteOrder(char *bytes, UInt n) const
 
 /***********************************************/
 
+void FileInGrace::readBinary(void *x, UInt n)
+{
+  if(pos+n > buffer.size())
+    throw(Exception("unexpected end of file"));
+  std::memcpy(x, buffer.data()+pos, n);
+  changeByteOrder(reinterpret_cast<char*>(x), n);
+  pos += n;
+}
+
+/***********************************************/
+
 FileInGrace &FileInGrace::operator>>(Double &x)
 {
   try
   {
     if(isBinary)
-    {
-      file.read(reinterpret_cast<char*>(&x), sizeof(x));
-      changeByteOrder(reinterpret_cast<char*>(&x), sizeof(x));
-    }
+      readBinary(&x, sizeof(x));
     else
       file>>x;
     return *this;
@@ -97,10 +116,7 @@ FileInGrace &FileInGrace::operator>>(Float &x)
   try
   {
     if(isBinary)
-    {
-      file.read(reinterpret_cast<char*>(&x), sizeof(x));
-      changeByteOrder(reinterpret_cast<char*>(&x), sizeof(x));
-    }
+      readBinary(&x, sizeof(x));
     else
       file>>x;
     return *this;
@@ -118,10 +134,7 @@ FileInGrace &FileInGrace::operator>>(Int32 &x)
   try
   {
     if(isBinary)
-    {
-      file.read(reinterpret_cast<char*>(&x), sizeof(x));
-      changeByteOrder(reinterpret_cast<char*>(&x), sizeof(x));
-    }
+      readBinary(&x, sizeof(x));
     else
       file>>x;
     return *this;
@@ -139,10 +152,7 @@ FileInGrace &FileInGrace::operator>>(Int64 &x)
   try
   {
     if(isBinary)
-    {
-      file.read(reinterpret_cast<char*>(&x), sizeof(x));
-      changeByteOrder(reinterpret_cast<char*>(&x), sizeof(x));
-    }
+      readBinary(&x, sizeof(x));
     else
       file>>x;
     return *this;
@@ -160,10 +170,7 @@ FileInGrace &FileInGrace::operator>>(UInt16 &x)
   try
   {
     if(isBinary)
-    {
-      file.read(reinterpret_cast<char*>(&x), sizeof(x));
-      changeByteOrder(reinterpret_cast<char*>(&x), sizeof(x));
-    }
+      readBinary(&x, sizeof(x));
     else
       file>>x;
     return *this;
@@ -180,10 +187,7 @@ FileInGrace &FileInGrace::operator>>(UInt32 &x)
   try
   {
     if(isBinary)
-    {
-      file.read(reinterpret_cast<char*>(&x), sizeof(x));
-      changeByteOrder(reinterpret_cast<char*>(&x), sizeof(x));
-    }
+      readBinary(&x, sizeof(x));
     else
       file>>x;
     return *this;
@@ -201,10 +205,7 @@ FileInGrace &FileInGrace::operator>>(UInt64 &x)
   try
   {
     if(isBinary)
-    {
-      file.read(reinterpret_cast<char*>(&x), sizeof(x));
-      changeByteOrder(reinterpret_cast<char*>(&x), sizeof(x));
-    }
+      readBinary(&x, sizeof(x));
     else
       file>>x;
     return *this;
@@ -222,10 +223,7 @@ FileInGrace &FileInGrace::operator>>(Byte &x)
   try
   {
     if(isBinary)
-    {
-      file.read(reinterpret_cast<char*>(&x), sizeof(x));
-      changeByteOrder(reinterpret_cast<char*>(&x), sizeof(x));
-    }
+      readBinary(&x, sizeof(x));
     else
       file>>x;
     return *this;
@@ -243,10 +241,7 @@ FileInGrace &FileInGrace::operator>>(const Flag &x)
   try
   {
     if(isBinary)
-    {
-      file.read(reinterpret_cast<char*>(x.value), x.size);
-      changeByteOrder(reinterpret_cast<char*>(x.value), x.size);
-    }
+      readBinary(x.value, x.size);
     else
     {
       UInt64 v = 0;
@@ -23,12 +23,17 @@
 */
 class FileInGrace
 {
-  InFile file;
-  Bool   isBinary;
+  InFile      file;
+  Bool        isBinary;
+  std::string buffer; // binary records are read at once after the header
+  UInt        pos;
 
   // change the byte order for n Bytes (e.g. Intel <-> SUN systems)
   void changeByteOrder(char *bytes, UInt n) const;
 
+  // next n Bytes of the binary buffer with changed byte order
+  void readBinary(void *x, UInt n);
+
 public:
   class Flag
   {
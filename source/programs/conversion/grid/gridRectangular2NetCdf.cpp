@@ -16,6 +16,10 @@ static const char *docstring = R"(
 This program converts a sequence of \configFile{inputfileGridRectangular}{griddedData}
 to a COARDS compliant NetCDF file.
 
+The grids are written epoch by epoch as time slices, each stored in one chunk of the data variables.
+With \config{compressionLevel} the data variables are compressed (deflate with byte shuffling),
+which reduces the size of long time series considerably.
+
 See also \program{NetCdfInfo}, \program{NetCdf2GridRectangular}.
 )";
 
@@ -119,12 +123,14 @@ void GridRectangular2NetCdf::run(Config &config, Parallel::CommunicatorPtr /*com
     std::vector<DataVariable> dataVariables;
     std::vector<Attribute>    globalAttributes;
     TimeSeriesPtr             timeSeries;
+    UInt                      compressionLevel;
 
     readConfig(config, "outputfileNetCdf",         fileNameOut,      Config::MUSTSET,  "", "file name of NetCDF output");
     readConfig(config, "inputfileGridRectangular", fileNameIn,       Config::MUSTSET,  "", "input grid sequence");
     readConfig(config, "times",                    timeSeries,       Config::DEFAULT,  "", "values for time axis (COARDS specification)");
     readConfig(config, "dataVariable",             dataVariables,    Config::MUSTSET,  "", "metadata for data variables");
     readConfig(config, "globalAttribute",          globalAttributes, Config::OPTIONAL, "", "additional meta data");
+    readConfig(config, "compressionLevel",         compressionLevel, Config::DEFAULT,  "0", "deflate level of data variables (0: uncompressed, 1: fastest, 9: smallest)");
     if(isCreateSchema(config)) return;
 
 #ifdef GROOPS_DISABLE_NETCDF
@@ -197,6 +203,10 @@ void GridRectangular2NetCdf::run(Config &config, Parallel::CommunicatorPtr /*com
         for(auto &data : dataVariables)
         {
           data.variable = file.addVariable(data.name, data.dataType, file.dimensions());
+          // one chunk per epoch: each grid is written as a single time slice
+          if(times.size())
+            data.variable.setChunking({1, grid.latitudes.size(), grid.longitudes.size()});
+          data.variable.setCompression(compressionLevel);
           for(auto &attr : data.attributes)
           {
             if(attr.text.empty())
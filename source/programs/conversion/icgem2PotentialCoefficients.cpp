@@ -96,14 +96,19 @@ void Icgem2PotentialCoefficients::run(Config &config, Parallel::CommunicatorPtr
       return date2time(year, month, day) + mjd2time(fraction);
     };
 
-    auto splitLine = [](const std::string &line)
+    // tokens are reused for all lines (no memory allocations)
+    auto splitLine = [](const std::string &line, std::vector<std::string> &tokens)
     {
-      std::vector<std::string> tokens;
-      std::stringstream ss(line);
-      std::string token;
-      while(ss >> token)
-        tokens.push_back(token);
-      return tokens;
+      UInt count = 0;
+      for(auto pos = line.find_first_not_of(" \t\r"); pos != std::string::npos; count++)
+      {
+        const auto end = std::min(line.find_first_of(" \t\r", pos), line.size());
+        if(count >= tokens.size())
+          tokens.emplace_back();
+        tokens.at(count).assign(line, pos, end-pos);
+        pos = line.find_first_not_of(" \t\r", end);
+      }
+      tokens.resize(count);
     };
 
     // read header
@@ -161,13 +166,14 @@ void Icgem2PotentialCoefficients::run(Config &config, Parallel::CommunicatorPtr
     // ---------
     logStatus<<"read potential coeffcients"<<Log::endl;
     std::vector<Coefficient> coefficients;
+    std::vector<std::string> tokens;
     UInt maxDegree = 0;
     while(!inputFile.eof())
     {
       std::getline(inputFile, line);
       if(line.size() == 0)
         continue;
-      std::vector<std::string> tokens = splitLine(line);
+      splitLine(line, tokens);
       if(tokens.size()<5)
         continue;
       UInt offset = 1;
@@ -175,8 +181,8 @@ void Icgem2PotentialCoefficients::run(Config &config, Parallel::CommunicatorPtr
       maxDegree = std::max(n, maxDegree);
       UInt m = std::stoul(tokens.at(offset++));
 
-      Double cnm = std::stod(tokens.at(offset++));
-      Double snm = std::stod(tokens.at(offset++));
+      Double cnm = String::toDouble(tokens.at(offset++));
+      Double snm = String::toDouble(tokens.at(offset++));
 
       Double cnm_error = 0.0;
       Double snm_error = 0.0;
@@ -184,13 +190,13 @@ void Icgem2PotentialCoefficients::run(Config &config, Parallel::CommunicatorPtr
       if(hasFormalError && hasCalibratedError)
       {
         if(useFormalErrors) offset += 2;
-        cnm_error = std::stod(tokens.at(offset++));
-        snm_error = std::stod(tokens.at(offset++));
+        cnm_error = String::toDouble(tokens.at(offset++));
+        snm_error = String::toDouble(tokens.at(offset++));
       }
       if(hasFormalError || hasCalibratedError)
       {
-        cnm_error = std::stod(tokens.at(offset++));
-        snm_error = std::stod(tokens.at(offset++));
+        cnm_error = String::toDouble(tokens.at(offset++));
+        snm_error = String::toDouble(tokens.at(offset++));
       }
       Coefficient c(n, m, cnm, snm, cnm_error*cnm_error, snm_error*snm_error);
 
@@ -224,7 +230,7 @@ void Icgem2PotentialCoefficients::run(Config &config, Parallel::CommunicatorPtr
           c.t0 = parseTimeStamp(tokens.at(offset++));
           c.t1 = parseTimeStamp(tokens.at(offset++));
         }
-        c.period = std::stod(tokens.at(offset));
+        c.period = String::toDouble(tokens.at(offset));
       }
       else if(tokens.front() == "asin")
       {
@@ -234,7 +240,7 @@ void Icgem2PotentialCoefficients::run(Config &config, Parallel::CommunicatorPtr
           c.t0 = parseTimeStamp(tokens.at(offset++));
           c.t1 = parseTimeStamp(tokens.at(offset++));
         }
-        c.period = std::stod(tokens.at(offset));
+        c.period = String::toDouble(tokens.at(offset));
       }
       if(!isVersion2)
       {
@@ -94,7 +94,7 @@ void Sp3Format2Orbit::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
 
           if(String::startsWith(line, "+"))     // satellite list and orbit accuracy lines
           {
-            if(satId.empty() && String::toInt(line.substr(3, 3)) > 0)
+            if(satId.empty() && String::toInt(line, 3, 3) > 0)
               satId = line.substr(9, 3);
             continue;
           }
@@ -113,12 +113,12 @@ void Sp3Format2Orbit::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
           // -----
           if(String::startsWith(line, "* "))
           {
-            UInt   year  = String::toInt(line.substr(3, 4));
-            UInt   month = String::toInt(line.substr(8, 2));
-            UInt   day   = String::toInt(line.substr(11, 2));
-            UInt   hour  = String::toInt(line.substr(14, 2));
-            UInt   min   = String::toInt(line.substr(17, 2));
-            Double sec   = String::toDouble(line.substr(20, 11));
+            UInt   year  = String::toInt(line, 3, 4);
+            UInt   month = String::toInt(line, 8, 2);
+            UInt   day   = String::toInt(line, 11, 2);
+            UInt   hour  = String::toInt(line, 14, 2);
+            UInt   min   = String::toInt(line, 17, 2);
+            Double sec   = String::toDouble(line, 20, 11);
             time = date2time(year, month, day, hour, min, sec);
             if(timeSystem == UTC)
               time = timeUTC2GPS(time);
@@ -136,10 +136,10 @@ void Sp3Format2Orbit::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
             else
             {
               positionRecord = TRUE;
-              Double x = String::toDouble(line.substr(4, 14));
-              Double y = String::toDouble(line.substr(18, 14));
-              Double z = String::toDouble(line.substr(32, 14));
-              Double c = String::toDouble(line.substr(46, 14));
+              Double x = String::toDouble(line, 4, 14);
+              Double y = String::toDouble(line, 18, 14);
+              Double z = String::toDouble(line, 32, 14);
+              Double c = String::toDouble(line, 46, 14);
 
               if(x != 0. && y != 0. && z != 0.)
               {
@@ -162,12 +162,12 @@ void Sp3Format2Orbit::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
           // -------------------
           if(String::startsWith(line, "EP") && positionRecord)
           {
-            Double xx = String::toDouble(line.substr(4, 4));
-            Double yy = String::toDouble(line.substr(9, 4));
-            Double zz = String::toDouble(line.substr(14, 4));
-            Double xy = String::toDouble(line.substr(27, 8));
-            Double xz = String::toDouble(line.substr(36, 8));
-            Double yz = String::toDouble(line.substr(54, 8));
+            Double xx = String::toDouble(line, 4, 4);
+            Double yy = String::toDouble(line, 9, 4);
+            Double zz = String::toDouble(line, 14, 4);
+            Double xy = String::toDouble(line, 27, 8);
+            Double xz = String::toDouble(line, 36, 8);
+            Double yz = String::toDouble(line, 54, 8);
             Covariance3dEpoch epochCov;
             epochCov.time = time;
             // mm -> m, correlation [1e-7] -> covariance
@@ -179,9 +179,9 @@ void Sp3Format2Orbit::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
           // --------
           if(String::startsWith(line, "V") && (line.substr(1,3) == satId) && positionRecord)
           {
-            Double x = String::toDouble(line.substr(4, 14));
-            Double y = String::toDouble(line.substr(18, 14));
-            Double z = String::toDouble(line.substr(32, 14));
+            Double x = String::toDouble(line, 4, 14);
+            Double y = String::toDouble(line, 18, 14);
+            Double z = String::toDouble(line, 32, 14);
             if(x != 0. && y != 0. && z != 0.)
               orbit.at(orbit.size()-1).velocity = 0.1*Vector3d(x,y,z);  // dm/s -> m/s
           }
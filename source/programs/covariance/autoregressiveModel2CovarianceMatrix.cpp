@@ -13,8 +13,9 @@
 #define DOCSTRING docstring
 static const char *docstring = R"(
 This program computes the covariance structure of a random process represented by an AR model sequence.
-The covariance matrix is determined by accumulating the normal equations of all AR models in \config{autoregressiveModelSequence}
-and inverting the combined normal equation matrix.
+The covariance matrix is the inverse of the combined normal equations of all AR models in \config{autoregressiveModelSequence}.
+As the AR model of order $k$ constrains epoch $k$, the pseudo observation equations $\mathbf{W}$ are block lower triangular
+and the covariance matrix $\mathbf{W}^{-1}\mathbf{W}^{-T}$ is computed from the first block column of $\mathbf{W}^{-1}$ by block forward substitution.
 For each output file in \configFile{outputfileCovarianceMatrix}{matrix},
 the covariance matrix of appropriate time lag is saved (the first file contains the auto-covariance,
 second file cross covariance and so on). The matrix for lag $h$ describes the covariance between $x_{t-h}$ and $x_{t}$, i.e. $\Sigma(t-h, t)$.
@@ -24,7 +25,6 @@ second file cross covariance and so on). The matrix for lag $h$ describes the co
 
 #include "programs/program.h"
 #include "files/fileMatrix.h"
-#include "parallel/matrixDistributed.h"
 #include "misc/kalmanProcessing.h"
 
 /***** CLASS ***********************************/
@@ -53,24 +53,31 @@ void AutoregressiveModel2CovarianceMatrix::run(Config &config, Parallel::Communi
     if(isCreateSchema(config)) return;
 
     logStatus<<"read autoregressive model sequence"<<Log::endl;
-    const UInt blockCount = arSequence->maximumOrder()+1;
+    const UInt blockCount = std::min(arSequence->maximumOrder()+1, fileNameOut.size());
     const UInt dimension  = arSequence->dimension();
-    auto blockIndex = MatrixDistributed::computeBlockIndex(dimension*blockCount, dimension);
-    MatrixDistributed N(blockIndex, Parallel::selfCommunicator());
 
-    logStatus<<"set up normal equations"<<Log::endl;
-    for(UInt r = 0; r<N.blockCount(); r++)
-      for(UInt c = r; c<N.blockCount(); c++)
-        arSequence->distributedNormalsBlock(N.blockCount(), r, c, N.N(r, c));
+    // first block column Y of W^-1 (W: block lower triangular pseudo observation equations)
+    // W_kk Y_k = -sum_j<k W_kj Y_j, with Y_0 = W_00^-1
+    logStatus<<"compute covariance matrices"<<Log::endl;
+    std::vector<Matrix> Y(blockCount);
+    for(UInt k=0; k<blockCount; k++)
+    {
+      const Matrix W = arSequence->pseudoObservationEquation(k); // [A_k, ..., A_1, A_0]
+      Matrix rhs = (k == 0) ? identityMatrix(dimension) : Matrix(dimension, dimension);
+      for(UInt j=0; j<k; j++)
+        matMult(-1., W.column(j*dimension, dimension), Y.at(j), rhs);
+      Matrix Wkk = W.column(k*dimension, dimension);
+      Y.at(k) = solve(Wkk, rhs);
+    }
 
-    logStatus<<"compute inverse of normal equations"<<Log::endl;
-    N.cholesky(FALSE/*timing*/);
-    N.choleskyInverse(FALSE/*timing*/);
-    N.choleskyProduct(FALSE/*timing*/);
-    for(UInt column = 0; column<std::min(N.blockCount(), fileNameOut.size()); column++)
+    // Sigma(0, k) = Y_0 Y_k^T
+    for(UInt column = 0; column<blockCount; column++)
     {
+      Matrix Sigma = Y.at(0) * Y.at(column).trans();
+      if(column == 0)
+        Sigma.setType(Matrix::SYMMETRIC);
       logStatus<<"write covariance matrix to <"<<fileNameOut.at(column)<<">"<<Log::endl;
-      writeFileMatrix(fileNameOut.at(column), N.N(0, column));
+      writeFileMatrix(fileNameOut.at(column), Sigma);
     }
   }
   catch(std::exception &e)
@@ -15,6 +15,8 @@ static const char *docstring = R"(
 Computes digital filter coefficients for a \configClass{digital filter}{digitalFilterType} of given degree and
 order. The filter coefficients are computed by fitting them to an approximated
 impulse response represented by the cholesky factor of the covariance matrix.
+The cholesky factor of the toeplitz covariance matrix (or its inverse) is computed
+with the Schur algorithm (or the Levinson-Durbin recursion) in $\mathcal{O}(n^2)$ operations.
 
 The parameter \config{warmup} determines from which element of the cholesky matrix the
 coefficients (default: half the covariance length) are fitted.
@@ -69,15 +71,64 @@ void CovarianceFunction2DigitalFilter::run(Config &config, Parallel::Communicato
     readFileMatrix(inputFileCovariance, covFunc);
     Vector c = covFunc.column(column);
 
-    Matrix W(c.rows(), Matrix::SYMMETRIC, Matrix::UPPER);
-    for(UInt i = 0; i<W.rows(); i++)
-      for(UInt j = i; j<W.rows(); j++)
-        W(i, j) = c(j-i);
-
-    cholesky(W);
-
-    if(decorrelate)
-      inverse(W);
+    // upper cholesky factor W (W^T W = C) of the toeplitz covariance matrix or its inverse
+    const UInt n = c.rows();
+    if(!n || (c(0) <= 0))
+      throw(Exception("covariance matrix is not positive definite"));
+    Matrix W(n, n);
+    if(!decorrelate)
+    {
+      // Schur algorithm: rows of W from the generators u, v (C - Z C Z^T = u^T u - v^T v)
+      Vector u = (1./std::sqrt(c(0))) * c;
+      Vector v = u;
+      v(0) = 0;
+      for(UInt i=0; i<n; i++)
+      {
+        for(UInt k=i; k<n; k++)
+          W(i, k) = u(k);
+        if(i+1 == n)
+          break;
+        for(UInt k=n-1; k>i; k--) // shift
+          u(k) = u(k-1);
+        u(i) = 0;
+        const Double rho = v(i+1)/u(i+1); // reflection coefficient
+        const Double s   = std::sqrt((1-rho)*(1+rho));
+        if(!(s > 0))
+          throw(Exception("covariance matrix is not positive definite"));
+        for(UInt k=i+1; k<n; k++)
+        {
+          const Double uk = u(k);
+          u(k) = (uk - rho*v(k))/s;
+          v(k) = (v(k) - rho*uk)/s;
+        }
+      }
+    }
+    else
+    {
+      // Levinson-Durbin recursion: column m of W^-1 are the normalized prediction error filters of order m
+      Vector a(n), aOld(n);
+      Double sigma2 = c(0);
+      W(0, 0) = 1./std::sqrt(sigma2);
+      for(UInt m=1; m<n; m++)
+      {
+        Double k = c(m);
+        for(UInt j=1; j<m; j++)
+          k -= a(j)*c(m-j);
+        k /= sigma2;
+        copy(a, aOld);
+        for(UInt j=1; j<m; j++)
+          a(j) = aOld(j) - k*aOld(m-j);
+        a(m) = k;
+        sigma2 *= (1-k)*(1+k);
+        if(!(sigma2 > 0))
+          throw(Exception("covariance matrix is not positive definite"));
+        const Double f = 1./std::sqrt(sigma2);
+        W(m, m) = f;
+        for(UInt j=1; j<=m; j++)
+          W(m-j, m) = -f*a(j);
+      }
+    }
+    W.setType(Matrix::TRIANGULAR, Matrix::UPPER);
 
     // compute best fitting filter
     // ---------------------------
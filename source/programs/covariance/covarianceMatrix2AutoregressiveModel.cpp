@@ -30,13 +30,15 @@ the covariance structure of the (stationary) process is therefore given by
 \end{bmatrix}.
 \end{equation}
 
+The block Toeplitz normal equations are solved with the block Levinson-Whittle recursion,
+which needs $\mathcal{O}(p^2)$ instead of $\mathcal{O}(p^3)$ block operations for an AR model of order $p$.
+
 The estimate AR model is saved as single matrix \config{outputfileAutoregressiveModel} according to the GROOPS AR model conventions.
 )";
 
 /***********************************************/
 
 #include "programs/program.h"
-#include "parallel/matrixDistributed.h"
 #include "files/fileMatrix.h"
 
 /***** CLASS ***********************************/
@@ -84,19 +86,49 @@ void CovarianceMatrix2AutoregressiveModel::run(Config &config, Parallel::Communi
     }
     const UInt dim = C.front().rows();
     Matrix n(dim*order, dim); // right hand side
-    MatrixDistributed N;
-    auto blockIndex = MatrixDistributed::computeBlockIndex(dim*order, dim);
-    N.initEmpty(blockIndex, Parallel::selfCommunicator());
-    for(UInt r = 0; r<N.blockCount(); r++)
-    {
+    for(UInt r = 0; r<order; r++)
       copy(C.at(r+1), n.row(r*dim, dim));
-      for(UInt c = r; c<N.blockCount(); c++)
+
+    // block Levinson-Whittle recursion for the block toeplitz normal equations
+    // forward prediction x_t = sum_k Phi_k x_{t-k} and backward prediction x_t = sum_k Psi_k x_{t+k}
+    // with prediction error covariances V and Vb, Gamma(h) = Cov(x_{t+h}, x_t) = C_h^T
+    Matrix C0 = C.front();
+    fillSymmetric(C0);
+    C0.setType(Matrix::GENERAL);
+    Matrix V = C0, Vb = C0;
+    Matrix Delta = C.at(1).trans();
+    std::vector<Matrix> Phi, Psi;
+    for(UInt k=1; k<=order; k++)
+    {
+      Matrix VSym  = V;  VSym.setType(Matrix::SYMMETRIC);
+      Matrix VbSym = Vb; VbSym.setType(Matrix::SYMMETRIC);
+      const Matrix PhiK = solve(VbSym, Delta.trans()).trans();
+      const Matrix PsiK = solve(VSym,  Delta).trans();
+
+      std::vector<Matrix> PhiNew(k), PsiNew(k);
+      for(UInt j=0; j+1<k; j++)
+      {
+        PhiNew.at(j) = Phi.at(j) - PhiK * Psi.at(k-2-j);
+        PsiNew.at(j) = Psi.at(j) - PsiK * Phi.at(k-2-j);
+      }
+      PhiNew.back() = PhiK;
+      PsiNew.back() = PsiK;
+      std::swap(Phi, PhiNew);
+      std::swap(Psi, PsiNew);
+
+      matMult(-1., PhiK, Delta.trans(), V);
+      matMult(-1., PsiK, Delta, Vb);
+      if(k < order)
       {
-        N.setBlock(r, c);
-        N.N(r, c) = C.at(c-r).trans(); // block toeplitz
+        Delta = C.at(k+1).trans();
+        for(UInt j=0; j<k; j++)
+          matMult(-1., Phi.at(j), C.at(k-j).trans(), Delta);
       }
     }
-    Matrix X = N.solve(n, TRUE/*timing*/);
+
+    Matrix X(dim*order, dim);
+    for(UInt k=0; k<order; k++)
+      copy(Phi.at(k).trans(), X.row(k*dim, dim));
 
     logStatus<<"compute white noise covariance"<<Log::endl;
     Matrix Q = C.front();
@@ -0,0 +1,156 @@
+/***********************************************/
+/**
+* @file gravityfield2DoodsonHarmonics.cpp
+*
+* @brief Estimate tidal constituents from a time variable gravity field.
+*
+* @author GROOPS Developers
+* @date 2026-10-15
+*
+*/
+/***********************************************/
+
+// Latex documentation
+#define DOCSTRING docstring
+static const char *docstring = R"(
+Estimates the tidal constituents \config{doodson} (Doodson number or Darwin´s name, e.g. 255.555 or M2)
+of a time variable \configClass{gravityfield}{gravityfieldType}
+sampled at \configClass{timeSeries}{timeSeriesType} and writes a \file{DoodsonHarmonic file}{doodsonHarmonic}.
+For each potential coefficient the time series is modeled by
+\begin{equation}
+  c_{nm}(t) = \bar{c}_{nm} + \sum_i c^{cos}_{nm,i}\cos(\theta_i(t)) + c^{sin}_{nm,i}\sin(\theta_i(t)),
+\end{equation}
+where $\theta_i(t)$ are the Doodson arguments. The mean $\bar{c}_{nm}$ is only estimated with \config{estimateMean}.
+Nodal corrections are not considered.
+
+The temporal design matrix is the same for all coefficients. The normal matrix is factorized once
+and all coefficients are solved together as right hand sides. The epochs are distributed over the parallel processes.
+The expansion is limited in the range between \config{minDegree} and \config{maxDegree} inclusively.
+The coefficients are related to the reference radius~\config{R} and the Earth gravitational constant \config{GM}.
+)";
+
+/***********************************************/
+
+#include "programs/program.h"
+#include "base/doodson.h"
+#include "files/fileDoodsonHarmonic.h"
+#include "classes/timeSeries/timeSeries.h"
+#include "classes/gravityfield/gravityfield.h"
+
+/***** CLASS ***********************************/
+
+/** @brief Estimate tidal constituents from a time variable gravity field.
+* @ingroup programsGroup */
+class Gravityfield2DoodsonHarmonics
+{
+public:
+  void run(Config &config, Parallel::CommunicatorPtr comm);
+};
+
+GROOPS_REGISTER_PROGRAM(Gravityfield2DoodsonHarmonics, PARALLEL, "Estimate tidal constituents from a time variable gravity field", DoodsonHarmonics, Gravityfield)
+
+/***********************************************/
+
+void Gravityfield2DoodsonHarmonics::run(Config &config, Parallel::CommunicatorPtr comm)
+{
+  try
+  {
+    FileName             fileNameOut;
+    GravityfieldPtr      gravityfield;
+    TimeSeriesPtr        timeSeries;
+    std::vector<Doodson> doodson;
+    Bool                 estimateMean;
+    UInt                 minDegree, maxDegree;
+    Double               GM, R;
+
+    readConfig(config, "outputfileDoodsonHarmonics", fileNameOut,  Config::MUSTSET,  "",  "");
+    readConfig(config, "gravityfield",               gravityfield, Config::MUSTSET,  "",  "");
+    readConfig(config, "timeSeries",                 timeSeries,   Config::MUSTSET,  "",  "sampling of the gravityfield");
+    readConfig(config, "doodson",                    doodson,      Config::MUSTSET,  "",  "tidal constituents to estimate");
+    readConfig(config, "estimateMean",               estimateMean, Config::DEFAULT,  "1", "estimate additionally a constant for each coefficient");
+    readConfig(config, "minDegree",                  minDegree,    Config::DEFAULT,  "0", "");
+    readConfig(config, "maxDegree",                  maxDegree,    Config::MUSTSET,  "",  "");
+    readConfig(config, "GM",                         GM,           Config::DEFAULT,  STRING_DEFAULT_GM, "Geocentric gravitational constant");
+    readConfig(config, "R",                          R,            Config::DEFAULT,  STRING_DEFAULT_R,  "reference radius");
+    if(isCreateSchema(config)) return;
+
+    const std::vector<Time> times = timeSeries->times();
+    const UInt offset = estimateMean ? 1 : 0;
+    if(times.size() < offset+2*doodson.size())
+      throw(Exception("not enough epochs ("+times.size()%"%i) to estimate "s+(offset+2*doodson.size())%"%i parameters"s));
+
+    // temporal design matrix (same for all coefficients)
+    // ---------------------------------------------------
+    Matrix A(times.size(), offset+2*doodson.size());
+    for(UInt idEpoch=0; idEpoch<times.size(); idEpoch++)
+    {
+      if(estimateMean)
+        A(idEpoch, 0) = 1.;
+      for(UInt i=0; i<doodson.size(); i++)
+      {
+        const Double thetaf = doodson.at(i).thetaf(times.at(idEpoch));
+        A(idEpoch, offset+2*i+0) = std::cos(thetaf);
+        A(idEpoch, offset+2*i+1) = std::sin(thetaf);
+      }
+    }
+
+    // right hand sides for all coefficients: A^T L
+    // --------------------------------------------
+    logStatus<<"accumulate right hand sides of "<<times.size()<<" epochs"<<Log::endl;
+    const UInt coeffCount = (maxDegree+1)*(maxDegree+1);
+    const UInt blockSize  = 32;
+    Matrix rhs(A.columns(), coeffCount);
+    Parallel::forEach((times.size()+blockSize-1)/blockSize, [&](UInt idBlock)
+    {
+      const UInt start = idBlock*blockSize;
+      const UInt count = std::min(blockSize, times.size()-start);
+      Matrix L(count, coeffCount);
+      for(UInt i=0; i<count; i++)
+        copy(gravityfield->sphericalHarmonics(times.at(start+i), maxDegree, minDegree, GM, R).x().trans(), L.row(i));
+      matMult(1., A.row(start, count).trans(), L, rhs);
+    }, comm);
+    Parallel::reduceSum(rhs, 0, comm);
+
+    if(Parallel::isMaster(comm))
+    {
+      // solve all coefficients at once
+      // ------------------------------
+      logStatus<<"solve normal equations for "<<coeffCount<<" coefficients"<<Log::endl;
+      Matrix N(A.columns(), Matrix::SYMMETRIC);
+      rankKUpdate(1., A, N);
+      const Matrix x = solve(N, rhs);
+
+      std::vector<Matrix> cnmCos(doodson.size()), snmCos(doodson.size());
+      std::vector<Matrix> cnmSin(doodson.size()), snmSin(doodson.size());
+      for(UInt i=0; i<doodson.size(); i++)
+      {
+        auto coefficients = [&](UInt row, Matrix &cnm, Matrix &snm)
+        {
+          cnm = Matrix(maxDegree+1, Matrix::TRIANGULAR, Matrix::LOWER);
+          snm = Matrix(maxDegree+1, Matrix::TRIANGULAR, Matrix::LOWER);
+          UInt idx = 0;
+          for(UInt n=0; n<=maxDegree; n++)
+          {
+            cnm(n,0) = x(row, idx++);
+            for(UInt m=1; m<=n; m++)
+            {
+              cnm(n,m) = x(row, idx++);
+              snm(n,m) = x(row, idx++);
+            }
+          }
+        };
+        coefficients(offset+2*i+0, cnmCos.at(i), snmCos.at(i));
+        coefficients(offset+2*i+1, cnmSin.at(i), snmSin.at(i));
+      }
+
+      logStatus<<"writing doodson harmonics <"<<fileNameOut<<">"<<Log::endl;
+      writeFileDoodsonHarmonic(fileNameOut, DoodsonHarmonic(GM, R, doodson, cnmCos, snmCos, cnmSin, snmSin));
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
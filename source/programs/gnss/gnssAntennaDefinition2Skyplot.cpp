@@ -94,12 +94,12 @@ void GnssAntennaDefinition2Skyplot::run(Config &config, Parallel::CommunicatorPt
     std::vector<Vector3d> points = grid->points();
     std::vector<Double>   areas  = grid->areas();
     std::vector< std::vector<Double> > values(types.size(), std::vector<Double>(points.size()));
-    for(UInt i=0; i<points.size(); i++)
-      for(UInt idType=0; idType<types.size(); idType++)
-      {
-        const UInt idPattern = antenna->findAntennaPattern(types.at(idType), GnssAntennaDefinition::THROW_EXCEPTION);
-        values.at(idType).at(i) = antenna->pattern.at(idPattern).antennaVariations(points.at(i).lambda(), points.at(i).phi(), FALSE);
-      }
+    for(UInt idType=0; idType<types.size(); idType++)
+    {
+      const GnssAntennaPattern &pattern = antenna->pattern.at(antenna->findAntennaPattern(types.at(idType), GnssAntennaDefinition::THROW_EXCEPTION));
+      for(UInt i=0; i<points.size(); i++)
+        values.at(idType).at(i) = pattern.antennaVariations(points.at(i).lambda(), points.at(i).phi(), FALSE);
+    }
 
     logStatus<<"save values to file <"<<fileNameGrid<<">"<<Log::endl;
     GriddedData griddedData(Ellipsoid(a, f), points, areas, values);
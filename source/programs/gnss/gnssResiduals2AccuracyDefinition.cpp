@@ -27,6 +27,7 @@ are replaced by estimated accuracy
 where $e_i$ are the azimuth and elevation dependent residuals and $r_i$ the
 corresponding redundancies (number of observations minus the contribution to
 the estimated parameters).
+The residual files are read one arc at a time and accumulated in parallel into the grid cells of the patterns.
 
 The \configFile{inputfileAccuracyDefinition}{gnssAntennaDefinition} can be modified
 to the demands before with \program{GnssAntennaDefinitionCreate}
@@ -63,12 +64,12 @@ public:
   void run(Config &config, Parallel::CommunicatorPtr comm);
 };
 
-GROOPS_REGISTER_PROGRAM(GnssResiduals2AccuracyDefinition, SINGLEPROCESS, "Compute accuracy definition from observation residuals", Gnss)
+GROOPS_REGISTER_PROGRAM(GnssResiduals2AccuracyDefinition, PARALLEL, "Compute accuracy definition from observation residuals", Gnss)
 GROOPS_RENAMED_PROGRAM(GnssResiduals2AntennaDefinition, GnssResiduals2AccuracyDefinition, date2time(2020, 6, 26))
 
 /***********************************************/
 
-void GnssResiduals2AccuracyDefinition::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
+void GnssResiduals2AccuracyDefinition::run(Config &config, Parallel::CommunicatorPtr comm)
 {
   try
   {
@@ -110,13 +111,15 @@ void GnssResiduals2AccuracyDefinition::run(Config &config, Parallel::Communicato
 
     // ============================
 
-    for(const FileName &fileName : fileNameResiduals)
+    // residuals are accumulated file by file into the pattern cells of each process
+    Parallel::forEach(fileNameResiduals.size(), [&](UInt idFile)
     {
+      const FileName &fileName = fileNameResiduals.at(idFile);
       logStatus<<"read GNSS residuals <"<<fileName<<">"<<Log::endl;
       if(!System::exists(fileName))
       {
         logWarning<<"file not exist -> continue"<<Log::endl;
-        continue;
+        return;
       }
 
       InstrumentFile fileReceiver(fileName);
@@ -221,7 +224,36 @@ void GnssResiduals2AccuracyDefinition::run(Config &config, Parallel::Communicato
           } // for(satType)
         } // for(epoch)
       } // for(arcNo)
-    } // for(idFile)
+    }, comm);
+
+    // sum up the cells of all processes
+    std::vector<GnssAntennaPattern*> patterns;
+    for(auto &antenna : antennaList)
+      for(auto &pattern : antenna->pattern)
+        patterns.push_back(&pattern);
+    Vector isUsed(patterns.size());
+    for(UInt i=0; i<patterns.size(); i++)
+      isUsed(i) = patterns.at(i)->count.size() ? 1. : 0.;
+    Parallel::reduceSum(isUsed, 0, comm);
+    Parallel::broadCast(isUsed, 0, comm);
+    for(UInt i=0; i<patterns.size(); i++)
+      if(isUsed(i))
+      {
+        GnssAntennaPattern &pattern = *patterns.at(i);
+        if(!pattern.count.size())
+        {
+          pattern.sum        = Matrix(pattern.pattern.rows(), pattern.pattern.columns());
+          pattern.ePe        = Matrix(pattern.pattern.rows(), pattern.pattern.columns());
+          pattern.redundancy = Matrix(pattern.pattern.rows(), pattern.pattern.columns());
+          pattern.count      = Matrix(pattern.pattern.rows(), pattern.pattern.columns());
+        }
+        Parallel::reduceSum(pattern.sum,        0, comm);
+        Parallel::reduceSum(pattern.ePe,        0, comm);
+        Parallel::reduceSum(pattern.redundancy, 0, comm);
+        Parallel::reduceSum(pattern.count,      0, comm);
+      }
+    if(!Parallel::isMaster(comm))
+      return;
 
     // ============================
 
@@ -19,6 +19,7 @@ as in \program{PlotMap}. If with \configClass{typeTransmitter}{gnssType} (e.g. '
 a single transmitter is selected the azimuth and elevation are computed from the transmitter point of view.
 
 For each GNSS \configClass{type}{gnssType} an extra data column is created.
+The residual files are read in parallel.
 
 A \file{GNSS residual file}{instrument} includes additional information
 besides the residuals, which can also be selected with \configClass{type}{gnssType}
@@ -55,12 +56,12 @@ public:
   void run(Config &config, Parallel::CommunicatorPtr comm);
 };
 
-GROOPS_REGISTER_PROGRAM(GnssResiduals2Skyplot, SINGLEPROCESS, "Convert residuals into griddedData format for plotting", Gnss, Grid)
+GROOPS_REGISTER_PROGRAM(GnssResiduals2Skyplot, PARALLEL, "Convert residuals into griddedData format for plotting", Gnss, Grid)
 GROOPS_RENAMED_PROGRAM(GnssResiduals2GriddedData, GnssResiduals2Skyplot, date2time(2019, 9, 9))
 
 /***********************************************/
 
-void GnssResiduals2Skyplot::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
+void GnssResiduals2Skyplot::run(Config &config, Parallel::CommunicatorPtr comm)
 {
   try
   {
@@ -80,18 +81,21 @@ void GnssResiduals2Skyplot::run(Config &config, Parallel::CommunicatorPtr /*comm
 
     // ============================
 
-    Ellipsoid                        ellipsoid(a, f);
-    std::vector<Vector3d>            points;
-    std::vector<std::vector<Double>> values(types.size());
-    for(const FileName &fileName : fileNameResiduals)
+    // the files are read in parallel, each row of the file matrices is a point (x, y, z, values)
+    Ellipsoid           ellipsoid(a, f);
+    std::vector<Matrix> pointsFile(fileNameResiduals.size());
+    Parallel::forEach(pointsFile, [&](UInt idFile)
     {
+      const FileName &fileName = fileNameResiduals.at(idFile);
       logStatus<<"read GNSS residuals <"<<fileName<<">"<<Log::endl;
       if(!System::exists(fileName))
       {
         logWarning<<"file not exist -> continue"<<Log::endl;
-        continue;
+        return Matrix();
       }
 
+      std::vector<Vector3d> points;
+      std::vector<Double>   valuesFile;
       InstrumentFile fileReceiver(fileName);
       for(UInt arcNo=0; arcNo<fileReceiver.arcCount(); arcNo++)
       {
@@ -142,13 +146,36 @@ void GnssResiduals2Skyplot::run(Config &config, Parallel::CommunicatorPtr /*comm
             if(found)
             {
               points.push_back(point);
-              for(UInt i=0; i<values.size(); i++)
-                values.at(i).push_back(valuesPerPoint.at(i));
+              valuesFile.insert(valuesFile.end(), valuesPerPoint.begin(), valuesPerPoint.end());
             }
           } // for(satType)
         } // for(epoch)
       } // for(arcNo)
-    } // for(idFile)
+
+      Matrix A(points.size(), 3+types.size());
+      for(UInt k=0; k<points.size(); k++)
+      {
+        A(k, 0) = points.at(k).x();
+        A(k, 1) = points.at(k).y();
+        A(k, 2) = points.at(k).z();
+        for(UInt i=0; i<types.size(); i++)
+          A(k, 3+i) = valuesFile.at(k*types.size()+i);
+      }
+      return A;
+    }, comm);
+    if(!Parallel::isMaster(comm))
+      return;
+
+    std::vector<Vector3d>            points;
+    std::vector<std::vector<Double>> values(types.size());
+    for(const Matrix &A : pointsFile)
+      for(UInt k=0; k<A.rows(); k++)
+      {
+        points.push_back(Vector3d(A(k, 0), A(k, 1), A(k, 2)));
+        for(UInt i=0; i<types.size(); i++)
+          values.at(i).push_back(A(k, 3+i));
+      }
+    pointsFile.clear();
 
     // ============================
 
@@ -32,6 +32,7 @@ Parameter settings and outputfiles are irgnored.
 
 If the program is run on multiple processes the \configClass{receiver}{gnssReceiverGeneratorType}s
 (stations or LEO satellites) are distributed over the processes.
+The output files of the receivers of each process are written in parallel by the threads of the process.
 )";
 
 /***********************************************/
@@ -146,6 +147,12 @@ void GnssSimulateReceiver::run(Config &config, Parallel::CommunicatorPtr comm)
 
     // ============================
 
+    // the files of the own receivers are written independently by threads
+    std::vector<GnssReceiverPtr> myReceivers;
+    for(auto recv : gnss.receivers)
+      if(recv->isMyRank())
+        myReceivers.push_back(recv);
+
     // Write observations
     // ------------------
     if(!fileNameReceiver.empty())
@@ -153,54 +160,55 @@ void GnssSimulateReceiver::run(Config &config, Parallel::CommunicatorPtr comm)
       VariableList fileNameVariableList;
       addVariable("station", "****", fileNameVariableList);
       logStatus<<"write receiver observations to files <"<<fileNameReceiver(fileNameVariableList)<<">"<<Log::endl;
-      for(auto recv : gnss.receivers)
-        if(recv->isMyRank())
-        {
-          GnssReceiverArc arc;
-          for(UInt idEpoch=0; idEpoch<gnss.times.size(); idEpoch++)
-            if(recv->useable(idEpoch))
-            {
-              GnssReceiverEpoch epoch;
-              epoch.time       = gnss.times.at(idEpoch);
-              epoch.clockError = recv->clockError(idEpoch);
-
-              // get types
-              for(UInt idTrans=0; idTrans<recv->idTransmitterSize(idEpoch); idTrans++)
-                if(recv->observation(idTrans, idEpoch) && gnss.transmitters.at(idTrans)->useable(idEpoch))
-                  for(UInt idType=0; idType<recv->observation(idTrans, idEpoch)->size(); idType++)
-                    if(!recv->observation(idTrans, idEpoch)->at(idType).type.isInList(epoch.obsType))
-                      epoch.obsType.push_back(recv->observation(idTrans, idEpoch)->at(idType).type & ~(GnssType::PRN+GnssType::FREQ_NO));
-              std::sort(epoch.obsType.begin(), epoch.obsType.end());
-              if(!epoch.obsType.size())
-                continue;
-
-              for(UInt idTrans=0; idTrans<recv->idTransmitterSize(idEpoch); idTrans++)
-                if(recv->observation(idTrans, idEpoch) && gnss.transmitters.at(idTrans)->useable(idEpoch))
+      Parallel::threadLoop(0, myReceivers.size(), [&](UInt idx)
+      {
+        auto recv = myReceivers.at(idx);
+        GnssReceiverArc arc;
+        for(UInt idEpoch=0; idEpoch<gnss.times.size(); idEpoch++)
+          if(recv->useable(idEpoch))
+          {
+            GnssReceiverEpoch epoch;
+            epoch.time       = gnss.times.at(idEpoch);
+            epoch.clockError = recv->clockError(idEpoch);
+
+            // get types
+            for(UInt idTrans=0; idTrans<recv->idTransmitterSize(idEpoch); idTrans++)
+              if(recv->observation(idTrans, idEpoch) && gnss.transmitters.at(idTrans)->useable(idEpoch))
+                for(UInt idType=0; idType<recv->observation(idTrans, idEpoch)->size(); idType++)
+                  if(!recv->observation(idTrans, idEpoch)->at(idType).type.isInList(epoch.obsType))
+                    epoch.obsType.push_back(recv->observation(idTrans, idEpoch)->at(idType).type & ~(GnssType::PRN+GnssType::FREQ_NO));
+            std::sort(epoch.obsType.begin(), epoch.obsType.end());
+            if(!epoch.obsType.size())
+              continue;
+
+            for(UInt idTrans=0; idTrans<recv->idTransmitterSize(idEpoch); idTrans++)
+              if(recv->observation(idTrans, idEpoch) && gnss.transmitters.at(idTrans)->useable(idEpoch))
+              {
+                const GnssObservation &obs = *recv->observation(idTrans, idEpoch);
+                const GnssType prn = obs.at(0).type & (GnssType::SYSTEM + GnssType::PRN + GnssType::FREQ_NO);
+                UInt idType = std::distance(epoch.obsType.begin(), std::find(epoch.obsType.begin(), epoch.obsType.end(), prn));
+
+                epoch.satellite.push_back(prn);
+                for(; (idType<epoch.obsType.size()) && (epoch.obsType.at(idType) == prn); idType++)
                 {
-                  const GnssObservation &obs = *recv->observation(idTrans, idEpoch);
-                  const GnssType prn = obs.at(0).type & (GnssType::SYSTEM + GnssType::PRN + GnssType::FREQ_NO);
-                  UInt idType = std::distance(epoch.obsType.begin(), std::find(epoch.obsType.begin(), epoch.obsType.end(), prn));
-
-                  epoch.satellite.push_back(prn);
-                  for(; (idType<epoch.obsType.size()) && (epoch.obsType.at(idType) == prn); idType++)
-                  {
-                    epoch.observation.push_back(NAN_EXPR);
-                    for(UInt i=0; i<obs.size(); i++)
-                      if(obs.at(i).type == epoch.obsType.at(idType))
-                      {
-                        epoch.observation.back() = obs.at(i).observation;
-                        break;
-                      }
-                  }
-                } // for(idTrans)
-
-              if(epoch.satellite.size())
-                arc.push_back(epoch);
-            } // for(idEpoch)
-
-          fileNameVariableList["station"]->setValue(recv->name());
-          InstrumentFile::write(fileNameReceiver(fileNameVariableList), arc);
-        } // for(recv)
+                  epoch.observation.push_back(NAN_EXPR);
+                  for(UInt i=0; i<obs.size(); i++)
+                    if(obs.at(i).type == epoch.obsType.at(idType))
+                    {
+                      epoch.observation.back() = obs.at(i).observation;
+                      break;
+                    }
+                }
+              } // for(idTrans)
+
+            if(epoch.satellite.size())
+              arc.push_back(epoch);
+          } // for(idEpoch)
+
+        VariableList varList;
+        addVariable("station", recv->name(), varList);
+        InstrumentFile::write(fileNameReceiver(varList), arc);
+      }); // for(recv)
     } // if(fileNameReceiver)
 
     // ============================
@@ -212,21 +220,22 @@ void GnssSimulateReceiver::run(Config &config, Parallel::CommunicatorPtr comm)
       VariableList fileNameVariableList;
       addVariable("station", "****", fileNameVariableList);
       logStatus<<"write receiver clocks to files <"<<fileNameClock(fileNameVariableList)<<">"<<Log::endl;
-      for(auto recv : gnss.receivers)
-        if(recv->isMyRank())
-        {
-          MiscValueArc arc;
-          for(UInt idEpoch=0; idEpoch<gnss.times.size(); idEpoch++)
-            if(recv->useable(idEpoch))
-            {
-              MiscValueEpoch epoch;
-              epoch.time  = gnss.times.at(idEpoch);
-              epoch.value = recv->clockError(idEpoch);
-              arc.push_back(epoch);
-            }
-          fileNameVariableList["station"]->setValue(recv->name());
-          InstrumentFile::write(fileNameClock(fileNameVariableList), arc);
-        } // for(recv)
+      Parallel::threadLoop(0, myReceivers.size(), [&](UInt idx)
+      {
+        auto recv = myReceivers.at(idx);
+        MiscValueArc arc;
+        for(UInt idEpoch=0; idEpoch<gnss.times.size(); idEpoch++)
+          if(recv->useable(idEpoch))
+          {
+            MiscValueEpoch epoch;
+            epoch.time  = gnss.times.at(idEpoch);
+            epoch.value = recv->clockError(idEpoch);
+            arc.push_back(epoch);
+          }
+        VariableList varList;
+        addVariable("station", recv->name(), varList);
+        InstrumentFile::write(fileNameClock(varList), arc);
+      }); // for(recv)
     } // if(fileNameClock)
   }
   catch(std::exception &e)
@@ -70,54 +70,28 @@ void GraceSstResidualAnalysis::run(Config &config, Parallel::CommunicatorPtr /*c
     logStatus<<"read GRACE SST residuals "<<"<"<<fileNameInResiduals<<">"<<Log::endl;
     SatelliteTrackingArc sstArc = InstrumentFile::read(fileNameInResiduals);
     UInt posCount = sstArc.size();
-    std::vector<Double> signal(posCount);
+    Vector signal(posCount);
     for(UInt i=0; i<posCount; i++)
-      signal.at(i) = sstArc.at(i).rangeRate;
+      signal(i) = sstArc.at(i).rangeRate;
 
     logStatus<<"read wavelet filters "<<"<"<<fileNameInWavelet<<">"<<Log::endl;
     Vector wl;
     readFileMatrix(fileNameInWavelet, wl);
 
-    std::vector<UInt>   length;
-    std::vector<UInt>   flag, flag2;
-    std::vector<Double> dwtCoeff,dwt_a08,idwt_a08,idwt_out;
-    std::vector<Double> dwt_d03, dwt_d02, dwt_d01;
-    std::vector<Double> idwt_d03,idwt_d02,idwt_d01;
-
-    //perform 8-Level DWT
-    Wavelets::discreteWaveletTransform(signal, wl, level, dwtCoeff,flag, length);
-
-    //compute cumulative flag vector
-    flag2.resize(length.size());
-    for (UInt i=0; i<length.size();i++)
-      flag2.at(i) = length.at(i);
-    for (UInt i=1; i<flag2.size();i++)
-      flag2.at(i) += flag2.at(i-1);
-
-    //merge detail coefficients into three major groups
-    dwt_a08.resize(dwtCoeff.size()); dwt_d03.resize(dwtCoeff.size());
-    dwt_d02.resize(dwtCoeff.size()); dwt_d01.resize(dwtCoeff.size());
-    for (UInt i = 0; i < dwtCoeff.size();i++)
-      if (i < flag2.at(0))
-        dwt_a08.at(i) = dwtCoeff.at(i);
-      else if (i < flag2.at(3))
-        dwt_d03.at(i) = dwtCoeff.at(i);
-      else if (i < flag2.at(5))
-        dwt_d02.at(i) = dwtCoeff.at(i);
-      else
-        dwt_d01.at(i) = dwtCoeff.at(i);
-
-    //apply inverse DWT, from wavelet domain to time domain
-    Wavelets::inverseDiscreteWaveletTransform(dwt_d03, wl, flag, idwt_d03, length);
-    Wavelets::inverseDiscreteWaveletTransform(dwt_d02, wl, flag, idwt_d02, length);
-    Wavelets::inverseDiscreteWaveletTransform(dwt_d01, wl, flag, idwt_d01, length);
+    // perform 8-Level DWT and merge detail levels into three major groups (levels: a_8, d_8, ..., d_1)
+    const std::vector<Matrix> levels = Wavelets::multiresolutionAnalysis(signal, wl, level);
+    const Matrix idwt_d03 = levels.at(1) + levels.at(2) + levels.at(3);
+    const Matrix idwt_d02 = levels.at(4) + levels.at(5);
+    Matrix idwt_d01 = levels.at(6);
+    for(UInt j=7; j<levels.size(); j++)
+      idwt_d01 += levels.at(j);
 
     SatelliteTrackingArc d03, d02, d01;
     for(UInt i=0; i<posCount; i++)
     {
       SatelliteTrackingEpoch epoch;
       epoch.time = sstArc.at(i).time;
-      epoch.range = epoch.rangeRate = epoch.rangeAcceleration = idwt_d03.at(i);
+      epoch.range = epoch.rangeRate = epoch.rangeAcceleration = idwt_d03(i, 0);
       d03.push_back(epoch);
     }
 
@@ -125,7 +99,7 @@ void GraceSstResidualAnalysis::run(Config &config, Parallel::CommunicatorPtr /*c
     {
       SatelliteTrackingEpoch epoch;
       epoch.time = sstArc.at(i).time;
-      epoch.range = epoch.rangeRate = epoch.rangeAcceleration = idwt_d02.at(i);
+      epoch.range = epoch.rangeRate = epoch.rangeAcceleration = idwt_d02(i, 0);
       d02.push_back(epoch);
     }
 
@@ -133,7 +107,7 @@ void GraceSstResidualAnalysis::run(Config &config, Parallel::CommunicatorPtr /*c
     {
       SatelliteTrackingEpoch epoch;
       epoch.time = sstArc.at(i).time;
-      epoch.range = epoch.rangeRate = epoch.rangeAcceleration = idwt_d01.at(i);
+      epoch.range = epoch.rangeRate = epoch.rangeAcceleration = idwt_d01(i, 0);
       d01.push_back(epoch);
     }
 
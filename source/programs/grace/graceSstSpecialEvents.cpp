@@ -79,13 +79,21 @@ void GraceSstSpecialEvents::run(Config &config, Parallel::CommunicatorPtr /*comm
     StarCameraArc starCamera1 = InstrumentFile::read(fileNameStarCamera1);
     Arc::checkSynchronized({orbit1, orbit2, starCamera1});
 
+    std::vector<Vector3d> positions1(orbit1.size()), positions2(orbit2.size());
+    for(UInt i=0; i<orbit1.size(); i++)
+    {
+      positions1.at(i) = orbit1.at(i).position;
+      positions2.at(i) = orbit2.at(i).position;
+    }
+    const Vector factor1 = eclipse->factors(orbit1.times(), positions1, ephemerides);
+    const Vector factor2 = eclipse->factors(orbit2.times(), positions2, ephemerides);
+
     MiscValueArc arc;
     for(UInt i=0; i<orbit1.size(); i++)
     {
       // eclipse transit
       // ---------------
-      const Double delta = eclipse->factor(orbit2.at(i).time, orbit2.at(i).position, ephemerides)
-                         - eclipse->factor(orbit1.at(i).time, orbit1.at(i).position, ephemerides);
+      const Double delta = factor2(i) - factor1(i);
 
       if(fabs(delta) > 1e-10)
       {
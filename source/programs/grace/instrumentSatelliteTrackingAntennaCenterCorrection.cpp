@@ -31,7 +31,7 @@ an interpolation polynomial of degree \config{interpolationDegree}.
 /***********************************************/
 
 #include "programs/program.h"
-#include "base/polynomial.h"
+#include "misc/grace/graceKBandGeometry.h"
 #include "files/fileMatrix.h"
 #include "files/fileInstrument.h"
 
@@ -107,22 +107,7 @@ void InstrumentSatelliteTrackingAntennaCenterCorrection::run(Config &config, Par
       OrbitArc      orbit2      = orbit2File.readArc(arcNo);
       StarCameraArc starCamera1 = starCamera1File.readArc(arcNo);
       StarCameraArc starCamera2 = starCamera2File.readArc(arcNo);
-      Arc::checkSynchronized({orbit1, orbit2, starCamera1, starCamera2});
-
-      Matrix A(orbit1.size(), 4);
-      for(UInt i=0; i<A.rows(); i++)
-      {
-        const Vector3d u = (orbit2.at(i).position - orbit1.at(i).position);                                       // center of mass vector
-        const Vector3d v = (starCamera2.at(i).rotary.rotate(center2) - starCamera1.at(i).rotary.rotate(center1)); // combined antenna offset vector
-        A(i,1) = u.r() - (u+v).r();  // COM - ANT -> AOC
-      }
-
-      const std::vector<Time> times = orbit1.times();
-      Polynomial p(times, degree);
-      copy(p.derivative(   times, A.column(1)), A.column(2));
-      copy(p.derivative2nd(times, A.column(1)), A.column(3));
-
-      return Arc(times, A, Epoch::Type::SATELLITETRACKING);
+      return GraceKBandGeometry::antennaCenterCorrection(orbit1, orbit2, starCamera1, starCamera2, center1, center2, degree);
     }, comm); // forEach
 
     if(Parallel::isMaster(comm) && !outSSTName.empty())
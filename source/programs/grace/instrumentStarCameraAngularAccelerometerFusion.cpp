@@ -52,6 +52,10 @@ with
 The reference values $\M q_{0}$ and $\dot{\boldsymbol{\omega}}_{0}$ are derived
 from \configFile{inputfileStarCameraReference}{instrument}. In the course of the estimation,
 the accelerometer data is calibrated, by setting a bias factor $\M b$ with \config{accBias}.
+
+The normal equations are a band matrix (\config{interpolationDegree}) bordered by the calibration parameters.
+The redundancies and the epoch-wise \configFile{outputfileCovariance}{instrument} are computed within
+this structure. Only \configFile{outputfileCovarianceMatrix}{matrix} requires the inversion of the full arc-wise matrix.
 )";
 
 /***********************************************/
@@ -107,7 +111,7 @@ public:
 
   Bool           index(const Time &time, std::vector<Time> &times, UInt &idx) const;
   ArcObservation computeArc(UInt arc);
-  static Vector  computeRedundancy(std::vector<Matrix> &A, MatrixDistributed &normals, Double threshold=1e-4);
+  static Vector  computeRedundancy(std::vector<Matrix> &A, MatrixDistributed &normals, UInt bandwidth, Double threshold=1e-4);
   static void    estimateAccuracy(std::vector<Vector> &e, std::vector<Vector> &redundancy, Bool sigmaPerAxis, Double huber, Double huberPower, Vector &sigmaAxis, Vector &sigmaEpoch);
 
   void run(Config &config, Parallel::CommunicatorPtr comm);
@@ -571,7 +575,7 @@ InstrumentStarCameraAngularAccelerometerFusion::ArcObservation InstrumentStarCam
 
             // redundancy
             A.at(i) = scaA.at(i);
-            redundancy.at(i) = computeRedundancy(A, normals);
+            redundancy.at(i) = computeRedundancy(A, normals, degree);
             A.at(i) = Matrix();
           } // for(i=epochCount)
 
@@ -598,7 +602,7 @@ InstrumentStarCameraAngularAccelerometerFusion::ArcObservation InstrumentStarCam
             for(UInt k=0; k<accA.at(i).size(); k++)
               A.at(accIdxA.at(i)+k) = accA.at(i).at(k);
             A.back() = accB.at(i);
-            redundancy.at(i) = computeRedundancy(A, normals);
+            redundancy.at(i) = computeRedundancy(A, normals, degree);
             for(UInt k=0; k<accA.at(i).size(); k++)
               A.at(accIdxA.at(i)+k) = Matrix();
           } // for(i=epochCount)
@@ -614,21 +618,30 @@ InstrumentStarCameraAngularAccelerometerFusion::ArcObservation InstrumentStarCam
 
     //=================================
 
-    // full variance covariance matrix
-    Matrix C;
-    if(!fileNameOutCovariance.empty() || !fileNameOutCovarianceMatrix.empty())
+    // variance covariance matrix
+    std::vector<Tensor3d> covEpoch;
+    if(!fileNameOutCovarianceMatrix.empty())
     {
-      C = Matrix(normals.blockIndex(blockCount), Matrix::TRIANGULAR, Matrix::UPPER);
+      // full variance covariance matrix
+      Matrix C(normals.blockIndex(blockCount), Matrix::TRIANGULAR, Matrix::UPPER);
       for(UInt i=0; i<blockCount; i++)
         for(UInt k=i; k<blockCount; k++)
           if(normals.isBlockUsed(i, k))
             copy(normals.N(i,k), C.slice(normals.blockIndex(i), normals.blockIndex(k), normals.blockSize(i), normals.blockSize(k)));
       cholesky2Inverse(C);
       C *= sigma0 * sigma0;
-    }
-
-    if(!fileNameOutCovarianceMatrix.empty())
       writeFileMatrix(fileNameOutCovarianceMatrix.appendBaseName(".arc"+arcNo%"%03i"s), C.slice(0,0,3*epochCount,3*epochCount));
+      if(!fileNameOutCovariance.empty())
+        for(UInt i=0; i<epochCount; i++)
+          covEpoch.push_back(Tensor3d(C.slice(3*i,3*i,3,3)));
+    }
+    else if(!fileNameOutCovariance.empty())
+    {
+      // epoch wise covariances only: sparse inverse within the band structure of the Cholesky factor
+      normals.cholesky2SparseInverse(FALSE/*timing*/);
+      for(UInt i=0; i<epochCount; i++)
+        covEpoch.push_back(Tensor3d((sigma0*sigma0) * normals.N(i,i)));
+    }
 
     // Results
     ArcObservation arc;
@@ -655,7 +668,7 @@ InstrumentStarCameraAngularAccelerometerFusion::ArcObservation InstrumentStarCam
         {
           Covariance3dEpoch epoch;
           epoch.time       = times.at(i);
-          epoch.covariance = Tensor3d(C.slice(3*i,3*i,3,3));
+          epoch.covariance = covEpoch.at(i);
           arc.starCameraCovariance.push_back(epoch);
         }
     }
@@ -705,24 +718,31 @@ InstrumentStarCameraAngularAccelerometerFusion::ArcObservation InstrumentStarCam
 
 /***********************************************/
 
-Vector InstrumentStarCameraAngularAccelerometerFusion::computeRedundancy(std::vector<Matrix> &A, MatrixDistributed &normals, Double threshold)
+Vector InstrumentStarCameraAngularAccelerometerFusion::computeRedundancy(std::vector<Matrix> &A, MatrixDistributed &normals, UInt bandwidth, Double threshold)
 {
   try
   {
+    // the Cholesky factor is a band matrix (polynomial degree) with the calibration blocks as last block column
+    const UInt lastBlock = normals.blockCount()-1;
     Vector redundancy = {1., 1., 1.};
-    for(UInt i=0; i<normals.blockCount()-1; i++)
+    for(UInt i=0; i<lastBlock; i++)
       if(A.at(i).size())
       {
         triangularSolve(1., normals.N(i,i).trans(), A.at(i).trans());
         for(UInt idAxis=0; idAxis<3; idAxis++)
           redundancy(idAxis) -= quadsum(A.at(i).row(idAxis));
-        for(UInt k=i+1; k<normals.blockCount(); k++)
-          if(normals.isBlockUsed(i,k))
-          {
-            if(!A.at(k).size())
-              A.at(k) = Matrix(A.at(i).rows(), normals.blockSize(k));
-            matMult(-1., A.at(i), normals.N(i,k), A.at(k));
-          }
+        auto update = [&](UInt k)
+        {
+          if(!normals.isBlockUsed(i,k))
+            return;
+          if(!A.at(k).size())
+            A.at(k) = Matrix(A.at(i).rows(), normals.blockSize(k));
+          matMult(-1., A.at(i), normals.N(i,k), A.at(k));
+        };
+        for(UInt k=i+1; k<=std::min(i+bandwidth, lastBlock); k++)
+          update(k);
+        if(i+bandwidth < lastBlock)
+          update(lastBlock);
         if(quadsum(A.at(i)) < threshold)
           break;
       }
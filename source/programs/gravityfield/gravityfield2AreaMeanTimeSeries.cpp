@@ -21,7 +21,17 @@ The average is performed at each time step by a weigthed average over all \confi
 points where the weight is the associated area at each point. If \config{removeMean} is set
 the temporal mean is removed from the time series. To speed up the computation
 the gravity field can be converted to spherical harmonics before the computation
-with \config{convertToHarmonics}.
+with \config{convertToHarmonics}. In this case the area mean is a linear functional
+of the spherical harmonics coefficients, which is computed only once.
+This functional can also be precomputed with \program{Grid2AreaMeanPotentialCoefficients}
+and given as \configFile{inputfileAreaMeanCoefficients}{potentialCoefficients} instead of
+\configClass{grid}{gridType} and \configClass{kernel}{kernelType}. Each epoch is then evaluated
+with one inner product and the accuracy is propagated from the covariance matrix of the coefficients.
+This covariance matrix is only available as full matrix for
+\configClass{gravityfield:timeSplines}{gravityfieldType:timeSplines}, otherwise only the variances
+of the coefficients are used. For full covariance matrices of other representations
+(e.g. \configClass{gravityfield:fromParametrization}{gravityfieldType:fromParametrization})
+set \config{convertToHarmonics} to false for \config{computeSigma}.
 
 Additionally the root mean square of the values in the area at each time step
 can is computed if \config{compueRms} is set.
@@ -40,6 +50,7 @@ To visualize the results use \program{PlotGraph}.
 
 #include "programs/program.h"
 #include "files/fileInstrument.h"
+#include "files/fileSphericalHarmonics.h"
 #include "classes/grid/grid.h"
 #include "classes/timeSeries/timeSeries.h"
 #include "classes/kernel/kernel.h"
@@ -64,40 +75,51 @@ void Gravityfield2AreaMeanTimeSeries::run(Config &config, Parallel::Communicator
 {
   try
   {
-    FileName        fileNameOut;
+    FileName        fileNameOut, fileNameAreaMean;
     GridPtr         grid;
     TimeSeriesPtr   timeSeries;
     KernelPtr       kernel;
     GravityfieldPtr gravityfield;
     Bool            convertToHarmonics, computeRms, computeSigma, removeMean, multiplyWithArea;
 
-    readConfig(config, "outputfileTimeSeries", fileNameOut,        Config::MUSTSET,  "", "");
-    readConfig(config, "grid",                 grid,               Config::MUSTSET,  "", "");
-    readConfig(config, "timeSeries",           timeSeries,         Config::MUSTSET,  "", "");
-    readConfig(config, "kernel",               kernel,             Config::MUSTSET,  "", "");
-    readConfig(config, "gravityfield",         gravityfield,       Config::MUSTSET,  "", "");
-    readConfig(config, "convertToHarmonics",   convertToHarmonics, Config::DEFAULT,  "1", "gravityfield is converted to spherical harmonics before evaluation, may accelerate the computation");
-    readConfig(config, "multiplyWithArea",     multiplyWithArea,   Config::DEFAULT,  "0", "multiply time series with total area (useful for mass estimates)");
-    readConfig(config, "removeMean",           removeMean,         Config::DEFAULT,  "0", "remove the temporal mean of the series");
-    readConfig(config, "computeRms",           computeRms,         Config::DEFAULT,  "0", "additional rms each time step");
-    readConfig(config, "computeSigma",         computeSigma,       Config::DEFAULT,  "0", "additional error bars at each time step");
+    readConfig(config, "outputfileTimeSeries",          fileNameOut,        Config::MUSTSET,  "", "");
+    readConfig(config, "grid",                          grid,               Config::OPTIONAL, "", "points and areas of the region (not needed with inputfileAreaMeanCoefficients)");
+    readConfig(config, "inputfileAreaMeanCoefficients", fileNameAreaMean,   Config::OPTIONAL, "", "precomputed linear functional (Grid2AreaMeanPotentialCoefficients), instead of grid and kernel");
+    readConfig(config, "timeSeries",                    timeSeries,         Config::MUSTSET,  "", "");
+    readConfig(config, "kernel",                        kernel,             Config::OPTIONAL, "", "type of functional (not needed with inputfileAreaMeanCoefficients)");
+    readConfig(config, "gravityfield",                  gravityfield,       Config::MUSTSET,  "", "");
+    readConfig(config, "convertToHarmonics",            convertToHarmonics, Config::DEFAULT,  "1", "gravityfield is converted to spherical harmonics before evaluation, may accelerate the computation");
+    readConfig(config, "multiplyWithArea",              multiplyWithArea,   Config::DEFAULT,  "0", "multiply time series with total area (useful for mass estimates)");
+    readConfig(config, "removeMean",                    removeMean,         Config::DEFAULT,  "0", "remove the temporal mean of the series");
+    readConfig(config, "computeRms",                    computeRms,         Config::DEFAULT,  "0", "additional rms each time step");
+    readConfig(config, "computeSigma",                  computeSigma,       Config::DEFAULT,  "0", "additional error bars at each time step");
     if(isCreateSchema(config)) return;
 
-    std::vector<Time>     times  = timeSeries->times();
-    std::vector<Vector3d> points = grid->points();
-    std::vector<Double>   areas  = grid->areas();
+    if(fileNameAreaMean.empty() && (!grid || !kernel))
+      throw(Exception("grid and kernel must be set if no inputfileAreaMeanCoefficients is given"));
+    if(!fileNameAreaMean.empty() && (computeRms || !convertToHarmonics))
+      throw(Exception("computeRms and convertToHarmonics=0 need grid and kernel instead of inputfileAreaMeanCoefficients"));
 
-    // create grid
-    // -----------
-    Double totalArea = 0.0;
-    for(UInt k=0; k<areas.size(); k++)
-      totalArea += areas.at(k);
+    std::vector<Time>     times = timeSeries->times();
+    std::vector<Vector3d> points;
+    std::vector<Double>   areas;
+    if(grid)
+    {
+      points = grid->points();
+      areas  = grid->areas();
+
+      // create grid
+      // -----------
+      Double totalArea = 0.0;
+      for(UInt k=0; k<areas.size(); k++)
+        totalArea += areas.at(k);
 
-    for(UInt k=0; k<areas.size(); k++)
-      areas.at(k) *= multiplyWithArea ? std::pow(points.at(k).r(), 2) : 1.0/totalArea;
+      for(UInt k=0; k<areas.size(); k++)
+        areas.at(k) *= multiplyWithArea ? std::pow(points.at(k).r(), 2) : 1.0/totalArea;
 
-    logInfo<<"  area:             "<<totalArea/(4*PI)*100<<"% of Earth's surface ("<<totalArea*pow(DEFAULT_R/1000,2)<<" km^2)"<<Log::endl;
-    logInfo<<"  number of points: "<<points.size()<<Log::endl;
+      logInfo<<"  area:             "<<totalArea/(4*PI)*100<<"% of Earth's surface ("<<totalArea*pow(DEFAULT_R/1000,2)<<" km^2)"<<Log::endl;
+      logInfo<<"  number of points: "<<points.size()<<Log::endl;
+    }
 
     // Create values on grid
     // ---------------------
@@ -143,54 +165,83 @@ void Gravityfield2AreaMeanTimeSeries::run(Config &config, Parallel::Communicator
     // -----------------------------
     if(convertToHarmonics)
     {
-      logStatus<<"create gravity functionals"<<Log::endl;
+      // linear functional from spherical harmonics to area mean
       Vector B;
-      Parallel::forEach(value, [&](UInt i)
+      Double GM = DEFAULT_GM;
+      Double R  = DEFAULT_R;
+      UInt   maxDegree = INFINITYDEGREE;
+      if(!fileNameAreaMean.empty())
       {
-        const SphericalHarmonics harm = gravityfield->sphericalHarmonics(times.at(i));
-        const Vector x = harm.x();
-        if(B.rows() < x.rows())
-          B = MiscGriddedData::synthesisSphericalHarmonicsMatrix(harm.maxDegree(), harm.GM(), harm.R(), points, kernel, harm.isInterior()).trans() * Vector(areas);
-        return inner(B.row(0, x.rows()), x);
-      }, comm);
+        logStatus<<"read area mean coefficients from <"<<fileNameAreaMean<<">"<<Log::endl;
+        SphericalHarmonics harm;
+        readFileSphericalHarmonics(fileNameAreaMean, harm);
+        GM        = harm.GM();
+        R         = harm.R();
+        maxDegree = harm.maxDegree();
+        B         = harm.x();
+      }
 
-      if(computeRms)
+      // coefficients of a block of epochs are evaluated at once
+      logStatus<<"create gravity functionals"<<Log::endl;
+      const UInt coefficientCount = gravityfield->sphericalHarmonics(times.at(0), maxDegree, 0, GM, R).x().rows();
+      const UInt blockSize = std::max(UInt(1), UInt(10000000)/coefficientCount); // about 80 MB coefficients
+      for(UInt start=0; start<count; start+=blockSize)
       {
-        logStatus<<"compute RMS"<<Log::endl;
-        Matrix B;
-        Parallel::forEach(rms, [&](UInt i)
+        std::vector<Vector> x(std::min(blockSize, count-start));
+        Parallel::forEach(x, [&](UInt i) {return gravityfield->sphericalHarmonics(times.at(start+i), maxDegree, 0, GM, R).x();}, comm);
+        Matrix X;
+        UInt rows = 0;
+        if(Parallel::isMaster(comm))
         {
-          const SphericalHarmonics harm = gravityfield->sphericalHarmonics(times.at(i));
-          const Vector x = harm.x();
-          if(B.columns()<x.rows())
-          {
-            B = MiscGriddedData::synthesisSphericalHarmonicsMatrix(harm.maxDegree(), harm.GM(), harm.R(), points, kernel, harm.isInterior());
-            for(UInt k=0; k<points.size(); k++)
-              B.row(k) *= std::sqrt(areas.at(k));
-          }
-          return std::sqrt(quadsum(B.column(0, x.rows()) * x));
-        }, comm);
+          for(UInt i=0; i<x.size(); i++)
+            rows = std::max(rows, x.at(i).rows());
+          X = Matrix(rows, x.size());
+          for(UInt i=0; i<x.size(); i++)
+            copy(x.at(i), X.slice(0, i, x.at(i).rows(), 1));
+        }
+
+        Parallel::broadCast(rows, 0, comm);
+        if(B.rows() < rows)
+          B = MiscGriddedData::synthesisSphericalHarmonicsWeightedSum(static_cast<UInt>(std::round(std::sqrt(rows)))-1, GM, R, points, areas, kernel, comm);
+
+        if(Parallel::isMaster(comm))
+        {
+          const Vector values = X.trans() * B.row(0, X.rows());
+          for(UInt i=0; i<X.columns(); i++)
+            value.at(start+i) = values(i);
+        }
+
+        if(computeRms)
+        {
+          Parallel::broadCast(X, 0, comm);
+          const Matrix field = MiscGriddedData::synthesisSphericalHarmonics(GM, R, X, points, kernel, comm);
+          if(Parallel::isMaster(comm))
+            for(UInt i=0; i<X.columns(); i++)
+            {
+              Double sum = 0;
+              for(UInt k=0; k<points.size(); k++)
+                sum += areas.at(k) * std::pow(field(k,i), 2);
+              rms.at(start+i) = std::sqrt(sum);
+            }
+        }
       }
 
       if(computeSigma)
       {
         logStatus<<"compute accuracy"<<Log::endl;
-logWarning<<"Variance propagation from spherical harmonics to AMV may be not correct implemented. Set convertToHarmonics to FALSE."<<Log::endl;
-        Vector B;
+        Parallel::broadCast(B, 0, comm);
         Parallel::forEach(sigma, [&](UInt i)
         {
-          const SphericalHarmonics harm = gravityfield->sphericalHarmonics(times.at(i));
-          const Matrix C = gravityfield->sphericalHarmonicsCovariance(times.at(i));
-          if(B.rows() < C.rows())
-            B = MiscGriddedData::synthesisSphericalHarmonicsMatrix(harm.maxDegree(), harm.GM(), harm.R(), points, kernel, harm.isInterior()).trans() * Vector(areas);
+          const Matrix C = gravityfield->sphericalHarmonicsCovariance(times.at(i), maxDegree, 0, GM, R);
+          const UInt   n = std::min(B.rows(), C.rows());
           // full covariance matrix
           if(C.getType() == Matrix::SYMMETRIC)
-            return sqrt(inner(B.row(0, C.rows()), C * B.row(0, C.rows())));
+            return std::sqrt(inner(B.row(0, n), C.slice(0, 0, n, n) * B.row(0, n)));
           // only diagonal matrix
           Double sum = 0;
-          for(UInt i=0; i<C.rows(); i++)
-            sum += B(i)*C(i,0)*B(i);
-          return sqrt(sum);
+          for(UInt k=0; k<n; k++)
+            sum += B(k)*C(k,0)*B(k);
+          return std::sqrt(sum);
         }, comm);
       }
     }
@@ -15,6 +15,10 @@ static const char *docstring = R"(
 This program computes degree amplitudes from a \configClass{gravityfield}{gravityfieldType}
 and saves them to a \file{matrix}{matrix} file with three columns: the degree, the degree amplitude, and the formal errors.
 
+If a \configClass{timeSeries}{timeSeriesType} is given, the degree amplitudes of all epochs are written
+into one matrix. For each epoch two columns are appended: the degree amplitude and the formal errors.
+The epochs are distributed over the parallel processes.
+
 The coefficients can be converted to different functionals with \configClass{kernel}{kernelType}.
 The gravity field can be evaluated at different altitudes by specifying \config{evaluationRadius}.
 Polar regions can be excluded by setting \config{polarGap}.
@@ -30,6 +34,7 @@ See also \program{PotentialCoefficients2DegreeAmplitudes}.
 
 #include "programs/program.h"
 #include "files/fileMatrix.h"
+#include "classes/timeSeries/timeSeries.h"
 #include "classes/gravityfield/gravityfield.h"
 
 /***** CLASS ***********************************/
@@ -42,11 +47,11 @@ public:
   void run(Config &config, Parallel::CommunicatorPtr comm);
 };
 
-GROOPS_REGISTER_PROGRAM(Gravityfield2DegreeAmplitudes, SINGLEPROCESS, "computes degree amplitudes of a gravity field", Gravityfield, PotentialCoefficients)
+GROOPS_REGISTER_PROGRAM(Gravityfield2DegreeAmplitudes, PARALLEL, "computes degree amplitudes of a gravity field", Gravityfield, PotentialCoefficients)
 
 /***********************************************/
 
-void Gravityfield2DegreeAmplitudes::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
+void Gravityfield2DegreeAmplitudes::run(Config &config, Parallel::CommunicatorPtr comm)
 {
   try
   {
@@ -55,6 +60,7 @@ void Gravityfield2DegreeAmplitudes::run(Config &config, Parallel::CommunicatorPt
     FileName        fileNameCoeff;
     UInt            minDegree, maxDegree = INFINITYDEGREE;
     Time            time;
+    TimeSeriesPtr   timeSeries;
     Double          GM, R;
     Double          evalRadius = NAN_EXPR;
     GravityfieldPtr gravityfield;
@@ -73,6 +79,7 @@ void Gravityfield2DegreeAmplitudes::run(Config &config, Parallel::CommunicatorPt
       endChoice(config);
     }
     readConfig(config, "time",             time,         Config::OPTIONAL, "", "at this time the gravity field will be evaluated");
+    readConfig(config, "timeSeries",       timeSeries,   Config::DEFAULT,  "", "degree amplitudes for each epoch (instead of time)");
     readConfig(config, "evaluationRadius", evalRadius,   Config::OPTIONAL, "", "evaluate the gravity field at this radius (default: evaluate at surface");
     readConfig(config, "polarGap",         gap,          Config::DEFAULT,  "0.0", "exclude polar regions (aperture angle in degrees)");
     readConfig(config, "minDegree",        minDegree,    Config::DEFAULT,  "0", "");
@@ -88,13 +95,14 @@ void Gravityfield2DegreeAmplitudes::run(Config &config, Parallel::CommunicatorPt
 
     if(std::isnan(evalRadius)) evalRadius = R;
 
-    // Create potential coefficients
-    // -----------------------------
-    logStatus<<"create spherical harmonics"<<Log::endl;
-    SphericalHarmonics harm = gravityfield->sphericalHarmonics(time, maxDegree, minDegree, GM, R);
-    maxDegree = harm.maxDegree();
-    const Vector kn     = kernel->inverseCoefficients(Vector3d(0, 0, evalRadius), maxDegree, harm.isInterior());
-    const Bool hasSigma = harm.sigma2cnm().size() || harm.sigma2snm().size();
+    std::vector<Time> times = {time};
+    if(timeSeries && timeSeries->times().size())
+      times = timeSeries->times();
+
+    // maximum degree of the expansion
+    // -------------------------------
+    if(maxDegree == INFINITYDEGREE)
+      maxDegree = gravityfield->sphericalHarmonics(times.at(0), maxDegree, minDegree, GM, R).maxDegree();
 
     auto vectorMedian = [](std::vector<Double> &data)
     {
@@ -102,62 +110,72 @@ void Gravityfield2DegreeAmplitudes::run(Config &config, Parallel::CommunicatorPt
       return (data.size()%2) ? data.at(data.size()/2) : (0.5*(data.at(data.size()/2-1)+data.at(data.size()/2)));
     };
 
-    auto vectorAccumulate = [](std::vector<Double> &data)
-    {
-      std::for_each(data.begin(), data.end(), [](Double &v) { v = v*v; });
-      std::partial_sum(data.begin(), data.end(), data.begin());
-      std::for_each(data.begin(), data.end(), [](Double &v) { v = std::sqrt(v); });
-    };
-
-    std::vector<Double> x, y, sigma;
-    for(UInt n=0; n<=maxDegree; n++)
+    // degree amplitudes (signal, formal errors) of each epoch
+    // -------------------------------------------------------
+    logStatus<<"compute degree amplitudes of "<<times.size()<<" epoch(s)"<<Log::endl;
+    std::vector<Matrix> amplitudes(times.size());
+    Parallel::forEach(amplitudes, [&](UInt idEpoch)
     {
-      const UInt   minOrder   = static_cast<UInt>(gap*static_cast<Double>(n)+0.5); // Sneeuw
-      const Double areaFactor = (minOrder>0) ? ((2.*n+1.)/(2.*n+2.-2.*minOrder)) : (1.0);
-      const Double factor     = areaFactor * std::pow(harm.GM()/harm.R() * std::pow(harm.R()/evalRadius, n+1) * kn(n), 2);
+      const SphericalHarmonics harm = gravityfield->sphericalHarmonics(times.at(idEpoch), maxDegree, minDegree, GM, R);
+      const Vector kn     = kernel->inverseCoefficients(Vector3d(0, 0, evalRadius), maxDegree, harm.isInterior());
+      const Bool hasSigma = harm.sigma2cnm().size() || harm.sigma2snm().size();
 
-      std::vector<Double> coefficients, formalErrors;
-      for(UInt m=minOrder; m<=n; m++)
+      Matrix A(maxDegree+1, 2, NAN_EXPR);
+      for(UInt n=0; n<=std::min(maxDegree, harm.maxDegree()); n++)
       {
-        coefficients.push_back(factor * std::pow(harm.cnm()(n, m),2));
-        if(hasSigma) formalErrors.push_back(factor * harm.sigma2cnm()(n, m));
-        if(m > 0)
+        const UInt   minOrder   = static_cast<UInt>(gap*static_cast<Double>(n)+0.5); // Sneeuw
+        const Double areaFactor = (minOrder>0) ? ((2.*n+1.)/(2.*n+2.-2.*minOrder)) : (1.0);
+        const Double factor     = areaFactor * std::pow(harm.GM()/harm.R() * std::pow(harm.R()/evalRadius, n+1) * kn(n), 2);
+
+        std::vector<Double> coefficients, formalErrors;
+        for(UInt m=minOrder; m<=n; m++)
         {
-          coefficients.push_back(factor * std::pow(harm.snm()(n, m),2));
-          if(hasSigma) formalErrors.push_back(factor * harm.sigma2snm()(n, m));
+          coefficients.push_back(factor * std::pow(harm.cnm()(n, m),2));
+          if(hasSigma) formalErrors.push_back(factor * harm.sigma2cnm()(n, m));
+          if(m > 0)
+          {
+            coefficients.push_back(factor * std::pow(harm.snm()(n, m),2));
+            if(hasSigma) formalErrors.push_back(factor * harm.sigma2snm()(n, m));
+          }
         }
-      }
 
-      // degree variances
-      // ----------------
-      x.push_back(n);
-      if( (degreeType == RMS) || (degreeType == CUMMULATE) )
-      {
-        y.push_back( std::sqrt(std::accumulate(coefficients.begin(), coefficients.end(), 0.0)) );
-        if(hasSigma) sigma.push_back( std::sqrt(std::accumulate(formalErrors.begin(), formalErrors.end(), 0.0)) );
-      }
-      else if(degreeType == MEDIAN)
-      {
-        y.push_back( std::sqrt( (2*n+1) * vectorMedian(coefficients)) );
-        if(hasSigma) sigma.push_back( std::sqrt( (2*n+1) * vectorMedian(formalErrors)) );
-      }
-    } // for(n)
+        // degree variances
+        // ----------------
+        if((degreeType == RMS) || (degreeType == CUMMULATE))
+        {
+          A(n, 0) = std::accumulate(coefficients.begin(), coefficients.end(), 0.0);
+          if(hasSigma) A(n, 1) = std::accumulate(formalErrors.begin(), formalErrors.end(), 0.0);
+        }
+        else if(degreeType == MEDIAN)
+        {
+          A(n, 0) = (2*n+1) * vectorMedian(coefficients);
+          if(hasSigma) A(n, 1) = (2*n+1) * vectorMedian(formalErrors);
+        }
+      } // for(n)
 
-    if(degreeType == CUMMULATE)
-    {
-      vectorAccumulate(y);
-      if(hasSigma) vectorAccumulate(sigma);
-    }
+      if(degreeType == CUMMULATE)
+        for(UInt n=1; n<A.rows(); n++)
+          axpy(1., A.row(n-1), A.row(n));
 
-    Matrix data(x.size(), 3, NAN_EXPR);
-    copy(Vector(x), data.column(0));
-    copy(Vector(y), data.column(1));
-    if(hasSigma) copy(Vector(sigma), data.column(2));
+      for(UInt n=0; n<A.rows(); n++)
+        for(UInt k=0; k<A.columns(); k++)
+          A(n, k) = std::sqrt(A(n, k));
+      return A;
+    }, comm);
 
-    // write
-    // -----
-    logStatus<<"write degree amplitudes to file <"<<fileNameCoeff<<">"<<Log::endl;
-    writeFileMatrix(fileNameCoeff, data);
+    if(Parallel::isMaster(comm))
+    {
+      Matrix data(maxDegree+1, 1+2*times.size());
+      for(UInt n=0; n<=maxDegree; n++)
+        data(n, 0) = n;
+      for(UInt idEpoch=0; idEpoch<times.size(); idEpoch++)
+        copy(amplitudes.at(idEpoch), data.column(1+2*idEpoch, 2));
+
+      // write
+      // -----
+      logStatus<<"write degree amplitudes to file <"<<fileNameCoeff<<">"<<Log::endl;
+      writeFileMatrix(fileNameCoeff, data);
+    }
   }
   catch(std::exception &e)
   {
@@ -154,30 +154,25 @@ void Gravityfield2EmpiricalCovariance::run(Config &config, Parallel::Communicato
 
       // covariance function
       // -------------------
-      count = harm.size()-delay;
-      for(UInt i=0; i<count; i++)
+      // coefficients of all epochs as columns: one matrix product instead of an outer product per epoch
+      Matrix X(dim, harm.size());
+      for(UInt i=0; i<harm.size(); i++)
       {
-        Matrix cnm1 = harm.at(i).cnm();
-        Matrix snm1 = harm.at(i).snm();
-        Matrix cnm2 = harm.at(i+delay).cnm();
-        Matrix snm2 = harm.at(i+delay).snm();
-        // sort coefficients into vectors
-        Vector x1(dim), x2(dim);
+        const Matrix &cnm = harm.at(i).cnm();
+        const Matrix &snm = harm.at(i).snm();
         for(UInt n=0; n<=maxDegree; n++)
         {
-          if(idxC[n][0]!=NULLINDEX) x1(idxC[n][0]) = cnm1(n,0);
-          if(idxC[n][0]!=NULLINDEX) x2(idxC[n][0]) = cnm2(n,0);
+          if(idxC[n][0]!=NULLINDEX) X(idxC[n][0], i) = cnm(n,0);
           for(UInt m=1; m<=n; m++)
           {
-            if(idxC[n][m]!=NULLINDEX)  x1(idxC[n][m]) = cnm1(n,m);
-            if(idxC[n][m]!=NULLINDEX)  x2(idxC[n][m]) = cnm2(n,m);
-            if(idxS[n][m]!=NULLINDEX)  x1(idxS[n][m]) = snm1(n,m);
-            if(idxS[n][m]!=NULLINDEX)  x2(idxS[n][m]) = snm2(n,m);
+            if(idxC[n][m]!=NULLINDEX) X(idxC[n][m], i) = cnm(n,m);
+            if(idxS[n][m]!=NULLINDEX) X(idxS[n][m], i) = snm(n,m);
           }
         }
-
-        matMult(1., x1, x2.trans(), CovFull);
       }
+      count = harm.size()-delay;
+      if(count)
+        matMult(1., X.column(0, count), X.column(delay, count).trans(), CovFull);
 
       countTotal += count;
       if(removeMean)
@@ -79,20 +79,40 @@ void Gravityfield2GriddedDataTimeSeries::run(Config &config, Parallel::Communica
     // ---------------------
     logStatus<<"create values on grid for each time"<<Log::endl;
     Matrix A(times.size(), 1+points.size()); // one time column + data
-    Parallel::forEach(times.size(), [&](UInt i)
+    if(!convertToHarmonics) // All representations, all point distributions
     {
-      if(!convertToHarmonics) // All representations, all point distributions
+      Parallel::forEach(times.size(), [&](UInt i)
       {
         for(UInt k=0; k<points.size(); k++)
           A(i, 1+k) = gravityfield->field(times.at(i), points.at(k), *kernel);
-      }
-      else // fast version
+      }, comm);
+      Parallel::reduceSum(A, 0, comm);
+    }
+    else // fast version: coefficients of a block of epochs are synthesized at once
+    {
+      const UInt coefficientCount = gravityfield->sphericalHarmonics(times.at(0)).x().rows();
+      const UInt blockSize = std::max(UInt(1), UInt(10000000)/coefficientCount); // about 80 MB coefficients
+      for(UInt start=0; start<times.size(); start+=blockSize)
       {
-        std::vector<Double> field = MiscGriddedData::synthesisSphericalHarmonics(gravityfield->sphericalHarmonics(times.at(i)), points, kernel, Parallel::selfCommunicator(), FALSE/*timing*/);
-        copy(Vector(field).trans(), A.slice(i, 1, 1, field.size()));
+        std::vector<Vector> x(std::min(blockSize, times.size()-start));
+        Parallel::forEach(x, [&](UInt i) {return gravityfield->sphericalHarmonics(times.at(start+i), INFINITYDEGREE, 0, DEFAULT_GM, DEFAULT_R).x();}, comm, FALSE/*timing*/);
+        Matrix X;
+        if(Parallel::isMaster(comm))
+        {
+          UInt rows = 0;
+          for(UInt i=0; i<x.size(); i++)
+            rows = std::max(rows, x.at(i).rows());
+          X = Matrix(rows, x.size());
+          for(UInt i=0; i<x.size(); i++)
+            copy(x.at(i), X.slice(0, i, x.at(i).rows(), 1));
+        }
+        Parallel::broadCast(X, 0, comm);
+
+        const Matrix field = MiscGriddedData::synthesisSphericalHarmonics(DEFAULT_GM, DEFAULT_R, X, points, kernel, comm);
+        if(Parallel::isMaster(comm))
+          copy(field.trans(), A.slice(start, 1, X.columns(), points.size()));
       }
-    }, comm);
-    Parallel::reduceSum(A, 0, comm);
+    }
 
     // Write results
     // -------------
@@ -23,6 +23,7 @@ and the Earth gravitational constant \config{GM}.
 The \configFile{outputfileTimeSeries}{instrument} contains the potential coefficients
 as data columns for each epoch in the sequence given by
 \configClass{numbering}{sphericalHarmonicsNumberingType}.
+The epochs are distributed over the parallel processes.
 )";
 
 /***********************************************/
@@ -44,11 +45,11 @@ public:
   void run(Config &config, Parallel::CommunicatorPtr comm);
 };
 
-GROOPS_REGISTER_PROGRAM(Gravityfield2PotentialCoefficientsTimeSeries, SINGLEPROCESS, "time series of potential coefficients", Gravityfield, TimeSeries)
+GROOPS_REGISTER_PROGRAM(Gravityfield2PotentialCoefficientsTimeSeries, PARALLEL, "time series of potential coefficients", Gravityfield, TimeSeries)
 
 /***********************************************/
 
-void Gravityfield2PotentialCoefficientsTimeSeries::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
+void Gravityfield2PotentialCoefficientsTimeSeries::run(Config &config, Parallel::CommunicatorPtr comm)
 {
   try
   {
@@ -73,23 +74,34 @@ void Gravityfield2PotentialCoefficientsTimeSeries::run(Config &config, Parallel:
     std::vector<std::vector<UInt>> idxC, idxS;
     numbering->numbering(maxDegree, minDegree, idxC, idxS);
 
-    Matrix A(times.size(), 1+numbering->parameterCount(maxDegree, minDegree));
-    for(UInt idEpoch=0; idEpoch<times.size(); idEpoch++)
+    // coefficients of each epoch (distributed over processes)
+    const UInt parameterCount = numbering->parameterCount(maxDegree, minDegree);
+    std::vector<Vector> coefficients(times.size());
+    Parallel::forEach(coefficients, [&](UInt idEpoch)
     {
       SphericalHarmonics harm = gravityfield->sphericalHarmonics(times.at(idEpoch), maxDegree, minDegree, GM, R);
+      Vector x(parameterCount);
       for(UInt n=minDegree; n<=maxDegree; n++)
       {
-        if(idxC[n][0]!=NULLINDEX) A(idEpoch, 1+idxC[n][0]) = harm.cnm()(n, 0);
+        if(idxC[n][0]!=NULLINDEX) x(idxC[n][0]) = harm.cnm()(n, 0);
         for(UInt m=1; m<=n; m++)
         {
-          if(idxC[n][m]!=NULLINDEX) A(idEpoch, 1+idxC[n][m]) = harm.cnm()(n, m);
-          if(idxS[n][m]!=NULLINDEX) A(idEpoch, 1+idxS[n][m]) = harm.snm()(n, m);
+          if(idxC[n][m]!=NULLINDEX) x(idxC[n][m]) = harm.cnm()(n, m);
+          if(idxS[n][m]!=NULLINDEX) x(idxS[n][m]) = harm.snm()(n, m);
         }
       }
-    }
+      return x;
+    }, comm);
+
+    if(Parallel::isMaster(comm))
+    {
+      Matrix A(times.size(), 1+parameterCount);
+      for(UInt idEpoch=0; idEpoch<times.size(); idEpoch++)
+        copy(coefficients.at(idEpoch).trans(), A.slice(idEpoch, 1, 1, parameterCount));
 
-    logStatus<<"write time series of potential coefficients to file <"<<fileNameOut<<">"<<Log::endl;
-    InstrumentFile::write(fileNameOut, Arc(times, A));
+      logStatus<<"write time series of potential coefficients to file <"<<fileNameOut<<">"<<Log::endl;
+      InstrumentFile::write(fileNameOut, Arc(times, A));
+    }
   }
   catch(std::exception &e)
   {
@@ -23,6 +23,9 @@ r_{ij} = \frac{\sigma_{ij}}{\sigma_i \sigma_j}
 \end{equation}
 in the range of [-1, 1] instead of the covariance.
 
+With \config{convertToHarmonics} the covariance matrix of the spherical harmonics coefficients
+is used directly for blocks of points, see \program{GravityfieldVariancesPropagation2GriddedData}.
+
 See also \program{Gravityfield2GridCovarianceMatrix}, \program{GravityfieldVariancesPropagation2GriddedData}.
 )";
 
@@ -61,19 +64,20 @@ void GravityfieldCovariancesPropagation2GriddedData::run(Config &config, Paralle
     Angle           L, B;
     Double          height;
     Double          a, f;
-    Bool            calcCorrelation;
-
-    readConfig(config, "outputfileGriddedData", fileNameGrid,    Config::MUSTSET,  "", "gridded data file containing the covariance betwenn source point and grid points");
-    readConfig(config, "grid",                  grid,            Config::MUSTSET,  "", "");
-    readConfig(config, "kernel",                kernel,          Config::MUSTSET, "", "functional");
-    readConfig(config, "gravityfield",          gravityfield,    Config::MUSTSET,  "", "");
-    readConfig(config, "time",                  time,            Config::OPTIONAL, "",  "at this time the gravity field will be evaluated");
-    readConfig(config, "L",                     L,               Config::DEFAULT,  "0", "longitude of variance point");
-    readConfig(config, "B",                     B,               Config::DEFAULT,  "0", "latitude of variance point");
-    readConfig(config, "height",                height,          Config::DEFAULT,  "0", "ellipsoidal height of source point");
-    readConfig(config, "computeCorrelation",    calcCorrelation, Config::DEFAULT,  "0", "compute correlations instead of covariances");
-    readConfig(config, "R",                     a,               Config::DEFAULT,  STRING_DEFAULT_GRS80_a, "reference radius for ellipsoidal coordinates on output");
-    readConfig(config, "inverseFlattening",     f,               Config::DEFAULT,  STRING_DEFAULT_GRS80_f, "reference flattening for ellipsoidal coordinates on output, 0: spherical coordinates");
+    Bool            calcCorrelation, convertToHarmonics;
+
+    readConfig(config, "outputfileGriddedData", fileNameGrid,       Config::MUSTSET,  "", "gridded data file containing the covariance betwenn source point and grid points");
+    readConfig(config, "grid",                  grid,               Config::MUSTSET,  "", "");
+    readConfig(config, "kernel",                kernel,             Config::MUSTSET,  "", "functional");
+    readConfig(config, "gravityfield",          gravityfield,       Config::MUSTSET,  "", "");
+    readConfig(config, "time",                  time,               Config::OPTIONAL, "",  "at this time the gravity field will be evaluated");
+    readConfig(config, "L",                     L,                  Config::DEFAULT,  "0", "longitude of variance point");
+    readConfig(config, "B",                     B,                  Config::DEFAULT,  "0", "latitude of variance point");
+    readConfig(config, "height",                height,             Config::DEFAULT,  "0", "ellipsoidal height of source point");
+    readConfig(config, "computeCorrelation",    calcCorrelation,    Config::DEFAULT,  "0", "compute correlations instead of covariances");
+    readConfig(config, "convertToHarmonics",    convertToHarmonics, Config::DEFAULT,  "0", "propagate the covariance matrix of spherical harmonics in blocks of points (faster, full matrix only for timeSplines)");
+    readConfig(config, "R",                     a,                  Config::DEFAULT,  STRING_DEFAULT_GRS80_a, "reference radius for ellipsoidal coordinates on output");
+    readConfig(config, "inverseFlattening",     f,                  Config::DEFAULT,  STRING_DEFAULT_GRS80_f, "reference flattening for ellipsoidal coordinates on output, 0: spherical coordinates");
     if(isCreateSchema(config)) return;
 
     // Create grid
@@ -86,20 +90,36 @@ void GravityfieldCovariancesPropagation2GriddedData::run(Config &config, Paralle
     // -------------------
     logStatus<<"calculate covariances on grid"<<Log::endl;
     std::vector<Double> field(points.size());
-    Parallel::forEach(field, [&](UInt i) {return gravityfield->covariance(time, point0, points.at(i), *kernel);}, comm);
-
     std::vector<Double> sigma(points.size());
-    if(calcCorrelation)
+    Double sigma0 = 0;
+    if(!convertToHarmonics)
+    {
+      Parallel::forEach(field, [&](UInt i) {return gravityfield->covariance(time, point0, points.at(i), *kernel);}, comm);
+      if(calcCorrelation)
+      {
+        logStatus<<"calculate standard deviations on grid"<<Log::endl;
+        Parallel::forEach(sigma, [&](UInt i) {return sqrt(gravityfield->variance(time, points.at(i), *kernel));}, comm);
+        sigma0 = std::sqrt(gravityfield->variance(time, point0, *kernel));
+      }
+    }
+    else
     {
-      logStatus<<"calculate standard deviations on grid"<<Log::endl;
-      Parallel::forEach(sigma, [&](UInt i) {return sqrt(gravityfield->variance(time, points.at(i), *kernel));}, comm);
+      Matrix C = gravityfield->sphericalHarmonicsCovariance(time, INFINITYDEGREE, 0, DEFAULT_GM, DEFAULT_R);
+      field = MiscGriddedData::covarianceSphericalHarmonics(DEFAULT_GM, DEFAULT_R, C, point0, points, kernel, comm);
+      if(calcCorrelation)
+      {
+        logStatus<<"calculate standard deviations on grid"<<Log::endl;
+        sigma0 = std::sqrt(MiscGriddedData::varianceSphericalHarmonics(DEFAULT_GM, DEFAULT_R, C, {point0}, kernel, Parallel::selfCommunicator(), FALSE).at(0));
+        sigma  = MiscGriddedData::varianceSphericalHarmonics(DEFAULT_GM, DEFAULT_R, std::move(C), points, kernel, comm);
+        for(Double &x : sigma)
+          x = std::sqrt(x);
+      }
     }
 
     if(Parallel::isMaster(comm))
     {
       if(calcCorrelation)
       {
-        Double sigma0 = std::sqrt(gravityfield->variance(time, point0, *kernel));
         for(UInt i=0; i<field.size(); i++)
           field.at(i) /= (sigma0*sigma.at(i));
       }
@@ -18,6 +18,14 @@ given by \configClass{kernel}{kernelType}.
 The resulting \file{outputfileGriddedData}{griddedData} contains the standard deviations of the grid
 points.
 
+With \config{convertToHarmonics} the covariance matrix of the spherical harmonics coefficients
+is factorized once ($\M C = \M W^T\M W$) and the variances $\sigma_i^2 = \|\M W\M a_i\|^2$
+are computed for blocks of points with matrix-matrix products.
+This requires the covariance matrix in terms of spherical harmonics, which is only available as full matrix
+for \configClass{gravityfield:timeSplines}{gravityfieldType:timeSplines}, otherwise only the variances
+of the coefficients are used. Without \config{convertToHarmonics} each point is propagated separately,
+which supports all representations of the gravity field.
+
 See also \program{Gravityfield2GridCovarianceMatrix}, \program{GravityfieldCovariancesPropagation2GriddedData}.
 )";
 
@@ -54,14 +62,16 @@ void GravityfieldVariancesPropagation2GriddedData::run(Config &config, Parallel:
     GravityfieldPtr gravityfield;
     Time            time;
     Double          a, f;
+    Bool            convertToHarmonics;
 
-    readConfig(config, "outputfileGriddedData", fileNameGrid, Config::MUSTSET,  "", "standard deviation at each grid point");
-    readConfig(config, "grid",                  grid,         Config::MUSTSET,  "", "");
-    readConfig(config, "kernel",                kernel,       Config::MUSTSET,  "", "functional");
-    readConfig(config, "gravityfield",          gravityfield, Config::MUSTSET,  "", "");
-    readConfig(config, "time",                  time,         Config::OPTIONAL, "", "at this time the gravity field will be evaluated");
-    readConfig(config, "R",                     a,            Config::DEFAULT,  STRING_DEFAULT_GRS80_a, "reference radius for ellipsoidal coordinates on output");
-    readConfig(config, "inverseFlattening",     f,            Config::DEFAULT,  STRING_DEFAULT_GRS80_f, "reference flattening for ellipsoidal coordinates on output, 0: spherical coordinates");
+    readConfig(config, "outputfileGriddedData", fileNameGrid,       Config::MUSTSET,  "", "standard deviation at each grid point");
+    readConfig(config, "grid",                  grid,               Config::MUSTSET,  "", "");
+    readConfig(config, "kernel",                kernel,             Config::MUSTSET,  "", "functional");
+    readConfig(config, "gravityfield",          gravityfield,       Config::MUSTSET,  "", "");
+    readConfig(config, "time",                  time,               Config::OPTIONAL, "", "at this time the gravity field will be evaluated");
+    readConfig(config, "convertToHarmonics",    convertToHarmonics, Config::DEFAULT,  "0", "propagate the covariance matrix of spherical harmonics in blocks of points (faster, full matrix only for timeSplines)");
+    readConfig(config, "R",                     a,                  Config::DEFAULT,  STRING_DEFAULT_GRS80_a, "reference radius for ellipsoidal coordinates on output");
+    readConfig(config, "inverseFlattening",     f,                  Config::DEFAULT,  STRING_DEFAULT_GRS80_f, "reference flattening for ellipsoidal coordinates on output, 0: spherical coordinates");
     if(isCreateSchema(config)) return;
 
     // Compute standard deviations
@@ -70,7 +80,14 @@ void GravityfieldVariancesPropagation2GriddedData::run(Config &config, Parallel:
     std::vector<Vector3d> points = grid->points();
     std::vector<Double>   areas  = grid->areas();
     std::vector<Double>   field(points.size());
-    Parallel::forEach(field, [&](UInt i) {return sqrt(gravityfield->variance(time, points.at(i), *kernel));}, comm);
+    if(!convertToHarmonics)
+      Parallel::forEach(field, [&](UInt i) {return sqrt(gravityfield->variance(time, points.at(i), *kernel));}, comm);
+    else
+    {
+      field = MiscGriddedData::varianceSphericalHarmonics(DEFAULT_GM, DEFAULT_R, gravityfield->sphericalHarmonicsCovariance(time, INFINITYDEGREE, 0, DEFAULT_GM, DEFAULT_R), points, kernel, comm);
+      for(Double &x : field)
+        x = std::sqrt(x);
+    }
 
     if(Parallel::isMaster(comm))
     {
@@ -0,0 +1,118 @@
+/***********************************************/
+/**
+* @file grid2AreaMeanPotentialCoefficients.cpp
+*
+* @brief Linear functional of an area mean in spherical harmonics.
+*
+* @author GROOPS Developers
+* @date 2026-10-15
+*
+*/
+/***********************************************/
+
+// Latex documentation
+#define DOCSTRING docstring
+static const char *docstring = R"(
+This program computes the area mean over a region as linear functional of the spherical harmonics coefficients.
+The region is given by the points of a \configClass{grid}{gridType} (e.g. with a \configClass{border}{borderType}
+or a polygon file), where each point is weighted by its associated area.
+The type of functional (e.g. geoid heights or equivalent water heights) is choosen with \configClass{kernel}{kernelType}.
+
+The result is written as \configFile{outputfilePotentialCoefficients}{potentialCoefficients}
+in the same sequence as a gravity field, so the area mean of a field with coefficients $c_{nm}, s_{nm}$
+(related to the same \config{GM} and \config{R}) is
+\begin{equation}
+  \bar{f} = \sum_{n=0}^{N}\sum_{m=0}^{n} \bar{c}_{nm} c_{nm} + \bar{s}_{nm} s_{nm},
+\end{equation}
+where $\bar{c}_{nm}, \bar{s}_{nm}$ are the coefficients of the output file.
+If \config{multiplyWithArea} is set, the mean is multiplied with the total area (useful for mass estimates).
+
+The functional is computed with the fast summation along the rows of rectangular grids.
+It can be used in \program{Gravityfield2AreaMeanTimeSeries} to evaluate long time series
+with one inner product each epoch.
+)";
+
+/***********************************************/
+
+#include "programs/program.h"
+#include "files/fileSphericalHarmonics.h"
+#include "classes/grid/grid.h"
+#include "classes/kernel/kernel.h"
+#include "misc/miscGriddedData.h"
+
+/***** CLASS ***********************************/
+
+/** @brief Linear functional of an area mean in spherical harmonics.
+* @ingroup programsGroup */
+class Grid2AreaMeanPotentialCoefficients
+{
+public:
+  void run(Config &config, Parallel::CommunicatorPtr comm);
+};
+
+GROOPS_REGISTER_PROGRAM(Grid2AreaMeanPotentialCoefficients, PARALLEL, "linear functional of an area mean in spherical harmonics", Grid, PotentialCoefficients)
+
+/***********************************************/
+
+void Grid2AreaMeanPotentialCoefficients::run(Config &config, Parallel::CommunicatorPtr comm)
+{
+  try
+  {
+    FileName  fileNameOut;
+    GridPtr   grid;
+    KernelPtr kernel;
+    UInt      maxDegree;
+    Double    GM, R;
+    Bool      multiplyWithArea;
+
+    readConfig(config, "outputfilePotentialCoefficients", fileNameOut,      Config::MUSTSET,  "",  "area mean = inner product with field coefficients");
+    readConfig(config, "grid",                            grid,             Config::MUSTSET,  "",  "points and areas of the region");
+    readConfig(config, "kernel",                          kernel,           Config::MUSTSET,  "",  "type of functional");
+    readConfig(config, "maxDegree",                       maxDegree,        Config::MUSTSET,  "",  "");
+    readConfig(config, "GM",                              GM,               Config::DEFAULT,  STRING_DEFAULT_GM, "Geocentric gravitational constant");
+    readConfig(config, "R",                               R,                Config::DEFAULT,  STRING_DEFAULT_R,  "reference radius");
+    readConfig(config, "multiplyWithArea",                multiplyWithArea, Config::DEFAULT,  "0", "multiply with total area (useful for mass estimates)");
+    if(isCreateSchema(config)) return;
+
+    const std::vector<Vector3d> points = grid->points();
+    std::vector<Double>         areas  = grid->areas();
+
+    Double totalArea = 0.0;
+    for(UInt k=0; k<areas.size(); k++)
+      totalArea += areas.at(k);
+
+    for(UInt k=0; k<areas.size(); k++)
+      areas.at(k) *= multiplyWithArea ? std::pow(points.at(k).r(), 2) : 1.0/totalArea;
+
+    logInfo<<"  area:             "<<totalArea/(4*PI)*100<<"% of Earth's surface ("<<totalArea*pow(DEFAULT_R/1000,2)<<" km^2)"<<Log::endl;
+    logInfo<<"  number of points: "<<points.size()<<Log::endl;
+
+    logStatus<<"compute area mean functional"<<Log::endl;
+    const Vector x = MiscGriddedData::synthesisSphericalHarmonicsWeightedSum(maxDegree, GM, R, points, areas, kernel, comm);
+
+    if(Parallel::isMaster(comm))
+    {
+      Matrix cnm(maxDegree+1, Matrix::TRIANGULAR, Matrix::LOWER);
+      Matrix snm(maxDegree+1, Matrix::TRIANGULAR, Matrix::LOWER);
+      UInt idx = 0;
+      for(UInt n=0; n<=maxDegree; n++)
+      {
+        cnm(n,0) = x(idx++);
+        for(UInt m=1; m<=n; m++)
+        {
+          cnm(n,m) = x(idx++);
+          snm(n,m) = x(idx++);
+        }
+      }
+
+      logStatus<<"write potential coefficients to file <"<<fileNameOut<<">"<<Log::endl;
+      writeFileSphericalHarmonics(fileNameOut, SphericalHarmonics(GM, R, cnm, snm));
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
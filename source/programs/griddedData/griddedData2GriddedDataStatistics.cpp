@@ -17,6 +17,8 @@ of a new \configClass{grid}{gridType}. If some of the new points are not filled
 \config{emptyValue} is used instead. If multiple points of the input fall on the same node
 the result can be selected with \config{statistics} (e.g. mean, root mean square, min, max, \ldots).
 It also is possible to simply count the number of data points that were assigned to each point.
+The nearest nodes of rectangular grids are computed directly from longitude and latitude,
+for other grids a kd-tree is used. The input points are accumulated in parallel threads.
 
 Be aware in case borders are given within \configClass{grid}{gridType}, the \configFile{outputfileGriddedData}{griddedData} will have points excluded before the assignement of old points to the new points.
 The data from \configFile{inputfileGriddedData}{griddedData} will not be limited by the given borders! See \reference{GriddedDataConcatenate}{GriddedDataConcatenate} to limit the
@@ -28,12 +30,28 @@ The data from \configFile{inputfileGriddedData}{griddedData} will not be limited
 /***********************************************/
 
 #include "programs/program.h"
+#include "base/kdTree.h"
 #include "files/fileGriddedData.h"
 #include "classes/grid/grid.h"
 #include "misc/miscGriddedData.h"
 
 /***** CLASS ***********************************/
 
+/** @brief Index of the nearest node in monotonic coordinates.
+* Equidistant nodes are computed directly, otherwise by binary search. */
+class NearestNode
+{
+  std::vector<Double> x;
+  Double x0, dx;
+  Bool   equidistant, descending;
+
+public:
+  NearestNode(const std::vector<Angle> &nodes);
+  UInt operator()(Double value) const;
+};
+
+/***********************************************/
+
 /** @brief Assign gridded data to grid points.
 * @ingroup programsGroup */
 class GriddedData2GriddedDataStatistics
@@ -46,6 +64,41 @@ GROOPS_REGISTER_PROGRAM(GriddedData2GriddedDataStatistics, SINGLEPROCESS, "Assig
 
 /***********************************************/
 
+NearestNode::NearestNode(const std::vector<Angle> &nodes) : x(nodes.begin(), nodes.end()), x0(0), dx(0), equidistant(FALSE), descending(FALSE)
+{
+  if(x.size() < 2)
+    return;
+  x0 = x.front();
+  dx = (x.back()-x.front())/(x.size()-1);
+  equidistant = (dx != 0);
+  for(UInt i=0; equidistant && (i<x.size()); i++)
+    equidistant = (std::fabs(x.at(i)-x0-i*dx) < 1e-6*std::fabs(dx));
+  descending = (x.back() < x.front());
+  if(descending) // binary search in ascending order
+    std::transform(x.begin(), x.end(), x.begin(), [](Double v) {return -v;});
+}
+
+/***********************************************/
+
+UInt NearestNode::operator()(Double value) const
+{
+  if(x.size() < 2)
+    return 0;
+  if(equidistant)
+    return static_cast<UInt>(std::min(std::max(std::round((value-x0)/dx), 0.), x.size()-1.));
+
+  if(descending)
+    value = -value;
+  const UInt idx = std::distance(x.begin(), std::lower_bound(x.begin(), x.end(), value));
+  if(idx == 0)
+    return 0;
+  if(idx == x.size())
+    return x.size()-1;
+  return (value-x.at(idx-1) <= x.at(idx)-value) ? idx-1 : idx;
+}
+
+/***********************************************/
+
 void GriddedData2GriddedDataStatistics::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
 {
   try
@@ -98,82 +151,105 @@ void GriddedData2GriddedDataStatistics::run(Config &config, Parallel::Communicat
     Double initialValue = 0;
     if(type == MIN) initialValue =  1e99;
     if(type == MAX) initialValue = -1e99;
-    gridNew.values.resize(grid.values.size(), std::vector<Double>(gridNew.points.size(), initialValue));
 
     std::vector<Angle>  lambda, phi;
     std::vector<Double> radius;
     const Bool isRectangle = gridNew.isRectangle(lambda, phi, radius);
-
-    // additional variables
-    std::vector<std::vector<Double>> count, wmean, weight;
-    count.resize(gridNew.values.size(), std::vector<Double>(gridNew.points.size(), 0));
-    if((type == STD) || (type == WSTD))
-      wmean.resize(gridNew.values.size(), std::vector<Double>(gridNew.points.size(), 0));
-    if((type == WMEAN) || (type == WRMS) || (type == WSTD))
-      weight.resize(gridNew.values.size(), std::vector<Double>(gridNew.points.size(), 0));
+    KdTree kdTree;
+    if(!isRectangle)
+      kdTree.init(gridNew.points);
+    const NearestNode nearestLon(lambda);
+    const NearestNode nearestLat(phi);
 
     // Assign grid
     // -----------
+    // each thread accumulates a contiguous range of points into its own cells,
+    // which are combined afterwards in the order of the points
     logStatus<<"assign grid"<<Log::endl;
-    Single::forEach(grid.points.size(), [&](UInt i)
+    struct Statistics
     {
-      // find nearest neighbor
-      UInt idx = 0;
-      if(isRectangle)
-      {
-        const Angle lon = grid.points.at(i).lambda();
-        const Angle lat = grid.points.at(i).phi();
-        const UInt  col = std::distance(lambda.begin(), std::min_element(lambda.begin(), lambda.end(),
-                                        [&](Angle lon1, Angle lon2) {return std::fabs(lon-lon1) < std::fabs(lon-lon2);}));
-        const UInt  row = std::distance(phi.begin(), std::min_element(phi.begin(), phi.end(),
-                                        [&](Angle lat1, Angle lat2) {return std::fabs(lat-lat1) < std::fabs(lat-lat2);}));
-        idx = row * lambda.size() + col;
-      }
-      else
-      {
-        Double minDistance = std::numeric_limits<Double>::max();
-        for(UInt k=0; k<gridNew.points.size(); k++)
-        {
-          const Double distance = (gridNew.points[k] - grid.points[i]).r();
-          if(distance < minDistance)
-          {
-            minDistance = distance;
-            idx = k;
-          }
-        }
-      }
-      Double w = 1;
+      std::vector<std::vector<Double>> values, count, wmean, weight;
+    };
+    const UInt threads = std::max(std::min(Parallel::threadCount(), grid.points.size()/std::max(gridNew.points.size(), UInt(1))), UInt(1));
+    std::vector<Statistics> statistics(threads);
+    Parallel::threadLoop(0, threads, [&](UInt idThread)
+    {
+      Statistics &stat = statistics.at(idThread);
+      stat.values.resize(grid.values.size(), std::vector<Double>(gridNew.points.size(), initialValue));
+      stat.count.resize(grid.values.size(), std::vector<Double>(gridNew.points.size(), 0));
+      if((type == STD) || (type == WSTD))
+        stat.wmean.resize(grid.values.size(), std::vector<Double>(gridNew.points.size(), 0));
       if((type == WMEAN) || (type == WRMS) || (type == WSTD))
-        w = grid.areas.at(i);
+        stat.weight.resize(grid.values.size(), std::vector<Double>(gridNew.points.size(), 0));
 
-      for(UInt k=0; k<grid.values.size(); k++)
+      for(UInt i=idThread*grid.points.size()/threads; i<(idThread+1)*grid.points.size()/threads; i++)
       {
-        const Double v = grid.values.at(k).at(i);
-        if(std::isnan(v))
-          continue;
-
-        if(count.size())  count.at(k).at(idx)++;
-        if(weight.size()) weight.at(k).at(idx) += w;
-        if(wmean.size())  wmean.at(k).at(idx)  += w*v;
+        // find nearest neighbor
+        const UInt idx = isRectangle ? nearestLat(grid.points.at(i).phi()) * lambda.size() + nearestLon(grid.points.at(i).lambda())
+                                     : kdTree.nearest(grid.points.at(i));
+        Double w = 1;
+        if((type == WMEAN) || (type == WRMS) || (type == WSTD))
+          w = grid.areas.at(i);
 
-        switch(type)
+        for(UInt k=0; k<grid.values.size(); k++)
         {
-          case MEAN:
-          case WMEAN:
-          case SUM:   gridNew.values.at(k).at(idx) += w*v;   break;
-          case RMS:
-          case WRMS:
-          case STD:
-          case WSTD:  gridNew.values.at(k).at(idx) += w*v*v; break;
-          case MIN:   gridNew.values.at(k).at(idx)  = std::min(v, gridNew.values.at(k).at(idx)); break;
-          case MAX:   gridNew.values.at(k).at(idx)  = std::max(v, gridNew.values.at(k).at(idx)); break;
-          case LAST:  gridNew.values.at(k).at(idx)  = v  ; break;
-          case FIRST: if(count.at(k).at(idx) == 1) gridNew.values.at(k).at(idx) = v; break;
-          default: ;
+          const Double v = grid.values.at(k).at(i);
+          if(std::isnan(v))
+            continue;
+
+          stat.count.at(k).at(idx)++;
+          if(stat.weight.size()) stat.weight.at(k).at(idx) += w;
+          if(stat.wmean.size())  stat.wmean.at(k).at(idx)  += w*v;
+
+          switch(type)
+          {
+            case MEAN:
+            case WMEAN:
+            case SUM:   stat.values.at(k).at(idx) += w*v;   break;
+            case RMS:
+            case WRMS:
+            case STD:
+            case WSTD:  stat.values.at(k).at(idx) += w*v*v; break;
+            case MIN:   stat.values.at(k).at(idx)  = std::min(v, stat.values.at(k).at(idx)); break;
+            case MAX:   stat.values.at(k).at(idx)  = std::max(v, stat.values.at(k).at(idx)); break;
+            case LAST:  stat.values.at(k).at(idx)  = v  ; break;
+            case FIRST: if(stat.count.at(k).at(idx) == 1) stat.values.at(k).at(idx) = v; break;
+            default: ;
+          }
         }
       }
     });
 
+    // combine threads
+    // ---------------
+    for(UInt idThread=1; idThread<statistics.size(); idThread++)
+    {
+      const Statistics &stat = statistics.at(idThread);
+      for(UInt k=0; k<grid.values.size(); k++)
+        for(UInt idx=0; idx<gridNew.points.size(); idx++)
+          if(stat.count.at(k).at(idx))
+          {
+            Double &value = statistics.at(0).values.at(k).at(idx);
+            switch(type)
+            {
+              case MIN:   value = std::min(value, stat.values.at(k).at(idx)); break;
+              case MAX:   value = std::max(value, stat.values.at(k).at(idx)); break;
+              case LAST:  value = stat.values.at(k).at(idx); break;
+              case FIRST: if(!statistics.at(0).count.at(k).at(idx)) value = stat.values.at(k).at(idx); break;
+              case COUNT: break;
+              default:    value += stat.values.at(k).at(idx);
+            }
+            statistics.at(0).count.at(k).at(idx) += stat.count.at(k).at(idx);
+            if(stat.weight.size()) statistics.at(0).weight.at(k).at(idx) += stat.weight.at(k).at(idx);
+            if(stat.wmean.size())  statistics.at(0).wmean.at(k).at(idx)  += stat.wmean.at(k).at(idx);
+          }
+    }
+    gridNew.values = std::move(statistics.at(0).values);
+    std::vector<std::vector<Double>> count  = std::move(statistics.at(0).count);
+    std::vector<std::vector<Double>> wmean  = std::move(statistics.at(0).wmean);
+    std::vector<std::vector<Double>> weight = std::move(statistics.at(0).weight);
+    statistics.clear();
+
     // post computation
     // ----------------
     for(UInt k=0; k<gridNew.values.size(); k++)
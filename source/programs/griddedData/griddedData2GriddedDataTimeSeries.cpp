@@ -64,29 +64,41 @@ void GriddedData2GriddedDataTimeSeries::run(Config &config, Parallel::Communicat
     if(times.size()+splineDegree-1 != fileNamesGrid.size())
       throw(Exception("fileCount("+fileNamesGrid.size()%"%i) != timeCount("s+times.size()%"%i)-1+splineDegree"s));
 
-    GriddedData         grid;
-    std::vector<Matrix> data;
-    for(UInt idEpoch=0; idEpoch<times.size(); idEpoch++)
+    // nodes are written directly after reading, grids not readable are written as zeros
+    OutFileGriddedDataTimeSeries file;
+    UInt countMissing = 0;
+    for(UInt idNode=0; idNode<fileNamesGrid.size(); idNode++)
     {
+      GriddedData grid;
       try
       {
-        logStatus<<"read gridded data <"<<fileNamesGrid.at(idEpoch)<<">"<<Log::endl;
-        readFileGriddedData(fileNamesGrid.at(idEpoch), grid);
-        if(!data.size())
-          data.resize(times.size(), Matrix(grid.points.size(), grid.values.size()));
-        for(UInt k=0; k<grid.values.size(); k++)
-          for(UInt i=0; i<grid.values.at(k).size(); i++)
-            data.at(idEpoch)(i,k) = grid.values.at(k).at(i);
+        logStatus<<"read gridded data <"<<fileNamesGrid.at(idNode)<<">"<<Log::endl;
+        readFileGriddedData(fileNamesGrid.at(idNode), grid);
       }
       catch(std::exception &e)
       {
         logWarning<<e.what()<<Log::endl;
+        if(file.fileName().empty())
+          countMissing++;
+        else
+          file.writeNode(Matrix(file.pointCount(), file.dataCount()));
+        continue;
       }
-    }
 
-    logStatus<<"write time series to file <"<<fileNameOut<<">"<<Log::endl;
-    grid.values.clear();
-    writeFileGriddedDataTimeSeries(fileNameOut, splineDegree, times, grid, data);
+      const Matrix data = grid.valuesMatrix();
+
+      if(file.fileName().empty())
+      {
+        logStatus<<"write time series to file <"<<fileNameOut<<">"<<Log::endl;
+        grid.values.clear();
+        file.open(fileNameOut, splineDegree, times, grid, data.columns());
+        for(; countMissing; countMissing--)
+          file.writeNode(Matrix(data.rows(), data.columns()));
+      }
+      file.writeNode(data);
+    }
+    if(file.fileName().empty())
+      throw(Exception("no gridded data readable"));
   }
   catch(std::exception &e)
   {
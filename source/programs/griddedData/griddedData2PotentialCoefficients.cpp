@@ -23,6 +23,13 @@ gravity field functionals. It used a simple quadrature formular
 or a \config{leastSquares} adjustment with block diagonal normal matrix (order by order).
 For the latter one the data must be regular distributed.
 
+For regular rectangular grids (e.g. geographic, Gauss or Driscoll-Healy grids) the quadrature
+is computed ring by ring: the sums along each latitude are evaluated first for all orders
+and the Legendre functions are computed only once per latitude.
+This reduces the computational effort from $O(N^4)$ to $O(N^3)$ for maximum degree $N$.
+Together with suitable quadrature weights (e.g. Gauss weights times longitude spacing)
+this is an exact spherical harmonic analysis without setting up normal equations.
+
 The \config{value}s $f_i$ and the \config{weight}s $\Delta\Phi_i$ are expressions
 using the common data variables for grids, see \reference{dataVariables}{general.parser:dataVariables}.
 The type of the gridded data (e.g gravity anomalies or geoid heights)
@@ -70,8 +77,9 @@ class GriddedData2PotentialCoefficients
   Double                lPl;
 
 
-  SphericalHarmonics computeQuadrature(Bool isRectangle, Parallel::CommunicatorPtr comm);
+  SphericalHarmonics computeQuadrature(Parallel::CommunicatorPtr comm);
   SphericalHarmonics computeLeastSquares(Bool isRectangle, Parallel::CommunicatorPtr comm);
+  void               computeCosSinm();
   void               buildNormals(UInt i);
   void               buildNormalsFast(UInt i);
 
@@ -142,7 +150,7 @@ void GriddedData2PotentialCoefficients::run(Config &config, Parallel::Communicat
     if(useLeastSquares)
       harm = computeLeastSquares(isRectangle, comm);
     else
-      harm = computeQuadrature(isRectangle, comm);
+      harm = computeQuadrature(comm);
 
     // write potential coefficients
     // ----------------------------
@@ -160,27 +168,15 @@ void GriddedData2PotentialCoefficients::run(Config &config, Parallel::Communicat
 
 /***********************************************/
 
-SphericalHarmonics GriddedData2PotentialCoefficients::computeQuadrature(Bool /*isRectangle*/, Parallel::CommunicatorPtr comm)
+SphericalHarmonics GriddedData2PotentialCoefficients::computeQuadrature(Parallel::CommunicatorPtr comm)
 {
   try
   {
-    Matrix cnm(maxDegree+1, Matrix::TRIANGULAR, Matrix::LOWER);
-    Matrix snm(maxDegree+1, Matrix::TRIANGULAR, Matrix::LOWER);
     logStatus<<"computing quadrature formular"<<Log::endl;
-    Parallel::forEach(grid.points.size(), [&](UInt i)
-    {
-      const Vector kn = kernel->coefficients(grid.points.at(i), maxDegree);
-      Matrix Cnm, Snm;
-      SphericalHarmonics::CnmSnm(grid.points.at(i)/grid.points.at(i).r(), maxDegree, Cnm, Snm);
-      for(UInt n=minDegree; n<=maxDegree; n++)
-      {
-        axpy((kn(n)* R/(4*PI*GM) * std::pow(grid.points.at(i).r()/R, n+1) * grid.values.at(0).at(i) * grid.areas.at(i)), Cnm.row(n), cnm.row(n));
-        axpy((kn(n)* R/(4*PI*GM) * std::pow(grid.points.at(i).r()/R, n+1) * grid.values.at(0).at(i) * grid.areas.at(i)), Snm.row(n), snm.row(n));
-      }
-    }, comm);
-    Parallel::reduceSum(cnm, 0, comm);
-    Parallel::reduceSum(snm, 0, comm);
-    return SphericalHarmonics(GM, R, cnm, snm);
+    std::vector<SphericalHarmonics> harms = MiscGriddedData::analysisSphericalHarmonics(maxDegree, GM, R, grid.points, grid.areas, grid.values, kernel, comm);
+    if(!Parallel::isMaster(comm))
+      return SphericalHarmonics();
+    return harms.at(0).get(maxDegree, minDegree);
   }
   catch(std::exception &e)
   {
@@ -226,17 +222,7 @@ SphericalHarmonics GriddedData2PotentialCoefficients::computeLeastSquares(Bool i
       for(UInt i=0; i<grid.points.size(); i++)
         lPl += grid.values.at(0).at(i) * grid.areas.at(i)/(4*PI) * grid.values.at(0).at(i);
 
-      cossinm = Matrix(lambda.size(), 2*maxDegree+1);
-      for(UInt k=0; k<lambda.size(); k++)
-      {
-        cossinm(k,0) = 1.;
-        for(UInt m=1; m<=maxDegree; m++)
-        {
-          cossinm(k,2*m-1) = cos(m*static_cast<Double>(lambda.at(k)));
-          cossinm(k,2*m+0) = sin(m*static_cast<Double>(lambda.at(k)));
-        }
-      }
-
+      computeCosSinm();
       Parallel::forEach(phi.size(), [this](UInt i){buildNormalsFast(i);}, comm);
     } // if(isRectangle)
 
@@ -315,6 +301,22 @@ SphericalHarmonics GriddedData2PotentialCoefficients::computeLeastSquares(Bool i
 
 /***********************************************/
 
+void GriddedData2PotentialCoefficients::computeCosSinm()
+{
+  cossinm = Matrix(lambda.size(), 2*maxDegree+1);
+  for(UInt k=0; k<lambda.size(); k++)
+  {
+    cossinm(k,0) = 1.;
+    for(UInt m=1; m<=maxDegree; m++)
+    {
+      cossinm(k,2*m-1) = cos(m*static_cast<Double>(lambda.at(k)));
+      cossinm(k,2*m+0) = sin(m*static_cast<Double>(lambda.at(k)));
+    }
+  }
+}
+
+/***********************************************/
+
 void GriddedData2PotentialCoefficients::buildNormals(UInt i)
 {
   try
@@ -156,6 +156,8 @@ void GriddedDataCalculate::run(Config &config, Parallel::CommunicatorPtr /*comm*
     std::for_each(paramExpr.begin(), paramExpr.end(), [&](auto expr) {addVariable(expr, varList);});
     auto varListWoData = varList;
     addDataVariables(gridIn, varList, usedVariables);
+    // point wise varying variables are evaluated column wise
+    DataVariableColumns columns(gridIn);
 
     // =====================================================
 
@@ -169,23 +171,11 @@ void GriddedDataCalculate::run(Config &config, Parallel::CommunicatorPtr /*comm*
 
       for(UInt k=0; k<lsaExpr.size(); k++)
       {
-        std::vector<ExpressionVariablePtr> lsaA(paramExpr.size());
-        for(UInt s=0; s<paramExpr.size(); s++)
-        {
-          lsaA.at(s) = lsaExpr.at(k)->derivative(paramExpr.at(s)->name(), varList);
-          lsaA.at(s)->simplify(varList);
-        }
-        lsaExpr.at(k)->simplify(varList);
-
-        for(UInt i=0; i<gridIn.points.size(); i++)
-        {
-          evaluateDataVariables(gridIn, i, varList);
-          l(i+k*gridIn.points.size()) = -lsaExpr.at(k)->evaluate(varList); // observations
-          for(UInt s=0; s<lsaA.size(); s++)
-            A(i+k*gridIn.points.size(),s) = lsaA.at(s)->evaluate(varList); // columns of design matrix
-        }
-        undefineDataVariables(gridIn, varList);
+        columns.evaluate(columns.compile(lsaExpr.at(k), varList), l.field()+k*gridIn.points.size()); // observations
+        for(UInt s=0; s<paramExpr.size(); s++) // columns of design matrix
+          columns.evaluate(columns.compile(lsaExpr.at(k)->derivative(paramExpr.at(s)->name(), varList), varList), A.field()+k*gridIn.points.size()+s*A.ld());
       }
+      l *= -1;
 
       Vector x = leastSquares(A,l);
       for(UInt s=0; s<paramExpr.size(); s++)
@@ -203,30 +193,33 @@ void GriddedDataCalculate::run(Config &config, Parallel::CommunicatorPtr /*comm*
     // calculate output grid
     // ---------------------
     logStatus<<"calculate output matrix"<<Log::endl;
-    lonExpr->simplify(varList);
-    latExpr->simplify(varList);
-    heightExpr->simplify(varList);
-    if(areaExpr)
-      areaExpr->simplify(varList);
-    std::for_each(removeExpr.begin(), removeExpr.end(), [&](auto expr) {expr->simplify(varList);});
-    std::for_each(valueExpr.begin(),  valueExpr.end(),  [&](auto expr) {expr->simplify(varList);});
+    std::vector<Bool> remove(gridIn.points.size(), FALSE);
+    for(auto &expr : removeExpr)
+    {
+      const Vector criterion = columns.evaluate(columns.compile(expr, varList));
+      for(UInt i=0; i<gridIn.points.size(); i++)
+        remove.at(i) = remove.at(i) || (criterion(i) != 0.);
+    }
+    const Vector L    = columns.evaluate(columns.compile(lonExpr,    varList));
+    const Vector B    = columns.evaluate(columns.compile(latExpr,    varList));
+    const Vector h    = columns.evaluate(columns.compile(heightExpr, varList));
+    const Vector area = areaExpr ? columns.evaluate(columns.compile(areaExpr, varList)) : Vector();
+    std::vector<Vector> values(valueExpr.size());
+    for(UInt k=0; k<valueExpr.size(); k++)
+      values.at(k) = columns.evaluate(columns.compile(valueExpr.at(k), varList));
 
     GriddedData gridOut;
     gridOut.ellipsoid = Ellipsoid(a,f);
     gridOut.values.resize(valueExpr.size());
     for(UInt i=0; i<gridIn.points.size(); i++)
     {
-      evaluateDataVariables(gridIn, i, varList);
-      if(std::any_of(removeExpr.begin(), removeExpr.end(), [&](auto expr) {return expr->evaluate(varList) != 0.;}))
+      if(remove.at(i))
         continue;
-      Double L = lonExpr->evaluate(varList);
-      Double B = latExpr->evaluate(varList);
-      Double h = heightExpr->evaluate(varList);
-      gridOut.points.push_back( gridOut.ellipsoid(Angle(L*DEG2RAD), Angle(B*DEG2RAD), h) );
+      gridOut.points.push_back( gridOut.ellipsoid(Angle(L(i)*DEG2RAD), Angle(B(i)*DEG2RAD), h(i)) );
       if(areaExpr)
-        gridOut.areas.push_back( areaExpr->evaluate(varList) );
+        gridOut.areas.push_back( area(i) );
       for(UInt k=0; k<valueExpr.size(); k++)
-        gridOut.values.at(k).push_back( valueExpr.at(k)->evaluate(varList) );
+        gridOut.values.at(k).push_back( values.at(k)(i) );
     }
 
     // =====================================================
@@ -2,7 +2,7 @@
 /**
 * @file griddedDataInterpolate.cpp
 *
-* @brief Interpolate values of rectangular grids to new points.
+* @brief Interpolate values of grids to new points.
 *
 * @author Torsten Mayer-Guerr
 * @date 2019-05-11
@@ -12,11 +12,12 @@
 // Latex documentation
 #define DOCSTRING docstring
 static const char *docstring = R"(
-Interpolate values of a regular rectangular \configFile{inputfileGriddedData}{griddedData}
+Interpolate values of a \configFile{inputfileGriddedData}{griddedData}
 to new points given by \configClass{grid}{gridType} and write as \configFile{outputfileGriddedData}{griddedData}.
 Only longitude and latitude of points are considered; the height is ignored for interpolation.
 
 (Only nearest neighbor method is implemented at the moment.)
+The nearest points are found with a spatial index (k-d tree), so also large irregular grids can be interpolated.
 
 \fig{!hb}{0.8}{griddedDataInterpolate}{fig:griddedDataInterpolate}{Interpolation of point data from rectangular gridded data.}
 )";
@@ -24,13 +25,14 @@ Only longitude and latitude of points are considered; the height is ignored for
 /***********************************************/
 
 #include "programs/program.h"
+#include "base/kdTree.h"
 #include "files/fileGriddedData.h"
 #include "classes/grid/grid.h"
 #include "misc/miscGriddedData.h"
 
 /***** CLASS ***********************************/
 
-/** @brief Interpolate values of rectangular grids to new points.
+/** @brief Interpolate values of grids to new points.
 * @ingroup programsGroup */
 class GriddedDataInterpolate
 {
@@ -38,7 +40,7 @@ public:
   void run(Config &config, Parallel::CommunicatorPtr comm);
 };
 
-GROOPS_REGISTER_PROGRAM(GriddedDataInterpolate, SINGLEPROCESS, "Interpolate values of rectangular grids to new points", Grid)
+GROOPS_REGISTER_PROGRAM(GriddedDataInterpolate, SINGLEPROCESS, "Interpolate values of grids to new points", Grid)
 
 /***********************************************/
 
@@ -51,7 +53,7 @@ void GriddedDataInterpolate::run(Config &config, Parallel::CommunicatorPtr /*com
     std::string choice;
 
     readConfig(config, "outputfileGriddedData", fileNameOutGrid, Config::MUSTSET, "", "");
-    readConfig(config, "inputfileGriddedData",  fileNameInGrid,  Config::MUSTSET, "", "must be rectangular");
+    readConfig(config, "inputfileGriddedData",  fileNameInGrid,  Config::MUSTSET, "", "");
     readConfig(config, "grid",                  gridPtr,         Config::MUSTSET, "", "");
     if(readConfigChoice(config, "method", choice, Config::MUSTSET, "", ""))
     {
@@ -63,29 +65,37 @@ void GriddedDataInterpolate::run(Config &config, Parallel::CommunicatorPtr /*com
     // read grid
     // ---------
     logStatus<<"read grid from file <"<<fileNameInGrid<<">"<<Log::endl;
-    GriddedDataRectangular grid;
+    GriddedData grid;
     readFileGriddedData(fileNameInGrid, grid);
     MiscGriddedData::printStatistics(grid);
 
     logStatus<<"create grid"<<Log::endl;
     GriddedData pointList(grid.ellipsoid, gridPtr->points(), gridPtr->areas(), std::vector<std::vector<Double>>(grid.values.size(), std::vector<Double>(gridPtr->points().size(), 0.)));
 
+    // points at the ellipsoid (height ignored)
+    auto surfacePoints = [&](const std::vector<Vector3d> &points)
+    {
+      std::vector<Vector3d> surface(points.size());
+      for(UInt i=0; i<points.size(); i++)
+      {
+        Angle  L, B;
+        Double h;
+        grid.ellipsoid(points.at(i), L, B, h);
+        surface.at(i) = grid.ellipsoid(L, B, 0.);
+      }
+      return surface;
+    };
+
     // interpolate
     // -----------
-    for(UInt i=0; i<pointList.points.size(); i++)
+    logStatus<<"interpolate"<<Log::endl;
+    const KdTree kdTree(surfacePoints(grid.points));
+    const std::vector<Vector3d> points = surfacePoints(pointList.points);
+    for(UInt i=0; i<points.size(); i++)
     {
-      Angle  L, B;
-      Double h;
-      grid.ellipsoid(pointList.points.at(i), L, B, h);
-
-      // find nearest neighbor
-      const UInt row = std::distance(grid.latitudes.begin(), std::min_element(grid.latitudes.begin(), grid.latitudes.end(),
-                                     [&B](Angle B1, Angle B2) {return std::fabs(B-B1) < std::fabs(B-B2);}));
-      const UInt col = std::distance(grid.longitudes.begin(), std::min_element(grid.longitudes.begin(), grid.longitudes.end(),
-                                     [&L](Angle L1, Angle L2) {return std::fabs(L-L1) < std::fabs(L-L2);}));
-
+      const UInt idx = kdTree.nearest(points.at(i)); // nearest neighbor
       for(UInt k=0; k<grid.values.size(); k++)
-        pointList.values.at(k).at(i) = grid.values.at(k)(row, col);
+        pointList.values.at(k).at(i) = grid.values.at(k).at(idx);
     }
 
     // write
@@ -16,6 +16,7 @@ Generate coarse grid by computing mean values.
 The number of points is decimated by averaging integer multiplies of grid points
 (\config{multiplierLongitude}, \config{multiplierLatitude}).
 The fine grid can be written, where the coarse grid values are additionally appended.
+The columns of the coarse grid are computed in parallel threads.
 )";
 
 /***********************************************/
@@ -115,31 +116,37 @@ void GriddedDataReduceSampling::run(Config &config, Parallel::CommunicatorPtr /*
     // Compute mean values
     // -------------------
     logStatus<<"compute mean values"<<Log::endl;
+    std::vector<Double> dPhiCosPhi1(rows1);
+    for(UInt z=0; z<rows1; z++)
+      dPhiCosPhi1.at(z) = std::cos(phi1.at(z)) * dPhi1.at(z);
+
     grid1.values.push_back( Matrix(rows1, cols1) );
-    for(UInt idx=0; idx<grid2.values.size(); idx++)
+    Parallel::threadLoop(0, cols2, [&](UInt s) // columns of coarse grid are independent
+    {
       for(UInt z=0; z<rows2; z++)
-        for(UInt s=0; s<cols2; s++)
-        {
-          Double sum    = 0;
-          Double weight = 0;
+      {
+        Double weight = 0;
+        for(UInt k=0; k<numberCols; k++)
           for(UInt i=0; i<numberRows; i++)
-          {
-            const Double dPhicosPhi = cos(phi1.at(z*numberRows+i)) * dPhi1.at(z*numberRows+i);
-            for(UInt k=0; k<numberCols; k++)
-            {
-              const Double w = dPhicosPhi * dLambda1.at(s*numberCols+k);
-              sum    += w * grid1.values.at(idx)(z*numberRows+i, s*numberCols+k);
-              weight += w;
-            }
-          }
+            weight += dPhiCosPhi1.at(z*numberRows+i) * dLambda1.at(s*numberCols+k);
+
+        for(UInt idx=0; idx<grid2.values.size(); idx++)
+        {
+          const Matrix &values1 = grid1.values.at(idx);
+          Double sum = 0;
+          for(UInt k=0; k<numberCols; k++)
+            for(UInt i=0; i<numberRows; i++) // inner loop along the stored columns
+              sum += dPhiCosPhi1.at(z*numberRows+i) * dLambda1.at(s*numberCols+k) * values1(z*numberRows+i, s*numberCols+k);
           sum /= weight;
           grid2.values.at(idx)(z, s) = sum;
 
           if(idx==0)
-            for(UInt i=0; i<numberRows; i++)
-              for(UInt k=0; k<numberCols; k++)
+            for(UInt k=0; k<numberCols; k++)
+              for(UInt i=0; i<numberRows; i++)
                 grid1.values.back()(z*numberRows+i, s*numberCols+k) = sum;
         }
+      }
+    });
 
     MiscGriddedData::printStatistics(grid1);
     MiscGriddedData::printStatistics(grid2);
@@ -0,0 +1,142 @@
+/***********************************************/
+/**
+* @file griddedDataSphericalHarmonicsFilter.cpp
+*
+* @brief Filter gridded data in the spherical harmonics domain.
+*
+* @author GROOPS Developers
+* @date 2026-10-15
+*/
+/***********************************************/
+
+// Latex documentation
+#define DOCSTRING docstring
+static const char *docstring = R"(
+This program filters all data columns of \configFile{inputfileGriddedData}{griddedData}
+in the spherical harmonics domain. Each column is analysed with the quadrature formula
+(see \program{GriddedData2PotentialCoefficients})
+\begin{equation}
+  c_{nm} = \frac{1}{4\pi}\frac{R}{GM} \sum_i f_i \left(\frac{r_i}{R}\right)^{n+1} k_n C_{nm}(\lambda_i,\vartheta_i)\,\Delta\Phi_i,
+\end{equation}
+where the type of the input values is given by \configClass{kernelInput}{kernelType} and
+the weights $\Delta\Phi_i$ by the expression \config{weight}.
+The coefficients between \config{minDegree} and \config{maxDegree} are filtered
+with \configClass{filter}{sphericalHarmonicsFilterType}
+and synthesized at the same points as functionals given by \configClass{kernelOutput}{kernelType}.
+An isotropic filter can also be applied with the output kernel (e.g. \configClass{filterGauss}{kernelType:filterGauss}).
+
+On rectangular grids (e.g. geographic or Gauss grids) analysis and synthesis are computed ring by ring
+with the Legendre functions computed only once per latitude for all columns.
+Together with suitable weights (e.g. Gauss grids) the analysis is exact.
+)";
+
+/***********************************************/
+
+#include "programs/program.h"
+#include "parser/dataVariables.h"
+#include "files/fileGriddedData.h"
+#include "classes/kernel/kernel.h"
+#include "classes/sphericalHarmonicsFilter/sphericalHarmonicsFilter.h"
+#include "misc/miscGriddedData.h"
+
+/***** CLASS ***********************************/
+
+/** @brief Filter gridded data in the spherical harmonics domain.
+* @ingroup programsGroup */
+class GriddedDataSphericalHarmonicsFilter
+{
+public:
+  void run(Config &config, Parallel::CommunicatorPtr comm);
+};
+
+GROOPS_REGISTER_PROGRAM(GriddedDataSphericalHarmonicsFilter, PARALLEL, "Filter gridded data in the spherical harmonics domain", Grid, PotentialCoefficients)
+
+/***********************************************/
+
+void GriddedDataSphericalHarmonicsFilter::run(Config &config, Parallel::CommunicatorPtr comm)
+{
+  try
+  {
+    FileName                    fileNameOut, fileNameGrid;
+    ExpressionVariablePtr       exprArea;
+    KernelPtr                   kernelIn, kernelOut;
+    SphericalHarmonicsFilterPtr filter;
+    UInt                        minDegree, maxDegree;
+    Double                      GM, R;
+
+    readConfig(config, "outputfileGriddedData", fileNameOut,  Config::MUSTSET,  "",     "");
+    readConfig(config, "inputfileGriddedData",  fileNameGrid, Config::MUSTSET,  "",     "");
+    readConfig(config, "weight",                exprArea,     Config::MUSTSET,  "area", "expression to compute the quadrature weights (input columns are named data0, data1, ...)");
+    readConfig(config, "kernelInput",           kernelIn,     Config::MUSTSET,  "",     "data type of input values");
+    readConfig(config, "kernelOutput",          kernelOut,    Config::MUSTSET,  "",     "data type of output values");
+    readConfig(config, "filter",                filter,       Config::DEFAULT,  "",     "filter the coefficients");
+    readConfig(config, "minDegree",             minDegree,    Config::DEFAULT,  "0",    "");
+    readConfig(config, "maxDegree",             maxDegree,    Config::MUSTSET,  "",     "");
+    readConfig(config, "GM",                    GM,           Config::DEFAULT,  STRING_DEFAULT_GM, "Geocentric gravitational constant");
+    readConfig(config, "R",                     R,            Config::DEFAULT,  STRING_DEFAULT_R,  "reference radius");
+    if(isCreateSchema(config)) return;
+
+    // reading grid
+    // ------------
+    logStatus<<"read grid from file <"<<fileNameGrid<<">"<<Log::endl;
+    GriddedData grid;
+    readFileGriddedData(fileNameGrid, grid);
+    if(!grid.values.size())
+      throw(Exception("grid contains no values"));
+
+    // evaluate weights
+    // ----------------
+    auto varList = config.getVarList();
+    std::set<std::string> usedVariables;
+    exprArea->usedVariables(varList, usedVariables);
+    addDataVariables(grid, varList, usedVariables);
+    exprArea->simplify(varList);
+    std::vector<Double> weights(grid.points.size());
+    for(UInt i=0; i<grid.points.size(); i++)
+    {
+      evaluateDataVariables(grid, i, varList);
+      weights.at(i) = exprArea->evaluate(varList);
+    }
+
+    // analysis
+    // --------
+    logStatus<<"spherical harmonics analysis of "<<grid.values.size()<<" data columns"<<Log::endl;
+    std::vector<SphericalHarmonics> harms = MiscGriddedData::analysisSphericalHarmonics(maxDegree, GM, R, grid.points, weights, grid.values, kernelIn, comm);
+
+    // filter
+    // ------
+    Matrix x;
+    if(Parallel::isMaster(comm))
+    {
+      for(auto &harm : harms)
+        harm = harm.get(maxDegree, minDegree);
+      harms = filter->filter(harms);
+      x = Matrix((maxDegree+1)*(maxDegree+1), harms.size());
+      for(UInt idField=0; idField<harms.size(); idField++)
+        copy(harms.at(idField).get(maxDegree, 0, GM, R).x(), x.column(idField));
+    }
+    Parallel::broadCast(x, 0, comm);
+
+    // synthesis
+    // ---------
+    logStatus<<"spherical harmonics synthesis"<<Log::endl;
+    const Matrix field = MiscGriddedData::synthesisSphericalHarmonics(GM, R, x, grid.points, kernelOut, comm);
+
+    if(Parallel::isMaster(comm))
+    {
+      for(UInt idField=0; idField<grid.values.size(); idField++)
+        for(UInt i=0; i<grid.points.size(); i++)
+          grid.values.at(idField).at(i) = field(i, idField);
+
+      logStatus<<"save values to file <"<<fileNameOut<<">"<<Log::endl;
+      writeFileGriddedData(fileNameOut, grid);
+      MiscGriddedData::printStatistics(grid);
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
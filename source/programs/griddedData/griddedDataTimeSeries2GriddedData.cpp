@@ -68,7 +68,6 @@ void GriddedDataTimeSeries2GriddedData::run(Config &config, Parallel::Communicat
     InFileGriddedDataTimeSeries file(fileNameIn);
     GriddedData grid = file.grid();
     MiscGriddedData::printStatistics(grid);
-    grid.values = std::vector<std::vector<Double>>(file.dataCount(), std::vector<Double>(grid.points.size()));
     std::vector<Time> times = file.times();
     if(timeSeries)
       times = timeSeries->times();
@@ -82,10 +81,7 @@ void GriddedDataTimeSeries2GriddedData::run(Config &config, Parallel::Communicat
       if(!nameTime.empty())  varList[nameTime]->setValue(times.at(idEpoch).mjd());
       if(!nameIndex.empty()) varList[nameIndex]->setValue(idEpoch);
       logStatus<<"write gridded data <"<<fileNameOut(varList)<<">"<<Log::endl;
-      Matrix data = file.data(times.at(idEpoch));
-      for(UInt i=0; i<grid.points.size(); i++)
-        for(UInt k=0; k<data.columns(); k++)
-          grid.values.at(k).at(i) = data(i, k);
+      grid.setValues(file.data(times.at(idEpoch)));
       writeFileGriddedData(fileNameOut(varList), grid);
     }
   }
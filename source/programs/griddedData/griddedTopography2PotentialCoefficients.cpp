@@ -14,12 +14,16 @@
 static const char *docstring = R"(
 Estimate potential coefficients from digital terrain models.
 Coefficients for interior $(1/r)^{n+1}$ and exterior ($r^n$) are computed.
+
+The grid is distributed in latitude bands over the processes, so no process holds the complete grid.
+For complete equidistant rings of longitudes (global grids) the sums over longitudes are computed with FFT.
 )";
 
 /***********************************************/
 
 #include "programs/program.h"
 #include "base/legendreFunction.h"
+#include "base/fourier.h"
 #include "parser/dataVariables.h"
 #include "files/fileGriddedData.h"
 #include "files/fileSphericalHarmonics.h"
@@ -39,14 +43,18 @@ class GriddedTopography2PotentialCoefficients
   Matrix                cnmExt, snmExt;
   Matrix                cnmInt, snmInt;
   Matrix                cosm, sinm;
+  Bool                  isRing;       // complete equidistant ring of longitudes -> FFT
+  Double                deltaLambda;  // signed spacing of ring
 
   UInt                  rows, cols;
   std::vector<Double>   dLambda, dPhi;
   std::vector<Angle>    lambda;
   std::vector<Angle>    phi;
-  Matrix                rLower, rUpper, rho;
+  UInt                  rowStart;     // first row of the latitude band of this process
+  Matrix                rLower, rUpper, rho; // latitude band only
 
   void computeCoefficientsRow(UInt row);
+  void sumLongitudes(const Matrix &f, const Matrix &Pnm, Matrix &cnm, Matrix &snm) const;
 
 public:
   void run(Config &config, Parallel::CommunicatorPtr comm);
@@ -77,24 +85,19 @@ void GriddedTopography2PotentialCoefficients::run(Config &config, Parallel::Comm
     readConfig(config, "R",                        R,               Config::DEFAULT,  STRING_DEFAULT_R,  "reference radius");
     if(isCreateSchema(config)) return;
 
+    GriddedDataRectangular grid;
+    std::vector<Double>    radius;
+    VariableList           varList;
     if(Parallel::isMaster(comm))
     {
       // read rectangular grid
       // ---------------------
       logStatus<<"read grid from file <"<<fileNameInGrid<<">"<<Log::endl;
-      GriddedDataRectangular grid;
       readFileGriddedData(fileNameInGrid, grid);
       MiscGriddedData::printStatistics(grid);
-
-      std::vector<Double> radius;
       grid.geocentric(lambda, phi, radius, dLambda, dPhi);
-      rows = phi.size();
-      cols = lambda.size();
 
-      // evaluate upper and lower height
-      // -------------------------------
-      logStatus<<"evaluate upper and lower height"<<Log::endl;
-      auto varList = config.getVarList();
+      varList = config.getVarList();
       std::set<std::string> usedVariables;
       expressionUpper->usedVariables(varList, usedVariables);
       expressionLower->usedVariables(varList, usedVariables);
@@ -104,22 +107,8 @@ void GriddedTopography2PotentialCoefficients::run(Config &config, Parallel::Comm
       expressionUpper->simplify(varList);
       expressionLower->simplify(varList);
       expressionRho  ->simplify(varList);
-
-      rLower = rUpper =  rho = Matrix(rows,cols);
-      for(UInt z=0; z<rows; z++)
-        for(UInt s=0; s<cols; s++)
-        {
-          evaluateDataVariables(grid, z, s, varList);
-          varList["area"]->setValue( dLambda.at(s)*dPhi.at(z)*cos(phi.at(z)) ); // area
-          rUpper(z,s) = radius.at(z) + expressionUpper->evaluate(varList);
-          rLower(z,s) = radius.at(z) + expressionLower->evaluate(varList);
-          rho(z,s)    = expressionRho->evaluate(varList);
-        }
     } // if(Parallel::isMaster(comm))
 
-    Parallel::broadCast(rUpper,  0, comm);
-    Parallel::broadCast(rLower,  0, comm);
-    Parallel::broadCast(rho,     0, comm);
     Parallel::broadCast(lambda,  0, comm);
     Parallel::broadCast(phi,     0, comm);
     Parallel::broadCast(dLambda, 0, comm);
@@ -127,17 +116,77 @@ void GriddedTopography2PotentialCoefficients::run(Config &config, Parallel::Comm
     rows = phi.size();
     cols = lambda.size();
 
+    // latitude bands
+    // --------------
+    const UInt processCount = Parallel::size(comm);
+    std::vector<UInt> bandStart(processCount+1);
+    for(UInt p=0; p<=processCount; p++)
+      bandStart.at(p) = p*rows/processCount;
+    std::vector<UInt> processNo(rows);
+    for(UInt p=0; p<processCount; p++)
+      std::fill(processNo.begin()+bandStart.at(p), processNo.begin()+bandStart.at(p+1), p);
+    rowStart = bandStart.at(Parallel::myRank(comm));
+
+    // evaluate upper and lower height
+    // -------------------------------
+    logStatus<<"evaluate upper and lower height and distribute latitude bands"<<Log::endl;
+    if(Parallel::isMaster(comm))
+    {
+      for(UInt p=processCount; p-->0;) // master band at last
+      {
+        Matrix upper, lower, density;
+        upper = lower = density = Matrix(bandStart.at(p+1)-bandStart.at(p), cols);
+        for(UInt z=bandStart.at(p); z<bandStart.at(p+1); z++)
+          for(UInt s=0; s<cols; s++)
+          {
+            evaluateDataVariables(grid, z, s, varList);
+            varList["area"]->setValue( dLambda.at(s)*dPhi.at(z)*cos(phi.at(z)) ); // area
+            upper  (z-bandStart.at(p),s) = radius.at(z) + expressionUpper->evaluate(varList);
+            lower  (z-bandStart.at(p),s) = radius.at(z) + expressionLower->evaluate(varList);
+            density(z-bandStart.at(p),s) = expressionRho->evaluate(varList);
+          }
+        if(p == 0)
+        {
+          rUpper = upper;
+          rLower = lower;
+          rho    = density;
+          break;
+        }
+        Parallel::send(upper,   p, comm);
+        Parallel::send(lower,   p, comm);
+        Parallel::send(density, p, comm);
+      }
+      grid = GriddedDataRectangular();
+    }
+    else
+    {
+      Parallel::receive(rUpper, 0, comm);
+      Parallel::receive(rLower, 0, comm);
+      Parallel::receive(rho,    0, comm);
+    }
+
+    // complete equidistant ring of longitudes?
+    // ----------------------------------------
+    isRing = (cols > 2*maxDegree);
+    deltaLambda = (cols > 1) ? std::remainder(lambda.at(1)-lambda.at(0), 2*PI) : 0.;
+    isRing = isRing && (std::fabs(std::fabs(deltaLambda)-2*PI/cols) < 1e-10);
+    for(UInt k=0; isRing && (k<cols); k++)
+      isRing = (std::fabs(std::remainder(lambda.at(k)-lambda.at(0)-k*deltaLambda, 2*PI)) < 1e-10) && (std::fabs(dLambda.at(k)-std::fabs(deltaLambda)) < 1e-10);
+
     // precompute integral_sin, integral_cos
     // -------------------------------------
-    cosm = Matrix(lambda.size(), maxDegree+1);
-    sinm = Matrix(lambda.size(), maxDegree+1);
-    for(UInt i=0; i<lambda.size(); i++)
+    if(!isRing)
     {
-      cosm(i,0) = dLambda.at(i);
-      for(UInt m=1; m<=maxDegree; m++)
+      cosm = Matrix(lambda.size(), maxDegree+1);
+      sinm = Matrix(lambda.size(), maxDegree+1);
+      for(UInt i=0; i<lambda.size(); i++)
       {
-        cosm(i,m) = cos(m*static_cast<Double>(lambda.at(i))) * 2*sin(m*dLambda.at(i)/2)/m;
-        sinm(i,m) = sin(m*static_cast<Double>(lambda.at(i))) * 2*sin(m*dLambda.at(i)/2)/m;
+        cosm(i,0) = dLambda.at(i);
+        for(UInt m=1; m<=maxDegree; m++)
+        {
+          cosm(i,m) = cos(m*static_cast<Double>(lambda.at(i))) * 2*sin(m*dLambda.at(i)/2)/m;
+          sinm(i,m) = sin(m*static_cast<Double>(lambda.at(i))) * 2*sin(m*dLambda.at(i)/2)/m;
+        }
       }
     }
 
@@ -148,7 +197,7 @@ void GriddedTopography2PotentialCoefficients::run(Config &config, Parallel::Comm
     if(isExterior) snmExt = Matrix(maxDegree+1, Matrix::TRIANGULAR, Matrix::LOWER);
     if(isInterior) cnmInt = Matrix(maxDegree+1, Matrix::TRIANGULAR, Matrix::LOWER);
     if(isInterior) snmInt = Matrix(maxDegree+1, Matrix::TRIANGULAR, Matrix::LOWER);
-    Parallel::forEach(phi.size(), [this](UInt i){computeCoefficientsRow(i);}, comm);
+    Parallel::forEachProcess(phi.size(), [this](UInt i){computeCoefficientsRow(i);}, processNo, comm);
     if(isExterior) Parallel::reduceSum(cnmExt, 0, comm);
     if(isExterior) Parallel::reduceSum(snmExt, 0, comm);
     if(isInterior) Parallel::reduceSum(cnmInt, 0, comm);
@@ -184,19 +233,20 @@ void GriddedTopography2PotentialCoefficients::computeCoefficientsRow(UInt row)
   try
   {
     Matrix fExt, fInt;
+    const UInt z = row-rowStart; // row in latitude band
 
     if(isExterior)
     {
       fExt = Matrix(lambda.size(), maxDegree+1);
       for(UInt k=0; k<lambda.size(); k++)
       {
-        if(fabs(rUpper(row,k)-rLower(row,k))<0.001)
+        if(fabs(rUpper(z,k)-rLower(z,k))<0.001)
           continue;
 
-        const Double dense= rho(row,k);
+        const Double dense= rho(z,k);
         const Double term = factor * dense * GRAVITATIONALCONSTANT/GM * R*R*R;
-        const Double r1R  = rLower(row,k)/R;
-        const Double r2R  = rUpper(row,k)/R;
+        const Double r1R  = rLower(z,k)/R;
+        const Double r2R  = rUpper(z,k)/R;
         Double r1RnExt = term * pow(r1R, minDegree+3);
         Double r2RnExt = term * pow(r2R, minDegree+3);
 
@@ -214,13 +264,13 @@ void GriddedTopography2PotentialCoefficients::computeCoefficientsRow(UInt row)
       fInt = Matrix(lambda.size(), maxDegree+1);
       for(UInt k=0; k<lambda.size(); k++)
       {
-        if(fabs(rUpper(row,k)-rLower(row,k))<0.001)
+        if(fabs(rUpper(z,k)-rLower(z,k))<0.001)
           continue;
 
-        const Double dense= rho(row,k);
+        const Double dense= rho(z,k);
         const Double term = factor * dense * GRAVITATIONALCONSTANT/GM * R*R*R;
-        const Double Rr1  = R/rLower(row,k);
-        const Double Rr2  = R/rUpper(row,k);
+        const Double Rr1  = R/rLower(z,k);
+        const Double Rr2  = R/rUpper(z,k);
         Double r1RnInt = term * pow(Rr1, minDegree-2.);
         Double r2RnInt = term * pow(Rr2, minDegree-2.);
 
@@ -229,7 +279,7 @@ void GriddedTopography2PotentialCoefficients::computeCoefficientsRow(UInt row)
           if(n!=2.)
             fInt(k,n) = (r2RnInt-r1RnInt)/((2.*n+1)*(2.-n));
           else
-            fInt(k,n) = term * log(rUpper(row,k)/rLower(row,k))/(2.*n+1);
+            fInt(k,n) = term * log(rUpper(z,k)/rLower(z,k))/(2.*n+1);
           r1RnInt *= Rr1;
           r2RnInt *= Rr2;
         } // for(n)
@@ -244,32 +294,47 @@ void GriddedTopography2PotentialCoefficients::computeCoefficientsRow(UInt row)
                      * (cos(PI/2-phi.at(row)-fabs(dPhi.at(row))/2) - cos(PI/2-phi.at(row)+fabs(dPhi.at(row))/2));
 
     if(isExterior)
-    {
-      Matrix cnm(maxDegree+1, Matrix::TRIANGULAR, Matrix::LOWER);
-      Matrix snm(maxDegree+1, Matrix::TRIANGULAR, Matrix::LOWER);
-      for(UInt n=minDegree; n<=maxDegree; n++)
-        for(UInt m=0; m<=n; m++)
-        {
-          cnm(n,m) += Pnm(n,m) * inner(cosm.column(m), fExt.column(n));
-          snm(n,m) += Pnm(n,m) * inner(sinm.column(m), fExt.column(n));
-        }
-      cnmExt += cnm;
-      snmExt += snm;
-    } // if(isExterior)
-
+      sumLongitudes(fExt, Pnm, cnmExt, snmExt);
     if(isInterior)
+      sumLongitudes(fInt, Pnm, cnmInt, snmInt);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void GriddedTopography2PotentialCoefficients::sumLongitudes(const Matrix &f, const Matrix &Pnm, Matrix &cnm, Matrix &snm) const
+{
+  try
+  {
+    if(isRing)
     {
-      Matrix cnm(maxDegree+1, Matrix::TRIANGULAR, Matrix::LOWER);
-      Matrix snm(maxDegree+1, Matrix::TRIANGULAR, Matrix::LOWER);
+      // sum_k f(k,n) exp(-i m lambda_k) = exp(-i m lambda_0) * FFT(f(:,n))_m
+      const auto F = Fourier::fftColumns(f);
+      const Double lambda0 = static_cast<Double>(lambda.at(0));
       for(UInt n=minDegree; n<=maxDegree; n++)
         for(UInt m=0; m<=n; m++)
         {
-          cnm(n,m) += Pnm(n,m) * inner(cosm.column(m), fInt.column(n));
-          snm(n,m) += Pnm(n,m) * inner(sinm.column(m), fInt.column(n));
+          const std::complex<Double> Fm = (deltaLambda > 0) ? F.at(n).at(m) : std::conj(F.at(n).at(m));
+          const std::complex<Double> sum = std::polar(1., -static_cast<Double>(m)*lambda0) * Fm;
+          const Double integral = (m == 0) ? std::fabs(deltaLambda) : 2*std::sin(m*std::fabs(deltaLambda)/2)/m;
+          cnm(n,m) += Pnm(n,m) * integral * sum.real();
+          snm(n,m) -= Pnm(n,m) * integral * sum.imag();
         }
-      cnmInt += cnm;
-      snmInt += snm;
-    } // if(isInterior)
+      return;
+    }
+
+    const Matrix C = cosm.trans() * f;
+    const Matrix S = sinm.trans() * f;
+    for(UInt n=minDegree; n<=maxDegree; n++)
+      for(UInt m=0; m<=n; m++)
+      {
+        cnm(n,m) += Pnm(n,m) * C(m,n);
+        snm(n,m) += Pnm(n,m) * S(m,n);
+      }
   }
   catch(std::exception &e)
   {
@@ -64,7 +64,7 @@ void Instrument2AllanVariance::run(Config &config, Parallel::CommunicatorPtr com
     if(Parallel::isMaster(comm))
     {
       arcCount = instrumentFile.arcCount();
-      std::vector<Time> times;
+      MedianSampling medianSampling; // without keeping all times of long series in memory
 
       arcEpochCount = 0;
       for(UInt arcNo = 0; arcNo<arcCount; arcNo++)
@@ -72,12 +72,10 @@ void Instrument2AllanVariance::run(Config &config, Parallel::CommunicatorPtr com
         Arc arc = instrumentFile.readArc(arcNo);
         if(arc.size() == 0)
           continue;
-        auto arcTimes = arc.times();
-
         arcEpochCount = std::max(arc.size(), arcEpochCount);
-        times.insert(times.end(), arcTimes.begin(), arcTimes.end());
+        medianSampling.add(arc.times());
       }
-      sampling = medianSampling(times);
+      sampling = medianSampling.median();
 
       logInfo<<"  maximum arc length: "<<arcEpochCount<<" epochs"<<Log::endl;
       logInfo<<"  median sampling:    "<<sampling.seconds()<<" seconds"<<Log::endl;
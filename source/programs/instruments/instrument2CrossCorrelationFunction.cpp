@@ -124,18 +124,14 @@ void Instrument2CrossCorrelationFunction::run(Config &config, Parallel::Communic
       std::vector<Time> times = arc.times();
       if(isRegular(times)) // fast version possible?
       {
-        count(maxLag-1) += X.rows();
-        for(UInt col=1; col<crossCovariance.columns(); col++)
-          crossCovariance(maxLag-1, col) += inner(X.column(col), Y.column(col));
-        for(UInt h=1; h<X.rows(); h++)
+        // lagged products of all data columns with zero padded FFT
+        const UInt lagCount = std::min(X.rows(), maxLag);
+        const Matrix C = Fourier::crossCorrelation(Y.slice(0, 1, X.rows(), dataCount), X.column(1, dataCount), lagCount-1);
+        axpy(1., C, crossCovariance.slice(maxLag-lagCount, 1, C.rows(), dataCount));
+        for(UInt h=0; h<lagCount; h++)
         {
           count(maxLag-1-h) += X.rows()-h;
-          count(maxLag-1+h) += X.rows()-h;
-          for(UInt col=1; col<crossCovariance.columns(); col++)
-          {
-            crossCovariance(maxLag-1-h, col) += inner(X.slice(0, col, X.rows()-h, 1), Y.slice(h, col, X.rows()-h, 1));
-            crossCovariance(maxLag-1+h, col) += inner(X.slice(h, col, X.rows()-h, 1), Y.slice(0, col, X.rows()-h, 1));
-          }
+          if(h) count(maxLag-1+h) += X.rows()-h;
         }
       }
       else // general case
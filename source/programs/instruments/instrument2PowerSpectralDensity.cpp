@@ -25,7 +25,8 @@ The PSD for this frequency is then computed by forming the square sum of adjuste
 \end{equation}
 
 The resulting PSD is the average over all arcs. For regularly sampled time series,
-this method yields the same results as FFT based PSD estimates.
+this method yields the same results as FFT based PSD estimates. Arcs without gaps
+and with the maximum arc length are therefore computed with the FFT.
 
 A regular frequency grid based on the longest arc and the median sampling is computed.
 The maximum number of epochs per arc is determined by
@@ -87,7 +88,7 @@ void Instrument2PowerSpectralDensity::run(Config &config, Parallel::Communicator
     Double sampling = 1.0;
     if(Parallel::isMaster(comm))
     {
-      std::vector<Time> times;
+      MedianSampling medianSampling; // without keeping all times of long series in memory
       Time maxArcLen;
       for(UInt arcNo=0; arcNo<arcCount; arcNo++)
       {
@@ -96,9 +97,9 @@ void Instrument2PowerSpectralDensity::run(Config &config, Parallel::Communicator
           continue;
         std::vector<Time> arcTimes = arc.times();
         maxArcLen = std::max(arcTimes.back() - arcTimes.front(), maxArcLen);
-        times.insert(times.end(), arcTimes.begin(), arcTimes.end());
+        medianSampling.add(arcTimes);
       }
-      sampling      = medianSampling(times).seconds();
+      sampling      = medianSampling.median().seconds();
       arcEpochCount = static_cast<UInt>(std::round(maxArcLen.seconds()/sampling)+1);
       logInfo<<"  maximum arc length: "<<arcEpochCount<<" epochs"<<Log::endl;
       logInfo<<"  median sampling:    "<<sampling<<" seconds"<<Log::endl;
@@ -120,6 +121,23 @@ void Instrument2PowerSpectralDensity::run(Config &config, Parallel::Communicator
       for(UInt i=0; i<t.rows(); i++)
         t(i) = (arc.at(i).time-arc.at(0).time).seconds();
 
+      // arc without gaps over the full frequency grid:
+      // sinusoids are orthogonal and the adjusted square sums are given by the FFT
+      Bool isRegular = (arc.size() == arcEpochCount) && (arcEpochCount > 1);
+      for(UInt i=0; isRegular && (i<t.rows()); i++)
+        isRegular = (std::fabs(t(i)-i*sampling) < 1e-5);
+      if(isRegular)
+      {
+        const auto F = Fourier::fftColumns(data.column(1, data.columns()-1));
+        for(UInt i=0; i<F.size(); i++)
+          for(UInt k=0; k<freqs.size(); k++)
+          {
+            const Bool isNyquist = (arcEpochCount%2 == 0) && (2*k == arcEpochCount);
+            PSD(k, i+1) += ((k == 0) || isNyquist ? 1. : 2.) * std::norm(F.at(i).at(k))/arcEpochCount;
+          }
+        return;
+      }
+
       // square sum of observations
       Vector lPl(data.columns()-1);
       for(UInt i=0; i<lPl.rows(); i++)
@@ -24,7 +24,8 @@ $P_{xy}$ is the cross-spectral density between $x$ and $y$ and $P_{xx}$, $P_{yy}
 Auto- and cross-spectral densities are computed using Lomb's method (see \program{Instrument2PowerSpectralDensity} for details).
 
 The resulting PSD is the average over all arcs. For regularly sampled time series,
-this method yields the same results as FFT based PSD estimates.
+this method yields the same results as FFT based PSD estimates. Regularly sampled arcs
+with the maximum number of epochs are therefore directly transformed with FFT.
 
 A regular frequency grid based on the longest arc and the median sampling is computed.
 The maximum number of epochs per arc is determined by
@@ -58,6 +59,7 @@ class Instrument2SpectralCoherence
 {
   Matrix designMatrix(const Vector &t, Double f, Bool isNyquist = FALSE);
   std::vector<std::vector<std::complex<Double>>> leastSquaresFourier(const Vector &freqs, const_MatrixSliceRef arcMatrix, Bool countEven);
+  std::vector<std::vector<std::complex<Double>>> fftFourier(const_MatrixSliceRef arcMatrix);
 
 public:
   void run(Config &config, Parallel::CommunicatorPtr comm);
@@ -140,8 +142,15 @@ void Instrument2SpectralCoherence::run(Config &config, Parallel::CommunicatorPtr
       Matrix X = arc.matrix();
       Matrix Y = arcRef.matrix();
 
-      std::vector<std::vector<std::complex<Double>>> F = leastSquaresFourier(freqs, X, countEven);
-      std::vector<std::vector<std::complex<Double>>> G = leastSquaresFourier(freqs, Y, countEven);
+      // complete regular arcs: least squares fit is equivalent to FFT
+      auto fourier = [&](const Arc &arc, const_MatrixSliceRef A)
+      {
+        if((A.rows() == arcEpochCount) && isRegular(arc.times()))
+          return fftFourier(A);
+        return leastSquaresFourier(freqs, A, countEven);
+      };
+      std::vector<std::vector<std::complex<Double>>> F = fourier(arc,    X);
+      std::vector<std::vector<std::complex<Double>>> G = fourier(arcRef, Y);
 
       // accumulate estimates
       for(UInt k = 0; k<std::min(F.size(), G.size()); k++)
@@ -242,3 +251,14 @@ std::vector<std::vector<std::complex<Double>>> Instrument2SpectralCoherence::lea
 }
 
 /***********************************************/
+
+std::vector<std::vector<std::complex<Double>>> Instrument2SpectralCoherence::fftFourier(const_MatrixSliceRef arcMatrix)
+{
+  auto F = Fourier::fftColumns(arcMatrix.column(1, arcMatrix.columns()-1));
+  for(auto &f : F)
+    for(auto &c : f)
+      c *= 1./arcMatrix.rows();
+  return F;
+}
+
+/***********************************************/
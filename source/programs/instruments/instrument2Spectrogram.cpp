@@ -100,12 +100,10 @@ void Instrument2Spectrogram::run(Config &config, Parallel::CommunicatorPtr comm)
       copy(A.slice(row, 1+startData, std::min(rows, windowCount), countData), signal.row(0, std::min(rows, windowCount)));
 
       // compute fft
+      const auto F = Fourier::fftColumns(signal);
       for(UInt k=0; k<countData; k++)
-      {
-        std::vector<std::complex<Double>> f = Fourier::fft(signal.column(k));
-        for(UInt i=0; i<f.size(); i++)
-          spectrogram(idx+i, 2+k) = std::abs(f.at(i))*std::sqrt(sampling/f.size());
-      }
+        for(UInt i=0; i<F.at(k).size(); i++)
+          spectrogram(idx+i, 2+k) = std::abs(F.at(k).at(i))*std::sqrt(sampling/F.at(k).size());
     }, comm);
     Parallel::reduceSum(spectrogram, 0, comm);
 
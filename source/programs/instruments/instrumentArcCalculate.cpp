@@ -115,17 +115,18 @@ void InstrumentArcCalculate::run(Config &config, Parallel::CommunicatorPtr comm)
     Parallel::forEach(arcList, [&](UInt arcNo)
     {
       // read data
-      std::vector<Arc> arc(file.size());
+      std::vector<ArcColumns> arc(file.size());
       for(UInt i=0; i<arc.size(); i++)
-        arc.at(i) = file.at(i).readArc(arcNo);
+        arc.at(i) = file.at(i).readArcColumns(arcNo);
       for(UInt i=1; i<arc.size(); i++)
-        Arc::checkSynchronized({arc.at(0), arc.at(i)});
+        if(arc.at(0).size() && arc.at(i).size() && (arc.at(0).times != arc.at(i).times))
+          throw(Exception("instrument arc "+Epoch::getTypeName(arc.at(i).getType())+" is not synchronous with the other arcs"));
 
       // copy data to one matrix + extra time vector
-      std::vector<Time> times = (arc.at(0).times());
+      std::vector<Time> times = arc.at(0).times;
       std::vector<UInt> index(1, 0);
       for(UInt i=0; i<arc.size(); i++)
-        index.push_back( arc.at(i).at(0).data().rows() + index.back() );
+        index.push_back( arc.at(i).data.columns() + index.back() );
       Matrix data(arc.at(0).size(), index.back());
       for(UInt i=0; i<arc.size(); i++)
         copy(arc.at(i).matrix().column(1, index.at(i+1)-index.at(i)), data.column(index.at(i), index.at(i+1)-index.at(i))); // without time column
@@ -134,6 +135,9 @@ void InstrumentArcCalculate::run(Config &config, Parallel::CommunicatorPtr comm)
       auto varListArcWoData = varListGlobal;
       addDataVariables("epoch", times, varListArc, usedVariables);
       addDataVariables(data, varListArc, usedVariables);
+      // row wise varying variables are evaluated column wise
+      DataVariableColumns columns(data);
+      columns.add("epoch", times);
 
       // least squares adjustment
       if(lsaExpr.size())
@@ -142,24 +146,11 @@ void InstrumentArcCalculate::run(Config &config, Parallel::CommunicatorPtr comm)
         Matrix A(data.rows()*lsaExpr.size(), paramExpr.size());
         for(UInt k=0; k<lsaExpr.size(); k++)
         {
-          std::vector<ExpressionVariablePtr> designExpr(paramExpr.size());
-          for(UInt s=0; s<paramExpr.size(); s++)
-          {
-            designExpr.at(s) = lsaExpr.at(k)->derivative(paramExpr.at(s)->name(), varListArc);
-            designExpr.at(s)->simplify(varListArc);
-          }
-
-          for(UInt i=0; i<data.rows(); i++)
-          {
-            evaluateDataVariables(data, i, varListArc);
-            varListArc["epoch"]->setValue(times.at(i).mjd());
-            l(i+k*data.rows()) = -lsaExpr.at(k)->evaluate(varListArc); // observations
-            for(UInt s=0; s<designExpr.size(); s++)
-              A(i+k*data.rows(),s) = designExpr.at(s)->evaluate(varListArc); // columns of design matrix
-          }
-          undefineDataVariables(data, varListArc);
-          varListArc["epoch"]->setUndefined();
+          columns.evaluate(columns.compile(lsaExpr.at(k), varListArc), l.field()+k*data.rows()); // observations
+          for(UInt s=0; s<paramExpr.size(); s++) // columns of design matrix
+            columns.evaluate(columns.compile(lsaExpr.at(k)->derivative(paramExpr.at(s)->name(), varListArc), varListArc), A.field()+k*data.rows()+s*A.ld());
         }
+        l *= -1;
 
         Vector x = leastSquares(A, l);
         for(UInt s=0; s<paramExpr.size(); s++)
@@ -170,22 +161,33 @@ void InstrumentArcCalculate::run(Config &config, Parallel::CommunicatorPtr comm)
         }
       } // if(lsa)
 
+      // removal criteria
+      std::vector<Bool> remove(data.rows(), FALSE);
+      for(auto &expr : removeExpr)
+      {
+        const Vector criterion = columns.evaluate(columns.compile(expr, varListArc));
+        for(UInt i=0; i<data.rows(); i++)
+          remove.at(i) = remove.at(i) || (criterion(i) != 0);
+      }
+
       // create output arc
-      std::vector<Time> timesOut(data.rows());
       Matrix outData(data.rows(), 1 + (outExpr.size() ? outExpr.size() : data.columns())); // first column for time
+      if(outExpr.size())
+        for(UInt k=0; k<outExpr.size(); k++)
+          columns.evaluate(columns.compile(outExpr.at(k), varListArc), outData.field()+(1+k)*outData.ld());
+      else
+        copy(data, outData.column(1, data.columns()));
+
+      std::vector<Time> timesOut(data.rows());
       UInt row = 0;
       for(UInt i=0; i<outData.rows(); i++)
-      {
-        evaluateDataVariables(data, i, varListArc);
-        varListArc["epoch"]->setValue(times.at(i).mjd());
-        if(!std::any_of(removeExpr.begin(), removeExpr.end(), [&](auto expr) {return expr->evaluate(varListArc) != 0;}))
+        if(!remove.at(i))
         {
           timesOut.at(row) = times.at(i);
-          for(UInt k=0; k<outData.columns()-1; k++)
-            outData(row, 1+k) = outExpr.size() ? outExpr.at(k)->evaluate(varListArc) : data(i, k);
+          for(UInt k=1; k<outData.columns(); k++)
+            outData(row, k) = outData(i, k);
           row++;
         }
-      }
       timesOut.resize(row);
       if(row < outData.rows())
         outData = outData.row(0, row);
@@ -19,7 +19,7 @@ The arcs are merged to one arc even though there is a gap inbetween.
 To split the data into arcs use \program{InstrumentSynchronize}.
 Three options are available: \config{sort}, \config{removeDuplicates} and \config{checkForNaNs}.
 If \config{sort} is enabled, the program reads all files, no matter if they are sorted correctly in time, and
-then sorts the epochs. If \config{removeDuplicates} is enabled, the program checks the whole data set
+then sorts the epochs (the already sorted files are merged). If \config{removeDuplicates} is enabled, the program checks the whole data set
 for epochs that are contained twice. And if \config{checkForNaNs} is enabled the data set is checked for
 invalid epochs containing NaNs.
 )";
@@ -108,22 +108,21 @@ void InstrumentConcatenate::run(Config &config, Parallel::CommunicatorPtr /*comm
     if(checkNaN)
     {
       logStatus<<"search for NaNs"<<Log::endl;
-      UInt removed=0;
+      Arc arcValid;
       logTimerStart;
       for(UInt i=0; i<arc.size(); i++)
       {
         logTimerLoop(i,arc.size());
-        Vector data=arc.at(i).data();
-        for(UInt j=0; j<data.rows(); j++)
-          if(std::isnan(data.at(j)))
-          {
-            arc.remove(i);
-            removed++;
-            i--;
-            break;
-          }
+        const Vector data = arc.at(i).data();
+        Bool valid = TRUE;
+        for(UInt j=0; valid && (j<data.rows()); j++)
+          valid = !std::isnan(data.at(j));
+        if(valid)
+          arcValid.push_back(arc.at(i));
       }
       logTimerLoopEnd(arc.size());
+      const UInt removed = arc.size()-arcValid.size();
+      arc = std::move(arcValid);
       logInfo<<" "<<removed<<" epochs with NaN values removed!"<<Log::endl;
     }
 
@@ -36,6 +36,7 @@ To get a reliable estimate, \program{InstrumentDetrend} should be called first.
 /***********************************************/
 
 #include "programs/program.h"
+#include "base/fourier.h"
 #include "files/fileInstrument.h"
 #include "files/fileMatrix.h"
 
@@ -79,6 +80,15 @@ void InstrumentEstimateEmpiricalCovariance::run(Config &config, Parallel::Commun
       if(data.rows() < fileNameOut.size()) return;
       countEpochs += data.rows();
 
+      // many lags: lagged products with zero padded FFT
+      if(fileNameOut.size() > 64*std::log2(data.rows()))
+      {
+        const std::vector<Matrix> R = Fourier::laggedProducts(data.column(startData+1, dim), fileNameOut.size()-1);
+        for(UInt h=0; h<fileNameOut.size(); h++)
+          axpy(1., R.at(h), covarianceMatrix.at(h)); // x_{t-h}*x_{t}^T
+        return;
+      }
+
       rankKUpdate(1, data.column(startData+1, dim), covarianceMatrix.at(0)); // x_{t-h}*x_{t}^T
       for(UInt h=1; h<fileNameOut.size(); h++)
         matMult(1., data.slice(0, startData+1, data.rows()-h, dim).trans(), data.slice(h, startData+1, data.rows()-h, dim), covarianceMatrix.at(h)); // x_{t-h}*x_{t}^T
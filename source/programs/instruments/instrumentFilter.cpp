@@ -59,13 +59,13 @@ void InstrumentFilter::run(Config &config, Parallel::CommunicatorPtr comm)
     std::vector<Arc> arcList(instrumentFile.arcCount(), instrumentFile.getType());
     Parallel::forEach(arcList, [&](UInt arcNo)
     {
-      Arc arc = instrumentFile.readArc(arcNo);
+      ArcColumns arc = instrumentFile.readArcColumns(arcNo);
       if(arc.size() == 0)
-        return arc;
+        return Arc(arc.type);
       Matrix data = arc.matrix();
       countData = std::min(countData, data.columns()-1-startData);
       copy(filter->filter(data.column(1+startData, countData)), data.column(1+startData, countData));
-      return Arc(arc.times(), data, arc.getType());
+      return Arc(arc.times, data, arc.type);
     }, comm);
 
     if(Parallel::isMaster(comm))
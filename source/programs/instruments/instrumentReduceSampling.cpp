@@ -31,11 +31,11 @@ public:
   void run(Config &config, Parallel::CommunicatorPtr comm);
 };
 
-GROOPS_REGISTER_PROGRAM(InstrumentReduceSampling, SINGLEPROCESS, "reduce sampling of instrument data.", Instrument)
+GROOPS_REGISTER_PROGRAM(InstrumentReduceSampling, PARALLEL, "reduce sampling of instrument data.", Instrument)
 
 /***********************************************/
 
-void InstrumentReduceSampling::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
+void InstrumentReduceSampling::run(Config &config, Parallel::CommunicatorPtr comm)
 {
   try
   {
@@ -51,17 +51,17 @@ void InstrumentReduceSampling::run(Config &config, Parallel::CommunicatorPtr /*c
     if(isCreateSchema(config)) return;
 
     logStatus<<"read instrument data <"<<inName<<"> and reduce sampling"<<Log::endl;
-    InstrumentFile  inFile(inName);
-    UInt arcCount = inFile.arcCount();
-    std::list<Arc> arcList;
+    InstrumentFile inFile(inName);
 
     Double refTime=0;
-    Single::forEach(arcCount, [&](UInt arcNo)
+    if(relative2FirstEpoch && inFile.arcCount())
+      refTime = inFile.readArc(0).at(0).time.mjdMod();
+
+    std::vector<Arc> arcList(inFile.arcCount());
+    Parallel::forEach(arcList, [&](UInt arcNo)
     {
       std::vector<Time> times;
       Arc arc = inFile.readArc(arcNo);
-      if(arcNo==0 && relative2FirstEpoch)
-        refTime = arc.at(0).time.mjdMod();
       for(UInt i=0; i<arc.size(); i++)
       {
 
@@ -75,12 +75,15 @@ void InstrumentReduceSampling::run(Config &config, Parallel::CommunicatorPtr /*c
       }
 
       arc.synchronize(times, margin);
-      if(arc.size()!=0)
-        arcList.push_back(arc);
-    });
+      return arc;
+    }, comm);
 
-    logStatus<<"write instrument data to <"<<outName<<">"<<Log::endl;
-    InstrumentFile::write(outName, arcList);
+    if(Parallel::isMaster(comm))
+    {
+      arcList.erase(std::remove_if(arcList.begin(), arcList.end(), [](const Arc &arc) {return arc.size() == 0;}), arcList.end());
+      logStatus<<"write instrument data to <"<<outName<<">"<<Log::endl;
+      InstrumentFile::write(outName, arcList);
+    }
   }
   catch(std::exception &e)
   {
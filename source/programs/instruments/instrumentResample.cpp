@@ -60,11 +60,11 @@ public:
   void run(Config &config, Parallel::CommunicatorPtr comm);
 };
 
-GROOPS_REGISTER_PROGRAM(InstrumentResample, SINGLEPROCESS, "Resample data to given time series using polynomial prediction or least squares polynomial fit.", Instrument)
+GROOPS_REGISTER_PROGRAM(InstrumentResample, PARALLEL, "Resample data to given time series using polynomial prediction or least squares polynomial fit.", Instrument)
 
 /***********************************************/
 
-void InstrumentResample::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
+void InstrumentResample::run(Config &config, Parallel::CommunicatorPtr comm)
 {
   try
   {
@@ -105,22 +105,38 @@ void InstrumentResample::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
     logStatus<<"resample data"<<Log::endl;
     Polynomial polynomial;
     polynomial.init(arc.times(), polynomialDegree, FALSE/*throwException*/, isLeastSquares, maxDataPointRange, maxExtrapolationDistance);
-    const Matrix A = polynomial.interpolate(timesNew, arc.matrix().column(1, Epoch::dataCount(arc.getType(), TRUE)));
+    const Matrix data = arc.matrix().column(1, Epoch::dataCount(arc.getType(), TRUE));
 
-    Arc arcNew;
-    Epoch *epoch = Epoch::create(arc.getType());
-    for(UInt i=0; i<timesNew.size(); i++)
-      if(!std::isnan(A(i,0)))
-      {
-        epoch->time  = timesNew.at(i);
-        epoch->setData(A.row(i).trans());
-        arcNew.push_back(*epoch);
+    // resampling points are distributed in blocks over the processes
+    const UInt blockSize = 10000;
+    std::vector<Matrix> A((timesNew.size()+blockSize-1)/blockSize);
+    Parallel::forEach(A, [&](UInt idBlock)
+    {
+      const UInt start = idBlock*blockSize;
+      const UInt count = std::min(blockSize, timesNew.size()-start);
+      if(count == timesNew.size())
+        return polynomial.interpolate(timesNew, data);
+      return polynomial.interpolate(std::vector<Time>(timesNew.begin()+start, timesNew.begin()+start+count), data);
+    }, comm);
+
+    if(Parallel::isMaster(comm))
+    {
+      Arc arcNew;
+      Epoch *epoch = Epoch::create(arc.getType());
+      for(UInt idBlock=0; idBlock<A.size(); idBlock++)
+        for(UInt i=0; i<A.at(idBlock).rows(); i++)
+          if(!std::isnan(A.at(idBlock)(i,0)))
+          {
+            epoch->time  = timesNew.at(idBlock*blockSize+i);
+            epoch->setData(A.at(idBlock).row(i).trans());
+            arcNew.push_back(*epoch);
+          }
+      delete epoch;
+
+      logStatus<<"write instrument data to file <"<<outName<<">"<<Log::endl;
+      InstrumentFile::write(outName, arcNew);
+      Arc::printStatistics(arcNew);
     }
-    delete epoch;
-
-    logStatus<<"write instrument data to file <"<<outName<<">"<<Log::endl;
-    InstrumentFile::write(outName, arcNew);
-    Arc::printStatistics(arcNew);
   }
   catch(std::exception &e)
   {
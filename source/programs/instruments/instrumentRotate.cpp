@@ -64,25 +64,25 @@ void InstrumentRotate::run(Config &config, Parallel::CommunicatorPtr comm)
       StarCameraArc starCamera = starCameraFile.readArc(arcNo);
       Arc::checkSynchronized({arc, starCamera});
 
+      // vector types: all epochs at once
+      if((arc.getType() == Epoch::ORBIT) || (arc.getType() == Epoch::ACCELEROMETER) || (arc.getType() == Epoch::VECTOR3D))
+      {
+        std::vector<Rotary3d> rot(arc.size());
+        for(UInt i=0; i<arc.size(); i++)
+          rot.at(i) = starCamera.at(i).rotary;
+        Matrix A = arc.matrix();
+        for(UInt col=1; col+3<=A.columns(); col+=3) // position, velocity, acceleration
+          rotate(rot, A.column(col, 3), inverseRotate);
+        return Arc(arc.times(), A, arc.getType());
+      }
+
       for(UInt i=0; i<arc.size(); i++)
       {
         Rotary3d rot = starCamera.at(i).rotary;
         if(inverseRotate)
           rot = inverse(rot);
 
-        if(arc.getType() == Epoch::ORBIT)
-        {
-          auto &epoch = dynamic_cast<OrbitEpoch&>(arc.at(i));
-          epoch.position     = rot.rotate(epoch.position);
-          epoch.velocity     = rot.rotate(epoch.velocity);
-          epoch.acceleration = rot.rotate(epoch.acceleration);
-        }
-        else if(arc.getType() == Epoch::ACCELEROMETER)
-        {
-          auto &epoch = dynamic_cast<AccelerometerEpoch&>(arc.at(i));
-          epoch.acceleration = rot.rotate(epoch.acceleration);
-        }
-        else if(arc.getType() == Epoch::GRADIOMETER)
+        if(arc.getType() == Epoch::GRADIOMETER)
         {
           auto &epoch = dynamic_cast<GradiometerEpoch&>(arc.at(i));
           epoch.gravityGradient = rot.rotate(epoch.gravityGradient);
@@ -92,11 +92,6 @@ void InstrumentRotate::run(Config &config, Parallel::CommunicatorPtr comm)
           auto &epoch = dynamic_cast<Covariance3dEpoch&>(arc.at(i));
           epoch.covariance = rot.rotate(epoch.covariance);
         }
-        else if(arc.getType() == Epoch::VECTOR3D)
-        {
-          auto &epoch = dynamic_cast<Vector3dEpoch&>(arc.at(i));
-          epoch.vector3d = rot.rotate(epoch.vector3d);
-        }
         else
           throw(Exception("rotation for "+arc.getTypeName()+" not implemented"));
       }
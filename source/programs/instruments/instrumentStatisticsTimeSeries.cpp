@@ -140,9 +140,12 @@ void InstrumentStatisticsTimeSeries::run(Config &config, Parallel::CommunicatorP
       if(intervals.size() >= 2)
       {
         std::vector<Double> times = Vector(A.column(0));
+        const Bool isSorted = std::is_sorted(times.begin(), times.end());
         for(UInt i = 0; i < intervals.size(); i++)
         {
-          const auto it = std::find_if(times.begin(), times.end(), [intervals, i] (Double t) { return t >= intervals.at(i).mjd(); });
+          const Double mjd = intervals.at(i).mjd();
+          const auto it = isSorted ? std::lower_bound(times.begin(), times.end(), mjd) // binary search for long series
+                                   : std::find_if(times.begin(), times.end(), [mjd] (Double t) { return t >= mjd; });
           intervalEpochIds.push_back(std::distance(times.begin(), it));
         }
       }
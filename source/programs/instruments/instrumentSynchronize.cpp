@@ -115,8 +115,7 @@ UInt InstrumentSynchronize::searchInterval(UInt i)
   {
     if(times.at(i)<timesInterval.at(idx))
       return MAX_UINT;
-    while((idx+1 < timesInterval.size()) && (times.at(i) >= timesInterval.at(idx+1)))
-      idx++;
+    idx = std::distance(timesInterval.begin(), std::upper_bound(timesInterval.begin(), timesInterval.end(), times.at(i))) - 1;
     if(idx+1 >= timesInterval.size())
       return MAX_UINT;
   }
@@ -275,6 +274,7 @@ void InstrumentSynchronize::run(Config &config, Parallel::CommunicatorPtr /*comm
     std::vector<UInt> subArcStart, subArcLen;
     std::vector< std::vector<UInt> > irregularSubArcStart(data2.size()), irregularSubArcLen(data2.size());
 
+    std::vector<UInt> irregularIdx(data2.size(), 0); // arcs are in increasing time: continue search from previous arc
     UInt idx = 0;
     while((times.size()-idx) >= minArcLen)
     {
@@ -292,10 +292,10 @@ void InstrumentSynchronize::run(Config &config, Parallel::CommunicatorPtr /*comm
       Bool shortArc = FALSE;
       for(UInt k=0; k<data2.size(); k++)
       {
-        UInt idx2 = 0;
+        UInt idx2 = irregularIdx.at(k);
         while((idx2<arcIrregular.at(k).size()) && ((arcIrregular.at(k).at(idx2).time-times.at(idxStart)).seconds() < -margin))
           idx2++;
-        UInt idx2Start = idx2;
+        UInt idx2Start = irregularIdx.at(k) = idx2;
         while((idx2<arcIrregular.at(k).size()) && ((arcIrregular.at(k).at(idx2).time-times.at(idx-1)).seconds() < +margin))
           idx2++;
         irregularSubArcStart.at(k).push_back(idx2Start);
@@ -62,26 +62,8 @@ void InstrumentWaveletDecomposition::run(Config &config, Parallel::CommunicatorP
     Vector wl;
     readFileMatrix(fileNameInWavelet, wl);
 
-    // perform n-Level DWT
-    std::vector<UInt>   length, flag;
-    std::vector<Double> dwtCoeff;
-    std::vector<Double> signal = Vector(arc.matrix().column(1+selectData));
-    Wavelets::discreteWaveletTransform(signal, wl, level, dwtCoeff, flag, length);
-
-    // detail coefficients in each column
-    UInt idx = 0;
-    std::vector<std::vector<Double>> dwt(level+1, std::vector<Double>(dwtCoeff.size(), 0.));
-    for(UInt j=0; j<level+1;j++)
-      for(UInt i=0; i<length.at(j); i++)
-      {
-        dwt.at(j).at(idx) = dwtCoeff.at(idx);
-        idx++;
-      }
-
-    // apply inverse DWT, from wavelet domain to time domain
-    std::vector<std::vector<Double>> idwt(level+1);
-    for (UInt j=0; j<level+1; j++)
-      Wavelets::inverseDiscreteWaveletTransform(dwt.at(j), wl, flag, idwt.at(j), length);
+    // n-Level DWT, each level transformed back to time domain
+    const std::vector<Matrix> levels = Wavelets::multiresolutionAnalysis(arc.matrix().column(1+selectData), wl, level);
 
     MiscValuesArc arcOut;
     for(UInt i=0; i<arc.size(); i++)
@@ -89,7 +71,7 @@ void InstrumentWaveletDecomposition::run(Config &config, Parallel::CommunicatorP
       MiscValuesEpoch epoch(level+1);
       epoch.time = arc.at(i).time;
       for(UInt j=0; j<level+1; j++)
-        epoch.values(j) = idwt.at(j).at(i);
+        epoch.values(j) = levels.at(j)(i, 0);
       arcOut.push_back(epoch);
     }
 
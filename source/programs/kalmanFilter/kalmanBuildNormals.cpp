@@ -56,6 +56,7 @@ This program computes the input normals for \program{KalmanFilter} and \program{
 /***********************************************/
 
 #include "programs/program.h"
+#include "parallel/threadPool.h"
 #include "parser/dataVariables.h"
 #include "files/fileArcList.h"
 #include "files/fileNormalEquation.h"
@@ -285,10 +286,24 @@ void KalmanBuildNormals::computeArc(UInt arcNo)
     if(n.at(idxInterval).size() == 0)
       n.at(idxInterval) = Matrix(A.columns(), l.columns());
     matMult(1., A.trans(), l, n.at(idxInterval));
-    // normal matrix
+    // normal matrix (tiles of upper triangle in parallel threads)
     if(N.at(idxInterval).size() == 0)
       N.at(idxInterval) = Matrix(A.columns(), Matrix::SYMMETRIC);
-    rankKUpdate(1., A, N.at(idxInterval));
+    constexpr UInt tileSize = 512;
+    const UInt tileCount = (A.columns()+tileSize-1)/tileSize;
+    Parallel::threadLoop(0, tileCount*(tileCount+1)/2, [&](UInt idx)
+    {
+      UInt i = 0, k = idx; // idx -> tile (i,k) with k>=i
+      while(k >= tileCount-i)
+        k -= tileCount-i++;
+      k += i;
+      const UInt start1 = i*tileSize, cols1 = std::min(tileSize, A.columns()-start1);
+      const UInt start2 = k*tileSize, cols2 = std::min(tileSize, A.columns()-start2);
+      if(i == k)
+        rankKUpdate(1., A.column(start1, cols1), N.at(idxInterval).slice(start1, start1, cols1, cols1));
+      else
+        matMult(1., A.column(start1, cols1).trans(), A.column(start2, cols2), N.at(idxInterval).slice(start1, start2, cols1, cols2));
+    });
   }
   catch(std::exception &e)
   {
@@ -41,6 +41,17 @@ can also be specified using \configClass{loops}{loopType}.
 If no \configFile{inputfileInitialState}{matrix} is set, a zero vector with appropriate dimensions is used.
 The \configFile{inputfileInitialStateCovarianceMatrix}{matrix} however must be given.
 
+The state covariance matrices are distributed in blocks of \config{blockSize} over all processes.
+Instead of explicit inverses the updated state is solved with the Cholesky factor
+of the information matrix $\mathbf{N}_t + \mathbf{P}^{-^{-1}}_t$.
+
+With \config{squareRootInformationFilter} the upper triangular factor $\mathbf{R}_t$ of the information matrix
+$\mathbf{R}_t^T\mathbf{R}_t = \mathbf{P}^{+^{-1}}_t$ is propagated instead of the covariance matrix
+(square root information filter). The prediction uses the AR model as pseudo observation equations
+and the normal equations are added as square root $\mathbf{H}^T\mathbf{H} = \mathbf{N}_t$,
+both with QR decompositions. No inverse is computed except for the optional output of the covariance matrix.
+The results are the same, but the condition of the matrices is improved. This mode runs on a single process.
+
 See also \program{KalmanBuildNormals}, \program{KalmanSmoother}.
 )";
 
@@ -63,11 +74,11 @@ public:
   void run(Config &config, Parallel::CommunicatorPtr comm);
 };
 
-GROOPS_REGISTER_PROGRAM(KalmanFilter, SINGLEPROCESS, "Computes time variable gravity fields using Kalman filter approach", KalmanFilter, NormalEquation)
+GROOPS_REGISTER_PROGRAM(KalmanFilter, PARALLEL, "Computes time variable gravity fields using Kalman filter approach", KalmanFilter, NormalEquation)
 
 /***********************************************/
 
-void KalmanFilter::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
+void KalmanFilter::run(Config &config, Parallel::CommunicatorPtr comm)
 {
   try
   {
@@ -75,6 +86,8 @@ void KalmanFilter::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
     FileName fileNameInitialState, fileNameInitialCovariance;
     FileName fileNameArModel;
     std::vector<FileName> fileNameNormals;
+    Bool     squareRootInformationFilter;
+    UInt     blockSize;
 
     readConfig(config, "outputfileUpdatedState",                   fileNameState,                          Config::MUSTSET,   "kalman/updatedState/x_{loopTime:%D}.txt",                      "estimated state x+ (nx1-matrix)");
     readConfig(config, "outputfileUpdatedStateCovarianceMatrix",   fileNameStateCovarianceMatrix,          Config::OPTIONAL, "kalman/updatedStateCovariance/covariance_{loopTime:%D}.dat",   "estimated state' s covariance matrix Cov(x+)");
@@ -82,6 +95,8 @@ void KalmanFilter::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
     readConfig(config, "inputfileInitialState",                    fileNameInitialState,                   Config::OPTIONAL,  "", "initial state x0");
     readConfig(config, "inputfileInitialStateCovarianceMatrix",    fileNameInitialCovariance,              Config::MUSTSET,   "", "initial state's covariance matrix Cov(x0)");
     readConfig(config, "inputfileAutoregressiveModel",             fileNameArModel,                        Config::MUSTSET,   "", "file name of autoregressive model");
+    readConfig(config, "squareRootInformationFilter",              squareRootInformationFilter,            Config::DEFAULT,   "0",   "propagate the triangular factor of the information matrix with QR decompositions (single process)");
+    readConfig(config, "blockSize",                                blockSize,                              Config::DEFAULT,   "512", "block size for distributing the covariance matrices");
     if(isCreateSchema(config)) return;
 
     // check input
@@ -106,53 +121,135 @@ void KalmanFilter::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
 
     // load initial state:
     // -------------------
-    logStatus<<"initialize state's covariance matrix with <"<<fileNameInitialCovariance<<">"<<Log::endl;
-    Matrix updatedStateCovariance;
-    readFileMatrix(fileNameInitialCovariance, updatedStateCovariance);
-
-    Matrix updatedState(updatedStateCovariance.rows(),1);
+    Matrix updatedState(B.rows(), 1);
     if(!fileNameInitialState.empty())
     {
       logStatus <<"initialize initial state with <"<<fileNameInitialState<<">"<< Log::endl;
       readFileMatrix(fileNameInitialState, updatedState);
     }
 
+    logStatus<<"initialize state's covariance matrix with <"<<fileNameInitialCovariance<<">"<<Log::endl;
+    Matrix initialCovariance;
+    if(Parallel::isMaster(comm))
+      readFileMatrix(fileNameInitialCovariance, initialCovariance);
+
+    // Run the square root information filter:
+    // ---------------------------------------
+    if(squareRootInformationFilter)
+    {
+      if(!Parallel::isMaster(comm))
+        return;
+
+      // information matrix R'R = Cov(x0)^-1 with R x0 = z
+      Matrix R = initialCovariance;
+      inverse(R);
+      cholesky(R);
+      zeroUnusedTriangle(R);
+      Matrix z = updatedState;
+      triangularMult(1., R, z);
+
+      for(UInt k=0; k<fileNameNormals.size(); k++)
+      {
+        KalmanProcessing::squareRootPrediction(arModel.pseudoObservationEquation(), R, z);
+
+        try
+        {
+          NormalEquationInfo info;
+          Matrix N, n;
+          readFileNormalEquation(fileNameNormals.at(k), info, N, n);
+          KalmanProcessing::squareRootUpdate(N, n, R, z);
+        }
+        catch(std::exception &e)
+        {
+          logWarning<<e.what()<<Log::endl;
+        }
+
+        logStatus <<"write updated state to <"<<fileNameState.at(k)<<">"<<Log::endl;
+        updatedState = z;
+        triangularSolve(1., R, updatedState);
+        writeFileMatrix(fileNameState.at(k), updatedState);
+        if(!fileNameStateCovarianceMatrix.empty())
+        {
+          logStatus <<"write updated state covariance to <"<<fileNameStateCovarianceMatrix.at(k)<<">"<<Log::endl;
+          Matrix covariance = R;
+          cholesky2Inverse(covariance);
+          fillSymmetric(covariance);
+          writeFileMatrix(fileNameStateCovarianceMatrix.at(k), covariance);
+        }
+      }
+      return;
+    }
+
+    MatrixDistributed updatedStateCovariance(MatrixDistributed::computeBlockIndex(B.rows(), blockSize), comm);
+    KalmanProcessing::addMatrix(initialCovariance, updatedStateCovariance);
+    initialCovariance = Matrix();
+
     // Run the filter:
     // ---------------
     for(UInt k = 0; k<fileNameNormals.size(); k++)
     {
       Matrix predictedState = B*updatedState;
-      Matrix predictedStateCovariance = Q+B*updatedStateCovariance*B.trans();
+      MatrixDistributed predictedStateCovariance(updatedStateCovariance.blockIndex(), comm);
+      KalmanProcessing::addMatrix(Q, predictedStateCovariance);
+      KalmanProcessing::addPropagation(B, updatedStateCovariance, predictedStateCovariance);
 
-      try
+      NormalEquationInfo info;
+      Matrix N, n;
+      Bool   isRead = TRUE;
+      if(Parallel::isMaster(comm))
       {
-        NormalEquationInfo info;
-        Matrix N, n;
-        readFileNormalEquation(fileNameNormals.at(k), info, N, n);
+        try
+        {
+          readFileNormalEquation(fileNameNormals.at(k), info, N, n);
+        }
+        catch(std::exception &e)
+        {
+          logWarning<<e.what()<<Log::endl;
+          isRead = FALSE;
+        }
+      }
+      Parallel::broadCast(isRead, 0, comm);
 
-        inverse(predictedStateCovariance);
+      if(isRead)
+      {
+        // information matrix P+^-1 = P-^-1 + N
         updatedStateCovariance = predictedStateCovariance;
-        axpy(1.0, N, updatedStateCovariance.slice(0, 0, N.rows(), n.rows()));
-        inverse(updatedStateCovariance);
-        fillSymmetric(updatedStateCovariance);
+        updatedStateCovariance.cholesky(FALSE/*timing*/);
+        updatedStateCovariance.choleskyInverse(FALSE/*timing*/);
+        updatedStateCovariance.choleskyProduct(FALSE/*timing*/);
+        KalmanProcessing::addMatrix(N, updatedStateCovariance);
 
-        matMult(-1.0, N, predictedState.row(0, N.rows()), n);
-        updatedState = predictedState;
-        matMult(1.0, updatedStateCovariance.column(0, n.rows()), n, updatedState);
+        // x+ = x- + P+ (n - N x-), solved with the Cholesky factor of the information matrix
+        Matrix rhs;
+        if(Parallel::isMaster(comm))
+        {
+          matMult(-1.0, N, predictedState.row(0, N.rows()), n);
+          rhs = Matrix(predictedState.rows(), 1);
+          copy(n, rhs.row(0, n.rows()));
+        }
+        updatedState = updatedStateCovariance.solve(rhs, FALSE/*timing*/);
+        if(Parallel::isMaster(comm))
+          axpy(1.0, predictedState, updatedState);
+        Parallel::broadCast(updatedState, 0, comm);
+
+        updatedStateCovariance.choleskyInverse(FALSE/*timing*/);
+        updatedStateCovariance.choleskyProduct(FALSE/*timing*/);
       }
-      catch(std::exception &e)
+      else
       {
-        logWarning<<e.what()<<Log::endl;
         updatedState = predictedState;
         updatedStateCovariance = predictedStateCovariance;
       }
 
       logStatus <<"write updated state to <"<<fileNameState.at(k)<<">"<<Log::endl;
-      writeFileMatrix(fileNameState.at(k), updatedState);
+      if(Parallel::isMaster(comm))
+        writeFileMatrix(fileNameState.at(k), updatedState);
       if(!fileNameStateCovarianceMatrix.empty())
       {
         logStatus <<"write updated state covariance to <"<<fileNameStateCovarianceMatrix.at(k)<<">"<<Log::endl;
-        writeFileMatrix(fileNameStateCovarianceMatrix.at(k), updatedStateCovariance);
+        Matrix covariance = KalmanProcessing::collectMatrix(updatedStateCovariance);
+        if(Parallel::isMaster(comm))
+          writeFileMatrix(fileNameStateCovarianceMatrix.at(k), covariance);
       }
     }
   }
@@ -26,6 +26,7 @@ The result has zero phase and the squared magnitude response of \configFile{inpu
 are the output of a \program{KalmanFilter} forward sweep.
 The matrix files for\configFile{outputfileUpdatedState}{matrix}, \configFile{inputfileUpdatedState}{matrix}
 and \configFile{inputfileUpdatedStateCovariance}{matrix} can also be specified using \configClass{loops}{loopType}.
+The covariance matrices are distributed in blocks of \config{blockSize} over all processes.
 
 See also \program{KalmanBuildNormals}, \program{KalmanFilter} and \program{KalmanSmootherLeastSquares}.
 )";
@@ -48,22 +49,24 @@ public:
   void run(Config &config, Parallel::CommunicatorPtr comm);
 };
 
-GROOPS_REGISTER_PROGRAM(KalmanSmoother, SINGLEPROCESS, "Computes time variable gravity fields using Kalman smoother approach", KalmanFilter, NormalEquation)
+GROOPS_REGISTER_PROGRAM(KalmanSmoother, PARALLEL, "Computes time variable gravity fields using Kalman smoother approach", KalmanFilter, NormalEquation)
 
 /***********************************************/
 
-void KalmanSmoother::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
+void KalmanSmoother::run(Config &config, Parallel::CommunicatorPtr comm)
 {
   try
   {
     std::vector<FileName> fileNameSmoothedState,  fileNameSmoothedCovariance, fileNameUpdatedState, fileNameUpdatedCovariance;
     FileName fileNameArModel;
+    UInt     blockSize;
 
     readConfig(config, "outputfileState",                         fileNameSmoothedState,            Config::MUSTSET,   "kalman/smoothedState/x_{loopTime:%D}.txt",                    "estimated parameters (nx1-matrix)");
     readConfig(config, "outputfileStateCovarianceMatrix",         fileNameSmoothedCovariance,       Config::OPTIONAL,  "kalman/smoothedStateCovariance/covariance_{loopTime:%D}.dat", "estimated parameters' covariance matrix");
     readConfig(config, "inputfileUpdatedState",                   fileNameUpdatedState,             Config::MUSTSET,   "kalman/updatedState/x_{loopTime:%D}.txt", "");
     readConfig(config, "inputfileUpdatedStateCovarianceMatrix",   fileNameUpdatedCovariance,        Config::MUSTSET,   "kalman/updatedStateCovariance/covariance_{loopTime:%D}.dat", "");
     readConfig(config, "inputfileAutoregressiveModel",            fileNameArModel,                  Config::MUSTSET,   "", "file name of autoregressive model");
+    readConfig(config, "blockSize",                               blockSize,                        Config::DEFAULT,   "512", "block size for distributing the covariance matrices");
     if(isCreateSchema(config)) return;
 
     // check input
@@ -90,65 +93,70 @@ void KalmanSmoother::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
     arModel.orderOneRepresentation(B, Q);
 
     // Initialize backward smoother:
-    Matrix smoothedState, smoothedStateCovariance;
-    Matrix updatedState, updatedStateCovariance;
-    Matrix predictedState, predictedStateCovariance;
+    Matrix smoothedState, updatedState, updatedCovariance;
+    const std::vector<UInt> blockIndex = MatrixDistributed::computeBlockIndex(B.rows(), blockSize);
 
     logStatus <<"initialize state with <"<<fileNameUpdatedState.back()<<"> and <"<<fileNameUpdatedCovariance.back()<<">"<<Log::endl;
-    readFileMatrix(fileNameUpdatedState.back(), updatedState);
-    readFileMatrix(fileNameUpdatedCovariance.back(), updatedStateCovariance);
+    readFileMatrix(fileNameUpdatedState.back(), smoothedState);
+    if(Parallel::isMaster(comm))
+      readFileMatrix(fileNameUpdatedCovariance.back(), updatedCovariance);
+    MatrixDistributed smoothedStateCovariance(blockIndex, comm);
+    KalmanProcessing::addMatrix(updatedCovariance, smoothedStateCovariance);
 
-    smoothedState = updatedState;
-    smoothedStateCovariance = updatedStateCovariance;
     logStatus <<"write smoothed state to <"<<fileNameSmoothedState.back()<<">"<<Log::endl;
-    writeFileMatrix(fileNameSmoothedState.back(), smoothedState);
+    if(Parallel::isMaster(comm))
+      writeFileMatrix(fileNameSmoothedState.back(), smoothedState);
     if(fileNameSmoothedCovariance.size() > 0)
     {
       logStatus <<"write smoothed state to <"<<fileNameSmoothedCovariance.back()<<">"<<Log::endl;
-      writeFileMatrix(fileNameSmoothedCovariance.back(), smoothedStateCovariance);
+      if(Parallel::isMaster(comm))
+        writeFileMatrix(fileNameSmoothedCovariance.back(), updatedCovariance);
     }
 
     for(UInt k=epochCount-1; k>0; k--)
     {
       readFileMatrix(fileNameUpdatedState.at(k-1), updatedState);
-      readFileMatrix(fileNameUpdatedCovariance.at(k-1), updatedStateCovariance);
-
-      predictedState = B*updatedState;
-
-      // predicted state covariance
-      cholesky(updatedStateCovariance);
-      Matrix smootherGain = B;
-      triangularMult(1.0, updatedStateCovariance, smootherGain.trans());
-
-      predictedStateCovariance = Q;
-      rankKUpdate(1.0, smootherGain.trans(), predictedStateCovariance);
-
-      // transposed gain matrix K
-      triangularMult(1.0, updatedStateCovariance.trans(), smootherGain.trans());
-      solveInPlace(predictedStateCovariance, smootherGain);
+      if(Parallel::isMaster(comm))
+        readFileMatrix(fileNameUpdatedCovariance.at(k-1), updatedCovariance);
+      MatrixDistributed updatedStateCovariance(blockIndex, comm);
+      KalmanProcessing::addMatrix(updatedCovariance, updatedStateCovariance);
+
+      // predicted state and covariance
+      Matrix predictedState = B*updatedState;
+      MatrixDistributed predictedStateCovariance(blockIndex, comm);
+      KalmanProcessing::addMatrix(Q, predictedStateCovariance);
+      KalmanProcessing::addPropagation(B, updatedStateCovariance, predictedStateCovariance);
+
+      // difference of smoothed and predicted covariance (same distribution of blocks)
+      for(UInt i=0; i<blockIndex.size()-1; i++)
+        for(UInt s=i; s<blockIndex.size()-1; s++)
+          if(smoothedStateCovariance.isMyRank(i, s))
+            axpy(-1.0, predictedStateCovariance.N(i, s), smoothedStateCovariance.N(i, s));
+
+      // transposed gain matrix K' = P-^-1 B P+, solved with the Cholesky factor of the predicted covariance
+      Matrix smootherGain = updatedStateCovariance.multiply(B.trans());
+      if(Parallel::isMaster(comm))
+        smootherGain = smootherGain.trans();
+      smootherGain = predictedStateCovariance.solve(smootherGain, FALSE/*timing*/);
+      Parallel::broadCast(smootherGain, 0, comm);
 
       // smoothed state
       smoothedState = updatedState + smootherGain.trans()*(smoothedState-predictedState);
 
-      // smoothed state covariance
-      zeroUnusedTriangle(predictedStateCovariance);
-      predictedStateCovariance.setType(Matrix::GENERAL);
-      rankKUpdate(-1.0, predictedStateCovariance, smoothedStateCovariance);
-      fillSymmetric(smoothedStateCovariance);
-      smoothedStateCovariance.setType(Matrix::GENERAL);
-
-      smoothedStateCovariance = smootherGain.trans()*smoothedStateCovariance*smootherGain;
-      smoothedStateCovariance.setType(Matrix::SYMMETRIC);
-      zeroUnusedTriangle(updatedStateCovariance);
-      updatedStateCovariance.setType(Matrix::GENERAL);
-      rankKUpdate(1.0, updatedStateCovariance, smoothedStateCovariance);
+      // smoothed state covariance P+ + K (Ps - P-) K'
+      MatrixDistributed differenceCovariance = smoothedStateCovariance;
+      smoothedStateCovariance = updatedStateCovariance;
+      KalmanProcessing::addPropagation(smootherGain.trans(), differenceCovariance, smoothedStateCovariance);
 
       logStatus <<"write smoothed state to <"<<fileNameSmoothedState.at(k-1)<<">"<<Log::endl;
-      writeFileMatrix(fileNameSmoothedState.at(k-1), smoothedState);
+      if(Parallel::isMaster(comm))
+        writeFileMatrix(fileNameSmoothedState.at(k-1), smoothedState);
       if(!fileNameSmoothedCovariance.empty())
       {
         logStatus <<"write smoothed state covariance to <"<<fileNameSmoothedCovariance.at(k-1)<<">"<<Log::endl;
-        writeFileMatrix(fileNameSmoothedCovariance.at(k-1), smoothedStateCovariance);
+        Matrix covariance = KalmanProcessing::collectMatrix(smoothedStateCovariance);
+        if(Parallel::isMaster(comm))
+          writeFileMatrix(fileNameSmoothedCovariance.at(k-1), covariance);
       }
     }
   }
@@ -22,6 +22,10 @@ corresponding standard deviations (\configFile{outputfileSigmax}{matrix}) and th
 Similarly, the \configFile{inputfileNormalEquations}{normalEquation}
 can also be specified using \configClass{loops}{loopType}.
 
+The normal matrix is block banded (block tridiagonal for an AR(1) model), as each epoch is coupled
+only to its neighbors by the process model. Set up, Cholesky decomposition and the computation of the
+standard deviations and covariances (sparse inverse within the band) scale linearly with the number of epochs.
+
 See also \program{KalmanBuildNormals}, \program{KalmanFilter} and\program{KalmanSmoother}
 )";
 
@@ -0,0 +1,316 @@
+/***********************************************/
+/**
+* @file benchmarkKernels.cpp
+*
+* @brief Reproducible timing of core numerical kernels.
+*
+* @author GROOPS Developers
+* @date 2026-10-15
+*
+*/
+/***********************************************/
+
+// Latex documentation
+#define DOCSTRING docstring
+static const char *docstring = R"(
+Measures the run time of the core numerical kernels of GROOPS with synthetic data
+to quantify performance regressions between releases or to compare BLAS/LAPACK backends:
+\begin{itemize}
+\item \verb|rankKUpdate|, \verb|cholesky|: dense \verb|Matrix| of dimension \config{matrixSize},
+\item \verb|LegendreFunction::compute|: 1000 latitudes for each of the \config{degree},
+\item \verb|SphericalHarmonics::gravity|: 100 points for each of the \config{degree},
+\item \verb|Fourier::fft|: time series with \config{fftLength} samples,
+\item \verb|InstrumentFile::write/read|: \config{instrumentEpochs} epochs of a 3D vector
+      in ASCII (\verb|.txt|), XML (\verb|.xml|), binary (\verb|.dat|), and compressed (\verb|.dat.gz|) format,
+      the temporary files are written to \config{temporaryDirectory},
+\item \verb|Expression::evaluate|, \verb|ExpressionCompiled::evaluate|: \config{expression} at 100000 points,
+\item \verb|GnssLambda|: decorrelation and integer search of \config{ambiguityCount} ambiguities,
+\item \verb|MatrixDistributed::cholesky|: distributed matrix of dimension \config{distributedMatrixSize}
+      in blocks of \config{blockSize} over all processes.
+\end{itemize}
+All random numbers are generated with a fixed seed. Each kernel is run \config{repetitions} times.
+
+The \configFile{outputfileBenchmark}{stringTable} contains one row per kernel with the columns:
+kernel name, size parameter, number of processes, number of threads, repetitions,
+minimum and median run time in seconds.
+)";
+
+/***********************************************/
+
+#include "programs/program.h"
+#include "base/legendreFunction.h"
+#include "base/sphericalHarmonics.h"
+#include "base/fourier.h"
+#include "parser/expressionParser.h"
+#include "files/fileInstrument.h"
+#include "files/fileStringTable.h"
+#include "inputOutput/system.h"
+#include "parallel/matrixDistributed.h"
+#include "gnss/gnssLambda.h"
+#include <random>
+
+/***** CLASS ***********************************/
+
+/** @brief Reproducible timing of core numerical kernels.
+* @ingroup programsGroup */
+class BenchmarkKernels
+{
+  UInt                                  repetitions;
+  std::mt19937                          generator;
+  std::vector<std::vector<std::string>> table;
+
+  Matrix randomMatrix(UInt rows, UInt columns);
+  void   measure(const std::string &kernel, UInt parameter, Parallel::CommunicatorPtr comm,
+                 std::function<void()> prepare, std::function<void()> kernelFunc);
+
+public:
+  void run(Config &config, Parallel::CommunicatorPtr comm);
+};
+
+GROOPS_REGISTER_PROGRAM(BenchmarkKernels, PARALLEL, "Reproducible timing of core numerical kernels", Misc)
+
+/***********************************************/
+
+void BenchmarkKernels::run(Config &config, Parallel::CommunicatorPtr comm)
+{
+  try
+  {
+    FileName          fileNameOut, tempDirectory;
+    UInt              matrixSize, fftLength, instrumentEpochs, ambiguityCount, distributedMatrixSize, blockSize;
+    std::vector<UInt> degrees;
+    std::string       expressionText;
+
+    readConfig(config, "outputfileBenchmark",   fileNameOut,           Config::MUSTSET,  "",     "stringTable: kernel, size, processes, threads, repetitions, min [s], median [s]");
+    readConfig(config, "repetitions",           repetitions,           Config::DEFAULT,  "5",    "each kernel is measured several times");
+    readConfig(config, "matrixSize",            matrixSize,            Config::DEFAULT,  "2000", "dimension of dense matrices (rankKUpdate, cholesky)");
+    readConfig(config, "degree",                degrees,               Config::MUSTSET,  "100",  "max. degree of Legendre functions and spherical harmonics");
+    readConfig(config, "fftLength",             fftLength,             Config::DEFAULT,  "86400", "number of samples of the time series");
+    readConfig(config, "instrumentEpochs",      instrumentEpochs,      Config::DEFAULT,  "86400", "number of epochs of the instrument files");
+    readConfig(config, "temporaryDirectory",    tempDirectory,         Config::DEFAULT,  ".",    "instrument files are written to and read from this directory");
+    readConfig(config, "expression",            expressionText,        Config::DEFAULT,  "sin(x)*exp(-y/2)+x^2-sqrt(abs(y))", "with variables x and y");
+    readConfig(config, "ambiguityCount",        ambiguityCount,        Config::DEFAULT,  "500",  "dimension of the integer search");
+    readConfig(config, "distributedMatrixSize", distributedMatrixSize, Config::DEFAULT,  "4000", "dimension of the distributed matrix (cholesky)");
+    readConfig(config, "blockSize",             blockSize,             Config::DEFAULT,  "512",  "block size of the distributed matrix");
+    if(isCreateSchema(config)) return;
+
+    repetitions = std::max(repetitions, UInt(1));
+    generator.seed(42);
+    table.clear();
+
+    // the sequential kernels are computed at master only
+    if(Parallel::isMaster(comm))
+    {
+      Parallel::CommunicatorPtr commSelf = Parallel::selfCommunicator();
+
+      // dense matrix
+      // ------------
+      {
+        logStatus<<"dense matrix of dimension "<<matrixSize<<Log::endl;
+        const Matrix A = randomMatrix(2*matrixSize, matrixSize);
+        Matrix N(matrixSize, Matrix::SYMMETRIC);
+        measure("rankKUpdate", matrixSize, commSelf, [&]() {N.setNull();}, [&]() {rankKUpdate(1., A, N);});
+        for(UInt i=0; i<N.rows(); i++)
+          N(i,i) += 1.;
+        const Matrix N0 = N;
+        measure("cholesky", matrixSize, commSelf, [&]() {N = N0;}, [&]() {cholesky(N);});
+      }
+
+      // Legendre functions and spherical harmonics
+      // ------------------------------------------
+      for(UInt degree : degrees)
+      {
+        logStatus<<"Legendre functions and spherical harmonics of degree "<<degree<<Log::endl;
+        measure("LegendreFunction::compute", degree, commSelf, nullptr, [&]()
+        {
+          for(UInt i=0; i<1000; i++)
+            LegendreFunction::compute(std::cos(PI*(i+0.5)/1000), degree);
+        });
+
+        Matrix cnm = 1e-6*randomMatrix(degree+1, degree+1);
+        Matrix snm = 1e-6*randomMatrix(degree+1, degree+1);
+        cnm(0,0) = 1.;
+        for(UInt n=0; n<=degree; n++)
+          for(UInt m=n+1; m<=degree; m++)
+            cnm(n,m) = snm(n,m) = 0.;
+        snm.column(0).setNull();
+        const SphericalHarmonics harm(DEFAULT_GM, DEFAULT_R, cnm, snm);
+        measure("SphericalHarmonics::gravity", degree, commSelf, nullptr, [&]()
+        {
+          for(UInt i=0; i<100; i++)
+            harm.gravity(polar(Angle(2*PI*i/100), Angle(PI/2*std::sin(0.7*i)), DEFAULT_R+500e3));
+        });
+      }
+
+      // FFT
+      // ---
+      {
+        logStatus<<"FFT of "<<fftLength<<" samples"<<Log::endl;
+        const Vector data = randomMatrix(fftLength, 1);
+        measure("Fourier::fft", fftLength, commSelf, nullptr, [&]() {Fourier::fft(data);});
+      }
+
+      // instrument files
+      // ----------------
+      {
+        logStatus<<"instrument files with "<<instrumentEpochs<<" epochs"<<Log::endl;
+        const Matrix values = randomMatrix(instrumentEpochs, 3);
+        Vector3dArc arc;
+        for(UInt i=0; i<instrumentEpochs; i++)
+        {
+          Vector3dEpoch epoch;
+          epoch.time     = mjd2time(58000.) + seconds2time(static_cast<Double>(i));
+          epoch.vector3d = Vector3d(values(i,0), values(i,1), values(i,2));
+          arc.push_back(epoch);
+        }
+        for(const std::string &extension : {"txt", "xml", "dat", "dat.gz"})
+        {
+          const FileName fileName = tempDirectory.append(FileName("benchmarkKernels."+extension));
+          measure("InstrumentFile::write."+extension, instrumentEpochs, commSelf, nullptr, [&]() {InstrumentFile::write(fileName, arc);});
+          measure("InstrumentFile::read."+extension,  instrumentEpochs, commSelf, nullptr, [&]() {InstrumentFile::read(fileName);});
+          System::remove(fileName);
+        }
+      }
+
+      // expressions
+      // -----------
+      {
+        logStatus<<"expression <"<<expressionText<<">"<<Log::endl;
+        const UInt count = 100000;
+        const Matrix xy = randomMatrix(count, 2);
+        ExpressionPtr expr = Expression::parse(expressionText);
+        VariableList varList;
+        addVariable("x", 0., varList);
+        addVariable("y", 0., varList);
+        measure("Expression::evaluate", count, commSelf, nullptr, [&]()
+        {
+          for(UInt i=0; i<count; i++)
+          {
+            varList["x"]->setValue(xy(i,0));
+            varList["y"]->setValue(xy(i,1));
+            expr->evaluate(varList);
+          }
+        });
+
+        const ExpressionCompiled compiled(expr, varList, {"x", "y"});
+        const Vector x = xy.column(0);
+        const Vector y = xy.column(1);
+        Vector result(count);
+        measure("ExpressionCompiled::evaluate", count, commSelf, nullptr, [&]() {compiled.evaluate(count, {x.field(), y.field()}, result.field());});
+      }
+
+      // integer ambiguity search
+      // ------------------------
+      if(ambiguityCount)
+      {
+        logStatus<<"integer search of "<<ambiguityCount<<" ambiguities"<<Log::endl;
+        const Matrix A = 10*randomMatrix(3*ambiguityCount, ambiguityCount);
+        Matrix N(ambiguityCount, Matrix::SYMMETRIC);
+        rankKUpdate(1., A, N);
+        fillSymmetric(N);
+        GnssLambda::Transformation Z(ambiguityCount);
+        GnssLambda::choleskyReversePivot(N, Z, FALSE/*timing*/);
+        inverse(N); // Cholesky factor of covariance matrix
+        Vector xFloat = randomMatrix(ambiguityCount, 1);
+        for(UInt i=0; i<xFloat.rows(); i++)
+          xFloat(i) = std::round(100*xFloat(i)) + 0.1*xFloat(i);
+
+        Matrix W;
+        measure("GnssLambda", ambiguityCount, commSelf, [&]() {W = N;}, [&]()
+        {
+          GnssLambda::Transformation T(W.rows());
+          const Vector d = GnssLambda::choleskyTransform(W, T, FALSE/*timing*/);
+          Vector isNotFixed;
+          Double sigma;
+          Matrix solutionSteps;
+          GnssLambda::searchIntegerBlocked(T.transform(xFloat), W, d, 0.2/*sigmaMaxResolve*/, 200/*searchBlockSize*/, 200000000/*maxSearchSteps*/,
+                                           GnssLambda::IncompleteAction::SHRINKBLOCKSIZE, FALSE/*timing*/, isNotFixed, sigma, solutionSteps);
+        });
+      }
+    } // if(isMaster)
+
+    // distributed matrix
+    // ------------------
+    if(distributedMatrixSize)
+    {
+      logStatus<<"distributed matrix of dimension "<<distributedMatrixSize<<" on "<<Parallel::size(comm)<<" processes"<<Log::endl;
+      MatrixDistributed normals;
+      auto prepare = [&]()
+      {
+        std::mt19937 generatorBlocks(7);
+        std::uniform_real_distribution<Double> uniform(-0.5, 0.5);
+        normals.initEmpty(MatrixDistributed::computeBlockIndex(distributedMatrixSize, blockSize), comm);
+        for(UInt i=0; i<normals.blockCount(); i++)
+          for(UInt k=i; k<normals.blockCount(); k++)
+          {
+            normals.setBlock(i, k);
+            if(normals.isMyRank(i,k))
+            {
+              Matrix &N = normals.N(i,k);
+              for(UInt z=0; z<N.rows(); z++)
+                for(UInt s=0; s<N.columns(); s++)
+                  N(z,s) = uniform(generatorBlocks);
+              if(i == k) // diagonal dominant -> positive definite
+                for(UInt z=0; z<N.rows(); z++)
+                  N(z,z) = distributedMatrixSize;
+            }
+          }
+      };
+      measure("MatrixDistributed::cholesky", distributedMatrixSize, comm, prepare, [&]() {normals.cholesky(FALSE/*timing*/);});
+    }
+
+    if(Parallel::isMaster(comm))
+    {
+      logStatus<<"write benchmark to <"<<fileNameOut<<">"<<Log::endl;
+      writeFileStringTable(fileNameOut, table);
+      for(const auto &row : table)
+        logInfo<<"  "<<row.at(0)<<"("<<row.at(1)<<"): "<<row.at(5)<<" s"<<Log::endl;
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Matrix BenchmarkKernels::randomMatrix(UInt rows, UInt columns)
+{
+  std::normal_distribution<Double> normal;
+  Matrix A(rows, columns);
+  for(UInt s=0; s<columns; s++)
+    for(UInt z=0; z<rows; z++)
+      A(z,s) = normal(generator);
+  return A;
+}
+
+/***********************************************/
+
+void BenchmarkKernels::measure(const std::string &kernel, UInt parameter, Parallel::CommunicatorPtr comm,
+                               std::function<void()> prepare, std::function<void()> kernelFunc)
+{
+  try
+  {
+    std::vector<Double> seconds;
+    for(UInt i=0; i<repetitions; i++)
+    {
+      if(prepare)
+        prepare();
+      Parallel::barrier(comm);
+      const Double start = Profiler::seconds();
+      kernelFunc();
+      Parallel::barrier(comm);
+      seconds.push_back(Profiler::seconds()-start);
+    }
+    std::sort(seconds.begin(), seconds.end());
+    const Double median = (seconds.size() % 2) ? seconds.at(seconds.size()/2) : 0.5*(seconds.at(seconds.size()/2-1)+seconds.at(seconds.size()/2));
+    table.push_back({kernel, parameter%"%i"s, Parallel::size(comm)%"%i"s, Parallel::threadCount()%"%i"s, repetitions%"%i"s,
+                     seconds.front()%"%.6f"s, median%"%.6f"s});
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
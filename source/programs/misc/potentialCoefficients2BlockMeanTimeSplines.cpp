@@ -90,21 +90,25 @@ void PotentialCoefficients2BlockMeanTimeSplines::run(Config &config, Parallel::C
     std::vector<Matrix> cnmList(fileCount), snmList(fileCount);
     std::vector<Matrix> sigma2List(fileCount);
     std::vector<Bool>   isZero(fileCount, FALSE);
-    Single::forEach(fileCount, [&](UInt i)
+    std::vector<SphericalHarmonics> harms(fileCount);
+    for(UInt i=0; i<fileCount; i++)
     {
-      SphericalHarmonics harm;
       try
       {
-        readFileSphericalHarmonics(inputName.at(i), harm);
-        harm = filter->filter(harm);
+        readFileSphericalHarmonics(inputName.at(i), harms.at(i));
       }
       catch(std::exception &e)
       {
         logError<<e.what()<<": continue..."<<Log::endl;
-        harm = SphericalHarmonics();
+        harms.at(i)  = SphericalHarmonics();
         isZero.at(i) = TRUE;
       }
+    }
+    harms = filter->filter(harms); // all files at once
 
+    Single::forEach(fileCount, [&](UInt i)
+    {
+      SphericalHarmonics harm = isZero.at(i) ? SphericalHarmonics() : harms.at(i);
       harm      = harm.get(maxDegree, minDegree, GM, R);
       maxDegree = harm.maxDegree();
       GM        = harm.GM();
@@ -67,16 +67,32 @@ void ThermosphericState2GriddedData::run(Config &config, Parallel::CommunicatorP
     Ellipsoid             ellipsoid(a, f);
     std::vector<Vector3d> points = grid->points();
     std::vector<Double>   areas  = grid->areas();
-    std::vector<Vector>   values(points.size());
-    Parallel::forEach(values, [&](UInt i)
+    // blocks of points evaluated at once
+    const UInt blockSize = 1000;
+    std::vector<Vector> values(points.size());
+    std::vector<Matrix> blocks((points.size()+blockSize-1)/blockSize);
+    Parallel::forEach(blocks, [&](UInt idBlock)
     {
-      Double   density, temperature;
-      Vector3d wind;
-      thermosphere->state(time, points.at(i), density, temperature, wind);
-      if(useLocalFrame)
-        wind = localNorthEastUp(points.at(i), ellipsoid).inverseTransform(wind);
-      return Vector({density, temperature, wind.x(), wind.y(), wind.z()});
+      const std::vector<Vector3d> pointsBlock(points.begin()+idBlock*blockSize, points.begin()+std::min(points.size(), (idBlock+1)*blockSize));
+      std::vector<Double>   density, temperature;
+      std::vector<Vector3d> wind;
+      thermosphere->state(time, pointsBlock, density, temperature, wind);
+      Matrix A(pointsBlock.size(), 5);
+      for(UInt i=0; i<pointsBlock.size(); i++)
+      {
+        if(useLocalFrame)
+          wind.at(i) = localNorthEastUp(pointsBlock.at(i), ellipsoid).inverseTransform(wind.at(i));
+        A(i,0) = density.at(i);
+        A(i,1) = temperature.at(i);
+        A(i,2) = wind.at(i).x();
+        A(i,3) = wind.at(i).y();
+        A(i,4) = wind.at(i).z();
+      }
+      return A;
     }, comm);
+    for(UInt idBlock=0; idBlock<blocks.size(); idBlock++)
+      for(UInt i=0; i<blocks.at(idBlock).rows(); i++)
+        values.at(idBlock*blockSize+i) = blocks.at(idBlock).row(i).trans();
 
     if(Parallel::isMaster(comm))
     {
@@ -16,6 +16,10 @@ This program accumulates normal equations and writes the total combined system t
 \configFile{outputfileNormalequation}{normalEquation}.
 The \configFile{inputfileNormalEquation}{normalEquation}s must have all the same size and the same block structure.
 This program is the simplified and fast version of the more general program \program{NormalsBuild}.
+
+The matrix blocks are accumulated independently and only one block is kept in memory at a time.
+The blocks are distributed over the processes, the next input block is read ahead in a separate thread
+while the previous one is accumulated.
 )";
 
 /***********************************************/
@@ -23,6 +27,7 @@ This program is the simplified and fast version of the more general program \pro
 #include "programs/program.h"
 #include "files/fileMatrix.h"
 #include "files/fileNormalEquation.h"
+#include <future>
 
 /***** CLASS ***********************************/
 
@@ -34,11 +39,11 @@ public:
   void run(Config &config, Parallel::CommunicatorPtr comm);
 };
 
-GROOPS_REGISTER_PROGRAM(NormalsAccumulate, SINGLEPROCESS, "accumulate normal equations and write to file", NormalEquation)
+GROOPS_REGISTER_PROGRAM(NormalsAccumulate, PARALLEL, "accumulate normal equations and write to file", NormalEquation)
 
 /***********************************************/
 
-void NormalsAccumulate::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
+void NormalsAccumulate::run(Config &config, Parallel::CommunicatorPtr comm)
 {
   try
   {
@@ -103,42 +108,53 @@ void NormalsAccumulate::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
     // ==================================
 
     logStatus<<"read and write block normals"<<Log::endl;
-    logTimerStart;
-    UInt idx = 0;
+    std::vector<std::pair<UInt, UInt>> blocks;
     for(UInt z=0; z<infoOut.blockIndex.size()-1; z++)
       for(UInt s=z; s<infoOut.blockIndex.size()-1; s++)
-      {
-        logTimerLoop(idx++, infoOut.blockIndex.size()*(infoOut.blockIndex.size()-1)/2);
-
-        if(infoOut.usedBlocks(z,s) == 0)
-          continue;
-
-        std::string ext;
-        if(infoOut.blockIndex.size()-1 > 1)
-          ext = "."+z%"%02i-"s+s%"%02i"s;
+        if(infoOut.usedBlocks(z,s))
+          blocks.push_back({z, s});
 
+    Parallel::forEach(blocks.size(), [&](UInt idx)
+    {
+      const UInt z = blocks.at(idx).first;
+      const UInt s = blocks.at(idx).second;
+      std::string ext;
+      if(infoOut.blockIndex.size()-1 > 1)
+        ext = "."+z%"%02i-"s+s%"%02i"s;
+
+      std::vector<FileName> fileNames;
+      for(UInt i=0; i<fileNameIn.size(); i++)
+        if(usedBlocksIn.at(i)(z,s))
+          fileNames.push_back(fileNameIn.at(i).appendBaseName(ext));
+
+      // next matrix is read ahead in a separate thread
+      auto read = [&](UInt i)
+      {
         Matrix N;
-        for(UInt i=0; i<fileNameIn.size(); i++)
-          if(usedBlocksIn.at(i)(z,s))
-          {
-            logStatus<<"read matrix <"<<fileNameIn.at(i).appendBaseName(ext)<<">"<<Log::endl;
-            Matrix N2;
-            readFileMatrix(fileNameIn.at(i).appendBaseName(ext), N2);
-            if(N.size())
-              N += N2;
-            else
-              N = N2;
-          }
-
-        logStatus<<"write matrix <"<<fileNameOut.appendBaseName(ext)<<">"<<Log::endl;
-        writeFileMatrix(fileNameOut.appendBaseName(ext), N);
+        readFileMatrix(fileNames.at(i), N);
+        return N;
+      };
+      std::future<Matrix> next = std::async(std::launch::async, read, 0);
+      Matrix N;
+      for(UInt i=0; i<fileNames.size(); i++)
+      {
+        Matrix N2 = next.get();
+        if(i+1 < fileNames.size())
+          next = std::async(std::launch::async, read, i+1);
+        if(N.size())
+          N += N2;
+        else
+          N = N2;
       }
-    logTimerLoopEnd(infoOut.blockIndex.size()*(infoOut.blockIndex.size()-1)/2);
+
+      writeFileMatrix(fileNameOut.appendBaseName(ext), N);
+    }, comm);
 
     // ==================================
 
     logStatus<<"write normal equations to <"<<fileNameOut<<">"<<Log::endl;
-    writeFileNormalEquation(fileNameOut, infoOut, nOut);
+    if(Parallel::isMaster(comm))
+      writeFileNormalEquation(fileNameOut, infoOut, nOut);
   }
   catch(std::exception &e)
   {
@@ -17,6 +17,17 @@ writes the total combined system to \configFile{outputfileNormalequation}{normal
 For a detailed description of the used algorithm see \configClass{normalEquation}{normalEquationType}.
 Large normal equation systems can be divided into blocks with \config{normalsBlockSize}.
 
+With \config{checkpointInterval} each process stores the partially accumulated normals of
+\configClass{design}{normalEquationType:design} together with the processed arcs
+every given number of seconds in files beside \configFile{outputfileNormalEquation}{normalEquation}.
+If an interrupted run is started again with the same number of processes, the accumulation
+continues from these files and only the missing arcs are computed.
+The files are removed after the normals are accumulated.
+
+Matrix, potential coefficients and doodson harmonic files read with the configuration
+(e.g. ocean tides, background gravity fields) are stored only once per shared memory node
+and are used by all processes of the node.
+
 A simplifed and fast version of this program is \program{NormalsAccumulate}.
 To solve the system of normal equations use \program{NormalsSolverVCE}.
 )";
@@ -24,6 +35,7 @@ To solve the system of normal equations use \program{NormalsSolverVCE}.
 /***********************************************/
 
 #include "programs/program.h"
+#include "inputOutput/fileCache.h"
 #include "files/fileMatrix.h"
 #include "classes/normalEquation/normalEquation.h"
 
@@ -48,19 +60,28 @@ void NormalsBuild::run(Config &config, Parallel::CommunicatorPtr comm)
     FileName          fileNameNormals;
     NormalEquationPtr normals;
     UInt              blockSize;
+    Bool              autotuneBlockSize;
+    Double            checkpointInterval;
 
     renameDeprecatedConfig(config, "outputfileNormalequation", "outputfileNormalEquation", date2time(2020, 6, 3));
     renameDeprecatedConfig(config, "normalequation",           "normalEquation",           date2time(2020, 6, 3));
 
-    readConfig(config, "outputfileNormalEquation", fileNameNormals, Config::MUSTSET,  "", "");
-    readConfig(config, "normalEquation",           normals,         Config::MUSTSET,  "", "");
-    readConfig(config, "normalsBlockSize",         blockSize,       Config::DEFAULT,  "2048", "block size for distributing the normal equations, 0: one block");
+    readConfig(config, "outputfileNormalEquation", fileNameNormals,    Config::MUSTSET,  "",     "");
+    {
+      FileCache::NodeShared nodeShared(comm); // model files are stored once per node
+      readConfig(config, "normalEquation",         normals,            Config::MUSTSET,  "",     "");
+    }
+    readConfig(config, "normalsBlockSize",         blockSize,          Config::DEFAULT,  "2048", "block size for distributing the normal equations, 0: one block");
+    readConfig(config, "autotuneBlockSize",        autotuneBlockSize,  Config::DEFAULT,  "0",    "benchmark block sizes on this machine and process layout (instead of normalsBlockSize)");
+    readConfig(config, "checkpointInterval",       checkpointInterval, Config::DEFAULT,  "0",    "[seconds] store partially accumulated normals for a restart, 0: disabled");
     if(isCreateSchema(config)) return;
 
     logStatus<<"init normal equations"<<Log::endl;
-    normals->init(blockSize, comm);
+    normals->init(autotuneBlockSize ? NULLINDEX : blockSize, comm);
     logInfo<<"  number of unknown parameters: "<<normals->parameterCount()<<Log::endl;
     logInfo<<"  number of right hand sides:   "<<normals->rightHandSideCount()<<Log::endl;
+    if(checkpointInterval > 0)
+      normals->setCheckpoint(fileNameNormals.appendBaseName(".checkpoint"), checkpointInterval);
 
     logStatus<<"accumulate normal equations"<<Log::endl;
     normals->build();
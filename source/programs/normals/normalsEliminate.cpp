@@ -131,11 +131,23 @@ void NormalsEliminate::run(Config &config, Parallel::CommunicatorPtr comm)
     logStatus<<"reorder normal matrix"<<Log::endl;
     normal.reorder(indexVector, blockIndex);
     rhs = reorder(rhs, indexVector);
+    // e.g. epoch wise parameters are not correlated with each other,
+    // the Cholesky decomposition is much faster without fill-in of zero blocks
+    normal.eraseZeroBlocks();
 
     if(eliminationCount > 0)
     {
-      logStatus<<"eliminate parameters from normal equations"<<Log::endl;
       const UInt eliminationBlocks = eliminationBlockIndex.size();
+
+      // fill reducing order of the to-be-eliminated blocks
+      const std::vector<UInt> blockOrder = normal.minimumDegreeOrder(0, eliminationBlocks);
+      if(!std::is_sorted(blockOrder.begin(), blockOrder.end()))
+      {
+        logStatus<<"reorder blocks to reduce fill-in"<<Log::endl;
+        rhs = reorder(rhs, normal.reorderBlocks(blockOrder));
+      }
+
+      logStatus<<"eliminate parameters from normal equations"<<Log::endl;
       normal.cholesky(TRUE, 0, eliminationBlocks, TRUE);
       normal.triangularTransSolve(rhs, 0, eliminationBlocks);
       normal.eraseBlocks(0, eliminationBlocks);
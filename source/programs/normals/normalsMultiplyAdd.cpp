@@ -31,12 +31,14 @@ and the quadratic sum of observations by
 
 As the normal matrix itself is not modified, rewriting of the matrix can be disabled by setting
 \config{writeNormalMatrix} to false.
+
+The normal matrix is processed block by block with the blocks distributed over the processes.
+Only one block per process is kept in memory.
 )";
 
 /***********************************************/
 
 #include "programs/program.h"
-#include "parallel/matrixDistributed.h"
 #include "files/fileMatrix.h"
 #include "files/fileNormalEquation.h"
 
@@ -75,11 +77,11 @@ void NormalsMultiplyAdd::run(Config &config, Parallel::CommunicatorPtr comm)
     // ==================================
 
     logStatus<<"init normal equations"<<Log::endl;
-    MatrixDistributed normal;
-    Matrix n;
-    NormalEquationInfo info;
-    readFileNormalEquation(normalsName, info, normal, n, comm);
-    logInfo<<"  number of parameters:       "<<normal.parameterCount()<<Log::endl;
+    InFileNormalEquation file;
+    file.open(normalsName, comm);
+    NormalEquationInfo info = file.info();
+    Matrix n = file.rightHandSide();
+    logInfo<<"  number of parameters:       "<<file.parameterCount()<<Log::endl;
     logInfo<<"  number of right hand sides: "<<info.lPl.rows()<<Log::endl;
 
     Matrix x;
@@ -96,43 +98,51 @@ void NormalsMultiplyAdd::run(Config &config, Parallel::CommunicatorPtr comm)
 
     // ==================================
 
-    logStatus<<"multiply normal matrix"<<Log::endl;
+    // multiply normal matrix block by block
+    // -------------------------------------
+    // the used blocks are striped over the processes,
+    // each block is read, multiplied and (if needed) written without holding the matrix in memory
+    const Bool writeBlocks = writeMatrix && (normalsName != outName);
+    logStatus<<"multiply normal matrix"<<(writeBlocks ? " and write blocks to <"+outName.str()+">" : ""s)<<Log::endl;
     Parallel::broadCast(x, 0, comm);
     x *= factor;
     Matrix Nx(x.rows(), x.columns());
-    for(UInt i=0; i<normal.blockCount(); i++)
-    {
-      if(normal.isMyRank(i,i))
-        matMult(1., normal.N(i,i), x.row(normal.blockIndex(i), normal.blockSize(i)), Nx.row(normal.blockIndex(i), normal.blockSize(i)));
-      for(UInt k=i+1; k<normal.blockCount(); k++)
-        if(normal.isMyRank(i,k))
+    info.usedBlocks = Matrix(file.blockCount(), Matrix::SYMMETRIC);
+    UInt idxBlock = 0;
+    for(UInt i=0; i<file.blockCount(); i++)
+      for(UInt k=i; k<file.blockCount(); k++)
+        if(file.isBlockUsed(i, k) && ((idxBlock++ % Parallel::size(comm)) == Parallel::myRank(comm)))
         {
-          matMult(1., normal.N(i,k),         x.row(normal.blockIndex(k), normal.blockSize(k)), Nx.row(normal.blockIndex(i), normal.blockSize(i)));
-          matMult(1., normal.N(i,k).trans(), x.row(normal.blockIndex(i), normal.blockSize(i)), Nx.row(normal.blockIndex(k), normal.blockSize(k)));
+          Matrix N;
+          file.readBlock(i, k, N);
+          matMult(1., N, x.row(file.blockIndex(k), file.blockSize(k)), Nx.row(file.blockIndex(i), file.blockSize(i)));
+          if(i != k)
+            matMult(1., N.trans(), x.row(file.blockIndex(i), file.blockSize(i)), Nx.row(file.blockIndex(k), file.blockSize(k)));
+          if(writeBlocks && !isStrictlyZero(N))
+          {
+            writeFileMatrix(fileNameNormalEquationBlock(outName, file.blockCount(), i, k), N);
+            info.usedBlocks(i,k) = 1;
+          }
         }
-    }
     Parallel::reduceSum(Nx, 0, comm);
+    if(writeBlocks)
+      Parallel::reduceSum(info.usedBlocks, 0, comm);
+    else
+      info.usedBlocks = file.info().usedBlocks;
 
+    // ==================================
+
+    // write normal equations
+    // ----------------------
     if(Parallel::isMaster(comm))
     {
       for(UInt i=0; i<info.lPl.rows(); i++)
         info.lPl(i) += 2.*inner(x.column(i), n.column(i)) + inner(x.column(i), Nx.column(i));
       n += Nx;
-    }
-
-    // ==================================
 
-    // write normal equations
-    // ----------------------
-    logStatus<<"write normal equations to <"<<outName<<">"<<Log::endl;
-    if((normalsName==outName) || !writeMatrix)
-    {
-      logStatus<<"(only the information file and the right hand sides)"<<Log::endl;
-      if(Parallel::isMaster(comm))
-        writeFileNormalEquation(outName, info, n);
+      logStatus<<"write right hand sides and info to <"<<outName<<">"<<Log::endl;
+      writeFileNormalEquation(outName, info, n);
     }
-    else
-      writeFileNormalEquation(outName, info, normal, n);
   }
   catch(std::exception &e)
   {
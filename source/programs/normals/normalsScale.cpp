@@ -24,12 +24,14 @@ The estimated solution is now
 This is effectively the same as rescaling columns of the design matrix.
 This program is useful when combining normal equations from different sources,
 for example in case the units of certain parameters don't match.
+
+The normal matrix is processed block by block (read, scale, write) with the blocks distributed
+over the processes. Only one block per process is kept in memory.
 )";
 
 /***********************************************/
 
 #include "programs/program.h"
-#include "parallel/matrixDistributed.h"
 #include "files/fileMatrix.h"
 #include "files/fileNormalEquation.h"
 
@@ -63,45 +65,55 @@ void NormalsScale::run(Config &config, Parallel::CommunicatorPtr comm)
 
     // ==================================
 
-    logStatus<<"read normal equations <"<<outName<<">"<<Log::endl;
-    MatrixDistributed normal;
-    Matrix n;
-    NormalEquationInfo info;
-    readFileNormalEquation(normalsName, info, normal, n, comm);
-    logInfo<<"  number of parameters:       "<<normal.parameterCount()<<Log::endl;
+    logStatus<<"read normal equations <"<<normalsName<<">"<<Log::endl;
+    InFileNormalEquation file;
+    file.open(normalsName, comm);
+    NormalEquationInfo info = file.info();
+    Matrix n = file.rightHandSide();
+    logInfo<<"  number of parameters:       "<<file.parameterCount()<<Log::endl;
     logInfo<<"  number of right hand sides: "<<info.lPl.rows()<<Log::endl;
 
     logStatus<<"read factor vector <"<<factorName<<">"<<Log::endl;
     Vector factor;
     readFileMatrix(factorName, factor);
-
-    if(Parallel::isMaster(comm) && (factor.rows() != n.rows()))
+    if(factor.rows() != n.rows())
       throw(Exception("Dimension error factor("+factor.rows()%"%i) != n("s+n.rows()%"%i)"s));
 
     // ==================================
 
-    logStatus<<"scale normal matrix"<<Log::endl;
-    for(UInt i=0; i<normal.blockCount(); i++)
-      for(UInt k=i; k<normal.blockCount(); k++)
-        if(normal.isMyRank(i,k))
+    // scale normal matrix block by block
+    // ----------------------------------
+    // the used blocks are striped over the processes,
+    // each block is read, scaled and written without holding the matrix in memory
+    logStatus<<"scale and write normal matrix to <"<<outName<<">"<<Log::endl;
+    info.usedBlocks = Matrix(file.blockCount(), Matrix::SYMMETRIC);
+    UInt idxBlock = 0;
+    for(UInt i=0; i<file.blockCount(); i++)
+      for(UInt k=i; k<file.blockCount(); k++)
+        if(file.isBlockUsed(i, k) && ((idxBlock++ % Parallel::size(comm)) == Parallel::myRank(comm)))
         {
-          Matrix &N = normal.N(i,k);
+          Matrix N;
+          file.readBlock(i, k, N);
           for(UInt z=0; z<N.rows(); z++)
-            N.row(z) *= factor(z+normal.blockIndex(i));
+            N.row(z) *= factor(z+file.blockIndex(i));
           for(UInt s=0; s<N.columns(); s++)
-            N.column(s) *= factor(s+normal.blockIndex(k));
+            N.column(s) *= factor(s+file.blockIndex(k));
+          if(isStrictlyZero(N))
+            continue;
+          writeFileMatrix(fileNameNormalEquationBlock(outName, file.blockCount(), i, k), N);
+          info.usedBlocks(i,k) = 1;
         }
+    Parallel::reduceSum(info.usedBlocks, 0, comm);
 
+    // right hand sides
+    // ----------------
     if(Parallel::isMaster(comm))
+    {
       for(UInt z=0; z<n.rows(); z++)
-        n.row(z) *= factor(z)*factor(z);
-
-    // ==================================
-
-    // write normal equations
-    // ----------------------
-    logStatus<<"write normal equations to <"<<outName<<">"<<Log::endl;
-    writeFileNormalEquation(outName, info, normal, n);
+        n.row(z) *= factor(z);
+      logStatus<<"write right hand sides and info to <"<<outName<<">"<<Log::endl;
+      writeFileNormalEquation(outName, info, n);
+    }
   }
   catch(std::exception &e)
   {
@@ -26,11 +26,43 @@ estimated accuracies (\configFile{outputfileSigmax}{matrix}) and the full covari
 (\configFile{outputfileCovariance}{matrix}) can be saved. Also the combined normal system
 can be written to \configFile{outputfileNormalEquation}{normalEquation}.
 
+The covariance matrix of a few parameters (e.g. the coordinates of a station) can be written to
+\configFile{outputfileCovarianceSelected}{matrix}. The parameters are selected with
+\configClass{parameterSelection}{parameterSelectorType}. It is computed from the Cholesky factor
+with an effort proportional to the number of selected parameters without inverting the full matrix.
+If the Cholesky factor contains empty blocks (e.g. combined normals with disjoint local parameters),
+the standard deviations are computed by selected inversion at the structure of the factor.
+
 The \configFile{outputfileContribution}{matrix} is a matrix with rows for each estimated
 parameter and columns for each \configClass{normalEquation}{normalEquationType}
 and indicates the contribution of the individual normals to the estimated parameters.
 Each row sum up to one.
 
+The traces needed for the variance component estimation are estimated stochastically
+(Hutchinson estimator) with \config{monteCarloVectorCount} random vectors $\M z$, which are solved
+together with the triangular Cholesky factor $\M W$: $trace(\M N_k\M N^{-1}) \approx \M z^T\M W^{-1}\M N_k\M W^{-T}\M z$.
+The error of the estimated traces decreases with the square root of the number of vectors.
+
+With \config{mixedPrecision} the Cholesky decomposition is computed in single precision
+and the solution is refined iteratively with residuals in double precision. This is faster
+for large well-conditioned systems. The accuracies and the covariance matrix are computed
+from the single precision decomposition in this case. If the refinement does not converge
+the system is solved in double precision instead.
+
+With \config{conjugateGradient} the normal equations are solved iteratively with preconditioned
+conjugate gradients. Only products with the normal matrix are computed, which is much faster than
+the Cholesky decomposition for large systems. The Cholesky decompositions of the diagonal blocks
+(see \config{normalsBlockSize}) are used as preconditioner, so parameters which are strongly
+correlated (e.g. the coefficients of one order) should be located within the same block.
+The traces needed for the variance component estimation are estimated stochastically from
+the conjugate gradient solutions of the Monte-Carlo vectors. The accuracies and the covariance matrix
+still require the Cholesky decomposition, which is computed at the end if needed.
+
+A series of normal equations of the same structure (e.g. monthly gravity field solutions)
+is solved efficiently in \program{LoopPrograms} with \config{processCountPerIteration}
+(several systems in parallel on groups of processes) and \config{prefetchInputs}
+(the normal equations of the next iteration are read while the current one is solved).
+
 See also \program{NormalsBuild}.
 )";
 
@@ -38,6 +70,7 @@ See also \program{NormalsBuild}.
 
 #include "programs/program.h"
 #include "files/fileMatrix.h"
+#include "classes/parameterSelector/parameterSelector.h"
 #include "classes/normalEquation/normalEquation.h"
 
 /***** CLASS ***********************************/
@@ -62,11 +95,19 @@ void NormalsSolverVCE::run(Config &config, Parallel::CommunicatorPtr comm)
   {
     FileName          fileNameSolution, fileNameSigmax;
     FileName          fileNameCovariance, fileNameNormals, fileNameContribution, fileNameVarianceFactors;
+    FileName          fileNameCovarianceSelected;
+    ParameterSelectorPtr parameterSelector;
     NormalEquationPtr normals;
     FileName          fileNameX0;
     UInt              rhsNo;
     UInt              maxIter;
+    UInt              monteCarloCount;
     UInt              blockSize;
+    Bool              autotuneBlockSize;
+    Bool              mixedPrecision;
+    Bool              conjugateGradient = FALSE;
+    UInt              maxIterCG;
+    Double            thresholdCG;
 
     renameDeprecatedConfig(config, "outputfileNormalequation", "outputfileNormalEquation", date2time(2020, 6, 3));
     renameDeprecatedConfig(config, "normalequation",           "normalEquation",           date2time(2020, 6, 3));
@@ -74,6 +115,8 @@ void NormalsSolverVCE::run(Config &config, Parallel::CommunicatorPtr comm)
     readConfig(config, "outputfileSolution",        fileNameSolution,        Config::OPTIONAL, "",     "parameter vector");
     readConfig(config, "outputfileSigmax",          fileNameSigmax,          Config::OPTIONAL, "",     "standard deviations of the parameters (sqrt of the diagonal of the inverse normal equation)");
     readConfig(config, "outputfileCovariance",      fileNameCovariance,      Config::OPTIONAL, "",     "full covariance matrix");
+    readConfig(config, "outputfileCovarianceSelected", fileNameCovarianceSelected, Config::OPTIONAL, "", "covariance matrix of the selected parameters");
+    readConfig(config, "parameterSelection",        parameterSelector,       Config::OPTIONAL, "",     "parameters of outputfileCovarianceSelected");
     readConfig(config, "outputfileContribution",    fileNameContribution,    Config::OPTIONAL, "",     "contribution of normal system components to the solution vector");
     readConfig(config, "outputfileVarianceFactors", fileNameVarianceFactors, Config::OPTIONAL, "",     "estimated variance factors as vector");
     readConfig(config, "outputfileNormalEquation",  fileNameNormals,         Config::OPTIONAL, "",     "the combined normal equation system");
@@ -81,11 +124,21 @@ void NormalsSolverVCE::run(Config &config, Parallel::CommunicatorPtr comm)
     readConfig(config, "inputfileApproxSolution",   fileNameX0,              Config::OPTIONAL, "",     "to accelerate convergence");
     readConfig(config, "rightHandSideNumberVCE",    rhsNo,                   Config::DEFAULT,  "0",    "the right hand side number for estimation of variance factors");
     readConfig(config, "normalsBlockSize",          blockSize,               Config::DEFAULT,  "2048", "block size for distributing the normal equations, 0: one block");
+    readConfig(config, "autotuneBlockSize",         autotuneBlockSize,       Config::DEFAULT,  "0",    "benchmark block sizes on this machine and process layout (instead of normalsBlockSize)");
     readConfig(config, "maxIterationCount",         maxIter,                 Config::DEFAULT,  "20",   "maximum number of iterations for variance component estimation");
+    readConfig(config, "monteCarloVectorCount",     monteCarloCount,         Config::DEFAULT,  "100",  "number of random vectors for the stochastic trace estimation in the variance component estimation");
+    readConfig(config, "mixedPrecision",            mixedPrecision,          Config::DEFAULT,  "0",    "single precision Cholesky decomposition with iterative refinement in double precision");
+    if(readConfigSequence(config, "conjugateGradient", Config::OPTIONAL, "", "solve iteratively without decomposition of the normal matrix"))
+    {
+      conjugateGradient = TRUE;
+      readConfig(config, "maxIterationCount", maxIterCG,   Config::DEFAULT, "1000",  "maximum number of conjugate gradient iterations");
+      readConfig(config, "threshold",         thresholdCG, Config::DEFAULT, "1e-10", "iteration stops if the norm of the residuals is reduced by this factor");
+      endSequence(config);
+    }
     if(isCreateSchema(config)) return;
 
     logStatus<<"init normal equations"<<Log::endl;
-    normals->init(blockSize, comm);
+    normals->init(autotuneBlockSize ? NULLINDEX : blockSize, comm, monteCarloCount);
     logInfo<<"  number of unknown parameters: "<<normals->parameterCount()<<Log::endl;
     logInfo<<"  number of right hand sides:   "<<normals->rightHandSideCount()<<Log::endl;
 
@@ -142,7 +195,7 @@ void NormalsSolverVCE::run(Config &config, Parallel::CommunicatorPtr comm)
       }
 
       logStatus<<"solve normal equations"<<Log::endl;
-      Matrix x = normals->solve();
+      Matrix x = (conjugateGradient) ? normals->solveConjugateGradient(maxIterCG, thresholdCG) : normals->solve(mixedPrecision);
       logInfo<<"  sigma (total) = "<<normals->aposterioriSigma()<<Log::endl;
 
       if(Parallel::isMaster(comm) && !fileNameSolution.empty())
@@ -152,13 +205,14 @@ void NormalsSolverVCE::run(Config &config, Parallel::CommunicatorPtr comm)
       }
     } // for(iter)
 
-    // Inverse
-    if(!fileNameSigmax.empty())
+    // Covariance of selected parameters (from Cholesky factor)
+    if(!fileNameCovarianceSelected.empty() && parameterSelector)
     {
-      logStatus<<"inverte cholesky matrix and write standard deviations to <"<<fileNameSigmax<<">"<<Log::endl;
-      Vector sigmax = normals->sigmaParameter();
+      logStatus<<"compute covariance matrix of selected parameters and write to <"<<fileNameCovarianceSelected<<">"<<Log::endl;
+      const std::vector<UInt> index = parameterSelector->indexVector(normals->parameterNames());
+      Matrix covariance = normals->covarianceParameter(index);
       if(Parallel::isMaster(comm))
-        writeFileMatrix(fileNameSigmax, sigmax);
+        writeFileMatrix(fileNameCovarianceSelected, covariance);
     }
 
     // Covariance matrix
@@ -176,6 +230,15 @@ void NormalsSolverVCE::run(Config &config, Parallel::CommunicatorPtr comm)
       if(Parallel::isMaster(comm))
         writeFileMatrix(fileNameContribution, contrib);
     }
+
+    // Inverse (diagonal of the full covariance matrix if already computed)
+    if(!fileNameSigmax.empty())
+    {
+      logStatus<<"inverte cholesky matrix and write standard deviations to <"<<fileNameSigmax<<">"<<Log::endl;
+      Vector sigmax = normals->sigmaParameter();
+      if(Parallel::isMaster(comm))
+        writeFileMatrix(fileNameSigmax, sigmax);
+    }
   }
   catch(std::exception &e)
   {
@@ -16,6 +16,11 @@ This program reads a times series of \configFile{inputfileNormalequation}{normal
 with asscociated \configClass{timeSeries}{timeSeriesType} and setup a new combined normal equation system.
 For each parameter a \configClass{parametrizationTemporal}{parametrizationTemporalType} is used.
 
+Each temporal parameter gets the block structure of the input normal equations.
+The blocks of the combined normal matrix are distributed over the processes
+and each process reads only the blocks of the input normal equations it needs.
+The combined normal equations are written block wise by the owning processes.
+
 It can be used to estimate trend and annual spherical harmonic coefficients from monthly GRACE normal equations.
 )";
 
@@ -76,16 +81,16 @@ void NormalsTemporalCombination::run(Config &config, Parallel::CommunicatorPtr c
     MatrixDistributed  normal;
     Matrix             nTotal;
     NormalEquationInfo infoTotal;
+    std::vector<UInt>  blockIndexSpatial;
 
     Single::forEach(times.size(), [&](UInt idEpoch)
     {
-      // read normals
-      // ------------
-      Matrix N, n;
-      NormalEquationInfo info;
+      // read info and right hand sides
+      // ------------------------------
+      InFileNormalEquation file;
       try
       {
-        readFileNormalEquation(fileNameIn.at(idEpoch), info, N, n);
+        file.open(fileNameIn.at(idEpoch));
       }
       catch(std::exception &e)
       {
@@ -95,50 +100,78 @@ void NormalsTemporalCombination::run(Config &config, Parallel::CommunicatorPtr c
 
       // init normals
       // ------------
+      // each temporal parameter gets the block structure of the input normals
       const Vector factorTemporal = temporal->factors(times.at(idEpoch));
+      const UInt   parameterCount = file.parameterCount();
       if(normal.parameterCount()==0)
       {
-        std::vector<UInt> blockIndex(factorTemporal.size()+1);
-        for(UInt i=0; i<=factorTemporal.rows(); i++)
-          blockIndex.at(i) = i*N.rows();
+        blockIndexSpatial = file.info().blockIndex;
+        std::vector<UInt> blockIndex(1, 0);
+        for(UInt i=0; i<factorTemporal.rows(); i++)
+          for(UInt a=0; a<file.blockCount(); a++)
+            blockIndex.push_back(i*parameterCount+file.blockIndex(a+1));
         normal.initEmpty(blockIndex, comm);
-        nTotal = Matrix(normal.parameterCount(), n.columns());
-        infoTotal.lPl = Vector(n.columns());
+        nTotal = Matrix(normal.parameterCount(), file.rightHandSide().columns());
+        infoTotal.lPl = Vector(nTotal.columns());
       }
 
       // test dimension
       // --------------
-      if((n.rows() != normal.blockSize(0)) || (n.columns() != nTotal.columns()))
+      if((file.info().blockIndex != blockIndexSpatial) || (file.rightHandSide().columns() != nTotal.columns()))
         throw(Exception("Normal equation dimension mismatch"));
 
       // parameter names
       // ---------------
+      const std::vector<ParameterName> &parameterName = file.info().parameterName;
       if(!infoTotal.parameterName.size())
-        infoTotal.parameterName = info.parameterName;
+        infoTotal.parameterName = parameterName;
       else
         for(UInt i=0; i<infoTotal.parameterName.size(); i++)
-          if(!infoTotal.parameterName.at(i).combine(info.parameterName.at(i)))
-            logWarning<<"Parameter names do not match at index "<<i<<": '"<<infoTotal.parameterName.at(i).str()<<"' != '"<< info.parameterName.at(i).str()<<"'"<< Log::endl;
+          if(!infoTotal.parameterName.at(i).combine(parameterName.at(i)))
+            logWarning<<"Parameter names do not match at index "<<i<<": '"<<infoTotal.parameterName.at(i).str()<<"' != '"<< parameterName.at(i).str()<<"'"<< Log::endl;
 
       // setup normal matrix
       // -------------------
-      fillSymmetric(N);
-      for(UInt i=0; i<normal.blockCount(); i++)
-        for(UInt k=i; k<normal.blockCount(); k++)
+      // block (i,a),(k,b) = factor(i)*factor(k)*N(a,b),
+      // each process reads only the input blocks needed for its own blocks
+      const UInt blockCount = file.blockCount();
+      std::map<std::pair<UInt, UInt>, Matrix> blocks;
+      for(UInt i=0; i<factorTemporal.rows(); i++)
+        for(UInt k=i; k<factorTemporal.rows(); k++)
           if(factorTemporal(i) != 0 && factorTemporal(k) != 0)
-          {
-            normal.setBlock(i, k);
-
-            if(normal.isMyRank(i,k))
-              axpy(factorTemporal(i)*factorTemporal(k), N, normal.N(i,k));
-          }
+            for(UInt a=0; a<blockCount; a++)
+              for(UInt b=((i==k) ? a : 0); b<blockCount; b++)
+              {
+                const std::pair<UInt, UInt> ab(std::min(a,b), std::max(a,b));
+                if(!file.isBlockUsed(ab.first, ab.second))
+                  continue;
+                const UInt idxRow = i*blockCount+a;
+                const UInt idxCol = k*blockCount+b;
+                normal.setBlock(idxRow, idxCol);
+                if(!normal.isMyRank(idxRow, idxCol))
+                  continue;
+
+                auto iter = blocks.find(ab);
+                if(iter == blocks.end())
+                {
+                  Matrix N;
+                  file.readBlock(ab.first, ab.second, N);
+                  if(ab.first == ab.second)
+                    fillSymmetric(N);
+                  iter = blocks.emplace(ab, N).first;
+                }
+                if(a <= b)
+                  axpy(factorTemporal(i)*factorTemporal(k), iter->second, normal.N(idxRow, idxCol));
+                else
+                  axpy(factorTemporal(i)*factorTemporal(k), iter->second.trans(), normal.N(idxRow, idxCol));
+              }
 
       if(Parallel::isMaster(comm))
       {
-        for(UInt i=0; i<normal.blockCount(); i++)
-          axpy(factorTemporal(i), n, nTotal.row(normal.blockIndex(i), normal.blockSize(i)));
-        infoTotal.observationCount += info.observationCount;
-        infoTotal.lPl += info.lPl;
+        for(UInt i=0; i<factorTemporal.rows(); i++)
+          axpy(factorTemporal(i), file.rightHandSide(), nTotal.row(i*parameterCount, parameterCount));
+        infoTotal.observationCount += file.info().observationCount;
+        infoTotal.lPl += file.info().lPl;
       }
     });
 
@@ -73,8 +73,10 @@ void Orbit2EclipseFactor::run(Config &config, Parallel::CommunicatorPtr comm)
     {
       const OrbitArc orbit = orbitFile.readArc(arcNo);
       Matrix A(orbit.size(), dataCount);
+      std::vector<Vector3d> positions(orbit.size());
       for(UInt i=0; i<orbit.size(); i++)
-        A(i, 1) = eclipse->factor(orbit.at(i).time, orbit.at(i).position, ephemerides);
+        positions.at(i) = orbit.at(i).position;
+      copy(eclipse->factors(orbit.times(), positions, ephemerides), A.column(1));
 
       UInt idx = 2;
       for(auto &file: instrumentFile)
@@ -141,6 +141,15 @@ void PlotMap::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
         plotBasics.height = (maxB-minB)/(maxL-minL) * plotBasics.width;
     }
 
+    // size of a pixel in the output (conservative: the smaller of both directions)
+    Double rangeL = maxL-minL;
+    if(rangeL <= 0)
+      rangeL += 2*PI;
+    const Double pixelsPerCm = plotBasics.dpi/2.54;
+    const Angle  pixelSize(std::min(rangeL/(plotBasics.width*pixelsPerCm), (maxB-minB)/(plotBasics.height*pixelsPerCm)));
+    for(UInt i=0; i<layer.size(); i++)
+      layer.at(i)->setPixelSize(pixelSize);
+
     // create data files
     // -----------------
     logStatus<<"create temporary data files"<<Log::endl;
@@ -24,6 +24,12 @@ With setting \config{options:removeFiles}=false the last step is skipped and it
 to specific publication needs. Individual GMT settings are adjusted with \config{options:options}="\verb|FORMAT=value|",
 see \url{https://docs.generic-mapping-tools.org/latest/gmt.conf.html}.
 
+Large matrices with more rows or columns than pixels in the output (given by \config{options:width/height}
+and \config{options:dpi}) are reduced to blocks of coefficients which are smaller than a pixel.
+The \config{decimation} determines the value of a block computed from the non-zero coefficients
+(\config{mean}, \config{minimum}, \config{maximum}, or the value with the \config{maximumAbsolute}).
+This limits the temporary data files and the work of GMT to the number of pixels.
+
 \fig{!hb}{0.6}{plotMatrix}{fig:plotMatrix}{Upper left part of the DDK filter matrix.}
 )";
 
@@ -62,6 +68,9 @@ void PlotMatrix::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
     PlotLinePtr     gridLine;
     PlotColorbarPtr colorbar;
     PlotBasics      plotBasics;
+    std::string     choice;
+    enum Decimation {NONE, MEAN, MINIMUM, MAXIMUM, MAXIMUMABSOLUTE};
+    Decimation      decimation = MEAN;
 
     renameDeprecatedConfig(config, "annotationX", "majorTickSpacingX", date2time(2020, 4, 23));
     renameDeprecatedConfig(config, "frameX",      "minorTickSpacingX", date2time(2020, 4, 23));
@@ -85,6 +94,15 @@ void PlotMatrix::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
     readConfig(config, "gridLineSpacingY",  gridY,          Config::OPTIONAL, "",  "gridline spacing");
     readConfig(config, "gridLine",          gridLine,       Config::OPTIONAL, R"({"solid": {"width":"0.25", "color":"gray"}})", "The style of the grid lines.");
     readConfig(config, "colorbar",          colorbar,       Config::MUSTSET,  "",  "");
+    if(readConfigChoice(config, "decimation", choice, Config::OPTIONAL, "mean", "blocks of coefficients smaller than a pixel of the output (dpi), default: mean"))
+    {
+      if(readConfigChoiceElement(config, "none",            choice, "plot all coefficients"))                  decimation = NONE;
+      if(readConfigChoiceElement(config, "mean",            choice, "mean of the non-zero coefficients"))      decimation = MEAN;
+      if(readConfigChoiceElement(config, "minimum",         choice, "minimum of the non-zero coefficients"))   decimation = MINIMUM;
+      if(readConfigChoiceElement(config, "maximum",         choice, "maximum of the non-zero coefficients"))   decimation = MAXIMUM;
+      if(readConfigChoiceElement(config, "maximumAbsolute", choice, "coefficient with the largest magnitude")) decimation = MAXIMUMABSOLUTE;
+      endChoice(config);
+    }
     plotBasics.read(config, "PlotMatrix", fileNamePlot, title, "12", "");
     if(isCreateSchema(config)) return;
 
@@ -129,18 +147,58 @@ void PlotMatrix::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
     if(std::isnan(plotBasics.height))
       plotBasics.height = plotBasics.width*(maxY-minY)/(maxX-minX);
 
+    // blocks smaller than a pixel
+    // ---------------------------
+    const UInt columns = ((minX < M.columns()) && (minX <= maxX)) ? std::min(maxX, M.columns()-1)+1-minX : 0;
+    const UInt rows    = ((minY < M.rows())    && (minY <= maxY)) ? std::min(maxY, M.rows()-1)+1-minY    : 0;
+    UInt blockX = 1, blockY = 1;
+    if(decimation != NONE)
+    {
+      blockX = std::max(blockX, static_cast<UInt>(std::floor(columns/(plotBasics.width *plotBasics.dpi/2.54))));
+      blockY = std::max(blockY, static_cast<UInt>(std::floor(rows   /(plotBasics.height*plotBasics.dpi/2.54))));
+    }
+    const Bool isDecimated = (blockX > 1) || (blockY > 1);
+    const UInt countX = (columns+blockX-1)/blockX;
+    const UInt countY = (rows   +blockY-1)/blockY;
+    if(isDecimated)
+      logInfo<<"  decimated to ("<<countY<<" x "<<countX<<") blocks of ("<<blockY<<" x "<<blockX<<") coefficients"<<Log::endl;
+
     // write data files
     // ----------------
     logStatus<<"create temporary data files"<<Log::endl;
     {
       OutFile file(plotBasics.workingDirectory.append("data.dat"), std::ios::out | std::ios::binary);
-      for(UInt z=minY; z<=std::min(maxY, M.rows()-1); z++)
-        for(UInt s=minX; s<=std::min(maxX, M.columns()-1); s++)
-          if(M(z,s))
+      for(UInt idX=0; idX<countX; idX++)
+      {
+        std::vector<Double> values(countY, 0.);
+        std::vector<UInt>   count(countY, 0);
+        for(UInt s=minX+idX*blockX; s<std::min(minX+(idX+1)*blockX, minX+columns); s++)
+          for(UInt z=minY; z<minY+rows; z++)
+            if(M(z,s))
+            {
+              const UInt idY = (z-minY)/blockY;
+              Double &value = values.at(idY);
+              if(!count.at(idY)++ || (decimation == NONE))
+                value = M(z,s);
+              else if(decimation == MEAN)
+                value += M(z,s);
+              else if(decimation == MINIMUM)
+                value = std::min(value, M(z,s));
+              else if(decimation == MAXIMUM)
+                value = std::max(value, M(z,s));
+              else if(std::fabs(M(z,s)) > std::fabs(value))
+                value = M(z,s);
+            }
+
+        for(UInt idY=0; idY<countY; idY++)
+          if(count.at(idY))
           {
-            std::vector<Double> line = {Double(s), Double(z), M(z,s)};
+            std::vector<Double> line = {minX+(idX+0.5)*blockX-0.5, minY+(idY+0.5)*blockY-0.5, values.at(idY)};
+            if(decimation == MEAN)
+              line.at(2) /= count.at(idY);
             file.write(reinterpret_cast<char*>(line.data()), line.size()*sizeof(Double));
           }
+      }
     }
 
     // create scriptfile
@@ -153,8 +211,14 @@ void PlotMatrix::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
       file<<"gmt psbasemap -Y"<<-plotBasics.height-plotBasics.marginTitle<<"c -R"<<minX-0.5<<"/"<<maxX+0.5<<"/"<<minY-0.5<<"/"<<maxY+0.5<<" -JX"<<plotBasics.width<<"c/"<<-plotBasics.height<<"c";
       file<<" -BWSne -Bx"<<PlotBasics::axisTicks(FALSE, minX, maxX, annotationX, frameX, 0)<<" -By"<<PlotBasics::axisTicks(FALSE, minY, maxY, annotationY, frameY, 0);
       file<<" -O -K >> groopsPlot.ps"<<std::endl;
-      file<<"gmt xyz2grd data.dat -bi3d -Gdata.grd -r -V -I1 -R"<<std::endl;
-      file<<"gmt grdimage  data.grd --COLOR_NAN=255/255/255 -Q -R -J -CgroopsPlot.cpt";
+      if(!isDecimated)
+        file<<"gmt xyz2grd data.dat -bi3d -Gdata.grd -r -V -I1 -R"<<std::endl;
+      else
+        file<<"gmt xyz2grd data.dat -bi3d -Gdata.grd -r -V -I"<<blockX<<"/"<<blockY<<" -R"<<minX-0.5<<"/"<<minX-0.5+countX*blockX<<"/"<<minY-0.5<<"/"<<minY-0.5+countY*blockY<<std::endl;
+      file<<"gmt grdimage  data.grd --COLOR_NAN=255/255/255 -Q -R";
+      if(isDecimated)
+        file<<minX-0.5<<"/"<<maxX+0.5<<"/"<<minY-0.5<<"/"<<maxY+0.5;
+      file<<" -J -CgroopsPlot.cpt";
       if(gridLine)
         file<<" -Bxg"<<gridX<<"-0.5 -Byg"<<gridY<<"-0.5 --MAP_GRID_PEN_PRIMARY="<<gridLine->str();
       file<<" -O -K >> groopsPlot.ps"<<std::endl;
@@ -68,6 +68,17 @@ private:
   Bool estimateEpochSigmas;
   Bool estimateResiduals;
   Bool estimateSigmaShortTimeModel;
+  Bool keepDecorrelated;
+
+  // decorrelated observation equations of the current iteration
+  // (computed in buildNormals, reused in computeResiduals and computeRedundancies)
+  class DecorrelatedArc
+  {
+  public:
+    Matrix Wl, WA, WB;
+    Matrix CovSst1, CovSst2, CovAcc, WSst, WPod1, WPod2;
+  };
+  std::vector<DecorrelatedArc> decorrelatedArc;
 
   // normal equations
   // ----------------
@@ -256,6 +267,7 @@ void PreprocessingDualSst::run(Config &config, Parallel::CommunicatorPtr comm)
     readConfig(config, "iterationCount",         iterCount,        Config::DEFAULT,  "3",    "(maximum) number of iterations for the estimation of calibration parameter and error PSD");
     readConfig(config, "variableNameIterations", iterVariableName, Config::OPTIONAL, "",     "All output fileNames in preprocessing iteration are expanded with this variable prior to writing to disk");
     readConfig(config, "defaultBlockSize",       defaultBlockSize, Config::DEFAULT,  "2048", "block size of static normal equation blocks");
+    readConfig(config, "keepDecorrelatedArcs",   keepDecorrelated, Config::DEFAULT,  "0",    "reuse the decorrelated observation equations within an iteration (faster, but needs twice the memory)");
     if(isCreateSchema(config)) return;
 
     // =============================================
@@ -509,6 +521,9 @@ void PreprocessingDualSst::run(Config &config, Parallel::CommunicatorPtr comm)
       {
         logStatus<<"accumulate system of normal equations"<<Log::endl;
         normals.setNull();
+        decorrelatedArc.clear();
+        if(keepDecorrelated && (estimateResiduals || estimateEpochSigmas || estimateArcSigmas || estimateCovarianceFunctionVCE))
+          decorrelatedArc.resize(arcCount);
         Parallel::forEachProcess(arcCount, [this](UInt arcNo) {buildNormals(arcNo);}, processNo, comm);
         logStatus<<"collect system of normal equations"<<Log::endl;
         normals.reduceSum();
@@ -615,6 +630,7 @@ void PreprocessingDualSst::run(Config &config, Parallel::CommunicatorPtr comm)
         ePePod2 = redundancyPod2 = Matrix(covLengthPod2, 3); // for x,y,z
         Parallel::forEachProcess(arcCount, [this](UInt arcNo) {computeRedundancies(arcNo);}, processNo, comm);
       }
+      decorrelatedArc.clear(); // weights change with the new estimates
 
       // =============================================
 
@@ -926,6 +942,8 @@ void PreprocessingDualSst::buildNormals(UInt arcNo)
     decorrelate(arcNo, observationArc.at(arcNo).timesSst.size(),
                 observationArc.at(arcNo).timesPod1.size(), observationArc.at(arcNo).timesPod2.size(),
                 CovSst1, CovSst2, CovAcc, WSst, WPod1, WPod2, {Wl, WA, WB});
+    if(decorrelatedArc.size())
+      decorrelatedArc.at(arcNo) = {Wl, WA, WB, CovSst1, CovSst2, CovAcc, WSst, WPod1, WPod2}; // copy-on-write: accumulate modifies its own copy
 
     normals.accumulate(findInterval(arcNo), Wl, WA, WB);
   }
@@ -957,13 +975,27 @@ void PreprocessingDualSst::computeRedundancies(UInt arcNo)
 
     // Decorrelation
     // -------------
-    Matrix Wl = observationArc.at(arcNo).l;
-    Matrix WA = observationArc.at(arcNo).A;
-    Matrix WB = observationArc.at(arcNo).B;
-    Matrix CovSst1, CovSst2, CovAcc, WSst, WPod1, WPod2;
-    decorrelate(arcNo, observationArc.at(arcNo).timesSst.size(),
-                observationArc.at(arcNo).timesPod1.size(), observationArc.at(arcNo).timesPod2.size(),
-                CovSst1, CovSst2, CovAcc, WSst, WPod1, WPod2, {Wl, WA, WB});
+    Matrix Wl, WA, WB, WSst, WPod1, WPod2;
+    if(decorrelatedArc.size() && decorrelatedArc.at(arcNo).Wl.size())
+    {
+      std::swap(Wl,    decorrelatedArc.at(arcNo).Wl);
+      std::swap(WA,    decorrelatedArc.at(arcNo).WA);
+      std::swap(WB,    decorrelatedArc.at(arcNo).WB);
+      std::swap(WSst,  decorrelatedArc.at(arcNo).WSst);
+      std::swap(WPod1, decorrelatedArc.at(arcNo).WPod1);
+      std::swap(WPod2, decorrelatedArc.at(arcNo).WPod2);
+      decorrelatedArc.at(arcNo) = DecorrelatedArc();
+    }
+    else
+    {
+      Wl = observationArc.at(arcNo).l;
+      WA = observationArc.at(arcNo).A;
+      WB = observationArc.at(arcNo).B;
+      Matrix CovSst1, CovSst2, CovAcc;
+      decorrelate(arcNo, observationArc.at(arcNo).timesSst.size(),
+                  observationArc.at(arcNo).timesPod1.size(), observationArc.at(arcNo).timesPod2.size(),
+                  CovSst1, CovSst2, CovAcc, WSst, WPod1, WPod2, {Wl, WA, WB});
+    }
 
     // eliminate arc dependent parameters
     // ----------------------------------
@@ -1087,15 +1119,22 @@ void PreprocessingDualSst::varianceComponentEstimationPsd(
                                +  R(std::min(i+count,k),       std::max(i+count,k));
       }
 
+    // inner products with all columns of CosTransform
+    e1  = Vce::cosTransformTrans(e1);
+    e2  = Vce::cosTransformTrans(e2);
+    e12 = Vce::cosTransformTrans(e12);
+    r1  = Vce::cosTransformTrans(r1);
+    r2  = Vce::cosTransformTrans(r2);
+    r12 = Vce::cosTransformTrans(r12);
+
     for(UInt idFreq=0; idFreq<Psd1.rows(); idFreq++)
     {
-      const_MatrixSliceRef cov(CosTransform.column(idFreq));
-      const Double ePe1Tmp         = std::pow(sigma1,  2) * Psd1 (idFreq, 0) * inner(e1,  cov);
-      const Double ePe2Tmp         = std::pow(sigma2,  2) * Psd2 (idFreq, 0) * inner(e2,  cov);
-      const Double ePe12Tmp        = std::pow(sigma12, 2) * Psd12(idFreq, 0) * inner(e12, cov);
-      const Double redundancy1Tmp  = std::pow(sigma1,  2) * Psd1 (idFreq, 0) * inner(r1,  cov);
-      const Double redundancy2Tmp  = std::pow(sigma2,  2) * Psd2 (idFreq, 0) * inner(r2,  cov);
-      const Double redundancy12Tmp = std::pow(sigma12, 2) * Psd12(idFreq, 0) * inner(r12, cov);
+      const Double ePe1Tmp         = std::pow(sigma1,  2) * Psd1 (idFreq, 0) * e1(idFreq);
+      const Double ePe2Tmp         = std::pow(sigma2,  2) * Psd2 (idFreq, 0) * e2(idFreq);
+      const Double ePe12Tmp        = std::pow(sigma12, 2) * Psd12(idFreq, 0) * e12(idFreq);
+      const Double redundancy1Tmp  = std::pow(sigma1,  2) * Psd1 (idFreq, 0) * r1(idFreq);
+      const Double redundancy2Tmp  = std::pow(sigma2,  2) * Psd2 (idFreq, 0) * r2(idFreq);
+      const Double redundancy12Tmp = std::pow(sigma12, 2) * Psd12(idFreq, 0) * r12(idFreq);
 
       ePe1 (idFreq, 0)        += ePe1Tmp;
       ePe2 (idFreq, 0)        += ePe2Tmp;
@@ -1146,7 +1185,27 @@ void PreprocessingDualSst::computeResiduals(UInt arcNo)
     // eliminate arc dependent parameters
     // ----------------------------------
     Matrix CovSst1, CovSst2, CovAcc, WSst, WPod1, WPod2;
-    if(observationArc.at(arcNo).B.size())
+    if(decorrelatedArc.size() && decorrelatedArc.at(arcNo).Wl.size())
+    {
+      const DecorrelatedArc &arc = decorrelatedArc.at(arcNo);
+      CovSst1 = arc.CovSst1;
+      CovSst2 = arc.CovSst2;
+      CovAcc  = arc.CovAcc;
+      WSst    = arc.WSst;
+      if(arc.WB.size())
+      {
+        Matrix We = arc.Wl;
+        Matrix WB = arc.WB;
+        normals.designMatMult(findInterval(arcNo), -1., arc.WA, x, We);
+
+        Vector tau = QR_decomposition(WB);
+        QTransMult(WB, tau, We); // transform observations: l:= Q'l
+        Matrix y = We.row(0, tau.rows());
+        triangularSolve(1., WB.row(0, tau.rows()), y);
+        matMult(-1, observationArc.at(arcNo).B, y, e);
+      }
+    }
+    else if(observationArc.at(arcNo).B.size())
     {
       Matrix We = e;
       Matrix WB = observationArc.at(arcNo).B;
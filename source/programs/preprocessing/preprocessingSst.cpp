@@ -26,6 +26,12 @@ variance component estimation fails and assigns too much weight to the POD data.
 in the iteration. This factor should also applied as \config{sigma} in \configClass{observation}{observationType}
 for computation of the final solution e.g. with \program{NormalsSolverVCE}.
 
+The observation equations of all arcs are computed only once and kept in memory.
+In each iteration they are decorrelated with the current covariances to accumulate the normal equations
+and again to compute the residuals and redundancies. With \config{keepDecorrelatedArcs}
+the decorrelated observation equations are kept from the accumulation of the normals instead,
+which saves the repeated decorrelation but needs twice the memory.
+
 Short time variations of the gravity field can be co-estimated together with the static/monthly
 mean gravity field. The short time parameters must also be set in \configClass{observation:parametrizationGravity}{parametrizationGravityType} and
 can then be selected by \configClass{estimateShortTimeVariations:parameterSelection}{parameterSelectorType}.
@@ -75,6 +81,17 @@ private:
   Bool estimateEpochSigmas;
   Bool estimateResiduals;
   Bool estimateSigmaShortTimeModel;
+  Bool keepDecorrelated;
+
+  // decorrelated observation equations of the current iteration
+  // (computed in buildNormals, reused in computeResiduals and computeRedundancies)
+  class DecorrelatedArc
+  {
+  public:
+    Matrix Wl, WA, WB;
+    Matrix WSst, WPod1, WPod2;
+  };
+  std::vector<DecorrelatedArc> decorrelatedArc;
 
   // normal equations
   // ----------------
@@ -230,6 +247,7 @@ void PreprocessingSst::run(Config &config, Parallel::CommunicatorPtr comm)
     readConfig(config, "iterationCount",         iterCount,          Config::DEFAULT,  "3",    "(maximum) number of iterations for the estimation of calibration parameter and error PSD");
     readConfig(config, "variableNameIterations", iterVariableName,   Config::OPTIONAL, "",     "All output fileNames in preprocessing iteration are expanded with this variable prior to writing to disk");
     readConfig(config, "defaultBlockSize",       defaultBlockSize,   Config::DEFAULT,  "2048", "block size of static normal equation blocks");
+    readConfig(config, "keepDecorrelatedArcs",   keepDecorrelated,   Config::DEFAULT,  "0",    "reuse the decorrelated observation equations within an iteration (faster, but needs twice the memory)");
     if(isCreateSchema(config)) return;
 
     // =============================================
@@ -439,6 +457,9 @@ void PreprocessingSst::run(Config &config, Parallel::CommunicatorPtr comm)
       {
         logStatus<<"accumulate system of normal equations"<<Log::endl;
         normals.setNull();
+        decorrelatedArc.clear();
+        if(keepDecorrelated && (estimateResiduals || estimateEpochSigmas || estimateArcSigmas || estimateCovarianceFunctionVCE || estimateSigmasCovSst))
+          decorrelatedArc.resize(arcCount);
         Parallel::forEachProcess(arcCount, [this](UInt arcNo) {buildNormals(arcNo);}, processNo, comm);
         logStatus<<"collect system of normal equations"<<Log::endl;
         normals.reduceSum();
@@ -528,6 +549,7 @@ void PreprocessingSst::run(Config &config, Parallel::CommunicatorPtr comm)
         ePeCovSst = redundancyCovSst = Vector(sigmasCovSst.rows());
         Parallel::forEachProcess(arcCount, [this](UInt arcNo) {computeRedundancies(arcNo);}, processNo, comm);
       }
+      decorrelatedArc.clear(); // weights change with the new estimates
 
       // =============================================
 
@@ -784,6 +806,8 @@ void PreprocessingSst::buildNormals(UInt arcNo)
     decorrelate(arcNo, observationArc.at(arcNo).timesSst.size(),
                 observationArc.at(arcNo).timesPod1.size(), observationArc.at(arcNo).timesPod2.size(),
                 WSst, WPod1, WPod2, {Wl, WA, WB});
+    if(decorrelatedArc.size())
+      decorrelatedArc.at(arcNo) = {Wl, WA, WB, WSst, WPod1, WPod2}; // copy-on-write: accumulate modifies its own copy
 
     normals.accumulate(findInterval(arcNo), Wl, WA, WB);
   }
@@ -815,11 +839,23 @@ void PreprocessingSst::computeRedundancies(UInt arcNo)
 
     // Decorrelation
     // -------------
-    Matrix Wl = observationArc.at(arcNo).l;
-    Matrix WA = observationArc.at(arcNo).A;
-    Matrix WB = observationArc.at(arcNo).B;
-    Matrix WSst, WPod1, WPod2;
-    decorrelate(arcNo, countSst, countPod1, countPod2, WSst, WPod1, WPod2, {Wl, WA, WB});
+    Matrix Wl, WA, WB, WSst, WPod1, WPod2;
+    if(decorrelatedArc.size() && decorrelatedArc.at(arcNo).Wl.size())
+    {
+      std::swap(Wl,    decorrelatedArc.at(arcNo).Wl);
+      std::swap(WA,    decorrelatedArc.at(arcNo).WA);
+      std::swap(WB,    decorrelatedArc.at(arcNo).WB);
+      std::swap(WSst,  decorrelatedArc.at(arcNo).WSst);
+      std::swap(WPod1, decorrelatedArc.at(arcNo).WPod1);
+      std::swap(WPod2, decorrelatedArc.at(arcNo).WPod2);
+    }
+    else
+    {
+      Wl = observationArc.at(arcNo).l;
+      WA = observationArc.at(arcNo).A;
+      WB = observationArc.at(arcNo).B;
+      decorrelate(arcNo, countSst, countPod1, countPod2, WSst, WPod1, WPod2, {Wl, WA, WB});
+    }
 
     // eliminate arc dependent parameters
     // ----------------------------------
@@ -958,10 +994,20 @@ void PreprocessingSst::computeResiduals(UInt arcNo)
     // ----------------------------------
     if(observationArc.at(arcNo).B.size())
     {
-      Matrix We = e;
-      Matrix WB = observationArc.at(arcNo).B;
-      Matrix WSst, WPod1, WPod2;
-      decorrelate(arcNo, countSst, countPod1, countPod2, WSst, WPod1, WPod2, {We, WB});
+      Matrix We, WB;
+      if(decorrelatedArc.size() && decorrelatedArc.at(arcNo).Wl.size())
+      {
+        We = decorrelatedArc.at(arcNo).Wl;
+        WB = decorrelatedArc.at(arcNo).WB;
+        normals.designMatMult(findInterval(arcNo), -1., decorrelatedArc.at(arcNo).WA, x, We);
+      }
+      else
+      {
+        We = e;
+        WB = observationArc.at(arcNo).B;
+        Matrix WSst, WPod1, WPod2;
+        decorrelate(arcNo, countSst, countPod1, countPod2, WSst, WPod1, WPod2, {We, WB});
+      }
       Vector tau = QR_decomposition(WB);
       QTransMult(WB, tau, We); // transform observations: l:= Q'l
       Matrix y = We.row(0, tau.rows());
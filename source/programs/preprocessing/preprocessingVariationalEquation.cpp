@@ -37,6 +37,15 @@ To improve the numerical stability a reference ellipse can be reduced beforehand
 Mathematically the result is the same, but as the large central term is removed before and restored
 afterwards more digits are available for the computation.
 
+With \config{checkpoint} each finished arc is stored immediately in a separate file beside
+\configFile{outputfileVariational}{variationalEquation} (with an appended arc number).
+If an interrupted run is started again, only the missing arcs are computed.
+The arc files are removed after the complete output is written.
+
+The state transition matrices can be stored with a reduced relative accuracy \config{stateAccuracy}
+(e.g. 1e-7, about float precision). Together with a compressed output file (extension *.gz)
+this reduces the file size considerably.
+
 The integrated orbit should be fitted to observations afterwards by the programs
 \program{PreprocessingVariationalEquationOrbitFit} and/or \program{PreprocessingVariationalEquationSstFit}.
 They apply a least squares adjustment by estimating some satellite parameters (e.g. an accelerometer bias).
@@ -49,6 +58,7 @@ as \configFile{inputfileOrbit}{instrument} and introducing the \config{estimated
 
 #include "programs/program.h"
 #include "base/equinoctial.h"
+#include "inputOutput/system.h"
 #include "files/fileMatrix.h"
 #include "files/fileInstrument.h"
 #include "files/fileSatelliteModel.h"
@@ -58,6 +68,7 @@ as \configFile{inputfileOrbit}{instrument} and introducing the \config{estimated
 #include "classes/forces/forces.h"
 #include "classes/gravityfield/gravityfield.h"
 #include "classes/parametrizationAcceleration/parametrizationAcceleration.h"
+#include <cstdio>
 
 /***** CLASS ***********************************/
 
@@ -104,6 +115,8 @@ void PreprocessingVariationalEquation::run(Config &config, Parallel::Communicato
     FileName fileNameSatellite;
     FileName orbitName, starCameraName, accName;
     FileName fileNameSolution;
+    Bool     checkpoint;
+    Double   stateAccuracy;
     GM = 0;
 
     renameDeprecatedConfig(config, "satelliteModel", "inputfileSatelliteModel", date2time(2020, 8, 19));
@@ -132,6 +145,8 @@ void PreprocessingVariationalEquation::run(Config &config, Parallel::Communicato
       readConfig(config, "GM", GM, Config::DEFAULT,  STRING_DEFAULT_GM, "geocentric gravitational constant used for elliptical reference orbit");
       endSequence(config);
     }
+    readConfig(config, "stateAccuracy",     stateAccuracy,     Config::DEFAULT,  "0",   "store state matrices rounded to this relative accuracy (e.g. 1e-7) for better compression (*.gz), 0: full precision");
+    readConfig(config, "checkpoint",        checkpoint,        Config::DEFAULT,  "0",   "store finished arcs, a restart computes only the missing arcs");
     if(isCreateSchema(config)) return;
 
     if(integrationDegree%2 == 0)
@@ -185,7 +200,23 @@ void PreprocessingVariationalEquation::run(Config &config, Parallel::Communicato
     logStatus<<"integrate arcs"<<Log::endl;
     maxPosDiff = 0;
     std::vector<VariationalEquationArc> arcs(orbitFile.arcCount());
-    Parallel::forEach(arcs, [this](UInt arcNo) {return computeArc(arcNo);}, comm);
+    auto fileNameArc = [&](UInt arcNo) {return fileNameOutVariational.appendBaseName(".arc"+arcNo%"%05i"s);};
+    Parallel::forEach(arcs, [&](UInt arcNo)
+    {
+      if(!checkpoint)
+        return computeArc(arcNo);
+      // restore arc from previous run
+      const FileName fileName = fileNameArc(arcNo);
+      if(System::exists(fileName))
+        return FileVariationalEquation(fileName).readArc(0);
+      VariationalEquationArc arc = computeArc(arcNo);
+      // write to temporary file first: an interrupted write must not leave an incomplete arc
+      const FileName fileNameTmp = fileName.appendBaseName(".tmp");
+      writeFileVariationalEquation(fileNameTmp, satellite, arc, stateAccuracy);
+      if(std::rename(fileNameTmp.c_str(), fileName.c_str()) != 0)
+        throw(Exception("cannot rename <"+fileNameTmp.str()+"> to <"+fileName.str()+">"));
+      return arc;
+    }, comm);
     Parallel::reduceMax(maxPosDiff, 0, comm);
     logInfo<<"  max diff (orbit-reference orbit) "<<maxPosDiff<<" m"<<Log::endl;
 
@@ -194,7 +225,10 @@ void PreprocessingVariationalEquation::run(Config &config, Parallel::Communicato
     if(Parallel::isMaster(comm))
     {
       logStatus<<"write variational equation to file <"<<fileNameOutVariational<<">"<<Log::endl;
-      writeFileVariationalEquation(fileNameOutVariational, satellite, arcs);
+      writeFileVariationalEquation(fileNameOutVariational, satellite, arcs, stateAccuracy);
+      if(checkpoint)
+        for(UInt arcNo=0; arcNo<arcs.size(); arcNo++)
+          System::remove(fileNameArc(arcNo));
     }
 
     if(Parallel::isMaster(comm) && !fileNameOutOrbit.empty())
@@ -383,13 +417,20 @@ VariationalEquationArc PreprocessingVariationalEquation::computeArc(UInt arcNo)
     Matrix pos0  = integrate2Position(deltaT, g);
     Vector state = leastSquares(Matrix(PosState), posApprox-posRef-pos0);
     matMult(1, PosState, state, pos0);
-    pos0 = solve(deltaT, tensor, pos0 - (posApprox-posRef)) + posApprox;
 
     // =============================================
 
-    // State with indirect effect
-    // --------------------------
-    PosState = solve(deltaT, tensor, PosState);
+    // Position and state with indirect effect
+    // ---------------------------------------
+    // solved together for all columns (position + 6 states)
+    {
+      Matrix rhs(3*epochCount, 1+PosState.columns());
+      copy(pos0 - (posApprox-posRef), rhs.column(0));
+      copy(PosState, rhs.column(1, PosState.columns()));
+      const Matrix x = solve(deltaT, tensor, rhs);
+      pos0     = x.column(0) + posApprox;
+      PosState = x.column(1, PosState.columns());
+    }
 
     Matrix AccState(3*epochCount, 6);
     for(UInt i=0; i<epochCount; i++)
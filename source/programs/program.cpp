@@ -16,13 +16,14 @@
 enum Tags {tag_, __VA_ARGS__};\
 const char *tagStrings[] = {#tag_ _GROOPS_FOR_EACH(GROOPS_STRINGIFY, __VA_ARGS__)};
 
+#include <map>
 #include "base/import.h"
 #include "config/configRegister.h"
 #include "program.h"
 
 /***********************************************/
 
-std::vector<Program::Program*> Program::Program::programList(Program *program)
+const std::vector<Program::Program*> &Program::Program::programList(Program *program)
 {
   static std::vector<Program*> list;
   if(program != nullptr)
@@ -40,7 +41,23 @@ void Program::Program::sortList(std::vector<Program*> &list)
 
 /***********************************************/
 
-std::vector<Program::RenamedProgram::Renamed>
+Program::Program *Program::Program::find(const std::string &name)
+{
+  static const std::map<std::string, Program*> table = []()
+  {
+    std::map<std::string, Program*> table;
+    for(Program *program : programList())
+      table[program->name()] = program;
+    return table;
+  }();
+
+  auto iter = table.find(name);
+  return (iter != table.end()) ? iter->second : nullptr;
+}
+
+/***********************************************/
+
+const std::vector<Program::RenamedProgram::Renamed> &
   Program::RenamedProgram::renamedList(const Renamed &renamed)
 {
   static std::vector<Renamed> list;
@@ -50,3 +67,19 @@ std::vector<Program::RenamedProgram::Renamed>
 }
 
 /***********************************************/
+
+const Program::RenamedProgram::Renamed *Program::RenamedProgram::find(const std::string &oldName)
+{
+  static const std::map<std::string, const Renamed*> table = []()
+  {
+    std::map<std::string, const Renamed*> table;
+    for(const Renamed &renamed : renamedList())
+      table[renamed.oldName] = &renamed;
+    return table;
+  }();
+
+  auto iter = table.find(oldName);
+  return (iter != table.end()) ? iter->second : nullptr;
+}
+
+/***********************************************/
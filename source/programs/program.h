@@ -135,8 +135,12 @@ public:
   virtual Bool              isSingleProcess()   const = 0;
   virtual void              run(Config &config, Parallel::CommunicatorPtr comm) const = 0;
 
-  static std::vector<Program*> programList(Program *program=nullptr);
+  static const std::vector<Program*> &programList(Program *program=nullptr);
   static void sortList(std::vector<Program*> &list);
+
+  /** @brief Registered program with @p name or nullptr.
+  * The lookup table is built at the first call (after all programs are registered). */
+  static Program *find(const std::string &name);
 };
 
 /***** CLASS ***********************************/
@@ -158,7 +162,10 @@ public:
   RenamedProgram(const Renamed &renamed) {renamedList(renamed);}
   virtual ~RenamedProgram() {}
 
-  static std::vector<Renamed> renamedList(const Renamed &renamed = Renamed("", "", Time()));
+  static const std::vector<Renamed> &renamedList(const Renamed &renamed = Renamed("", "", Time()));
+
+  /** @brief Renamed program with the old name @p oldName or nullptr. */
+  static const Renamed *find(const std::string &oldName);
 };
 
 } // namespace Program
@@ -47,6 +47,7 @@ The \configFile{inputfileOrbit}{instrument}s must contain positions, velocities,
 
 #include "programs/program.h"
 #include "files/fileInstrument.h"
+#include "misc/grace/graceKBandGeometry.h"
 
 /***** CLASS ***********************************/
 
@@ -87,22 +88,7 @@ void SimulateSatelliteTracking::run(Config &config, Parallel::CommunicatorPtr co
       OrbitArc orbit2 = orbit2File.readArc(arcNo);
       Arc::checkSynchronized({orbit1, orbit2});
 
-      SatelliteTrackingArc arc;
-      for(UInt i=0; i<orbit1.size(); i++)
-      {
-        Vector3d vrange         = orbit2.at(i).position     - orbit1.at(i).position;
-        Vector3d vvelocity      = orbit2.at(i).velocity     - orbit1.at(i).velocity;
-        Vector3d vacceleration  = orbit2.at(i).acceleration - orbit1.at(i).acceleration;
-
-        SatelliteTrackingEpoch epoch;
-        epoch.time              = orbit1.at(i).time;
-        epoch.range             = vrange.norm();
-        epoch.rangeRate         = inner(vrange,vvelocity)/epoch.range;
-        epoch.rangeAcceleration = (vvelocity.quadsum()-pow(epoch.rangeRate,2))/epoch.range
-                                + inner(vrange,vacceleration)/epoch.range;
-        arc.push_back(epoch);
-      }
-      return arc;
+      return GraceKBandGeometry::satelliteTracking(orbit1, orbit2);
     }, comm);
 
     if(Parallel::isMaster(comm))
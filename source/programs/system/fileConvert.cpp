@@ -180,11 +180,11 @@ void FileConvert::run(Config &config, Parallel::CommunicatorPtr /*comm*/)
 
       if(!fileNameOutput.empty())
       {
-        std::vector<Matrix> data(file.nodeCount());
+        OutFileGriddedDataTimeSeries fileOut(fileNameOutput, file.splineDegree(), file.times(), file.grid(), file.dataCount());
         for(UInt i=0; i<file.nodeCount(); i++)
-          data.at(i) = file.data(i);
-        writeFileGriddedDataTimeSeries(fileNameOutput, file.splineDegree(), file.times(), file.grid(), data);
+          fileOut.writeNode(file.data(i));
       }
+      return;
     }
 
     // =============================================
@@ -17,6 +17,15 @@ Runs \config{program}s in a group, which can be used to structure a config file.
 If \config{catchErrors} is enabled and an error occurs, the remaining \config{program}s
 are skipped and execution continues with \config{errorProgram}s, in case any are defined.
 Otherwise an exception is thrown.
+
+With \config{processCountPerProgram} greater than zero the \config{program}s are executed
+concurrently on groups of processes of this size. The dependencies between the programs are derived
+from the file names of all \config{inputfile*} and \config{outputfile*} elements: a program starts
+when all previous programs writing its input files or reading/writing its output files have finished.
+Programs with file names that cannot be resolved in advance (e.g. containing loop variables of
+nested programs), with loops/conditions in their elements, or without any files are executed
+in the original order after all previous programs (barrier). One process schedules the programs,
+so at least three processes are needed, otherwise the programs are executed sequentially.
 )";
 
 /***********************************************/
@@ -43,11 +52,15 @@ void GroupPrograms::run(Config &config, Parallel::CommunicatorPtr comm)
   try
   {
     Bool          continueAfterError = FALSE;
+    UInt          processCount = 0;
+    Bool          parallelLog  = TRUE;
     ProgramConfig programs, errorPrograms;
 
     renameDeprecatedConfig(config, "programme", "program", date2time(2020, 6, 3));
 
     readConfig(config, "program", programs, Config::OPTIONAL, "", "");
+    readConfig(config, "processCountPerProgram", processCount, Config::DEFAULT,  "0", "run independent programs concurrently on groups of processes (0: sequential)");
+    readConfig(config, "parallelLog",            parallelLog,  Config::DEFAULT,  "1", "write log output of all concurrently running programs");
     if(readConfigSequence(config, "catchErrors", Config::OPTIONAL, "", ""))
     {
       continueAfterError = TRUE;
@@ -61,7 +74,7 @@ void GroupPrograms::run(Config &config, Parallel::CommunicatorPtr comm)
       Parallel::broadCastExceptions(comm, [&](Parallel::CommunicatorPtr comm)
       {
         auto varListTmp = config.getVarList();
-        programs.run(varListTmp, comm);
+        programs.runParallel(varListTmp, processCount, parallelLog, comm);
       });
     }
     catch(std::exception &e)
@@ -24,12 +24,22 @@ and the other processes are assigned to iterations according to \config{processC
 For example, running a loop containing three iterations on 13 processes with \config{processCountPerIteration}=\verb|4|,
 runs the three iterations in parallel, with each iteration being assigned four processes.
 With \config{parallelLog}=\verb|yes| all processes write output to screen and the log file.
+
+With \config{prefetchInputs}=\verb|yes| the file names of all \verb|inputfile*| elements of the next iteration
+are resolved in advance and the files are read in the background while the current iteration is computed.
+This warms the file system cache, which helps with slow or network file systems.
+File names depending on variables which are not known before the iteration (e.g. inner loops) are not prefetched.
+The next iteration of the loop is evaluated before the programs of the current iteration are executed,
+so it must not depend on files created by them. If the iterations are computed in parallel,
+each group of processes is assigned its next iteration in advance, so the input files of the next system
+(e.g. monthly normal equations solved with \program{NormalsSolverVCE}) are read while the current one is computed.
 )";
 
 /***********************************************/
 
 #include "programs/program.h"
 #include "classes/loop/loop.h"
+#include <future>
 
 /***** CLASS ***********************************/
 
@@ -37,6 +47,8 @@ With \config{parallelLog}=\verb|yes| all processes write output to screen and th
 * @ingroup programsGroup */
 class LoopPrograms
 {
+  static void prefetch(const std::set<std::string> &fileNames);
+
 public:
   void run(Config &config, Parallel::CommunicatorPtr comm);
 };
@@ -54,6 +66,7 @@ void LoopPrograms::run(Config &config, Parallel::CommunicatorPtr comm)
     Bool          continueAfterError;
     UInt          processCount;
     Bool          parallelLog;
+    Bool          prefetchInputs;
     ProgramConfig programs;
 
     renameDeprecatedConfig(config, "programme",     "program", date2time(2020, 6, 3));
@@ -64,6 +77,7 @@ void LoopPrograms::run(Config &config, Parallel::CommunicatorPtr comm)
     readConfig(config, "continueAfterError",       continueAfterError, Config::DEFAULT,  "0", "continue with next iteration after error, otherwise throw exception");
     readConfig(config, "processCountPerIteration", processCount,       Config::DEFAULT,  "0", "0: use all processes for each iteration");
     readConfig(config, "parallelLog",              parallelLog,        Config::DEFAULT,  "1", "write to screen/log file from all processing nodes in parallelized loops");
+    readConfig(config, "prefetchInputs",           prefetchInputs,     Config::DEFAULT,  "0", "read input files of the next iteration in the background");
     readConfig(config, "program",                  programs,           Config::OPTIONAL, "",  "");
     if(isCreateSchema(config)) return;
 
@@ -76,10 +90,23 @@ void LoopPrograms::run(Config &config, Parallel::CommunicatorPtr comm)
     {
       UInt iter = 0;
       Log::startTimer();
-      while(loopPtr->iteration(varList))
+      VariableList varListNext;
+      std::future<void> prefetching;
+      Bool valid = loopPtr->iteration(varList);
+      while(valid)
       {
         logStatus<<"=== "<<iter+1<<". loop ==="<<Log::endl;
         Log::loopTimer(iter++, loopPtr->count());
+
+        if(prefetchInputs)
+        {
+          // evaluate next iteration in advance
+          varListNext = varList;
+          valid = loopPtr->iteration(varListNext);
+          if(valid && Parallel::isMaster(comm))
+            prefetching = std::async(std::launch::async, &LoopPrograms::prefetch, programs.inputFileNames(varListNext));
+        }
+
         try
         {
           Parallel::broadCastExceptions(comm, [&](Parallel::CommunicatorPtr comm)
@@ -95,6 +122,13 @@ void LoopPrograms::run(Config &config, Parallel::CommunicatorPtr comm)
           if(Parallel::isMaster(comm))
             logError<<e.what()<<"  continue..."<<Log::endl;
         }
+
+        if(prefetching.valid())
+          prefetching.wait();
+        if(prefetchInputs)
+          varList = varListNext;
+        else
+          valid = loopPtr->iteration(varList);
       }
       Log::loopTimerEnd(loopPtr->count());
       return;
@@ -134,21 +168,44 @@ void LoopPrograms::run(Config &config, Parallel::CommunicatorPtr comm)
     {
       // clients
       // -------
+      auto request = [&]()
+      {
+        UInt i;
+        Parallel::send(Parallel::myRank(commLoop), 0, commLoop); // which process needs work?
+        Parallel::receive(i, 0, commLoop);
+        return i;
+      };
+
       UInt k=0;
+      UInt iNext = NULLINDEX;
+      Bool isAssigned = FALSE; // next iteration already requested (prefetchInputs)
+      VariableList varListNext;
+      std::future<void> prefetching;
       for(;;)
       {
         UInt i;
         if(Parallel::isMaster(commLocal))
-        {
-          Parallel::send(Parallel::myRank(commLoop), 0, commLoop);
-          Parallel::receive(i, 0, commLoop);
-        }
+          i = isAssigned ? iNext : request();
         Parallel::broadCast(i, 0, commLocal);
         if(i == NULLINDEX) // end signal?
           break;
         for(; k<=i; k++) // step to current loop number
           loopPtr->iteration(varList);
 
+        // request next iteration in advance and read its input files in the background
+        if(prefetchInputs && Parallel::isMaster(commLocal))
+        {
+          iNext      = request();
+          isAssigned = TRUE;
+          if(iNext != NULLINDEX)
+          {
+            varListNext = varList;
+            for(; k<=iNext; k++)
+              loopPtr->iteration(varListNext);
+            prefetching = std::async(std::launch::async, &LoopPrograms::prefetch, programs.inputFileNames(varListNext));
+          }
+        }
+
         Bool outputOld = Log::enableOutput(parallelLog && Parallel::isMaster(commLocal));
         try
         {
@@ -169,6 +226,11 @@ void LoopPrograms::run(Config &config, Parallel::CommunicatorPtr comm)
             logError<<e.what()<<"  continue..."<<Log::endl;
         }
         Log::enableOutput(outputOld);
+
+        if(prefetching.valid())
+          prefetching.wait();
+        if(isAssigned && (iNext != NULLINDEX))
+          varList = varListNext;
       }
       Parallel::barrier(comm);
     } // clients
@@ -180,3 +242,17 @@ void LoopPrograms::run(Config &config, Parallel::CommunicatorPtr comm)
 }
 
 /***********************************************/
+
+// reads the files to warm the file system cache, errors are ignored
+void LoopPrograms::prefetch(const std::set<std::string> &fileNames)
+{
+  std::vector<char> buffer(1<<20);
+  for(const auto &fileName : fileNames)
+  {
+    std::ifstream file(fileName, std::ios::binary);
+    while(file.read(buffer.data(), buffer.size()))
+      ;
+  }
+}
+
+/***********************************************/